@@ -0,0 +1,185 @@
+#include <string>
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+
+#include <base/logging.hpp>
+#include <hlp/hlp.hpp>
+#include <hlp/parser.hpp>
+
+namespace
+{
+constexpr auto NAME = "benchParser";
+constexpr auto TARGET = "/targetField";
+
+/**
+ * @brief Initializes logging and the TZDB once and returns the date parser builder.
+ */
+hlp::ParserBuilder initAndGetDateParser()
+{
+    static bool hasInitiated = false;
+    if (!hasInitiated)
+    {
+        logging::testInit();
+        hlp::initTZDB("data/tzdb", false);
+        hasInitiated = true;
+    }
+    return hlp::parsers::getDateParser;
+}
+
+/**
+ * @brief Runs the full parser pipeline (syntax, semantic and mapping) over the input, reporting
+ * ns/event and bytes/sec.
+ */
+void runParser(benchmark::State& state, const hlp::parser::Parser& parser, std::string_view input)
+{
+    json::Json event;
+    for (auto _ : state)
+    {
+        auto error = hlp::parser::run(parser, input, event);
+        benchmark::DoNotOptimize(error);
+        benchmark::ClobberMemory();
+
+        if (error)
+        {
+            state.SkipWithError(error->message.c_str());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(input.size()));
+}
+
+const std::string LITERAL_INPUT = R"(Listening on 0.0.0.0:443)";
+const std::string DATE_SYSLOG_INPUT = "Jun 14 15:16:01";
+const std::string DATE_HTTP_INPUT = "26/Dec/2016:16:16:29 +0200";
+const std::string IPV4_INPUT = "192.168.100.255";
+const std::string IPV6_INPUT = "2001:db8:85a3:8d3:1319:8a2e:370:7348";
+const std::string CSV_INPUT = R"(192.168.33.1,-,-,200,GET /index.html HTTP/1.1,612)";
+const std::string DSV_INPUT = R"('192.168.33.1'|'-'|'-'|'200'|'GET /index.html HTTP/1.1'|'612')";
+const std::string KV_INPUT =
+    R"(name=mysql uid=106 gid=111 home=/nonexistent shell=/bin/false tty=pts/0 pwd=/home/vagrant user=root)";
+const std::string KV_QUOTED_INPUT =
+    R"(pid=6969 subj=system_u:system_r:virtd_t:s0-s0:c0.c1023 msg='virt=kvm vm=\"rhel-work3\" )"
+    R"(uuid=650c2a3b-2a7d-a7bd-bbc7-aa0069007bbf vm-ctx=system_u:system_r:svirt_t:s0:c424,c957 )"
+    R"(exe="/usr/sbin/someexe" terminal=? res=success')";
+const std::string JSON_INPUT =
+    R"({"timestamp":"2021-01-27T01:28:11.488362+0100","flow_id":1805461738637437,"event_type":"alert",)"
+    R"("src_ip":"81.2.69.143","src_port":80,"dest_ip":"10.31.64.240","dest_port":47592,"proto":"TCP",)"
+    R"("alert":{"action":"allowed","gid":1,"signature_id":2100498,"rev":7,)"
+    R"("signature":"GPL ATTACK_RESPONSE id check returned root","severity":2},)"
+    R"("http":{"hostname":"testmynids.org","url":"/uid/index.html","http_user_agent":"curl/7.58.0",)"
+    R"("http_method":"GET","protocol":"HTTP/1.1","status":200,"length":39}})";
+const std::string XML_INPUT = R"(<Event xmlns="http://schemas.microsoft.com/win/2004/08/events/event">)"
+                              R"(<System><Provider Name="Microsoft-Windows-Security-Auditing"/>)"
+                              R"(<EventID>5379</EventID><Version>0</Version><Level>0</Level><Task>13824</Task>)"
+                              R"(<TimeCreated SystemTime="2023-10-20T19:07:06.3037119Z"/>)"
+                              R"(<Channel>Security</Channel><Computer>WIN-8I36CR3738L</Computer></System></Event>)";
+const std::string QUOTED_INPUT = R"("GET /A%20Beka%20G1%20Howe/15%20reading%20elephants.mp4 HTTP/1.1" 206)";
+const std::string EVENTCHANNEL_INPUT =
+    R"(<Event xmlns="http://schemas.microsoft.com/win/2004/08/events/event">)"
+    R"(<System><Provider Name="Microsoft-Windows-Security-Auditing" Guid="{54849625-5478-4994-a5ba-3e3b0328c30d}"/>)"
+    R"(<EventID>4624</EventID><Version>2</Version><Level>0</Level><Task>12544</Task><Opcode>0</Opcode>)"
+    R"(<Keywords>0x8020000000000000</Keywords><TimeCreated SystemTime="2023-10-20T19:07:06.3037119Z"/>)"
+    R"(<EventRecordID>217214</EventRecordID><Correlation ActivityID="{d6acd7b4-abd0-0002-c9d7-acd6d0abd901}"/>)"
+    R"(<Execution ProcessID="708" ThreadID="4752"/><Channel>Security</Channel>)"
+    R"(<Computer>WIN-8I36CR3738L</Computer><Security/></System>)"
+    R"(<EventData><Data Name="SubjectUserSid">S-1-5-18</Data><Data Name="SubjectUserName">WIN-8I36CR3738L$</Data>)"
+    R"(<Data Name="SubjectDomainName">WORKGROUP</Data><Data Name="SubjectLogonId">0x3e7</Data>)"
+    R"(<Data Name="TargetUserSid">S-1-5-18</Data><Data Name="TargetUserName">SYSTEM</Data>)"
+    R"(<Data Name="TargetDomainName">NT AUTHORITY</Data><Data Name="TargetLogonId">0x3e7</Data>)"
+    R"(<Data Name="LogonType">5</Data><Data Name="LogonProcessName">Advapi</Data>)"
+    R"(<Data Name="AuthenticationPackageName">Negotiate</Data><Data Name="WorkstationName">-</Data>)"
+    R"(<Data Name="IpAddress">-</Data><Data Name="IpPort">-</Data></EventData></Event>)";
+} // namespace
+
+static void BM_literal(benchmark::State& state)
+{
+    auto parser = hlp::parsers::getLiteralParser({NAME, TARGET, {}, {LITERAL_INPUT}});
+    runParser(state, parser, LITERAL_INPUT);
+}
+BENCHMARK(BM_literal);
+
+static void BM_dateSyslog(benchmark::State& state)
+{
+    auto parser = initAndGetDateParser()({NAME, TARGET, {}, {"%b %d %T", "C"}});
+    runParser(state, parser, DATE_SYSLOG_INPUT);
+}
+BENCHMARK(BM_dateSyslog);
+
+static void BM_dateHttp(benchmark::State& state)
+{
+    auto parser = initAndGetDateParser()({NAME, TARGET, {}, {"%d/%b/%Y:%T %z", "C"}});
+    runParser(state, parser, DATE_HTTP_INPUT);
+}
+BENCHMARK(BM_dateHttp);
+
+static void BM_ipv4(benchmark::State& state)
+{
+    auto parser = hlp::parsers::getIPParser({NAME, TARGET, {}, {}});
+    runParser(state, parser, IPV4_INPUT);
+}
+BENCHMARK(BM_ipv4);
+
+static void BM_ipv6(benchmark::State& state)
+{
+    auto parser = hlp::parsers::getIPParser({NAME, TARGET, {}, {}});
+    runParser(state, parser, IPV6_INPUT);
+}
+BENCHMARK(BM_ipv6);
+
+static void BM_csv(benchmark::State& state)
+{
+    auto parser = hlp::parsers::getCSVParser(
+        {NAME, TARGET, {""}, {"src_ip", "ident", "auth", "status", "request", "size"}});
+    runParser(state, parser, CSV_INPUT);
+}
+BENCHMARK(BM_csv);
+
+static void BM_dsv(benchmark::State& state)
+{
+    auto parser = hlp::parsers::getDSVParser(
+        {NAME, TARGET, {""}, {"|", "'", "\\", "src_ip", "ident", "auth", "status", "request", "size"}});
+    runParser(state, parser, DSV_INPUT);
+}
+BENCHMARK(BM_dsv);
+
+static void BM_kvmap(benchmark::State& state)
+{
+    auto parser = hlp::parsers::getKVParser({NAME, TARGET, {}, {"=", " ", "'", "\\"}});
+    runParser(state, parser, KV_INPUT);
+}
+BENCHMARK(BM_kvmap);
+
+static void BM_kvmapQuoted(benchmark::State& state)
+{
+    auto parser = hlp::parsers::getKVParser({NAME, TARGET, {}, {"=", " ", "'", "\\"}});
+    runParser(state, parser, KV_QUOTED_INPUT);
+}
+BENCHMARK(BM_kvmapQuoted);
+
+static void BM_json(benchmark::State& state)
+{
+    auto parser = hlp::parsers::getJSONParser({NAME, TARGET, {}, {}});
+    runParser(state, parser, JSON_INPUT);
+}
+BENCHMARK(BM_json);
+
+static void BM_xml(benchmark::State& state)
+{
+    auto parser = hlp::parsers::getXMLParser({NAME, TARGET, {""}, {}});
+    runParser(state, parser, XML_INPUT);
+}
+BENCHMARK(BM_xml);
+
+static void BM_xmlEventChannel(benchmark::State& state)
+{
+    auto parser = hlp::parsers::getXMLParser({NAME, TARGET, {""}, {"windows"}});
+    runParser(state, parser, EVENTCHANNEL_INPUT);
+}
+BENCHMARK(BM_xmlEventChannel);
+
+static void BM_quoted(benchmark::State& state)
+{
+    auto parser = hlp::parsers::getQuotedParser({NAME, TARGET, {}, {}});
+    runParser(state, parser, QUOTED_INPUT);
+}
+BENCHMARK(BM_quoted);
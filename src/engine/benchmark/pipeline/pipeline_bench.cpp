@@ -0,0 +1,244 @@
+/**
+ * End-to-end engine pipeline benchmark.
+ *
+ * Replays recorded event corpora (raw syslog, JSON and windows eventchannel mixes) through the
+ * full in-process pipeline — parseEvent, the concurrent queue and a reference policy running on
+ * the rx backend — and reports sustained events per second, p50/p99 per-event latency and peak
+ * RSS, so throughput regressions show up per commit instead of in a staging fleet.
+ *
+ * A custom corpus can be replayed by pointing ENGINE_BENCH_CORPUS to a file with one raw event
+ * per line in the same "q:location:message" wire format the engine receives.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <benchmark/benchmark.h>
+
+#include <base/baseTypes.hpp>
+#include <base/expression.hpp>
+#include <base/parseEvent.hpp>
+#include <bk/rx/controller.hpp>
+#include <queue/concurrentQueue.hpp>
+
+namespace
+{
+
+constexpr int QUEUE_CAPACITY = 1 << 14;
+
+// Raw syslog events as received from agents (queue 1 and 2)
+const std::vector<std::string> SYSLOG_CORPUS = {
+    R"(1:[123] (bench_host) any->/var/log/auth.log:Feb 21 21:56:12 localhost sshd[3430]: Invalid user test from 10.0.2.2)",
+    R"(1:[123] (bench_host) any->/var/log/auth.log:Feb 22 16:45:20 slave22 sshd[2738]: Failed password for root from 202.196.224.106 port 1786 ssh2)",
+    R"(1:[123] (bench_host) any->/var/log/auth.log:Feb 24 09:20:10 precise32 sudo:  vagrant : TTY=pts/0 ; PWD=/home/vagrant ; USER=root ; COMMAND=/bin/cat /var/log/auth.log)",
+    R"(1:[123] (bench_host) any->/var/log/auth.log:Feb 24 09:19:55 precise32 useradd[8002]: new user: name=mysql, UID=106, GID=111, home=/nonexistent, shell=/bin/false)",
+    R"(1:[123] (bench_host) any->/var/log/apache2/access.log:192.168.33.1 - - [26/Dec/2016:16:22:00 +0000] "GET / HTTP/1.1" 200 484 "-" "Mozilla/5.0 (Macintosh; Intel Mac OS X 10_12_0) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/54.0.2840.98 Safari/537.36")",
+    R"(1:[123] (bench_host) any->/var/log/apache2/error.log:[Fri Sep 09 10:42:29.902022 2011] [core:error] [pid 35708:tid 4328636416] [client 72.15.99.187] File does not exist: /usr/local/apache2/htdocs/favicon.ico)",
+    R"(2:10.0.0.1:Mar  1 18:48:50.483 UTC: %SEC-6-IPACCESSLOGP: list ACL-IPv4-E0/0-IN permitted tcp 192.168.1.3(1024) -> 192.168.2.1(22), 1 packet)",
+    R"(2:10.0.0.1:Feb 14 09:40:10.326: %ASA-3-106014: Deny inbound icmp src inside:10.10.1.132 dst inside:192.3.69.136 (type 0, code 0))",
+};
+
+// JSON events (suricata, aws) as received from agents
+const std::vector<std::string> JSON_CORPUS = {
+    R"(1:[123] (bench_host) any->/var/log/suricata/eve.json:{"timestamp":"2021-01-27T01:28:11.488362+0100","flow_id":1805461738637437,"event_type":"alert","src_ip":"81.2.69.143","src_port":80,"dest_ip":"10.31.64.240","dest_port":47592,"proto":"TCP","alert":{"action":"allowed","gid":1,"signature_id":2100498,"rev":7,"signature":"GPL ATTACK_RESPONSE id check returned root","severity":2},"http":{"hostname":"testmynids.org","url":"/uid/index.html","http_user_agent":"curl/7.58.0","http_method":"GET","protocol":"HTTP/1.1","status":200,"length":39}})",
+    R"(1:[123] (bench_host) any->/var/log/suricata/eve.json:{"flow":{"start":"2020-06-26T11:00:02.970011-0400","bytes_toclient":4660,"bytes_toserver":1074,"pkts_toclient":8,"pkts_toserver":7},"app_proto":"tls","alert":{"severity":3,"category":"","signature":"SURICATA TLS on unusual port","rev":1,"signature_id":2610003,"gid":1,"action":"allowed"},"proto":"TCP","dest_port":8443,"dest_ip":"10.128.2.48","src_port":64389,"src_ip":"10.137.3.54","event_type":"alert","timestamp":"2020-06-26T11:00:03.342282-0400"})",
+    R"(1:[123] (bench_host) any->/var/aws:{"aws":{"source":"cloudtrail","eventVersion":"some-event-version","eventID":"some-event-id","eventTime":"2018-08-24T17:20:08Z","eventType":"AwsConsoleSignIn","errorMessage":"Failed authentication","responseElements":{"ConsoleLogin":"Failure"},"awsRegion":"us-east-1","eventName":"ConsoleLogin","userIdentity":{"userName":"some-user-name","type":"IAMUser","accountId":"0303456"},"eventSource":"signin.amazonaws.com","sourceIPAddress":"7.222.123.101"},"integration":"aws"})",
+};
+
+// Windows eventchannel events as forwarded by the agent
+const std::vector<std::string> EVENTCHANNEL_CORPUS = {
+    R"(f:EventChannel:{"Message":"An account was successfully logged on.","Event":"<Event xmlns='http://schemas.microsoft.com/win/2004/08/events/event'><System><Provider Name='Microsoft-Windows-Security-Auditing'/><EventID>4624</EventID><Level>0</Level><Task>12544</Task><TimeCreated SystemTime='2023-10-20T19:07:06.3037119Z'/><Channel>Security</Channel><Computer>WIN-8I36CR3738L</Computer></System></Event>"})",
+    R"(f:EventChannel:{"Message":"Credential Manager credentials were read.","Event":"<Event xmlns='http://schemas.microsoft.com/win/2004/08/events/event'><System><Provider Name='Microsoft-Windows-Security-Auditing'/><EventID>5379</EventID><Level>0</Level><Task>13824</Task><TimeCreated SystemTime='2023-10-20T19:07:06.3037119Z'/><Channel>Security</Channel><Computer>WIN-8I36CR3738L</Computer></System></Event>"})",
+};
+
+/**
+ * @brief Returns the corpus to replay: ENGINE_BENCH_CORPUS if set (one raw event per line),
+ * otherwise the built-in mix of all the recorded corpora.
+ */
+const std::vector<std::string>& mixedCorpus()
+{
+    static const std::vector<std::string> corpus = []()
+    {
+        std::vector<std::string> events;
+        if (const auto* path = std::getenv("ENGINE_BENCH_CORPUS"); path != nullptr && *path != '\0')
+        {
+            std::ifstream file {path};
+            for (std::string line; std::getline(file, line);)
+            {
+                if (!line.empty())
+                {
+                    events.emplace_back(std::move(line));
+                }
+            }
+            if (!events.empty())
+            {
+                return events;
+            }
+        }
+        events.insert(events.end(), SYSLOG_CORPUS.begin(), SYSLOG_CORPUS.end());
+        events.insert(events.end(), JSON_CORPUS.begin(), JSON_CORPUS.end());
+        events.insert(events.end(), EVENTCHANNEL_CORPUS.begin(), EVENTCHANNEL_CORPUS.end());
+        return events;
+    }();
+    return corpus;
+}
+
+/**
+ * @brief Builds a reference policy expression with the shape the builder produces: a broadcast of
+ * decoder chains followed by an enrichment and an output stage, each term doing representative
+ * JSON work over the event.
+ *
+ * Real catalog policies need a store behind them; the reference policy keeps the benchmark
+ * hermetic while exercising the same backend scheduling and per-term event mutation costs.
+ */
+base::Expression makeReferencePolicy()
+{
+    auto makeDecoder = [](const std::string& name, const std::string& field)
+    {
+        return base::Term<base::EngineOp>::create(name,
+                                                  [field](base::Event event)
+                                                  {
+                                                      auto original = event->getString("/event/original");
+                                                      if (!original)
+                                                      {
+                                                          return base::result::makeFailure(std::move(event));
+                                                      }
+                                                      event->setString(original.value().substr(0, 64),
+                                                                       std::string("/decoded/") + field);
+                                                      return base::result::makeSuccess(std::move(event));
+                                                  });
+    };
+
+    auto enrichment = base::Term<base::EngineOp>::create("enrichment/bench/0",
+                                                         [](base::Event event)
+                                                         {
+                                                             event->setString("benchmark", "/wazuh/origin");
+                                                             event->setInt(1, "/wazuh/schema_version");
+                                                             return base::result::makeSuccess(std::move(event));
+                                                         });
+
+    auto output = base::Term<base::EngineOp>::create("output/bench/0",
+                                                     [](base::Event event)
+                                                     {
+                                                         auto serialized = event->str();
+                                                         benchmark::DoNotOptimize(serialized);
+                                                         return base::result::makeSuccess(std::move(event));
+                                                     });
+
+    auto decoders = base::Broadcast::create("decoders/bench",
+                                            {base::Chain::create("decoder/syslog/bench", {makeDecoder("decoder/syslog/0", "syslog")}),
+                                             base::Chain::create("decoder/json/bench", {makeDecoder("decoder/json/0", "json")}),
+                                             base::Chain::create("decoder/windows/bench", {makeDecoder("decoder/windows/0", "windows")})});
+
+    return base::Chain::create("policy/bench/0", {decoders, enrichment, output});
+}
+
+/**
+ * @brief Reports peak RSS and per-event latency percentiles as benchmark counters.
+ */
+void reportCounters(benchmark::State& state, std::vector<int64_t>& latenciesNs)
+{
+    if (!latenciesNs.empty())
+    {
+        std::sort(latenciesNs.begin(), latenciesNs.end());
+        state.counters["p50_latency_ns"] =
+            static_cast<double>(latenciesNs[latenciesNs.size() / 2]);
+        state.counters["p99_latency_ns"] =
+            static_cast<double>(latenciesNs[(latenciesNs.size() * 99) / 100]);
+    }
+
+    struct rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        state.counters["peak_rss_kb"] = static_cast<double>(usage.ru_maxrss);
+    }
+}
+
+/**
+ * @brief Replays a corpus through parseEvent, the concurrent queue and the reference policy.
+ *
+ * items/sec in the report is the sustained EPS of the full pipeline.
+ */
+void runPipeline(benchmark::State& state, const std::vector<std::string>& corpus)
+{
+    using Queue = base::queue::
+        ConcurrentQueue<base::Event, moodycamel::ConcurrentQueueDefaultTraits, base::queue::NullQueueMetrics>;
+
+    Queue queue {QUEUE_CAPACITY, nullptr, nullptr};
+    bk::rx::Controller controller {makeReferencePolicy(), {}};
+
+    const auto corpusSize = corpus.size();
+    int64_t totalBytes = 0;
+    std::size_t current = 0;
+    std::vector<int64_t> latenciesNs;
+    latenciesNs.reserve(1 << 16);
+
+    for (auto _ : state)
+    {
+        const auto& raw = corpus[current];
+        current = (current + 1) % corpusSize;
+
+        const auto start = std::chrono::steady_clock::now();
+        try
+        {
+            queue.push(base::parseEvent::parseWazuhEvent(raw));
+            base::Event event;
+            if (!queue.waitPop(event))
+            {
+                state.SkipWithError("Queue pop timed out");
+                break;
+            }
+            auto processed = controller.ingestGet(std::move(event));
+            benchmark::DoNotOptimize(processed);
+        }
+        catch (const std::exception& e)
+        {
+            state.SkipWithError(e.what());
+            break;
+        }
+        const auto stop = std::chrono::steady_clock::now();
+
+        if (latenciesNs.size() < latenciesNs.capacity())
+        {
+            latenciesNs.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+        }
+        totalBytes += static_cast<int64_t>(raw.size());
+        benchmark::ClobberMemory();
+    }
+
+    controller.stop();
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(totalBytes);
+    reportCounters(state, latenciesNs);
+}
+
+} // namespace
+
+static void BM_pipelineSyslog(benchmark::State& state)
+{
+    runPipeline(state, SYSLOG_CORPUS);
+}
+BENCHMARK(BM_pipelineSyslog)->UseRealTime();
+
+static void BM_pipelineJson(benchmark::State& state)
+{
+    runPipeline(state, JSON_CORPUS);
+}
+BENCHMARK(BM_pipelineJson)->UseRealTime();
+
+static void BM_pipelineEventChannel(benchmark::State& state)
+{
+    runPipeline(state, EVENTCHANNEL_CORPUS);
+}
+BENCHMARK(BM_pipelineEventChannel)->UseRealTime();
+
+static void BM_pipelineMixed(benchmark::State& state)
+{
+    runPipeline(state, mixedCorpus());
+}
+BENCHMARK(BM_pipelineMixed)->UseRealTime();
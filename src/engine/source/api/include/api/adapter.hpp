@@ -24,14 +24,16 @@ base::utils::wazuhProtocol::WazuhResponse toWazuhResponse(const T& eMessage)
     // Check that T is derived from google::protobuf::Message
     static_assert(std::is_base_of<google::protobuf::Message, T>::value, "T must be a derived class of proto::Message");
 
-    const auto res = eMessage::eMessageToJson<T>(eMessage);
+    auto res = eMessage::eMessageToJson<T>(eMessage);
 
     if (std::holds_alternative<base::Error>(res))
     {
         const auto& error = std::get<base::Error>(res);
         return base::utils::wazuhProtocol::WazuhResponse::internalError(error.message);
     }
-    return base::utils::wazuhProtocol::WazuhResponse {json::Json {std::get<std::string>(res).c_str()}};
+    // The serialized eMessage is embedded as is, it is not parsed into a json object
+    // just to be re-serialized when the response hits the wire
+    return base::utils::wazuhProtocol::WazuhResponse::fromPreSerializedData(std::move(std::get<std::string>(res)));
 }
 
 /**
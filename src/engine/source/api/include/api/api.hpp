@@ -3,6 +3,12 @@
 
 #include "registry.hpp"
 
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
 #include <base/json.hpp>
 #include <rbac/irbac.hpp>
 
@@ -21,6 +27,58 @@ private:
     std::shared_ptr<api::Registry> m_registry; ///< Registry of handlers
     std::weak_ptr<rbac::IRBAC> m_rbac;         ///< RBAC instance
 
+    std::vector<std::thread> m_workers;          ///< Dedicated threads executing the handlers
+    std::queue<std::function<void()>> m_tasks;   ///< Pending requests
+    std::mutex m_taskMutex;                      ///< Protects the pending requests
+    std::condition_variable m_taskCv;            ///< Signals pending requests to the workers
+    bool m_stopWorkers {false};                  ///< Set on destruction to drain the workers
+
+    /**
+     * @brief Spawn the dedicated worker threads.
+     *
+     * @param workers Number of worker threads
+     */
+    void startWorkers(std::size_t workers);
+
+    /**
+     * @brief Queue a request for execution on the worker threads.
+     *
+     * @param task Task that parses and dispatches the request
+     */
+    void enqueue(std::function<void()> task);
+
+    /**
+     * @brief Parse a raw request, dispatch its handler and deliver the response.
+     *
+     * @param message Raw string request
+     * @param callbackFn Callback function that will be invoked with the generated response
+     */
+    void doProcessRequest(const std::string& message, std::function<void(const std::string&)> callbackFn)
+    {
+
+        json::Json jrequest {};
+        try
+        {
+            jrequest = json::Json {message.c_str()};
+        }
+        catch (const std::exception& e)
+        {
+            auto wresponse = base::utils::wazuhProtocol::WazuhResponse::invalidJsonRequest();
+            callbackFn(wresponse.toString());
+            return;
+        }
+
+        wpRequest wrequest {jrequest};
+        if (!wrequest.isValid())
+        {
+            auto wresponse = base::utils::wazuhProtocol::WazuhResponse::invalidRequest(wrequest.error().value());
+            callbackFn(wresponse.toString());
+            return;
+        }
+
+        processWazuhRequest(wrequest, [=](const wpResponse& wresponse) { callbackFn(wresponse.toString()); });
+    }
+
 public:
     /**
      * @brief Construct a new Api object
@@ -33,11 +91,25 @@ public:
     /**
      * @brief Construct a new Api object
      *
+     * With a non-zero number of workers the handlers run on a dedicated thread pool,
+     * so a slow operation does not block the server loop nor unrelated API calls.
+     * With zero workers the handlers run on the caller thread.
+     *
      * @param rbac RBAC instance to use in the API
+     * @param workers Number of dedicated worker threads, 0 to execute on the caller thread
      */
-    Api(std::weak_ptr<rbac::IRBAC> rbac)
+    Api(std::weak_ptr<rbac::IRBAC> rbac, std::size_t workers = 0)
         : m_registry(std::make_shared<api::Registry>())
-        , m_rbac(rbac) {};
+        , m_rbac(rbac)
+    {
+        startWorkers(workers);
+    };
+
+    /**
+     * @brief Destroy the Api object, draining the worker threads
+     */
+    ~Api();
+
     /**
      * @brief Register a handler for a command
      *
@@ -71,33 +143,22 @@ public:
     /**
      * @brief Processes a raw string request and invokes a callback function with the response.
      *
+     * When the API was constructed with worker threads the request is queued and the
+     * callback is invoked from a worker, so the callback must be safe to call from
+     * another thread. Otherwise the request is processed on the caller thread.
+     *
      * @param message Raw string request
      * @param callbackFn Callback function that will be invoked with the generated response
      */
     void processRequest(const std::string& message, std::function<void(const std::string&)> callbackFn)
     {
-
-        json::Json jrequest {};
-        try
-        {
-            jrequest = json::Json {message.c_str()};
-        }
-        catch (const std::exception& e)
-        {
-            auto wresponse = base::utils::wazuhProtocol::WazuhResponse::invalidJsonRequest();
-            callbackFn(wresponse.toString());
-            return;
-        }
-
-        wpRequest wrequest {jrequest};
-        if (!wrequest.isValid())
+        if (!m_workers.empty())
         {
-            auto wresponse = base::utils::wazuhProtocol::WazuhResponse::invalidRequest(wrequest.error().value());
-            callbackFn(wresponse.toString());
+            enqueue([this, message, callbackFn]() { doProcessRequest(message, callbackFn); });
             return;
         }
 
-        processWazuhRequest(wrequest, [=](const wpResponse& wresponse) { callbackFn(wresponse.toString()); });
+        doProcessRequest(message, callbackFn);
     }
 
     /**
@@ -7,7 +7,9 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -67,6 +69,21 @@ private:
     std::optional<base::Error>
     validate(const Resource& item, const std::string& namespaceId, const json::Json& content) const;
 
+    /**
+     * @brief Check the pre-conditions of a post without touching the store.
+     *
+     * Performs the format, name and validator checks of postResource over one item. Does not
+     * read or write the store, so items of a bulk post can be checked concurrently.
+     *
+     * @param collection Resource identifying the collection the content belongs to
+     * @param namespaceId Namespace name where the item will be added
+     * @param content String with the resource to add to the collection
+     * @return base::RespOrError<std::pair<Resource, json::Json>> The content resource and its
+     * parsed content, or the first error found
+     */
+    base::RespOrError<std::pair<Resource, json::Json>>
+    checkPostResource(const Resource& collection, const std::string& namespaceId, const std::string& content) const;
+
     /**
      * @brief Get the Document or error from the store.
      *
@@ -142,6 +159,20 @@ public:
     std::optional<base::Error>
     postResource(const Resource& collection, const std::string& namespaceStr, const std::string& content);
 
+    /**
+     * @brief Add a batch of items, validating them in parallel and committing all or none.
+     *
+     * Every item is checked and validated concurrently across a thread pool. The store is only
+     * touched when every item passed, and a failure while storing rolls the already added items
+     * back, so the bulk behaves atomically towards the catalog.
+     *
+     * @param items Collection resource and content of each item, as taken by postResource
+     * @param namespaceStr Namespace name where the items will be added
+     * @return std::optional<base::Error> Aggregated per-item errors if the operation failed
+     */
+    std::optional<base::Error> postResourceBulk(const std::vector<std::pair<Resource, std::string>>& items,
+                                                const std::string& namespaceStr);
+
     /**
      * @brief Update an item
      *
@@ -13,6 +13,7 @@ namespace api::catalog::handlers
 
 /* Resource Endpoint */
 api::HandlerSync resourcePost(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
+api::HandlerSync resourceBulkPost(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
 api::HandlerSync resourceGet(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
 api::HandlerSync resourceDelete(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
 api::HandlerSync resourcePut(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac);
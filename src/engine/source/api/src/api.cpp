@@ -1,5 +1,70 @@
 #include <api/api.hpp>
 
+#include <base/logging.hpp>
+
 namespace api
 {
+
+void Api::startWorkers(std::size_t workers)
+{
+    m_workers.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i)
+    {
+        m_workers.emplace_back(
+            [this]()
+            {
+                while (true)
+                {
+                    std::function<void()> task {};
+                    {
+                        std::unique_lock lock {m_taskMutex};
+                        m_taskCv.wait(lock, [this]() { return m_stopWorkers || !m_tasks.empty(); });
+                        if (m_stopWorkers && m_tasks.empty())
+                        {
+                            return;
+                        }
+                        task = std::move(m_tasks.front());
+                        m_tasks.pop();
+                    }
+
+                    try
+                    {
+                        task();
+                    }
+                    catch (const std::exception& e)
+                    {
+                        // The task responds through its own callback, never let it kill the worker
+                        LOG_ERROR("Exception in API worker: {}", e.what());
+                    }
+                }
+            });
+    }
+}
+
+void Api::enqueue(std::function<void()> task)
+{
+    {
+        std::lock_guard lock {m_taskMutex};
+        m_tasks.push(std::move(task));
+    }
+    m_taskCv.notify_one();
+}
+
+Api::~Api()
+{
+    {
+        std::lock_guard lock {m_taskMutex};
+        m_stopWorkers = true;
+    }
+    m_taskCv.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
 }
+
+} // namespace api
@@ -1,5 +1,8 @@
 #include "api/catalog/catalog.hpp"
 
+#include <atomic>
+#include <thread>
+
 #include <base/logging.hpp>
 #include <fmt/format.h>
 
@@ -143,10 +146,35 @@ Catalog::postResource(const Resource& collection, const std::string& namespaceSt
     }
 
     // content must be a valid resource for the specified collection
+    auto checked = checkPostResource(collection, namespaceStr, content);
+    if (base::isError(checked))
+    {
+        return base::getError(checked);
+    }
+
+    const auto& [contentResource, contentJson] = base::getResponse(checked);
+
+    // All pre-conditions are met, post the content in the store
+    const auto storeError = store::utils::add(
+        m_store, contentResource.m_name, namespaceId, Resource::formatToStr(collection.m_format), contentJson, content);
+    if (storeError)
+    {
+        return base::Error {fmt::format("Content '{}' could not be added to store: {}",
+                                        contentResource.m_name.fullName(),
+                                        storeError.value().message)};
+    }
+
+    return base::noError();
+    ;
+}
+
+base::RespOrError<std::pair<Resource, json::Json>>
+Catalog::checkPostResource(const Resource& collection, const std::string& namespaceId, const std::string& content) const
+{
     // Build the resource Json, input content format must be the expected by the
     // collection and the name type of the content must be the same as the
     // collection
-    const auto formatResult = m_inFormat[collection.m_format](content);
+    const auto formatResult = m_inFormat.at(collection.m_format)(content);
     if (std::holds_alternative<base::Error>(formatResult))
     {
         return base::Error {fmt::format("JSON object could not be created from '{} {}': {}",
@@ -201,7 +229,7 @@ Catalog::postResource(const Resource& collection, const std::string& namespaceSt
     // Validate the content if needed
     if (contentResource.m_validation)
     {
-        const auto validationError = validate(contentResource, namespaceStr, contentJson);
+        const auto validationError = validate(contentResource, namespaceId, contentJson);
 
         if (validationError)
         {
@@ -211,17 +239,120 @@ Catalog::postResource(const Resource& collection, const std::string& namespaceSt
         }
     }
 
-    // All pre-conditions are met, post the content in the store
-    const auto storeError = store::utils::add(
-        m_store, contentResource.m_name, namespaceId, Resource::formatToStr(collection.m_format), contentJson, content);
-    if (storeError)
+    return std::make_pair(contentResource, contentJson);
+}
+
+std::optional<base::Error> Catalog::postResourceBulk(const std::vector<std::pair<Resource, std::string>>& items,
+                                                     const std::string& namespaceStr)
+{
+    LOG_DEBUG("Engine catalog: '{}' method: '{}' items. Namespace: '{}'.", __func__, items.size(), namespaceStr);
+
+    // Verify namespace
+    base::OptError namespaceError;
+    store::NamespaceId namespaceId = [&namespaceError, &namespaceStr]()
     {
-        return base::Error {fmt::format(
-            "Content '{}' could not be added to store: {}", contentNameStr.value(), storeError.value().message)};
+        try
+        {
+            return store::NamespaceId {namespaceStr};
+        }
+        catch (const std::exception& e)
+        {
+            namespaceError = base::Error {fmt::format("Invalid namespace '{}': {}", namespaceStr, e.what())};
+            return store::NamespaceId {};
+        }
+    }();
+
+    if (namespaceError)
+    {
+        return namespaceError;
+    }
+
+    // Every specified resource must be a collection
+    for (const auto& [collection, content] : items)
+    {
+        if (Resource::Type::collection != collection.m_type)
+        {
+            return base::Error {fmt::format("Expected resource type is '{}', but got '{}'",
+                                            Resource::typeToStr(collection.m_type),
+                                            Resource::typeToStr(Resource::Type::collection))};
+        }
+    }
+
+    // Check every item concurrently, the store is not touched until all of them passed.
+    // Validation (parse, schema check and builder dry-run) dominates a ruleset deploy, so the
+    // items are spread over a pool of threads pulling from a shared index.
+    std::vector<base::RespOrError<std::pair<Resource, json::Json>>> checked(items.size());
+    const auto poolSize = std::min<std::size_t>(items.size(), std::max(1u, std::thread::hardware_concurrency()));
+    std::atomic<std::size_t> nextItem {0};
+    std::vector<std::thread> pool;
+    pool.reserve(poolSize);
+    for (std::size_t i = 0; i < poolSize; ++i)
+    {
+        pool.emplace_back(
+            [this, &items, &checked, &nextItem, &namespaceStr]()
+            {
+                for (auto item = nextItem.fetch_add(1); item < items.size(); item = nextItem.fetch_add(1))
+                {
+                    try
+                    {
+                        checked[item] = checkPostResource(items[item].first, namespaceStr, items[item].second);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        checked[item] = base::Error {e.what()};
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+
+    // Aggregate every item error so one round trip reports the whole ruleset
+    std::string errors;
+    for (std::size_t i = 0; i < checked.size(); ++i)
+    {
+        if (base::isError(checked[i]))
+        {
+            errors += fmt::format("Item '{}': {}\n", i, base::getError(checked[i]).message);
+        }
+    }
+
+    if (!errors.empty())
+    {
+        errors.pop_back();
+        return base::Error {std::move(errors)};
+    }
+
+    // All items passed, commit them to the store. A failure rolls the already added items back
+    // so a partial ruleset is never left behind.
+    std::vector<base::Name> added;
+    added.reserve(items.size());
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+        const auto& [contentResource, contentJson] = base::getResponse(checked[i]);
+        const auto storeError = store::utils::add(m_store,
+                                                  contentResource.m_name,
+                                                  namespaceId,
+                                                  Resource::formatToStr(items[i].first.m_format),
+                                                  contentJson,
+                                                  items[i].second);
+        if (storeError)
+        {
+            for (const auto& name : added)
+            {
+                m_store->deleteDoc(name);
+            }
+            return base::Error {fmt::format("Content '{}' could not be added to store: {}",
+                                            contentResource.m_name.fullName(),
+                                            storeError.value().message)};
+        }
+        added.push_back(contentResource.m_name);
     }
 
     return base::noError();
-    ;
 }
 
 std::optional<base::Error> Catalog::checkResourceInNamespace(const api::catalog::Resource& item,
@@ -111,6 +111,77 @@ api::HandlerSync resourcePost(std::shared_ptr<Catalog> catalog, std::weak_ptr<rb
     };
 }
 
+api::HandlerSync resourceBulkPost(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac)
+{
+
+    auto rbacPtr = rbac.lock();
+    if (!rbacPtr)
+    {
+        throw std::runtime_error {"RBAC instance is not available"};
+    }
+
+    auto authFn = rbacPtr->getAuthFn(rbac::Resource::ASSET, rbac::Operation::WRITE);
+    auto authSystemFn = rbacPtr->getAuthFn(rbac::Resource::SYSTEM_ASSET, rbac::Operation::WRITE);
+
+    return [catalog, authFn, authSystemFn](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eCatalog::ResourceBulkPost_Request;
+        using ResponseType = eEngine::GenericStatus_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+        const auto& eRequest = std::get<RequestType>(res);
+
+        // Validate the params request
+        const auto error = !eRequest.has_format()        ? std::make_optional("Missing /format parameter or is invalid")
+                           : !eRequest.has_namespaceid() ? std::make_optional("Missing /namespace parameter")
+                           : eRequest.assets().empty()   ? std::make_optional("Missing /assets parameter or is empty")
+                                                         : std::nullopt;
+        if (error)
+        {
+            return ::api::adapter::genericError<ResponseType>(error.value());
+        }
+
+        // Build the target resource of every asset
+        std::vector<std::pair<catalog::Resource, std::string>> items;
+        items.reserve(eRequest.assets().size());
+        for (const auto& eAsset : eRequest.assets())
+        {
+            if (!eAsset.has_type())
+            {
+                return ::api::adapter::genericError<ResponseType>("Missing /type parameter or is invalid");
+            }
+
+            if (!eAsset.has_content())
+            {
+                return ::api::adapter::genericError<ResponseType>("Missing /content parameter");
+            }
+
+            try
+            {
+                auto name = base::Name {Resource::typeToStr(eAsset.type())};
+                items.emplace_back(catalog::Resource {name, eRequest.format()}, eAsset.content());
+            }
+            catch (const std::exception& e)
+            {
+                return ::api::adapter::genericError<ResponseType>(std::string {"Invalid /name parameter:"} + e.what());
+            }
+        }
+
+        const auto invalid = catalog->postResourceBulk(items, eRequest.namespaceid());
+        if (invalid)
+        {
+            return ::api::adapter::genericError<ResponseType>(invalid.value().message);
+        }
+
+        return ::api::adapter::genericSuccess<ResponseType>();
+    };
+}
+
 api::HandlerSync resourceGet(std::shared_ptr<Catalog> catalog, std::weak_ptr<rbac::IRBAC> rbac)
 {
 
@@ -475,6 +546,8 @@ void registerHandlers(std::shared_ptr<Catalog> catalog, std::shared_ptr<api::Api
 {
     const bool ok =
         api->registerHandler("catalog.resource/post", Api::convertToHandlerAsync(resourcePost(catalog, api->getRBAC())))
+        && api->registerHandler("catalog.resource/bulk_post",
+                                Api::convertToHandlerAsync(resourceBulkPost(catalog, api->getRBAC())))
         && api->registerHandler("catalog.resource/get",
                                 Api::convertToHandlerAsync(resourceGet(catalog, api->getRBAC())))
         && api->registerHandler("catalog.resource/put",
@@ -193,32 +193,45 @@ api::HandlerSync managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
         }
 
         auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
-        auto dumpRes = handler->dump(page, records);
 
-        if (std::holds_alternative<base::Error>(dumpRes))
-        {
-            return ::api::adapter::genericError<ResponseType>(std::get<base::Error>(dumpRes).message);
-        }
-        const auto& dump = std::get<std::list<std::pair<std::string, std::string>>>(dumpRes);
         ResponseType eResponse;
         eResponse.set_status(eEngine::ReturnStatus::OK);
-
         auto entries = eResponse.mutable_entries();
-        for (const auto& [key, value] : dump)
-        {
-            auto entry = eKVDB::Entry();
-            entry.mutable_key()->assign(key);
 
-            const auto res = eMessage::eMessageFromJson<google::protobuf::Value>(value);
-            if (std::holds_alternative<base::Error>(res)) // Should not happen but just in case
-            {
-                const auto msg =
-                    fmt::format("{}. For key '{}' and value {}", std::get<base::Error>(res).message, key, value);
-                return ::api::adapter::genericError<ResponseType>(msg);
-            }
-            const auto json_value = std::get<google::protobuf::Value>(res);
-            entry.mutable_value()->CopyFrom(json_value);
-            entries->Add(std::move(entry));
+        // Stream the entries straight into the response while the database is iterated,
+        // the dumped page is never materialized as an intermediate list
+        std::optional<std::string> entryError {};
+        auto dumpError = handler->dump(page,
+                                       records,
+                                       [&entries, &entryError](std::string_view key, std::string_view value) -> bool
+                                       {
+                                           const auto res = eMessage::eMessageFromJson<google::protobuf::Value>(
+                                               std::string {value});
+                                           if (std::holds_alternative<base::Error>(res)) // Should not happen but just
+                                                                                         // in case
+                                           {
+                                               entryError = fmt::format("{}. For key '{}' and value {}",
+                                                                        std::get<base::Error>(res).message,
+                                                                        key,
+                                                                        value);
+                                               return false;
+                                           }
+
+                                           auto entry = eKVDB::Entry();
+                                           entry.mutable_key()->assign(key.data(), key.size());
+                                           entry.mutable_value()->CopyFrom(std::get<google::protobuf::Value>(res));
+                                           entries->Add(std::move(entry));
+                                           return true;
+                                       });
+
+        if (base::isError(dumpError))
+        {
+            return ::api::adapter::genericError<ResponseType>(base::getError(dumpError).message);
+        }
+
+        if (entryError.has_value())
+        {
+            return ::api::adapter::genericError<ResponseType>(entryError.value());
         }
 
         // Adapt the response to wazuh api
@@ -1,3 +1,9 @@
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include <api/api.hpp>
@@ -58,3 +64,69 @@ INSTANTIATE_TEST_SUITE_P(
                         R"({"data":{},"error":5,"message":"Command \"no_exist_cmd\" not found"})"),
         std::make_tuple(wpRequest::create("testCommandException", "test_moudule", json::Json(R"({})")).toStr(),
                         wpResponse::unknownError().toString())));
+
+TEST(ApiAsyncTest, ProcessRequestRunsOnWorkerThread)
+{
+    logging::testInit();
+    Api api {std::weak_ptr<rbac::IRBAC>(), 2};
+    api.registerHandler("testCommand", Api::convertToHandlerAsync(testHandler));
+
+    std::mutex mutex {};
+    std::condition_variable cv {};
+    std::string response {};
+    std::thread::id handlerThread {};
+
+    api.processRequest(wpRequest::create("testCommand", "test_moudule", json::Json(R"({})")).toStr(),
+                       [&](const std::string& res)
+                       {
+                           std::lock_guard lock {mutex};
+                           response = res;
+                           handlerThread = std::this_thread::get_id();
+                           cv.notify_one();
+                       });
+
+    std::unique_lock lock {mutex};
+    ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&]() { return !response.empty(); }));
+    EXPECT_EQ(response, R"({"data":{"response":"OK"},"error":0})");
+    EXPECT_NE(handlerThread, std::this_thread::get_id());
+}
+
+TEST(ApiAsyncTest, SlowHandlerDoesNotBlockOtherRequests)
+{
+    logging::testInit();
+    Api api {std::weak_ptr<rbac::IRBAC>(), 2};
+
+    std::promise<void> release {};
+    auto released = release.get_future().share();
+    api.registerHandler("slowCommand",
+                        Api::convertToHandlerAsync(
+                            [released](const wpRequest&) -> wpResponse
+                            {
+                                released.wait();
+                                return wpResponse(json::Json(R"({"response": "slow"})"), 0);
+                            }));
+    api.registerHandler("testCommand", Api::convertToHandlerAsync(testHandler));
+
+    std::mutex mutex {};
+    std::condition_variable cv {};
+    std::string fastResponse {};
+
+    api.processRequest(wpRequest::create("slowCommand", "test_moudule", json::Json(R"({})")).toStr(),
+                       [](const std::string&) {});
+    api.processRequest(wpRequest::create("testCommand", "test_moudule", json::Json(R"({})")).toStr(),
+                       [&](const std::string& res)
+                       {
+                           std::lock_guard lock {mutex};
+                           fastResponse = res;
+                           cv.notify_one();
+                       });
+
+    // The fast request completes while the slow one is still being handled
+    {
+        std::unique_lock lock {mutex};
+        ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&]() { return !fastResponse.empty(); }));
+    }
+    EXPECT_EQ(fastResponse, R"({"data":{"response":"OK"},"error":0})");
+
+    release.set_value();
+}
@@ -72,6 +72,55 @@ INSTANTIATE_TEST_SUITE_P(CatalogCommand,
                                            std::make_tuple(true, successCollectionAssetJson, successYml),
                                            std::make_tuple(true, successResourceAssetJson, successJson.str())));
 
+using BulkItems = std::vector<std::pair<api::catalog::Resource, std::string>>;
+const std::string failContentJson(fmt::format("{{\"name\": \"{}\"}}", failName.fullName()));
+
+class CatalogBulkPostTest : public ::testing::TestWithParam<std::tuple<bool, BulkItems>>
+{
+protected:
+    void SetUp() override
+    {
+        logging::testInit();
+        m_spCatalog = std::make_unique<api::catalog::Catalog>(getConfig());
+    }
+    std::unique_ptr<api::catalog::Catalog> m_spCatalog;
+};
+
+TEST_P(CatalogBulkPostTest, CatalogCommand)
+{
+    auto [isFailure, items] = GetParam();
+
+    std::optional<base::Error> error;
+    ASSERT_NO_THROW(error = m_spCatalog->postResourceBulk(items, "nsId"));
+    if (isFailure)
+    {
+        ASSERT_TRUE(error);
+    }
+    else
+    {
+        ASSERT_FALSE(error);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    CatalogCommand,
+    CatalogBulkPostTest,
+    ::testing::Values(
+        // Every item is valid
+        std::make_tuple(false,
+                        BulkItems {{successCollectionAssetJson, successJson.str()},
+                                   {successCollectionAssetYml, successYml}}),
+        // One invalid item fails the whole bulk
+        std::make_tuple(true,
+                        BulkItems {{successCollectionAssetJson, successJson.str()},
+                                   {successCollectionAssetJson, successYml}}),
+        // Items must target a collection
+        std::make_tuple(true, BulkItems {{successResourceAssetJson, successJson.str()}}),
+        // A store failure rolls the already added items back and reports the error
+        std::make_tuple(true,
+                        BulkItems {{successCollectionAssetJson, successJson.str()},
+                                   {successCollectionAssetJson, failContentJson}})));
+
 class CatalogDeleteTest : public ::testing::TestWithParam<std::tuple<bool, api::catalog::Resource>>
 {
 protected:
@@ -1078,7 +1078,8 @@ TEST_P(DumpWithMultiplePages, Functionality)
     EXPECT_CALL(*kvdbManager, existsDB("test")).WillRepeatedly(testing::Return(true));
 
     auto kvdbHandler = std::make_shared<MockKVDBHandler>();
-    EXPECT_CALL(*kvdbHandler, dump(testing::_, testing::_)).WillRepeatedly(testing::Return(kvdbDumpOk()));
+    EXPECT_CALL(*kvdbHandler, dump(testing::_, testing::_, testing::_))
+        .WillRepeatedly(testing::Return(base::noError()));
 
     EXPECT_CALL(*kvdbManager, getKVDBHandler("test", "test")).WillRepeatedly(testing::Return(kvdbHandler));
 
@@ -1103,6 +1104,39 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(R"({"name": "test", "page": 1, "records": 10})", R"({"status":"OK","entries":[]})"),
         std::make_tuple(R"({"name": "test", "page": 3, "records": 5})", R"({"status":"OK","entries":[]})")));
 
+TEST(DumpStreamedEntries, EntriesAreStreamedIntoTheResponse)
+{
+    logging::testInit();
+
+    auto kvdbManager = std::make_shared<MockKVDBManager>();
+    EXPECT_CALL(*kvdbManager, existsDB("test")).WillOnce(testing::Return(true));
+
+    auto kvdbHandler = std::make_shared<MockKVDBHandler>();
+    EXPECT_CALL(*kvdbHandler, dump(1, 10, testing::_))
+        .WillOnce(testing::Invoke(
+            [](const unsigned int, const unsigned int, const kvdbManager::IKVDBHandler::DumpVisitor& visitor)
+                -> base::OptError
+            {
+                visitor("key1", R"("value1")");
+                visitor("key2", R"({"field":"value2"})");
+                return base::noError();
+            }));
+
+    EXPECT_CALL(*kvdbManager, getKVDBHandler("test", "test")).WillOnce(testing::Return(kvdbHandler));
+
+    api::HandlerSync cmd;
+    ASSERT_NO_THROW(cmd = managerDump(kvdbManager, "test"));
+    json::Json jsonParams(R"({"name": "test", "page": 1, "records": 10})");
+    const auto response = cmd(api::wpRequest::create(rCommand, rOrigin, jsonParams));
+    const auto expectedData = json::Json(
+        R"({"status":"OK","entries":[{"key":"key1","value":"value1"},{"key":"key2","value":{"field":"value2"}}]})");
+
+    ASSERT_TRUE(response.isValid());
+    ASSERT_EQ(response.error(), 0);
+    ASSERT_FALSE(response.message().has_value());
+    ASSERT_EQ(response.data(), expectedData);
+}
+
 template<typename T>
 class SearchTest : public ::testing::TestWithParam<T>
 {
@@ -18,10 +18,17 @@
 
 #include <filesystem>
 #include <httplib.h>
+#include <memory>
 #include <thread>
 
+#include <metrics/iMetricsScope.hpp>
+
 namespace apiserver
 {
+constexpr auto DEFAULT_WORKER_THREADS {4U};       ///< Default size of the request worker pool.
+constexpr auto DEFAULT_KEEPALIVE_MAX_COUNT {64};  ///< Default requests served per kept-alive connection.
+constexpr auto DEFAULT_KEEPALIVE_TIMEOUT_SEC {5}; ///< Default idle seconds before a kept-alive connection is closed.
+
 enum class Method
 {
     GET,
@@ -53,6 +60,9 @@ class ApiServer final
 {
     httplib::Server m_svr;
     std::thread m_thread;
+    std::shared_ptr<metricsManager::IMetricsScope> m_metricsScope;
+    std::shared_ptr<metricsManager::iCounter<uint64_t>> m_requestCounter;
+    std::shared_ptr<metricsManager::iHistogram<uint64_t>> m_requestDuration;
 
 public:
     /**
@@ -61,8 +71,17 @@ public:
      * This constructor initializes the ApiServer object by setting up the logger and error handler.
      * The error handler is set to a lambda function that handles invalid requests. It creates a JSON response
      * with an error message and the HTTP status code, and sets the response content type to "application/json".
+     * It also sizes the request worker pool and enables connection keep-alive with an idle timeout.
+     *
+     * @param metricsScope Metrics scope used to record per-request metrics, may be null to disable them.
+     * @param workerThreads Number of threads serving requests.
+     * @param keepAliveMaxCount Maximum number of requests served over a single kept-alive connection.
+     * @param keepAliveTimeoutSec Idle seconds before a kept-alive connection is closed.
      */
-    ApiServer();
+    explicit ApiServer(std::shared_ptr<metricsManager::IMetricsScope> metricsScope = nullptr,
+                       unsigned int workerThreads = DEFAULT_WORKER_THREADS,
+                       size_t keepAliveMaxCount = DEFAULT_KEEPALIVE_MAX_COUNT,
+                       time_t keepAliveTimeoutSec = DEFAULT_KEEPALIVE_TIMEOUT_SEC);
 
     /**
      * @brief Destructor for the ApiServer class.
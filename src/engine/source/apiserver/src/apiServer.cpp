@@ -16,22 +16,37 @@
 #include <apiserver/apiServer.hpp>
 #include <base/json.hpp>
 #include <base/logging.hpp>
+#include <chrono>
 #include <stdexcept>
+#include <utility>
 
 using namespace apiserver;
 
-ApiServer::ApiServer()
+ApiServer::ApiServer(std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                     unsigned int workerThreads,
+                     size_t keepAliveMaxCount,
+                     time_t keepAliveTimeoutSec)
+    : m_metricsScope {std::move(metricsScope)}
 {
+    if (m_metricsScope)
+    {
+        m_requestCounter = m_metricsScope->getCounterUInteger("RequestsProcessed");
+        m_requestDuration = m_metricsScope->getHistogramUInteger("RequestDurationUs");
+    }
+
+    m_svr.new_task_queue = [workerThreads]() { return new httplib::ThreadPool(workerThreads); };
+    m_svr.set_keep_alive_max_count(keepAliveMaxCount);
+    m_svr.set_keep_alive_timeout(keepAliveTimeoutSec);
+
     m_svr.set_logger(
         [](const auto& /*req*/, const auto& /*res*/)
         {
-            // TODO: Add metrics here.
+            // Request metrics are recorded around the route handlers, where the duration is known.
         });
 
     m_svr.set_error_handler(
         [](const auto& /*req*/, auto& res)
         {
-            // TODO: Add metrics here.
             json::Json response {};
             response.appendString("Service Unavailable", "/error");
             response.setInt(res.status, "/code");
@@ -88,12 +103,28 @@ void ApiServer::addRoute(const Method method,
                          const std::string& route,
                          const std::function<void(const httplib::Request&, httplib::Response&)>& handler)
 {
+    auto timedHandler {handler};
+
+    if (m_metricsScope)
+    {
+        timedHandler = [this, handler](const httplib::Request& req, httplib::Response& res)
+        {
+            const auto start {std::chrono::steady_clock::now()};
+            handler(req, res);
+            const auto elapsed {
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)};
+
+            m_requestCounter->addValue(1UL);
+            m_requestDuration->recordValue(static_cast<uint64_t>(elapsed.count()));
+        };
+    }
+
     switch (method)
     {
-        case Method::GET: m_svr.Get(route, handler); break;
-        case Method::POST: m_svr.Post(route, handler); break;
-        case Method::PUT: m_svr.Put(route, handler); break;
-        case Method::DELETE: m_svr.Delete(route, handler); break;
+        case Method::GET: m_svr.Get(route, timedHandler); break;
+        case Method::POST: m_svr.Post(route, timedHandler); break;
+        case Method::PUT: m_svr.Put(route, timedHandler); break;
+        case Method::DELETE: m_svr.Delete(route, timedHandler); break;
         default: LOG_ERROR("Invalid method: {}", static_cast<int>(method)); break;
     }
 }
@@ -24,6 +24,13 @@ TEST(ApiServerTest, Constructor)
     ASSERT_FALSE(apiServer.isRunning());
 }
 
+TEST(ApiServerTest, ConstructorWithTuning)
+{
+    // No metrics scope, custom worker pool size and keep-alive settings
+    apiserver::ApiServer apiServer(nullptr, 2, 16, 1);
+    ASSERT_FALSE(apiServer.isRunning());
+}
+
 TEST(ApiServerTest, Start)
 {
     // Create an instance of ApiServer
@@ -0,0 +1,131 @@
+#ifndef _BASE_EVENT_TRACE_HPP
+#define _BASE_EVENT_TRACE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <base/baseTypes.hpp>
+
+/**
+ * @brief Opt-in sampling tracer for stage latencies across the event pipeline.
+ *
+ * When enabled, 1 every N events carries a vector of timestamps under a
+ * reserved path: each pipeline stage appends its timestamp and the last stage
+ * consumes the vector to compute per-stage latencies. Disabled tracing costs a
+ * single branch on the hot path, and untraced events only pay the enabled check.
+ */
+namespace base::eventTrace
+{
+
+/// Reserved path where sampled events carry their stage timestamps.
+constexpr std::string_view TRACE_PATH = "/_trace";
+
+namespace detail
+{
+/// Sampling period shared by every stage. 0 means tracing is disabled.
+inline std::atomic<std::size_t>& samplePeriod()
+{
+    static std::atomic<std::size_t> value {0};
+    return value;
+}
+} // namespace detail
+
+/**
+ * @brief Configures the sampling period.
+ *
+ * @param sampleEvery Stamp 1 every sampleEvery events, 0 disables tracing.
+ */
+inline void configure(std::size_t sampleEvery)
+{
+    detail::samplePeriod().store(sampleEvery, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Whether tracing is enabled. The only cost on the untraced path.
+ */
+inline bool enabled()
+{
+    return detail::samplePeriod().load(std::memory_order_relaxed) != 0;
+}
+
+/**
+ * @brief Decides whether the next event is sampled.
+ *
+ * Counts per thread, so with T threads each thread samples 1 every N of its own
+ * events and the overall rate stays 1 in N.
+ *
+ * @return true 1 every N calls on the calling thread.
+ */
+inline bool sample()
+{
+    thread_local std::size_t counter = 0;
+    return ++counter % detail::samplePeriod().load(std::memory_order_relaxed) == 0;
+}
+
+/**
+ * @brief Current steady-clock time in microseconds, comparable between stages
+ * within the process.
+ */
+inline int64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * @brief Appends the current timestamp to the event's trace vector, creating it
+ * on the first stamp.
+ *
+ * @param event The event to stamp.
+ */
+inline void stamp(const Event& event)
+{
+    json::Json jTimestamp;
+    jTimestamp.setInt64(now());
+    event->appendJson(jTimestamp, TRACE_PATH);
+}
+
+/**
+ * @brief Whether the event carries a trace vector.
+ *
+ * @param event The event to check.
+ */
+inline bool isTraced(const Event& event)
+{
+    return event->exists(TRACE_PATH);
+}
+
+/**
+ * @brief Extracts and removes the trace vector from the event.
+ *
+ * Erasing keeps the reserved path from leaking into the processed document.
+ *
+ * @param event The event to consume the trace from.
+ * @return The stage timestamps in stamping order, std::nullopt if the event is
+ * not traced.
+ */
+inline std::optional<std::vector<int64_t>> take(const Event& event)
+{
+    auto jStamps = event->getArray(TRACE_PATH);
+    if (!jStamps.has_value())
+    {
+        return std::nullopt;
+    }
+
+    std::vector<int64_t> stamps;
+    stamps.reserve(jStamps->size());
+    for (const auto& jStamp : jStamps.value())
+    {
+        stamps.push_back(jStamp.getInt64().value_or(0));
+    }
+
+    event->erase(TRACE_PATH);
+    return stamps;
+}
+
+} // namespace base::eventTrace
+
+#endif // _BASE_EVENT_TRACE_HPP
@@ -1,12 +1,14 @@
 #ifndef _GRAPH_H
 #define _GRAPH_H
 
+#include <algorithm>
 #include <functional>
 #include <queue>
 #include <sstream>
 #include <stack>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <fmt/format.h>
@@ -23,6 +25,7 @@ class Graph
 private:
     K m_root;
     std::unordered_map<K, T> m_nodes;
+    mutable std::unordered_map<K, std::vector<K>> m_orderCache;
 
     void _addNode(K key, T&& value)
     {
@@ -52,6 +55,7 @@ private:
                 m_edges[from].push_back(to);
             }
         }
+        _invalidateOrderings(from);
     }
 
     void _deleteNode(K key)
@@ -62,6 +66,40 @@ private:
         }
         m_nodes.erase(key);
         m_edges.erase(key);
+        _invalidateOrderings(key);
+    }
+
+    // Drop only the cached orderings that contain the dirty node, orderings over
+    // untouched subgraphs stay valid
+    void _invalidateOrderings(const K& dirty) const
+    {
+        for (auto it = m_orderCache.begin(); it != m_orderCache.end();)
+        {
+            if (it->second.end() != std::find(it->second.begin(), it->second.end(), dirty))
+            {
+                it = m_orderCache.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void _postOrder(const K& key, std::unordered_set<K>& visited, std::vector<K>& order) const
+    {
+        visited.insert(key);
+        if (hasChildren(key))
+        {
+            for (const auto& child : children(key))
+            {
+                if (visited.end() == visited.find(child))
+                {
+                    _postOrder(child, visited, order);
+                }
+            }
+        }
+        order.push_back(key);
     }
 
     void _preOrder(K key, std::function<void(const K&, const T&)> visitor) const
@@ -267,6 +305,51 @@ public:
         _preOrder(m_root, _visitor);
     }
 
+    /**
+     * @brief Get the topological ordering of the subgraph reachable from a node.
+     *
+     * Every reachable node appears exactly once, and always before its children, even
+     * when multiple parent nodes share the same child. The ordering is cached, so
+     * repeated traversals of an unmodified graph do not recompute it. Mutations
+     * (addEdge, injectNode, setRoot) only drop the cached orderings that contain a
+     * modified node, so recomputation after an incremental change is proportional to
+     * the affected subgraph rather than the whole graph.
+     *
+     * @param from Node id to start the ordering from.
+     * @return const std::vector<K>& Topologically ordered node ids.
+     *
+     * @throws std::runtime_error if the node does not exist.
+     */
+    const std::vector<K>& topologicalOrder(const K& from) const
+    {
+        auto it = m_orderCache.find(from);
+        if (m_orderCache.end() != it)
+        {
+            return it->second;
+        }
+
+        if (!hasNode(from))
+        {
+            throw std::runtime_error(fmt::format("Engine base graph: Node \"{}\" does not exist.", from));
+        }
+
+        std::vector<K> order;
+        std::unordered_set<K> visited;
+        _postOrder(from, visited, order);
+        std::reverse(order.begin(), order.end());
+
+        return m_orderCache.emplace(from, std::move(order)).first->second;
+    }
+
+    /**
+     * @brief Get the topological ordering of the graph from the root node.
+     *
+     * @return const std::vector<K>& Topologically ordered node ids.
+     *
+     * @throws std::runtime_error if the root node does not exist.
+     */
+    const std::vector<K>& topologicalOrder() const { return topologicalOrder(m_root); }
+
     /**
      * @brief Get the Graph Str object
      *
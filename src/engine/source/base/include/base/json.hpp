@@ -26,6 +26,95 @@ namespace json
 constexpr bool RECURSIVE {true};
 constexpr bool NOT_RECURSIVE {false};
 
+constexpr size_t ARENA_DEFAULT_CHUNK_SIZE {64 * 1024}; ///< Default chunk size for the Json arena allocator
+
+/**
+ * @brief Reusable allocation arena for Json documents.
+ *
+ * Owns a rapidjson::MemoryPoolAllocator that can back one or more Json documents, so the
+ * per-field heap allocations of the default CrtAllocator are replaced by bump allocations
+ * inside the arena chunks. Resetting the arena releases every chunk at once.
+ *
+ * @warning The arena is not thread safe and must outlive every Json built on it. Calling
+ * reset() while a Json built on the arena is still alive leaves that document dangling.
+ */
+class JsonArena
+{
+private:
+    rapidjson::MemoryPoolAllocator<> m_allocator; ///< The arena allocator
+
+public:
+    /**
+     * @brief Construct a new JsonArena object.
+     *
+     * @param chunkSize Size in bytes of each chunk allocated by the arena.
+     */
+    explicit JsonArena(size_t chunkSize = ARENA_DEFAULT_CHUNK_SIZE)
+        : m_allocator(chunkSize)
+    {
+    }
+
+    JsonArena(const JsonArena&) = delete;
+    JsonArena& operator=(const JsonArena&) = delete;
+
+    /**
+     * @brief Get the underlying rapidjson allocator.
+     *
+     * @return rapidjson::MemoryPoolAllocator<>& The arena allocator.
+     */
+    rapidjson::MemoryPoolAllocator<>& allocator() { return m_allocator; }
+
+    /**
+     * @brief Release every chunk owned by the arena.
+     *
+     * @warning Every Json built on the arena must be dead before calling this.
+     */
+    void reset() { m_allocator.Clear(); }
+
+    /**
+     * @brief Get the number of bytes allocated from the arena so far.
+     *
+     * @return size_t The allocated size in bytes.
+     */
+    size_t size() const { return m_allocator.Size(); }
+};
+
+/**
+ * @brief A precompiled JSON Pointer path.
+ *
+ * Wraps a validated rapidjson::Pointer so the tokenization of the path string is paid once,
+ * typically at policy build time, instead of on every field access. The accessors of Json
+ * accepting a Path resolve fields by walking the cached token array.
+ */
+class Path
+{
+private:
+    std::string m_str;            ///< The string representation of the path
+    rapidjson::Pointer m_pointer; ///< The compiled pointer
+
+public:
+    Path() = default;
+
+    /**
+     * @brief Compile a Path from a JSON Pointer path string.
+     *
+     * @param ptrPath The pointer path, e.g. "/field/subfield". Use Json::formatJsonPath to
+     * convert from dot notation.
+     * @throws std::runtime_error if the path is not a valid JSON Pointer.
+     */
+    explicit Path(std::string_view ptrPath);
+
+    /**
+     * @brief Get the string representation of the path.
+     */
+    const std::string& str() const { return m_str; }
+
+    /**
+     * @brief Get the compiled rapidjson pointer.
+     */
+    const rapidjson::Pointer& pointer() const { return m_pointer; }
+};
+
 class Json
 {
 public:
@@ -167,6 +256,25 @@ public:
      */
     explicit Json(const char* json);
 
+    /**
+     * @brief Construct a new Json empty json object backed by an arena.
+     *
+     * Every value allocation of the document is served by the arena instead of the heap.
+     *
+     * @param arena The arena backing the document, it must outlive this Json.
+     */
+    explicit Json(JsonArena& arena);
+
+    /**
+     * @brief Construct a new Json object from a json string, backed by an arena.
+     *
+     * Every value allocation of the parsed document is served by the arena instead of the heap.
+     *
+     * @param json The json string to parse.
+     * @param arena The arena backing the document, it must outlive this Json.
+     */
+    Json(const char* json, JsonArena& arena);
+
     /**
      * @brief Copy constructs a new Json object.
      * Value is copied.
@@ -283,6 +391,112 @@ public:
      */
     void set(std::string_view basePointerPath, std::string_view referencePointerPath);
 
+    /************************************************************************************/
+    // Compiled path accessors
+    //
+    // Overloads taking a precompiled Path, they skip the per-call tokenization of the
+    // pointer path string. Use them on hot paths where the same field is accessed per event.
+    /************************************************************************************/
+
+    /**
+     * @brief Check if the Json contains a field with the given compiled path.
+     *
+     * @param path The compiled path to check.
+     * @return true The Json contains the field.
+     */
+    bool exists(const Path& path) const;
+
+    /**
+     * @brief Check if the Json contains a field with the given compiled path and value.
+     *
+     * @param path The compiled path to check.
+     * @param value The value to compare.
+     * @return true The Json contains the field with the given value.
+     */
+    bool equals(const Path& path, const Json& value) const;
+
+    /**
+     * @brief Check if the field at basePath has the same value as the field at referencePath.
+     *
+     * @param basePath The compiled base path to check.
+     * @param referencePath The compiled reference path to check.
+     * @return true Both fields exist and have the same value.
+     */
+    bool equals(const Path& basePath, const Path& referencePath) const;
+
+    /**
+     * @brief Set the value of the field with the given compiled path. Overwrites previous value.
+     *
+     * @param path The compiled path to set.
+     * @param value The value to set.
+     */
+    void set(const Path& path, const Json& value);
+
+    /**
+     * @brief Get the value of the string field at the given compiled path.
+     *
+     * @param path The compiled path of the field.
+     * @return The value of the field or nothing if the path is not found or is not a string.
+     */
+    std::optional<std::string> getString(const Path& path) const;
+
+    /**
+     * @brief Get a view of the string field at the given compiled path, avoiding the copy.
+     *
+     * @param path The compiled path of the field.
+     * @return A view of the field value or nothing if the path is not found or is not a string.
+     * @warning The view is only valid until the document is mutated.
+     */
+    std::optional<std::string_view> getStringView(const Path& path) const;
+
+    /**
+     * @brief Get the value of the int field at the given compiled path.
+     *
+     * @param path The compiled path of the field.
+     * @return The value of the field or nothing if the path is not found or is not an int.
+     */
+    std::optional<int> getInt(const Path& path) const;
+
+    /**
+     * @brief Get the value of the int or int64 field at the given compiled path as int64.
+     *
+     * @param path The compiled path of the field.
+     * @return The value of the field or nothing if the path is not found or is not an integer.
+     */
+    std::optional<int64_t> getIntAsInt64(const Path& path) const;
+
+    /**
+     * @brief Get the value of the double field at the given compiled path.
+     *
+     * @param path The compiled path of the field.
+     * @return The value of the field or nothing if the path is not found or is not a double.
+     */
+    std::optional<double_t> getDouble(const Path& path) const;
+
+    /**
+     * @brief Get the value of the bool field at the given compiled path.
+     *
+     * @param path The compiled path of the field.
+     * @return The value of the field or nothing if the path is not found or is not a bool.
+     */
+    std::optional<bool> getBool(const Path& path) const;
+
+    /**
+     * @brief Get a copy of the Json at the given compiled path.
+     *
+     * @param path The compiled path of the field.
+     * @return The Json of the field or nothing if the path is not found.
+     */
+    std::optional<Json> getJson(const Path& path) const;
+
+    /**
+     * @brief Set the string value of the field at the given compiled path.
+     *
+     * @param value The string value to set.
+     * @param path The compiled path of the field.
+     */
+    void setString(std::string_view value, const Path& path);
+
     /************************************************************************************/
     // Getters
     /************************************************************************************/
@@ -300,6 +514,17 @@ public:
      */
     std::optional<std::string> getString(std::string_view path = "") const;
 
+    /**
+     * @brief Get a view of the string field, avoiding the copy.
+     *
+     * @param path The pointer path of the field.
+     * @return A view of the field value or nothing if the path is not found or is not a string.
+     * @warning The view is only valid until the document is mutated.
+     *
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    std::optional<std::string_view> getStringView(std::string_view path = "") const;
+
     /**
      * @brief get the value of the int field.
      * Overwrites previous value. If reference field is not found, sets base field to
@@ -427,6 +652,17 @@ public:
      */
     std::string str() const;
 
+    /**
+     * @brief Get Json string, serializing into a caller-provided buffer.
+     *
+     * @details The buffer is cleared but keeps its allocation, so a caller that serializes
+     * periodically can reuse the same buffer across calls and avoid reallocating it each time.
+     *
+     * @param buffer Buffer to serialize into.
+     * @return std::string_view View over the serialized string, valid until the buffer is reused.
+     */
+    std::string_view str(rapidjson::StringBuffer& buffer) const;
+
     /**
      * @brief Get Json string from an object.
      *
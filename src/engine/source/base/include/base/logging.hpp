@@ -194,6 +194,15 @@ void start(const LoggingConfig& cfg);
  */
 void stop();
 
+/**
+ * @brief Number of records dropped because the async queue was full.
+ *
+ * Only meaningful when the logger was started with dedicated threads, otherwise
+ * it is always 0.
+ * @return std::size_t Dropped record count.
+ */
+std::size_t getDroppedCount();
+
 /**
  * @brief Initializes the logger for testing purposes.
  */
@@ -206,12 +215,28 @@ inline std::string getLambdaName(const char* parentScope, const std::string& lam
 
 } // namespace logging
 
+// Trace and debug sites are guarded so the message arguments are not evaluated nor
+// formatted when the level is disabled: a disabled site costs one branch.
 #define LOG_TRACE(msg, ...)                                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::trace, msg, ##__VA_ARGS__)
+    do                                                                                                                 \
+    {                                                                                                                  \
+        auto _engineLogger = logging::getDefaultLogger();                                                              \
+        if (_engineLogger->should_log(spdlog::level::trace))                                                           \
+        {                                                                                                              \
+            _engineLogger->log(                                                                                        \
+                spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::trace, msg, ##__VA_ARGS__);   \
+        }                                                                                                              \
+    } while (0)
 #define LOG_DEBUG(msg, ...)                                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::debug, msg, ##__VA_ARGS__)
+    do                                                                                                                 \
+    {                                                                                                                  \
+        auto _engineLogger = logging::getDefaultLogger();                                                              \
+        if (_engineLogger->should_log(spdlog::level::debug))                                                           \
+        {                                                                                                              \
+            _engineLogger->log(                                                                                        \
+                spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::debug, msg, ##__VA_ARGS__);   \
+        }                                                                                                              \
+    } while (0)
 #define LOG_INFO(msg, ...)                                                                                             \
     logging::getDefaultLogger()->log(                                                                                  \
         spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::info, msg, ##__VA_ARGS__)
@@ -226,14 +251,25 @@ inline std::string getLambdaName(const char* parentScope, const std::string& lam
         spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::critical, msg, ##__VA_ARGS__)
 
 #define LOG_TRACE_L(functionName, msg, ...)                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::trace, msg, ##__VA_ARGS__)
+    do                                                                                                                 \
+    {                                                                                                                  \
+        auto _engineLogger = logging::getDefaultLogger();                                                              \
+        if (_engineLogger->should_log(spdlog::level::trace))                                                           \
+        {                                                                                                              \
+            _engineLogger->log(                                                                                        \
+                spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::trace, msg, ##__VA_ARGS__);      \
+        }                                                                                                              \
+    } while (0)
 #define LOG_DEBUG_L(functionName, msg, ...)                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::debug, msg, ##__VA_ARGS__)
-#define LOG_TRACE_L(functionName, msg, ...)                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::trace, msg, ##__VA_ARGS__)
+    do                                                                                                                 \
+    {                                                                                                                  \
+        auto _engineLogger = logging::getDefaultLogger();                                                              \
+        if (_engineLogger->should_log(spdlog::level::debug))                                                           \
+        {                                                                                                              \
+            _engineLogger->log(                                                                                        \
+                spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::debug, msg, ##__VA_ARGS__);      \
+        }                                                                                                              \
+    } while (0)
 #define LOG_INFO_L(functionName, msg, ...)                                                                             \
     logging::getDefaultLogger()->log(                                                                                  \
         spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::info, msg, ##__VA_ARGS__)
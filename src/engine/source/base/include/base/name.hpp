@@ -1,10 +1,15 @@
 #ifndef _BASE_NAME_HPP
 #define _BASE_NAME_HPP
 
+#include <cstdint>
 #include <initializer_list>
 #include <iostream>
+#include <memory>
 #include <numeric>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fmt/core.h>
@@ -15,6 +20,97 @@
 namespace base
 {
 
+namespace detail
+{
+
+/**
+ * @brief Global intern pool for Name contents.
+ *
+ * Every distinct name is stored once and identified by a small integer symbol, so copies of a
+ * Name share a single parts vector and equality/hashing compare one integer instead of the part
+ * strings. Entries are never evicted: names come from the bounded set of assets, routes and
+ * store resources.
+ */
+class NamePool final
+{
+private:
+    struct Entry
+    {
+        uint32_t symbol;
+        std::shared_ptr<const std::vector<std::string>> spParts;
+    };
+
+    std::shared_mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+
+    // Parts cannot contain the null character, so it is a collision-free joiner.
+    static std::string keyOf(const std::vector<std::string>& parts)
+    {
+        std::string key;
+        for (const auto& part : parts)
+        {
+            key += part;
+            key += '\0';
+        }
+        return key;
+    }
+
+public:
+    using Symbol = uint32_t;
+
+    /**
+     * @brief Get the global pool instance.
+     */
+    static NamePool& instance()
+    {
+        static NamePool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Shared parts vector of the empty (default constructed) name, symbol 0.
+     */
+    static const std::shared_ptr<const std::vector<std::string>>& emptyParts()
+    {
+        static const auto spEmpty = std::make_shared<const std::vector<std::string>>();
+        return spEmpty;
+    }
+
+    /**
+     * @brief Intern a parts vector, returning its symbol and the shared pooled vector.
+     *
+     * @param parts Parts of the name, consumed if the name was not pooled yet.
+     * @return Symbol identifying the name and the pooled parts vector.
+     */
+    std::pair<Symbol, std::shared_ptr<const std::vector<std::string>>> intern(std::vector<std::string>&& parts)
+    {
+        auto key = keyOf(parts);
+
+        {
+            std::shared_lock lock {m_mutex};
+            auto it = m_entries.find(key);
+            if (it != m_entries.end())
+            {
+                return {it->second.symbol, it->second.spParts};
+            }
+        }
+
+        std::unique_lock lock {m_mutex};
+        auto it = m_entries.find(key);
+        if (it == m_entries.end())
+        {
+            // Symbol 0 is reserved for the empty name.
+            Entry entry {static_cast<Symbol>(m_entries.size() + 1),
+                         std::make_shared<const std::vector<std::string>>(std::move(parts))};
+            it = m_entries.emplace(std::move(key), std::move(entry)).first;
+        }
+
+        return {it->second.symbol, it->second.spParts};
+    }
+};
+
+} // namespace detail
+
 /**
  * @brief Name of a store resource.
  *
@@ -25,7 +121,8 @@ namespace base
  * <part>[SEPARATOR<part>...] Where SEPARATOR is the separator character,
  * currently '/'
  *
- * @note The name is not a path, it's a name.
+ * @note The name is not a path, it's a name. Contents are interned in a global pool: equality
+ * and hashing compare a single integer symbol, and copies share one parts vector.
  */
 class Name
 {
@@ -35,20 +132,21 @@ public:
     constexpr static auto MAX_PARTS = 10;
 
 private:
-    std::vector<std::string> m_parts;
+    detail::NamePool::Symbol m_symbol {0};
+    std::shared_ptr<const std::vector<std::string>> m_spParts {detail::NamePool::emptyParts()};
 
-    void assertSize(size_t size) const
+    static void assertParts(const std::vector<std::string>& parts)
     {
-        if (0 == size)
+        if (parts.empty())
         {
             throw std::runtime_error(fmt::format("Name cannot be empty"));
         }
-        if (MAX_PARTS < size)
+        if (MAX_PARTS < parts.size())
         {
             throw std::runtime_error(fmt::format(
-                "Name size must have {} parts at most at most, but the one inserted has {}", MAX_PARTS, size));
+                "Name size must have {} parts at most at most, but the one inserted has {}", MAX_PARTS, parts.size()));
         }
-        for (const auto& part : m_parts)
+        for (const auto& part : parts)
         {
             if (part.empty())
             {
@@ -57,8 +155,16 @@ private:
         }
     }
 
-    void copy(const Name& other) { m_parts = other.m_parts; }
-    void copyMove(Name&& other) noexcept { m_parts = std::move(other.m_parts); }
+    void intern(std::vector<std::string>&& parts)
+    {
+        std::tie(m_symbol, m_spParts) = detail::NamePool::instance().intern(std::move(parts));
+    }
+
+    void copy(const Name& other)
+    {
+        m_symbol = other.m_symbol;
+        m_spParts = other.m_spParts;
+    }
 
 public:
     Name() = default;
@@ -72,8 +178,8 @@ public:
      */
     Name(const std::vector<std::string>& parts)
     {
-        assertSize(parts.size());
-        m_parts = parts;
+        assertParts(parts);
+        intern(std::vector<std::string>(parts));
     }
 
     /**
@@ -84,8 +190,8 @@ public:
      */
     Name(std::vector<std::string>&& parts)
     {
-        m_parts = std::move(parts);
-        assertSize(m_parts.size());
+        assertParts(parts);
+        intern(std::move(parts));
     }
 
     /**
@@ -96,8 +202,9 @@ public:
      */
     Name(const std::string& fullName)
     {
-        m_parts = base::utils::string::split(fullName, SEPARATOR_C);
-        assertSize(m_parts.size());
+        auto parts = base::utils::string::split(fullName, SEPARATOR_C);
+        assertParts(parts);
+        intern(std::move(parts));
     }
 
     /**
@@ -124,7 +231,7 @@ public:
      *
      * @param other Name to move
      */
-    Name(Name&& other) noexcept { copyMove(std::move(other)); }
+    Name(Name&& other) noexcept { copy(other); }
 
     /**
      * @brief Copy assignment operator
@@ -150,7 +257,7 @@ public:
      */
     Name& operator=(Name&& other) noexcept
     {
-        copyMove(std::move(other));
+        copy(other);
 
         return *this;
     }
@@ -158,11 +265,13 @@ public:
     /**
      * @brief Equality comparison operator
      *
+     * Interned names compare by symbol, without touching the part strings.
+     *
      * @param other Name to compare
      * @return true
      * @return false
      */
-    friend bool operator==(const Name& rh, const Name& lh) { return rh.m_parts == lh.m_parts; }
+    friend bool operator==(const Name& rh, const Name& lh) { return rh.m_symbol == lh.m_symbol; }
 
     /**
      * @brief Inequality comparison operator
@@ -180,9 +289,9 @@ public:
      */
     std::string toStr() const
     {
-        return std::accumulate(m_parts.cbegin() + 1,
-                               m_parts.cend(),
-                               m_parts.front(),
+        return std::accumulate(m_spParts->cbegin() + 1,
+                               m_spParts->cend(),
+                               m_spParts->front(),
                                [](const std::string& a, const std::string& b) -> std::string
                                { return a + SEPARATOR_S + b; });
     }
@@ -219,7 +328,7 @@ public:
         auto parts = lhs.parts();
         parts.insert(parts.end(), rhs.parts().begin(), rhs.parts().end());
 
-        return Name(parts);
+        return Name(std::move(parts));
     }
 
     /**
@@ -235,7 +344,13 @@ public:
      */
     bool operator<(const Name& other) const
     {
-        return std::lexicographical_compare(m_parts.begin(), m_parts.end(), other.m_parts.begin(), other.m_parts.end());
+        if (m_symbol == other.m_symbol)
+        {
+            return false;
+        }
+
+        return std::lexicographical_compare(
+            m_spParts->begin(), m_spParts->end(), other.m_spParts->begin(), other.m_spParts->end());
     }
 
     /**
@@ -251,7 +366,17 @@ public:
      *
      * @return const std::vector<std::string>&
      */
-    const std::vector<std::string>& parts() const { return m_parts; }
+    const std::vector<std::string>& parts() const { return *m_spParts; }
+
+    /**
+     * @brief Get the intern pool symbol of the name
+     *
+     * Distinct names have distinct symbols, equal names share one, so the symbol is a cheap
+     * map/set key. 0 is the symbol of the empty (default constructed) name.
+     *
+     * @return detail::NamePool::Symbol
+     */
+    detail::NamePool::Symbol symbol() const { return m_symbol; }
 };
 
 } // namespace base
@@ -262,16 +387,7 @@ namespace std
 template<>
 struct hash<base::Name>
 {
-    size_t operator()(const base::Name& name) const
-    {
-        std::hash<std::string> hasher;
-        size_t hashValue = 0;
-        for (const auto& part : name.parts())
-        {
-            hashValue ^= hasher(part);
-        }
-        return hashValue;
-    }
+    size_t operator()(const base::Name& name) const { return std::hash<uint32_t> {}(name.symbol()); }
 };
 } // namespace std
 
@@ -2,7 +2,7 @@
 #ifndef _PARSE_EVENT_H
 #define _PARSE_EVENT_H
 
-#include <string>
+#include <string_view>
 
 #include <base/baseTypes.hpp>
 
@@ -18,7 +18,7 @@ constexpr char EVENT_MESSAGE_ID[] {"/event/original"};
  * @param event Wazuh message
  * @return Event Event object
  */
-Event parseWazuhEvent(const std::string& event);
+Event parseWazuhEvent(std::string_view event);
 
 } // namespace base::parseEvent
 
@@ -1,19 +1,47 @@
 #ifndef _RESULT_H
 #define _RESULT_H
 
+#include <functional>
+#include <memory>
 #include <string>
+#include <variant>
 
 namespace base::result
 {
 
+/**
+ * @brief Trace shared between results.
+ *
+ * Operations format their trace messages once at build time and share the same immutable string
+ * across every per-event result, so attaching the trace is a reference count bump instead of a
+ * string copy.
+ */
+using SharedTrace = std::shared_ptr<const std::string>;
+
+/**
+ * @brief Deferred trace, formatted only if the trace is actually read.
+ */
+using DeferredTrace = std::function<std::string()>;
+
 template<typename Event>
 class Result
 {
 private:
+    using Trace = std::variant<std::monostate, SharedTrace, DeferredTrace>;
+
     Event m_payload;
-    std::string m_trace;
+    Trace m_trace;
     bool m_success;
 
+    static Trace intoTrace(std::string&& trace)
+    {
+        if (trace.empty())
+        {
+            return std::monostate {};
+        }
+        return std::make_shared<const std::string>(std::move(trace));
+    }
+
 public:
     /**
      * @brief Construct a new Result object without parameters.
@@ -29,68 +57,51 @@ public:
      * @param success Status of the event.
      */
     Result(Event payload, std::string trace, bool success)
-        : m_payload {payload}
-        , m_trace {trace}
+        : m_payload {std::move(payload)}
+        , m_trace {intoTrace(std::move(trace))}
         , m_success {success}
     {
     }
 
     /**
-     * @brief Copy constructs a new Result object.
+     * @brief Construct a new Result object with a shared trace.
      *
-     * @param other The Result to copy.
+     * @param payload Event.
+     * @param trace Trace shared with other results, may be nullptr.
+     * @param success Status of the event.
      */
-    Result(const Result& other)
-        : m_payload {other.m_payload}
-        , m_trace {other.m_trace}
-        , m_success {other.m_success}
+    Result(Event payload, SharedTrace trace, bool success)
+        : m_payload {std::move(payload)}
+        , m_success {success}
     {
+        if (trace)
+        {
+            m_trace = std::move(trace);
+        }
     }
 
     /**
-     * @brief Move copy constructor.
+     * @brief Construct a new Result object with a deferred trace.
      *
-     * @param other The Result to copy.
+     * @param payload Event.
+     * @param trace Callable formatting the trace, invoked only if the trace is read.
+     * @param success Status of the event.
      */
-    Result(Result&& other)
-        : m_payload {std::move(other.m_payload)}
-        , m_trace {other.m_trace}
-        , m_success {other.m_success}
+    Result(Event payload, DeferredTrace trace, bool success)
+        : m_payload {std::move(payload)}
+        , m_success {success}
     {
+        if (trace)
+        {
+            m_trace = std::move(trace);
+        }
     }
 
-    /**
-     * @brief Destroy the Result object
-     */
+    Result(const Result& other) = default;
+    Result(Result&& other) = default;
     ~Result() = default;
-
-    /**
-     * @brief Copy assignment operator.
-     *
-     * @param other The Result to copy.
-     * @return Result& The new Result object.
-     */
-    Result& operator=(const Result& other)
-    {
-        m_payload = other.m_payload;
-        m_trace = other.m_trace;
-        m_success = other.m_success;
-        return *this;
-    }
-
-    /**
-     * @brief Move copy assignment operator.
-     *
-     * @param other The Result to move.
-     * @return Result& The new Result object.
-     */
-    Result& operator=(Result&& other)
-    {
-        m_payload = std::move(other.m_payload);
-        m_trace = other.m_trace;
-        m_success = other.m_success;
-        return *this;
-    }
+    Result& operator=(const Result& other) = default;
+    Result& operator=(Result&& other) = default;
 
     /**
      * @brief Check if the result is a success.
@@ -124,18 +135,29 @@ public:
     const Event& payload() const { return m_payload; }
 
     /**
-     * @brief Returns the event trace.
+     * @brief Returns the event trace, materializing a deferred trace if needed.
      *
      * @return std::string the event trace.
      */
-    std::string trace() const { return m_trace; }
+    std::string trace() const
+    {
+        if (std::holds_alternative<SharedTrace>(m_trace))
+        {
+            return *std::get<SharedTrace>(m_trace);
+        }
+        if (std::holds_alternative<DeferredTrace>(m_trace))
+        {
+            return std::get<DeferredTrace>(m_trace)();
+        }
+        return {};
+    }
 
     /**
-     * @brief Returns the event trace.
+     * @brief Returns the event trace, materializing a deferred trace if needed.
      *
      * @return std::string the event trace.
      */
-    std::string popTrace() const { return std::move(m_trace); }
+    std::string popTrace() const { return trace(); }
 
     /**
      * @brief Get the payload object.
@@ -156,7 +178,24 @@ public:
      *
      * @param trace the trace object.
      */
-    void setTrace(std::string trace) { m_trace = trace; }
+    void setTrace(std::string trace) { m_trace = intoTrace(std::move(trace)); }
+
+    /**
+     * @brief Set a trace shared with other results.
+     *
+     * @param trace the trace object, may be nullptr to clear the trace.
+     */
+    void setTrace(SharedTrace trace)
+    {
+        if (trace)
+        {
+            m_trace = std::move(trace);
+        }
+        else
+        {
+            m_trace = std::monostate {};
+        }
+    }
 
     /**
      * @brief Set the payload object.
@@ -179,7 +218,21 @@ public:
 template<typename Event>
 Result<Event> makeSuccess(Event payload, std::string trace = "")
 {
-    return Result<Event> {payload, trace, true};
+    return Result<Event> {std::move(payload), std::move(trace), true};
+}
+
+/**
+ * @brief Returns a success result sharing a prebuilt trace.
+ *
+ * @tparam Event
+ * @param payload event message
+ * @param trace trace shared with other results
+ * @return Result<Event> Result of the event with all the complete information.
+ */
+template<typename Event>
+Result<Event> makeSuccess(Event payload, SharedTrace trace)
+{
+    return Result<Event> {std::move(payload), std::move(trace), true};
 }
 
 /**
@@ -195,7 +248,35 @@ Result<Event> makeSuccess(Event payload, std::string trace = "")
 template<typename Event>
 Result<Event> makeFailure(Event payload, std::string trace = "")
 {
-    return Result<Event> {payload, trace, false};
+    return Result<Event> {std::move(payload), std::move(trace), false};
+}
+
+/**
+ * @brief Returns a failure result sharing a prebuilt trace.
+ *
+ * @tparam Event
+ * @param payload event message
+ * @param trace trace shared with other results
+ * @return Result<Event> Result of the event with all the complete information.
+ */
+template<typename Event>
+Result<Event> makeFailure(Event payload, SharedTrace trace)
+{
+    return Result<Event> {std::move(payload), std::move(trace), false};
+}
+
+/**
+ * @brief Returns a failure result whose trace is formatted only if it is read.
+ *
+ * @tparam Event
+ * @param payload event message
+ * @param trace callable formatting the trace message
+ * @return Result<Event> Result of the event with all the complete information.
+ */
+template<typename Event>
+Result<Event> makeFailure(Event payload, DeferredTrace trace)
+{
+    return Result<Event> {std::move(payload), std::move(trace), false};
 }
 
 } // namespace base::result
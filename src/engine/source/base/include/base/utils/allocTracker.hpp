@@ -0,0 +1,223 @@
+#ifndef _ALLOC_TRACKER_HPP
+#define _ALLOC_TRACKER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Opt-in allocation instrumentation, tagged per subsystem.
+ *
+ * Counters are recorded against the tag installed in the calling thread with ScopedTag, so heap
+ * traffic and Json copies can be attributed to the builder, the router, the event path, etc. The
+ * counters are fed from two places: the global operator-new replacement compiled in when the
+ * ENGINE_ALLOC_TRACKING build option is enabled, and the json::Json copy constructor, which always
+ * reports copies (a no-op while tracking is disabled). Intended for tests and development builds;
+ * nothing is recorded until enable() is called.
+ */
+namespace base::utils::alloctracker
+{
+
+/**
+ * @brief Counters recorded for one subsystem tag.
+ */
+struct TagCounters
+{
+    std::atomic<uint64_t> allocations {0}; ///< Number of heap allocations.
+    std::atomic<uint64_t> bytes {0};       ///< Total bytes requested.
+    std::atomic<uint64_t> jsonCopies {0};  ///< Number of json::Json copy constructions.
+};
+
+/**
+ * @brief Snapshot of the counters of one subsystem tag, as returned by report().
+ */
+struct TagReport
+{
+    std::string tag;
+    uint64_t allocations;
+    uint64_t bytes;
+    uint64_t jsonCopies;
+};
+
+namespace details
+{
+inline std::atomic<bool>& enabledFlag()
+{
+    static std::atomic<bool> enabled {false};
+    return enabled;
+}
+
+inline std::mutex& registryMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+inline std::map<std::string, std::unique_ptr<TagCounters>>& registry()
+{
+    static std::map<std::string, std::unique_ptr<TagCounters>> tags;
+    return tags;
+}
+
+inline TagCounters*& currentCountersRef()
+{
+    static thread_local TagCounters* counters {nullptr};
+    return counters;
+}
+
+inline TagCounters* countersOf(const std::string& tag)
+{
+    std::lock_guard lock {registryMutex()};
+    auto& entry = registry()[tag];
+    if (!entry)
+    {
+        entry = std::make_unique<TagCounters>();
+    }
+    return entry.get();
+}
+} // namespace details
+
+/**
+ * @brief Start recording allocations and Json copies.
+ */
+inline void enable()
+{
+    details::enabledFlag().store(true, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Stop recording. Counters keep their values until reset().
+ */
+inline void disable()
+{
+    details::enabledFlag().store(false, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Whether recording is active.
+ */
+inline bool isEnabled()
+{
+    return details::enabledFlag().load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Record a heap allocation against the calling thread's tag.
+ *
+ * Called by the operator-new replacement; safe to call from any context, re-entrant calls are
+ * dropped so the registry's own allocations are not counted.
+ *
+ * @param bytes Size of the allocation.
+ */
+inline void recordAllocation(std::size_t bytes)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    static thread_local bool inRecord {false};
+    if (inRecord)
+    {
+        return;
+    }
+    inRecord = true;
+
+    auto*& counters = details::currentCountersRef();
+    if (!counters)
+    {
+        counters = details::countersOf("untagged");
+    }
+    counters->allocations.fetch_add(1, std::memory_order_relaxed);
+    counters->bytes.fetch_add(bytes, std::memory_order_relaxed);
+
+    inRecord = false;
+}
+
+/**
+ * @brief Record a json::Json copy construction against the calling thread's tag.
+ */
+inline void recordJsonCopy()
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    auto*& counters = details::currentCountersRef();
+    if (!counters)
+    {
+        counters = details::countersOf("untagged");
+    }
+    counters->jsonCopies.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Installs a subsystem tag on the calling thread for the lifetime of the scope.
+ */
+class ScopedTag final
+{
+private:
+    TagCounters* m_previous;
+
+public:
+    /**
+     * @brief Tag every counter recorded by this thread until the scope ends.
+     *
+     * @param tag Subsystem tag, e.g. "builder" or "router".
+     */
+    explicit ScopedTag(const std::string& tag)
+        : m_previous {details::currentCountersRef()}
+    {
+        details::currentCountersRef() = details::countersOf(tag);
+    }
+
+    ~ScopedTag() { details::currentCountersRef() = m_previous; }
+
+    ScopedTag(const ScopedTag&) = delete;
+    ScopedTag& operator=(const ScopedTag&) = delete;
+    ScopedTag(ScopedTag&&) = delete;
+    ScopedTag& operator=(ScopedTag&&) = delete;
+};
+
+/**
+ * @brief Zero every counter of every tag.
+ */
+inline void reset()
+{
+    std::lock_guard lock {details::registryMutex()};
+    for (auto& [tag, counters] : details::registry())
+    {
+        counters->allocations.store(0, std::memory_order_relaxed);
+        counters->bytes.store(0, std::memory_order_relaxed);
+        counters->jsonCopies.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Snapshot the counters of every tag seen so far, ordered by tag.
+ *
+ * @return std::vector<TagReport>
+ */
+inline std::vector<TagReport> report()
+{
+    std::vector<TagReport> reports;
+    std::lock_guard lock {details::registryMutex()};
+    for (const auto& [tag, counters] : details::registry())
+    {
+        reports.push_back({tag,
+                           counters->allocations.load(std::memory_order_relaxed),
+                           counters->bytes.load(std::memory_order_relaxed),
+                           counters->jsonCopies.load(std::memory_order_relaxed)});
+    }
+    return reports;
+}
+
+} // namespace base::utils::alloctracker
+
+#endif // _ALLOC_TRACKER_HPP
@@ -0,0 +1,149 @@
+#ifndef _COARSE_CLOCK_HPP
+#define _COARSE_CLOCK_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace base::utils::time
+{
+
+constexpr auto COARSE_CLOCK_DEFAULT_GRANULARITY = std::chrono::milliseconds(5); ///< Default tick period.
+
+/**
+ * @brief Coarse cached clock service.
+ *
+ * A background thread refreshes cached system and steady timestamps at a configurable
+ * granularity, so per-event code reads an atomic instead of issuing a clock call per use. While
+ * the service is not running, the getters fall back to the real clocks, so callers never depend
+ * on start() having been called. Readings are stale by at most one tick.
+ */
+class CoarseClock final
+{
+private:
+    std::atomic<int64_t> m_systemNs {0}; ///< Cached system_clock nanoseconds since epoch.
+    std::atomic<int64_t> m_steadyNs {0}; ///< Cached steady_clock nanoseconds since epoch.
+    std::atomic<bool> m_running {false};
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+
+    void refresh()
+    {
+        m_systemNs.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::system_clock::now().time_since_epoch())
+                             .count(),
+                         std::memory_order_relaxed);
+        m_steadyNs.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now().time_since_epoch())
+                             .count(),
+                         std::memory_order_relaxed);
+    }
+
+    CoarseClock() = default;
+
+public:
+    ~CoarseClock() { stop(); }
+
+    CoarseClock(const CoarseClock&) = delete;
+    CoarseClock& operator=(const CoarseClock&) = delete;
+
+    /**
+     * @brief Get the global clock service instance.
+     */
+    static CoarseClock& instance()
+    {
+        static CoarseClock clock;
+        return clock;
+    }
+
+    /**
+     * @brief Start the background tick. Idempotent.
+     *
+     * @param granularity Refresh period; readings are stale by at most this much.
+     */
+    void start(std::chrono::milliseconds granularity = COARSE_CLOCK_DEFAULT_GRANULARITY)
+    {
+        if (m_running.exchange(true))
+        {
+            return;
+        }
+
+        refresh();
+        m_thread = std::thread(
+            [this, granularity]()
+            {
+                std::unique_lock lock {m_mutex};
+                while (m_running.load(std::memory_order_relaxed))
+                {
+                    m_cv.wait_for(lock, granularity);
+                    refresh();
+                }
+            });
+    }
+
+    /**
+     * @brief Stop the background tick and fall back to real clock reads.
+     */
+    void stop()
+    {
+        if (!m_running.exchange(false))
+        {
+            return;
+        }
+
+        m_cv.notify_all();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    /**
+     * @brief Whether the background tick is running.
+     */
+    bool isRunning() const { return m_running.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Cached system_clock time, or a real read while the service is stopped.
+     */
+    std::chrono::system_clock::time_point systemNow() const
+    {
+        if (!isRunning())
+        {
+            return std::chrono::system_clock::now();
+        }
+
+        return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds(m_systemNs.load(std::memory_order_relaxed))));
+    }
+
+    /**
+     * @brief Cached steady_clock time, or a real read while the service is stopped.
+     */
+    std::chrono::steady_clock::time_point steadyNow() const
+    {
+        if (!isRunning())
+        {
+            return std::chrono::steady_clock::now();
+        }
+
+        return std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::nanoseconds(m_steadyNs.load(std::memory_order_relaxed))));
+    }
+
+    /**
+     * @brief Cached whole seconds since the system_clock epoch.
+     */
+    int64_t secondsSinceEpoch() const
+    {
+        return std::chrono::duration_cast<std::chrono::seconds>(systemNow().time_since_epoch()).count();
+    }
+};
+
+} // namespace base::utils::time
+
+#endif // _COARSE_CLOCK_HPP
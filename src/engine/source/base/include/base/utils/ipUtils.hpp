@@ -3,10 +3,24 @@
 
 #include <cstdint>
 #include <iostream>
+#include <string_view>
 
 namespace utils::ip
 {
 
+/**
+ * @brief Try to convert a ipv4 string to a uint32_t without throwing
+ *
+ * Fast path for the per-event checks: a single pass over the string with no
+ * allocations. Only strict dotted-quad addresses are accepted (four octets in range,
+ * no leading zeros, nothing before or after).
+ *
+ * @param ip String to be converted (format x.x.x.x)
+ * @param result Converted ipv4, only written on success
+ * @return true if the string is a strict dotted-quad IPv4 address
+ */
+bool tryIPv4ToUInt(std::string_view ip, uint32_t& result) noexcept;
+
 /**
  * @brief Convert a ipv4 string to a uint32_t
  *
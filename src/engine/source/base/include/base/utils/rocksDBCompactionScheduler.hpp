@@ -0,0 +1,171 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _ROCKS_DB_COMPACTION_SCHEDULER_HPP
+#define _ROCKS_DB_COMPACTION_SCHEDULER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <base/logging.hpp>
+
+namespace utils::rocksdb
+{
+
+constexpr auto COMPACTION_IDLE_WINDOW = std::chrono::seconds(60);
+constexpr auto COMPACTION_POLL_PERIOD = std::chrono::seconds(5);
+
+/**
+ * @brief Schedules CompactRange on embedded RocksDB stores during ingestion idle windows.
+ *
+ * Left to its own devices RocksDB starts compactions at unpredictable times, stealing I/O from
+ * event processing peaks. Stores register a compaction callback and bump a write counter on
+ * every ingestion; a single background thread polls the counters and, once a store has been
+ * quiet for the idle window with writes pending since its last compaction, runs the callback.
+ * Counting a write is one relaxed atomic increment, no clock reads on the write path.
+ */
+class RocksDBCompactionScheduler final
+{
+public:
+    using CompactFn = std::function<void()>;
+
+    /**
+     * @brief Per-store handle, bump the counter on every write.
+     */
+    class StoreHandle final
+    {
+    public:
+        /**
+         * @brief Record one ingestion on the store.
+         */
+        void noteWrite() { m_writes.fetch_add(1, std::memory_order_relaxed); }
+
+    private:
+        friend class RocksDBCompactionScheduler;
+
+        std::atomic<uint64_t> m_writes {0}; ///< Writes seen so far, bumped by the store.
+        uint64_t m_lastSeen {0};            ///< Counter value at the last poll.
+        uint64_t m_lastCompacted {0};       ///< Counter value at the last compaction.
+        std::chrono::steady_clock::time_point m_lastChange {std::chrono::steady_clock::now()};
+        std::string m_name;   ///< Store name, for logging.
+        CompactFn m_compact;  ///< Compaction callback.
+    };
+
+    /**
+     * @brief Process-wide scheduler instance.
+     */
+    static RocksDBCompactionScheduler& instance()
+    {
+        static RocksDBCompactionScheduler scheduler;
+        return scheduler;
+    }
+
+    /**
+     * @brief Register a store for idle-window compaction.
+     *
+     * @param name Store name, used for logging.
+     * @param compact Callback triggering the compaction, invoked from the scheduler thread.
+     * @return std::shared_ptr<StoreHandle> Handle the store keeps alive and notes writes on.
+     * Dropping the handle unregisters the store.
+     */
+    std::shared_ptr<StoreHandle> registerStore(std::string name, CompactFn compact)
+    {
+        auto handle = std::make_shared<StoreHandle>();
+        handle->m_name = std::move(name);
+        handle->m_compact = std::move(compact);
+
+        std::lock_guard lock {m_mutex};
+        m_handles.push_back(handle);
+        return handle;
+    }
+
+    ~RocksDBCompactionScheduler()
+    {
+        {
+            std::lock_guard lock {m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    RocksDBCompactionScheduler(const RocksDBCompactionScheduler&) = delete;
+    RocksDBCompactionScheduler& operator=(const RocksDBCompactionScheduler&) = delete;
+
+private:
+    RocksDBCompactionScheduler()
+        : m_thread {[this]() { loop(); }}
+    {
+    }
+
+    void loop()
+    {
+        std::unique_lock lock {m_mutex};
+        while (!m_cv.wait_for(lock, COMPACTION_POLL_PERIOD, [this]() { return m_stop; }))
+        {
+            const auto now = std::chrono::steady_clock::now();
+
+            for (auto it = m_handles.begin(); it != m_handles.end();)
+            {
+                // The store dropped its handle, retire the entry
+                if (it->use_count() == 1)
+                {
+                    it = m_handles.erase(it);
+                    continue;
+                }
+
+                auto& handle = **it;
+                const auto writes = handle.m_writes.load(std::memory_order_relaxed);
+                if (writes != handle.m_lastSeen)
+                {
+                    // Still ingesting, push the idle window forward
+                    handle.m_lastSeen = writes;
+                    handle.m_lastChange = now;
+                }
+                else if (writes != handle.m_lastCompacted && now - handle.m_lastChange >= COMPACTION_IDLE_WINDOW)
+                {
+                    try
+                    {
+                        handle.m_compact();
+                        handle.m_lastCompacted = writes;
+                    }
+                    catch (const std::exception& e)
+                    {
+                        LOG_WARNING("Idle compaction of '{}' failed: {}", handle.m_name, e.what());
+                        // Do not retry until new writes arrive
+                        handle.m_lastCompacted = writes;
+                    }
+                }
+                ++it;
+            }
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop {false};
+    std::vector<std::shared_ptr<StoreHandle>> m_handles;
+    std::thread m_thread;
+};
+
+} // namespace utils::rocksdb
+
+#endif // _ROCKS_DB_COMPACTION_SCHEDULER_HPP
@@ -13,8 +13,10 @@
 #define _ROCKS_DB_OPTIONS_HPP
 
 #include <memory>
+#include <rocksdb/cache.h>
 #include <rocksdb/db.h>
 #include <rocksdb/table.h>
+#include <rocksdb/write_buffer_manager.h>
 
 namespace utils::rocksdb
 {
@@ -24,6 +26,52 @@ constexpr auto ROCKSDB_MAX_WRITE_BUFFER_NUMBER = 2;
 constexpr auto ROCKSDB_MAX_OPEN_FILES = 256;
 constexpr auto ROCKSDB_NUM_LEVELS = 4;
 constexpr auto ROCKSDB_BLOCK_CACHE_SIZE = 16 * 1024 * 1024;
+constexpr auto ROCKSDB_SHARED_WRITE_BUFFER_SIZE = 128 * 1024 * 1024;
+constexpr auto ROCKSDB_SHARED_BLOCK_CACHE_SIZE = 64 * 1024 * 1024;
+
+/**
+ * @brief Process-wide RocksDB memory resources shared by every embedded store.
+ *
+ * Each wrapper used to allocate its own WriteBufferManager and block cache, statically
+ * partitioning memory between stores and wasting cache on idle ones. Joining these shared
+ * instances puts all memtables under one global budget and lets the block cache evict towards
+ * whichever store is hot, so total RocksDB memory stays bounded by the configured caps.
+ */
+class RocksDBSharedResources final
+{
+public:
+    /**
+     * @brief Block cache shared by all the RocksDB instances.
+     * @return std::shared_ptr<::rocksdb::Cache> Shared cache.
+     */
+    static const std::shared_ptr<::rocksdb::Cache>& blockCache()
+    {
+        static std::shared_ptr<::rocksdb::Cache> cache = ::rocksdb::NewLRUCache(ROCKSDB_SHARED_BLOCK_CACHE_SIZE);
+        return cache;
+    }
+
+    /**
+     * @brief Write buffer manager shared by all the RocksDB instances.
+     * @return std::shared_ptr<::rocksdb::WriteBufferManager> Shared manager.
+     */
+    static const std::shared_ptr<::rocksdb::WriteBufferManager>& writeBufferManager()
+    {
+        static auto manager = std::make_shared<::rocksdb::WriteBufferManager>(ROCKSDB_SHARED_WRITE_BUFFER_SIZE);
+        return manager;
+    }
+
+    /**
+     * @brief Adjust the global block cache capacity, applied to the live cache.
+     * @param bytes New capacity in bytes.
+     */
+    static void setBlockCacheCapacity(size_t bytes) { blockCache()->SetCapacity(bytes); }
+
+    /**
+     * @brief Adjust the global memtable budget, applied to the live manager.
+     * @param bytes New budget in bytes.
+     */
+    static void setWriteBufferCapacity(size_t bytes) { writeBufferManager()->SetBufferSize(bytes); }
+};
 
 class RocksDBOptions final
 {
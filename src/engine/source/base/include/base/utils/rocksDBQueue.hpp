@@ -12,12 +12,16 @@
 #ifndef _ROCKSDB_QUEUE_HPP
 #define _ROCKSDB_QUEUE_HPP
 
+#include "rocksDBOptions.hpp"
 #include "rocksdb/db.h"
 #include "rocksdb/filter_policy.h"
 #include "rocksdb/table.h"
 #include <filesystem>
+#include <queue>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 // RocksDB integration as queue
 template<typename T, typename U = T>
@@ -27,13 +31,12 @@ public:
     explicit RocksDBQueue(const std::string& connectorName)
     {
         // RocksDB initialization.
-        // Read cache is used to cache the data read from the disk.
-        m_readCache = rocksdb::NewLRUCache(16 * 1024 * 1024);
+        // Join the process-wide cache and memtable budget instead of a private partition.
+        m_readCache = utils::rocksdb::RocksDBSharedResources::blockCache();
         rocksdb::BlockBasedTableOptions tableOptions;
         tableOptions.block_cache = m_readCache;
 
-        // Write buffer manager is used to manage the memory used for writing data to the disk.
-        m_writeManager = std::make_shared<rocksdb::WriteBufferManager>(64 * 1024 * 1024);
+        m_writeManager = utils::rocksdb::RocksDBSharedResources::writeBufferManager();
 
         rocksdb::Options options;
         options.table_factory.reset(NewBlockBasedTableFactory(tableOptions));
@@ -138,6 +141,61 @@ public:
         return value;
     }
 
+    /**
+     * @brief Reads the first `count` elements with a single batched lookup.
+     *
+     * The elements are read in queue order through one MultiGet instead of one Get per element, so
+     * a large backlog can be drained without paying a round trip into the storage engine per
+     * document.
+     *
+     * @param count Amount of elements to read, must not exceed the queue size.
+     * @return std::queue<U> Elements read, in queue order.
+     */
+    std::queue<U> getRange(const uint64_t count) const
+    {
+        if (count > m_size)
+        {
+            throw std::out_of_range("Range out of bounds");
+        }
+
+        std::vector<std::string> keys;
+        keys.reserve(count);
+        std::vector<rocksdb::Slice> keySlices;
+        keySlices.reserve(count);
+
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            keys.push_back(std::to_string(m_first + i));
+            keySlices.emplace_back(keys.back());
+        }
+
+        std::vector<std::string> values;
+        const auto statuses = m_db->MultiGet(rocksdb::ReadOptions(), keySlices, &values);
+
+        std::queue<U> result;
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            if (!statuses.at(i).ok())
+            {
+                throw std::runtime_error("Failed to get element at index");
+            }
+
+            if constexpr (std::is_same_v<U, std::string>)
+            {
+                result.push(std::move(values.at(i)));
+            }
+            else
+            {
+                U value;
+                *value.GetSelf() = std::move(values.at(i));
+                value.PinSelf();
+                result.push(std::move(value));
+            }
+        }
+
+        return result;
+    }
+
     U at(const uint64_t index) const
     {
         if (index >= m_size)
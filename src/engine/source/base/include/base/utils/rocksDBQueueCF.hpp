@@ -77,11 +77,9 @@ public:
     explicit RocksDBQueueCF(const std::string& path)
     {
         // RocksDB initialization.
-        // Read cache is used to cache the data read from the disk.
-        m_readCache = rocksdb::NewLRUCache(utils::rocksdb::ROCKSDB_BLOCK_CACHE_SIZE);
-        // Write buffer manager is used to manage the memory used for writing data to the disk.
-        m_writeManager =
-            std::make_shared<rocksdb::WriteBufferManager>(utils::rocksdb::ROCKSDB_WRITE_BUFFER_MANAGER_SIZE);
+        // Join the process-wide cache and memtable budget instead of a private partition.
+        m_readCache = utils::rocksdb::RocksDBSharedResources::blockCache();
+        m_writeManager = utils::rocksdb::RocksDBSharedResources::writeBufferManager();
 
         rocksdb::Options options = utils::rocksdb::RocksDBOptions::buildDBOptions(m_writeManager, m_readCache);
         rocksdb::ColumnFamilyOptions columnFamilyOptions =
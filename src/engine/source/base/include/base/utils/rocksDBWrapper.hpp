@@ -13,6 +13,7 @@
 #define _ROCKS_DB_WRAPPER_HPP
 
 #include "rocksDBColumnFamily.hpp"
+#include "rocksDBCompactionScheduler.hpp"
 #include "rocksDBIterator.hpp"
 #include "rocksDBOptions.hpp"
 #include <algorithm>
@@ -20,9 +21,12 @@
 #include <memory>
 #include <rocksdb/db.h>
 #include <rocksdb/filter_policy.h>
+#include <rocksdb/rate_limiter.h>
 #include <rocksdb/table.h>
+#include <rocksdb/utilities/checkpoint.h>
 #include <rocksdb/utilities/transaction.h>
 #include <rocksdb/utilities/transaction_db.h>
+#include <rocksdb/utilities/write_batch_with_index.h>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -31,6 +35,7 @@
 namespace utils::rocksdb
 {
 class RocksDBTransaction;
+class RocksDBBatch;
 class IRocksDBWrapper
 {
 public:
@@ -65,15 +70,22 @@ public:
      *
      * @param dbPath Path to the RocksDB database.
      * @param enableWal Whether to enable WAL or not.
+     * @param rateLimitBytesPerSec Cap on background I/O (flush and compaction) for this store,
+     * 0 leaves it unlimited.
      */
-    explicit TRocksDBWrapper(std::string dbPath, const bool enableWal = true)
+    explicit TRocksDBWrapper(std::string dbPath, const bool enableWal = true, const int64_t rateLimitBytesPerSec = 0)
         : m_enableWal {enableWal}
         , m_path {std::move(dbPath)}
     {
-        m_readCache = ::rocksdb::NewLRUCache(16 * 1024 * 1024);
-        m_writeManager = std::make_shared<::rocksdb::WriteBufferManager>(128 * 1024 * 1024);
+        // Join the process-wide cache and memtable budget instead of a private partition
+        m_readCache = RocksDBSharedResources::blockCache();
+        m_writeManager = RocksDBSharedResources::writeBufferManager();
 
         ::rocksdb::Options options = RocksDBOptions::buildDBOptions(m_writeManager, m_readCache);
+        if (rateLimitBytesPerSec > 0)
+        {
+            options.rate_limiter.reset(::rocksdb::NewGenericRateLimiter(rateLimitBytesPerSec));
+        }
         ::rocksdb::ColumnFamilyOptions columnFamilyOptions = RocksDBOptions::buildColumnFamilyOptions(m_readCache);
 
         T* dbRawPtr;
@@ -139,6 +151,18 @@ public:
         {
             m_columnsInstances.emplace_back(m_db, handle);
         }
+
+        // Compact during ingestion idle windows instead of colliding with write peaks. The
+        // callback holds the DB weakly so a stale trigger after destruction is a no-op.
+        m_compactionHandle = RocksDBCompactionScheduler::instance().registerStore(
+            m_path,
+            [weakDb = std::weak_ptr<T>(m_db)]()
+            {
+                if (auto db = weakDb.lock())
+                {
+                    db->CompactRange(::rocksdb::CompactRangeOptions(), nullptr, nullptr);
+                }
+            });
     }
 
     /**
@@ -164,6 +188,7 @@ public:
         {
             throw std::runtime_error("Error putting data: " + status.ToString());
         }
+        m_compactionHandle->noteWrite();
     }
 
     /**
@@ -269,6 +294,7 @@ public:
         {
             throw std::runtime_error("Error deleting data: " + status.ToString());
         }
+        m_compactionHandle->noteWrite();
     }
 
     /**
@@ -384,12 +410,42 @@ public:
         m_db->CompactRange(compactOptions, nullptr, nullptr);
     }
 
+    /**
+     * @brief Creates a consistent checkpoint of the database at the given path.
+     *
+     * The checkpoint hard-links the immutable SST files when the target lives on the same
+     * filesystem, so creating it is cheap and does not block readers or writers. The resulting
+     * directory is a complete database that can be opened independently.
+     *
+     * @param checkpointPath Destination directory, must not exist.
+     */
+    void createCheckpoint(const std::string& checkpointPath)
+    {
+        ::rocksdb::Checkpoint* rawCheckpoint {nullptr};
+        if (const auto status = ::rocksdb::Checkpoint::Create(m_db.get(), &rawCheckpoint); !status.ok())
+        {
+            throw std::runtime_error("Failed to create checkpoint builder: " + status.ToString());
+        }
+
+        const std::unique_ptr<::rocksdb::Checkpoint> checkpoint {rawCheckpoint};
+        if (const auto status = checkpoint->CreateCheckpoint(checkpointPath); !status.ok())
+        {
+            throw std::runtime_error("Failed to create checkpoint at '" + checkpointPath + "': " + status.ToString());
+        }
+    }
+
     /**
      * @brief Initialize transaction.
      * @return RocksDBTransaction Transaction object.
      */
     std::unique_ptr<IRocksDBWrapper> createTransaction() { return std::make_unique<RocksDBTransaction>(this); }
 
+    /**
+     * @brief Initialize a write batch.
+     * @return RocksDBBatch Batch object.
+     */
+    std::unique_ptr<IRocksDBWrapper> createBatch() { return std::make_unique<RocksDBBatch>(this); }
+
     void commit() override { throw std::runtime_error("Not implemented"); }
 
     /**
@@ -636,6 +692,7 @@ private:
     const std::string m_path;                                      ///< Location of the DB.
     std::shared_ptr<::rocksdb::Cache> m_readCache;                 ///< Cache for read operations.
     std::shared_ptr<::rocksdb::WriteBufferManager> m_writeManager; ///< Write buffer manager.
+    std::shared_ptr<RocksDBCompactionScheduler::StoreHandle> m_compactionHandle; ///< Idle compaction handle.
 
     /**
      * @brief Returns the column family handle identified by its name.
@@ -682,6 +739,7 @@ private:
     }
 
     friend class RocksDBTransaction;
+    friend class RocksDBBatch;
 };
 
 /**
@@ -881,6 +939,195 @@ private:
         m_txn;                ///< RocksDB transaction.
     bool m_committed {false}; ///< Whether the transaction has been committed or not.
 };
+/**
+ * @brief Wrapper class for RocksDB write batches.
+ *
+ * Buffers puts and deletes in memory and applies them to the database with a single atomic write on
+ * commit, instead of one write per mutation. Reads are answered from the pending batch first and fall
+ * back to the database, so read-modify-write sequences within the batch see their own updates. After a
+ * commit the batch is empty and can be reused for the next group of mutations.
+ *
+ * @note seek() only iterates the database, so pending mutations are not visible to iterators until the
+ * batch is committed.
+ */
+class RocksDBBatch final : public IRocksDBWrapper
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param dbWrapper RocksDB instance.
+     */
+    explicit RocksDBBatch(TRocksDBWrapper<>* dbWrapper)
+        : m_dbWrapper {dbWrapper}
+    {
+        if (!m_dbWrapper)
+        {
+            throw std::runtime_error {"RocksDB instance is null"};
+        }
+    }
+
+    /**
+     * @brief Buffer a key-value pair to be put in the database on commit.
+     * @param key Key to put.
+     * @param value Value to put.
+     * @param columnName Column name where the put will be performed. If empty, the default column will be used.
+     *
+     * @note If the key already exists, the value will be overwritten.
+     */
+    void put(const std::string& key, const ::rocksdb::Slice& value, const std::string& columnName) override
+    {
+        const auto status {m_batch.Put(m_dbWrapper->getColumnFamilyBasedOnName(columnName).handle(), key, value)};
+        if (!status.ok())
+        {
+            throw std::runtime_error {"Failed to put key: " + std::string {status.getState()}};
+        }
+    }
+
+    /**
+     * @brief Buffer a key-value pair to be put in the database on commit.
+     * @param key Key to put.
+     * @param value Value to put.
+     *
+     * @note If the key already exists, the value will be overwritten.
+     */
+    void put(const std::string& key, const ::rocksdb::Slice& value) override { put(key, value, ""); }
+
+    /**
+     * @brief Buffer the deletion of a key-value pair, applied to the database on commit.
+     *
+     * @param key Key to delete.
+     * @param columnName Column name from where to delete. If empty, the default column will be used.
+     */
+    void delete_(const std::string& key, const std::string& columnName) override
+    {
+        const auto status {m_batch.Delete(m_dbWrapper->getColumnFamilyBasedOnName(columnName).handle(), key)};
+        if (!status.ok())
+        {
+            throw std::runtime_error {"Failed to delete key: " + std::string {status.getState()}};
+        }
+    }
+
+    /**
+     * @brief Buffer the deletion of a key-value pair, applied to the database on commit.
+     *
+     * @param key Key to delete.
+     * @param columnName Column name from where to delete. If empty, the default column will be used.
+     */
+    void delete_(const std::string& key) override { delete_(key, ""); }
+
+    /**
+     * @brief Get a value, consulting the pending batch before the database.
+     *
+     * @param key Key to get.
+     * @param value Value to get (::rocksdb::PinnableSlice).
+     * @param columnName Column name from where to get. If empty, the default column will be used.
+     *
+     * @return bool True if the operation was successful.
+     * @return bool False if the key was not found.
+     */
+    bool get(const std::string& key, ::rocksdb::PinnableSlice& value, const std::string& columnName) override
+    {
+        if (key.empty())
+        {
+            throw std::invalid_argument("Key is empty");
+        }
+
+        if (const auto status =
+                m_batch.GetFromBatchAndDB(m_dbWrapper->m_db.get(),
+                                          ::rocksdb::ReadOptions(),
+                                          m_dbWrapper->getColumnFamilyBasedOnName(columnName).handle(),
+                                          key,
+                                          &value);
+            status.IsNotFound())
+        {
+            return false;
+        }
+        else if (!status.ok())
+        {
+            throw std::runtime_error("Error getting data: " + status.ToString());
+        }
+        return true;
+    }
+
+    /**
+     * @brief Get a value, consulting the pending batch before the database.
+     *
+     * @param key Key to get.
+     * @param value Value to get (::rocksdb::PinnableSlice).
+     *
+     * @return bool True if the operation was successful.
+     * @return bool False if the key was not found.
+     */
+    bool get(const std::string& key, ::rocksdb::PinnableSlice& value) override { return get(key, value, ""); }
+
+    /**
+     * @brief Write the buffered mutations to the database in a single atomic write and reset the batch.
+     */
+    void commit() override
+    {
+        ::rocksdb::WriteOptions writeOptions;
+        writeOptions.disableWAL = !m_dbWrapper->m_enableWal;
+
+        if (const auto status {m_dbWrapper->m_db->Write(writeOptions, m_batch.GetWriteBatch())}; !status.ok())
+        {
+            throw std::runtime_error {"Failed to write batch: " + std::string {status.getState()}};
+        }
+
+        m_batch.Clear();
+    }
+
+    /**
+     * @brief Delete all key-value pairs from the database.
+     */
+    void deleteAll() override { m_dbWrapper->deleteAll(); }
+
+    /**
+     * @brief Creates a new column family in the database.
+     *
+     * @note The column handle created is also added to the handles list to be then accessible by other methods.
+     *
+     * @param columnName Name of the new column.
+     */
+    void createColumn(const std::string& columnName) override { m_dbWrapper->createColumn(columnName); }
+
+    /**
+     * @brief Checks whether a column exists in the database or not.
+     *
+     * @param columnName Name of the column.
+     * @return true If the column exists.
+     * @return false If the column doesn't exists.
+     */
+    bool columnExists(const std::string& columnName) const override { return m_dbWrapper->columnExists(columnName); }
+
+    /**
+     * @brief Retrieves all the column families from the DB.
+     *
+     * @return std::vector<std::string> Vector of strings with all the column names.
+     */
+    std::vector<std::string> getAllColumns() override { return m_dbWrapper->getAllColumns(); }
+
+    /**
+     * @brief Seek to specific key
+     *
+     * @param key Key to seek.
+     * @param columnName Column family name.
+     * @return RocksDBIterator  RocksDBIterator Iterator to the database.
+     */
+    RocksDBIterator seek(std::string_view key, const std::string& columnName = "") override // NOLINT
+    {
+        return m_dbWrapper->seek(key, columnName);
+    }
+
+    /**
+     * @brief Flushes the database.
+     */
+    void flush() override { m_dbWrapper->flush(); }
+
+private:
+    TRocksDBWrapper<>* m_dbWrapper;          ///< RocksDB instance.
+    ::rocksdb::WriteBatchWithIndex m_batch; ///< Pending mutations, indexed for read-your-writes lookups.
+};
 using RocksDBWrapper = TRocksDBWrapper<>;
 } // namespace utils::rocksdb
 
@@ -0,0 +1,108 @@
+#ifndef _SCRATCH_STRING_H
+#define _SCRATCH_STRING_H
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace base::utils::string
+{
+
+/**
+ * @brief Append-only string builder with a small inline buffer.
+ *
+ * Short results are composed in a stack buffer and only spill to the heap when they
+ * outgrow it. clear() keeps the spilled capacity, so a reused builder (e.g. a
+ * thread_local scratch in a per-event operation) stops allocating after warm-up, no
+ * matter how many pieces are appended.
+ */
+class ScratchString
+{
+private:
+    constexpr static std::size_t INLINE_CAPACITY = 256;
+
+    char m_inline[INLINE_CAPACITY];     ///< Inline buffer, used until it overflows
+    std::unique_ptr<char[]> m_heap;     ///< Heap buffer once the inline one is outgrown
+    char* m_data {m_inline};            ///< Active buffer
+    std::size_t m_size {0};             ///< Bytes written
+    std::size_t m_capacity {INLINE_CAPACITY}; ///< Active buffer capacity
+
+    void grow(std::size_t needed)
+    {
+        auto newCapacity = m_capacity;
+        while (newCapacity < needed)
+        {
+            newCapacity *= 2;
+        }
+
+        auto newHeap = std::make_unique<char[]>(newCapacity);
+        std::memcpy(newHeap.get(), m_data, m_size);
+        m_heap = std::move(newHeap);
+        m_data = m_heap.get();
+        m_capacity = newCapacity;
+    }
+
+public:
+    ScratchString() = default;
+    ScratchString(const ScratchString&) = delete;
+    ScratchString& operator=(const ScratchString&) = delete;
+
+    /**
+     * @brief Append a piece to the buffer, growing it if needed.
+     *
+     * @param piece Piece to append
+     * @return ScratchString& this, to allow chaining
+     */
+    ScratchString& append(std::string_view piece)
+    {
+        if (m_size + piece.size() > m_capacity)
+        {
+            grow(m_size + piece.size());
+        }
+
+        std::memcpy(m_data + m_size, piece.data(), piece.size());
+        m_size += piece.size();
+        return *this;
+    }
+
+    /**
+     * @brief Append a single character to the buffer, growing it if needed.
+     *
+     * @param c Character to append
+     * @return ScratchString& this, to allow chaining
+     */
+    ScratchString& append(char c)
+    {
+        if (m_size + 1 > m_capacity)
+        {
+            grow(m_size + 1);
+        }
+
+        m_data[m_size++] = c;
+        return *this;
+    }
+
+    /**
+     * @brief Discard the content, keeping the current capacity for reuse.
+     */
+    void clear() { m_size = 0; }
+
+    /**
+     * @brief View of the current content, valid until the next append or clear.
+     */
+    std::string_view view() const { return {m_data, m_size}; }
+
+    /**
+     * @brief Copy of the current content.
+     */
+    std::string str() const { return {m_data, m_size}; }
+
+    std::size_t size() const { return m_size; }
+
+    bool empty() const { return 0 == m_size; }
+};
+
+} // namespace base::utils::string
+
+#endif // _SCRATCH_STRING_H
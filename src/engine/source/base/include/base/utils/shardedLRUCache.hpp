@@ -0,0 +1,131 @@
+#ifndef _SHARDED_LRU_CACHE_HPP
+#define _SHARDED_LRU_CACHE_HPP
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <base/lruCache.hpp>
+
+namespace base::utils
+{
+
+/**
+ * @brief A thread-safe LRU cache split into independently locked shards.
+ *
+ * Each key is assigned to a shard by hash, and each shard holds its own LRUCache
+ * behind its own mutex, so concurrent readers and writers only contend when they
+ * hit the same shard. Eviction is per shard, which makes the total capacity an
+ * approximation: a shard that receives a disproportionate share of the keys
+ * evicts earlier than the others.
+ *
+ * @tparam KeyType The type of the keys used for caching.
+ * @tparam ValueType The type of the values associated with the keys.
+ */
+template<typename KeyType, typename ValueType>
+class ShardedLRUCache final
+{
+private:
+    /**
+     * @brief A single shard: an LRUCache behind its own mutex.
+     */
+    struct Shard
+    {
+        std::mutex mutex;                     ///< Guards the shard's cache.
+        LRUCache<KeyType, ValueType> cache;   ///< The shard's key-value storage.
+
+        explicit Shard(std::size_t capacity)
+            : cache(capacity)
+        {
+        }
+    };
+
+    std::vector<std::unique_ptr<Shard>> m_shards; ///< The shards, fixed at construction.
+
+    /**
+     * @brief Get the shard that owns a key.
+     *
+     * @param key The key to be mapped.
+     * @return Shard& The shard the key belongs to.
+     */
+    Shard& shardFor(const KeyType& key)
+    {
+        return *m_shards[std::hash<KeyType> {}(key) % m_shards.size()];
+    }
+
+public:
+    static constexpr std::size_t DEFAULT_SHARDS = 16; ///< Default number of shards.
+
+    /**
+     * @brief Constructor to initialize a ShardedLRUCache with a total capacity.
+     *
+     * @param capacity The maximum number of key-value pairs the cache can hold,
+     * distributed evenly across the shards (at least one entry per shard).
+     * @param shards The number of shards.
+     */
+    explicit ShardedLRUCache(std::size_t capacity, std::size_t shards = DEFAULT_SHARDS)
+    {
+        if (shards == 0)
+        {
+            shards = 1;
+        }
+
+        auto perShard = capacity / shards;
+        if (perShard == 0)
+        {
+            perShard = 1;
+        }
+
+        m_shards.reserve(shards);
+        for (std::size_t i = 0; i < shards; ++i)
+        {
+            m_shards.emplace_back(std::make_unique<Shard>(perShard));
+        }
+    }
+
+    /**
+     * @brief Inserts a key-value pair, evicting the least recently used entry of
+     * the key's shard if it is full.
+     *
+     * @param key The key to be inserted.
+     * @param value The value associated with the key.
+     */
+    void insert(const KeyType& key, const ValueType& value)
+    {
+        auto& shard = shardFor(key);
+        std::lock_guard lock(shard.mutex);
+        shard.cache.insertKey(key, value);
+    }
+
+    /**
+     * @brief Retrieves the value associated with a key, marking it as the most
+     * recently used of its shard.
+     *
+     * @param key The key for which to retrieve the value.
+     * @return The value associated with the key or std::nullopt if not found.
+     */
+    std::optional<ValueType> get(const KeyType& key)
+    {
+        auto& shard = shardFor(key);
+        std::lock_guard lock(shard.mutex);
+        return shard.cache.getValue(key);
+    }
+
+    /**
+     * @brief Clears every shard, removing all key-value pairs.
+     */
+    void clear()
+    {
+        for (auto& shard : m_shards)
+        {
+            std::lock_guard lock(shard->mutex);
+            shard->cache.clear();
+        }
+    }
+};
+
+} // namespace base::utils
+
+#endif // _SHARDED_LRU_CACHE_HPP
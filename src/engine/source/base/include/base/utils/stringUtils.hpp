@@ -2,6 +2,8 @@
 #define _STRING_UTILS_H
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -18,6 +20,47 @@ namespace base::utils::string
  */
 std::vector<std::string> split(std::string_view str, const char delimiter);
 
+/**
+ * @brief Split a string into a caller-provided array of views, without allocating
+ *
+ * Mirrors the semantics of split(): a single leading delimiter is skipped and a trailing empty
+ * token is dropped, interior empty tokens are kept. The views point into the input buffer, so
+ * they are only valid while it is. At most N tokens are produced, any further input is discarded.
+ *
+ * @tparam N Capacity of the output array
+ * @param str String to be split
+ * @param delimiter Delimiter to split the string
+ * @param output Array receiving the token views
+ * @return std::size_t Number of tokens written
+ */
+template<std::size_t N>
+std::size_t splitView(std::string_view str, const char delimiter, std::array<std::string_view, N>& output)
+{
+    std::size_t count {0};
+    if (!str.empty() && str[0] == delimiter)
+    {
+        str = str.substr(1);
+    }
+
+    while (count < N)
+    {
+        auto pos = str.find(delimiter);
+        if (pos == str.npos)
+        {
+            break;
+        }
+        output[count++] = str.substr(0, pos);
+        str = str.substr(pos + 1);
+    }
+
+    if (!str.empty() && count < N)
+    {
+        output[count++] = str;
+    }
+
+    return count;
+}
+
 /**
  * @brief Concatenates all the strings of a vector, separated by `separator`.
  *
@@ -0,0 +1,132 @@
+#ifndef _THREAD_AFFINITY_HPP
+#define _THREAD_AFFINITY_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace base::utils::affinity
+{
+
+/**
+ * @brief Parse a CPU core set specification into a sorted list of core ids.
+ *
+ * Accepts comma-separated core ids and inclusive ranges, e.g. "0-3,8,10". Whitespace around
+ * entries is ignored and duplicates are collapsed. An empty specification yields an empty list,
+ * meaning no pinning.
+ *
+ * @param spec The core set specification.
+ * @return std::vector<int> The core ids, sorted and deduplicated.
+ * @throw std::runtime_error If the specification is malformed or contains negative cores.
+ */
+inline std::vector<int> parseCoreSet(const std::string& spec)
+{
+    std::vector<int> cores;
+
+    std::size_t pos = 0;
+    while (pos < spec.size())
+    {
+        auto end = spec.find(',', pos);
+        if (end == std::string::npos)
+        {
+            end = spec.size();
+        }
+
+        auto entry = spec.substr(pos, end - pos);
+        pos = end + 1;
+
+        // Trim surrounding whitespace
+        const auto first = entry.find_first_not_of(" \t");
+        if (first == std::string::npos)
+        {
+            continue;
+        }
+        entry = entry.substr(first, entry.find_last_not_of(" \t") - first + 1);
+
+        try
+        {
+            std::size_t parsed = 0;
+            const auto dash = entry.find('-');
+            if (dash == std::string::npos)
+            {
+                const auto core = std::stoi(entry, &parsed);
+                if (parsed != entry.size() || core < 0)
+                {
+                    throw std::invalid_argument {entry};
+                }
+                cores.push_back(core);
+            }
+            else
+            {
+                const auto lowStr = entry.substr(0, dash);
+                const auto highStr = entry.substr(dash + 1);
+                const auto low = std::stoi(lowStr, &parsed);
+                if (parsed != lowStr.size())
+                {
+                    throw std::invalid_argument {entry};
+                }
+                const auto high = std::stoi(highStr, &parsed);
+                if (parsed != highStr.size() || low < 0 || high < low)
+                {
+                    throw std::invalid_argument {entry};
+                }
+                for (auto core = low; core <= high; ++core)
+                {
+                    cores.push_back(core);
+                }
+            }
+        }
+        catch (const std::exception&)
+        {
+            throw std::runtime_error {fmt::format("Invalid core set entry '{}' in '{}'", entry, spec)};
+        }
+    }
+
+    std::sort(cores.begin(), cores.end());
+    cores.erase(std::unique(cores.begin(), cores.end()), cores.end());
+    return cores;
+}
+
+/**
+ * @brief Pin the calling thread to the given core set.
+ *
+ * Restricting a thread to the cores of one NUMA node keeps its first-touch allocations local to
+ * that node, so pinning the ingestion loops and the worker threads to the same node also keeps
+ * the event buffers node-local. An empty core set is a no-op reported as success.
+ *
+ * @param cores The core ids to pin to, as returned by parseCoreSet().
+ * @return true If the affinity was applied (or the set was empty), false otherwise. Pinning is
+ * best effort: on platforms without thread affinity support this always returns false.
+ */
+inline bool pinCurrentThread(const std::vector<int>& cores)
+{
+    if (cores.empty())
+    {
+        return true;
+    }
+
+#ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (const auto core : cores)
+    {
+        CPU_SET(core, &cpuSet);
+    }
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) == 0;
+#else
+    return false;
+#endif
+}
+
+} // namespace base::utils::affinity
+
+#endif // _THREAD_AFFINITY_HPP
@@ -12,7 +12,9 @@
 #ifndef _THREAD_EVENT_DISPATCHER_HPP
 #define _THREAD_EVENT_DISPATCHER_HPP
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <iostream>
 #include <thread>
 
@@ -36,8 +38,10 @@ struct ThreadEventDispatcherParams
 {
     const std::string& dbPath;
     const uint64_t bulkSize = 1;
+    const std::chrono::milliseconds bulkTimeout = std::chrono::seconds(5);
     const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE;
     const ThreadEventDispatcherType dispatcherType = ThreadEventDispatcherType::SINGLE_THREADED_ORDERED;
+    const unsigned int workersCount = 0; ///< Worker threads for the multi-threaded type, 0 uses the hardware concurrency.
 };
 
 /**
@@ -61,13 +65,12 @@ public:
         : m_functor {std::move(functor)}
         , m_maxQueueSize {threadEventDispatcherParams.maxQueueSize}
         , m_bulkSize {threadEventDispatcherParams.bulkSize}
+        , m_bulkTimeout {threadEventDispatcherParams.bulkTimeout}
         , m_queue {std::make_unique<TSafeQueueType>(TQueueType(threadEventDispatcherParams.dbPath))}
         , m_dispatcherType {threadEventDispatcherParams.dispatcherType}
+        , m_workersCount {threadEventDispatcherParams.workersCount}
     {
-        const auto threadsAmount =
-            m_dispatcherType == ThreadEventDispatcherType::MULTI_THREADED_UNORDERED ? MULTI_THREAD : SINGLE_THREAD;
-
-        for (unsigned int i = 0; i < threadsAmount; ++i)
+        for (unsigned int i = 0; i < threadsAmount(); ++i)
         {
             m_threads.push_back(
                 std::thread {&TThreadEventDispatcher<T, U, Functor, TQueueType, TSafeQueueType>::dispatch, this});
@@ -77,8 +80,10 @@ public:
     explicit TThreadEventDispatcher(const ThreadEventDispatcherParams& threadEventDispatcherParams)
         : m_maxQueueSize {threadEventDispatcherParams.maxQueueSize}
         , m_bulkSize {threadEventDispatcherParams.bulkSize}
+        , m_bulkTimeout {threadEventDispatcherParams.bulkTimeout}
         , m_queue {std::make_unique<TSafeQueueType>(TQueueType(threadEventDispatcherParams.dbPath))}
         , m_dispatcherType {threadEventDispatcherParams.dispatcherType}
+        , m_workersCount {threadEventDispatcherParams.workersCount}
     {
     }
 
@@ -88,13 +93,10 @@ public:
 
     void startWorker(Functor functor)
     {
-        const auto threadsAmount =
-            m_dispatcherType == ThreadEventDispatcherType::MULTI_THREADED_UNORDERED ? MULTI_THREAD : SINGLE_THREAD;
-
         m_functor = std::move(functor);
-        m_threads.reserve(threadsAmount);
+        m_threads.reserve(threadsAmount());
 
-        for (unsigned int i = 0; i < threadsAmount; ++i)
+        for (unsigned int i = 0; i < threadsAmount(); ++i)
         {
             m_threads.push_back(
                 std::thread {&TThreadEventDispatcher<T, U, Functor, TQueueType, TSafeQueueType>::dispatch, this});
@@ -137,6 +139,15 @@ public:
         m_queue->postpone(prefix, time);
     }
 
+    uint64_t bulkSize() const { return m_bulkSize.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Adjusts the amount of elements dequeued per bulk at runtime.
+     *
+     * @param bulkSize New bulk size, clamped to a minimum of 1.
+     */
+    void setBulkSize(uint64_t bulkSize) { m_bulkSize.store(std::max<uint64_t>(bulkSize, 1), std::memory_order_relaxed); }
+
 private:
     /**
      * @brief Check if the queue type is a `TSafeQueue`.
@@ -145,6 +156,19 @@ private:
     static constexpr bool m_isTSafeQueue =
         std::is_same_v<base::utils::queue::TSafeQueue<T, U, RocksDBQueue<T, U>>, TSafeQueueType>;
 
+    /**
+     * @brief Amount of worker threads to spawn: one for the single-threaded ordered type, the
+     * configured bound (or the hardware concurrency when unset) for the multi-threaded type.
+     */
+    unsigned int threadsAmount() const
+    {
+        if (m_dispatcherType != ThreadEventDispatcherType::MULTI_THREADED_UNORDERED)
+        {
+            return SINGLE_THREAD;
+        }
+        return m_workersCount > 0 ? m_workersCount : MULTI_THREAD;
+    }
+
     /**
      * @brief Dispatch function to handle queue processing based on the number of threads.
      *
@@ -184,7 +208,7 @@ private:
         {
             if constexpr (m_isTSafeQueue)
             {
-                std::queue<U> data = m_queue->getBulk(m_bulkSize);
+                std::queue<U> data = m_queue->getBulk(m_bulkSize.load(std::memory_order_relaxed), m_bulkTimeout);
                 const auto size = data.size();
 
                 if (!data.empty())
@@ -221,7 +245,7 @@ private:
         {
             if constexpr (m_isTSafeQueue)
             {
-                data = m_queue->getBulkAndPop(m_bulkSize);
+                data = m_queue->getBulkAndPop(m_bulkSize.load(std::memory_order_relaxed), m_bulkTimeout);
 
                 if (!data.empty())
                 {
@@ -262,8 +286,10 @@ private:
     std::atomic_bool m_running = true;
 
     const size_t m_maxQueueSize;
-    const uint64_t m_bulkSize;
+    std::atomic<uint64_t> m_bulkSize;
+    const std::chrono::milliseconds m_bulkTimeout;
     const ThreadEventDispatcherType m_dispatcherType;
+    const unsigned int m_workersCount = 0;
 };
 
 template<typename Type, typename Functor>
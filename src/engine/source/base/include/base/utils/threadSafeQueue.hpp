@@ -11,6 +11,7 @@
 
 #ifndef THREAD_SAFE_QUEUE_H
 #define THREAD_SAFE_QUEUE_H
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <iostream>
@@ -95,7 +96,7 @@ public:
     }
 
     std::queue<U> getBulk(const uint64_t elementsQuantity,
-                          const std::chrono::seconds& timeout = std::chrono::seconds(5))
+                          const std::chrono::milliseconds& timeout = std::chrono::seconds(5))
     {
         std::unique_lock lock {m_mutex};
         std::queue<U> bulkQueue;
@@ -113,13 +114,10 @@ public:
                           });
         }
 
-        // If the queue is not canceled, get the elements.
+        // If the queue is not canceled, get the elements with a single batched read.
         if (!m_canceled)
         {
-            for (auto i = 0; i < elementsQuantity && i < m_queue.size(); ++i)
-            {
-                bulkQueue.push(std::move(m_queue.at(i)));
-            }
+            bulkQueue = m_queue.getRange(std::min<uint64_t>(elementsQuantity, m_queue.size()));
         }
 
         return bulkQueue;
@@ -135,7 +133,7 @@ public:
     }
 
     std::queue<U> getBulkAndPop(const uint64_t elementsQuantity,
-                                const std::chrono::seconds& timeout = std::chrono::seconds(5))
+                                const std::chrono::milliseconds& timeout = std::chrono::seconds(5))
     {
         std::unique_lock lock {m_mutex};
         std::queue<U> bulkQueue;
@@ -153,13 +151,10 @@ public:
                           });
         }
 
-        // If the queue is not canceled, get the elements.
+        // If the queue is not canceled, get the elements with a single batched read.
         if (!m_canceled)
         {
-            for (auto i = 0; i < elementsQuantity && i < m_queue.size(); ++i)
-            {
-                bulkQueue.push(std::move(m_queue.at(i)));
-            }
+            bulkQueue = m_queue.getRange(std::min<uint64_t>(elementsQuantity, m_queue.size()));
         }
 
         // Pop the elements from the queue after getting them.
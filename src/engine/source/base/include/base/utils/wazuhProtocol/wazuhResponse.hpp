@@ -28,9 +28,11 @@ class WazuhResponse
 {
 private:
     // Mandatory fields for all responses
-    int m_error;                          ///< Error code
-    json::Json m_data;                    ///< Data
-    std::optional<std::string> m_message; ///< Optional message
+    int m_error;                           ///< Error code
+    mutable json::Json m_data;             ///< Data
+    std::optional<std::string> m_message;  ///< Optional message
+    std::optional<std::string> m_rawData;  ///< Data already serialized as JSON, avoids a parse/serialize round trip
+    mutable bool m_rawParsed {false};      ///< Whether m_rawData was already parsed into m_data
 
 public:
     // TODO Delete explicit when json constructor does not throw exceptions
@@ -98,12 +100,51 @@ public:
         , m_error(static_cast<int>(RESPONSE_ERROR_CODES::OK))
         , m_message() {};
 
+    /**
+     * @brief Construct a new Wazuh Response object from data already serialized as JSON
+     *
+     * The serialized data is embedded in the response as is when converting it to a
+     * string, skipping the parse into a json object and the re-serialization that the
+     * regular constructors imply. Intended for module responses whose payload is
+     * produced as a JSON string (e.g. serialized protobuf messages).
+     *
+     * @param dataJson Data serialized as a JSON object or array
+     * @param error Error code (0 if no error)
+     * @return WazuhResponse object
+     *
+     * @warning The caller must guarantee that dataJson is a valid JSON object or array,
+     * it is not validated.
+     */
+    static WazuhResponse fromPreSerializedData(std::string dataJson, int error = 0) noexcept
+    {
+        WazuhResponse response {};
+        response.m_error = error;
+        response.m_rawData = std::move(dataJson);
+        return response;
+    }
+
     /**
      * @brief Return data object of the response
      *
      * @return data object
      */
-    const json::Json& data() const { return m_data; }
+    const json::Json& data() const
+    {
+        // Pre-serialized data is parsed lazily, only when the object form is requested
+        if (m_rawData.has_value() && !m_rawParsed)
+        {
+            try
+            {
+                m_data = json::Json {m_rawData.value().c_str()};
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Engine protocol: Pre-serialized response data is not valid JSON: {}", e.what());
+            }
+            m_rawParsed = true;
+        }
+        return m_data;
+    }
 
     /**
      * @brief Return error code of the response
@@ -124,7 +165,12 @@ public:
      *
      * @param data object
      */
-    void data(const json::Json& data) { m_data = json::Json {data}; }
+    void data(const json::Json& data)
+    {
+        m_data = json::Json {data};
+        m_rawData.reset();
+        m_rawParsed = false;
+    }
 
     /**
      * @brief Set error code of the response, overwriting the previous one
@@ -147,13 +193,20 @@ public:
      */
     std::string toString() const
     {
-        if (m_message.has_value())
+        // Pre-serialized data is embedded as is, the regular path serializes the json object
+        const auto format = [this](const std::string& dataStr)
         {
-            json::Json jsonMesage;
-            jsonMesage.setString(m_message.value(), "");
-            return fmt::format("{{\"data\":{},\"error\":{},\"message\":{}}}", m_data.str(), m_error, jsonMesage.str());
-        }
-        return fmt::format("{{\"data\":{},\"error\":{}}}", m_data.str(), m_error);
+            if (m_message.has_value())
+            {
+                json::Json jsonMesage;
+                jsonMesage.setString(m_message.value(), "");
+                return fmt::format(
+                    "{{\"data\":{},\"error\":{},\"message\":{}}}", dataStr, m_error, jsonMesage.str());
+            }
+            return fmt::format("{{\"data\":{},\"error\":{}}}", dataStr, m_error);
+        };
+
+        return m_rawData.has_value() ? format(m_rawData.value()) : format(m_data.str());
     }
 
     /**
@@ -163,7 +216,7 @@ public:
      * @return true
      * @return false
      */
-    bool isValid() const { return !(!m_data.isObject() && !m_data.isArray()); }
+    bool isValid() const { return !(!data().isObject() && !data().isArray()); }
 
     /**
      * @brief Create a WazuhResponse object from a string
@@ -6,6 +6,7 @@
 #include "rapidjson/schema.h"
 
 #include <base/logging.hpp>
+#include <base/utils/allocTracker.hpp>
 #include <fmt/format.h>
 
 namespace
@@ -59,9 +60,30 @@ Json::Json(const char* json)
     }
 }
 
+Json::Json(JsonArena& arena)
+    : m_document {&arena.allocator()} {};
+
+Json::Json(const char* json, JsonArena& arena)
+    : m_document {&arena.allocator()}
+{
+    rapidjson::ParseResult result = m_document.Parse(json);
+    if (!result)
+    {
+        throw std::runtime_error(
+            fmt::format("JSON document could not be parsed: {}", rapidjson::GetParseError_En(result.Code())));
+    }
+
+    auto error = checkDuplicateKeys();
+    if (error)
+    {
+        throw std::runtime_error(fmt::format("JSON document has duplicated keys: {}", error->message));
+    }
+}
+
 Json::Json(const Json& other)
     : m_document {}
 {
+    base::utils::alloctracker::recordJsonCopy();
     m_document.CopyFrom(other.m_document, m_document.GetAllocator());
 }
 
@@ -215,6 +237,118 @@ void Json::set(std::string_view basePtrPath, std::string_view referencePtrPath)
     }
 }
 
+Path::Path(std::string_view ptrPath)
+    : m_str {ptrPath}
+    , m_pointer {ptrPath.data(), ptrPath.size()}
+{
+    if (!m_pointer.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, ptrPath));
+    }
+}
+
+bool Json::exists(const Path& path) const
+{
+    return path.pointer().Get(m_document) != nullptr;
+}
+
+bool Json::equals(const Path& path, const Json& value) const
+{
+    const auto got {path.pointer().Get(m_document)};
+    return (got && *got == value.m_document);
+}
+
+bool Json::equals(const Path& basePath, const Path& referencePath) const
+{
+    const auto fieldValue {basePath.pointer().Get(m_document)};
+    const auto referenceValue {referencePath.pointer().Get(m_document)};
+    return (fieldValue && referenceValue && *fieldValue == *referenceValue);
+}
+
+void Json::set(const Path& path, const Json& value)
+{
+    path.pointer().Set(m_document, value.m_document);
+}
+
+std::optional<std::string> Json::getString(const Path& path) const
+{
+    const auto* value = path.pointer().Get(m_document);
+    if (value && value->IsString())
+    {
+        return std::string {value->GetString()};
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string_view> Json::getStringView(const Path& path) const
+{
+    const auto* value = path.pointer().Get(m_document);
+    if (value && value->IsString())
+    {
+        return std::string_view {value->GetString(), value->GetStringLength()};
+    }
+    return std::nullopt;
+}
+
+std::optional<int> Json::getInt(const Path& path) const
+{
+    const auto* value = path.pointer().Get(m_document);
+    if (value && value->IsInt())
+    {
+        return value->GetInt();
+    }
+    return std::nullopt;
+}
+
+std::optional<int64_t> Json::getIntAsInt64(const Path& path) const
+{
+    const auto* value = path.pointer().Get(m_document);
+    if (value && value->IsInt64())
+    {
+        return value->GetInt64();
+    }
+    else if (value && value->IsInt())
+    {
+        return static_cast<int64_t>(value->GetInt());
+    }
+    return std::nullopt;
+}
+
+std::optional<double_t> Json::getDouble(const Path& path) const
+{
+    const auto* value = path.pointer().Get(m_document);
+    if (value && value->IsDouble())
+    {
+        return value->GetDouble();
+    }
+    return std::nullopt;
+}
+
+std::optional<bool> Json::getBool(const Path& path) const
+{
+    const auto* value = path.pointer().Get(m_document);
+    if (value && value->IsBool())
+    {
+        return value->GetBool();
+    }
+    return std::nullopt;
+}
+
+std::optional<Json> Json::getJson(const Path& path) const
+{
+    const auto* value = path.pointer().Get(m_document);
+    if (value)
+    {
+        return Json(*value);
+    }
+    return std::nullopt;
+}
+
+void Json::setString(std::string_view value, const Path& path)
+{
+    path.pointer().Set(m_document, std::string(value).c_str());
+}
+
 std::optional<std::string> Json::getString(std::string_view path) const
 {
     std::optional<std::string> retval {std::nullopt};
@@ -233,6 +367,23 @@ std::optional<std::string> Json::getString(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
+std::optional<std::string_view> Json::getStringView(std::string_view path) const
+{
+    const auto pp = rapidjson::Pointer(path.data());
+
+    if (pp.IsValid())
+    {
+        const auto* value = pp.Get(m_document);
+        if (value && value->IsString())
+        {
+            return std::string_view {value->GetString(), value->GetStringLength()};
+        }
+        return std::nullopt;
+    }
+
+    throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+}
+
 std::optional<int> Json::getInt(std::string_view path) const
 {
     std::optional<int> retval {std::nullopt};
@@ -453,6 +604,14 @@ std::string Json::str() const
     return buffer.GetString();
 }
 
+std::string_view Json::str(rapidjson::StringBuffer& buffer) const
+{
+    buffer.Clear();
+    rapidjson::Writer<rapidjson::StringBuffer, rapidjson::Document::EncodingType, rapidjson::ASCII<>> writer(buffer);
+    this->m_document.Accept(writer);
+    return {buffer.GetString(), buffer.GetSize()};
+}
+
 std::optional<std::string> Json::str(std::string_view path) const
 {
     std::optional<std::string> retval {std::nullopt};
@@ -990,76 +1149,87 @@ void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::st
 {
     const auto pp = rapidjson::Pointer(path.data());
 
-    if (pp.IsValid())
+    if (!pp.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+    }
+
+    auto* dstRoot = pp.Get(m_document);
+    if (!dstRoot)
     {
-        auto* dstValue = pp.Get(m_document);
-        if (dstValue)
+        throw std::runtime_error(fmt::format(PATH_NOT_FOUND_MSG, path));
+    }
+
+    auto& allocator = m_document.GetAllocator();
+
+    // Iterative merge over an explicit stack of destination/source pairs, instead of
+    // recursing and re-resolving a pointer path per nested member
+    std::vector<std::pair<rapidjson::Value*, const rapidjson::Value*>> pending;
+    pending.emplace_back(dstRoot, &source);
+
+    while (!pending.empty())
+    {
+        auto [dst, src] = pending.back();
+        pending.pop_back();
+
+        if (dst->GetType() != src->GetType())
         {
-            if (dstValue->GetType() == source.GetType())
+            throw std::runtime_error("JSON objects of different types cannot be merged");
+        }
+
+        if (dst->IsObject())
+        {
+            // Reserve up front so member storage does not reallocate while adding,
+            // keeping the member pointers queued for nested merges valid
+            dst->MemberReserve(dst->MemberCount() + src->MemberCount(), allocator);
+            for (auto srcIt = src->MemberBegin(); srcIt != src->MemberEnd(); ++srcIt)
             {
-                if (dstValue->IsObject())
+                auto dstIt = dst->FindMember(srcIt->name);
+                if (dstIt == dst->MemberEnd())
                 {
-                    for (auto srcIt = source.MemberBegin(); srcIt != source.MemberEnd(); ++srcIt)
-                    {
-                        if (dstValue->HasMember(srcIt->name))
-                        {
-                            rapidjson::Value cpyValue {srcIt->value, m_document.GetAllocator()};
-                            if (isRecursive && (srcIt->value.IsObject() || srcIt->value.IsArray()))
-                            {
-                                std::string newPath {std::string(path) + "/" + srcIt->name.GetString()};
-                                merge(isRecursive, cpyValue, newPath);
-                            }
-                            else
-                            {
-                                dstValue->FindMember(srcIt->name)->value = cpyValue;
-                            }
-                        }
-                        else
-                        {
-                            rapidjson::Value cpyValue {srcIt->value, m_document.GetAllocator()};
-                            rapidjson::Value cpyName {srcIt->name, m_document.GetAllocator()};
-                            dstValue->AddMember(cpyName, cpyValue, m_document.GetAllocator());
-                        }
-                    }
+                    rapidjson::Value cpyValue {srcIt->value, allocator};
+                    rapidjson::Value cpyName {srcIt->name, allocator};
+                    dst->AddMember(cpyName, cpyValue, allocator);
+                }
+                else if (isRecursive && (srcIt->value.IsObject() || srcIt->value.IsArray()))
+                {
+                    pending.emplace_back(&dstIt->value, &srcIt->value);
                 }
-                else if (dstValue->IsArray())
+                else
                 {
-                    for (auto srcIt = source.Begin(); srcIt != source.End(); ++srcIt)
+                    dstIt->value = rapidjson::Value {srcIt->value, allocator};
+                }
+            }
+        }
+        else if (dst->IsArray())
+        {
+            dst->Reserve(dst->Size() + src->Size(), allocator);
+            for (auto srcIt = src->Begin(); srcIt != src->End(); ++srcIt)
+            {
+                // Find if value is already in dst
+                // TODO: this is inefficient, but rapidjson does not provide a way
+                // to do it.
+                auto found = false;
+                for (auto dstIt = dst->Begin(); dstIt != dst->End(); ++dstIt)
+                {
+                    if (*dstIt == *srcIt)
                     {
-                        // Find if value is already in dstValue
-                        // TODO: this is inefficient, but rapidjson does not provide a way
-                        // to do it.
-                        auto found = false;
-                        for (auto dstIt = dstValue->Begin(); dstIt != dstValue->End(); ++dstIt)
-                        {
-                            if (*dstIt == *srcIt)
-                            {
-                                found = true;
-                                break;
-                            }
-                        }
-                        if (!found)
-                        {
-                            rapidjson::Value cpyValue {*srcIt, m_document.GetAllocator()};
-                            dstValue->PushBack(cpyValue, m_document.GetAllocator());
-                        }
+                        found = true;
+                        break;
                     }
                 }
-                else
+                if (!found)
                 {
-                    throw std::runtime_error("JSON elements must be both either objects or arrays to be merged");
+                    rapidjson::Value cpyValue {*srcIt, allocator};
+                    dst->PushBack(cpyValue, allocator);
                 }
-
-                return;
             }
-
-            throw std::runtime_error("JSON objects of different types cannot be merged");
         }
-
-        throw std::runtime_error(fmt::format(PATH_NOT_FOUND_MSG, path));
+        else
+        {
+            throw std::runtime_error("JSON elements must be both either objects or arrays to be merged");
+        }
     }
-
-    throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
 void Json::merge(const bool isRecursive, const Json& other, std::string_view path)
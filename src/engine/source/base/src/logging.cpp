@@ -69,8 +69,19 @@ private:
     std::unique_ptr<spdlog::formatter> m_upFormatter;
 };
 
+namespace
+{
+// Cached default logger, avoids taking the spdlog registry lock on every log site
+std::shared_ptr<spdlog::logger> g_defaultLogger;
+} // namespace
+
 std::shared_ptr<spdlog::logger> getDefaultLogger()
 {
+    if (g_defaultLogger)
+    {
+        return g_defaultLogger;
+    }
+
     auto logger = spdlog::get("default");
     if (!logger)
     {
@@ -80,6 +91,12 @@ std::shared_ptr<spdlog::logger> getDefaultLogger()
     return logger;
 }
 
+std::size_t getDroppedCount()
+{
+    auto pool = spdlog::thread_pool();
+    return pool ? static_cast<std::size_t>(pool->overrun_counter()) : 0;
+}
+
 void setLevel(Level level)
 {
     getDefaultLogger()->set_level(SEVERITY_LEVEL.at(level));
@@ -103,24 +120,39 @@ void start(const LoggingConfig& cfg)
         spdlog::init_thread_pool(cfg.queueSize, cfg.dedicatedThreads);
     }
 
-    if (cfg.filePath == STD_ERR_PATH || cfg.filePath == STD_OUT_PATH || cfg.filePath.empty())
+    // With dedicated threads the record is captured into the pool's ring buffer and
+    // formatted/written by the logger threads; a full ring drops the newest record
+    // instead of blocking the caller (drops are counted, see getDroppedCount).
+    auto makeLogger = [&cfg](spdlog::sink_ptr sink) -> std::shared_ptr<spdlog::logger>
     {
-        auto custumSink = std::make_shared<CustomSink>();
+        if (0 < cfg.dedicatedThreads)
+        {
+            return std::make_shared<spdlog::async_logger>(
+                "default", std::move(sink), spdlog::thread_pool(), spdlog::async_overflow_policy::discard_new);
+        }
 
-        logger = std::make_shared<spdlog::logger>("default", custumSink);
+        return std::make_shared<spdlog::logger>("default", std::move(sink));
+    };
+
+    if (cfg.filePath == STD_ERR_PATH || cfg.filePath == STD_OUT_PATH || cfg.filePath.empty())
+    {
+        logger = makeLogger(std::make_shared<CustomSink>());
         spdlog::set_default_logger(logger);
     }
     else
     {
-        logger = spdlog::basic_logger_mt("default", cfg.filePath, cfg.truncate);
+        logger = makeLogger(std::make_shared<spdlog::sinks::basic_file_sink_mt>(cfg.filePath, cfg.truncate));
+        spdlog::register_logger(logger);
     }
 
     setLevel(cfg.level);
     logger->flush_on(spdlog::level::trace);
+    g_defaultLogger = logger;
 }
 
 void stop()
 {
+    g_defaultLogger.reset();
     spdlog::shutdown();
 }
 
@@ -14,7 +14,7 @@ constexpr int MINIMUM_EVENT_ALLOWED_LENGTH = 4;
 constexpr char FIRST_FULL_LOCATION_CHAR {'['};
 } // namespace
 
-Event parseWazuhEvent(const std::string& event)
+Event parseWazuhEvent(std::string_view event)
 {
     int msgStartIndex {0};
 
@@ -33,7 +33,7 @@ Event parseWazuhEvent(const std::string& event)
 
     const int queue {event[0]};
     parseEvent->setInt(queue, EVENT_QUEUE_ID);
-    auto locationIdx = std::string::npos;
+    auto locationIdx = std::string_view::npos;
     // If we have an IPv6, double dots are preceded by a |
     for (auto i = LOCATION_OFFSET; i < event.size(); ++i)
     {
@@ -44,12 +44,12 @@ Event parseWazuhEvent(const std::string& event)
         }
     }
 
-    if (locationIdx == std::string::npos)
+    if (locationIdx == std::string_view::npos)
     {
         throw std::runtime_error("Invalid event format, a colon was expected to be right after the location");
     }
 
-    std::string location = event.substr(LOCATION_OFFSET, locationIdx - LOCATION_OFFSET);
+    std::string location {event.substr(LOCATION_OFFSET, locationIdx - LOCATION_OFFSET)};
     {
         size_t pos;
         while ((pos = location.find("|:")) != std::string::npos)
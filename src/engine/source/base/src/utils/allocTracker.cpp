@@ -0,0 +1,50 @@
+#include "utils/allocTracker.hpp"
+
+#include <cstdlib>
+#include <new>
+
+// Global operator-new replacement feeding the allocation tracker. Compiled into base only when
+// the ENGINE_ALLOC_TRACKING build option is enabled, so production builds keep the default
+// allocator entry points.
+
+void* operator new(std::size_t size)
+{
+    auto* ptr = std::malloc(size);
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    base::utils::alloctracker::recordAllocation(size);
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    auto* ptr = std::malloc(size);
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    base::utils::alloctracker::recordAllocation(size);
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
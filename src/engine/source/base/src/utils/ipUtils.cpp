@@ -7,8 +7,63 @@
 namespace utils::ip
 {
 
+bool tryIPv4ToUInt(std::string_view ip, uint32_t& result) noexcept
+{
+    uint32_t value {0};
+    std::size_t pos {0};
+
+    for (auto octet = 0; octet < 4; ++octet)
+    {
+        if (octet > 0)
+        {
+            if (pos >= ip.size() || ip[pos] != '.')
+            {
+                return false;
+            }
+            ++pos;
+        }
+
+        if (pos >= ip.size() || ip[pos] < '0' || ip[pos] > '9')
+        {
+            return false;
+        }
+
+        uint32_t v {0};
+        std::size_t digits {0};
+        while (digits < 3 && pos < ip.size() && ip[pos] >= '0' && ip[pos] <= '9')
+        {
+            v = v * 10 + (ip[pos] - '0');
+            ++digits;
+            ++pos;
+        }
+
+        // Reject leading zeros and out of range octets
+        if (v > 255 || (digits > 1 && ip[pos - digits] == '0'))
+        {
+            return false;
+        }
+
+        value = (value << 8) | v;
+    }
+
+    if (pos != ip.size())
+    {
+        return false;
+    }
+
+    result = value;
+    return true;
+}
+
 uint32_t IPv4ToUInt(const std::string& ipStr)
 {
+    // Fast path, well formed addresses avoid the sscanf machinery
+    uint32_t fast {0};
+    if (tryIPv4ToUInt(ipStr, fast))
+    {
+        return fast;
+    }
+
     int a, b, c, d {};
     char z {}; // Character after IP
     uint32_t ipUInt = 0;
@@ -1,3 +1,4 @@
+#include "base/utils/coarseClock.hpp"
 #include "base/utils/stringUtils.hpp"
 #include <chrono>
 #include <ctime>
@@ -125,13 +126,13 @@ std::string rawTimestampToISO8601(const std::string& timestamp)
 
 std::chrono::seconds secondsSinceEpoch()
 {
-    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch());
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        CoarseClock::instance().systemNow().time_since_epoch());
 }
 
 int64_t getSecondsFromEpoch()
 {
-    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
-        .count();
+    return CoarseClock::instance().secondsSinceEpoch();
 };
 
 } // namespace base::utils::time
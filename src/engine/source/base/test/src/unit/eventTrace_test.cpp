@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <base/eventTrace.hpp>
+
+class EventTraceTest : public ::testing::Test
+{
+protected:
+    void TearDown() override { base::eventTrace::configure(0); }
+};
+
+TEST_F(EventTraceTest, DisabledByDefault)
+{
+    EXPECT_FALSE(base::eventTrace::enabled());
+}
+
+TEST_F(EventTraceTest, ConfigureEnables)
+{
+    base::eventTrace::configure(10);
+    EXPECT_TRUE(base::eventTrace::enabled());
+
+    base::eventTrace::configure(0);
+    EXPECT_FALSE(base::eventTrace::enabled());
+}
+
+TEST_F(EventTraceTest, SamplesOneEveryN)
+{
+    base::eventTrace::configure(4);
+
+    int sampled = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        if (base::eventTrace::sample())
+        {
+            sampled++;
+        }
+    }
+
+    EXPECT_EQ(sampled, 25);
+}
+
+TEST_F(EventTraceTest, StampAndTake)
+{
+    base::eventTrace::configure(1);
+
+    auto event = std::make_shared<json::Json>(R"({"message":"test"})");
+    EXPECT_FALSE(base::eventTrace::isTraced(event));
+
+    base::eventTrace::stamp(event);
+    base::eventTrace::stamp(event);
+    EXPECT_TRUE(base::eventTrace::isTraced(event));
+
+    auto stamps = base::eventTrace::take(event);
+    ASSERT_TRUE(stamps.has_value());
+    ASSERT_EQ(stamps->size(), 2);
+    EXPECT_LE((*stamps)[0], (*stamps)[1]);
+
+    // The reserved path is erased, so it does not leak into the document
+    EXPECT_FALSE(base::eventTrace::isTraced(event));
+    EXPECT_TRUE(event->isString("/message"));
+}
+
+TEST_F(EventTraceTest, TakeUntracedEvent)
+{
+    auto event = std::make_shared<json::Json>(R"({"message":"test"})");
+    EXPECT_FALSE(base::eventTrace::take(event).has_value());
+}
@@ -253,6 +253,76 @@ TEST(GraphTest, VisitPreOrder)
     ASSERT_NO_THROW(graph.visitLeaves(visitorLeaf));
 }
 
+TEST(GraphTest, TopologicalOrder)
+{
+    auto graph = Graph<std::string, int>("root", 0);
+
+    // Diamond: both "left" and "right" share the child "join"
+    graph.addNode("left", 1);
+    graph.addNode("right", 2);
+    graph.addNode("join", 3);
+    graph.addEdge("root", "left");
+    graph.addEdge("root", "right");
+    graph.addEdge("left", "join");
+    graph.addEdge("right", "join");
+
+    std::vector<std::string> order;
+    ASSERT_NO_THROW(order = graph.topologicalOrder());
+
+    // Every node appears exactly once, even the shared child
+    ASSERT_EQ(order.size(), 4);
+    auto pos = [&order](const std::string& id)
+    {
+        return std::find(order.begin(), order.end(), id) - order.begin();
+    };
+    ASSERT_EQ(pos("root"), 0);
+    ASSERT_LT(pos("left"), pos("join"));
+    ASSERT_LT(pos("right"), pos("join"));
+
+    ASSERT_THROW(graph.topologicalOrder("missing"), std::runtime_error);
+}
+
+TEST(GraphTest, TopologicalOrderCached)
+{
+    auto graph = Graph<std::string, int>("root", 0);
+    graph.addNode("child", 1);
+    graph.addEdge("root", "child");
+
+    // Repeated queries on an unmodified graph return the same cached ordering
+    const auto& order = graph.topologicalOrder();
+    ASSERT_EQ(&order, &graph.topologicalOrder());
+
+    // A mutation invalidates the cached ordering and the next query reflects it
+    graph.addNode("child2", 2);
+    graph.addEdge("root", "child2");
+    const auto& newOrder = graph.topologicalOrder();
+    ASSERT_EQ(newOrder.size(), 3);
+    ASSERT_TRUE(newOrder.end() != std::find(newOrder.begin(), newOrder.end(), "child2"));
+}
+
+TEST(GraphTest, TopologicalOrderPartialInvalidation)
+{
+    auto graph = Graph<std::string, int>("root", 0);
+
+    // Two independent branches under the root
+    graph.addNode("left", 1);
+    graph.addNode("right", 2);
+    graph.addNode("left.0", 3);
+    graph.addEdge("root", "left");
+    graph.addEdge("root", "right");
+    graph.addEdge("left", "left.0");
+
+    const auto& leftOrder = graph.topologicalOrder("left");
+    graph.topologicalOrder("right");
+
+    // Modifying the right branch only drops the orderings that contain it
+    graph.addNode("right.0", 4);
+    graph.addEdge("right", "right.0");
+
+    ASSERT_EQ(&leftOrder, &graph.topologicalOrder("left"));
+    ASSERT_EQ(graph.topologicalOrder("right").size(), 2);
+}
+
 TEST(GraphTest, GetGraphStr)
 {
     auto initialize = []()
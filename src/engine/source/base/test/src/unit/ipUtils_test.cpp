@@ -2,6 +2,37 @@
 
 #include <base/utils/ipUtils.hpp>
 
+TEST(TryIPv4ToUInt, Invalid_format)
+{
+    uint32_t result {};
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt("", result));
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt("1", result));
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt("1.2.3", result));
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt("1.2.3.4.", result));
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt("1.2.3.4.5", result));
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt(" 1.1.1.1", result));
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt("1.1.1.1 ", result));
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt("-1.1.1.1", result));
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt("256.1.1.1", result));
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt("1.1.1.256", result));
+    // Strict grammar, leading zeros are rejected as in inet_pton
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt("01.1.1.1", result));
+    EXPECT_FALSE(utils::ip::tryIPv4ToUInt("1.1.1.001", result));
+}
+
+TEST(TryIPv4ToUInt, Valid_range)
+{
+    uint32_t result {};
+    ASSERT_TRUE(utils::ip::tryIPv4ToUInt("0.0.0.0", result));
+    EXPECT_EQ(result, 0x0);
+    ASSERT_TRUE(utils::ip::tryIPv4ToUInt("127.0.0.1", result));
+    EXPECT_EQ(result, 0x7F'00'00'01);
+    ASSERT_TRUE(utils::ip::tryIPv4ToUInt("192.168.0.1", result));
+    EXPECT_EQ(result, 0b11000000'10101000'00000000'00000001);
+    ASSERT_TRUE(utils::ip::tryIPv4ToUInt("255.255.255.255", result));
+    EXPECT_EQ(result, 0xFFFFFFFF);
+}
+
 TEST(IPv4ToUInt, Invalid_format)
 {
     EXPECT_THROW(utils::ip::IPv4ToUInt(""), std::invalid_argument);
@@ -92,6 +92,51 @@ TEST_F(JsonBase, InitializeJsonString)
     ASSERT_THROW(Json doc {"{\"key\":\"value\"}}"};, std::runtime_error);
 }
 
+TEST_F(JsonBase, InitializeArena)
+{
+    JsonArena arena;
+    ASSERT_NO_THROW(Json doc {arena};);
+    ASSERT_THROW(Json doc("{\"key\":\"value\"}}", arena), std::runtime_error);
+
+    {
+        Json doc {"{\"key\":\"value\"}", arena};
+        ASSERT_EQ(doc.getString("/key").value(), "value");
+        ASSERT_GT(arena.size(), 0);
+    }
+
+    // Every document built on the arena is dead, the arena can be reused
+    arena.reset();
+    ASSERT_EQ(arena.size(), 0);
+    Json doc2 {"{\"other\":1}", arena};
+    ASSERT_EQ(doc2.getInt("/other").value(), 1);
+}
+
+TEST_F(JsonBase, CompiledPath)
+{
+    ASSERT_THROW(Path {"invalid~path"}, std::runtime_error);
+
+    Path keyPath {"/key"};
+    ASSERT_EQ(keyPath.str(), "/key");
+
+    Json doc {R"({"key":"value","nested":{"int":42},"other":"value"})"};
+    ASSERT_TRUE(doc.exists(keyPath));
+    ASSERT_FALSE(doc.exists(Path {"/missing"}));
+    ASSERT_EQ(doc.getString(keyPath).value(), "value");
+    ASSERT_EQ(doc.getInt(Path {"/nested/int"}).value(), 42);
+    ASSERT_EQ(doc.getIntAsInt64(Path {"/nested/int"}).value(), 42);
+    ASSERT_FALSE(doc.getString(Path {"/nested/int"}).has_value());
+
+    ASSERT_TRUE(doc.equals(keyPath, Json {R"("value")"}));
+    ASSERT_TRUE(doc.equals(keyPath, Path {"/other"}));
+    ASSERT_FALSE(doc.equals(keyPath, Path {"/nested/int"}));
+
+    doc.set(Path {"/nested/new"}, Json {"123"});
+    ASSERT_EQ(doc.getInt("/nested/new").value(), 123);
+    doc.setString("hello", Path {"/key"});
+    ASSERT_EQ(doc.getString("/key").value(), "hello");
+    ASSERT_EQ(doc.getJson(Path {"/nested"}).value().getInt("/int").value(), 42);
+}
+
 // TODO: Add more use cases, and add cases once operators and arrays are implemented.
 TEST_F(JsonStatic, FormatJsonPath)
 {
@@ -903,6 +948,33 @@ TEST_F(JsonGettersTest, GetString)
             ASSERT_FALSE(got.has_value());
         }
     }
+}
+
+TEST_F(JsonGettersTest, GetStringView)
+{
+    // Success cases, the view points into the document
+    Json jObjStr {R"({
+        "nested": "value"
+    })"};
+    std::optional<std::string_view> got;
+    ASSERT_NO_THROW(got = jObjStr.getStringView("/nested"));
+    ASSERT_TRUE(got.has_value());
+    ASSERT_EQ("value", got.value());
+
+    Path path {"/nested"};
+    ASSERT_NO_THROW(got = jObjStr.getStringView(path));
+    ASSERT_TRUE(got.has_value());
+    ASSERT_EQ("value", got.value());
+
+    // Failure cases
+    Json jObjInt {R"({
+        "nested": 123
+    })"};
+    ASSERT_NO_THROW(got = jObjInt.getStringView("/nested"));
+    ASSERT_FALSE(got.has_value());
+    ASSERT_NO_THROW(got = jObjInt.getStringView("/missing"));
+    ASSERT_FALSE(got.has_value());
+    ASSERT_THROW(jObjInt.getStringView("invalid~path"), std::runtime_error);
 
     // Wrong pointer
     ASSERT_THROW(jObjStr.getString("object/key"), std::runtime_error);
@@ -82,6 +82,19 @@ TEST_F(LoggerTest, LogGetSomeInstance)
     ASSERT_EQ(logger, someLogger);
 }
 
+TEST_F(LoggerTest, LogAsyncMode)
+{
+    ASSERT_NO_THROW(logging::start(
+        logging::LoggingConfig {.filePath = m_tmpPath, .level = logging::Level::Info, .dedicatedThreads = 1}));
+
+    LOG_INFO("ASYNC message");
+    EXPECT_EQ(logging::getDroppedCount(), 0);
+
+    // Stop drains the queue and joins the logger thread before reading the file
+    logging::stop();
+    EXPECT_NE(readFileContents(m_tmpPath).find("ASYNC message"), std::string::npos);
+}
+
 class LoggerTestLevels : public ::testing::TestWithParam<logging::Level>
 {
 public:
@@ -116,6 +116,25 @@ TEST_F(NameTest, Distinct)
     ASSERT_NE(name1, name4);
 }
 
+TEST_F(NameTest, InternSharing)
+{
+    // Equal names share one pooled parts vector and one symbol
+    base::Name name1({"type", "name", "version"});
+    base::Name name2(fmt::format("type{}name{}version", base::Name::SEPARATOR_S, base::Name::SEPARATOR_S));
+    ASSERT_EQ(&name1.parts(), &name2.parts());
+    ASSERT_EQ(name1.symbol(), name2.symbol());
+
+    base::Name name3({"type", "name", "version2"});
+    ASSERT_NE(name1.symbol(), name3.symbol());
+}
+
+TEST_F(NameTest, InternHash)
+{
+    base::Name name1({"type", "name", "version"});
+    base::Name name2({"type", "name", "version"});
+    ASSERT_EQ(std::hash<base::Name>()(name1), std::hash<base::Name>()(name2));
+}
+
 TEST_F(NameTest, FullName)
 {
     base::Name name({"type", "name", "version"});
@@ -147,3 +147,35 @@ TEST(Result, MakeFailure)
     ASSERT_TRUE(result.failure());
     ASSERT_FALSE(result.success());
 }
+
+TEST(Result, SharedTrace)
+{
+    auto trace = std::make_shared<const std::string>("shared");
+    auto result = makeSuccess<int>(0, trace);
+    ASSERT_EQ(result.trace(), "shared");
+    ASSERT_TRUE(result.success());
+
+    auto result2 = makeFailure<int>(0, trace);
+    ASSERT_EQ(result2.trace(), "shared");
+    ASSERT_TRUE(result2.failure());
+
+    result2.setTrace(SharedTrace {});
+    ASSERT_EQ(result2.trace(), "");
+}
+
+TEST(Result, DeferredTrace)
+{
+    int calls = 0;
+    auto result = makeFailure<int>(0,
+                                   DeferredTrace {
+                                       [&calls]()
+                                       {
+                                           ++calls;
+                                           return std::string {"deferred"};
+                                       }});
+    ASSERT_EQ(calls, 0);
+    ASSERT_EQ(result.trace(), "deferred");
+    ASSERT_EQ(calls, 1);
+    ASSERT_EQ(result.popTrace(), "deferred");
+    ASSERT_EQ(calls, 2);
+}
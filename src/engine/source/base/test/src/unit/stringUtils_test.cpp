@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <array>
 #include <vector>
 
 #include <base/utils/stringUtils.hpp>
@@ -61,6 +62,50 @@ TEST(split, ok_delimiter)
     ASSERT_EQ(result, expected);
 }
 
+TEST(splitView, middle_delimiter)
+{
+    std::string test = "value1/value2";
+    std::array<std::string_view, 4> result {};
+    auto count = base::utils::string::splitView(test, '/', result);
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(result[0], "value1");
+    ASSERT_EQ(result[1], "value2");
+}
+
+TEST(splitView, first_and_final_delimiter)
+{
+    std::string test = "/value1/value2/";
+    std::array<std::string_view, 4> result {};
+    auto count = base::utils::string::splitView(test, '/', result);
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(result[0], "value1");
+    ASSERT_EQ(result[1], "value2");
+}
+
+// Double empty section at middle and end, same semantics as split()
+TEST(splitView, doble_delimiter)
+{
+    std::string test = "//value1//value2//";
+    std::array<std::string_view, 8> result {};
+    auto count = base::utils::string::splitView(test, '/', result);
+    ASSERT_EQ(count, 5);
+    ASSERT_EQ(result[0], "");
+    ASSERT_EQ(result[1], "value1");
+    ASSERT_EQ(result[2], "");
+    ASSERT_EQ(result[3], "value2");
+    ASSERT_EQ(result[4], "");
+}
+
+TEST(splitView, capacity_limit)
+{
+    std::string test = "value1/value2/value3";
+    std::array<std::string_view, 2> result {};
+    auto count = base::utils::string::splitView(test, '/', result);
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(result[0], "value1");
+    ASSERT_EQ(result[1], "value2");
+}
+
 TEST(splitMulti, ThreeDelimiters)
 {
     std::string input = "this is-a test to split by - and ,,where-are included in the result";
@@ -0,0 +1,117 @@
+#include <base/utils/allocTracker.hpp>
+
+#include <gtest/gtest.h>
+
+#include <base/json.hpp>
+
+using namespace base::utils::alloctracker;
+
+namespace
+{
+const TagReport* findTag(const std::vector<TagReport>& reports, const std::string& tag)
+{
+    for (const auto& report : reports)
+    {
+        if (report.tag == tag)
+        {
+            return &report;
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+class AllocTrackerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        reset();
+        enable();
+    }
+
+    void TearDown() override
+    {
+        disable();
+        reset();
+    }
+};
+
+TEST_F(AllocTrackerTest, DisabledRecordsNothing)
+{
+    disable();
+
+    ScopedTag tag {"disabledTag"};
+    recordAllocation(128);
+    recordJsonCopy();
+
+    const auto* entry = findTag(report(), "disabledTag");
+    if (entry != nullptr)
+    {
+        EXPECT_EQ(entry->allocations, 0);
+        EXPECT_EQ(entry->jsonCopies, 0);
+    }
+}
+
+TEST_F(AllocTrackerTest, RecordsAgainstScopedTag)
+{
+    {
+        ScopedTag tag {"builderTag"};
+        recordAllocation(64);
+        recordAllocation(32);
+    }
+
+    const auto* entry = findTag(report(), "builderTag");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->allocations, 2);
+    EXPECT_EQ(entry->bytes, 96);
+}
+
+TEST_F(AllocTrackerTest, CountsJsonCopies)
+{
+    {
+        ScopedTag tag {"routerTag"};
+        json::Json original {R"({"field": "value"})"};
+        json::Json copy {original};
+    }
+
+    const auto* entry = findTag(report(), "routerTag");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->jsonCopies, 1);
+}
+
+TEST_F(AllocTrackerTest, ResetClearsCounters)
+{
+    {
+        ScopedTag tag {"resetTag"};
+        recordAllocation(16);
+    }
+
+    reset();
+
+    const auto* entry = findTag(report(), "resetTag");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->allocations, 0);
+    EXPECT_EQ(entry->bytes, 0);
+}
+
+TEST_F(AllocTrackerTest, NestedTagsRestore)
+{
+    ScopedTag outer {"outerTag"};
+    recordAllocation(8);
+
+    {
+        ScopedTag inner {"innerTag"};
+        recordAllocation(8);
+    }
+
+    recordAllocation(8);
+
+    const auto reports = report();
+    const auto* outerReport = findTag(reports, "outerTag");
+    const auto* innerReport = findTag(reports, "innerTag");
+    ASSERT_NE(outerReport, nullptr);
+    ASSERT_NE(innerReport, nullptr);
+    EXPECT_EQ(outerReport->allocations, 2);
+    EXPECT_EQ(innerReport->allocations, 1);
+}
@@ -0,0 +1,46 @@
+#include <base/utils/coarseClock.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using base::utils::time::CoarseClock;
+
+TEST(CoarseClockTest, FallbackWhenStopped)
+{
+    auto& clock = CoarseClock::instance();
+    ASSERT_FALSE(clock.isRunning());
+
+    const auto before = std::chrono::system_clock::now();
+    const auto cached = clock.systemNow();
+    const auto after = std::chrono::system_clock::now();
+
+    ASSERT_GE(cached, before);
+    ASSERT_LE(cached, after);
+}
+
+TEST(CoarseClockTest, AdvancesWhileRunning)
+{
+    auto& clock = CoarseClock::instance();
+    clock.start(std::chrono::milliseconds(1));
+    ASSERT_TRUE(clock.isRunning());
+
+    const auto first = clock.steadyNow();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const auto second = clock.steadyNow();
+
+    ASSERT_GT(second, first);
+
+    clock.stop();
+    ASSERT_FALSE(clock.isRunning());
+}
+
+TEST(CoarseClockTest, StartIsIdempotent)
+{
+    auto& clock = CoarseClock::instance();
+    clock.start();
+    clock.start();
+    ASSERT_TRUE(clock.isRunning());
+    clock.stop();
+    ASSERT_FALSE(clock.isRunning());
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <base/utils/scratchString.hpp>
+
+using namespace base::utils::string;
+
+TEST(ScratchStringTest, AppendPieces)
+{
+    ScratchString scratch;
+    EXPECT_TRUE(scratch.empty());
+
+    scratch.append("hello").append(' ').append("world");
+    EXPECT_EQ(scratch.view(), "hello world");
+    EXPECT_EQ(scratch.str(), "hello world");
+    EXPECT_EQ(scratch.size(), 11);
+}
+
+TEST(ScratchStringTest, ClearKeepsContentOut)
+{
+    ScratchString scratch;
+    scratch.append("hello");
+    scratch.clear();
+    EXPECT_TRUE(scratch.empty());
+
+    scratch.append("world");
+    EXPECT_EQ(scratch.view(), "world");
+}
+
+TEST(ScratchStringTest, SpillsToHeapBeyondInlineBuffer)
+{
+    ScratchString scratch;
+    const std::string piece(100, 'x');
+
+    // Grow well past the inline capacity, content must survive the spills
+    std::string expected;
+    for (auto i = 0; i < 100; ++i)
+    {
+        scratch.append(piece);
+        expected += piece;
+    }
+
+    EXPECT_EQ(scratch.size(), expected.size());
+    EXPECT_EQ(scratch.view(), expected);
+
+    // Reuse after a spill keeps working
+    scratch.clear();
+    scratch.append("small again");
+    EXPECT_EQ(scratch.view(), "small again");
+}
+
+TEST(ScratchStringTest, SingleCharGrowth)
+{
+    ScratchString scratch;
+    std::string expected;
+    for (auto i = 0; i < 1000; ++i)
+    {
+        scratch.append(static_cast<char>('a' + (i % 26)));
+        expected += static_cast<char>('a' + (i % 26));
+    }
+
+    EXPECT_EQ(scratch.view(), expected);
+}
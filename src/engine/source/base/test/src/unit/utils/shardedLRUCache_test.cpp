@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+#include <base/utils/shardedLRUCache.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(ShardedLRUCacheTest, InsertAndGet)
+{
+    base::utils::ShardedLRUCache<std::string, int> cache(32);
+
+    cache.insert("one", 1);
+    cache.insert("two", 2);
+
+    auto one = cache.get("one");
+    ASSERT_TRUE(one.has_value());
+    EXPECT_EQ(one.value(), 1);
+
+    auto two = cache.get("two");
+    ASSERT_TRUE(two.has_value());
+    EXPECT_EQ(two.value(), 2);
+
+    EXPECT_FALSE(cache.get("three").has_value());
+}
+
+TEST(ShardedLRUCacheTest, InsertOverwritesExistingKey)
+{
+    base::utils::ShardedLRUCache<std::string, int> cache(32);
+
+    cache.insert("key", 1);
+    cache.insert("key", 2);
+
+    auto value = cache.get("key");
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(value.value(), 2);
+}
+
+TEST(ShardedLRUCacheTest, EvictsLeastRecentlyUsedPerShard)
+{
+    // A single shard with capacity one makes the eviction order observable
+    base::utils::ShardedLRUCache<std::string, int> cache(1, 1);
+
+    cache.insert("one", 1);
+    cache.insert("two", 2);
+
+    EXPECT_FALSE(cache.get("one").has_value());
+    auto two = cache.get("two");
+    ASSERT_TRUE(two.has_value());
+    EXPECT_EQ(two.value(), 2);
+}
+
+TEST(ShardedLRUCacheTest, Clear)
+{
+    base::utils::ShardedLRUCache<std::string, int> cache(32);
+
+    cache.insert("one", 1);
+    cache.insert("two", 2);
+    cache.clear();
+
+    EXPECT_FALSE(cache.get("one").has_value());
+    EXPECT_FALSE(cache.get("two").has_value());
+}
+
+TEST(ShardedLRUCacheTest, ConcurrentInsertAndGet)
+{
+    base::utils::ShardedLRUCache<std::string, int> cache(1024);
+    constexpr int THREADS = 4;
+    constexpr int KEYS = 256;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back(
+            [&cache]()
+            {
+                for (int i = 0; i < KEYS; ++i)
+                {
+                    auto key = std::to_string(i);
+                    cache.insert(key, i);
+                    auto value = cache.get(key);
+                    if (value.has_value())
+                    {
+                        EXPECT_EQ(value.value(), i);
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int i = 0; i < KEYS; ++i)
+    {
+        auto value = cache.get(std::to_string(i));
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(value.value(), i);
+    }
+}
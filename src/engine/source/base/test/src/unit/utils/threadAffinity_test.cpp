@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <base/utils/threadAffinity.hpp>
+
+using base::utils::affinity::parseCoreSet;
+using base::utils::affinity::pinCurrentThread;
+
+TEST(ParseCoreSet, Empty)
+{
+    EXPECT_TRUE(parseCoreSet("").empty());
+    EXPECT_TRUE(parseCoreSet("  ").empty());
+    EXPECT_TRUE(parseCoreSet(",").empty());
+}
+
+TEST(ParseCoreSet, SingleCores)
+{
+    EXPECT_EQ(parseCoreSet("0"), (std::vector<int> {0}));
+    EXPECT_EQ(parseCoreSet("3,1,2"), (std::vector<int> {1, 2, 3}));
+    EXPECT_EQ(parseCoreSet(" 4 , 7 "), (std::vector<int> {4, 7}));
+}
+
+TEST(ParseCoreSet, Ranges)
+{
+    EXPECT_EQ(parseCoreSet("0-3"), (std::vector<int> {0, 1, 2, 3}));
+    EXPECT_EQ(parseCoreSet("0-3,8,10"), (std::vector<int> {0, 1, 2, 3, 8, 10}));
+    EXPECT_EQ(parseCoreSet("5-5"), (std::vector<int> {5}));
+}
+
+TEST(ParseCoreSet, Duplicates)
+{
+    EXPECT_EQ(parseCoreSet("0-3,2,1-2"), (std::vector<int> {0, 1, 2, 3}));
+}
+
+TEST(ParseCoreSet, Invalid)
+{
+    EXPECT_THROW(parseCoreSet("a"), std::runtime_error);
+    EXPECT_THROW(parseCoreSet("1,b"), std::runtime_error);
+    EXPECT_THROW(parseCoreSet("-1"), std::runtime_error);
+    EXPECT_THROW(parseCoreSet("3-1"), std::runtime_error);
+    EXPECT_THROW(parseCoreSet("1-"), std::runtime_error);
+    EXPECT_THROW(parseCoreSet("1.5"), std::runtime_error);
+}
+
+TEST(PinCurrentThread, EmptyIsNoOp)
+{
+    EXPECT_TRUE(pinCurrentThread({}));
+}
+
+#ifdef __linux__
+TEST(PinCurrentThread, PinToOwnCore)
+{
+    // Pinning to the core the thread is already allowed on must succeed
+    EXPECT_TRUE(pinCurrentThread({static_cast<int>(sched_getcpu())}));
+}
+#endif
@@ -164,3 +164,37 @@ TEST(WazuhResponse, validateErrorInvalidDataNull)
     const base::utils::wazuhProtocol::WazuhResponse wresponse {jdata, error, message};
     EXPECT_FALSE(wresponse.isValid());
 }
+
+TEST(WazuhResponse, fromPreSerializedDataToString)
+{
+    const auto wresponse =
+        base::utils::wazuhProtocol::WazuhResponse::fromPreSerializedData(R"({"test":"data"})", 0);
+    EXPECT_EQ(wresponse.toString(), R"({"data":{"test":"data"},"error":0})");
+}
+
+TEST(WazuhResponse, fromPreSerializedDataLazyDataAccess)
+{
+    const auto wresponse =
+        base::utils::wazuhProtocol::WazuhResponse::fromPreSerializedData(R"({"test":"data"})", 7);
+    const json::Json expected {R"({"test":"data"})"};
+    EXPECT_EQ(wresponse.data(), expected);
+    EXPECT_EQ(wresponse.error(), 7);
+    EXPECT_TRUE(wresponse.isValid());
+}
+
+TEST(WazuhResponse, fromPreSerializedDataArray)
+{
+    const auto wresponse =
+        base::utils::wazuhProtocol::WazuhResponse::fromPreSerializedData(R"([{"test":"data"}])", 0);
+    EXPECT_EQ(wresponse.toString(), R"({"data":[{"test":"data"}],"error":0})");
+    EXPECT_TRUE(wresponse.isValid());
+}
+
+TEST(WazuhResponse, dataSetterOverridesPreSerializedData)
+{
+    auto wresponse = base::utils::wazuhProtocol::WazuhResponse::fromPreSerializedData(R"({"test":"data"})", 0);
+    const json::Json jdata {R"({"other":"data"})"};
+    wresponse.data(jdata);
+    EXPECT_EQ(wresponse.toString(), R"({"data":{"other":"data"},"error":0})");
+    EXPECT_EQ(wresponse.data(), jdata);
+}
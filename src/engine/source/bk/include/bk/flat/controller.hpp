@@ -0,0 +1,122 @@
+#ifndef _BK_FLAT_CONTROLLER_HPP
+#define _BK_FLAT_CONTROLLER_HPP
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <base/expression.hpp>
+#include <bk/icontroller.hpp>
+
+namespace bk::flat
+{
+
+namespace detail
+{
+class Program; ///< Compiled flat representation of the expression
+}
+
+/**
+ * @brief Controller that compiles the expression into a flat bytecode program and runs it
+ * with a small interpreter loop, avoiding the pointer-chasing of the Formula graph.
+ */
+class Controller final : public IController
+{
+private:
+    class TracerImpl; ///< Implementation of the trace
+
+    std::unordered_map<std::string, std::shared_ptr<TracerImpl>> m_traces; ///< Traces
+    std::unordered_set<std::string> m_traceables;                          ///< Traceables
+    base::Expression m_expression;                                         ///< Expression
+
+    std::shared_ptr<detail::Program> m_program; ///< Compiled program
+    std::function<void()> m_endCallback;        ///< Callback called after each ingested event
+
+    base::Event m_event; ///< Event being processed
+
+public:
+    Controller() = delete;
+    Controller(const Controller&) = delete;
+
+    ~Controller();
+
+    /**
+     * @brief Construct a new Controller from an expression and a set of traceables
+     *
+     * @param expression expression to build
+     * @param traceables traceables expressions
+     * @param endCallback callback to call when the expression is finished
+     */
+    Controller(const base::Expression& expression,
+               const std::unordered_set<std::string>& traceables,
+               const std::function<void()> endCallback = nullptr);
+
+    /**
+     * @copydoc bk::IController::ingest
+     */
+    void ingest(base::Event&& event) override;
+
+    /**
+     * @copydoc bk::IController::ingestGet
+     */
+    base::Event ingestGet(base::Event&& event) override;
+
+    /**
+     * @copydoc bk::IController::start
+     */
+    void start() override {};
+
+    /**
+     * @copydoc bk::IController::stop
+     */
+    void stop() override {};
+
+    /**
+     * @copydoc bk::IController::isAviable
+     */
+    inline bool isAviable() const override { return m_program != nullptr; }
+
+    /**
+     * @copydoc bk::IController::printGraph
+     */
+    std::string printGraph() const override;
+
+    /**
+     * @copydoc bk::IController::getTraceables
+     */
+    const std::unordered_set<std::string>& getTraceables() const override { return m_traceables; }
+
+    /**
+     * @copydoc bk::IController::getTraces
+     */
+    base::RespOrError<Subscription> subscribe(const std::string& traceable, const Subscriber& subscriber) override;
+
+    /**
+     * @copydoc bk::IController::unsubscribe
+     */
+    void unsubscribe(const std::string& traceable, Subscription subscription) override;
+
+    /**
+     * @copydoc bk::IController::unsubscribeAll
+     */
+    void unsubscribeAll() override;
+};
+
+class ControllerMaker : public IControllerMaker
+{
+public:
+    /**
+     * @copydoc bk::IControllerMaker::create
+     */
+    std::shared_ptr<IController> create(const base::Expression& expression,
+                                        const std::unordered_set<std::string>& traceables,
+                                        const std::function<void()>& endCallback) override
+    {
+        return std::make_shared<Controller>(expression, traceables, endCallback);
+    }
+};
+
+} // namespace bk::flat
+
+#endif // _BK_FLAT_CONTROLLER_HPP
@@ -4,6 +4,7 @@
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <rxcpp/rx.hpp>
 
@@ -38,6 +39,40 @@ private:
     rxcpp::subscriber<RxEvent> m_policyInput;
     rxcpp::observable<RxEvent> m_policyOutput;
 
+    /// Reusable event envelopes. The subject processes on_next synchronously on the calling
+    /// thread and a controller is driven by a single worker, so a plain free list with no
+    /// locking is enough to make the envelope allocation a one-time cost instead of per-event.
+    std::vector<RxEvent> m_envelopePool;
+
+    /**
+     * @brief Lease an envelope from the pool, allocating a new one if the pool is empty.
+     */
+    RxEvent leaseEnvelope()
+    {
+        if (!m_envelopePool.empty())
+        {
+            auto envelope = std::move(m_envelopePool.back());
+            m_envelopePool.pop_back();
+            return envelope;
+        }
+        return std::make_shared<base::result::Result<base::Event>>();
+    }
+
+    /**
+     * @brief Return an envelope to the pool once the chain has processed it.
+     *
+     * Only uniquely owned envelopes are pooled, an envelope retained by some stage is simply
+     * dropped. The payload is released before pooling so the event does not outlive its run.
+     */
+    void returnEnvelope(RxEvent&& envelope)
+    {
+        if (1 == envelope.use_count())
+        {
+            *envelope = base::result::Result<base::Event> {};
+            m_envelopePool.emplace_back(std::move(envelope));
+        }
+    }
+
 public:
     Controller() = delete;
     Controller(const Controller&) = delete;
@@ -62,9 +97,10 @@ public:
     {
         if (m_policyInput.is_subscribed())
         {
-            RxEvent rxEvent =
-                std::make_shared<base::result::Result<base::Event>>(base::result::makeSuccess(std::move(event)));
-            m_policyInput.on_next(rxEvent);
+            auto envelope = leaseEnvelope();
+            *envelope = base::result::makeSuccess(std::move(event));
+            m_policyInput.on_next(envelope);
+            returnEnvelope(std::move(envelope));
         }
     }
 
@@ -75,10 +111,12 @@ public:
     {
         if (m_policyInput.is_subscribed())
         {
-            RxEvent rxEvent =
-                std::make_shared<base::result::Result<base::Event>>(base::result::makeSuccess(std::move(event)));
-            m_policyInput.on_next(rxEvent);
-            return rxEvent->popPayload();
+            auto envelope = leaseEnvelope();
+            *envelope = base::result::makeSuccess(std::move(event));
+            m_policyInput.on_next(envelope);
+            auto processed = envelope->popPayload();
+            returnEnvelope(std::move(envelope));
+            return processed;
         }
 
         return event;
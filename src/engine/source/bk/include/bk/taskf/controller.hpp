@@ -39,10 +39,13 @@ public:
      * @param expression expression to build
      * @param traceables traceables expressions
      * @param endCallback callback to call when the expression is finished
+     * @param runToCompletion if true the whole expression runs inline as a single task,
+     * without per-node task handoff, keeping Taskflow scheduling at the per-event level
      */
     Controller(const base::Expression& expression,
                const std::unordered_set<std::string>& traceables,
-               const std::function<void()> endCallback = nullptr);
+               const std::function<void()> endCallback = nullptr,
+               bool runToCompletion = false);
 
     /**
      * @copydoc bk::IController::ingest
@@ -105,7 +108,21 @@ public:
 
 class ControllerMaker : public IControllerMaker
 {
+private:
+    bool m_runToCompletion; ///< Build controllers that run each event inline as a single task
+
 public:
+    /**
+     * @brief Construct a new Controller Maker object
+     *
+     * @param runToCompletion if true the created controllers run each event inline as a
+     * single task, without per-node task handoff
+     */
+    explicit ControllerMaker(bool runToCompletion = false)
+        : m_runToCompletion(runToCompletion)
+    {
+    }
+
     /**
      * @copydoc bk::IControllerMaker::create
      */
@@ -113,7 +130,7 @@ public:
                                         const std::unordered_set<std::string>& traceables,
                                         const std::function<void()>& endCallback) override
     {
-        return std::make_shared<Controller>(expression, traceables, endCallback);
+        return std::make_shared<Controller>(expression, traceables, endCallback, m_runToCompletion);
     }
 };
 
@@ -0,0 +1,266 @@
+#ifndef _BK_PROFILER_HPP
+#define _BK_PROFILER_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+#include <base/json.hpp>
+
+namespace bk::profiler
+{
+
+/**
+ * @brief Reads the CPU cycle counter.
+ *
+ * Uses the TSC on x86, falling back to the steady clock in nanoseconds on
+ * other architectures. Values are only compared against each other, so the
+ * unit does not need to be uniform across platforms.
+ *
+ * @return Current counter value.
+ */
+inline uint64_t cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+#endif
+}
+
+/**
+ * @brief Per-asset invocation and cycle accumulator.
+ *
+ * Each thread writes to its own cache-line-padded slot, so the record path is
+ * a pair of relaxed atomic additions with no shared-line contention. Totals
+ * are aggregated across slots when the report is built.
+ */
+class AssetCounters final
+{
+public:
+    /**
+     * @brief Accounts one term invocation.
+     *
+     * @param elapsedCycles Cycles spent in the invocation.
+     */
+    void add(uint64_t elapsedCycles)
+    {
+        auto& slot = m_slots[slotIndex()];
+        slot.invocations.fetch_add(1, std::memory_order_relaxed);
+        slot.cycles.fetch_add(elapsedCycles, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Aggregates the invocation count across all slots.
+     *
+     * @return Total invocations.
+     */
+    uint64_t invocations() const
+    {
+        uint64_t total = 0;
+        for (const auto& slot : m_slots)
+        {
+            total += slot.invocations.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Aggregates the cycle count across all slots.
+     *
+     * @return Total cycles.
+     */
+    uint64_t cycleCount() const
+    {
+        uint64_t total = 0;
+        for (const auto& slot : m_slots)
+        {
+            total += slot.cycles.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Zeroes every slot.
+     */
+    void reset()
+    {
+        for (auto& slot : m_slots)
+        {
+            slot.invocations.store(0, std::memory_order_relaxed);
+            slot.cycles.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    /**
+     * @brief Number of per-thread slots, folded by modulo for larger thread counts.
+     */
+    static constexpr std::size_t SLOTS = 64;
+
+    /**
+     * @brief Per-thread accumulator, padded to its own cache line.
+     */
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> invocations {0}; ///< Invocations recorded by this slot.
+        std::atomic<uint64_t> cycles {0};      ///< Cycles recorded by this slot.
+    };
+
+    /**
+     * @brief Gets the slot index for the calling thread.
+     *
+     * @return Slot index, stable for the lifetime of the thread.
+     */
+    static std::size_t slotIndex()
+    {
+        static std::atomic<std::size_t> nextIndex {0};
+        thread_local const std::size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed) % SLOTS;
+        return index;
+    }
+
+    std::array<Slot, SLOTS> m_slots {}; ///< Per-thread accumulators.
+};
+
+namespace detail
+{
+
+/**
+ * @brief Process-wide profiler state: enablement flag and asset counter registry.
+ */
+struct Registry
+{
+    std::atomic<bool> enabled {false};                                     ///< Whether timing is recorded.
+    std::mutex mutex;                                                      ///< Guards the counters map.
+    std::unordered_map<std::string, std::shared_ptr<AssetCounters>> counters; ///< Counters indexed by asset name.
+};
+
+/**
+ * @brief Gets the process-wide registry.
+ *
+ * @return Reference to the registry.
+ */
+inline Registry& registry()
+{
+    static Registry instance {};
+    return instance;
+}
+
+} // namespace detail
+
+/**
+ * @brief Enables or disables per-asset CPU attribution.
+ *
+ * @param state true to record timings, false to disable.
+ */
+inline void enable(bool state)
+{
+    detail::registry().enabled.store(state, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Checks whether profiling is enabled. A single relaxed load, cheap
+ * enough for the per-event path.
+ *
+ * @return true if timings are being recorded.
+ */
+inline bool enabled()
+{
+    return detail::registry().enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Gets or creates the counters for an asset. Called at build time only,
+ * never on the event path.
+ *
+ * @param name Asset name.
+ * @return Shared pointer to the asset counters.
+ */
+inline std::shared_ptr<AssetCounters> forAsset(const std::string& name)
+{
+    auto& registry = detail::registry();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    auto it = registry.counters.find(name);
+    if (it == registry.counters.end())
+    {
+        it = registry.counters.emplace(name, std::make_shared<AssetCounters>()).first;
+    }
+    return it->second;
+}
+
+/**
+ * @brief Zeroes every registered asset counter.
+ */
+inline void reset()
+{
+    auto& registry = detail::registry();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& [name, counters] : registry.counters)
+    {
+        counters->reset();
+    }
+}
+
+/**
+ * @brief Builds the per-asset CPU report, ranked by total cycles descending.
+ *
+ * @return Json with an "/assets" array of {asset, invocations, cycles, avg_cycles}.
+ */
+inline json::Json report()
+{
+    std::vector<std::pair<std::string, std::shared_ptr<AssetCounters>>> entries;
+    {
+        auto& registry = detail::registry();
+        const std::lock_guard<std::mutex> lock(registry.mutex);
+        entries.assign(registry.counters.begin(), registry.counters.end());
+    }
+
+    struct Row
+    {
+        const std::string* name;
+        uint64_t invocations;
+        uint64_t cycles;
+    };
+
+    std::vector<Row> rows;
+    rows.reserve(entries.size());
+    for (const auto& [name, counters] : entries)
+    {
+        rows.push_back({&name, counters->invocations(), counters->cycleCount()});
+    }
+    std::sort(rows.begin(), rows.end(), [](const Row& lhs, const Row& rhs) { return lhs.cycles > rhs.cycles; });
+
+    json::Json jAssets;
+    for (const auto& row : rows)
+    {
+        json::Json jAsset;
+        jAsset.setString(*row.name, "/asset");
+        jAsset.setInt64(static_cast<int64_t>(row.invocations), "/invocations");
+        jAsset.setInt64(static_cast<int64_t>(row.cycles), "/cycles");
+        jAsset.setInt64(static_cast<int64_t>(row.invocations > 0 ? row.cycles / row.invocations : 0), "/avg_cycles");
+        jAssets.appendJson(jAsset);
+    }
+
+    json::Json jReport;
+    jReport.set("/assets", jAssets);
+    return jReport;
+}
+
+} // namespace bk::profiler
+
+#endif // _BK_PROFILER_HPP
@@ -0,0 +1,83 @@
+#include "controller.hpp"
+
+#include "programBuilder.hpp"
+#include "tracer.hpp"
+
+namespace bk::flat
+{
+
+class Controller::TracerImpl final : public detail::Tracer
+{
+};
+
+Controller::Controller(const base::Expression& expression,
+                       const std::unordered_set<std::string>& traceables,
+                       const std::function<void()> endCallback)
+    : m_event()
+    , m_traceables(traceables)
+    , m_expression(expression)
+    , m_endCallback(endCallback)
+{
+    detail::ProgramBuilder builder;
+    std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
+    m_program = std::make_shared<detail::Program>(builder.build(m_expression, traces, m_traceables));
+    for (auto& [name, trace] : traces)
+    {
+        m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
+    }
+}
+
+Controller::~Controller() = default;
+
+void Controller::ingest(base::Event&& event)
+{
+    m_event = std::move(event);
+    m_program->run(m_event);
+    if (m_endCallback)
+    {
+        m_endCallback();
+    }
+}
+
+base::Event Controller::ingestGet(base::Event&& event)
+{
+    ingest(std::move(event));
+    return std::move(m_event);
+}
+
+std::string Controller::printGraph() const
+{
+    return m_program->listing();
+}
+
+base::RespOrError<Subscription> Controller::subscribe(const std::string& traceable, const Subscriber& subscriber)
+{
+    auto it = m_traces.find(traceable);
+    if (it == m_traces.end())
+    {
+        return base::Error {"Traceable not found"};
+    }
+
+    return it->second->subscribe(subscriber);
+}
+
+void Controller::unsubscribe(const std::string& traceable, Subscription subscription)
+{
+    auto it = m_traces.find(traceable);
+    if (it == m_traces.end())
+    {
+        return;
+    }
+
+    it->second->unsubscribe(subscription);
+}
+
+void Controller::unsubscribeAll()
+{
+    for (auto& [name, trace] : m_traces)
+    {
+        trace->unsubscribeAll();
+    }
+}
+
+} // namespace bk::flat
@@ -0,0 +1,268 @@
+#ifndef _BK_FLAT_PROGRAMBUILDER_HPP
+#define _BK_FLAT_PROGRAMBUILDER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <base/baseTypes.hpp>
+#include <base/expression.hpp>
+
+#include "tracer.hpp"
+
+namespace bk::flat::detail
+{
+
+constexpr uint32_t HALT_SUCCESS = std::numeric_limits<uint32_t>::max();     ///< Terminal pc, expression succeeded
+constexpr uint32_t HALT_FAILURE = std::numeric_limits<uint32_t>::max() - 1; ///< Terminal pc, expression failed
+
+/**
+ * @brief A single operation of the flattened expression.
+ *
+ * Control operations (And/Or/Chain/Implication/Broadcast) do not exist at runtime, they are
+ * compiled away into the success/failure continuations of the terms.
+ */
+struct Instruction
+{
+    base::EngineOp op;    ///< The term function to compute, wrapped with its trace publisher when traced
+    uint32_t onSuccess;   ///< Next pc when the term succeeds
+    uint32_t onFailure;   ///< Next pc when the term fails
+    std::string name;     ///< Name of the term, for the program listing
+};
+
+/**
+ * @brief A compiled expression: a contiguous array of instructions run by a small
+ * interpreter loop, replacing the shared_ptr graph traversal of the Formula tree.
+ */
+class Program
+{
+private:
+    friend class ProgramBuilder;
+
+    std::vector<Instruction> m_code; ///< The flattened instructions
+    uint32_t m_entry;                ///< Entry pc of the program
+
+public:
+    Program()
+        : m_entry(HALT_SUCCESS)
+    {
+    }
+
+    /**
+     * @brief Run the program over an event.
+     *
+     * @param event The event to process, modified in place by the terms.
+     * @return true if the expression succeeded, false otherwise.
+     */
+    bool run(base::Event& event) const
+    {
+        const auto size = static_cast<uint32_t>(m_code.size());
+        auto pc = m_entry;
+        while (pc < size)
+        {
+            const auto& ins = m_code[pc];
+            pc = ins.op(event).success() ? ins.onSuccess : ins.onFailure;
+        }
+
+        return pc == HALT_SUCCESS;
+    }
+
+    /**
+     * @brief Get a human readable listing of the program.
+     *
+     * @return std::string The program listing, one instruction per line.
+     */
+    std::string listing() const
+    {
+        auto pcToStr = [](uint32_t pc) -> std::string
+        {
+            if (pc == HALT_SUCCESS)
+            {
+                return "HALT_SUCCESS";
+            }
+            if (pc == HALT_FAILURE)
+            {
+                return "HALT_FAILURE";
+            }
+            return std::to_string(pc);
+        };
+
+        std::stringstream ss;
+        ss << "entry: " << pcToStr(m_entry) << "\n";
+        for (uint32_t pc = 0; pc < m_code.size(); ++pc)
+        {
+            ss << pc << ": " << m_code[pc].name << " -> success: " << pcToStr(m_code[pc].onSuccess)
+               << ", failure: " << pcToStr(m_code[pc].onFailure) << "\n";
+        }
+        return ss.str();
+    }
+};
+
+/**
+ * @brief Compiles a built base::Expression into a Program.
+ *
+ * The Formula API is kept as the building and testing representation, the compilation is a
+ * pure lowering pass: each control operation is folded into the continuation targets of its
+ * operands, so at runtime only terms are computed.
+ */
+class ProgramBuilder
+{
+private:
+    struct BuildParams
+    {
+        Publisher publisher; ///< Publisher inherited from the closest enclosing traceable
+        std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
+        const std::unordered_set<std::string>& traceables;
+    };
+
+    std::vector<Instruction> m_code; ///< Instructions emitted so far
+
+    /**
+     * @brief Compile an expression given its success and failure continuations.
+     *
+     * @param expression The expression to compile.
+     * @param onSuccess The pc to jump to when the expression succeeds.
+     * @param onFailure The pc to jump to when the expression fails.
+     * @param params Build parameters, copied so a subtree publisher does not leak to siblings.
+     * @return uint32_t The entry pc of the compiled expression.
+     */
+    uint32_t compile(const base::Expression& expression, uint32_t onSuccess, uint32_t onFailure, BuildParams params)
+    {
+        // Error if empty expression
+        if (expression == nullptr)
+        {
+            throw std::runtime_error {"Expression is null"};
+        }
+
+        // Create traceable if found and get the publisher function
+        auto traceIt = params.traceables.find(expression->getName());
+        if (traceIt != params.traceables.end())
+        {
+            if (params.traces.find(expression->getName()) == params.traces.end())
+            {
+                params.traces.emplace(expression->getName(), std::make_shared<Tracer>());
+            }
+
+            params.publisher = params.traces[expression->getName()]->publisher();
+        }
+
+        if (expression->isTerm())
+        {
+            auto term = expression->getPtr<base::Term<base::EngineOp>>();
+            auto op = term->getFn();
+            // Traced terms publish from inside the wrapped op, selected here at build time, so
+            // the interpreter loop carries no trace branch for traceless programs
+            if (params.publisher)
+            {
+                op = [fn = std::move(op), publisher = params.publisher](base::Event& event)
+                {
+                    auto res = fn(event);
+                    publisher(res.trace(), res.success());
+                    return res;
+                };
+            }
+            m_code.emplace_back(Instruction {std::move(op), onSuccess, onFailure, term->getName()});
+            return static_cast<uint32_t>(m_code.size() - 1);
+        }
+
+        if (!expression->isOperation())
+        {
+            throw std::runtime_error("Unsupported expression type");
+        }
+
+        const auto& operands = expression->getPtr<base::Operation>()->getOperands();
+
+        if (expression->isImplication())
+        {
+            // true(left) -> right --> true, regardless of the right result
+            // false(left) --> false
+            auto thenEntry = compile(operands[1], onSuccess, onSuccess, params);
+            return compile(operands[0], thenEntry, onFailure, params);
+        }
+
+        if (expression->isAnd())
+        {
+            // Each operand falls through to the next on success, any failure short-circuits
+            auto next = onSuccess;
+            for (auto it = operands.rbegin(); it != operands.rend(); ++it)
+            {
+                next = compile(*it, next, onFailure, params);
+            }
+            return next;
+        }
+
+        if (expression->isOr())
+        {
+            // Each operand falls through to the next on failure, any success short-circuits
+            auto next = onFailure;
+            for (auto it = operands.rbegin(); it != operands.rend(); ++it)
+            {
+                next = compile(*it, onSuccess, next, params);
+            }
+            return next;
+        }
+
+        if (expression->isChain() || expression->isBroadcast())
+        {
+            // Every operand is computed regardless of its result and the operation always
+            // succeeds. Broadcast steps are order independent, so running them sequentially
+            // is a valid serialization.
+            auto next = onSuccess;
+            for (auto it = operands.rbegin(); it != operands.rend(); ++it)
+            {
+                next = compile(*it, next, next, params);
+            }
+            return next;
+        }
+
+        throw std::runtime_error("Unsupported operation type");
+    }
+
+public:
+    virtual ~ProgramBuilder() = default;
+    ProgramBuilder() = default;
+
+    /**
+     * @brief Build a Program from an expression and a set of traceables.
+     *
+     * @param expression The expression to compile.
+     * @param traces Output map of traceable name to tracer, filled during the compilation.
+     * @param traceables The traceable expression names.
+     * @return Program The compiled program.
+     */
+    Program build(const base::Expression& expression,
+                  std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
+                  const std::unordered_set<std::string>& traceables)
+    {
+        m_code.clear();
+        BuildParams params {nullptr, traces, traceables};
+        auto entry = compile(expression, HALT_SUCCESS, HALT_FAILURE, params);
+
+        // Continuations are emitted before the terms that jump to them, reverse the array so
+        // execution mostly walks it forward
+        std::reverse(m_code.begin(), m_code.end());
+        auto remap = [size = static_cast<uint32_t>(m_code.size())](uint32_t pc) -> uint32_t
+        {
+            return pc < size ? size - 1 - pc : pc;
+        };
+        for (auto& ins : m_code)
+        {
+            ins.onSuccess = remap(ins.onSuccess);
+            ins.onFailure = remap(ins.onFailure);
+        }
+
+        Program program;
+        program.m_code = std::move(m_code);
+        program.m_entry = remap(entry);
+        return program;
+    }
+};
+
+} // namespace bk::flat::detail
+
+#endif // _BK_FLAT_PROGRAMBUILDER_HPP
@@ -7,6 +7,8 @@
 #include <base/baseTypes.hpp>
 #include <base/expression.hpp>
 
+#include <bk/profiler.hpp>
+
 #include "tracer.hpp"
 
 namespace bk::rx::detail
@@ -20,9 +22,10 @@ private:
 
     struct BuildParams
     {
-        Publisher publisher;
+        std::shared_ptr<Tracer> tracer;
         std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
         const std::unordered_set<std::string>& traceables;
+        std::shared_ptr<profiler::AssetCounters> counters;
     };
 
     Observable recBuild(const Observable& input, const base::Expression& expression, BuildParams& params)
@@ -42,7 +45,8 @@ private:
                 params.traces.emplace(expression->getName(), std::make_shared<Tracer>());
             }
 
-            params.publisher = params.traces[expression->getName()]->publisher();
+            params.tracer = params.traces[expression->getName()];
+            params.counters = profiler::forAsset(expression->getName());
         }
 
         // Handle pipelines
@@ -102,7 +106,7 @@ private:
                 auto condition = std::make_shared<bool>(false);
                 step1 = recBuild(step1, op->getOperands()[0], params)
                             .filter(
-                                [condition, tracer = params.publisher](RxEvent result)
+                                [condition](RxEvent result)
                                 {
                                     *condition = result->success();
                                     return result->success();
@@ -123,14 +127,42 @@ private:
         else if (expression->isTerm())
         {
             auto term = expression->getPtr<base::Term<base::EngineOp>>();
+            // The map callable is selected at build time, untraced terms carry no tracer at all
+            if (params.tracer == nullptr)
+            {
+                return input.map(
+                    [op = term->getFn(), counters = params.counters](RxEvent result)
+                    {
+                        if (counters && profiler::enabled())
+                        {
+                            const auto start = profiler::cycles();
+                            *result = op(result->payload());
+                            counters->add(profiler::cycles() - start);
+                        }
+                        else
+                        {
+                            *result = op(result->payload());
+                        }
+                        return result;
+                    });
+            }
             return input.map(
-                [op = term->getFn(), tracer = params.publisher](RxEvent result)
+                [op = term->getFn(), tracer = params.tracer, counters = params.counters](RxEvent result)
                 {
-                    *result = op(result->payload());
-                    // TODO: should we allow to not include tracer?
-                    if (tracer != nullptr)
+                    if (counters && profiler::enabled())
+                    {
+                        const auto start = profiler::cycles();
+                        *result = op(result->payload());
+                        counters->add(profiler::cycles() - start);
+                    }
+                    else
+                    {
+                        *result = op(result->payload());
+                    }
+                    // The trace message is only materialized when somebody listens
+                    if (tracer->hasSubscribers())
                     {
-                        tracer(std::string {result->trace()}, result->success());
+                        tracer->publish(result->trace(), result->success());
                     }
                     return result;
                 });
@@ -150,7 +182,7 @@ public:
                      const std::unordered_set<std::string>& traceables,
                      const Observable& input)
     {
-        BuildParams params {.publisher = nullptr, .traces = traces, .traceables = traceables};
+        BuildParams params {.tracer = nullptr, .traces = traces, .traceables = traceables, .counters = nullptr};
         auto output = recBuild(input, expression, params);
 
         return output;
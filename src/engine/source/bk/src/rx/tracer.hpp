@@ -1,6 +1,7 @@
 #ifndef _BK_RX_TRACER_HPP
 #define _BK_RX_TRACER_HPP
 
+#include <atomic>
 #include <memory>
 #include <shared_mutex>
 #include <string>
@@ -11,9 +12,8 @@
 
 namespace bk::rx::detail
 {
-using Publisher = Subscriber;
 
-class Tracer : public std::enable_shared_from_this<Tracer>
+class Tracer
 {
 private:
     std::string m_name;                                         ///< Name of the trace
@@ -24,6 +24,10 @@ private:
 
     std::shared_mutex m_subscribersMutex; ///< Mutex for the subscribers
 
+    /// Subscriber count mirror, readable without the mutex so the hot path can skip the trace
+    /// entirely when nobody listens
+    std::atomic<std::size_t> m_subscriberCount {0};
+
 public:
     virtual ~Tracer() = default;
 
@@ -50,6 +54,7 @@ public:
         }
 
         m_subscribers.emplace(id, subscriber);
+        m_subscriberCount.store(m_subscribers.size(), std::memory_order_relaxed);
         return id;
     }
 
@@ -62,22 +67,30 @@ public:
     {
         std::unique_lock lock {m_subscribersMutex};
         m_subscribers.erase(subscription);
+        m_subscriberCount.store(m_subscribers.size(), std::memory_order_relaxed);
     }
 
     /**
-     * @copydoc bk::ITrace::publisher
+     * @brief Whether the trace has any subscriber, without taking the mutex.
+     *
+     * The hot path checks this before materializing the trace message, so untraced runs pay
+     * one relaxed load per asset instead of a string allocation and a publish.
      */
-    Publisher publisher()
+    inline bool hasSubscribers() const { return m_subscriberCount.load(std::memory_order_relaxed) > 0; }
+
+    /**
+     * @brief Publish a trace message to every subscriber.
+     *
+     * @param message The trace message.
+     * @param success Status of the event.
+     */
+    void publish(const std::string& message, bool success)
     {
-        return [thisPtr = this->weak_from_this()](const std::string& message, bool success)
+        std::shared_lock lock {m_subscribersMutex};
+        for (const auto& [_, subscriber] : m_subscribers)
         {
-            auto thisShared = thisPtr.lock();
-            std::shared_lock lock {thisShared->m_subscribersMutex};
-            for (const auto& [_, subscriber] : thisShared->m_subscribers)
-            {
-                subscriber(message, success);
-            }
-        };
+            subscriber(message, success);
+        }
     }
 
     /**
@@ -88,6 +101,7 @@ public:
     {
         std::unique_lock lock {m_subscribersMutex};
         m_subscribers.clear();
+        m_subscriberCount.store(0, std::memory_order_relaxed);
     }
 };
 
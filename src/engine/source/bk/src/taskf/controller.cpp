@@ -11,16 +11,36 @@ class Controller::TracerImpl final : public detail::Tracer
 
 Controller::Controller(const base::Expression& expression,
                        const std::unordered_set<std::string>& traceables,
-                       const std::function<void()> endCallback)
+                       const std::function<void()> endCallback,
+                       bool runToCompletion)
     : m_tf()
     , m_executor(1)
     , m_event()
     , m_traceables(traceables)
     , m_expression(expression)
 {
-    detail::ExprBuilder builder;
     std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
-    builder.build(m_expression, m_tf, &m_event, traces, m_traceables, endCallback);
+    if (runToCompletion)
+    {
+        // A single task per event: the whole tree walk runs inline on the worker thread
+        detail::InlineBuilder builder;
+        m_tf.emplace(
+                [evaluate = builder.build(m_expression, traces, m_traceables), event = &m_event, endCallback]()
+                {
+                    evaluate(*event);
+                    if (endCallback)
+                    {
+                        endCallback();
+                    }
+                })
+            .name("run_to_completion");
+    }
+    else
+    {
+        detail::ExprBuilder builder;
+        builder.build(m_expression, m_tf, &m_event, traces, m_traceables, endCallback);
+    }
+
     for (auto& [name, trace] : traces)
     {
         m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
@@ -69,18 +69,29 @@ public:
     void on(tf::Task& success, tf::Task& failure) override
     {
         assertConnect();
-        m_task.work(
-            [fn = m_op, publisher = m_publisher, data = m_data]()
-            {
-                auto& event = *static_cast<base::Event*>(data);
-                auto res = fn(event);
-                if (publisher)
+        // The trace callable is selected when the task is built, so untraced terms run a work
+        // function with no publisher check per event
+        if (m_publisher)
+        {
+            m_task.work(
+                [fn = m_op, publisher = m_publisher, data = m_data]()
                 {
+                    auto& event = *static_cast<base::Event*>(data);
+                    auto res = fn(event);
                     publisher(res.trace(), res.success());
-                }
 
-                return res.success() ? 0 : 1;
-            });
+                    return res.success() ? 0 : 1;
+                });
+        }
+        else
+        {
+            m_task.work(
+                [fn = m_op, data = m_data]()
+                {
+                    auto& event = *static_cast<base::Event*>(data);
+                    return fn(event).success() ? 0 : 1;
+                });
+        }
 
         m_task.precede(success, failure);
     }
@@ -430,6 +441,158 @@ public:
     }
 };
 
+/**
+ * @brief Compiles an expression into a single callable that walks the tree run to
+ * completion on the calling thread.
+ *
+ * Scheduling every Formula node as a Taskflow task pays scheduler overhead per node,
+ * which dominates the short tree walk of a single event. The compiled callable keeps
+ * the task graph semantics (operand order, short-circuits and trace publishing) but
+ * performs no task handoff, so Taskflow scheduling stays at the per-event level.
+ */
+class InlineBuilder
+{
+public:
+    using StepFn = std::function<bool(base::Event&)>;
+
+private:
+    struct BuildParams
+    {
+        Publisher publisher; ///< Publisher inherited from the closest enclosing traceable
+        std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
+        const std::unordered_set<std::string>& traceables;
+    };
+
+    // Params are copied so a subtree publisher does not leak to siblings
+    StepFn recBuild(const base::Expression& expression, BuildParams params)
+    {
+        // Error if empty expression
+        if (expression == nullptr)
+        {
+            throw std::runtime_error {"Expression is null"};
+        }
+
+        // Create traceable if found and get the publisher function
+        auto traceIt = params.traceables.find(expression->getName());
+        if (traceIt != params.traceables.end())
+        {
+            if (params.traces.find(expression->getName()) == params.traces.end())
+            {
+                params.traces.emplace(expression->getName(), std::make_shared<Tracer>());
+            }
+
+            params.publisher = params.traces[expression->getName()]->publisher();
+        }
+
+        if (expression->isTerm())
+        {
+            auto term = expression->getPtr<base::Term<base::EngineOp>>();
+            // Pick the step callable at build time so untraced terms carry no publisher check
+            if (params.publisher)
+            {
+                return [fn = term->getFn(), publisher = params.publisher](base::Event& event)
+                {
+                    auto res = fn(event);
+                    publisher(res.trace(), res.success());
+                    return res.success();
+                };
+            }
+            return [fn = term->getFn()](base::Event& event) { return fn(event).success(); };
+        }
+
+        if (!expression->isOperation())
+        {
+            throw std::runtime_error("Unsupported expression type");
+        }
+
+        std::vector<StepFn> steps;
+        for (auto& exprOperand : expression->getPtr<base::Operation>()->getOperands())
+        {
+            steps.emplace_back(recBuild(exprOperand, params));
+        }
+
+        if (expression->isImplication())
+        {
+            // true(left) -> right --> true, regardless of the right result
+            // false(left) --> false
+            return [condition = steps[0], then = steps[1]](base::Event& event)
+            {
+                if (!condition(event))
+                {
+                    return false;
+                }
+                then(event);
+                return true;
+            };
+        }
+
+        if (expression->isAnd())
+        {
+            return [steps = std::move(steps)](base::Event& event)
+            {
+                for (const auto& step : steps)
+                {
+                    if (!step(event))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            };
+        }
+
+        if (expression->isOr())
+        {
+            return [steps = std::move(steps)](base::Event& event)
+            {
+                for (const auto& step : steps)
+                {
+                    if (step(event))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            };
+        }
+
+        if (expression->isChain() || expression->isBroadcast())
+        {
+            // Every operand is computed regardless of its result and the operation always
+            // succeeds
+            return [steps = std::move(steps)](base::Event& event)
+            {
+                for (const auto& step : steps)
+                {
+                    step(event);
+                }
+                return true;
+            };
+        }
+
+        throw std::runtime_error("Unsupported operation type");
+    }
+
+public:
+    virtual ~InlineBuilder() = default;
+    InlineBuilder() = default;
+
+    /**
+     * @brief Build the run-to-completion callable of an expression.
+     *
+     * @param expression The expression to compile.
+     * @param traces Output map of traceable name to tracer, filled during the compilation.
+     * @param traceables The traceable expression names.
+     * @return StepFn Callable computing the expression over an event.
+     */
+    StepFn build(const base::Expression& expression,
+                 std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
+                 const std::unordered_set<std::string>& traceables)
+    {
+        return recBuild(expression, BuildParams {.publisher = nullptr, .traces = traces, .traceables = traceables});
+    }
+};
+
 } // namespace bk::taskf::detail
 
 #endif // _BK_TASKF_EXPRBUILDER_HPP
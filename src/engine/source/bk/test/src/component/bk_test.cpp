@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <bk/mockController.hpp> // Force mock compilation
+#include <bk/flat/controller.hpp>
+#include <bk/profiler.hpp>
 #include <bk/rx/controller.hpp>
 #include <bk/taskf/controller.hpp>
 
@@ -85,6 +87,33 @@ TEST_P(PipelineTest, RxProcessTraces)
     GTEST_SKIP(); // TODO
 }
 
+TEST_P(PipelineTest, FlatProcessEvent)
+{
+    auto [name, expression, expectedPath] = GetParam();
+    auto testExpression = getTestExpression(expression);
+    buildIngestTest<bk::flat::Controller>(testExpression, expectedPath);
+}
+
+TEST_P(PipelineTest, FlatProcessTraces)
+{
+    GTEST_SKIP(); // TODO
+}
+
+TEST_P(PipelineTest, TfRunToCompletionProcessEvent)
+{
+    auto [name, expression, expectedPath] = GetParam();
+    auto testExpression = getTestExpression(expression);
+
+    auto counter = 0;
+    auto controller = bk::taskf::Controller(testExpression, {}, [&]() { ++counter; }, true);
+    auto event = std::make_shared<json::Json>();
+    ASSERT_NO_THROW(event = controller.ingestGet(std::move(event)));
+
+    ASSERT_EQ(counter, 1) << "Only one event was sent but the end callback received more than one event";
+
+    expectedPath.check(event);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     BK,
     PipelineTest,
@@ -938,3 +967,42 @@ TEST(BKTraceTest, UnsubscribeNotExists)
     unsubscribeNotExistsTest<bk::taskf::Controller>();
     unsubscribeNotExistsTest<bk::rx::Controller>();
 }
+
+TEST(BKProfilerTest, DisabledByDefault)
+{
+    ASSERT_FALSE(bk::profiler::enabled());
+}
+
+TEST(BKProfilerTest, RxAttributesCyclesPerAsset)
+{
+    bk::profiler::reset();
+    bk::profiler::enable(true);
+
+    bk::rx::Controller c(EasyExp::term("profiledTerm", true), {"profiledTerm"});
+    auto event = std::make_shared<json::Json>();
+    ASSERT_NO_THROW(c.ingestGet(std::move(event)));
+
+    bk::profiler::enable(false);
+
+    auto counters = bk::profiler::forAsset("profiledTerm");
+    EXPECT_EQ(counters->invocations(), 1);
+    EXPECT_GT(counters->cycleCount(), 0);
+
+    // The report ranks the profiled asset with its accumulated totals
+    auto report = bk::profiler::report();
+    auto assets = report.getArray("/assets");
+    ASSERT_TRUE(assets.has_value());
+
+    bool found = false;
+    for (const auto& jAsset : assets.value())
+    {
+        if (jAsset.getString("/asset").value_or("") == "profiledTerm")
+        {
+            found = true;
+            EXPECT_EQ(jAsset.getInt64("/invocations").value_or(0), 1);
+            EXPECT_GT(jAsset.getInt64("/cycles").value_or(0), 0);
+            EXPECT_EQ(jAsset.getInt64("/avg_cycles").value_or(0), jAsset.getInt64("/cycles").value_or(0));
+        }
+    }
+    EXPECT_TRUE(found);
+}
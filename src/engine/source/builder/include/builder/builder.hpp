@@ -56,6 +56,7 @@ public:
             const BuilderDeps& builderDeps);
 
     std::shared_ptr<IPolicy> buildPolicy(const base::Name& name) const override;
+    std::string getPolicyHash(const base::Name& name) const override;
     base::Expression buildAsset(const base::Name& name) const override;
 
     base::OptError validateIntegration(const json::Json& json, const std::string& namespaceId) const override;
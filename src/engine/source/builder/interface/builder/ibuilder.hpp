@@ -28,6 +28,17 @@ public:
      */
     virtual std::shared_ptr<IPolicy> buildPolicy(const base::Name& name) const = 0;
 
+    /**
+     * @brief Get the content hash of a policy without building it.
+     *
+     * The hash is read from the stored policy document, so it is cheap compared to a build and
+     * can be used to decide whether an already built policy is still current.
+     *
+     * @param name Name of the policy.
+     * @return std::string The content hash of the policy.
+     */
+    virtual std::string getPolicyHash(const base::Name& name) const = 0;
+
     /**
      * @brief Build an asset expression from the store.
      * @attention This method ignores the parents of the asset.
@@ -2,6 +2,8 @@
 
 #include <stdexcept>
 
+#include <fmt/format.h>
+
 #include <store/utils.hpp>
 
 #include "builders/ibuildCtx.hpp"
@@ -10,6 +12,7 @@
 #include "policy/policy.hpp"
 #include "register.hpp"
 #include "registry.hpp"
+#include "syntax.hpp"
 
 namespace builder
 {
@@ -46,6 +49,9 @@ Builder::Builder(const std::shared_ptr<store::IStore>& storeRead,
 
     detail::registerStageBuilders<Registry>(m_registry, builderDeps);
     detail::registerOpBuilders<Registry>(m_registry, builderDeps);
+
+    // All builders are registered at construction, freeze the dispatch tables
+    m_registry->freeze();
 }
 
 std::shared_ptr<IPolicy> Builder::buildPolicy(const base::Name& name) const
@@ -62,6 +68,24 @@ std::shared_ptr<IPolicy> Builder::buildPolicy(const base::Name& name) const
     return policy;
 }
 
+std::string Builder::getPolicyHash(const base::Name& name) const
+{
+    auto policyDoc = m_storeRead->readInternalDoc(name);
+    if (base::isError(policyDoc))
+    {
+        throw std::runtime_error(base::getError(policyDoc).message);
+    }
+
+    auto hash = base::getResponse<store::Doc>(policyDoc).getString(syntax::policy::PATH_HASH);
+    if (!hash)
+    {
+        throw std::runtime_error(
+            fmt::format("Could not find policy hash string attribute at '{}'", syntax::policy::PATH_HASH));
+    }
+
+    return hash.value();
+}
+
 base::Expression Builder::buildAsset(const base::Name& name) const
 {
     auto assetDoc = store::utils::get(m_storeRead, name);
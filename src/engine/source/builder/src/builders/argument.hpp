@@ -31,6 +31,7 @@ class Reference : public Argument
 private:
     std::string m_dotPath;
     std::string m_jsonPath;
+    json::Path m_compiledPath;
 
 public:
     Reference() = default;
@@ -39,6 +40,7 @@ public:
     {
         m_dotPath = dotPath;
         m_jsonPath = json::Json::formatJsonPath(dotPath);
+        m_compiledPath = json::Path(m_jsonPath);
     }
 
     explicit Reference(const std::string& dotPath) { set(dotPath); }
@@ -46,6 +48,11 @@ public:
     const std::string& dotPath() const { return m_dotPath; }
     const std::string& jsonPath() const { return m_jsonPath; }
 
+    /**
+     * @brief The precompiled path, avoids re-tokenizing the pointer path on every event.
+     */
+    const json::Path& compiledPath() const { return m_compiledPath; }
+
     bool isReference() const override { return true; }
     std::string str() const override { return std::string {syntax::field::REF_ANCHOR} + m_dotPath; }
 };
@@ -147,7 +147,7 @@ TransformBuilder mapToTransform(const MapBuilder& builder, const Reference& targ
         auto mapOp = builder(opArgs, buildCtx);
 
         // Wrapper TransformOp
-        return [mapOp, targetField](base::Event event) -> TransformResult
+        return [mapOp, targetPath = targetField.compiledPath()](base::Event event) -> TransformResult
         {
             auto mapRes = mapOp(event);
             if (mapRes.failure())
@@ -155,7 +155,7 @@ TransformBuilder mapToTransform(const MapBuilder& builder, const Reference& targ
                 return base::result::makeFailure<base::Event>(event, mapRes.popTrace());
             }
 
-            event->set(targetField.jsonPath(), mapRes.popPayload());
+            event->set(targetPath, mapRes.popPayload());
 
             return base::result::makeSuccess(event, mapRes.popTrace());
         };
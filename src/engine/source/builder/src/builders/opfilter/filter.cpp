@@ -16,7 +16,7 @@ FilterOp filterValue(const Reference& targetField, const Value& value, const std
     auto valueMissmatch =
         fmt::format("{} -> Value missmatch for reference '{}'", buildCtx->context().opName, targetField.dotPath());
     const auto successTrace = fmt::format("{} -> Success", buildCtx->context().opName);
-    return [targetField = targetField.jsonPath(),
+    return [targetField = targetField.compiledPath(),
             targetNotFound,
             valueMissmatch,
             successTrace,
@@ -50,13 +50,13 @@ FilterOp filterReference(const Reference& targetField,
                                       reference.dotPath(),
                                       targetField.dotPath());
     const auto successTrace = fmt::format("{} -> Success", buildCtx->context().opName);
-    return [targetField = targetField.jsonPath(),
+    return [targetField = targetField.compiledPath(),
             successTrace,
             runState = buildCtx->runState(),
             referenceNotFound,
             targetNotFound,
             valueMissmatch,
-            referencePath = reference.jsonPath()](base::ConstEvent event) -> FilterResult
+            referencePath = reference.compiledPath()](base::ConstEvent event) -> FilterResult
     {
         if (!event->exists(targetField))
         {
@@ -6,6 +6,7 @@
 
 #include <re2/re2.h>
 
+#include "builders/regexCache.hpp"
 #include "syntax.hpp"
 #include <base/baseTypes.hpp>
 #include <base/utils/ipUtils.hpp>
@@ -622,11 +623,7 @@ FilterOp opBuilderHelperRegexMatch(const Reference& targetField,
 
     auto value = std::static_pointer_cast<Value>(opArgs[0])->value().getString().value();
 
-    auto regex_ptr {std::make_shared<RE2>(value, RE2::Quiet)};
-    if (!regex_ptr->ok())
-    {
-        throw std::runtime_error(fmt::format("Invalid regex: \"{}\".", value));
-    }
+    auto regex_ptr = utils::getCompiledRegex(value);
 
     // Tracing
     const auto name = buildCtx->context().opName;
@@ -672,13 +669,14 @@ FilterOp opBuilderHelperRegexNotMatch(const Reference& targetField,
     const auto name = buildCtx->context().opName;
     const auto value = std::static_pointer_cast<Value>(opArgs[0])->value().getString().value();
 
-    auto regex_ptr {std::make_shared<RE2>(value, RE2::Quiet)};
-    if (!regex_ptr->ok())
+    std::shared_ptr<const RE2> regex_ptr;
+    try
     {
-        throw std::runtime_error(fmt::format("\"{}\" function: "
-                                             "Invalid regex: \"{}\".",
-                                             name,
-                                             value));
+        regex_ptr = utils::getCompiledRegex(value);
+    }
+    catch (const std::runtime_error& e)
+    {
+        throw std::runtime_error(fmt::format("\"{}\" function: {}", name, e.what()));
     }
 
     // Tracing
@@ -1341,6 +1339,16 @@ FilterOp opBuilderHelperMatchKey(const Reference& targetField,
         }
     }
 
+    // When the schema knows the target field, reject non-string targets at build time
+    if (buildCtx->validator().hasField(targetField.dotPath())
+        && buildCtx->validator().getJsonType(targetField.dotPath()) != json::Json::Type::String)
+    {
+        throw std::runtime_error(
+            fmt::format("Expected a string reference but got reference '{}' of type '{}'",
+                        targetField.dotPath(),
+                        json::Json::typeToStr(buildCtx->validator().getJsonType(targetField.dotPath()))));
+    }
+
     const auto name = buildCtx->context().opName;
 
     // Tracing
@@ -1361,18 +1369,14 @@ FilterOp opBuilderHelperMatchKey(const Reference& targetField,
     return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath(), parameter = opArgs[0]](
                base::ConstEvent event) -> FilterResult
     {
-        // Get key
-        if (!event->exists(targetField))
+        // Get key, a single lookup replaces the exists/isString/getString walks
+        const auto key = event->getString(targetField);
+        if (!key.has_value())
         {
-            RETURN_FAILURE(runState, false, failureTrace1);
-        }
-
-        if (!event->isString(targetField))
-        {
-            RETURN_FAILURE(runState, false, failureTrace2);
+            RETURN_FAILURE(runState, false, event->exists(targetField) ? failureTrace2 : failureTrace1);
         }
 
-        auto pointerPath = json::Json::formatJsonPath(event->getString(targetField).value());
+        auto pointerPath = json::Json::formatJsonPath(key.value());
         bool exists {false};
 
         if (parameter->isReference())
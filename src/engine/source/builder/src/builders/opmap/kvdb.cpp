@@ -1,11 +1,14 @@
 #include "builders/opmap/kvdb.hpp"
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <variant>
 
 #include <fmt/format.h>
 
 #include <base/json.hpp>
+#include <base/lruCache.hpp>
 #include <base/utils/stringUtils.hpp>
 #include <kvdb/ikvdbhandler.hpp>
 
@@ -847,8 +850,218 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
     };
 }
 
+// <field>: kvdb_get_batch(<db>, <key_array>)
+TransformBuilder getOpBuilderKVDBGetBatch(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName)
+{
+    return [kvdbManager, kvdbScopeName](const Reference& targetField,
+                                        const std::vector<OpArg>& opArgs,
+                                        const std::shared_ptr<const IBuildCtx>& buildCtx) -> TransformOp
+    {
+        // Assert expected number of parameters
+        utils::assertSize(opArgs, 2);
+
+        // First argument is kvdb name
+        utils::assertValue(opArgs, 0);
+        if (!std::static_pointer_cast<Value>(opArgs[0])->value().isString())
+        {
+            throw std::runtime_error(fmt::format("Expected db name 'string' as first argument but got '{}'",
+                                                 std::static_pointer_cast<Value>(opArgs[0])->value().str()));
+        }
+        const auto dbName = std::static_pointer_cast<const Value>(opArgs[0])->value().getString().value();
+
+        // Second argument is key array
+        auto keyArray = opArgs[1];
+
+        if (keyArray->isValue())
+        {
+            if (!std::static_pointer_cast<Value>(keyArray)->value().isArray())
+            {
+                throw std::runtime_error(fmt::format("Expected key array 'array' as second argument but got '{}'",
+                                                     std::static_pointer_cast<Value>(keyArray)->value().str()));
+            }
+
+            auto asArray = std::static_pointer_cast<Value>(keyArray)->value().getArray().value();
+            for (auto& value : asArray)
+            {
+                if (!value.isString())
+                {
+                    throw std::runtime_error(fmt::format("Expected an array of strings but found '{}'",
+                                                         json::Json::typeToStr(value.type())));
+                }
+            }
+        }
+        else
+        {
+            const auto& ref = *std::static_pointer_cast<const Reference>(keyArray);
+            if (buildCtx->validator().hasField(ref.dotPath()))
+            {
+                if (!buildCtx->validator().isArray(ref.dotPath()))
+                {
+                    throw std::runtime_error(fmt::format("Reference field '{}' is not an array", ref.dotPath()));
+                }
+
+                auto jType = buildCtx->validator().getJsonType(ref.dotPath());
+                if (jType != json::Json::Type::String)
+                {
+                    throw std::runtime_error(
+                        fmt::format("Reference field '{}' is not an array of strings", ref.dotPath()));
+                }
+            }
+        }
+
+        // Get KVDB handler
+        auto resultHandler = kvdbManager->getKVDBHandler(dbName, kvdbScopeName);
+        if (std::holds_alternative<base::Error>(resultHandler))
+        {
+            throw std::runtime_error(
+                fmt::format("Engine KVDB builder: {}.", std::get<base::Error>(resultHandler).message));
+        }
+
+        // Validate the target field
+        schemf::ValueValidator validator = nullptr;
+        if (buildCtx->validator().hasField(targetField.dotPath()))
+        {
+            auto res = buildCtx->validator().validate(targetField.dotPath(), schemf::runtimeValidation());
+            validator = base::getResponse<schemf::ValidationResult>(res).getValidator();
+        }
+
+        // Trace messages
+        const auto name = buildCtx->context().opName;
+        const auto successTrace = fmt::format("{} -> Success", name);
+
+        const auto failureTrace1 = [&]()
+        {
+            if (keyArray->isReference())
+            {
+                return fmt::format("{} -> Reference for key array '{}' not found",
+                                   name,
+                                   std::static_pointer_cast<Reference>(keyArray)->dotPath());
+            }
+
+            return std::string("");
+        }();
+
+        const auto failureTrace2 = [&]()
+        {
+            if (keyArray->isReference())
+            {
+                return fmt::format("{} -> Reference for key array '{}' is not an heterogeneous string array",
+                                   name,
+                                   std::static_pointer_cast<Reference>(keyArray)->dotPath());
+            }
+
+            return std::string("");
+        }();
+
+        const auto failureTrace3 = fmt::format("{} -> Could not get values from DB: ", name);
+        const auto failureTrace4 = fmt::format("{} -> Malformed JSON for value in DB: ", name);
+        const auto failureTrace5 = fmt::format("{} -> None of the keys were found in DB", name);
+        const auto failureTrace6 =
+            fmt::format("{} -> Value from DB failed validation for '{}': ", name, targetField.dotPath());
+
+        // Return Op
+        return [=,
+                runState = buildCtx->runState(),
+                targetField = targetField.jsonPath(),
+                kvdbHandler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler)](
+                   base::Event event) -> TransformResult
+        {
+            // Resolve array of keys
+            std::vector<std::string> keys;
+            if (keyArray->isReference())
+            {
+                const auto& keyArrayRef = *std::static_pointer_cast<Reference>(keyArray);
+                if (!event->exists(keyArrayRef.jsonPath()))
+                {
+                    RETURN_FAILURE(runState, event, failureTrace1);
+                }
+
+                const auto value = event->getArray(keyArrayRef.jsonPath());
+                if (!value)
+                {
+                    RETURN_FAILURE(runState, event, failureTrace2);
+                }
+
+                for (const auto& key : value.value())
+                {
+                    if (!key.isString())
+                    {
+                        RETURN_FAILURE(runState, event, failureTrace2);
+                    }
+
+                    keys.emplace_back(key.getString().value());
+                }
+            }
+            else
+            {
+                auto asArray = std::static_pointer_cast<const Value>(keyArray)->value().getArray().value();
+                for (const auto& key : asArray)
+                {
+                    keys.emplace_back(key.getString().value());
+                }
+            }
+
+            // Get all values from KVDB in a single batched lookup
+            auto resultValue = kvdbHandler->multiGet(keys);
+            if (base::isError(resultValue))
+            {
+                RETURN_FAILURE(runState, event, failureTrace3 + std::get<base::Error>(resultValue).message);
+            }
+
+            const auto& content = std::get<std::list<std::pair<std::string, std::string>>>(resultValue);
+            if (content.empty())
+            {
+                RETURN_FAILURE(runState, event, failureTrace5);
+            }
+
+            // Map found values as an object keyed by the resolved keys
+            json::Json object;
+            object.setObject();
+            for (const auto& [key, value] : content)
+            {
+                json::Json jValue;
+                try
+                {
+                    jValue = json::Json {value.c_str()};
+                }
+                catch (const std::runtime_error& e)
+                {
+                    RETURN_FAILURE(runState, event, failureTrace4 + e.what());
+                }
+
+                object.set(json::Json::formatJsonPath(key), jValue);
+            }
+
+            // Validate the object
+            if (validator != nullptr)
+            {
+                auto res = validator(object);
+                if (base::isError(res))
+                {
+                    RETURN_FAILURE(runState, event, failureTrace6 + res.value().message);
+                }
+            }
+
+            event->set(targetField, object);
+
+            RETURN_SUCCESS(runState, event, successTrace);
+        };
+    };
+}
+
 namespace
 {
+// Capacity of the per-helper cache of fully decoded masks
+constexpr size_t DECODED_MASK_CACHE_SIZE = 512;
+
+// Per-helper cache mapping a mask value to its decoded flag list. The map is read from KVDB once
+// at build time, so cached entries stay valid for the whole life of the operation.
+struct DecodedMaskCache
+{
+    std::mutex mutex;
+    LRUCache<uint64_t, std::vector<json::Json>> cache {DECODED_MASK_CACHE_SIZE};
+};
+
 // TODO Change this to use an vector instead of a map
 std::function<std::optional<json::Json>(uint64_t pos)> getFnSearchMap(const json::Json& jMap)
 {
@@ -1006,6 +1219,9 @@ TransformOp OpBuilderHelperKVDBDecodeBitmask(const Reference& targetField,
     // Get the function to search in the map
     auto getValueFn = getFnSearchMap(jMap);
 
+    // Audit sources repeat the same few mask values endlessly, so the decoded flag list is cached
+    auto decodedCache = std::make_shared<DecodedMaskCache>();
+
     // Tracing
     const auto name = buildCtx->context().opName;
     const auto successTrace = fmt::format("{} -> Success", name);
@@ -1063,27 +1279,48 @@ TransformOp OpBuilderHelperKVDBDecodeBitmask(const Reference& targetField,
             mask = base::getResponse(resultMask);
         }
 
-        // iterate over the bits of the mask
-        bool isResultEmpty {true};
-        for (uint64_t bitPos = 0; bitPos < std::numeric_limits<uint64_t>::digits; bitPos++)
+        // Reuse the decoded flag list if this mask was already seen
+        std::optional<std::vector<json::Json>> decoded;
         {
-            auto flag = 0x1 << bitPos;
-            if (flag & mask)
-            {
-                auto value = getValueFn(bitPos);
+            std::lock_guard lock {decodedCache->mutex};
+            decoded = decodedCache->cache.getValue(mask);
+        }
 
-                if (value.has_value())
+        if (!decoded.has_value())
+        {
+            // iterate over the bits of the mask
+            std::vector<json::Json> values;
+            for (uint64_t bitPos = 0; bitPos < std::numeric_limits<uint64_t>::digits; bitPos++)
+            {
+                auto flag = 0x1 << bitPos;
+                if (flag & mask)
                 {
-                    isResultEmpty = false;
-                    event->appendJson(*value, targetField);
+                    auto value = getValueFn(bitPos);
+
+                    if (value.has_value())
+                    {
+                        values.emplace_back(std::move(*value));
+                    }
                 }
             }
+
+            {
+                std::lock_guard lock {decodedCache->mutex};
+                decodedCache->cache.insertKey(mask, values);
+            }
+            decoded = std::move(values);
         }
-        if (isResultEmpty)
+
+        if (decoded->empty())
         {
             RETURN_FAILURE(runState, event, failureTrace4);
         }
 
+        for (const auto& value : decoded.value())
+        {
+            event->appendJson(value, targetField);
+        }
+
         RETURN_SUCCESS(runState, event, successTrace);
     };
 }
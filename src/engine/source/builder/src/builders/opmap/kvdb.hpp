@@ -120,6 +120,19 @@ TransformBuilder getOpBuilderKVDBDelete(std::shared_ptr<IKVDBManager> kvdbManage
  */
 TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
 
+/**
+ * @brief Get the KVDB Get Batch function helper builder
+ *
+ * Resolves an array of keys against the database in a single batched lookup and maps the
+ * values found into the target field as an object keyed by the resolved keys.
+ *
+ * @param kvdbManager KVDB Manager
+ * @param kvdbScopeName KVDB Scope Name
+ *
+ * @return Builder
+ */
+TransformBuilder getOpBuilderKVDBGetBatch(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
+
 /**
  * @brief Builds helper BitmaskToTable, that maps a bitmask to a table of values.
  * <field>: kvdb_decode_bitmask(KVDB_name, keyKVDB, $mask)
@@ -14,9 +14,12 @@
 #include <openssl/sha.h>
 #include <re2/re2.h>
 
+#include <base/utils/coarseClock.hpp>
 #include <base/utils/ipUtils.hpp>
+#include <base/utils/scratchString.hpp>
 #include <base/utils/stringUtils.hpp>
 
+#include "builders/regexCache.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -120,24 +123,33 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
 
     const auto& rightParameter = opArgs[0];
 
-    // Depending on the operator we return the correct function
-    std::function<std::string(const std::string& value)> transformFunction;
+    // Depending on the operator we return the correct function. The result is composed
+    // in a reusable scratch buffer, the returned view is valid until the next call.
+    std::function<std::string_view(const std::string& value)> transformFunction;
     switch (op)
     {
         case StringOperator::UP:
-            transformFunction = [](const std::string& value)
+            transformFunction = [](const std::string& value) -> std::string_view
             {
-                std::string result;
-                std::transform(value.begin(), value.end(), std::back_inserter(result), ::toupper);
-                return result;
+                thread_local base::utils::string::ScratchString scratch;
+                scratch.clear();
+                for (const auto c : value)
+                {
+                    scratch.append(static_cast<char>(::toupper(c)));
+                }
+                return scratch.view();
             };
             break;
         case StringOperator::LO:
-            transformFunction = [](const std::string& value)
+            transformFunction = [](const std::string& value) -> std::string_view
             {
-                std::string result;
-                std::transform(value.begin(), value.end(), std::back_inserter(result), ::tolower);
-                return result;
+                thread_local base::utils::string::ScratchString scratch;
+                scratch.clear();
+                for (const auto c : value)
+                {
+                    scratch.append(static_cast<char>(::tolower(c)));
+                }
+                return scratch.view();
             };
             break;
         default: break;
@@ -160,7 +172,7 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
         if (rightParameter->isReference())
         {
             const auto resolvedRValue {
-                event->getString(std::static_pointer_cast<Reference>(rightParameter)->jsonPath())};
+                event->getString(std::static_pointer_cast<Reference>(rightParameter)->compiledPath())};
 
             if (!resolvedRValue.has_value())
             {
@@ -255,7 +267,7 @@ MapOp opBuilderHelperIntTransformation(IntOperator op,
             getOperandFn.emplace_back(
                 [ref, failureTrace2](base::ConstEvent event) -> int64_t
                 {
-                    auto resolvedRValue {event->getIntAsInt64(ref->jsonPath())};
+                    auto resolvedRValue {event->getIntAsInt64(ref->compiledPath())};
                     if (!resolvedRValue.has_value())
                     {
                         throw std::runtime_error(failureTrace2 + ref->dotPath());
@@ -480,7 +492,7 @@ TransformOp opBuilderHelperStringTrim(const Reference& targetField,
 
     // Return Op
     return
-        [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](base::Event event) -> TransformResult
+        [=, runState = buildCtx->runState(), targetField = targetField.compiledPath()](base::Event event) -> TransformResult
     {
         // Get field value
         if (!event->exists(targetField))
@@ -574,7 +586,9 @@ MapBuilder opBuilderHelperStringConcat(bool atleastOne)
         // Return Op
         return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
         {
-            std::string result {};
+            // Reused scratch buffer, pieces are appended without intermediate growth
+            thread_local base::utils::string::ScratchString result;
+            result.clear();
 
             for (const auto& arg : opArgs)
             {
@@ -633,7 +647,7 @@ MapBuilder opBuilderHelperStringConcat(bool atleastOne)
                 }
             }
             json::Json resultJson;
-            resultJson.setString(result);
+            resultJson.setString(result.view());
             RETURN_SUCCESS(runState, resultJson, successTrace);
         };
     };
@@ -700,25 +714,27 @@ MapOp opBuilderHelperStringFromArray(const std::vector<OpArg>& opArgs, const std
             RETURN_FAILURE(runState, json::Json {}, failureTrace3);
         }
 
-        std::vector<std::string> stringArray;
+        // Compose directly into a reused scratch buffer, without collecting the members
+        thread_local base::utils::string::ScratchString composed;
+        composed.clear();
+        auto first = true;
         for (const auto& s_param : stringJsonArray.value())
         {
-            if (s_param.isString())
+            if (!s_param.isString())
             {
-                const auto strVal = s_param.getString().value();
-                stringArray.emplace_back(std::move(strVal));
+                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
             }
-            else
+
+            if (!first)
             {
-                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
+                composed.append(separator);
             }
+            composed.append(s_param.getString().value());
+            first = false;
         }
 
-        // accumulated concation without trailing indexes
-        const std::string composedValueString {base::utils::string::join(stringArray, separator)};
-
         json::Json result;
-        result.setString(composedValueString);
+        result.setString(composed.view());
 
         RETURN_SUCCESS(runState, result, successTrace);
     };
@@ -757,7 +773,7 @@ MapOp opBuilderHelperStringFromHexa(const std::vector<OpArg>& opArgs, const std:
     const auto failureTrace5 = fmt::format("{} -> Found non ascii character", traceName);
 
     // Return Op
-    return [=, runState = buildCtx->runState(), sourceField = hexRef.jsonPath()](base::ConstEvent event) -> MapResult
+    return [=, runState = buildCtx->runState(), sourceField = hexRef.compiledPath()](base::ConstEvent event) -> MapResult
     {
         std::string strHex {};
 
@@ -844,7 +860,7 @@ MapOp opBuilderHelperHexToNumber(const std::vector<OpArg>& opArgs, const std::sh
     const std::string failureTrace3 {fmt::format("[{}] -> Failure: ", traceName)};
 
     // Return Op
-    return [=, runState = buildCtx->runState(), sourceField = hexRef.jsonPath()](base::ConstEvent event) -> MapResult
+    return [=, runState = buildCtx->runState(), sourceField = hexRef.compiledPath()](base::ConstEvent event) -> MapResult
     {
         // Getting string field from a reference
         if (!event->exists(sourceField))
@@ -914,7 +930,7 @@ TransformOp opBuilderHelperStringReplace(const Reference& targetField,
 
     // Return Op
     return
-        [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](base::Event event) -> TransformResult
+        [=, runState = buildCtx->runState(), targetField = targetField.compiledPath()](base::Event event) -> TransformResult
     {
         if (!event->exists(targetField))
         {
@@ -966,6 +982,86 @@ MapOp opBuilderHelperNumberToString(const std::vector<OpArg>& opArgs, const std:
         fmt::format(R"([{}] -> Failure: Reference '{}' not found: )", name, reference->dotPath())};
     const std::string failureTrace3 {fmt::format(R"([{}] -> Failure: Parameter is not number: )", name)};
 
+    // When the schema proves the reference type, emit a specialized conversion and skip the
+    // per-event type dispatch
+    if (buildCtx->validator().hasField(reference->dotPath()))
+    {
+        const auto sType = buildCtx->validator().getType(reference->dotPath());
+        switch (sType)
+        {
+            case schemf::Type::BYTE:
+            case schemf::Type::SHORT:
+            case schemf::Type::INTEGER:
+            case schemf::Type::LONG:
+                return [successTrace,
+                        failureTrace2,
+                        failureTrace3,
+                        reference = reference->jsonPath(),
+                        runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
+                {
+                    const auto value = event->getIntAsInt64(reference);
+                    if (!value.has_value())
+                    {
+                        RETURN_FAILURE(runState,
+                                       json::Json(),
+                                       (!event->exists(reference)) ? (failureTrace2 + reference)
+                                                                   : (failureTrace3 + reference));
+                    }
+
+                    json::Json result;
+                    result.setString(std::to_string(value.value()));
+                    RETURN_SUCCESS(runState, result, successTrace);
+                };
+            case schemf::Type::FLOAT:
+            case schemf::Type::HALF_FLOAT:
+            case schemf::Type::SCALED_FLOAT:
+                return [successTrace,
+                        failureTrace2,
+                        failureTrace3,
+                        reference = reference->jsonPath(),
+                        runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
+                {
+                    const auto value = event->getFloat(reference);
+                    if (!value.has_value())
+                    {
+                        RETURN_FAILURE(runState,
+                                       json::Json(),
+                                       (!event->exists(reference)) ? (failureTrace2 + reference)
+                                                                   : (failureTrace3 + reference));
+                    }
+
+                    json::Json result;
+                    result.setString(std::to_string(value.value()));
+                    RETURN_SUCCESS(runState, result, successTrace);
+                };
+            case schemf::Type::DOUBLE:
+                return [successTrace,
+                        failureTrace2,
+                        failureTrace3,
+                        reference = reference->jsonPath(),
+                        runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
+                {
+                    const auto value = event->getDouble(reference);
+                    if (!value.has_value())
+                    {
+                        RETURN_FAILURE(runState,
+                                       json::Json(),
+                                       (!event->exists(reference)) ? (failureTrace2 + reference)
+                                                                   : (failureTrace3 + reference));
+                    }
+
+                    json::Json result;
+                    result.setString(std::to_string(value.value()));
+                    RETURN_SUCCESS(runState, result, successTrace);
+                };
+            default:
+                throw std::runtime_error(
+                    fmt::format("Expected a numeric reference but got reference '{}' of type '{}'",
+                                reference->dotPath(),
+                                schemf::typeToStr(sType)));
+        }
+    }
+
     // Function that implements the helper
     return [successTrace,
             failureTrace2,
@@ -1038,11 +1134,8 @@ MapOp opBuilderHelperRegexExtract(const std::vector<OpArg>& opArgs, const std::s
         throw std::runtime_error(fmt::format("Expected 'string' parameter but got type '{}'",
                                              std::static_pointer_cast<Value>(opArgs[1])->value().typeName()));
     }
-    auto regex_ptr = std::make_shared<RE2>(std::static_pointer_cast<Value>(opArgs[1])->value().getString().value());
-    if (!regex_ptr->ok())
-    {
-        throw std::runtime_error(fmt::format("Invalid regex: {}", regex_ptr->error()));
-    }
+    auto regex_ptr =
+        builder::builders::utils::getCompiledRegex(std::static_pointer_cast<Value>(opArgs[1])->value().getString().value());
 
     // Get field reference
     const auto refField = *std::static_pointer_cast<Reference>(opArgs[0]);
@@ -1065,7 +1158,7 @@ MapOp opBuilderHelperRegexExtract(const std::vector<OpArg>& opArgs, const std::s
     const auto failureTrace3 = fmt::format("[{}] -> Regex did not match", name);
 
     // Return Op
-    return [=, runState = buildCtx->runState(), refField = refField.jsonPath()](base::ConstEvent event) -> MapResult
+    return [=, runState = buildCtx->runState(), refField = refField.compiledPath()](base::ConstEvent event) -> MapResult
     {
         if (!event->exists(refField))
         {
@@ -1503,8 +1596,8 @@ MapOp opBuilderHelperEpochTimeFromSystem(const std::vector<OpArg>& opArgs,
     // Return Op
     return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
     {
-        auto sec = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
-                       .count();
+        // Second precision, so the coarse cached clock is more than accurate enough
+        auto sec = base::utils::time::CoarseClock::instance().secondsSinceEpoch();
         // TODO: Delete this and dd SetInt64 or SetIntAny to JSON class, get
         // Number of any type (fix concat helper)
         if (sec > std::numeric_limits<int64_t>::max())
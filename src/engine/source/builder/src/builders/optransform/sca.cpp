@@ -6,6 +6,7 @@
 #include <string>
 #include <tuple>
 #include <variant>
+#include <vector>
 
 #include <base/logging.hpp>
 #include <base/utils/stringUtils.hpp>
@@ -364,7 +365,10 @@ void fillCheckEvent(const DecodeCxt& ctx, const std::string& previousResult)
     field::csvStr2ArrayIfExist(ctx, field::Name::CHECK_COMMAND);
 }
 
-void insertCompliance(const DecodeCxt& ctx, const int checkID)
+void appendComplianceQueries(const DecodeCxt& ctx,
+                             const int checkID,
+                             std::vector<std::string>& queries,
+                             std::vector<std::string>& onFailMessages)
 {
     const auto& compliance = ctx.getSrcObject(field::Name::CHECK_COMPLIANCE);
 
@@ -382,19 +386,16 @@ void insertCompliance(const DecodeCxt& ctx, const int checkID)
             continue;
         }
         // Saving compliance fields to database for event id
-        const auto query =
-            fmt::format("agent {} sca insert_compliance {}|{}|{}", ctx.agentID, checkID, key, value.value());
-
-        const auto [res, payload] = ctx.wdb->tryQueryAndParseResult(query, WDB_ATTEMPTS);
-        if (wazuhdb::QueryResultCodes::OK != res)
-        {
-            LOG_WARNING(
-                "Engine SCA decoder builder: Failed to insert compliance '{}' for check '{}'.", value.value(), checkID);
-        }
+        queries.push_back(fmt::format("agent {} sca insert_compliance {}|{}|{}", ctx.agentID, checkID, key, value.value()));
+        onFailMessages.push_back(fmt::format(
+            "Engine SCA decoder builder: Failed to insert compliance '{}' for check '{}'.", value.value(), checkID));
     }
 }
 
-void insertRules(const DecodeCxt& ctx, const int checkID)
+void appendRulesQueries(const DecodeCxt& ctx,
+                        const int checkID,
+                        std::vector<std::string>& queries,
+                        std::vector<std::string>& onFailMessages)
 {
     // Save rules
     const auto rules = ctx.getSrcArray(field::Name::CHECK_RULES);
@@ -417,15 +418,10 @@ void insertRules(const DecodeCxt& ctx, const int checkID)
         const auto type = getRuleTypeStr(rule.value()[0]);
         if (type)
         {
-            const auto query =
-                fmt::format("agent {} sca insert_rules {}|{}|{}", ctx.agentID, checkID, type.value(), rule.value());
-
-            const auto [res, payload] = ctx.wdb->tryQueryAndParseResult(query, WDB_ATTEMPTS);
-            if (wazuhdb::QueryResultCodes::OK != res)
-            {
-                LOG_WARNING(
-                    "Engine SCA decoder builder: Failed to insert rule '{}' for check '{}'.", rule.value(), checkID);
-            }
+            queries.push_back(
+                fmt::format("agent {} sca insert_rules {}|{}|{}", ctx.agentID, checkID, type.value(), rule.value()));
+            onFailMessages.push_back(fmt::format(
+                "Engine SCA decoder builder: Failed to insert rule '{}' for check '{}'.", rule.value(), checkID));
         }
         else
         {
@@ -483,18 +479,25 @@ std::optional<std::string> handleCheckEvent(const DecodeCxt& ctx)
                         ctx.agentID);
             return std::string("Error querying policy monitoring database for agent ") + ctx.agentID;
     }
-    // Save or update the policy monitoring
-    const auto [resSavePolicy, empty] = ctx.wdb->tryQueryAndParseResult(saveQuery, WDB_ATTEMPTS);
-    if (wazuhdb::QueryResultCodes::OK != resSavePolicy)
+    // Aggregate the save or update of the policy monitoring with the compliance and
+    // rules inserts of new policies, and resolve them in one pipelined wdb exchange.
+    std::vector<std::string> saveQueries {std::move(saveQuery)};
+    std::vector<std::string> onFailMessages {
+        fmt::format("Engine SCA decoder builder: Error saving policy monitoring for agent '{}'.", ctx.agentID)};
+
+    if (SearchResult::NOT_FOUND == resPreviosResult)
     {
-        LOG_WARNING("Engine SCA decoder builder: Error saving policy monitoring for agent '{}'.", ctx.agentID);
+        appendComplianceQueries(ctx, checkID, saveQueries, onFailMessages);
+        appendRulesQueries(ctx, checkID, saveQueries, onFailMessages);
     }
 
-    // If policies are new, then save the rules and compliance
-    if (SearchResult::NOT_FOUND == resPreviosResult)
+    const auto saveResults = ctx.wdb->tryQueryAndParseResultPipelined(saveQueries, WDB_ATTEMPTS);
+    for (std::size_t i = 0; i < saveResults.size(); i++)
     {
-        insertCompliance(ctx, checkID);
-        insertRules(ctx, checkID);
+        if (wazuhdb::QueryResultCodes::OK != std::get<0>(saveResults[i]))
+        {
+            LOG_WARNING("{}", onFailMessages[i]);
+        }
     }
 
     // Normalize the SCA event and add the previous result if exists
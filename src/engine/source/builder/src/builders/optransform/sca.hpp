@@ -185,20 +185,32 @@ bool isValidCheckEvent(const DecodeCxt& ctx);
 void fillCheckEvent(const DecodeCxt& ctx, const std::string& previousResult);
 
 /**
- * @brief Insert compliance to wdb.
+ * @brief Append the compliance insert queries of a check to a batch.
  *
+ * The queries are resolved later in a single pipelined wdb exchange.
  * @param ctx The decoder context, decode info status.
  * @param checkID The check ID to insert.
+ * @param queries Batch of queries to append to.
+ * @param onFailMessages Warning to log, per query, if its result is not OK.
  */
-void insertCompliance(const DecodeCxt& ctx, const int checkID);
+void appendComplianceQueries(const DecodeCxt& ctx,
+                             const int checkID,
+                             std::vector<std::string>& queries,
+                             std::vector<std::string>& onFailMessages);
 
 /**
- * @brief Insert rules  to wdb
+ * @brief Append the rules insert queries of a check to a batch.
  *
+ * The queries are resolved later in a single pipelined wdb exchange.
  * @param ctx The decoder context, decode info status.
- * @param checkID The check ID to insert
+ * @param checkID The check ID to insert.
+ * @param queries Batch of queries to append to.
+ * @param onFailMessages Warning to log, per query, if its result is not OK.
  */
-void insertRules(const DecodeCxt& ctx, const int checkID);
+void appendRulesQueries(const DecodeCxt& ctx,
+                        const int checkID,
+                        std::vector<std::string>& queries,
+                        std::vector<std::string>& onFailMessages);
 
 /****************************************************************************************
                                   Scan Info Event
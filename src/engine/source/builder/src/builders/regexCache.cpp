@@ -0,0 +1,37 @@
+#include "regexCache.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+namespace builder::builders::utils
+{
+
+std::shared_ptr<const RE2> getCompiledRegex(const std::string& pattern)
+{
+    static std::mutex cacheMutex;
+    static std::unordered_map<std::string, std::shared_ptr<const RE2>> cache;
+
+    {
+        std::lock_guard<std::mutex> lock {cacheMutex};
+        auto it = cache.find(pattern);
+        if (it != cache.end())
+        {
+            return it->second;
+        }
+    }
+
+    // Compile outside the lock, invalid patterns are not cached
+    auto compiled = std::make_shared<const RE2>(pattern, RE2::Quiet);
+    if (!compiled->ok())
+    {
+        throw std::runtime_error(fmt::format("Invalid regex: \"{}\".", pattern));
+    }
+
+    std::lock_guard<std::mutex> lock {cacheMutex};
+    auto [it, inserted] = cache.emplace(pattern, std::move(compiled));
+    return it->second;
+}
+
+} // namespace builder::builders::utils
@@ -0,0 +1,28 @@
+#ifndef _BUILDER_BUILDERS_REGEXCACHE_HPP
+#define _BUILDER_BUILDERS_REGEXCACHE_HPP
+
+#include <memory>
+#include <string>
+
+#include <re2/re2.h>
+
+namespace builder::builders::utils
+{
+
+/**
+ * @brief Get a compiled RE2 for the given pattern, sharing one instance per pattern.
+ *
+ * Regex helpers are built once per asset, and the same patterns repeat across hundreds of
+ * decoders. Compiling each occurrence separately wastes build time and memory, so compiled
+ * expressions are kept in a process-wide cache keyed by the pattern string. RE2 matching is
+ * thread safe, so the returned instance can be shared freely between operations.
+ *
+ * @param pattern Regex pattern to compile.
+ * @return Shared compiled expression.
+ * @throw std::runtime_error if the pattern is not a valid RE2 regex.
+ */
+std::shared_ptr<const RE2> getCompiledRegex(const std::string& pattern);
+
+} // namespace builder::builders::utils
+
+#endif // _BUILDER_BUILDERS_REGEXCACHE_HPP
@@ -84,6 +84,29 @@ getTermBuilder(const std::shared_ptr<const IBuildCtx>& buildCtx)
     };
 }
 
+/**
+ * @brief Relative evaluation cost of a filter helper, used to reorder check
+ * expressions so cheap terms run first.
+ *
+ * Coarse buckets, not measurements: literal and numeric comparisons are nearly
+ * free, regex and KVDB lookups dominate, everything else sits in between.
+ */
+int getTermCost(const parsers::HelperToken& token)
+{
+    if (token.name.rfind("regex_", 0) == 0 || token.name.rfind("kvdb_", 0) == 0)
+    {
+        return 100;
+    }
+
+    if (token.name == "filter" || token.name == "exists" || token.name == "not_exists"
+        || token.name.rfind("int_", 0) == 0 || token.name.rfind("string_", 0) == 0 || token.name.rfind("is_", 0) == 0)
+    {
+        return 1;
+    }
+
+    return 10;
+}
+
 base::Expression checkExpressionBuilder(const std::string& logicExpr, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
     std::function<bool(base::Event)> evaluator;
@@ -92,8 +115,10 @@ base::Expression checkExpressionBuilder(const std::string& logicExpr, const std:
         // Apply definitions
         auto replacedExpr = buildCtx->definitions().replace(logicExpr);
         // TODO: make a factory and inject this dependency
-        evaluator = logicexpr::buildDijstraEvaluator<base::Event, parsers::HelperToken>(
-            replacedExpr, getTermBuilder(buildCtx), parsers::getTermParser());
+        // Filter helpers are side-effect free, so the commutative operands can be
+        // reordered by cost and short-circuited without changing the result
+        evaluator = logicexpr::buildCostOrderedEvaluator<base::Event, parsers::HelperToken>(
+            replacedExpr, getTermBuilder(buildCtx), parsers::getTermParser(), getTermCost);
     }
     catch (const std::exception& e)
     {
@@ -43,7 +43,8 @@ base::Expression fileOutputBuilder(const json::Json& definition, const std::shar
     }
 
     auto path = value.getString().value();
-    auto filePtr = std::make_shared<detail::FileOutput>(path);
+    // Batched writer: workers only append to a buffer, a single writer thread does the I/O
+    std::shared_ptr<detail::FileOutput> filePtr = std::make_shared<detail::BatchedFileOutput>(path);
     auto name = fmt::format("write.output({})", path);
     const auto successTrace = fmt::format("{} -> Success", name);
     const auto failureTrace = fmt::format("{} -> Could not write event to output", name);
@@ -1,10 +1,14 @@
 #ifndef _BUILDER_BUILDERS_STAGE_FILEOUTPUT_HPP
 #define _BUILDER_BUILDERS_STAGE_FILEOUTPUT_HPP
 
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include <fmt/format.h>
 
@@ -45,7 +49,7 @@ public:
      * @brief Closes file if open
      *
      */
-    ~FileOutput()
+    virtual ~FileOutput()
     {
         if (this->m_os.is_open())
         {
@@ -58,7 +62,122 @@ public:
      *
      * @param e
      */
-    void write(base::ConstEvent e) { this->m_os << e->str() << std::endl; }
+    virtual void write(base::ConstEvent e) { this->m_os << e->str() << std::endl; }
+};
+
+/**
+ * @brief FileOutput that batches events and writes them from a dedicated writer thread.
+ *
+ * Workers only append the serialized event to an in-memory buffer under a short lock,
+ * turning the per-event file operation and flush into a few large writes. The single
+ * writer thread swaps the buffer out and writes it when the pending bytes exceed
+ * maxBatchBytes or flushInterval elapses, whichever comes first. syncEveryFlush
+ * controls whether each batch is also pushed to the OS, otherwise the stream buffer
+ * decides; the destructor always drains and flushes the pending events.
+ */
+class BatchedFileOutput : public FileOutput
+{
+public:
+    constexpr static std::size_t DEFAULT_MAX_BATCH_BYTES = 1024 * 1024;
+    constexpr static std::chrono::milliseconds DEFAULT_FLUSH_INTERVAL {500};
+
+private:
+    std::string m_pending;              ///< Events appended by the workers, not yet written
+    std::mutex m_mutex;                 ///< Protects m_pending and m_stop
+    std::condition_variable m_cv;       ///< Wakes up the writer thread
+    std::thread m_writer;               ///< The single writer thread
+    bool m_stop {false};                ///< Writer thread stop flag
+    std::size_t m_maxBatchBytes;        ///< Pending bytes that trigger an early flush
+    std::chrono::milliseconds m_flushInterval; ///< Maximum time an event stays buffered
+    bool m_syncEveryFlush;              ///< Push every batch to the OS
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock {m_mutex};
+        while (true)
+        {
+            m_cv.wait_for(
+                lock, m_flushInterval, [this]() { return m_stop || m_pending.size() >= m_maxBatchBytes; });
+
+            std::string batch {};
+            batch.swap(m_pending);
+            const auto stopping = m_stop;
+            lock.unlock();
+
+            if (!batch.empty())
+            {
+                m_os.write(batch.data(), batch.size());
+                if (m_syncEveryFlush || stopping)
+                {
+                    m_os.flush();
+                }
+            }
+
+            if (stopping)
+            {
+                return;
+            }
+            lock.lock();
+        }
+    }
+
+public:
+    /**
+     * @brief Construct a new Batched File Output object
+     *
+     * @param path file to store the events received
+     * @param maxBatchBytes Pending bytes that trigger an early flush
+     * @param flushInterval Maximum time an event stays buffered
+     * @param syncEveryFlush Push every batch to the OS
+     */
+    explicit BatchedFileOutput(const std::string& path,
+                               std::size_t maxBatchBytes = DEFAULT_MAX_BATCH_BYTES,
+                               std::chrono::milliseconds flushInterval = DEFAULT_FLUSH_INTERVAL,
+                               bool syncEveryFlush = false)
+        : FileOutput(path)
+        , m_maxBatchBytes(maxBatchBytes)
+        , m_flushInterval(flushInterval)
+        , m_syncEveryFlush(syncEveryFlush)
+    {
+        m_writer = std::thread([this]() { run(); });
+    }
+
+    /**
+     * @brief Drains the pending events and stops the writer thread
+     *
+     */
+    ~BatchedFileOutput() override
+    {
+        {
+            std::unique_lock<std::mutex> lock {m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        if (m_writer.joinable())
+        {
+            m_writer.join();
+        }
+    }
+
+    /**
+     * @brief Append the event to the pending buffer, the writer thread does the I/O
+     *
+     * @param e
+     */
+    void write(base::ConstEvent e) override
+    {
+        bool wakeWriter {false};
+        {
+            std::unique_lock<std::mutex> lock {m_mutex};
+            m_pending += e->str();
+            m_pending += '\n';
+            wakeWriter = m_pending.size() >= m_maxBatchBytes;
+        }
+        if (wakeWriter)
+        {
+            m_cv.notify_one();
+        }
+    }
 };
 } // namespace detail
 
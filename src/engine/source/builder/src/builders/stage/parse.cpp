@@ -1,6 +1,7 @@
 #include "parse.hpp"
 
 #include <base/json.hpp>
+#include <logpar/literalDispatcher.hpp>
 
 #include "syntax.hpp"
 
@@ -36,6 +37,11 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
 
         auto logparArr = definition.getArray().value();
         std::vector<base::Expression> parsersExpressions {};
+
+        // Dispatcher over the leading literals of the alternatives, used to discard an
+        // alternative without running its parser when the input cannot match its anchor
+        auto dispatcher = std::make_shared<hlp::logpar::LiteralDispatcher>();
+
         for (const json::Json& item : logparArr)
         {
             if (!item.isObject())
@@ -64,17 +70,25 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
                 throw std::runtime_error(fmt::format("An error occurred while parsing a log: {}", e.what()));
             }
 
-            // Traces
+            auto alternative = dispatcher->add(hlp::logpar::Logpar::extractLeadingLiteral(logparExpr));
+
+            // Traces, formatted once and shared across every per-event result
             const auto name = fmt::format("{}: {}", field, logparExpr);
-            const auto successTrace = fmt::format("[{}] -> Success", name);
+            const auto successTrace =
+                std::make_shared<const std::string>(fmt::format("[{}] -> Success", name));
 
             // field to be parsed not exists
-            const std::string failureTrace1 =
-                fmt::format(R"([{}] -> Failure: Parameter "{}" reference not found)", name, field);
+            const auto failureTrace1 = std::make_shared<const std::string>(
+                fmt::format(R"([{}] -> Failure: Parameter "{}" reference not found)", name, field));
             // Parsing failed
-            const std::string failureTrace2 = fmt::format("[{}] -> Failure: Parse operation failed: ", name);
+            const auto failureTrace2 = std::make_shared<const std::string>(
+                fmt::format("[{}] -> Failure: Parse operation failed: ", name));
             // Parsing ok, mapping failed
-            const std::string failureTrace3 = fmt::format("[{}] -> Failure: field [{}] is not a string", name, field);
+            const auto failureTrace3 = std::make_shared<const std::string>(
+                fmt::format("[{}] -> Failure: field [{}] is not a string", name, field));
+            // Input does not start with the literal anchor of the expression
+            const auto failureTrace4 = std::make_shared<const std::string>(
+                fmt::format("[{}] -> Failure: Input does not match the leading literal of the expression", name));
 
             base::Expression parseExpression;
             try
@@ -93,10 +107,20 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
                         }
 
                         auto ev = event->getString(field).value();
+                        if (!dispatcher->isCandidate(alternative, ev))
+                        {
+                            return base::result::makeFailure(std::move(event), failureTrace4);
+                        }
+
                         auto error = hlp::parser::run(parser, ev, *event);
                         if (error)
                         {
-                            return base::result::makeFailure(std::move(event), failureTrace2 + error.value().message);
+                            // The concatenation is deferred until a tracer actually reads the trace
+                            return base::result::makeFailure(
+                                std::move(event),
+                                base::result::DeferredTrace {
+                                    [failureTrace2, msg = std::move(error.value().message)]()
+                                    { return *failureTrace2 + msg; }});
                         }
 
                         return base::result::makeSuccess(std::move(event), successTrace);
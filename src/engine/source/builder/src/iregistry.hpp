@@ -38,6 +38,12 @@ public:
      * @return base::RespOrError<Builder> Builder if found, error otherwise.
      */
     virtual base::RespOrError<Builder> get(const std::string& name) const = 0;
+
+    /**
+     * @brief Signal that registration is complete, allowing the registry to fix its
+     * dispatch structures. Adding builders after freezing may be rejected.
+     */
+    virtual void freeze() {}
 };
 
 namespace detail
@@ -104,6 +110,14 @@ public:
         registry->add(name, entry);
     }
 
+    /**
+     * @brief Freeze all the registries, fixing their dispatch structures.
+     */
+    void freeze()
+    {
+        std::apply([](auto&... registry) { (registry->freeze(), ...); }, m_registryTuple);
+    }
+
     template<typename Builder>
     auto get(const std::string& name) const
     {
@@ -1,10 +1,18 @@
 #include "policy/factory.hpp"
 
+#include <atomic>
+#include <mutex>
 #include <numeric> // std::accumulate
+#include <optional>
 #include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <fmt/format.h>
 
+#include <base/baseTypes.hpp>
 #include <store/utils.hpp>
 
 #include "asset.hpp"
@@ -13,6 +21,44 @@
 namespace
 {
 auto constexpr GRAPH_INPUT_SUFFIX = "Input";
+auto constexpr CHECK_STAGE_NAME = "stage.check";
+
+/**
+ * @brief Wrap a check term function so its result is memoized per event.
+ *
+ * The table is thread local and reset whenever a different event shows up, so a hit can
+ * only come from an earlier occurrence of the same term within the current event's
+ * traversal. Backends that move an event between threads simply miss the cache and
+ * re-evaluate, which is safe because check terms do not modify the event.
+ *
+ * @param key Key identifying the shared term in the table.
+ * @param fn Original term function.
+ * @return base::EngineOp Memoizing wrapper of fn.
+ */
+base::EngineOp memoizeCheckOp(unsigned int key, base::EngineOp fn)
+{
+    return [key, fn = std::move(fn)](base::Event event) -> base::result::Result<base::Event>
+    {
+        thread_local const json::Json* lastEvent = nullptr;
+        thread_local std::unordered_map<unsigned int, base::result::Result<base::Event>> results;
+
+        if (event.get() != lastEvent)
+        {
+            results.clear();
+            lastEvent = event.get();
+        }
+
+        auto it = results.find(key);
+        if (results.end() != it)
+        {
+            return it->second;
+        }
+
+        auto res = fn(event);
+        results.emplace(key, res);
+        return res;
+    };
+}
 }
 
 namespace builder::policy::factory
@@ -321,9 +367,18 @@ BuiltAssets buildAssets(const PolicyData& data,
                         const std::shared_ptr<store::IStoreReader> store,
                         const std::shared_ptr<IAssetBuilder>& assetBuilder)
 {
-    BuiltAssets builtAssets;
-
-    // Build assets for each type
+    // Asset builds are independent of each other until the graph is assembled, so the
+    // documents are fetched serially and compiled across a pool of workers.
+    struct BuildTask
+    {
+        PolicyData::AssetType type;             ///< Subgraph the asset belongs to
+        base::Name name;                        ///< Name of the asset
+        store::Doc document;                    ///< Document of the asset
+        std::optional<base::Name> defaultParent; ///< Default parent if the asset has none
+        Asset built;                            ///< Built asset, filled by the worker
+    };
+
+    std::vector<BuildTask> tasks;
     for (const auto& [assetType, subgraphData] : data.subgraphs())
     {
         for (const auto& [assetNs, assetNames] : subgraphData.assets)
@@ -337,27 +392,91 @@ BuiltAssets buildAssets(const PolicyData& data,
                     throw std::runtime_error(fmt::format("Asset '{}' not found", assetName));
                 }
 
-                Asset asset = (*assetBuilder)(base::getResponse<store::Doc>(resp));
+                std::optional<base::Name> defaultParent;
+                auto defParentIt = subgraphData.defaultParents.find(assetNs);
+                if (defParentIt != subgraphData.defaultParents.end() && defParentIt->second != assetName)
+                {
+                    defaultParent = defParentIt->second;
+                }
+
+                tasks.push_back(BuildTask {assetType,
+                                           assetName,
+                                           base::getResponse<store::Doc>(std::move(resp)),
+                                           std::move(defaultParent),
+                                           Asset {}});
+            }
+        }
+    }
+
+    // Compile every asset, each worker claims the next pending task. The first error
+    // stops the pool and is rethrown once every worker has joined.
+    std::atomic<std::size_t> nextTask {0};
+    std::exception_ptr firstError {};
+    std::mutex errorMutex;
+
+    auto worker = [&]()
+    {
+        for (auto i = nextTask.fetch_add(1); i < tasks.size(); i = nextTask.fetch_add(1))
+        {
+            auto& task = tasks[i];
+            try
+            {
+                task.built = (*assetBuilder)(task.document);
 
                 // Add parents
-                if (asset.parents().empty())
+                if (task.built.parents().empty() && task.defaultParent)
                 {
-                    auto defParentIt = subgraphData.defaultParents.find(assetNs);
-                    if (defParentIt != subgraphData.defaultParents.end() && defParentIt->second != assetName)
-                    {
-                        asset.parents().emplace_back(defParentIt->second);
-                    }
+                    task.built.parents().emplace_back(task.defaultParent.value());
                 }
-
-                // Add built asset to the subgraph
-                if (builtAssets.find(assetType) == builtAssets.end())
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock {errorMutex};
+                if (!firstError)
                 {
-                    builtAssets.emplace(assetType, std::unordered_map<base::Name, Asset> {});
+                    firstError = std::current_exception();
                 }
-
-                builtAssets[assetType].emplace(assetName, asset);
+                nextTask = tasks.size(); // Stop claiming tasks
+                return;
             }
         }
+    };
+
+    const auto hwThreads = std::max(1u, std::thread::hardware_concurrency());
+    const auto workers = std::min(tasks.size(), static_cast<std::size_t>(hwThreads));
+    if (workers <= 1)
+    {
+        worker();
+    }
+    else
+    {
+        std::vector<std::thread> pool;
+        pool.reserve(workers);
+        for (std::size_t i = 0; i < workers; i++)
+        {
+            pool.emplace_back(worker);
+        }
+        for (auto& thread : pool)
+        {
+            thread.join();
+        }
+    }
+
+    if (firstError)
+    {
+        std::rethrow_exception(firstError);
+    }
+
+    // Collect the built assets into the subgraphs serially
+    BuiltAssets builtAssets;
+    for (auto& task : tasks)
+    {
+        if (builtAssets.find(task.type) == builtAssets.end())
+        {
+            builtAssets.emplace(task.type, std::unordered_map<base::Name, Asset> {});
+        }
+
+        builtAssets[task.type].emplace(std::move(task.name), std::move(task.built));
     }
 
     return builtAssets;
@@ -475,6 +594,58 @@ PolicyGraph buildGraph(const BuiltAssets& assets, const PolicyData& data)
     return graph;
 }
 
+std::size_t shareCheckTerms(const base::Expression& expression)
+{
+    // Collect the operand slots holding each check term, keyed by the term's
+    // structural name
+    std::unordered_map<std::string, std::vector<std::reference_wrapper<base::Expression>>> slots;
+    std::unordered_set<const base::Formula*> visitedNodes;
+
+    auto collect = [&](const base::Expression& node, auto& visitRef) -> void
+    {
+        if (!node || !node->isOperation() || !visitedNodes.insert(node.get()).second)
+        {
+            return;
+        }
+
+        const auto isCheckStage = node->getName() == CHECK_STAGE_NAME;
+        for (auto& operand : node->getPtr<base::Operation>()->getOperands())
+        {
+            if (isCheckStage && operand->isTerm())
+            {
+                slots[operand->getName()].emplace_back(operand);
+            }
+            else
+            {
+                visitRef(operand, visitRef);
+            }
+        }
+    };
+    collect(expression, collect);
+
+    std::size_t sharedTerms = 0;
+    for (auto& [name, occurrences] : slots)
+    {
+        if (occurrences.size() < 2)
+        {
+            continue;
+        }
+
+        // Build the shared term from the first occurrence and point every slot to it
+        auto originalFn = occurrences.front().get()->getPtr<base::Term<base::EngineOp>>()->getFn();
+        auto sharedTerm = base::Term<base::EngineOp>::create(name, base::EngineOp {});
+        sharedTerm->setFn(memoizeCheckOp(sharedTerm->getId(), std::move(originalFn)));
+
+        for (auto& slot : occurrences)
+        {
+            slot.get() = sharedTerm;
+        }
+        sharedTerms += occurrences.size() - 1;
+    }
+
+    return sharedTerms;
+}
+
 base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& data)
 {
     // Expression of the policy, expression to be returned.
@@ -504,6 +675,9 @@ base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& dat
         policy->getOperands().emplace_back(subgraphExpr);
     }
 
+    // Share identical check terms repeated across sibling assets
+    shareCheckTerms(policy);
+
     return policy;
 }
 
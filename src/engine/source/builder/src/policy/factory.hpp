@@ -241,6 +241,9 @@ using BuiltAssets = std::unordered_map<PolicyData::AssetType, std::unordered_map
 /**
  * @brief Build the assets of the policy.
  *
+ * The assets are compiled in parallel across a pool of workers sized by the available
+ * hardware concurrency, as each build is independent until the graph is assembled.
+ *
  * @param data Policy data.
  * @param store The store interface to query assets and namespaces.
  * @param assetBuilder The asset builder instance to build each asset.
@@ -378,6 +381,25 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
     return root;
 }
 
+/**
+ * @brief Share structurally identical check terms across the policy expression.
+ *
+ * Sibling assets frequently repeat the same parent checks (same field comparison, same
+ * prefix parse). Terms built for the check stage carry a structural name (target field,
+ * helper and arguments), so two check terms with the same name compute the same
+ * condition. Every group of duplicated terms is replaced in place by a single shared
+ * term whose result is memoized per event, so the condition is computed once per event
+ * no matter how many candidate assets repeat it.
+ *
+ * Only direct term operands of a check stage are shared: filter helpers do not modify
+ * the event, so replaying the memoized result is equivalent to re-evaluating the term.
+ *
+ * @param expression Policy expression, modified in place.
+ *
+ * @return std::size_t Number of duplicated terms replaced by a shared one.
+ */
+std::size_t shareCheckTerms(const base::Expression& expression);
+
 /**
  * @brief Generates the expression of the policy from the policy graph and the policy data.
  *
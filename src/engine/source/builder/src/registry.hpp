@@ -1,7 +1,10 @@
 #ifndef _BUILDER2_REGISTRY_HPP
 #define _BUILDER2_REGISTRY_HPP
 
+#include <functional>
+#include <limits>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -14,7 +17,23 @@ template<typename Builder>
 class Registry : public IRegistry<Builder>
 {
 private:
-    std::unordered_map<std::string, Builder> m_registry; ///< Registry of builders
+    constexpr static std::size_t EMPTY_SLOT = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief Entry of the frozen dispatch table, the name hash is precomputed once.
+     */
+    struct FrozenEntry
+    {
+        std::size_t hash;  ///< Precomputed hash of the name
+        std::string name;  ///< Name of the builder
+        Builder builder;   ///< The builder
+    };
+
+    std::unordered_map<std::string, Builder> m_registry; ///< Registry of builders, until frozen
+
+    std::vector<FrozenEntry> m_entries; ///< Frozen entries, contiguous
+    std::vector<std::size_t> m_index;   ///< Open addressing probe table, power of two sized
+    bool m_frozen {false};              ///< Whether the dispatch table is frozen
 
 public:
     Registry() = default;
@@ -24,6 +43,11 @@ public:
      */
     inline base::OptError add(const std::string& name, const Builder& entry) override
     {
+        if (m_frozen)
+        {
+            return base::Error {fmt::format("Cannot register builder '{}', the registry is frozen", name)};
+        }
+
         if (m_registry.find(name) != m_registry.end())
         {
             return base::Error {fmt::format("Builder '{}' already registered", name)};
@@ -38,6 +62,28 @@ public:
      */
     inline base::RespOrError<Builder> get(const std::string& name) const override
     {
+        if (m_frozen)
+        {
+            const auto hash = std::hash<std::string> {}(name);
+            const auto mask = m_index.size() - 1;
+            for (auto slot = hash & mask;; slot = (slot + 1) & mask)
+            {
+                const auto entryIdx = m_index[slot];
+                if (EMPTY_SLOT == entryIdx)
+                {
+                    break;
+                }
+
+                const auto& entry = m_entries[entryIdx];
+                if (entry.hash == hash && entry.name == name)
+                {
+                    return entry.builder;
+                }
+            }
+
+            return base::Error {fmt::format("Builder '{}' not registered", name)};
+        }
+
         auto it = m_registry.find(name);
         if (it == m_registry.end())
         {
@@ -46,6 +92,50 @@ public:
 
         return it->second;
     }
+
+    /**
+     * @brief Freeze the registry into a fixed open addressing dispatch table.
+     *
+     * The table is generated from the registered set once registration is complete:
+     * entries are stored contiguously with their name hash precomputed, and the probe
+     * table is kept at most half full, so a lookup resolves with one hash computation
+     * and usually a single probe, without bucket chains or rehashing. Registration is
+     * rejected after freezing.
+     */
+    void freeze() override
+    {
+        if (m_frozen)
+        {
+            return;
+        }
+
+        m_entries.reserve(m_registry.size());
+        for (auto& [name, builder] : m_registry)
+        {
+            m_entries.emplace_back(FrozenEntry {std::hash<std::string> {}(name), name, std::move(builder)});
+        }
+        m_registry.clear();
+
+        std::size_t capacity = 1;
+        while (capacity < m_entries.size() * 2)
+        {
+            capacity <<= 1;
+        }
+
+        m_index.assign(capacity, EMPTY_SLOT);
+        const auto mask = capacity - 1;
+        for (std::size_t i = 0; i < m_entries.size(); ++i)
+        {
+            auto slot = m_entries[i].hash & mask;
+            while (m_index[slot] != EMPTY_SLOT)
+            {
+                slot = (slot + 1) & mask;
+            }
+            m_index[slot] = i;
+        }
+
+        m_frozen = true;
+    }
 };
 
 } // namespace builder
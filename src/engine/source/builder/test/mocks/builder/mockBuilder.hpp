@@ -11,6 +11,7 @@ class MockBuilder : public IBuilder
 {
 public:
     MOCK_METHOD(std::shared_ptr<IPolicy>, buildPolicy, (const base::Name& name), (const, override));
+    MOCK_METHOD(std::string, getPolicyHash, (const base::Name& name), (const, override));
     MOCK_METHOD(base::Expression, buildAsset, (const base::Name& name), (const, override));
 };
 } // namespace builder::mocks
@@ -31,10 +31,22 @@ auto typeRef(schemf::Type sType)
     {
         EXPECT_CALL(*mocks.ctx, validator()).Times(testing::AtLeast(1));
         EXPECT_CALL(*mocks.validator, hasField(DotPath("ref"))).WillOnce(testing::Return(true));
+        EXPECT_CALL(*mocks.validator, hasField(DotPath("targetField"))).WillRepeatedly(testing::Return(false));
         EXPECT_CALL(*mocks.validator, getType(DotPath("ref"))).WillRepeatedly(testing::Return(sType));
         return None {};
     };
 }
+
+auto typeTarget(json::Json::Type jType)
+{
+    return [=](const BuildersMocks& mocks)
+    {
+        EXPECT_CALL(*mocks.ctx, validator()).Times(testing::AtLeast(1));
+        EXPECT_CALL(*mocks.validator, hasField(DotPath("targetField"))).WillOnce(testing::Return(true));
+        EXPECT_CALL(*mocks.validator, getJsonType(DotPath("targetField"))).WillRepeatedly(testing::Return(jType));
+        return None {};
+    };
+}
 } // namespace
 
 namespace filterbuildtest
@@ -62,14 +74,17 @@ INSTANTIATE_TEST_SUITE_P(
         FilterT({makeValue("1")}, opfilter::opBuilderHelperMatchKey, FAILURE()),
         FilterT({makeValue(R"("str")")}, opfilter::opBuilderHelperMatchKey, FAILURE()),
         FilterT({makeValue(R"([])")}, opfilter::opBuilderHelperMatchKey, FAILURE()),
-        FilterT({makeValue(R"({})")}, opfilter::opBuilderHelperMatchKey, SUCCESS()),
+        FilterT({makeValue(R"({})")}, opfilter::opBuilderHelperMatchKey, SUCCESS(customRef())),
         FilterT({makeValue(R"({})"), makeValue(R"({})")}, opfilter::opBuilderHelperMatchKey, FAILURE()),
         FilterT({makeValue("null")}, opfilter::opBuilderHelperMatchKey, FAILURE()),
         FilterT({makeRef("ref")}, opfilter::opBuilderHelperMatchKey, SUCCESS(customRef())),
         FilterT({makeRef("ref"), makeRef("ref")}, opfilter::opBuilderHelperMatchKey, FAILURE()),
         FilterT({makeRef("ref")}, opfilter::opBuilderHelperMatchKey, SUCCESS(typeRef(schemf::Type::OBJECT))),
         FilterT({makeRef("ref")}, opfilter::opBuilderHelperMatchKey, FAILURE(typeRef(schemf::Type::TEXT))),
-        FilterT({makeRef("ref")}, opfilter::opBuilderHelperMatchKey, FAILURE(typeRef(schemf::Type::DOUBLE)))),
+        FilterT({makeRef("ref")}, opfilter::opBuilderHelperMatchKey, FAILURE(typeRef(schemf::Type::DOUBLE))),
+        FilterT({makeValue(R"({})")}, opfilter::opBuilderHelperMatchKey, SUCCESS(typeTarget(json::Json::Type::String))),
+        FilterT({makeValue(R"({})")}, opfilter::opBuilderHelperMatchKey, FAILURE(typeTarget(json::Json::Type::Number))),
+        FilterT({makeValue(R"({})")}, opfilter::opBuilderHelperMatchKey, FAILURE(typeTarget(json::Json::Type::Object)))),
     testNameFormatter<FilterBuilderTest>("Match"));
 } // namespace filterbuildtest
 
@@ -172,27 +187,27 @@ INSTANTIATE_TEST_SUITE_P(
                 opfilter::opBuilderHelperMatchKey,
                 "target",
                 {makeValue(R"({"key": "value"})")},
-                SUCCESS()),
+                SUCCESS(customRef())),
         FilterT(R"({"target": "key"})",
                 opfilter::opBuilderHelperMatchKey,
                 "target",
                 {makeValue(R"({"k": "v", "key": "value"})")},
-                SUCCESS()),
+                SUCCESS(customRef())),
         FilterT(R"({"target": "key"})",
                 opfilter::opBuilderHelperMatchKey,
                 "target",
                 {makeValue(R"({"k0": "v0", "k1": "v1", "key": "value"})")},
-                SUCCESS()),
+                SUCCESS(customRef())),
         FilterT(R"({"target": "key"})",
                 opfilter::opBuilderHelperMatchKey,
                 "target",
                 {makeValue(R"({"k0": "v0", "k1": "v1", "k2": "v2"})")},
-                FAILURE()),
+                FAILURE(customRef())),
         FilterT(R"({"target": "key"})",
                 opfilter::opBuilderHelperMatchKey,
                 "notTarget",
                 {makeValue(R"({"key": "value"})")},
-                FAILURE()),
+                FAILURE(customRef())),
         FilterT(R"({"target": "key", "ref": {"key": "value"}})",
                 opfilter::opBuilderHelperMatchKey,
                 "target",
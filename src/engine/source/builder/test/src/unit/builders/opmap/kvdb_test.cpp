@@ -209,6 +209,23 @@ auto expectKvdbGetError(const std::string& key)
     };
 }
 
+auto expectKvdbMultiGet(const std::vector<std::string>& keys,
+                        const std::list<std::pair<std::string, std::string>>& content)
+{
+    return [=](const std::shared_ptr<MockKVDBHandler>& handler)
+    {
+        EXPECT_CALL(*handler, multiGet(keys)).WillOnce(testing::Return(content));
+    };
+}
+
+auto expectKvdbMultiGetError(const std::vector<std::string>& keys)
+{
+    return [=](const std::shared_ptr<MockKVDBHandler>& handler)
+    {
+        EXPECT_CALL(*handler, multiGet(keys)).WillOnce(testing::Return(base::Error {"error"}));
+    };
+}
+
 auto expectKvdbSet(const std::string& key, const std::string& jValue)
 {
     json::Json value {jValue.c_str()};
@@ -518,6 +535,57 @@ INSTANTIATE_TEST_SUITE_P(
         TransformDepsT({makeValue(R"("dbname")"), makeValue(R"(["k0", "k1"])")},
                        getTrBuilderExpectHandlerError(getOpBuilderKVDBGetArray, "dbname"),
                        FAILURE()),
+        /*** GET BATCH ***/
+        TransformDepsT({}, getTrBuilder(getOpBuilderKVDBGetBatch), FAILURE()),
+        TransformDepsT({makeValue(R"("dbname")")}, getTrBuilder(getOpBuilderKVDBGetBatch), FAILURE()),
+        TransformDepsT({makeValue(R"("dbname")"), makeValue(R"(["k0", "k1"])")},
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch, "dbname"),
+                       SUCCESS(customRefExpected("targetField"))),
+        TransformDepsT({makeValue(R"("dbname")"), makeRef("ref")},
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch, "dbname"),
+                       SUCCESS(customRefExpected("ref", "targetField"))),
+        TransformDepsT({makeValue(R"(1)"), makeValue(R"(["k0", "k1"])")},
+                       getTrBuilder(getOpBuilderKVDBGetBatch),
+                       FAILURE()),
+        TransformDepsT({makeValue(R"("dbname")"), makeValue(R"(["k0", "k1"])"), makeValue(R"("other")")},
+                       getTrBuilder(getOpBuilderKVDBGetBatch),
+                       FAILURE()),
+        TransformDepsT({makeValue(R"("dbname")"), makeValue(R"("not an array")")},
+                       getTrBuilder(getOpBuilderKVDBGetBatch),
+                       FAILURE()),
+        TransformDepsT({makeValue(R"("dbname")"), makeRef("ref")},
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch, "dbname"),
+                       SUCCESS(
+                           [](const BuildersMocks& mocks)
+                           {
+                               jTypeRefExpected("ref", json::Json::Type::String)(mocks);
+                               EXPECT_CALL(*mocks.validator, isArray(DotPath("ref"))).WillOnce(testing::Return(true));
+                               EXPECT_CALL(*mocks.validator, hasField(DotPath("targetField")))
+                                   .WillOnce(testing::Return(false));
+                               return None {};
+                           })),
+        TransformDepsT({makeValue(R"("dbname")"), makeRef("ref")},
+                       getTrBuilder(getOpBuilderKVDBGetBatch),
+                       FAILURE(
+                           [](const BuildersMocks& mocks)
+                           {
+                               EXPECT_CALL(*mocks.validator, isArray(DotPath("ref"))).WillOnce(testing::Return(true));
+                               jTypeRefExpected("ref", json::Json::Type::Number)(mocks);
+                               return None {};
+                           })),
+        TransformDepsT({makeValue(R"("dbname")"), makeRef("ref")},
+                       getTrBuilder(getOpBuilderKVDBGetBatch),
+                       FAILURE(
+                           [](const BuildersMocks& mocks)
+                           {
+                               EXPECT_CALL(*mocks.ctx, validator()).Times(testing::AtLeast(1));
+                               EXPECT_CALL(*mocks.validator, hasField(DotPath("ref"))).WillOnce(testing::Return(true));
+                               EXPECT_CALL(*mocks.validator, isArray(DotPath("ref"))).WillOnce(testing::Return(false));
+                               return None {};
+                           })),
+        TransformDepsT({makeValue(R"("dbname")"), makeValue(R"(["k0", "k1"])")},
+                       getTrBuilderExpectHandlerError(getOpBuilderKVDBGetBatch, "dbname"),
+                       FAILURE()),
         /*** BITMASK TO TABLE ***/
         TransformDepsT({}, getTrBuilder(getOpBuilderHelperKVDBDecodeBitmask), FAILURE()),
         TransformDepsT({makeValue(R"("dbname")")}, getTrBuilder(getOpBuilderHelperKVDBDecodeBitmask), FAILURE()),
@@ -955,6 +1023,81 @@ INSTANTIATE_TEST_SUITE_P(
                        "target",
                        {makeValue(R"("dbname")"), makeValue(R"(["k0", "k1"])")},
                        FAILURE()),
+        /*** GET BATCH ***/
+        TransformDepsT(R"({})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch,
+                                                 "dbname",
+                                                 expectKvdbMultiGet({"k0", "k1"},
+                                                                    {{"k0", R"("v0")"}, {"k1", R"("v1")"}})),
+                       "target",
+                       {makeValue(R"("dbname")"), makeValue(R"(["k0", "k1"])")},
+                       SUCCESS(
+                           [](const BuildersMocks& mocks)
+                           {
+                               customRefExpected("target")(mocks);
+                               return makeEvent(R"({"target": {"k0": "v0", "k1": "v1"}})");
+                           })),
+        TransformDepsT(R"({"ref": ["k0", "k1"]})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch,
+                                                 "dbname",
+                                                 expectKvdbMultiGet({"k0", "k1"},
+                                                                    {{"k0", R"("v0")"}, {"k1", R"("v1")"}})),
+                       "target",
+                       {makeValue(R"("dbname")"), makeRef("ref")},
+                       SUCCESS(
+                           [](const BuildersMocks& mocks)
+                           {
+                               customRefExpected("ref", "target")(mocks);
+                               return makeEvent(R"({"ref": ["k0", "k1"], "target": {"k0": "v0", "k1": "v1"}})");
+                           })),
+        TransformDepsT(R"({"ref": ["k0", "k1"]})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch,
+                                                 "dbname",
+                                                 expectKvdbMultiGet({"k0", "k1"}, {{"k1", R"("v1")"}})),
+                       "target",
+                       {makeValue(R"("dbname")"), makeRef("ref")},
+                       SUCCESS(
+                           [](const BuildersMocks& mocks)
+                           {
+                               customRefExpected("ref", "target")(mocks);
+                               return makeEvent(R"({"ref": ["k0", "k1"], "target": {"k1": "v1"}})");
+                           })),
+        TransformDepsT(R"({"ref": ["k0"]})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch,
+                                                 "dbname",
+                                                 expectKvdbMultiGet({"k0"}, {})),
+                       "target",
+                       {makeValue(R"("dbname")"), makeRef("ref")},
+                       FAILURE(customRefExpected("ref", "target"))),
+        TransformDepsT(R"({})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch, "dbname"),
+                       "target",
+                       {makeValue(R"("dbname")"), makeRef("ref")},
+                       FAILURE(customRefExpected("ref", "target"))),
+        TransformDepsT(R"({"ref": "notArray"})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch, "dbname"),
+                       "target",
+                       {makeValue(R"("dbname")"), makeRef("ref")},
+                       FAILURE(customRefExpected("ref", "target"))),
+        TransformDepsT(R"({"ref": ["k0", 1]})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch, "dbname"),
+                       "target",
+                       {makeValue(R"("dbname")"), makeRef("ref")},
+                       FAILURE(customRefExpected("ref", "target"))),
+        TransformDepsT(R"({"ref": ["k0"]})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch,
+                                                 "dbname",
+                                                 expectKvdbMultiGetError({"k0"})),
+                       "target",
+                       {makeValue(R"("dbname")"), makeRef("ref")},
+                       FAILURE(customRefExpected("ref", "target"))),
+        TransformDepsT(R"({"ref": ["k0"]})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetBatch,
+                                                 "dbname",
+                                                 expectKvdbMultiGet({"k0"}, {{"k0", R"(malformed"json)"}})),
+                       "target",
+                       {makeValue(R"("dbname")"), makeRef("ref")},
+                       FAILURE(customRefExpected("ref", "target"))),
         /*** BITMASK TO TABLE ***/
         TransformDepsT(R"({"ref": "0x1"})",
                        getTrBuilderExpectHandler(getOpBuilderHelperKVDBDecodeBitmask,
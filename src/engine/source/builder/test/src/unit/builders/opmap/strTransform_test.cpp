@@ -45,6 +45,28 @@ auto jTypeRefExpected(json::Json::Type jType)
     };
 }
 
+auto schemaRefExpected(schemf::Type sType)
+{
+    return [=](const BuildersMocks& mocks)
+    {
+        EXPECT_CALL(*mocks.ctx, validator()).Times(testing::AtLeast(1));
+        EXPECT_CALL(*mocks.validator, hasField(DotPath("ref"))).WillOnce(testing::Return(true));
+        EXPECT_CALL(*mocks.validator, getType(DotPath("ref"))).WillOnce(testing::Return(sType));
+        return None {};
+    };
+}
+
+auto schemaRefExpected(schemf::Type sType, json::Json jValue)
+{
+    return [=](const BuildersMocks& mocks)
+    {
+        EXPECT_CALL(*mocks.ctx, validator()).Times(testing::AtLeast(1));
+        EXPECT_CALL(*mocks.validator, hasField(DotPath("ref"))).WillOnce(testing::Return(true));
+        EXPECT_CALL(*mocks.validator, getType(DotPath("ref"))).WillOnce(testing::Return(sType));
+        return jValue;
+    };
+}
+
 auto jTypeArrayRefExpected(json::Json::Type jType, bool isArray)
 {
     return [=](const BuildersMocks& mocks)
@@ -69,9 +91,15 @@ INSTANTIATE_TEST_SUITE_P(
     MapBuilderTest,
     testing::Values(
         /*** To String ***/
-        MapT({makeRef("ref")}, opBuilderHelperNumberToString, SUCCESS()),
+        MapT({makeRef("ref")}, opBuilderHelperNumberToString, SUCCESS(customRefExpected())),
         MapT({makeRef("ref"), makeRef("ref")}, opBuilderHelperNumberToString, FAILURE()),
         MapT({makeValue(R"("value")")}, opBuilderHelperNumberToString, FAILURE()),
+        MapT({makeRef("ref")}, opBuilderHelperNumberToString, SUCCESS(schemaRefExpected(schemf::Type::INTEGER))),
+        MapT({makeRef("ref")}, opBuilderHelperNumberToString, SUCCESS(schemaRefExpected(schemf::Type::LONG))),
+        MapT({makeRef("ref")}, opBuilderHelperNumberToString, SUCCESS(schemaRefExpected(schemf::Type::FLOAT))),
+        MapT({makeRef("ref")}, opBuilderHelperNumberToString, SUCCESS(schemaRefExpected(schemf::Type::DOUBLE))),
+        MapT({makeRef("ref")}, opBuilderHelperNumberToString, FAILURE(schemaRefExpected(schemf::Type::KEYWORD))),
+        MapT({makeRef("ref")}, opBuilderHelperNumberToString, FAILURE(schemaRefExpected(schemf::Type::BOOLEAN))),
         /*** To Upper ***/
         MapT({}, opBuilderHelperStringUP, FAILURE()),
         MapT({makeValue(R"("value")")}, opBuilderHelperStringUP, SUCCESS()),
@@ -199,19 +227,40 @@ INSTANTIATE_TEST_SUITE_P(
     MapOperationTest,
     testing::Values(
         /*** To String ***/
-        MapT(R"({})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE()),
-        MapT(R"({"notRef": "value"})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE()),
-        MapT(R"({"ref": 1})", opBuilderHelperNumberToString, {makeRef("ref")}, SUCCESS(json::Json(R"("1")"))),
+        MapT(R"({})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"notRef": "value"})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": 1})",
+             opBuilderHelperNumberToString,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json(R"("1")")))),
         MapT(R"({"ref": 2.33875648})",
              opBuilderHelperNumberToString,
              {makeRef("ref")},
-             SUCCESS(json::Json(R"("2.338756")"))),
-        MapT(R"({"ref": 2.35})", opBuilderHelperNumberToString, {makeRef("ref")}, SUCCESS(json::Json(R"("2.350000")"))),
-        MapT(R"({"ref": "hello"})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE()),
-        MapT(R"({"ref": true})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE()),
-        MapT(R"({"ref": [1, 2, 3]})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE()),
-        MapT(R"({"ref": {"a": 1, "b": 2}})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE()),
-        MapT(R"({"ref": null})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE()),
+             SUCCESS(customRefExpected(json::Json(R"("2.338756")")))),
+        MapT(R"({"ref": 2.35})",
+             opBuilderHelperNumberToString,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json(R"("2.350000")")))),
+        MapT(R"({"ref": "hello"})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": true})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": [1, 2, 3]})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": {"a": 1, "b": 2}})",
+             opBuilderHelperNumberToString,
+             {makeRef("ref")},
+             FAILURE(customRefExpected())),
+        MapT(R"({"ref": null})", opBuilderHelperNumberToString, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": 7})",
+             opBuilderHelperNumberToString,
+             {makeRef("ref")},
+             SUCCESS(schemaRefExpected(schemf::Type::LONG, json::Json(R"("7")")))),
+        MapT(R"({"ref": 2.5})",
+             opBuilderHelperNumberToString,
+             {makeRef("ref")},
+             SUCCESS(schemaRefExpected(schemf::Type::DOUBLE, json::Json(R"("2.500000")")))),
+        MapT(R"({"ref": "hello"})",
+             opBuilderHelperNumberToString,
+             {makeRef("ref")},
+             FAILURE(schemaRefExpected(schemf::Type::LONG))),
         /*** To Upper ***/
         MapT("{}", opBuilderHelperStringUP, {makeValue(R"("value")")}, SUCCESS(json::Json(R"("VALUE")"))),
         MapT("{}", opBuilderHelperStringUP, {makeValue(R"("VALUE")")}, SUCCESS(json::Json(R"("VALUE")"))),
@@ -28,6 +28,14 @@ namespace
 {
 const Reference targetField {"wdb.result"};
 const std::vector<OpArg> commonArguments {makeRef("event.original"), makeRef("agent.id")};
+
+using PipelinedRes = std::vector<QueryRes>;
+
+/// @brief Build a pipelined exchange result with `count` OK responses.
+PipelinedRes okPipelinedRes(const std::size_t count)
+{
+    return PipelinedRes(count, okQueryRes());
+}
 } // namespace
 
 class opBuilderSCAdecoder_Functions : public ::testing::Test
@@ -1612,8 +1620,10 @@ TEST_F(checkTypeDecoderSCA, FindEventcheckOkFoundWithoutComplianceNorRules)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("found check")));
-    EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca update 911|Some Result||404"), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+    EXPECT_CALL(*wdb,
+                tryQueryAndParseResultPipelined(testing::ElementsAre("agent 007 sca update 911|Some Result||404"),
+                                                testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(1)));
 
     result::Result<Event> result {op(event)};
 
@@ -1644,8 +1654,10 @@ TEST_F(checkTypeDecoderSCA, FindEventcheckOkFoundWithResultEqualResponse)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("found Some Result")));
-    EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca update 911|Some Result||404"), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+    EXPECT_CALL(*wdb,
+                tryQueryAndParseResultPipelined(testing::ElementsAre("agent 007 sca update 911|Some Result||404"),
+                                                testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(1)));
 
     result::Result<Event> result {op(event)};
 
@@ -1691,9 +1703,11 @@ TEST_F(checkTypeDecoderSCA, FindEventcheckOkFoundWithoutResult)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("found ")));
-    EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca update 911||Could not open file|404"), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+    EXPECT_CALL(
+        *wdb,
+        tryQueryAndParseResultPipelined(testing::ElementsAre("agent 007 sca update 911||Could not open file|404"),
+                                        testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(1)));
 
     result::Result<Event> result {op(event)};
 
@@ -1714,11 +1728,11 @@ TEST_F(checkTypeDecoderSCA, FindEventcheckOkNotFoundWithoutComplianceNorRules)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("not found")));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(
-            testing::StrEq("agent 007 sca insert " + event->str("/event/original").value_or("error")), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+    EXPECT_CALL(*wdb,
+                tryQueryAndParseResultPipelined(
+                    testing::ElementsAre("agent 007 sca insert " + event->str("/event/original").value_or("error")),
+                    testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(1)));
 
     result::Result<Event> result {op(event)};
 
@@ -1771,14 +1785,12 @@ TEST_F(checkTypeDecoderSCA, SaveACompliance)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("not found")));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(
-            testing::StrEq("agent 007 sca insert " + event->str("/event/original").value_or("error")), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
     EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_compliance 911|keyI|valueI"), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+                tryQueryAndParseResultPipelined(
+                    testing::ElementsAre("agent 007 sca insert " + event->str("/event/original").value_or("error"),
+                                         "agent 007 sca insert_compliance 911|keyI|valueI"),
+                    testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(2)));
 
     result::Result<Event> result {op(event)};
 
@@ -1839,19 +1851,14 @@ TEST_F(checkTypeDecoderSCA, SaveCompliances)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("not found")));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(
-            testing::StrEq("agent 007 sca insert " + event->str("/event/original").value_or("error")), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
-    EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_compliance 911|keyI|valueI"), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
-    EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_compliance 911|keyII|2"), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
     EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_compliance 911|keyIII|3.0"), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+                tryQueryAndParseResultPipelined(
+                    testing::ElementsAre("agent 007 sca insert " + event->str("/event/original").value_or("error"),
+                                         "agent 007 sca insert_compliance 911|keyI|valueI",
+                                         "agent 007 sca insert_compliance 911|keyII|2",
+                                         "agent 007 sca insert_compliance 911|keyIII|3.0"),
+                    testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(4)));
 
     result::Result<Event> result {op(event)};
 
@@ -1897,15 +1904,12 @@ TEST_F(checkTypeDecoderSCA, SaveFileRule)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("not found")));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(
-            testing::StrEq("agent 007 sca insert " + event->str("/event/original").value_or("error")), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|file|f:some_file_rule"), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+    EXPECT_CALL(*wdb,
+                tryQueryAndParseResultPipelined(
+                    testing::ElementsAre("agent 007 sca insert " + event->str("/event/original").value_or("error"),
+                                         "agent 007 sca insert_rules 911|file|f:some_file_rule"),
+                    testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(2)));
 
     result::Result<Event> result {op(event)};
 
@@ -1951,15 +1955,12 @@ TEST_F(checkTypeDecoderSCA, SaveDirectoryRule)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("not found")));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(
-            testing::StrEq("agent 007 sca insert " + event->str("/event/original").value_or("error")), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
     EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|directory|d:some_directory_rule"),
-                                       testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+                tryQueryAndParseResultPipelined(
+                    testing::ElementsAre("agent 007 sca insert " + event->str("/event/original").value_or("error"),
+                                         "agent 007 sca insert_rules 911|directory|d:some_directory_rule"),
+                    testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(2)));
 
     result::Result<Event> result {op(event)};
 
@@ -2005,15 +2006,12 @@ TEST_F(checkTypeDecoderSCA, SaveRegistryRule)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("not found")));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(
-            testing::StrEq("agent 007 sca insert " + event->str("/event/original").value_or("error")), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
     EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|registry|r:some_registry_rule"),
-                                       testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+                tryQueryAndParseResultPipelined(
+                    testing::ElementsAre("agent 007 sca insert " + event->str("/event/original").value_or("error"),
+                                         "agent 007 sca insert_rules 911|registry|r:some_registry_rule"),
+                    testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(2)));
 
     result::Result<Event> result {op(event)};
 
@@ -2059,15 +2057,12 @@ TEST_F(checkTypeDecoderSCA, SaveCommandRule)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("not found")));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(
-            testing::StrEq("agent 007 sca insert " + event->str("/event/original").value_or("error")), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
     EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|command|c:some_command_rule"),
-                                       testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+                tryQueryAndParseResultPipelined(
+                    testing::ElementsAre("agent 007 sca insert " + event->str("/event/original").value_or("error"),
+                                         "agent 007 sca insert_rules 911|command|c:some_command_rule"),
+                    testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(2)));
 
     result::Result<Event> result {op(event)};
 
@@ -2113,15 +2108,12 @@ TEST_F(checkTypeDecoderSCA, SaveProcessRule)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("not found")));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(
-            testing::StrEq("agent 007 sca insert " + event->str("/event/original").value_or("error")), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
     EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|process|p:some_process_rule"),
-                                       testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+                tryQueryAndParseResultPipelined(
+                    testing::ElementsAre("agent 007 sca insert " + event->str("/event/original").value_or("error"),
+                                         "agent 007 sca insert_rules 911|process|p:some_process_rule"),
+                    testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(2)));
 
     result::Result<Event> result {op(event)};
 
@@ -2167,15 +2159,12 @@ TEST_F(checkTypeDecoderSCA, SaveNumericRule)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("not found")));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(
-            testing::StrEq("agent 007 sca insert " + event->str("/event/original").value_or("error")), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
     EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|numeric|n:some_numeric_rule"),
-                                       testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+                tryQueryAndParseResultPipelined(
+                    testing::ElementsAre("agent 007 sca insert " + event->str("/event/original").value_or("error"),
+                                         "agent 007 sca insert_rules 911|numeric|n:some_numeric_rule"),
+                    testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(2)));
 
     result::Result<Event> result {op(event)};
 
@@ -2323,11 +2312,11 @@ TEST_F(checkTypeDecoderSCA, InvalidRules)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("not found")));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(
-            testing::StrEq("agent 007 sca insert " + event->str("/event/original").value_or("error")), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+    EXPECT_CALL(*wdb,
+                tryQueryAndParseResultPipelined(
+                    testing::ElementsAre("agent 007 sca insert " + event->str("/event/original").value_or("error")),
+                    testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(1)));
 
     result::Result<Event> result {op(event)};
 
@@ -2378,35 +2367,17 @@ TEST_F(checkTypeDecoderSCA, SaveRules)
 
     EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
         .WillOnce(testing::Return(okQueryRes("not found")));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(
-            testing::StrEq("agent 007 sca insert " + event->str("/event/original").value_or("error")), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
-    EXPECT_CALL(
-        *wdb,
-        tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|file|f:some_file_rule"), testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
-    EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|directory|d:some_directory_rule"),
-                                       testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
-    EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|registry|r:some_registry_rule"),
-                                       testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
-    EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|command|c:some_command_rule"),
-                                       testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
     EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|process|p:some_process_rule"),
-                                       testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
-    EXPECT_CALL(*wdb,
-                tryQueryAndParseResult(testing::StrEq("agent 007 sca insert_rules 911|numeric|n:some_numeric_rule"),
-                                       testing::_))
-        .WillOnce(testing::Return(okQueryRes()));
+                tryQueryAndParseResultPipelined(
+                    testing::ElementsAre("agent 007 sca insert " + event->str("/event/original").value_or("error"),
+                                         "agent 007 sca insert_rules 911|file|f:some_file_rule",
+                                         "agent 007 sca insert_rules 911|directory|d:some_directory_rule",
+                                         "agent 007 sca insert_rules 911|registry|r:some_registry_rule",
+                                         "agent 007 sca insert_rules 911|command|c:some_command_rule",
+                                         "agent 007 sca insert_rules 911|process|p:some_process_rule",
+                                         "agent 007 sca insert_rules 911|numeric|n:some_numeric_rule"),
+                    testing::_))
+        .WillOnce(testing::Return(okPipelinedRes(7)));
 
     result::Result<Event> result {op(event)};
 
@@ -0,0 +1,28 @@
+#include <gtest/gtest.h>
+
+#include "builders/regexCache.hpp"
+
+using namespace builder::builders;
+
+TEST(RegexCacheTest, SamePatternSharesCompiledRegex)
+{
+    auto first = utils::getCompiledRegex("^\\d+$");
+    auto second = utils::getCompiledRegex("^\\d+$");
+
+    ASSERT_EQ(first.get(), second.get());
+    ASSERT_TRUE(first->ok());
+    ASSERT_TRUE(RE2::PartialMatch("12345", *first));
+}
+
+TEST(RegexCacheTest, DifferentPatternsCompileSeparately)
+{
+    auto digits = utils::getCompiledRegex("^\\d+$");
+    auto alpha = utils::getCompiledRegex("^[a-z]+$");
+
+    ASSERT_NE(digits.get(), alpha.get());
+}
+
+TEST(RegexCacheTest, InvalidPatternThrows)
+{
+    ASSERT_THROW(utils::getCompiledRegex("(unclosed"), std::runtime_error);
+}
@@ -110,4 +110,46 @@ TEST_F(FileOutputTest, Write)
 
     ASSERT_EQ(buffer.str(), compact_message);
 }
+
+using builder::builders::detail::BatchedFileOutput;
+
+TEST_F(FileOutputTest, BatchedWriteDrainsOnDestruction)
+{
+    auto msg = std::make_shared<json::Json>(messageStr);
+    {
+        auto output = BatchedFileOutput(FILE_PATH);
+        ASSERT_NO_THROW(output.write(msg));
+        ASSERT_NO_THROW(output.write(msg));
+    }
+
+    std::ifstream ifs(FILE_PATH);
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+
+    ASSERT_EQ(buffer.str(), std::string {compact_message} + compact_message);
+}
+
+TEST_F(FileOutputTest, BatchedWriteFlushesWhenBatchSizeIsReached)
+{
+    auto msg = std::make_shared<json::Json>(messageStr);
+    // Batch size of one byte, every write triggers a flush without waiting the interval
+    auto output = BatchedFileOutput(FILE_PATH, 1, std::chrono::minutes(1), true);
+    ASSERT_NO_THROW(output.write(msg));
+
+    // Wait for the writer thread to do the I/O
+    std::stringstream buffer;
+    for (int i = 0; i < 100; ++i)
+    {
+        std::ifstream ifs(FILE_PATH);
+        buffer.str("");
+        buffer << ifs.rdbuf();
+        if (!buffer.str().empty())
+        {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_EQ(buffer.str(), compact_message);
+}
 } // namespace fileoutputtest
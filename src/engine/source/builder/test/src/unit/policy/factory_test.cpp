@@ -2,6 +2,7 @@
 
 #include <sstream>
 
+#include <base/baseTypes.hpp>
 #include <base/behaviour.hpp>
 #include <store/mockStore.hpp>
 
@@ -313,12 +314,9 @@ INSTANTIATE_TEST_SUITE_P(
                       const std::shared_ptr<MockAssetBuilder>& assetBuilder)
                    {
                        store::Doc asset;
-                       EXPECT_CALL(*store, readDoc(testing::_))
-                           .WillOnce(testing::Return(storeReadDocResp(asset)))
-                           .WillOnce(testing::Return(storeReadDocResp(asset)));
+                       EXPECT_CALL(*store, readDoc(testing::_)).WillRepeatedly(testing::Return(storeReadDocResp(asset)));
                        EXPECT_CALL(*assetBuilder, CallableOp(asset))
-                           .WillOnce(testing::Return(Asset {}))
-                           .WillOnce(testing::Throw(std::runtime_error("")));
+                           .WillRepeatedly(testing::Throw(std::runtime_error("")));
 
                        return None {};
                    })),
@@ -342,14 +340,15 @@ INSTANTIATE_TEST_SUITE_P(
                    [](const std::shared_ptr<MockStoreRead>& store,
                       const std::shared_ptr<MockAssetBuilder>& assetBuilder)
                    {
+                       // Documents are fetched before any build, so the asset builder is
+                       // never reached when a read fails. Subgraph order is not
+                       // guaranteed, the successful read may not happen.
                        store::Doc asset;
                        EXPECT_CALL(*store, readDoc(base::Name("decoder/asset")))
-                           .WillOnce(testing::Return(storeReadDocResp(asset)));
+                           .WillRepeatedly(testing::Return(storeReadDocResp(asset)));
                        EXPECT_CALL(*store, readDoc(base::Name("rule/asset")))
                            .WillOnce(testing::Throw(std::runtime_error("")));
 
-                       EXPECT_CALL(*assetBuilder, CallableOp(asset)).WillOnce(testing::Return(Asset {}));
-
                        return None {};
                    }))
 
@@ -801,3 +800,62 @@ INSTANTIATE_TEST_SUITE_P(
             ));
 
 } // namespace buildexpressiontest
+
+namespace sharechecktermstest
+{
+
+TEST(ShareCheckTerms, DuplicatedTermsAreSharedAndMemoized)
+{
+    auto counter = std::make_shared<int>(0);
+    auto makeCheckTerm = [&](const std::string& name)
+    {
+        return base::Term<base::EngineOp>::create(name,
+                                                  [counter](base::Event event) {
+                                                      ++(*counter);
+                                                      return base::result::makeSuccess(event, "");
+                                                  });
+    };
+
+    auto checkA = base::And::create(
+        "stage.check", {makeCheckTerm("event.module: filter(syslog)"), makeCheckTerm("event.other: filter(x)")});
+    auto checkB = base::And::create("stage.check", {makeCheckTerm("event.module: filter(syslog)")});
+    auto assetA = base::And::create("decoder/a/0", {checkA});
+    auto assetB = base::And::create("decoder/b/0", {checkB});
+    auto policy = base::Or::create("policy/test/0", {assetA, assetB});
+
+    std::size_t sharedCount = 0;
+    ASSERT_NO_THROW(sharedCount = factory::shareCheckTerms(policy));
+    ASSERT_EQ(sharedCount, 1);
+
+    // Both slots hold the same shared term, the non duplicated term is left untouched
+    ASSERT_EQ(checkA->getOperands()[0].get(), checkB->getOperands()[0].get());
+    ASSERT_EQ(checkA->getOperands()[1]->getName(), "event.other: filter(x)");
+
+    // The shared condition is computed once per event
+    auto fnA = checkA->getOperands()[0]->getPtr<base::Term<base::EngineOp>>()->getFn();
+    auto fnB = checkB->getOperands()[0]->getPtr<base::Term<base::EngineOp>>()->getFn();
+    auto event = std::make_shared<json::Json>(R"({})");
+    ASSERT_TRUE(fnA(event).success());
+    ASSERT_TRUE(fnB(event).success());
+    ASSERT_EQ(*counter, 1);
+
+    // A different event is evaluated again
+    auto otherEvent = std::make_shared<json::Json>(R"({})");
+    ASSERT_TRUE(fnB(otherEvent).success());
+    ASSERT_EQ(*counter, 2);
+}
+
+TEST(ShareCheckTerms, UniqueTermsAreNotTouched)
+{
+    auto check = base::And::create("stage.check",
+                                   {base::Term<base::EngineOp>::create(
+                                       "event.module: filter(syslog)",
+                                       [](base::Event event) { return base::result::makeSuccess(event, ""); })});
+    auto original = check->getOperands()[0];
+    auto policy = base::Or::create("policy/test/0", {base::And::create("decoder/a/0", {check})});
+
+    ASSERT_EQ(factory::shareCheckTerms(policy), 0);
+    ASSERT_EQ(check->getOperands()[0].get(), original.get());
+}
+
+} // namespace sharechecktermstest
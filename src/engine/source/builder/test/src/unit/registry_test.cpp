@@ -71,6 +71,52 @@ TEST(RegistryTest, MetaRegistry)
     l(metaRegistry);
 }
 
+TEST(RegistryTest, FrozenGet)
+{
+    Registry<int> registry;
+    EXPECT_FALSE(registry.add("test", 1).has_value());
+    EXPECT_FALSE(registry.add("other", 2).has_value());
+    registry.freeze();
+
+    auto resp = registry.get("test");
+    EXPECT_FALSE(base::isError(resp));
+    EXPECT_EQ(base::getResponse<int>(resp), 1);
+
+    resp = registry.get("other");
+    EXPECT_FALSE(base::isError(resp));
+    EXPECT_EQ(base::getResponse<int>(resp), 2);
+
+    EXPECT_TRUE(base::isError(registry.get("miss")));
+}
+
+TEST(RegistryTest, FrozenGetEmpty)
+{
+    Registry<int> registry;
+    registry.freeze();
+    EXPECT_TRUE(base::isError(registry.get("miss")));
+}
+
+TEST(RegistryTest, AddFailFrozen)
+{
+    Registry<int> registry;
+    EXPECT_FALSE(registry.add("test", 1).has_value());
+    registry.freeze();
+    EXPECT_TRUE(registry.add("late", 2).has_value());
+}
+
+TEST(RegistryTest, MetaRegistryFreeze)
+{
+    auto metaRegistry = MetaRegistry<int, std::string>::create<Registry>();
+
+    metaRegistry->add<int>("test", 1);
+    metaRegistry->add<std::string>("test", "test");
+    metaRegistry->freeze();
+
+    ASSERT_EQ(base::getResponse<int>(metaRegistry->get<int>("test")), 1);
+    ASSERT_EQ(base::getResponse<std::string>(metaRegistry->get<std::string>("test")), "test");
+    ASSERT_TRUE(base::isError(metaRegistry->get<int>("miss")));
+}
+
 // Ensure that the mock registry compiles, needs to be instantiated because it's a template
 TEST(RegistryTest, Mock)
 {
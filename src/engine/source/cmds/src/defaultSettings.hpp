@@ -20,12 +20,27 @@ constexpr auto ENGINE_SRV_EVENT_SOCK_ENV = "WZE_EVENT_SOCK";
 constexpr auto ENGINE_SRV_EVENT_QUEUE_TASK = 0;
 constexpr auto ENGINE_SRV_EVENT_QUEUE_TASK_ENV = "WZE_EVENT_QUEUE_TASK";
 
+constexpr auto ENGINE_SRV_EVENT_DRAIN_BATCH = 256;
+constexpr auto ENGINE_SRV_EVENT_DRAIN_BATCH_ENV = "WZE_EVENT_DRAIN_BATCH";
+
+constexpr auto ENGINE_SRV_EVENT_LOOPS = 1;
+constexpr auto ENGINE_SRV_EVENT_LOOPS_ENV = "WZE_EVENT_LOOPS";
+
+constexpr auto ENGINE_SRV_CORE_SET = ""; ///< Empty = server loop threads not pinned
+constexpr auto ENGINE_SRV_CORE_SET_ENV = "WZE_SERVER_CORE_SET";
+
+constexpr auto ENGINE_SRV_EVENT_SHM = ""; ///< Empty = shared memory event transport disabled
+constexpr auto ENGINE_SRV_EVENT_SHM_ENV = "WZE_EVENT_SHM";
+
 constexpr auto ENGINE_SRV_API_SOCK = "/run/wazuh-server/engine-api.socket";
 constexpr auto ENGINE_SRV_API_SOCK_ENV = "WZE_API_SOCK";
 
 constexpr auto ENGINE_SRV_API_QUEUE_TASK = 50;
 constexpr auto ENGINE_SRV_API_QUEUE_TASK_ENV = "WZE_API_QUEUE_TASK";
 
+constexpr auto ENGINE_SRV_API_WORKERS = 2;
+constexpr auto ENGINE_SRV_API_WORKERS_ENV = "WZE_API_WORKERS";
+
 constexpr auto ENGINE_CLIENT_TIMEOUT = 1000;
 constexpr auto ENGINE_SRV_API_TIMEOUT = 1000;
 constexpr auto ENGINE_SRV_API_TIMEOUT_ENV = "WZE_API_TIMEOUT";
@@ -42,6 +57,8 @@ constexpr auto ENGINE_STORE_PATH_ENV = "WZE_STORE_PATH";
 // KVDB module
 constexpr auto ENGINE_KVDB_PATH = "/var/lib/wazuh-server/engine/kvdb/";
 constexpr auto ENGINE_KVDB_PATH_ENV = "WZE_KVDB_PATH";
+constexpr auto ENGINE_KVDB_BLOCK_CACHE_MB = 64;
+constexpr auto ENGINE_KVDB_BLOCK_CACHE_MB_ENV = "WZE_KVDB_BLOCK_CACHE_MB";
 
 // TZDB
 constexpr auto ENGINE_TZDB_PATH = "/var/lib/wazuh-server/engine/tzdb";
@@ -56,6 +73,12 @@ constexpr auto ENGINE_KVDB_CLI_RECORDS = 50;
 constexpr auto ENGINE_ROUTER_THREADS = 1;
 constexpr auto ENGINE_ROUTER_THREADS_ENV = "WZE_ROUTER_THREADS";
 
+constexpr auto ENGINE_ROUTER_CORE_SET = ""; ///< Empty = router worker threads not pinned
+constexpr auto ENGINE_ROUTER_CORE_SET_ENV = "WZE_ROUTER_CORE_SET";
+
+constexpr auto ENGINE_ROUTER_MAX_THREADS = 0; ///< 0 = dynamic worker scaling disabled
+constexpr auto ENGINE_ROUTER_MAX_THREADS_ENV = "WZE_ROUTER_MAX_THREADS";
+
 // Maxmind module
 constexpr auto ENGINE_MMDB_ASN_PATH = "";
 constexpr auto ENGINE_MMDB_ASN_PATH_ENV = "WZE_MMDB_ASN_PATH";
@@ -63,16 +86,29 @@ constexpr auto ENGINE_MMDB_ASN_PATH_ENV = "WZE_MMDB_ASN_PATH";
 constexpr auto ENGINE_MMDB_CITY_PATH = "";
 constexpr auto ENGINE_MMDB_CITY_PATH_ENV = "WZE_MMDB_CITY_PATH";
 
+// Tracing
+constexpr auto ENGINE_TRACE_SAMPLE_EVERY = 0;
+constexpr auto ENGINE_TRACE_SAMPLE_EVERY_ENV = "WZE_TRACE_SAMPLE_EVERY";
+
+constexpr auto ENGINE_ASSET_CPU_PROFILING = false;
+constexpr auto ENGINE_ASSET_CPU_PROFILING_ENV = "WZE_ASSET_CPU_PROFILING";
+
 // Queue Module
 constexpr auto ENGINE_QUEUE_SIZE = 1000000;
 constexpr auto ENGINE_QUEUE_SIZE_ENV = "WZE_QUEUE_SIZE";
 
+constexpr auto ENGINE_QUEUE_SHARDS = 1;
+constexpr auto ENGINE_QUEUE_SHARDS_ENV = "WZE_QUEUE_SHARDS";
+
 constexpr auto ENGINE_QUEUE_FLOOD_FILE = "";
 constexpr auto ENGINE_QUEUE_FLOOD_FILE_ENV = "WZE_QUEUE_FLOOD_FILE";
 
 constexpr auto ENGINE_QUEUE_FLOOD_ATTEMPTS = 3;
 constexpr auto ENGINE_QUEUE_FLOOD_ATTEMPTS_ENV = "WZE_QUEUE_FLOOD_ATTEMPTS";
 
+constexpr auto ENGINE_QUEUE_SPILL_DIR = "";
+constexpr auto ENGINE_QUEUE_SPILL_DIR_ENV = "WZE_QUEUE_SPILL_DIR";
+
 constexpr auto ENGINE_QUEUE_FLOOD_SLEEP = 100;
 constexpr auto ENGINE_QUEUE_FLOOD_SLEEP_ENV = "WZE_QUEUE_FLOOD_SLEEP";
 
@@ -3,10 +3,13 @@
 #include <atomic>
 #include <csignal>
 #include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include <api/api.hpp>
@@ -22,8 +25,12 @@
 #include <api/router/handlers.hpp>
 #include <api/tester/handlers.hpp>
 #include <apiserver/apiServer.hpp>
+#include <base/eventTrace.hpp>
 #include <base/logging.hpp>
+#include <base/utils/coarseClock.hpp>
+#include <base/utils/threadAffinity.hpp>
 #include <base/parseEvent.hpp>
+#include <bk/profiler.hpp>
 #include <bk/rx/controller.hpp>
 #include <builder/builder.hpp>
 #include <cmds/details/stackExecutor.hpp>
@@ -36,12 +43,15 @@
 #include <logpar/registerParsers.hpp>
 #include <metrics/metricsManager.hpp>
 #include <queue/concurrentQueue.hpp>
+#include <queue/shardedQueue.hpp>
 #include <rbac/rbac.hpp>
 #include <router/orchestrator.hpp>
 #include <schemf/schema.hpp>
+#include <server/endpoints/shmRing.hpp>      // Event (shared memory)
 #include <server/endpoints/unixDatagram.hpp> // Event
 #include <server/endpoints/unixStream.hpp>   //API
 #include <server/engineServer.hpp>
+#include <server/protocolHandler.hpp>
 #include <server/protocolHandlers/wStream.hpp>
 #include <sockiface/unixSocketFactory.hpp>
 #include <store/drivers/fileDriver.hpp>
@@ -54,14 +64,108 @@
 
 namespace
 {
-struct QueueTraits : public moodycamel::ConcurrentQueueDefaultTraits
-{
-    static constexpr size_t BLOCK_SIZE = 2048;
-    static constexpr size_t IMPLICIT_INITIAL_INDEX_SIZE = 8192;
-};
+using QueueTraits = base::queue::EventQueueTraits;
 std::shared_ptr<engineserver::EngineServer> g_engineServer {};
 std::shared_ptr<apiserver::ApiServer> g_apiServer {};
 
+/**
+ * @brief Minimal dependency-aware task graph to overlap the independent, I/O-bound module
+ * initializations at engine start.
+ *
+ * Tasks are declared in dependency order (a task may only depend on tasks declared before it).
+ * run() launches every task asynchronously; each one waits for its dependencies to finish before
+ * executing, so independent slow opens run concurrently instead of summing. The first failure is
+ * rethrown after every launched task has settled.
+ */
+class InitTaskGraph
+{
+private:
+    struct Task
+    {
+        std::string name;              ///< Task name, referenced by dependents.
+        std::vector<std::string> deps; ///< Names of the tasks that must finish first.
+        std::function<void()> fn;      ///< Initialization step.
+    };
+
+    std::vector<Task> m_tasks;
+
+public:
+    /**
+     * @brief Add an initialization task.
+     *
+     * @param name Task name.
+     * @param deps Names of previously added tasks this one depends on.
+     * @param fn Initialization step.
+     */
+    void add(const std::string& name, const std::vector<std::string>& deps, std::function<void()> fn)
+    {
+        m_tasks.push_back({name, deps, std::move(fn)});
+    }
+
+    /**
+     * @brief Run every task, overlapping the ones whose dependencies are satisfied.
+     *
+     * @throw std::logic_error If a task depends on an unknown task.
+     * @throw The first exception thrown by a task, after all launched tasks settled.
+     */
+    void run()
+    {
+        std::unordered_map<std::string, std::shared_future<void>> futures;
+        futures.reserve(m_tasks.size());
+
+        for (auto& task : m_tasks)
+        {
+            std::vector<std::shared_future<void>> depFutures;
+            depFutures.reserve(task.deps.size());
+            for (const auto& dep : task.deps)
+            {
+                const auto it = futures.find(dep);
+                if (it == futures.end())
+                {
+                    throw std::logic_error(
+                        fmt::format("Initialization task '{}' depends on unknown task '{}'", task.name, dep));
+                }
+                depFutures.push_back(it->second);
+            }
+
+            futures.emplace(task.name,
+                            std::async(std::launch::async,
+                                       [&task, depFutures = std::move(depFutures)]()
+                                       {
+                                           // A failed dependency rethrows here, failing the dependents too
+                                           for (const auto& depFuture : depFutures)
+                                           {
+                                               depFuture.get();
+                                           }
+                                           task.fn();
+                                       })
+                                .share());
+        }
+
+        // Wait for every task before rethrowing, so no thread outlives the graph
+        std::exception_ptr firstError;
+        for (const auto& task : m_tasks)
+        {
+            try
+            {
+                futures.at(task.name).get();
+            }
+            catch (...)
+            {
+                if (!firstError)
+                {
+                    firstError = std::current_exception();
+                }
+            }
+        }
+
+        if (firstError)
+        {
+            std::rethrow_exception(firstError);
+        }
+    }
+};
+
 void sigintHandler(const int signum)
 {
     if (g_engineServer)
@@ -83,21 +187,33 @@ struct Options
     int serverThreads;
     std::string serverEventSock;
     int serverEventQueueSize;
+    int serverEventDrainBatch;
+    int serverEventLoops;
+    std::string serverCoreSet;
+    std::string serverEventShm;
     std::string serverApiSock;
     int serverApiQueueSize;
     int serverApiTimeout;
+    int serverApiWorkers;
     // Store
     std::string fileStorage;
     // KVDB
     std::string kvdbPath;
+    int kvdbBlockCacheMB;
     // Orchestration
     int routerThreads;
+    int routerMaxThreads;
+    std::string routerCoreSet;
+    int traceSampleEvery;
+    bool assetCpuProfiling;
     // Queue
     int queueSize;
+    int queueShards;
     std::string queueFloodFile;
     int queueFloodAttempts;
     int queueFloodSleep;
     bool queueDropFlood;
+    std::string queueSpillDir;
     // Loggin
     std::string level;
     // TZ_DB
@@ -124,9 +240,14 @@ void runStart(ConfHandler confManager)
     const auto serverThreads = confManager->get<int>("server.server_threads");
     const auto serverEventSock = confManager->get<std::string>("server.event_socket");
     const auto serverEventQueueSize = confManager->get<int>("server.event_queue_tasks");
+    const auto serverEventDrainBatch = confManager->get<int>("server.event_drain_batch");
+    const auto serverEventLoops = confManager->get<int>("server.event_loops");
+    const auto serverCoreSet = confManager->get<std::string>("server.server_core_set");
+    const auto serverEventShm = confManager->get<std::string>("server.event_shm");
     const auto serverApiSock = confManager->get<std::string>("server.api_socket");
     const auto serverApiQueueSize = confManager->get<int>("server.api_queue_tasks");
     const auto serverApiTimeout = confManager->get<int>("server.api_timeout");
+    const auto serverApiWorkers = confManager->get<int>("server.api_workers");
 
     // Store config
     const auto fileStorage = confManager->get<std::string>("server.store_path");
@@ -143,18 +264,29 @@ void runStart(ConfHandler confManager)
               logConfig.flushInterval);
     LOG_INFO("Logging initialized.");
 
+    // Coarse clock service, used by per-event timestamping and EPS windowing
+    base::utils::time::CoarseClock::instance().start();
+    exitHandler.add([]() { base::utils::time::CoarseClock::instance().stop(); });
+
     // KVDB config
     const auto kvdbPath = confManager->get<std::string>("server.kvdb_path");
+    const auto kvdbBlockCacheMB = confManager->get<int>("server.kvdb_block_cache_mb");
 
     // Router Config
     const auto routerThreads = confManager->get<int>("server.router_threads");
+    const auto routerMaxThreads = confManager->get<int>("server.router_max_threads");
+    const auto routerCoreSet = confManager->get<std::string>("server.router_core_set");
+    const auto traceSampleEvery = confManager->get<int>("server.trace_sample_every");
+    const auto assetCpuProfiling = confManager->get<bool>("server.asset_cpu_profiling");
 
     // Queue config
     const auto queueSize = confManager->get<int>("server.queue_size");
+    const auto queueShards = confManager->get<int>("server.queue_shards");
     const auto queueFloodFile = confManager->get<std::string>("server.queue_flood_file");
     const auto queueFloodAttempts = confManager->get<int>("server.queue_flood_attempts");
     const auto queueFloodSleep = confManager->get<int>("server.queue_flood_sleep");
     const auto queueDropFlood = confManager->get<bool>("server.queue_drop_flood");
+    const auto queueSpillDir = confManager->get<std::string>("server.queue_spill_dir");
 
     // TZDB config
     auto getExecutablePath = []() -> std::string
@@ -220,100 +352,136 @@ void runStart(ConfHandler confManager)
 
     try
     {
-        metrics = std::make_shared<metricsManager::MetricsManager>();
+        // The modules up to the indexer connector have few dependencies between them and their slow
+        // parts are I/O bound (store walk, KVDB open, geo mmdb open, indexer connection), so they
+        // are initialized through a task graph that overlaps the independent steps.
+        InitTaskGraph initGraph;
+
+        // Metrics
+        initGraph.add("metrics", {}, [&]() { metrics = std::make_shared<metricsManager::MetricsManager>(); });
 
         // Store
-        {
-            auto fileDriver = std::make_shared<store::drivers::FileDriver>(fileStorage);
-            store = std::make_shared<store::Store>(fileDriver);
-            LOG_INFO("Store initialized.");
-        }
+        initGraph.add("store",
+                      {},
+                      [&]()
+                      {
+                          auto fileDriver = std::make_shared<store::drivers::FileDriver>(fileStorage);
+                          store = std::make_shared<store::Store>(fileDriver);
+                          LOG_INFO("Store initialized.");
+                      });
 
         // RBAC
-        {
-            rbac = std::make_shared<rbac::RBAC>(store);
-            LOG_INFO("RBAC initialized.");
-        }
+        initGraph.add("rbac",
+                      {"store"},
+                      [&]()
+                      {
+                          rbac = std::make_shared<rbac::RBAC>(store);
+                          LOG_INFO("RBAC initialized.");
+                      });
 
         // KVDB
-        {
-            kvdbManager::KVDBManagerOptions kvdbOptions {kvdbPath, "kvdb"};
-            kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbOptions, metrics);
-            kvdbManager->initialize();
-            LOG_INFO("KVDB initialized.");
-            exitHandler.add(
-                [kvdbManager, functionName = logging::getLambdaName(__FUNCTION__, "exitHandler")]()
-                {
-                    kvdbManager->finalize();
-                    LOG_INFO_L(functionName.c_str(), "KVDB terminated.");
-                });
-        }
+        initGraph.add("kvdb",
+                      {"metrics"},
+                      [&]()
+                      {
+                          kvdbManager::KVDBManagerOptions kvdbOptions {
+                              kvdbPath, "kvdb", static_cast<size_t>(kvdbBlockCacheMB) * 1024 * 1024};
+                          kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbOptions, metrics);
+                          kvdbManager->initialize();
+                          LOG_INFO("KVDB initialized.");
+                          exitHandler.add(
+                              [kvdbManager, functionName = logging::getLambdaName(__FUNCTION__, "exitHandler")]()
+                              {
+                                  kvdbManager->finalize();
+                                  LOG_INFO_L(functionName.c_str(), "KVDB terminated.");
+                              });
+                      });
 
         // GEO
-        {
-            // TODO: This is a optional right now, but it be mandatory in the future
-            auto geoDownloader = std::make_shared<geo::Downloader>();
-            geoManager = std::make_shared<geo::Manager>(store, geoDownloader);
-            LOG_INFO("Geo initialized.");
-        }
+        initGraph.add("geo",
+                      {"store"},
+                      [&]()
+                      {
+                          // TODO: This is a optional right now, but it be mandatory in the future
+                          auto geoDownloader = std::make_shared<geo::Downloader>();
+                          geoManager = std::make_shared<geo::Manager>(store, geoDownloader);
+                          LOG_INFO("Geo initialized.");
+                      });
 
         // Schema
-        {
-            schema = std::make_shared<schemf::Schema>();
-            auto result = store->readInternalDoc("schema/engine-schema/0");
-            if (std::holds_alternative<base::Error>(result))
-            {
-                LOG_WARNING("Error loading schema definition: {}", std::get<base::Error>(result).message);
-                LOG_WARNING("Engine running without schema, consistency with indexer mappings is not guaranteed.");
-            }
-            else
-            {
-                auto schemaJson = std::get<json::Json>(result);
-                schema->load(schemaJson);
-            }
-            LOG_INFO("Schema initialized.");
-        }
+        initGraph.add("schema",
+                      {"store"},
+                      [&]()
+                      {
+                          schema = std::make_shared<schemf::Schema>();
+                          auto result = store->readInternalDoc("schema/engine-schema/0");
+                          if (std::holds_alternative<base::Error>(result))
+                          {
+                              LOG_WARNING("Error loading schema definition: {}",
+                                          std::get<base::Error>(result).message);
+                              LOG_WARNING("Engine running without schema, consistency with indexer mappings is "
+                                          "not guaranteed.");
+                          }
+                          else
+                          {
+                              auto schemaJson = std::get<json::Json>(result);
+                              schema->load(schemaJson);
+                          }
+                          LOG_INFO("Schema initialized.");
+                      });
 
         // HLP
-        {
-            hlp::initTZDB(tzdbPath, tzdbAutoUpdate);
-
-            base::Name hlpConfigFileName({"schema", "wazuh-logpar-types", "0"});
-            auto hlpParsers = store->readInternalDoc(hlpConfigFileName);
-            if (std::holds_alternative<base::Error>(hlpParsers))
-            {
-                LOG_ERROR("Could not retreive configuration file [{}] needed by the "
-                          "HLP module, error: {}",
-                          hlpConfigFileName.fullName(),
-                          std::get<base::Error>(hlpParsers).message);
-
-                exitHandler.execute();
-                return;
-            }
-            logpar = std::make_shared<hlp::logpar::Logpar>(std::get<json::Json>(hlpParsers), schema);
-            hlp::registerParsers(logpar);
-            LOG_INFO("HLP initialized.");
-        }
+        initGraph.add("hlp",
+                      {"schema"},
+                      [&]()
+                      {
+                          hlp::initTZDB(tzdbPath, tzdbAutoUpdate);
+
+                          base::Name hlpConfigFileName({"schema", "wazuh-logpar-types", "0"});
+                          auto hlpParsers = store->readInternalDoc(hlpConfigFileName);
+                          if (std::holds_alternative<base::Error>(hlpParsers))
+                          {
+                              throw std::runtime_error(
+                                  fmt::format("Could not retreive configuration file [{}] needed by the "
+                                              "HLP module, error: {}",
+                                              hlpConfigFileName.fullName(),
+                                              std::get<base::Error>(hlpParsers).message));
+                          }
+                          logpar = std::make_shared<hlp::logpar::Logpar>(std::get<json::Json>(hlpParsers), schema);
+                          hlp::registerParsers(logpar);
+                          LOG_INFO("HLP initialized.");
+                      });
 
         // Indexer Connector
-        { // TODO Change index to `wazuh-alerts-5.x-%{+yyyyy.MM.dd}` when supported placeholder is available.
-            // IndexerConnector configuration.
-            IndexerConnectorOptions indexerConnectorOptions {
-                .name = getEnvOrDefault("WENGINE_ICONNECTOR_INDEX", "test-basic-index"),
-                .hosts = {getEnvOrDefault("WENGINE_ICONNECTOR_HOSTS", "http://127.0.0.1:9200")},
-                .username = getEnvOrDefault("WENGINE_ICONNECTOR_USERNAME", "admin"),
-                .password = getEnvOrDefault("WENGINE_ICONNECTOR_PASSWORD", "WazuhEngine5+"),
-                .sslOptions = {.cacert = {getEnvOrDefault("WENGINE_ICONNECTOR_CA", "")},
-                               .cert = getEnvOrDefault("WENGINE_ICONNECTOR_CERT", ""),
-                               .key = getEnvOrDefault("WENGINE_ICONNECTOR_KEY", "")},
-                .timeout = static_cast<uint32_t>(std::stoul(getEnvOrDefault("WENGINE_ICONNECTOR_TIMEOUT", "60000"))),
-                .workingThreads =
-                    static_cast<uint8_t>(std::stoul(getEnvOrDefault("WENGINE_ICONNECTOR_WORKING_THREADS", "1"))),
-                .databasePath = getEnvOrDefault("WENGINE_ICONNECTOR_DB_PATH", cmd::ENGINE_INDEXER_CONNECTOR_QUEUE)};
-
-            // Create connector and wait until the connection is established.
-            iConnector = std::make_shared<IndexerConnector>(indexerConnectorOptions);
-        }
+        // TODO Change index to `wazuh-alerts-5.x-%{+yyyyy.MM.dd}` when supported placeholder is available.
+        initGraph.add("indexerConnector",
+                      {},
+                      [&]()
+                      {
+                          // IndexerConnector configuration.
+                          IndexerConnectorOptions indexerConnectorOptions {
+                              .name = getEnvOrDefault("WENGINE_ICONNECTOR_INDEX", "test-basic-index"),
+                              .hosts = {getEnvOrDefault("WENGINE_ICONNECTOR_HOSTS", "http://127.0.0.1:9200")},
+                              .username = getEnvOrDefault("WENGINE_ICONNECTOR_USERNAME", "admin"),
+                              .password = getEnvOrDefault("WENGINE_ICONNECTOR_PASSWORD", "WazuhEngine5+"),
+                              .sslOptions = {.cacert = {getEnvOrDefault("WENGINE_ICONNECTOR_CA", "")},
+                                             .cert = getEnvOrDefault("WENGINE_ICONNECTOR_CERT", ""),
+                                             .key = getEnvOrDefault("WENGINE_ICONNECTOR_KEY", "")},
+                              .timeout = static_cast<uint32_t>(
+                                  std::stoul(getEnvOrDefault("WENGINE_ICONNECTOR_TIMEOUT", "60000"))),
+                              .workingThreads = static_cast<uint8_t>(
+                                  std::stoul(getEnvOrDefault("WENGINE_ICONNECTOR_WORKING_THREADS", "1"))),
+                              .databasePath =
+                                  getEnvOrDefault("WENGINE_ICONNECTOR_DB_PATH", cmd::ENGINE_INDEXER_CONNECTOR_QUEUE),
+                              .compressRequests = getEnvOrDefault("WENGINE_ICONNECTOR_COMPRESSION", "false") == "true",
+                              .catchUpEventsPerSecond = static_cast<uint32_t>(
+                                  std::stoul(getEnvOrDefault("WENGINE_ICONNECTOR_CATCH_UP_EPS", "0")))};
+
+                          // Create connector and wait until the connection is established.
+                          iConnector = std::make_shared<IndexerConnector>(indexerConnectorOptions);
+                      });
+
+        initGraph.run();
 
         // Builder and registry
         {
@@ -350,16 +518,58 @@ void runStart(ConfHandler confManager)
         {
             // External queues
             using QEventType = base::queue::ConcurrentQueue<base::Event, QueueTraits>;
+            using QEventShardedType = base::queue::ShardedQueue<base::Event, QueueTraits>;
             using QTestType = base::queue::ConcurrentQueue<router::test::QueueType>;
 
-            std::shared_ptr<QEventType> eventQueue {};
+            std::shared_ptr<router::ProdQueueType> eventQueue {};
             std::shared_ptr<QTestType> testQueue {};
             {
                 auto scope = metrics->getMetricsScope("EventQueue");
                 auto scopeDelta = metrics->getMetricsScope("EventQueueDelta");
+
+                // Persistent overflow ring, overflow is delayed instead of lost
+                std::shared_ptr<base::queue::SpillQueue> spillQueue {};
+                std::function<base::Event(std::string&&)> rehydrate {};
+                if (!queueSpillDir.empty())
+                {
+                    spillQueue = std::make_shared<base::queue::SpillQueue>(queueSpillDir);
+                    rehydrate = [](std::string&& raw) { return std::make_shared<json::Json>(raw.c_str()); };
+                }
+
                 // TODO queueFloodFile, queueFloodAttempts, queueFloodSleep -> Move to Queue.flood options
-                eventQueue = std::make_shared<QEventType>(
-                    queueSize, scope, scopeDelta, queueFloodFile, queueFloodAttempts, queueFloodSleep, queueDropFlood);
+                if (queueShards > 1)
+                {
+                    // Events of the same agent land in the same shard, so their relative order
+                    // is preserved while idle workers steal batches from loaded shards
+                    auto byAgent = [](const base::Event& event) -> std::size_t
+                    {
+                        const auto location = event->getString(base::parseEvent::EVENT_LOCATION_ID);
+                        return std::hash<std::string> {}(location.value_or(""));
+                    };
+                    eventQueue = std::make_shared<QEventShardedType>(queueShards,
+                                                                     queueSize,
+                                                                     scope,
+                                                                     scopeDelta,
+                                                                     std::move(byAgent),
+                                                                     queueFloodFile,
+                                                                     queueFloodAttempts,
+                                                                     queueFloodSleep,
+                                                                     queueDropFlood,
+                                                                     spillQueue,
+                                                                     rehydrate);
+                }
+                else
+                {
+                    eventQueue = std::make_shared<QEventType>(queueSize,
+                                                              scope,
+                                                              scopeDelta,
+                                                              queueFloodFile,
+                                                              queueFloodAttempts,
+                                                              queueFloodSleep,
+                                                              queueDropFlood,
+                                                              spillQueue,
+                                                              rehydrate);
+                }
 
                 LOG_DEBUG("Event queue created.");
             }
@@ -370,12 +580,25 @@ void runStart(ConfHandler confManager)
                 LOG_DEBUG("Test queue created.");
             }
 
+            base::eventTrace::configure(traceSampleEvery > 0 ? static_cast<std::size_t>(traceSampleEvery) : 0);
+
+            bk::profiler::enable(assetCpuProfiling);
+            if (assetCpuProfiling)
+            {
+                metrics->getMetricsScope("AssetProfiler")
+                    ->registerScrapeCallback("AssetCpuReport", []() { return bk::profiler::report(); });
+                LOG_INFO("Per-asset CPU profiling enabled.");
+            }
+
             router::Orchestrator::Options config {.m_numThreads = routerThreads,
+                                                  .m_maxNumThreads = routerMaxThreads,
                                                   .m_wStore = store,
                                                   .m_builder = builder,
                                                   .m_controllerMaker = std::make_shared<bk::rx::ControllerMaker>(),
                                                   .m_prodQueue = eventQueue,
                                                   .m_testQueue = testQueue,
+                                                  .m_metricsScope = metrics->getMetricsScope("Router"),
+                                                  .m_workerCoreSet = routerCoreSet,
                                                   .m_testTimeout = serverApiTimeout};
 
             orchestrator = std::make_shared<router::Orchestrator>(config);
@@ -388,7 +611,7 @@ void runStart(ConfHandler confManager)
         // Create and configure the api endpints
         {
             // API
-            api = std::make_shared<api::Api>(rbac);
+            api = std::make_shared<api::Api>(rbac, serverApiWorkers);
             LOG_DEBUG("API created.");
             exitHandler.add(
                 [api, functionName = logging::getLambdaName(__FUNCTION__, "exitHandler")]()
@@ -449,7 +672,7 @@ void runStart(ConfHandler confManager)
 
         // API Server
         {
-            g_apiServer = std::make_shared<apiserver::ApiServer>();
+            g_apiServer = std::make_shared<apiserver::ApiServer>(metrics->getMetricsScope("ApiServer"));
 
             // Add apidoc documentation.
             /**
@@ -693,7 +916,8 @@ void runStart(ConfHandler confManager)
         // Server
         {
             using namespace engineserver;
-            server = std::make_shared<EngineServer>();
+            server = std::make_shared<EngineServer>(
+                serverThreads, serverEventLoops, base::utils::affinity::parseCoreSet(serverCoreSet));
             g_engineServer = server;
 
             // API Endpoint
@@ -715,10 +939,36 @@ void runStart(ConfHandler confManager)
             // Event Endpoint
             auto eventMetricScope = metrics->getMetricsScope("endpointEvent");
             auto eventMetricScopeDelta = metrics->getMetricsScope("endpointEventRate", true);
-            auto eventHandler = std::bind(&router::Orchestrator::pushEvent, orchestrator, std::placeholders::_1);
-            auto eventEndpointCfg = std::make_shared<endpoint::UnixDatagram>(
-                serverEventSock, eventHandler, eventMetricScope, eventMetricScopeDelta, serverEventQueueSize);
-            server->addEndpoint("EVENT", eventEndpointCfg);
+            // Batched frames carry several length-prefixed events per datagram, single events
+            // keep the legacy one-event-per-datagram path
+            auto eventHandler = [orchestrator](std::string_view data)
+            {
+                if (engineserver::framing::isBatchFrame(data))
+                {
+                    orchestrator->pushEventBatch(engineserver::framing::splitBatchFrame(data));
+                }
+                else
+                {
+                    orchestrator->pushEvent(data);
+                }
+            };
+            auto eventEndpointCfg = std::make_shared<endpoint::UnixDatagram>(serverEventSock,
+                                                                             eventHandler,
+                                                                             eventMetricScope,
+                                                                             eventMetricScopeDelta,
+                                                                             serverEventQueueSize,
+                                                                             serverEventDrainBatch);
+            server->addEndpoint("EVENT", eventEndpointCfg, true);
+
+            // Shared memory event endpoint (optional, the unix socket stays as fallback)
+            if (!serverEventShm.empty())
+            {
+                auto eventShmMetricScope = metrics->getMetricsScope("endpointEventShm");
+                auto eventShmMetricScopeDelta = metrics->getMetricsScope("endpointEventShmRate", true);
+                auto eventShmEndpointCfg = std::make_shared<endpoint::ShmRing>(
+                    serverEventShm, eventHandler, eventShmMetricScope, eventShmMetricScopeDelta);
+                server->addEndpoint("EVENT_SHM", eventShmEndpointCfg);
+            }
             LOG_DEBUG("Server configured.");
         }
     }
@@ -780,6 +1030,35 @@ void configure(CLI::App_p app)
         ->default_val(ENGINE_SRV_EVENT_QUEUE_TASK)
         ->check(CLI::NonNegativeNumber)
         ->envname(ENGINE_SRV_EVENT_QUEUE_TASK_ENV);
+    serverApp
+        ->add_option("--event_drain_batch",
+                     options->serverEventDrainBatch,
+                     "Sets the number of extra datagrams drained from the events socket per loop wakeup (0 = "
+                     "disable). Under load a burst is serviced in one wakeup, an idle socket falls back to the "
+                     "loop's epoll sleep.")
+        ->default_val(ENGINE_SRV_EVENT_DRAIN_BATCH)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_SRV_EVENT_DRAIN_BATCH_ENV);
+    serverApp
+        ->add_option("--event_loops",
+                     options->serverEventLoops,
+                     "Sets the number of event loops reading the events socket.")
+        ->default_val(ENGINE_SRV_EVENT_LOOPS)
+        ->check(CLI::Range(1, 128))
+        ->envname(ENGINE_SRV_EVENT_LOOPS_ENV);
+    serverApp
+        ->add_option("--server_core_set",
+                     options->serverCoreSet,
+                     "Pins the server loop threads to a core set, e.g. '0-3,8' (empty = no pinning). Pinning the "
+                     "ingestion loops to one NUMA node keeps the event buffers local to that node.")
+        ->default_val(ENGINE_SRV_CORE_SET)
+        ->envname(ENGINE_SRV_CORE_SET_ENV);
+    serverApp
+        ->add_option("--event_shm",
+                     options->serverEventShm,
+                     "Sets the shared memory segment name for the event ring transport (empty = disabled).")
+        ->default_val(ENGINE_SRV_EVENT_SHM)
+        ->envname(ENGINE_SRV_EVENT_SHM_ENV);
     serverApp->add_option("--api_socket", options->serverApiSock, "Sets the API server socket address.")
         ->default_val(ENGINE_SRV_API_SOCK)
         ->envname(ENGINE_SRV_API_SOCK_ENV);
@@ -795,6 +1074,13 @@ void configure(CLI::App_p app)
         ->default_val(ENGINE_SRV_API_TIMEOUT)
         ->check(CLI::NonNegativeNumber)
         ->envname(ENGINE_SRV_API_TIMEOUT_ENV);
+    serverApp
+        ->add_option("--api_workers",
+                     options->serverApiWorkers,
+                     "Sets the number of dedicated API worker threads. (0 = run the handlers on the caller thread).")
+        ->default_val(ENGINE_SRV_API_WORKERS)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_SRV_API_WORKERS_ENV);
 
     // Store Module
     serverApp
@@ -809,6 +1095,13 @@ void configure(CLI::App_p app)
         ->default_val(ENGINE_KVDB_PATH)
         ->check(CLI::ExistingDirectory)
         ->envname(ENGINE_KVDB_PATH_ENV);
+    serverApp
+        ->add_option("--kvdb_block_cache_mb",
+                     options->kvdbBlockCacheMB,
+                     "Sets the size in MiB of the block cache shared by all KVDBs.")
+        ->default_val(ENGINE_KVDB_BLOCK_CACHE_MB)
+        ->check(CLI::Range(1, 16384))
+        ->envname(ENGINE_KVDB_BLOCK_CACHE_MB_ENV);
 
     // TZ_DB Installation Path
     serverApp->add_option("--tzdb_path", options->tzdbPath, "Sets the install path to the time zone database.")
@@ -829,6 +1122,40 @@ void configure(CLI::App_p app)
         ->check(CLI::Range(1, 128))
         ->envname(ENGINE_ROUTER_THREADS_ENV);
 
+    serverApp
+        ->add_option("--router_max_threads",
+                     options->routerMaxThreads,
+                     "Sets the upper bound for dynamic router worker scaling: workers are started and parked "
+                     "between --router_threads and this bound following the event queue depth (0 = fixed count).")
+        ->default_val(ENGINE_ROUTER_MAX_THREADS)
+        ->check(CLI::Range(0, 128))
+        ->envname(ENGINE_ROUTER_MAX_THREADS_ENV);
+
+    serverApp
+        ->add_option("--router_core_set",
+                     options->routerCoreSet,
+                     "Pins the router worker threads to a core set, e.g. '0-3,8' (empty = no pinning). Use the "
+                     "same NUMA node as --server_core_set to avoid cross-node event traffic.")
+        ->default_val(ENGINE_ROUTER_CORE_SET)
+        ->envname(ENGINE_ROUTER_CORE_SET_ENV);
+
+    serverApp
+        ->add_option("--trace_sample_every",
+                     options->traceSampleEvery,
+                     "Stamps 1 every N events with stage timestamps to publish per-stage latency "
+                     "distributions through the metrics module, 0 disables tracing.")
+        ->default_val(ENGINE_TRACE_SAMPLE_EVERY)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_TRACE_SAMPLE_EVERY_ENV);
+
+    serverApp
+        ->add_flag("--asset_cpu_profiling",
+                   options->assetCpuProfiling,
+                   "Accumulates per-asset invocation and CPU cycle counts while processing events and publishes "
+                   "a ranked report through the metrics module.")
+        ->default_val(ENGINE_ASSET_CPU_PROFILING)
+        ->envname(ENGINE_ASSET_CPU_PROFILING_ENV);
+
     // Queue module
     serverApp
         ->add_option(
@@ -837,6 +1164,15 @@ void configure(CLI::App_p app)
         ->check(CLI::PositiveNumber)
         ->envname(ENGINE_QUEUE_SIZE_ENV);
 
+    serverApp
+        ->add_option("--queue_shards",
+                     options->queueShards,
+                     "Sets the number of event queue shards, 1 disables sharding. When sharded, each router "
+                     "worker owns a shard and steals batches from loaded ones, preserving per-agent ordering.")
+        ->default_val(ENGINE_QUEUE_SHARDS)
+        ->check(CLI::Range(1, 128))
+        ->envname(ENGINE_QUEUE_SHARDS_ENV);
+
     serverApp
         ->add_option("--queue_flood_file",
                      options->queueFloodFile,
@@ -864,6 +1200,14 @@ void configure(CLI::App_p app)
                         options->queueDropFlood,
                         "If enabled, the queue will drop the flood events instead of storing them in the file.");
 
+    serverApp
+        ->add_option("--queue_spill_dir",
+                     options->queueSpillDir,
+                     "Sets the directory for the persistent spill ring. When the queue is full, overflow events "
+                     "are buffered there and drained when the queue empties, instead of being flooded to the file.")
+        ->default_val(ENGINE_QUEUE_SPILL_DIR)
+        ->envname(ENGINE_QUEUE_SPILL_DIR_ENV);
+
     // Start subcommand
     auto startApp = serverApp->add_subcommand("start", "Start a Wazuh engine instance");
 
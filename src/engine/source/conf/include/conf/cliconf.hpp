@@ -2,8 +2,12 @@
 #define _CLI_CONF_HPP
 
 #include <algorithm>
+#include <any>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include <CLI/CLI.hpp>
 
@@ -24,6 +28,11 @@ class CliConf
 private:
     CLI::App_p m_app;
 
+    /// Typed snapshot of already-validated option values. Each option is walked, parsed and
+    /// validated at most once; later reads are a hash lookup. Invalidated per key by put().
+    mutable std::unordered_map<std::string, std::any> m_typedCache;
+    mutable std::shared_mutex m_cacheMutex; ///< Protects m_typedCache, reads vastly outnumber writes.
+
     /**
      * @brief Get the internal Option object from a key.
      *
@@ -55,6 +64,9 @@ public:
     /**
      * @brief Get the value of an option.
      *
+     * The first read of a key walks the option tree, parses and validates the value, and stores it
+     * in a typed snapshot; later reads of the same key return the snapshot value directly.
+     *
      * @tparam T The type of the option.
      * @param key The key of the option.
      * @return T The value of the option.
@@ -64,7 +76,25 @@ public:
     template<typename T>
     T get(const std::string& key) const
     {
-        return getOption(key)->as<T>();
+        {
+            std::shared_lock lock {m_cacheMutex};
+            if (const auto it = m_typedCache.find(key); it != m_typedCache.end())
+            {
+                // A key read as several types keeps only the last one cached, the others re-parse.
+                if (const auto* value = std::any_cast<T>(&it->second))
+                {
+                    return *value;
+                }
+            }
+        }
+
+        auto value = getOption(key)->as<T>();
+        {
+            std::unique_lock lock {m_cacheMutex};
+            m_typedCache.insert_or_assign(key, value);
+        }
+
+        return value;
     }
 
     /**
@@ -90,6 +120,9 @@ public:
      * @param value The value to put in the option.
      *
      * @throw std::runtime_error If the option does not exist or cannot be assigned to.
+     *
+     * @note Only the snapshot entry of the modified key is dropped, so a runtime reconfiguration
+     * revalidates that option on its next read without touching the rest of the snapshot.
      */
     void put(const std::string& key, const std::string& value);
 };
@@ -93,6 +93,10 @@ void CliConf::put(const std::string& key, const std::string& value)
             opt->add_result(prev);
             throw;
         }
+
+        // Drop only this key from the typed snapshot, it is revalidated on its next read.
+        std::unique_lock lock {m_cacheMutex};
+        m_typedCache.erase(key);
     }
     else
     {
@@ -136,3 +136,29 @@ TEST(CliConfTest, SaveConfigCustomLocation)
 
     ASSERT_EQ(got, expected);
 }
+
+TEST(CliConfTest, GetSnapshotCache)
+{
+    CLI::App_p app = std::make_shared<CLI::App>("Test");
+    app->add_option("--test", "Test option")->default_val("default");
+    conf::CliConf confManager(app);
+
+    // First read fills the snapshot, later reads return the same value
+    ASSERT_EQ(confManager.get<std::string>("test"), "default");
+    ASSERT_EQ(confManager.get<std::string>("test"), "default");
+
+    // Reading the same key as an incompatible type still fails
+    ASSERT_THROW(confManager.get<int>("test"), std::runtime_error);
+}
+
+TEST(CliConfTest, PutInvalidatesSnapshot)
+{
+    CLI::App_p app = std::make_shared<CLI::App>("Test");
+    std::string testVar;
+    app->add_option("--test", testVar, "Test option")->default_val("default");
+    conf::CliConf confManager(app);
+
+    ASSERT_EQ(confManager.get<std::string>("test"), "default");
+    ASSERT_NO_THROW(confManager.put("test", "new"));
+    ASSERT_EQ(confManager.get<std::string>("test"), "new");
+}
@@ -2,8 +2,11 @@
 #define _DEFS_HPP_
 
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 #include <base/json.hpp>
 #include <defs/idefinitions.hpp>
@@ -19,6 +22,9 @@ class Definitions : public IDefinitions
 private:
     std::unique_ptr<json::Json> m_definitions;
 
+    mutable std::unordered_map<std::string, std::string> m_replaceCache; ///< Memoized substitutions by input
+    mutable std::shared_mutex m_cacheMutex;                              ///< Protects the substitution memo
+
 public:
     Definitions() = default;
     ~Definitions() = default;
@@ -48,13 +54,43 @@ public:
 
 class DefinitionsBuilder : public IDefinitionsBuilder
 {
+private:
+    constexpr static auto MAX_CACHED_DEFINITIONS = 1024; ///< Cache is reset when this many entries accumulate
+
+    mutable std::unordered_map<std::string, std::shared_ptr<IDefinitions>>
+        m_cache;                    ///< Built definitions keyed by their content
+    mutable std::mutex m_cacheMutex; ///< Protects the cache
+
 public:
     DefinitionsBuilder() = default;
     ~DefinitionsBuilder() = default;
 
+    /**
+     * @copydoc IDefinitionsBuilder::build
+     *
+     * Equal definition objects share one Definitions instance, so rebuilding an unchanged asset
+     * reuses the validated definitions and their memoized substitutions instead of redoing the
+     * work.
+     */
     std::shared_ptr<IDefinitions> build(const json::Json& value) const override
     {
-        return std::make_shared<Definitions>(value);
+        auto key = value.str();
+
+        std::lock_guard lock {m_cacheMutex};
+        auto it = m_cache.find(key);
+        if (it != m_cache.end())
+        {
+            return it->second;
+        }
+
+        if (m_cache.size() >= MAX_CACHED_DEFINITIONS)
+        {
+            m_cache.clear();
+        }
+
+        auto definitions = std::make_shared<Definitions>(value);
+        m_cache.emplace(std::move(key), definitions);
+        return definitions;
     }
 };
 
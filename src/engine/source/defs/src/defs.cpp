@@ -51,6 +51,17 @@ std::string Definitions::replace(std::string_view input) const
         return std::string(input);
     }
 
+    // Substitution is memoized: rebuilding an asset whose expressions and definitions did not
+    // change resolves to a lookup instead of rescanning the input for every definition
+    {
+        std::shared_lock lock {m_cacheMutex};
+        auto cached = m_replaceCache.find(std::string(input));
+        if (cached != m_replaceCache.end())
+        {
+            return cached->second;
+        }
+    }
+
     // Replace in inverse order of definition declaration, so that definitions can reference each other
     // without causing infinite recursion
     auto replaced = std::string(input);
@@ -79,6 +90,17 @@ std::string Definitions::replace(std::string_view input) const
         }
     }
 
+    {
+        constexpr size_t maxCachedReplacements = 4096;
+
+        std::unique_lock lock {m_cacheMutex};
+        if (m_replaceCache.size() >= maxCachedReplacements)
+        {
+            m_replaceCache.clear();
+        }
+        m_replaceCache.emplace(std::string(input), replaced);
+    }
+
     return replaced;
 }
 } // namespace defs
@@ -97,3 +97,25 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple(json::Json(R"({"a": "value", "b": "$a", "c": "$b"})"), "$c", "value"),
                       std::make_tuple(json::Json(R"({"a": "$b", "b": "value"})"), "$a", "$b"),
                       std::make_tuple(json::Json(R"({"a": "$a"})"), "$a", "$a")));
+
+TEST(DefsReplaceCacheTest, RepeatedReplaceIsConsistent)
+{
+    auto def = defs::Definitions(json::Json(R"({"a": "value"})"));
+
+    // Second call resolves from the memo and must match the first
+    ASSERT_EQ(def.replace("$a and \\$a"), "value and $a");
+    ASSERT_EQ(def.replace("$a and \\$a"), "value and $a");
+}
+
+TEST(DefsBuilderCacheTest, EqualDefinitionsShareInstance)
+{
+    auto builder = defs::DefinitionsBuilder();
+
+    auto first = builder.build(json::Json(R"({"a": "value"})"));
+    auto second = builder.build(json::Json(R"({"a": "value"})"));
+    auto other = builder.build(json::Json(R"({"a": "other"})"));
+
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, other);
+    ASSERT_EQ(other->replace("$a"), "other");
+}
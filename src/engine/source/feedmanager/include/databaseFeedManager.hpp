@@ -14,6 +14,7 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <shared_mutex>
 #include <string>
@@ -29,6 +30,20 @@
 #include "vulnerabilityDescription_generated.h"
 #include "vulnerabilityRemediations_generated.h"
 
+/**
+ * @brief Immutable snapshot of the global feed maps.
+ *
+ * A snapshot is built once on (re)load and published atomically, so readers on the scan path get a
+ * consistent view of the three maps without taking any lock, while a concurrent reload publishes a
+ * brand new snapshot instead of mutating the one being read.
+ */
+struct GlobalMaps final
+{
+    nlohmann::json vendorsMap;  ///< Vendors map.
+    nlohmann::json cpeMappings; ///< OS CPE rules.
+    nlohmann::json cnaMappings; ///< CNA mappings.
+};
+
 /**
  * @brief Scanning package data struct.
  */
@@ -275,23 +290,121 @@ public:
      */
     auto vendorsMap() const -> const nlohmann::json&;
 
+    /**
+     * @brief Get the current snapshot of the global feed maps.
+     *
+     * The returned snapshot is immutable and keeps the maps alive while held, so scan paths that
+     * perform several lookups per event should load it once and read through it, independently of
+     * any concurrent reload.
+     *
+     * @return std::shared_ptr<const GlobalMaps> Current global maps snapshot.
+     */
+    std::shared_ptr<const GlobalMaps> globalMaps() const;
+
+    /**
+     * @brief Records that an agent was fully scanned against a given feed version.
+     *
+     * The marker survives restarts, so a fleet rescan interrupted by a manager restart can skip the
+     * agents already scanned against the current feed and resume from the first pending one.
+     *
+     * @param agentId Agent identifier.
+     * @param feedVersion Feed version the agent was scanned against.
+     */
+    void setAgentScanCheckpoint(const std::string& agentId, const std::string& feedVersion);
+
+    /**
+     * @brief Gets the feed version an agent was last fully scanned against.
+     *
+     * @param agentId Agent identifier.
+     * @return std::string Feed version of the last completed scan, or an empty string if the agent
+     * has no recorded checkpoint.
+     */
+    std::string getAgentScanCheckpoint(const std::string& agentId);
+
+    /**
+     * @brief Drops the pinned candidate blob cache.
+     *
+     * This function releases the verified candidate blobs pinned in memory by getVulnerabilitiesCandidates.
+     * It must be called after a feed update, since the pinned blobs reflect the pre-update feed content.
+     */
+    void clearCandidateBlobCache();
+
+    /**
+     * @brief Opens a shadow copy of the feed database for an update to be applied to.
+     *
+     * The shadow is a checkpoint of the current feed, so the updater applies its deltas on top of
+     * the current content while scans keep reading the live generation untouched. Only one update
+     * may be in flight at a time; the shadow must be handed back to commitFeedUpdate.
+     *
+     * @return std::shared_ptr<utils::rocksdb::RocksDBWrapper> Writable shadow database.
+     */
+    std::shared_ptr<utils::rocksdb::RocksDBWrapper> startFeedUpdate();
+
+    /**
+     * @brief Atomically switches readers to an updated shadow database.
+     *
+     * The in-memory state (global maps and translation cache) is rebuilt from the shadow before
+     * the switch, so a shadow with invalid content is rejected without touching the live
+     * generation. Readers mid-scan keep the generation they started with; cleanup of the replaced
+     * generation is deferred until the next commit, once no reader references it. Scans never
+     * observe the update window.
+     *
+     * @param shadow Shadow database returned by startFeedUpdate, with the update applied.
+     * @throws std::runtime_error if the shadow content is invalid; the live feed is kept.
+     */
+    void commitFeedUpdate(std::shared_ptr<utils::rocksdb::RocksDBWrapper> shadow);
+
+    /**
+     * @brief Applies a batch of feed events, converting their payloads in parallel.
+     *
+     * The JSON to flatbuffer conversion dominates feed apply time and each payload is
+     * independent, so creations are converted across a worker pool first. The events are then
+     * ingested in feed order on the calling thread, with every write buffered into a single
+     * batch that is committed once at the end; point reads during the apply consult the pending
+     * batch, so events updating a resource created earlier in the same call see it.
+     *
+     * @param resources Feed events in offset order, each holding 'resource', 'type' and its
+     * payload or operations.
+     * @param feedDatabase Database to apply the events to, typically the shadow returned by
+     * startFeedUpdate.
+     * @throws std::runtime_error if an event cannot be converted or ingested.
+     */
+    void applyFeedEvents(const std::vector<nlohmann::json>& resources,
+                         utils::rocksdb::RocksDBWrapper& feedDatabase);
+
 private:
+    static constexpr size_t CANDIDATE_BLOB_CACHE_SIZE {4096}; ///< Capacity of the pinned candidate blob cache.
+
     /**
      * Do not change the order of definition of these variables.
      * Since it is important at the object destruction time.
      */
     std::shared_mutex& m_mutex;
-    std::unique_ptr<utils::rocksdb::RocksDBWrapper> m_feedDatabase;
+    /// Current feed generation, published with std::atomic_store and read with std::atomic_load
+    /// so a feed swap never blocks a scan.
+    std::shared_ptr<utils::rocksdb::RocksDBWrapper> m_feedDatabase;
     // TODO: Get size from the config
     std::unique_ptr<TranslationLRUCache> m_translationL2Cache = std::make_unique<TranslationLRUCache>(1024);
 
     std::unique_ptr<std::unordered_set<std::string>> m_translationFilter =
         std::make_unique<std::unordered_set<std::string>>();
+    std::mutex m_translationCacheMutex; ///< Protects the translation caches and filter during concurrent scans.
 
     // TODO: Get size from the config
     std::unique_ptr<LRUCache<std::string, std::vector<PackageData>>> m_translationL1Cache =
         std::make_unique<LRUCache<std::string, std::vector<PackageData>>>(1024);
 
+    /**
+     * @brief Pinned, pre-verified candidate flatbuffer blobs.
+     *
+     * The feed is read-mostly between updates, so getVulnerabilitiesCandidates pins each candidate blob in memory
+     * the first time it is read and verified. Later scans access the flatbuffer in place, without copying the
+     * value out of RocksDB or re-running the verifier. Keyed by "<cna>_<candidate key>".
+     */
+    std::unique_ptr<LRUCache<std::string, std::shared_ptr<const std::string>>> m_candidateBlobCache =
+        std::make_unique<LRUCache<std::string, std::shared_ptr<const std::string>>>(CANDIDATE_BLOB_CACHE_SIZE);
+    std::mutex m_candidateBlobCacheMutex; ///< Protects m_candidateBlobCache.
+
     /**
      * @brief Reads the vendor and os cpe maps from the database and loads the data into memory.
      *
@@ -300,9 +413,44 @@ private:
      */
     void reloadGlobalMaps();
 
-    nlohmann::json m_cnaMappings;
-    nlohmann::json m_vendorsMap;
-    nlohmann::json m_cpeMappings;
+    /**
+     * @brief Gets the current feed database generation.
+     *
+     * Readers load the pointer once per operation, so a concurrent swap retires the previous
+     * generation only after every in-flight operation released it.
+     */
+    std::shared_ptr<utils::rocksdb::RocksDBWrapper> feedDatabase() const;
+
+    /**
+     * @brief Builds the global maps from the given feed database, without publishing them.
+     *
+     * @throws std::runtime_error if the maps aren't available or are invalid.
+     */
+    std::shared_ptr<const GlobalMaps> loadGlobalMaps(utils::rocksdb::RocksDBWrapper& feedDatabase) const;
+
+    /**
+     * @brief Fills the Level 2 translation cache from the given feed database.
+     *
+     * The caller is responsible for holding m_translationCacheMutex when scans may run
+     * concurrently.
+     */
+    void fillL2CacheTranslationsFrom(utils::rocksdb::RocksDBWrapper& feedDatabase);
+
+    /**
+     * @brief Destroys the retired feed generation and removes its directory.
+     *
+     * Skipped while any reader still references the retired generation; retried on the next
+     * commit.
+     */
+    void dropRetiredGeneration();
+
+    std::shared_ptr<const GlobalMaps> m_globalMaps; ///< Current snapshot, accessed with std::atomic_load/store.
+
+    std::string m_feedDatabasePath;    ///< Directory of the current feed generation.
+    std::string m_pendingShadowPath;   ///< Directory of the shadow opened by startFeedUpdate.
+    std::size_t m_feedGeneration {0};  ///< Monotonic generation counter for shadow directories.
+    std::shared_ptr<utils::rocksdb::RocksDBWrapper> m_retiredFeedDatabase; ///< Replaced generation, cleanup deferred.
+    std::string m_retiredFeedPath; ///< Directory of the replaced generation.
 };
 
 #endif // _DATABASE_FEED_MANAGER_HPP
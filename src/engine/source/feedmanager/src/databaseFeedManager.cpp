@@ -9,7 +9,12 @@
  * Foundation.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <thread>
 
 #include <base/logging.hpp>
 #include <fs/archiveHelper.hpp>
@@ -18,6 +23,7 @@
 #include "databaseFeedManager.hpp"
 #include "eventDecoder.hpp"
 #include "storeModel.hpp"
+#include "updateCVECandidates.hpp"
 
 const std::string CONTENT_NAME {"vd_1.0.0_vd_4.10.0"};                            // Content name.
 const std::filesystem::path WAZUH_LIB_PATH {"/var/lib/wazuh-server/"};            //< Path to the lib server files.
@@ -29,12 +35,50 @@ const std::filesystem::path LEGACY_DB_PATH {WAZUH_LIB_TMP_PATH / "queue/"};
 const std::filesystem::path VD_FEED_DB_BASE_PATH {WAZUH_LIB_PATH / "vd/"};            //< Path to the current database.
 const std::filesystem::path VD_UPDATER_DB_BASE_PATH {WAZUH_LIB_PATH / "vd_updater/"}; //< Path to the updater database.
 
+constexpr auto FEED_GENERATION_PREFIX {"feed_gen_"};   //< Prefix of double-buffered feed generation folders.
+constexpr auto FEED_CURRENT_MARKER {"feed.current"};   //< Marker file naming the active feed generation folder.
+
 constexpr auto OFFSET_TRANSACTION_SIZE {1000};
 constexpr auto EMPTY_KEY {""};
 constexpr auto TRANSLATIONS_COLUMN {"translation"};
 constexpr auto VENDOR_MAP_COLUMN {"vendor_map"};
 constexpr auto OS_CPE_RULES_COLUMN {"oscpe_rules"};
 constexpr auto CNA_MAPPING_COLUMN {"cna_mapping"};
+constexpr auto SCAN_CHECKPOINTS_COLUMN {"scan_checkpoints"};
+
+namespace
+{
+/**
+ * @brief Reads the folder name of the active feed generation from the marker file.
+ *
+ * Falls back to the historical "feed" folder when no marker exists or the named folder is not a
+ * database, so trees written before the double-buffered swap open unchanged.
+ */
+std::string readCurrentFeedDir(const std::filesystem::path& basePath)
+{
+    std::string dirName;
+    if (std::ifstream marker {basePath / FEED_CURRENT_MARKER};
+        marker && std::getline(marker, dirName) && !dirName.empty()
+        && std::filesystem::exists(basePath / dirName / "CURRENT"))
+    {
+        return dirName;
+    }
+    return "feed";
+}
+
+/**
+ * @brief Atomically records the folder name of the active feed generation.
+ */
+void writeCurrentFeedDir(const std::filesystem::path& basePath, const std::string& dirName)
+{
+    const auto tmpMarker = basePath / (std::string {FEED_CURRENT_MARKER} + ".tmp");
+    {
+        std::ofstream marker {tmpMarker, std::ios::trunc};
+        marker << dirName << '\n';
+    }
+    std::filesystem::rename(tmpMarker, basePath / FEED_CURRENT_MARKER);
+}
+} // namespace
 
 DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex)
     : m_mutex(mutex)
@@ -91,7 +135,28 @@ DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex)
             std::filesystem::remove_all(LEGACY_DB_PATH);
         }
 
-        m_feedDatabase = std::make_unique<utils::rocksdb::RocksDBWrapper>(VD_FEED_DB_BASE_PATH / "feed", false);
+        // Resolve the active feed generation and drop stale generations left behind by an
+        // interrupted update.
+        const auto currentFeedDir = readCurrentFeedDir(VD_FEED_DB_BASE_PATH);
+        if (std::filesystem::exists(VD_FEED_DB_BASE_PATH))
+        {
+            for (const auto& entry : std::filesystem::directory_iterator(VD_FEED_DB_BASE_PATH))
+            {
+                if (const auto name = entry.path().filename().string();
+                    name != currentFeedDir && name.rfind(FEED_GENERATION_PREFIX, 0) == 0)
+                {
+                    std::filesystem::remove_all(entry.path());
+                }
+            }
+        }
+
+        if (currentFeedDir.rfind(FEED_GENERATION_PREFIX, 0) == 0)
+        {
+            m_feedGeneration = std::stoull(currentFeedDir.substr(std::string_view {FEED_GENERATION_PREFIX}.size()));
+        }
+
+        m_feedDatabasePath = (VD_FEED_DB_BASE_PATH / currentFeedDir).string();
+        m_feedDatabase = std::make_shared<utils::rocksdb::RocksDBWrapper>(m_feedDatabasePath, false);
 
         // Try to load global maps from the database, if it fails we throw an exception to force the download of
         // the complete feed.
@@ -104,7 +169,9 @@ DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex)
         {
             std::filesystem::remove_all(VD_FEED_DB_BASE_PATH);
             std::filesystem::remove_all(VD_UPDATER_DB_BASE_PATH);
-            m_feedDatabase = std::make_unique<utils::rocksdb::RocksDBWrapper>(VD_FEED_DB_BASE_PATH / "feed", false);
+            m_feedDatabasePath = (VD_FEED_DB_BASE_PATH / "feed").string();
+            m_feedGeneration = 0;
+            m_feedDatabase = std::make_shared<utils::rocksdb::RocksDBWrapper>(m_feedDatabasePath, false);
         }
 
         LOG_ERROR("Error opening the database: {}, trying to re-download the feed.", ex.what());
@@ -146,7 +213,7 @@ void DatabaseFeedManager::getVulnerabilityRemediation(
     const std::string& cveId, FlatbufferDataPair<NSVulnerabilityScanner::RemediationInfo>& dtoVulnRemediation)
 {
     // If the remediation information is not found in the database, we return because there is no remediation.
-    if (auto result = m_feedDatabase->get(cveId, dtoVulnRemediation.slice, REMEDIATIONS_COLUMN); !result)
+    if (auto result = feedDatabase()->get(cveId, dtoVulnRemediation.slice, REMEDIATIONS_COLUMN); !result)
     {
         return;
     }
@@ -165,9 +232,10 @@ void DatabaseFeedManager::getVulnerabilityRemediation(
 std::unordered_set<std::string> DatabaseFeedManager::getHotfixVulnerabilities(const std::string& hotfix)
 {
     std::unordered_set<std::string> hotfixVulnerabilities;
-    if (m_feedDatabase->columnExists(HOTFIXES_APPLICATIONS_COLUMN))
+    const auto feedDb = feedDatabase();
+    if (feedDb->columnExists(HOTFIXES_APPLICATIONS_COLUMN))
     {
-        for (const auto& [key, value] : m_feedDatabase->seek(hotfix, HOTFIXES_APPLICATIONS_COLUMN))
+        for (const auto& [key, value] : feedDb->seek(hotfix, HOTFIXES_APPLICATIONS_COLUMN))
         {
             hotfixVulnerabilities.insert(key);
         }
@@ -176,6 +244,11 @@ std::unordered_set<std::string> DatabaseFeedManager::getHotfixVulnerabilities(co
 }
 
 void DatabaseFeedManager::fillL2CacheTranslations()
+{
+    fillL2CacheTranslationsFrom(*feedDatabase());
+}
+
+void DatabaseFeedManager::fillL2CacheTranslationsFrom(utils::rocksdb::RocksDBWrapper& feedDatabase)
 {
     // Clear the Level 1 and Level 2 cache before filling the Level 2 cache
     m_translationL1Cache->clear();
@@ -186,7 +259,7 @@ void DatabaseFeedManager::fillL2CacheTranslations()
     m_translationFilter->clear();
 
     // Iterate over translations in the feed database
-    for (const auto& [key, value] : m_feedDatabase->begin(TRANSLATIONS_COLUMN))
+    for (const auto& [key, value] : feedDatabase.begin(TRANSLATIONS_COLUMN))
     {
         // Check if the cache is full
         if (m_translationL2Cache->isFull())
@@ -302,42 +375,118 @@ void DatabaseFeedManager::getVulnerabilitiesCandidates(
         throw std::runtime_error("Invalid package/cna name.");
     }
 
-    std::string packageNameWithSeparator;
-    packageNameWithSeparator.append(package.name);
-    packageNameWithSeparator.append("_CVE");
+    // The flatbuffer accessors read straight out of the pinned buffer (string_views into the blob), so once a
+    // blob is pinned and verified the scan loop performs no copies and no re-verification.
+    auto processPinnedCandidates = [&](const std::string& blob)
+    {
+        auto candidatesArray =
+            NSVulnerabilityScanner::GetScanVulnerabilityCandidateArray(reinterpret_cast<const uint8_t*>(blob.data()));
 
-    for (const auto& [key, value] : m_feedDatabase->seek(packageNameWithSeparator, cnaName))
+        if (candidatesArray)
+        {
+            for (const auto& candidate : *candidatesArray->candidates())
+            {
+                if (callback(cnaName, package, *candidate))
+                {
+                    // If the candidate is vulnerable, we stop looking for.
+                    break;
+                }
+            }
+        }
+    };
+
+    auto lookupPinnedCandidates = [&](const std::string& candidateKey) -> std::shared_ptr<const std::string>
     {
-        if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+        std::lock_guard<std::mutex> lock(m_candidateBlobCacheMutex);
+        if (auto cached = m_candidateBlobCache->getValue(cnaName + "_" + candidateKey))
+        {
+            return *cached;
+        }
+        return nullptr;
+    };
+
+    // Verify the blob once and pin it, so later scans of the same candidate skip the database read, the copy and
+    // the verification. The cache is dropped on feed updates.
+    auto pinCandidates = [&](const std::string& candidateKey,
+                             const char* data,
+                             const size_t size) -> std::shared_ptr<const std::string>
+    {
+        if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(data), size);
             !NSVulnerabilityScanner::VerifyScanVulnerabilityCandidateArrayBuffer(verifier))
         {
             throw std::runtime_error(
                 "Error getting ScanVulnerabilityCandidateArray object from rocksdb. FlatBuffers verifier failed");
         }
 
-        auto candidatesArray =
-            NSVulnerabilityScanner::GetScanVulnerabilityCandidateArray(reinterpret_cast<const uint8_t*>(value.data()));
+        auto blob = std::make_shared<const std::string>(data, size);
 
-        if (candidatesArray)
+        std::lock_guard<std::mutex> lock(m_candidateBlobCacheMutex);
+        m_candidateBlobCache->insertKey(cnaName + "_" + candidateKey, blob);
+        return blob;
+    };
+
+    // One generation snapshot for the whole lookup, so a concurrent feed swap is invisible here.
+    const auto feedDb = feedDatabase();
+
+    // Fast path: the inverted index built at feed-update time maps the normalized product name to its candidate
+    // keys, so the candidates are resolved with point lookups instead of a prefix scan over the CNA column.
+    if (const auto candidateIndexColumn = UpdateCVECandidates::createCandidateIndexColumnName(cnaName);
+        feedDb->columnExists(candidateIndexColumn))
+    {
+        if (rocksdb::PinnableSlice indexValue; feedDb->get(package.name, indexValue, candidateIndexColumn))
         {
-            for (const auto& candidate : *candidatesArray->candidates())
+            for (const auto& candidateKey :
+                 base::utils::string::split(indexValue.ToString(), CANDIDATE_INDEX_SEPARATOR))
             {
-                if (callback(cnaName, package, *candidate))
+                if (const auto pinned = lookupPinnedCandidates(candidateKey))
                 {
-                    // If the candidate is vulnerable, we stop looking for.
-                    break;
+                    processPinnedCandidates(*pinned);
+                }
+                else if (rocksdb::PinnableSlice candidateValue; feedDb->get(candidateKey, candidateValue, cnaName))
+                {
+                    processPinnedCandidates(*pinCandidates(candidateKey, candidateValue.data(), candidateValue.size()));
                 }
             }
         }
+
+        return;
+    }
+
+    // Fallback for feed databases built before the inverted index existed.
+    std::string packageNameWithSeparator;
+    packageNameWithSeparator.append(package.name);
+    packageNameWithSeparator.append("_CVE");
+
+    for (const auto& [key, value] : feedDb->seek(packageNameWithSeparator, cnaName))
+    {
+        if (const auto pinned = lookupPinnedCandidates(key))
+        {
+            processPinnedCandidates(*pinned);
+        }
+        else
+        {
+            processPinnedCandidates(*pinCandidates(key, value.data(), value.size()));
+        }
     }
 }
 
+void DatabaseFeedManager::clearCandidateBlobCache()
+{
+    std::lock_guard<std::mutex> lock(m_candidateBlobCacheMutex);
+    m_candidateBlobCache =
+        std::make_unique<LRUCache<std::string, std::shared_ptr<const std::string>>>(CANDIDATE_BLOB_CACHE_SIZE);
+}
+
 std::vector<PackageData> DatabaseFeedManager::checkAndTranslatePackage(const PackageData& package,
                                                                        const std::string& osPlatform)
 {
     std::vector<PackageData> vulnerabilityTranslations;
     const auto cacheKey = osPlatform + "_" + package.vendor + "_" + package.name;
 
+    // Agent scans run in parallel and the LRU caches reorder their entries on every read, so the whole lookup and
+    // fill sequence is serialized.
+    std::lock_guard<std::mutex> cacheLock(m_translationCacheMutex);
+
     auto translatePackage = [&](const auto& translations)
     {
         for (const auto& translation : translations)
@@ -402,7 +551,7 @@ std::vector<PackageData> DatabaseFeedManager::checkAndTranslatePackage(const Pac
 
 utils::rocksdb::RocksDBWrapper& DatabaseFeedManager::getCVEDatabase()
 {
-    return *m_feedDatabase;
+    return *feedDatabase();
 }
 
 // LCOV_EXCL_STOP
@@ -410,7 +559,7 @@ utils::rocksdb::RocksDBWrapper& DatabaseFeedManager::getCVEDatabase()
 void DatabaseFeedManager::getVulnerabiltyDescriptiveInformation(
     const std::string_view cveId, FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription>& resultContainer)
 {
-    if (m_feedDatabase->get(std::string(cveId), resultContainer.slice, DESCRIPTIONS_COLUMN) == false)
+    if (feedDatabase()->get(std::string(cveId), resultContainer.slice, DESCRIPTIONS_COLUMN) == false)
     {
         throw std::runtime_error(
             "Error getting VulnerabilityDescription object from rocksdb. Object not found for cveId: "
@@ -507,8 +656,19 @@ void DatabaseFeedManager::reloadGlobalMaps()
 {
     std::scoped_lock<std::shared_mutex> lock(m_mutex);
 
+    // Publish the new snapshot; readers holding the previous one keep it alive until they are done.
+    std::atomic_store(&m_globalMaps, loadGlobalMaps(*feedDatabase()));
+
+    // Load translations into the Level 2 cache
+    fillL2CacheTranslations();
+}
+
+std::shared_ptr<const GlobalMaps> DatabaseFeedManager::loadGlobalMaps(utils::rocksdb::RocksDBWrapper& feedDatabase) const
+{
+    auto globalMaps = std::make_shared<GlobalMaps>();
+
     std::string result;
-    if (!m_feedDatabase->get("FEED-GLOBAL", result, VENDOR_MAP_COLUMN))
+    if (!feedDatabase.get("FEED-GLOBAL", result, VENDOR_MAP_COLUMN))
     {
         throw std::runtime_error("Vendor map can not be found in DB.");
     }
@@ -517,38 +677,242 @@ void DatabaseFeedManager::reloadGlobalMaps()
         throw std::runtime_error("Vendor map is empty.");
     }
 
-    m_vendorsMap = nlohmann::json::parse(result);
+    globalMaps->vendorsMap = nlohmann::json::parse(result);
 
     rocksdb::PinnableSlice queryResult;
-    if (!m_feedDatabase->get("OSCPE-GLOBAL", queryResult, OS_CPE_RULES_COLUMN))
+    if (!feedDatabase.get("OSCPE-GLOBAL", queryResult, OS_CPE_RULES_COLUMN))
     {
         throw std::runtime_error("Error getting OS CPE rules content from rocksdb.");
     }
 
-    m_cpeMappings = nlohmann::json::parse(queryResult.ToString());
+    globalMaps->cpeMappings = nlohmann::json::parse(queryResult.ToString());
 
     // Load CNA mappings
-    if (!m_feedDatabase->get("CNA-MAPPING-GLOBAL", queryResult, CNA_MAPPING_COLUMN))
+    if (!feedDatabase.get("CNA-MAPPING-GLOBAL", queryResult, CNA_MAPPING_COLUMN))
     {
         throw std::runtime_error("Error getting CNA Mapping content from rocksdb.");
     }
-    m_cnaMappings = nlohmann::json::parse(queryResult.ToString());
+    globalMaps->cnaMappings = nlohmann::json::parse(queryResult.ToString());
 
-    // Load translations into the Level 2 cache
-    fillL2CacheTranslations();
+    return globalMaps;
+}
+
+std::shared_ptr<utils::rocksdb::RocksDBWrapper> DatabaseFeedManager::feedDatabase() const
+{
+    return std::atomic_load(&m_feedDatabase);
+}
+
+std::shared_ptr<utils::rocksdb::RocksDBWrapper> DatabaseFeedManager::startFeedUpdate()
+{
+    const auto shadowDir = std::string {FEED_GENERATION_PREFIX} + std::to_string(m_feedGeneration + 1);
+    const auto shadowPath = (VD_FEED_DB_BASE_PATH / shadowDir).string();
+
+    // The checkpoint hard-links the immutable files of the current generation, so taking it is
+    // cheap and the updater applies its deltas on top of the current content.
+    std::filesystem::remove_all(shadowPath);
+    feedDatabase()->createCheckpoint(shadowPath);
+
+    m_pendingShadowPath = shadowPath;
+    return std::make_shared<utils::rocksdb::RocksDBWrapper>(shadowPath, false);
+}
+
+void DatabaseFeedManager::commitFeedUpdate(std::shared_ptr<utils::rocksdb::RocksDBWrapper> shadow)
+{
+    if (!shadow || m_pendingShadowPath.empty())
+    {
+        throw std::runtime_error("No feed update in progress.");
+    }
+
+    shadow->flush();
+
+    // Build the new in-memory state from the shadow first: a shadow with invalid content is
+    // rejected here without touching the generation scans are reading.
+    auto globalMaps = loadGlobalMaps(*shadow);
+
+    // The generation retired by the previous commit has no readers left by now.
+    dropRetiredGeneration();
+
+    m_retiredFeedDatabase = feedDatabase();
+    m_retiredFeedPath = m_feedDatabasePath;
+
+    // Switch readers to the new generation. Scans load the pointer once per operation, so
+    // in-flight scans finish against the generation they started with.
+    std::atomic_store(&m_feedDatabase, std::move(shadow));
+    std::atomic_store(&m_globalMaps, std::shared_ptr<const GlobalMaps> {std::move(globalMaps)});
+    m_feedDatabasePath = m_pendingShadowPath;
+    m_pendingShadowPath.clear();
+    ++m_feedGeneration;
+    writeCurrentFeedDir(VD_FEED_DB_BASE_PATH, std::filesystem::path {m_feedDatabasePath}.filename().string());
+
+    // Refresh the derived caches from the new generation.
+    clearCandidateBlobCache();
+    {
+        std::lock_guard<std::mutex> cacheLock(m_translationCacheMutex);
+        fillL2CacheTranslationsFrom(*feedDatabase());
+    }
+}
+
+void DatabaseFeedManager::applyFeedEvents(const std::vector<nlohmann::json>& resources,
+                                          utils::rocksdb::RocksDBWrapper& feedDatabase)
+{
+    // Schema used by the convert phase, or nullptr for resources the decoder ingests as JSON.
+    const auto schemaFor = [](const nlohmann::json& resource) -> const char*
+    {
+        if (!resource.contains("resource") || !resource.contains("payload") || resource.value("type", "") != "create")
+        {
+            return nullptr;
+        }
+        const auto& name = resource.at("resource").get_ref<const std::string&>();
+        if (base::utils::string::startsWith(name, "CVE-"))
+        {
+            return cve5_SCHEMA;
+        }
+        if (base::utils::string::startsWith(name, "TID-"))
+        {
+            return packageTranslation_SCHEMA;
+        }
+        return nullptr;
+    };
+
+    // Convert the independent creations to flatbuffers across a pool; this is the CPU bound part
+    // of a feed apply, the writes below are cheap by comparison.
+    std::vector<flatbuffers::DetachedBuffer> converted(resources.size());
+    std::vector<std::exception_ptr> conversionErrors(resources.size());
+    std::atomic<std::size_t> nextEvent {0};
+
+    const auto poolSize =
+        std::min<std::size_t>(resources.size(), std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::thread> workers;
+    workers.reserve(poolSize);
+    for (std::size_t worker = 0; worker < poolSize; ++worker)
+    {
+        workers.emplace_back(
+            [&]()
+            {
+                for (auto i = nextEvent.fetch_add(1); i < resources.size(); i = nextEvent.fetch_add(1))
+                {
+                    const auto schema = schemaFor(resources.at(i));
+                    if (!schema)
+                    {
+                        continue;
+                    }
+
+                    try
+                    {
+                        flatbuffers::Parser parser;
+                        if (!parser.Parse(schema) || !parser.Parse(resources.at(i).at("payload").dump().c_str()))
+                        {
+                            throw std::runtime_error("Unable to parse payload: " + parser.error_);
+                        }
+                        converted.at(i) = parser.builder_.Release();
+                    }
+                    catch (...)
+                    {
+                        conversionErrors.at(i) = std::current_exception();
+                    }
+                }
+            });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    // Ingest in feed order, buffering every write into one batch committed at the end.
+    auto eventDecoder = std::make_shared<EventDecoder>();
+    eventDecoder->setLast(std::make_shared<StoreModel>());
+
+    const auto batch = feedDatabase.createBatch();
+    const std::vector<char> emptyMessage;
+    for (std::size_t i = 0; i < resources.size(); ++i)
+    {
+        if (conversionErrors.at(i))
+        {
+            std::rethrow_exception(conversionErrors.at(i));
+        }
+
+        auto eventContext = std::make_shared<EventContext>(EventContext {.message = emptyMessage,
+                                                                         .resource = resources.at(i),
+                                                                         .convertedPayload = std::move(converted.at(i)),
+                                                                         .feedDatabase = batch.get(),
+                                                                         .resourceType = ResourceType::UNKNOWN});
+        eventDecoder->handleRequest(std::move(eventContext));
+    }
+    batch->commit();
+}
+
+void DatabaseFeedManager::dropRetiredGeneration()
+{
+    if (!m_retiredFeedDatabase)
+    {
+        return;
+    }
+
+    if (m_retiredFeedDatabase.use_count() > 1)
+    {
+        // A reader still references the retired generation; retried on the next commit.
+        return;
+    }
+
+    m_retiredFeedDatabase.reset();
+    if (!m_retiredFeedPath.empty())
+    {
+        std::filesystem::remove_all(m_retiredFeedPath);
+        m_retiredFeedPath.clear();
+    }
+}
+
+std::shared_ptr<const GlobalMaps> DatabaseFeedManager::globalMaps() const
+{
+    auto globalMaps = std::atomic_load(&m_globalMaps);
+    if (!globalMaps)
+    {
+        // Nothing loaded yet; expose empty maps, as the members did before the snapshot existed.
+        static const auto EMPTY_MAPS {std::make_shared<const GlobalMaps>()};
+        return EMPTY_MAPS;
+    }
+    return globalMaps;
+}
+
+void DatabaseFeedManager::setAgentScanCheckpoint(const std::string& agentId, const std::string& feedVersion)
+{
+    const auto feedDb = feedDatabase();
+    if (!feedDb->columnExists(SCAN_CHECKPOINTS_COLUMN))
+    {
+        feedDb->createColumn(SCAN_CHECKPOINTS_COLUMN);
+    }
+
+    feedDb->put(agentId, feedVersion, SCAN_CHECKPOINTS_COLUMN);
+}
+
+std::string DatabaseFeedManager::getAgentScanCheckpoint(const std::string& agentId)
+{
+    const auto feedDb = feedDatabase();
+    if (!feedDb->columnExists(SCAN_CHECKPOINTS_COLUMN))
+    {
+        return {};
+    }
+
+    rocksdb::PinnableSlice checkpointValue;
+    if (!feedDb->get(agentId, checkpointValue, SCAN_CHECKPOINTS_COLUMN))
+    {
+        return {};
+    }
+
+    return checkpointValue.ToString();
 }
 
 auto DatabaseFeedManager::cnaMappings() const -> const nlohmann::json&
 {
-    return m_cnaMappings;
+    return globalMaps()->cnaMappings;
 }
 
 auto DatabaseFeedManager::cpeMappings() const -> const nlohmann::json&
 {
-    return m_cpeMappings;
+    return globalMaps()->cpeMappings;
 }
 
 auto DatabaseFeedManager::vendorsMap() const -> const nlohmann::json&
 {
-    return m_vendorsMap;
+    return globalMaps()->vendorsMap;
 }
@@ -15,6 +15,8 @@
 #include "base/utils/rocksDBWrapper.hpp"
 #include "flatbuffers/detached_buffer.h"
 #include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 enum class ResourceType
@@ -36,8 +38,14 @@ struct EventContext final
     const std::vector<char>& message;              ///< Message.
     const nlohmann::json& resource;                ///< Modified/created resource.
     flatbuffers::DetachedBuffer cve5Buffer;        ///< CVE data.
+    flatbuffers::DetachedBuffer convertedPayload;  ///< Payload already converted to a flatbuffer by the parallel
+                                                   ///< convert phase, empty when the decoder must convert it.
     utils::rocksdb::IRocksDBWrapper* feedDatabase; ///< CVEs database.
     ResourceType resourceType;                     ///< Resource type.
+    bool resourceUnchanged {false}; ///< True when the incoming resource is byte-identical to the stored one, so the
+                                    ///< write and the derived-table rebuilds are skipped.
+    std::unordered_set<std::string> affectedProducts; ///< Products whose candidates actually changed, for targeted
+                                                      ///< rescans instead of full-fleet ones.
 };
 
 #endif // _EVENT_CONTEXT_HPP
@@ -15,6 +15,7 @@
 #include "base/logging.hpp"
 #include "base/utils/chainOfResponsability.hpp"
 #include "base/utils/stringUtils.hpp"
+#include <cstring>
 #include "cve5_generated.h"
 #include "cve5_schema.h"
 #include "eventContext.hpp"
@@ -41,6 +42,34 @@ const static std::map<ResourceType, const char*> COLUMNS = {{ResourceType::CVE,
 class EventDecoder final : public utils::patterns::AbstractHandler<std::shared_ptr<EventContext>>
 {
 private:
+    /**
+     * @brief Writes a resource only when it differs from the stored value.
+     *
+     * @details Feed deltas re-send resources that did not change; comparing against the stored bytes before
+     * writing keeps RocksDB untouched for those, and flags the event so the derived-table rebuilds are skipped
+     * too.
+     *
+     * @param data Event context.
+     * @param value New serialized resource value.
+     * @param valueSize New serialized resource size.
+     * @param column Column family to write to.
+     */
+    static void putIfChanged(const std::shared_ptr<EventContext>& data,
+                             const char* value,
+                             const size_t valueSize,
+                             const std::string& column)
+    {
+        if (rocksdb::PinnableSlice storedValue;
+            data->feedDatabase->get(data->resource.at("resource"), storedValue, column)
+            && storedValue.size() == valueSize && std::memcmp(storedValue.data(), value, valueSize) == 0)
+        {
+            data->resourceUnchanged = true;
+            return;
+        }
+
+        data->feedDatabase->put(data->resource.at("resource"), rocksdb::Slice(value, valueSize), column);
+    }
+
     /**
      * @brief Process a CVE5 or Translation message.
      *
@@ -95,8 +124,20 @@ private:
                 if (!schema)
                 {
                     // Resources in JSON format.
-                    data->feedDatabase->put(
-                        data->resource.at("resource"), data->resource.at("payload").dump().c_str(), column);
+                    const auto payloadDump = data->resource.at("payload").dump();
+                    putIfChanged(data, payloadDump.data(), payloadDump.size(), column);
+                }
+                else if (data->convertedPayload.size())
+                {
+                    // Resources already converted by the parallel convert phase.
+                    putIfChanged(data,
+                                 reinterpret_cast<const char*>(data->convertedPayload.data()),
+                                 data->convertedPayload.size(),
+                                 column);
+                    if (data->resourceType == ResourceType::CVE)
+                    {
+                        data->cve5Buffer = std::move(data->convertedPayload);
+                    }
                 }
                 else
                 {
@@ -108,9 +149,10 @@ private:
                         throw std::runtime_error("Unable to parse payload: " + parser.error_);
                     }
 
-                    rocksdb::Slice flatbufferResource(reinterpret_cast<const char*>(parser.builder_.GetBufferPointer()),
-                                                      parser.builder_.GetSize());
-                    data->feedDatabase->put(data->resource.at("resource"), flatbufferResource, column);
+                    putIfChanged(data,
+                                 reinterpret_cast<const char*>(parser.builder_.GetBufferPointer()),
+                                 parser.builder_.GetSize(),
+                                 column);
                     if (data->resourceType == ResourceType::CVE)
                     {
                         flatbuffers::FlatBufferBuilder& builder = parser.builder_;
@@ -132,7 +174,8 @@ private:
                     // Resources in JSON format.
                     auto jsonData = nlohmann::json::parse(slice.data());
                     jsonData.patch_inplace(data->resource.at("operations"));
-                    data->feedDatabase->put(data->resource.at("resource"), jsonData.dump(), column);
+                    const auto jsonDump = jsonData.dump();
+                    putIfChanged(data, jsonDump.data(), jsonDump.size(), column);
                 }
                 else
                 {
@@ -174,10 +217,10 @@ private:
                         throw std::runtime_error("Unable to parse patched data: " + parser.error_);
                     }
 
-                    rocksdb::Slice flatbufferResource(reinterpret_cast<const char*>(parser.builder_.GetBufferPointer()),
-                                                      parser.builder_.GetSize());
-
-                    data->feedDatabase->put(data->resource.at("resource"), flatbufferResource, column);
+                    putIfChanged(data,
+                                 reinterpret_cast<const char*>(parser.builder_.GetBufferPointer()),
+                                 parser.builder_.GetSize(),
+                                 column);
 
                     if (data->resourceType == ResourceType::CVE)
                     {
@@ -216,6 +259,16 @@ public:
     {
         processEvent(data);
 
+        // Unchanged resources need no model conversion nor derived-table rebuilds.
+        if (data->resourceUnchanged)
+        {
+            LOG_DEBUG("Resource '{}' is unchanged, skipping ingestion.",
+                      data->resource.contains("resource")
+                          ? data->resource.at("resource").get_ref<const std::string&>()
+                          : "unknown");
+            return nullptr;
+        }
+
         // Only CVEs need more processing because needs convert the model.
         if (data->resourceType == ResourceType::CVE)
         {
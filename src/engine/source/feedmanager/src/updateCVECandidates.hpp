@@ -12,6 +12,10 @@
 #ifndef _UPDATE_CVE_CANDIDATES_HPP
 #define _UPDATE_CVE_CANDIDATES_HPP
 
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+
 #include "base/utils/rocksDBWrapper.hpp"
 #include "base/utils/stringUtils.hpp"
 #include "cve5_generated.h"
@@ -23,6 +27,8 @@ const std::unordered_map<std::string, NSVulnerabilityScanner::Status> VERSION_ST
     {"unknown", NSVulnerabilityScanner::Status::Status_unknown}};
 
 const std::string CVE_PACKAGE_COLUMN_NAME_PREFIX {"cve_package"};
+const std::string CANDIDATE_INDEX_COLUMN_NAME_PREFIX {"candidate_index"};
+constexpr char CANDIDATE_INDEX_SEPARATOR {'\n'};
 
 /**
  * @brief UpdateCVECandidates class.
@@ -31,14 +37,115 @@ const std::string CVE_PACKAGE_COLUMN_NAME_PREFIX {"cve_package"};
 class UpdateCVECandidates final
 {
 public:
+    /**
+     * @brief Builds the name of the inverted candidate index column for a CNA/ADP.
+     *
+     * @details The index column maps a normalized product name to the list of candidate keys
+     * (product_CVE-XXXX-XXXX) stored in the CNA column, so candidate resolution is a single point lookup instead
+     * of a prefix scan.
+     *
+     * @param shortName CNA/ADP short name.
+     * @return std::string Index column name.
+     */
+    static std::string createCandidateIndexColumnName(std::string_view shortName)
+    {
+        std::string candidateIndexColumnName;
+        candidateIndexColumnName.reserve(CANDIDATE_INDEX_COLUMN_NAME_PREFIX.size() + 1 + shortName.size());
+
+        candidateIndexColumnName += CANDIDATE_INDEX_COLUMN_NAME_PREFIX;
+        candidateIndexColumnName += "_";
+        candidateIndexColumnName += shortName;
+
+        return candidateIndexColumnName;
+    }
+
+    /**
+     * @brief Adds a candidate key to the inverted index entry of a product.
+     *
+     * @param product Normalized product name (index key).
+     * @param candidateKey Candidate key (product_CVE-XXXX-XXXX) to add.
+     * @param indexColumnName Index column name.
+     * @param feedDatabase rocksDB wrapper instance.
+     */
+    static void addToCandidateIndex(const std::string& product,
+                                    const std::string& candidateKey,
+                                    const std::string& indexColumnName,
+                                    utils::rocksdb::IRocksDBWrapper* feedDatabase)
+    {
+        std::string indexValue;
+        if (::rocksdb::PinnableSlice indexSlice; feedDatabase->get(product, indexSlice, indexColumnName))
+        {
+            indexValue = indexSlice.ToString();
+            const auto entries = base::utils::string::split(indexValue, CANDIDATE_INDEX_SEPARATOR);
+            if (std::find(entries.begin(), entries.end(), candidateKey) != entries.end())
+            {
+                return;
+            }
+
+            indexValue += CANDIDATE_INDEX_SEPARATOR;
+        }
+
+        indexValue += candidateKey;
+        feedDatabase->put(product, indexValue, indexColumnName);
+    }
+
+    /**
+     * @brief Removes a candidate key from the inverted index entry of a product.
+     *
+     * @details The index entry is deleted once its last candidate key is removed.
+     *
+     * @param product Normalized product name (index key).
+     * @param candidateKey Candidate key (product_CVE-XXXX-XXXX) to remove.
+     * @param indexColumnName Index column name.
+     * @param feedDatabase rocksDB wrapper instance.
+     */
+    static void removeFromCandidateIndex(const std::string& product,
+                                         const std::string& candidateKey,
+                                         const std::string& indexColumnName,
+                                         utils::rocksdb::IRocksDBWrapper* feedDatabase)
+    {
+        ::rocksdb::PinnableSlice indexSlice;
+        if (!feedDatabase->get(product, indexSlice, indexColumnName))
+        {
+            return;
+        }
+
+        const auto indexValue = indexSlice.ToString();
+
+        std::string newIndexValue;
+        for (const auto& entry : base::utils::string::split(indexValue, CANDIDATE_INDEX_SEPARATOR))
+        {
+            if (entry != candidateKey && !entry.empty())
+            {
+                if (!newIndexValue.empty())
+                {
+                    newIndexValue += CANDIDATE_INDEX_SEPARATOR;
+                }
+                newIndexValue += entry;
+            }
+        }
+
+        if (newIndexValue.empty())
+        {
+            feedDatabase->delete_(product, indexColumnName);
+        }
+        else if (newIndexValue != indexValue)
+        {
+            feedDatabase->put(product, newIndexValue, indexColumnName);
+        }
+    }
+
     /**
      * @brief Inserts the candidate data into the corresponding database.
      *
      * @param cve5Flatbuffer CVE5 Flatbuffer.
      * @param feedDatabase rocksDB wrapper instance.
+     * @param affectedProducts Optional output set collecting the products whose candidates were written or
+     * removed, so callers can scope a rescan to them instead of the whole fleet.
      */
     static void storeVulnerabilityCandidate(const cve_v5::Entry* cve5Flatbuffer,
-                                            utils::rocksdb::IRocksDBWrapper* feedDatabase)
+                                            utils::rocksdb::IRocksDBWrapper* feedDatabase,
+                                            std::unordered_set<std::string>* affectedProducts = nullptr)
     {
         if (!cve5Flatbuffer || !cve5Flatbuffer->containers())
         {
@@ -148,6 +255,7 @@ public:
             }
 
             const auto CVE_PACKAGE_COLUMN_NAME = createPackageColumnName(shortName);
+            const auto CANDIDATE_INDEX_COLUMN_NAME = createCandidateIndexColumnName(shortName);
 
             // Get all candidates stored in the database.
             // If some of the candidates are already store, and is removed in the new feed, we need to remove it from
@@ -170,6 +278,12 @@ public:
                 {
                     feedDatabase->delete_(packageCve, shortName);
                     feedDatabase->delete_(cvePackage, CVE_PACKAGE_COLUMN_NAME);
+                    removeFromCandidateIndex(packageCandidate, packageCve, CANDIDATE_INDEX_COLUMN_NAME, feedDatabase);
+
+                    if (affectedProducts)
+                    {
+                        affectedProducts->insert(packageCandidate);
+                    }
                 }
             }
 
@@ -193,7 +307,14 @@ public:
                 {
                     feedDatabase->put(finalKey, slice, shortName);
                     feedDatabase->put(reverseKey, finalKey, CVE_PACKAGE_COLUMN_NAME);
+
+                    if (affectedProducts)
+                    {
+                        affectedProducts->insert(key);
+                    }
                 }
+
+                addToCandidateIndex(key, finalKey, CANDIDATE_INDEX_COLUMN_NAME, feedDatabase);
             }
         };
 
@@ -220,6 +341,13 @@ public:
                     feedDatabase->createColumn(CVE_PACKAGE_COLUMN_NAME);
                 }
 
+                // Create the inverted index column for point candidate lookups.
+                if (const auto CANDIDATE_INDEX_COLUMN_NAME = createCandidateIndexColumnName(shortName);
+                    !feedDatabase->columnExists(CANDIDATE_INDEX_COLUMN_NAME))
+                {
+                    feedDatabase->createColumn(CANDIDATE_INDEX_COLUMN_NAME);
+                }
+
                 candidateLambda(adp->affected(), shortName);
             }
         }
@@ -252,6 +380,13 @@ public:
                 feedDatabase->createColumn(CVE_PACKAGE_COLUMN_NAME);
             }
 
+            // Create the inverted index column for point candidate lookups.
+            if (const auto CANDIDATE_INDEX_COLUMN_NAME = createCandidateIndexColumnName(shortName);
+                !feedDatabase->columnExists(CANDIDATE_INDEX_COLUMN_NAME))
+            {
+                feedDatabase->createColumn(CANDIDATE_INDEX_COLUMN_NAME);
+            }
+
             candidateLambda(cna->affected(), shortName);
         }
     }
@@ -261,9 +396,12 @@ public:
      *
      * @param cve5Flatbuffer Flatbuffer object containing the CVE information.
      * @param feedDatabase rocksDB wrapper instance.
+     * @param affectedProducts Optional output set collecting the products whose candidates were removed, so
+     * callers can scope a rescan to them instead of the whole fleet.
      */
     static void removeVulnerabilityCandidate(const cve_v5::Entry* cve5Flatbuffer,
-                                             utils::rocksdb::IRocksDBWrapper* feedDatabase)
+                                             utils::rocksdb::IRocksDBWrapper* feedDatabase,
+                                             std::unordered_set<std::string>* affectedProducts = nullptr)
     {
         if (!cve5Flatbuffer->cveMetadata() || !cve5Flatbuffer->cveMetadata()->cveId())
         {
@@ -282,13 +420,16 @@ public:
             return cvePackageColumnName;
         };
 
-        const auto cveId = cve5Flatbuffer->cveMetadata()->cveId()->str() + "_";
+        const auto cveIdPlain = cve5Flatbuffer->cveMetadata()->cveId()->str();
+        const auto cveId = cveIdPlain + "_";
 
         const auto cnaNames = feedDatabase->getAllColumns();
 
         for (const auto& cnaName : cnaNames)
         {
             const auto CVE_PACKAGE_COLUMN_NAME = createPackageColumnName(cnaName);
+            const auto CANDIDATE_INDEX_COLUMN_NAME = createCandidateIndexColumnName(cnaName);
+            const auto candidateIndexExists = feedDatabase->columnExists(CANDIDATE_INDEX_COLUMN_NAME);
 
             if (feedDatabase->columnExists(CVE_PACKAGE_COLUMN_NAME))
             {
@@ -297,6 +438,22 @@ public:
                 for (const auto& [cvePackage, packageCve] : feedDatabase->seek(cveId, CVE_PACKAGE_COLUMN_NAME))
                 {
                     feedDatabase->delete_(packageCve.ToString(), cnaName);
+
+                    // Remove _CVE-XXXX-XXXX from the key to recover the product name.
+                    auto product = packageCve.ToString();
+                    base::utils::string::replaceFirst(product, "_" + cveIdPlain, "");
+
+                    if (candidateIndexExists)
+                    {
+                        removeFromCandidateIndex(
+                            product, packageCve.ToString(), CANDIDATE_INDEX_COLUMN_NAME, feedDatabase);
+                    }
+
+                    if (affectedProducts)
+                    {
+                        affectedProducts->insert(product);
+                    }
+
                     cvePackagesToDelete.push_back(cvePackage);
                 }
 
@@ -1,19 +1,45 @@
 #ifndef _GEO_DOWNLOADER_HPP
 #define _GEO_DOWNLOADER_HPP
 
+#include <memory>
+#include <mutex>
+
 #include <geo/idownloader.hpp>
 
 namespace geo
 {
+
+/**
+ * @brief Connections kept alive in the libcurl handle cache by default.
+ */
+constexpr long DEFAULT_MAX_CONNECTIONS = 5;
+
 class Downloader : public IDownloader
 {
 public:
-    Downloader() = default;
+    /**
+     * @brief Construct a downloader with a persistent connection cache.
+     *
+     * The libcurl easy handle is created once and reused for every download, so consecutive
+     * requests against the same host keep the TCP connection alive and resume the TLS session
+     * instead of paying the full handshake each time.
+     *
+     * @param maxConnections Amount of connections kept alive in the handle cache.
+     * @throws std::runtime_error If the libcurl handle could not be created.
+     */
+    explicit Downloader(long maxConnections = DEFAULT_MAX_CONNECTIONS);
     virtual ~Downloader() = default;
 
     base::RespOrError<std::string> downloadHTTPS(const std::string& url) const override;
+    base::RespOrError<std::string>
+    downloadHTTPSStream(const std::string& url,
+                        const std::function<void(std::string_view)>& onChunk) const override;
     std::string computeMD5(const std::string& data) const override;
     base::RespOrError<std::string> downloadMD5(const std::string& url) const override;
+
+private:
+    std::shared_ptr<void> m_curl; ///< Reused libcurl easy handle, opaque to keep curl out of the public header.
+    mutable std::mutex m_mutex;   ///< Serializes downloads, easy handles are not thread-safe.
 };
 } // namespace geo
 
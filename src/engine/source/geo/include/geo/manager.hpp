@@ -19,6 +19,7 @@ namespace geo
 class DbEntry;
 
 auto constexpr MAX_RETRIES = 3;
+auto constexpr DEFAULT_LOOKUP_CACHE_SIZE = 10000; ///< Default per-database lookup cache capacity (entries).
 static const std::string INTERNAL_NAME = "geo";
 static const std::string PATH_PATH = "/path";
 static const std::string HASH_PATH = "/hash";
@@ -33,6 +34,7 @@ private:
 
     std::shared_ptr<store::IStoreInternal> m_store; ///< The store used to store the MMDB hash.
     std::shared_ptr<IDownloader> m_downloader;      ///< The downloader used to download the MMDB database.
+    std::size_t m_cacheSize;                        ///< The lookup cache capacity for each database.
 
     /**
      * @brief Upsert the internal store entry for a database.
@@ -69,19 +71,31 @@ private:
     base::OptError removeDbUnsafe(const std::string& path);
 
     /**
-     * @brief Write the MMDB database to the filesystem.
+     * @brief Swap the staged MMDB download over the destination path.
+     *
+     * The database is staged as '<path>.tmp' while it streams from the remote; the rename keeps
+     * the previous inode intact for in-flight lookups that still map it.
      *
      * @param path Path to store the database.
-     * @param content The content of the database.
-     * @return base::OptError An error if the database could not be written.
+     * @return base::OptError An error if the staged file could not be renamed.
      */
-    base::OptError writeDb(const std::string& path, const std::string& content);
+    base::OptError swapDb(const std::string& path);
 
 public:
     virtual ~Manager() = default;
 
     Manager() = delete;
-    Manager(const std::shared_ptr<store::IStoreInternal>& store, const std::shared_ptr<IDownloader>& downloader);
+
+    /**
+     * @brief Construct a new Manager.
+     *
+     * @param store The store used to store the MMDB hash.
+     * @param downloader The downloader used to download the MMDB database.
+     * @param cacheSize The lookup cache capacity for each database, in entries.
+     */
+    Manager(const std::shared_ptr<store::IStoreInternal>& store,
+            const std::shared_ptr<IDownloader>& downloader,
+            std::size_t cacheSize = DEFAULT_LOOKUP_CACHE_SIZE);
 
     /**
      * @copydoc IManager::listDbs
@@ -108,6 +122,11 @@ public:
      * @copydoc IManager::getLocator
      */
     base::RespOrError<std::shared_ptr<ILocator>> getLocator(Type type) const override;
+
+    /**
+     * @copydoc IManager::getFullEnrichment
+     */
+    base::RespOrError<json::Json> getFullEnrichment(const std::string& ip) const override;
 };
 
 } // namespace geo
@@ -1,7 +1,9 @@
 #ifndef _GEO_IDOWNLOADER_HPP
 #define _GEO_IDOWNLOADER_HPP
 
+#include <functional>
 #include <string>
+#include <string_view>
 
 #include <base/error.hpp>
 
@@ -13,6 +15,21 @@ public:
     virtual ~IDownloader() = default;
 
     virtual base::RespOrError<std::string> downloadHTTPS(const std::string& url) const = 0;
+
+    /**
+     * @brief Download a URL delivering the body in chunks as the bytes arrive.
+     *
+     * The body is never accumulated, so the resident memory is bounded by the chunk size
+     * regardless of the download size. An exception thrown by the callback aborts the transfer.
+     *
+     * @param url The URL to download.
+     * @param onChunk Callback invoked with each received chunk, in order.
+     * @return base::RespOrError<std::string> MD5 hex digest of the streamed body, so callers can
+     * verify it without keeping the body around, or an error if the download failed.
+     */
+    virtual base::RespOrError<std::string>
+    downloadHTTPSStream(const std::string& url, const std::function<void(std::string_view)>& onChunk) const = 0;
+
     virtual std::string computeMD5(const std::string& data) const = 0;
     virtual base::RespOrError<std::string> downloadMD5(const std::string& url) const = 0;
 };
@@ -2,6 +2,7 @@
 #define _GEO_ILOCATOR_HPP
 
 #include <string>
+#include <vector>
 
 #include <base/dotPath.hpp>
 #include <base/error.hpp>
@@ -56,6 +57,31 @@ public:
      * @note this method not supported array or object type.
      */
     virtual base::RespOrError<json::Json> getAsJson(const std::string& ip, const DotPath& path) = 0;
+
+    /**
+     * @brief Field of a bulk enrichment: where the data lives in the database and where it goes in
+     * the resulting fragment.
+     *
+     */
+    struct EnrichmentField
+    {
+        DotPath source;     ///< Dot path of the data in the database.
+        std::string target; ///< JSON pointer path of the data in the resulting fragment.
+    };
+
+    /**
+     * @brief Get several fields in a single pass.
+     *
+     * The address is parsed and looked up once for the whole field set; each field found is set in
+     * the resulting fragment at its target path, missing fields are skipped.
+     *
+     * @param ip Target ip to query.
+     * @param fields The fields to retrieve.
+     * @return base::RespOrError<json::Json> The enrichment fragment or an error if the address
+     * could not be looked up.
+     */
+    virtual base::RespOrError<json::Json> getEnrichment(const std::string& ip,
+                                                        const std::vector<EnrichmentField>& fields) = 0;
 };
 
 } // namespace geo
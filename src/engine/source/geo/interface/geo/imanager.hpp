@@ -135,6 +135,19 @@ public:
      * locator could not be retrieved.
      */
     virtual base::RespOrError<std::shared_ptr<ILocator>> getLocator(Type type) const = 0;
+
+    /**
+     * @brief Enrich an address against every configured database in a single pass.
+     *
+     * The address is parsed and looked up once per database; the fields found are emitted together
+     * as an ECS-shaped fragment, city data under "/geo" and ASN data under "/as". A database where
+     * the address is not found contributes nothing.
+     *
+     * @param ip The IP address to enrich.
+     * @return base::RespOrError<json::Json> The enrichment fragment, or an error if no database is
+     * configured or the address could not be looked up in any of them.
+     */
+    virtual base::RespOrError<json::Json> getFullEnrichment(const std::string& ip) const = 0;
 };
 
 } // namespace geo
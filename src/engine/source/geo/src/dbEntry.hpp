@@ -1,32 +1,81 @@
 #ifndef _GEO_DBENTRY_HPP
 #define _GEO_DBENTRY_HPP
 
+#include <atomic>
 #include <memory>
-#include <shared_mutex>
 
 #include <maxminddb.h>
+#include <unistd.h>
 
+#include <base/json.hpp>
+#include <base/utils/shardedLRUCache.hpp>
 #include <geo/imanager.hpp>
 
 namespace geo
 {
 
+/**
+ * @brief A cached data fragment extracted from the database.
+ *
+ * Keeps the original MMDB data type next to the JSON representation so the typed
+ * getters can apply the same type checks on a cache hit as on a database read.
+ */
+struct CachedData
+{
+    uint32_t mmdbType; ///< The MMDB data type of the fragment.
+    json::Json data;   ///< The fragment as JSON.
+};
+
 /**
  * @brief Class to hold the needed information for a database.
+ *
+ * The MMDB handle is immutable once opened: a reload opens a fresh memory-mapped
+ * database and publishes it atomically, so lookups take a snapshot of the current
+ * handle without locking and the old mapping is unmapped when its last reader
+ * releases it.
  */
 class DbEntry
 {
+private:
+    std::shared_ptr<const MMDB_s> m_mmdb; ///< Current MMDB handle, accessed atomically.
+
+    /**
+     * @brief Touch every page of a mapping so the first lookups after a swap do
+     * not pay the page faults.
+     *
+     * @param mmdb The freshly opened database.
+     */
+    static void warmup(const MMDB_s& mmdb)
+    {
+        if (mmdb.file_content == nullptr || mmdb.file_size <= 0)
+        {
+            return;
+        }
+
+        static const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        volatile uint8_t sink = 0;
+        for (std::size_t offset = 0; offset < static_cast<std::size_t>(mmdb.file_size); offset += pageSize)
+        {
+            sink = sink + mmdb.file_content[offset];
+        }
+    }
+
 public:
-    std::string path;                  ///< The path to the database.
-    Type type;                         ///< The type of database.
-    mutable std::shared_mutex rwMutex; ///< Read-Write mutex for thread safety access to the MMDB database.
-    std::unique_ptr<MMDB_s> mmdb;      ///< The MMDB database.
+    static constexpr std::size_t DEFAULT_CACHE_SIZE = 10000; ///< Default lookup cache capacity.
+
+    const std::string path; ///< The path to the database.
+    const Type type;        ///< The type of database.
 
-    DbEntry(const std::string& path, Type type)
+    /// Lookup result cache keyed by address and path, shared by every locator of
+    /// this database. Cleared on reload, as the cached fragments belong to the old
+    /// mapping.
+    base::utils::ShardedLRUCache<std::string, CachedData> cache;
+
+    DbEntry(const std::string& path, Type type, std::size_t cacheSize = DEFAULT_CACHE_SIZE)
         : path(path)
         , type(type)
+        , cache(cacheSize)
     {
-        mmdb = std::make_unique<MMDB_s>();
     }
 
     DbEntry(const DbEntry&) = delete;
@@ -34,12 +83,57 @@ public:
     DbEntry(DbEntry&&) = delete;
     DbEntry& operator=(DbEntry&&) = delete;
 
-    ~DbEntry()
+    ~DbEntry() = default;
+
+    /**
+     * @brief Open the database at path memory-mapped and publish it as the current
+     * handle, replacing the previous one if any.
+     *
+     * Double-buffered: the new mapping is opened and warmed while the previous one
+     * keeps serving lookups, then swapped in atomically. The previous mapping is
+     * closed once every lookup holding a snapshot of it has finished.
+     *
+     * @return int MMDB_SUCCESS or the libmaxminddb status code on failure.
+     */
+    int open()
     {
-        if (mmdb != nullptr)
+        auto* mmdb = new MMDB_s;
+        int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, mmdb);
+        if (MMDB_SUCCESS != status)
         {
-            MMDB_close(mmdb.get());
+            delete mmdb;
+            return status;
         }
+
+        // Fault the new mapping in before it becomes visible to lookups
+        warmup(*mmdb);
+
+        std::atomic_store_explicit(&m_mmdb,
+                                   std::shared_ptr<const MMDB_s>(mmdb,
+                                                                 [](const MMDB_s* db)
+                                                                 {
+                                                                     MMDB_close(const_cast<MMDB_s*>(db));
+                                                                     delete db;
+                                                                 }),
+                                   std::memory_order_release);
+
+        // Cached fragments were extracted from the previous mapping
+        cache.clear();
+
+        return MMDB_SUCCESS;
+    }
+
+    /**
+     * @brief Get a snapshot of the current MMDB handle, nullptr if it was never opened.
+     *
+     * Lock-free; the mapping stays valid for as long as the returned pointer is held,
+     * even across a concurrent reload.
+     *
+     * @return std::shared_ptr<const MMDB_s>
+     */
+    std::shared_ptr<const MMDB_s> handle() const
+    {
+        return std::atomic_load_explicit(&m_mmdb, std::memory_order_acquire);
     }
 };
 } // namespace geo
@@ -5,17 +5,54 @@
 #include <iomanip>
 #include <openssl/evp.h>
 #include <sstream>
+#include <stdexcept>
 
 #include <fmt/format.h>
 
 namespace
 {
-// This write callback function will be called by libcurl as soon as there is data received that needs to be saved.
-// For most transfers, this callback gets called many times and each invoke delivers another chunk of data.
-size_t writeCallback(void* contents, size_t size, size_t nmemb, std::string* userp)
+// Context handed to the libcurl write callback while a streaming download is in flight.
+struct StreamContext
 {
-    userp->append((char*)contents, size * nmemb);
-    return size * nmemb;
+    const std::function<void(std::string_view)>* onChunk; ///< Consumer callback for each received chunk.
+    EVP_MD_CTX* md5Ctx;                                   ///< Digest updated as the bytes arrive.
+    std::string error;                                    ///< First chunk handling error, aborts the transfer.
+};
+
+// This write callback function will be called by libcurl as soon as there is data received that needs to be handed
+// to the consumer. For most transfers, this callback gets called many times and each invoke delivers another chunk
+// of data. Returning less than the received size aborts the transfer.
+size_t writeCallback(void* contents, size_t size, size_t nmemb, StreamContext* ctx)
+{
+    const auto chunkSize = size * nmemb;
+    try
+    {
+        if (EVP_DigestUpdate(ctx->md5Ctx, contents, chunkSize) != 1)
+        {
+            ctx->error = "Failed to update the MD5 digest";
+            return 0;
+        }
+
+        (*ctx->onChunk)(std::string_view(static_cast<const char*>(contents), chunkSize));
+        return chunkSize;
+    }
+    catch (const std::exception& e)
+    {
+        ctx->error = e.what();
+        return 0;
+    }
+}
+
+// Renders a digest as the usual lowercase hex string.
+std::string digestToHex(const unsigned char* digest, unsigned int digestLen)
+{
+    std::stringstream ss;
+    for (unsigned int i = 0; i < digestLen; ++i)
+    {
+        ss << std::hex << std::setw(2) << std::setfill('0') << (int)digest[i];
+    }
+
+    return ss.str();
 }
 
 bool isMD5Hash(const std::string& str)
@@ -27,49 +64,92 @@ bool isMD5Hash(const std::string& str)
 
 namespace geo
 {
+Downloader::Downloader(long maxConnections)
+{
+    // Process-wide libcurl initialization, done once and never torn down since other instances may
+    // still be using the library.
+    static const CURLcode globalInit = curl_global_init(CURL_GLOBAL_DEFAULT);
+    if (globalInit != CURLE_OK)
+    {
+        throw std::runtime_error("Failed to initialize libcurl");
+    }
+
+    m_curl = std::shared_ptr<void>(curl_easy_init(), curl_easy_cleanup);
+    if (!m_curl)
+    {
+        throw std::runtime_error("Failed to create the libcurl handle");
+    }
+
+    auto curl = static_cast<CURL*>(m_curl.get());
+
+    // Enable SSL certificate verification
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 1L);
+
+    // Set option to follow redirects
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+
+    // Keep connections alive between downloads. Reusing the handle also keeps the TLS session
+    // cache, so requests against the same host resume the session instead of doing a full
+    // handshake.
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(curl, CURLOPT_MAXCONNECTS, maxConnections);
+
+    // Specify the write callback function
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
+}
+
 // Function to download content of the URL into a std::string in memory
 base::RespOrError<std::string> Downloader::downloadHTTPS(const std::string& url) const
 {
-    CURL* curl;
-    CURLcode res;
     std::string readBuffer;
 
-    curl_global_init(CURL_GLOBAL_DEFAULT);
-
-    curl = curl_easy_init();
-    if (curl)
+    auto resp = downloadHTTPSStream(url, [&readBuffer](std::string_view chunk) { readBuffer.append(chunk); });
+    if (base::isError(resp))
     {
-        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+        return base::getError(resp);
+    }
 
-        // Enable SSL certificate verification
-        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
-        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 1L);
+    return readBuffer;
+}
 
-        // Set option to follow redirects
-        curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+// Function to stream the content of the URL to the consumer chunk by chunk, hashing it on the fly
+base::RespOrError<std::string>
+Downloader::downloadHTTPSStream(const std::string& url, const std::function<void(std::string_view)>& onChunk) const
+{
+    // The reused handle is not thread-safe, serialize the downloads.
+    std::scoped_lock lock(m_mutex);
 
-        // Specify the write callback function
-        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
+    auto md5Ctx = std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)>(EVP_MD_CTX_new(), EVP_MD_CTX_free);
+    if (!md5Ctx || EVP_DigestInit_ex(md5Ctx.get(), EVP_md5(), nullptr) != 1)
+    {
+        return base::Error {"Failed to initialize the MD5 digest"};
+    }
 
-        // Set pointer to pass to our write function
-        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
+    StreamContext ctx {&onChunk, md5Ctx.get(), {}};
 
-        // Perform the request, res will get the return code
-        res = curl_easy_perform(curl);
+    auto curl = static_cast<CURL*>(m_curl.get());
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
 
-        // Check for errors
-        if (res != CURLE_OK)
-        {
-            return base::Error {
-                fmt::format("Failed to download file from '{}', error: {}", url, curl_easy_strerror(res))};
-        }
+    // Set pointer to pass to our write function
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &ctx);
 
-        // Always cleanup
-        curl_easy_cleanup(curl);
+    // Perform the request, res will get the return code
+    if (const auto res = curl_easy_perform(curl); res != CURLE_OK)
+    {
+        return base::Error {fmt::format("Failed to download file from '{}', error: {}",
+                                        url,
+                                        ctx.error.empty() ? curl_easy_strerror(res) : ctx.error.c_str())};
     }
 
-    curl_global_cleanup();
-    return readBuffer;
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digestLen {0};
+    if (EVP_DigestFinal_ex(md5Ctx.get(), digest, &digestLen) != 1)
+    {
+        return base::Error {"Failed to finalize the MD5 digest"};
+    }
+
+    return digestToHex(digest, digestLen);
 }
 
 // Function to compute the MD5 hash of input data
@@ -108,13 +188,7 @@ std::string Downloader::computeMD5(const std::string& data) const
 
     EVP_MD_CTX_free(ctx);
 
-    std::stringstream ss;
-    for (unsigned int i = 0; i < digest_len; ++i)
-    {
-        ss << std::hex << std::setw(2) << std::setfill('0') << (int)digest[i];
-    }
-
-    return ss.str();
+    return digestToHex(digest, digest_len);
 }
 
 base::RespOrError<std::string> Downloader::downloadMD5(const std::string& url) const
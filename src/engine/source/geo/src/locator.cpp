@@ -4,7 +4,7 @@
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
-#include <shared_mutex>
+#include <optional>
 #include <sstream>
 
 #include "dbEntry.hpp"
@@ -239,6 +239,48 @@ MMDB_entry_data_list_s* dumpEntryDataList(MMDB_entry_data_list_s* eDataList, jso
     return eDataList;
 }
 
+/**
+ * @brief Converts a simple MMDB entry data to its JSON representation.
+ *
+ * Follows the same conversions as Locator::getAsJson. Complex and unknown types
+ * are not representable as a cacheable fragment.
+ *
+ * @param eData The entry data to convert.
+ * @return The JSON representation, or std::nullopt for complex or unknown types.
+ */
+std::optional<json::Json> eDataToJson(const MMDB_entry_data_s& eData)
+{
+    json::Json result {};
+    switch (eData.type)
+    {
+        case MMDB_DATA_TYPE_UTF8_STRING: result.setString(std::string {eData.utf8_string, eData.data_size}); break;
+        case MMDB_DATA_TYPE_BYTES: result.setString(bytesToHexString(eData.bytes, eData.data_size)); break;
+        case MMDB_DATA_TYPE_DOUBLE: result.setDouble(eData.double_value); break;
+        case MMDB_DATA_TYPE_FLOAT: result.setDouble(eData.float_value); break;
+        case MMDB_DATA_TYPE_UINT16: result.setInt64(eData.uint16); break;
+        case MMDB_DATA_TYPE_UINT32: result.setInt64(eData.uint32); break;
+        case MMDB_DATA_TYPE_BOOLEAN: result.setBool(eData.boolean); break;
+        case MMDB_DATA_TYPE_UINT64: result.setString(std::to_string(eData.uint64)); break;
+        case MMDB_DATA_TYPE_UINT128: result.setString(uint128toHexString(eData.uint128)); break;
+        case MMDB_DATA_TYPE_INT32: result.setInt64(eData.int32); break;
+        default: return std::nullopt;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Builds the cache key for an address and path.
+ *
+ * @param ip The IP address.
+ * @param path The dot path of the fragment.
+ * @return The cache key.
+ */
+std::string cacheKey(const std::string& ip, const DotPath& path)
+{
+    return fmt::format("{}|{}", ip, path.str());
+}
+
 static const std::string TRANSLATE_ERROR = "Error translating IP address ";
 static const std::string LIBMMD_ERROR = "Error from libmaxminddb: ";
 
@@ -247,7 +289,39 @@ static const std::string LIBMMD_ERROR = "Error from libmaxminddb: ";
 namespace geo
 {
 
-base::OptError Locator::lookup(const std::string& ip, const std::shared_ptr<DbEntry>& entry)
+base::RespOrError<std::shared_ptr<DbEntry>> Locator::refreshHandle()
+{
+    // Check if the database entry is still valid
+    auto entry = m_weakDbEntry.lock();
+    if (entry == nullptr)
+    {
+        m_handle.reset();
+        m_cachedIp.clear();
+        return base::Error {"Database is not available"};
+    }
+
+    // Take a lock-free snapshot of the current handle, it keeps the mapping alive
+    // for the rest of the lookup even if the database is reloaded concurrently
+    auto handle = entry->handle();
+    if (handle == nullptr)
+    {
+        m_handle.reset();
+        m_cachedIp.clear();
+        return base::Error {"Database is not available"};
+    }
+
+    // Drop the cached result if the database was reloaded, it points into the old
+    // mapping
+    if (handle != m_handle)
+    {
+        m_handle = std::move(handle);
+        m_cachedIp.clear();
+    }
+
+    return entry;
+}
+
+base::OptError Locator::lookup(const std::string& ip)
 {
     // Check if the IP address is the same as the cached one
     if (ip == m_cachedIp)
@@ -257,7 +331,7 @@ base::OptError Locator::lookup(const std::string& ip, const std::shared_ptr<DbEn
 
     // Lookup the IP address in the database
     int gai_error, mmdb_error;
-    MMDB_lookup_result_s result = MMDB_lookup_string(entry->mmdb.get(), ip.c_str(), &gai_error, &mmdb_error);
+    MMDB_lookup_result_s result = MMDB_lookup_string(m_handle.get(), ip.c_str(), &gai_error, &mmdb_error);
 
     if (0 != gai_error) // translation error
     {
@@ -296,26 +370,28 @@ base::RespOrError<MMDB_entry_data_s> Locator::getEData(const DotPath& path)
 
 base::RespOrError<std::string> Locator::getString(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Refresh the handle snapshot, no locking on the lookup path
+    auto entryResp = refreshHandle();
+    if (base::isError(entryResp))
     {
-        return base::Error {"Database is not available"};
+        return base::getError(entryResp);
     }
+    auto& entry = base::getResponse(entryResp);
 
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Serve the fragment from the shared cache if it was already extracted
+    const auto key = cacheKey(ip, path);
+    if (auto cached = entry->cache.get(key); cached.has_value())
     {
-        return base::Error {"Database is not available"};
+        if (cached->mmdbType != MMDB_DATA_TYPE_UTF8_STRING)
+        {
+            return base::Error {"Data is not a string"};
+        }
+
+        return cached->data.getString().value();
     }
 
     // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    auto lookError = lookup(ip);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -330,6 +406,12 @@ base::RespOrError<std::string> Locator::getString(const std::string& ip, const D
 
     auto& eData = base::getResponse(eDataResp);
 
+    // Cache the fragment for the next lookups of this address
+    if (auto jData = eDataToJson(eData); jData.has_value())
+    {
+        entry->cache.insert(key, CachedData {eData.type, std::move(jData.value())});
+    }
+
     if (eData.type != MMDB_DATA_TYPE_UTF8_STRING)
     {
         return base::Error {"Data is not a string"};
@@ -340,26 +422,28 @@ base::RespOrError<std::string> Locator::getString(const std::string& ip, const D
 
 base::RespOrError<uint32_t> Locator::getUint32(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Refresh the handle snapshot, no locking on the lookup path
+    auto entryResp = refreshHandle();
+    if (base::isError(entryResp))
     {
-        return base::Error {"Database is not available"};
+        return base::getError(entryResp);
     }
+    auto& entry = base::getResponse(entryResp);
 
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Serve the fragment from the shared cache if it was already extracted
+    const auto key = cacheKey(ip, path);
+    if (auto cached = entry->cache.get(key); cached.has_value())
     {
-        return base::Error {"Database is not available"};
+        if (cached->mmdbType != MMDB_DATA_TYPE_UINT32)
+        {
+            return base::Error {"Data is not a uint32_t"};
+        }
+
+        return static_cast<uint32_t>(cached->data.getInt64().value());
     }
 
     // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    auto lookError = lookup(ip);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -374,6 +458,12 @@ base::RespOrError<uint32_t> Locator::getUint32(const std::string& ip, const DotP
 
     auto& eData = base::getResponse(eDataResp);
 
+    // Cache the fragment for the next lookups of this address
+    if (auto jData = eDataToJson(eData); jData.has_value())
+    {
+        entry->cache.insert(key, CachedData {eData.type, std::move(jData.value())});
+    }
+
     if (eData.type != MMDB_DATA_TYPE_UINT32)
     {
         return base::Error {"Data is not a uint32_t"};
@@ -384,26 +474,28 @@ base::RespOrError<uint32_t> Locator::getUint32(const std::string& ip, const DotP
 
 base::RespOrError<double> Locator::getDouble(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Refresh the handle snapshot, no locking on the lookup path
+    auto entryResp = refreshHandle();
+    if (base::isError(entryResp))
     {
-        return base::Error {"Database is not available"};
+        return base::getError(entryResp);
     }
+    auto& entry = base::getResponse(entryResp);
 
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Serve the fragment from the shared cache if it was already extracted
+    const auto key = cacheKey(ip, path);
+    if (auto cached = entry->cache.get(key); cached.has_value())
     {
-        return base::Error {"Database is not available"};
+        if (cached->mmdbType != MMDB_DATA_TYPE_DOUBLE)
+        {
+            return base::Error {"Data is not a double"};
+        }
+
+        return cached->data.getDouble().value();
     }
 
     // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    auto lookError = lookup(ip);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -418,6 +510,12 @@ base::RespOrError<double> Locator::getDouble(const std::string& ip, const DotPat
 
     auto& eData = base::getResponse(eDataResp);
 
+    // Cache the fragment for the next lookups of this address
+    if (auto jData = eDataToJson(eData); jData.has_value())
+    {
+        entry->cache.insert(key, CachedData {eData.type, std::move(jData.value())});
+    }
+
     if (eData.type != MMDB_DATA_TYPE_DOUBLE)
     {
         return base::Error {"Data is not a double"};
@@ -428,26 +526,23 @@ base::RespOrError<double> Locator::getDouble(const std::string& ip, const DotPat
 
 base::RespOrError<json::Json> Locator::getAsJson(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Refresh the handle snapshot, no locking on the lookup path
+    auto entryResp = refreshHandle();
+    if (base::isError(entryResp))
     {
-        return base::Error {"Database is not available"};
+        return base::getError(entryResp);
     }
+    auto& entry = base::getResponse(entryResp);
 
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Serve the fragment from the shared cache if it was already extracted
+    const auto key = cacheKey(ip, path);
+    if (auto cached = entry->cache.get(key); cached.has_value())
     {
-        return base::Error {"Database is not available"};
+        return cached->data;
     }
 
     // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    auto lookError = lookup(ip);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -462,6 +557,12 @@ base::RespOrError<json::Json> Locator::getAsJson(const std::string& ip, const Do
 
     auto& eData = base::getResponse(eDataResp);
 
+    // Cache the fragment for the next lookups of this address
+    if (auto jData = eDataToJson(eData); jData.has_value())
+    {
+        entry->cache.insert(key, CachedData {eData.type, std::move(jData.value())});
+    }
+
     json::Json result {};
     switch (eData.type)
     {
@@ -483,4 +584,62 @@ base::RespOrError<json::Json> Locator::getAsJson(const std::string& ip, const Do
     return result;
 }
 
+base::RespOrError<json::Json> Locator::getEnrichment(const std::string& ip, const std::vector<EnrichmentField>& fields)
+{
+    // Refresh the handle snapshot, no locking on the lookup path
+    auto entryResp = refreshHandle();
+    if (base::isError(entryResp))
+    {
+        return base::getError(entryResp);
+    }
+    auto& entry = base::getResponse(entryResp);
+
+    json::Json fragment {};
+    fragment.setObject();
+
+    // The address is parsed and looked up once for the whole field set; fully cached field sets
+    // skip the lookup altogether.
+    auto lookedUp = false;
+
+    for (const auto& field : fields)
+    {
+        // Serve the fragment from the shared cache if it was already extracted
+        const auto key = cacheKey(ip, field.source);
+        if (auto cached = entry->cache.get(key); cached.has_value())
+        {
+            fragment.set(field.target, cached->data);
+            continue;
+        }
+
+        if (!lookedUp)
+        {
+            auto lookError = lookup(ip);
+            if (base::isError(lookError))
+            {
+                return base::getError(lookError);
+            }
+            lookedUp = true;
+        }
+
+        // Missing or complex fields are skipped, mirroring the per-field getters
+        auto eDataResp = getEData(field.source);
+        if (base::isError(eDataResp))
+        {
+            continue;
+        }
+
+        auto& eData = base::getResponse(eDataResp);
+        auto jData = eDataToJson(eData);
+        if (!jData.has_value())
+        {
+            continue;
+        }
+
+        fragment.set(field.target, jData.value());
+        entry->cache.insert(key, CachedData {eData.type, std::move(jData.value())});
+    }
+
+    return fragment;
+}
+
 } // namespace geo
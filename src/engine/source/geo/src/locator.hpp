@@ -15,8 +15,9 @@ class Locator final : public ILocator
 private:
     std::weak_ptr<DbEntry> m_weakDbEntry; ///< The weak pointer to the database entry.
 
-    std::string m_cachedIp;              ///< The cached IP address.
-    MMDB_lookup_result_s m_cachedResult; ///< The cached lookup result.
+    std::shared_ptr<const MMDB_s> m_handle; ///< Snapshot of the MMDB handle the cached result points into.
+    std::string m_cachedIp;                 ///< The cached IP address.
+    MMDB_lookup_result_s m_cachedResult;    ///< The cached lookup result.
 
     /**
      * @brief Retrieves the entry data for a given dot path.
@@ -30,10 +31,20 @@ private:
      * @brief Looks up the given IP address in the database if it is not already cached.
      *
      * @param ip The IP address to look up.
-     * @param dbEntry The database entry to use for the lookup.
      * @return A base::OptError object containing an error message if the lookup failed.
      */
-    base::OptError lookup(const std::string& ip, const std::shared_ptr<DbEntry>& dbEntry);
+    base::OptError lookup(const std::string& ip);
+
+    /**
+     * @brief Refresh the MMDB handle snapshot from the database entry.
+     *
+     * Takes the current handle without locking; if the database was reloaded since
+     * the last call the cached lookup result is dropped, as it points into the old
+     * mapping.
+     *
+     * @return The database entry, or an error if no database is available.
+     */
+    base::RespOrError<std::shared_ptr<DbEntry>> refreshHandle();
 
 public:
     virtual ~Locator() = default;
@@ -74,6 +85,12 @@ public:
      */
     base::RespOrError<json::Json> getAsJson(const std::string& ip, const DotPath& path) override;
 
+    /**
+     * @copydoc ILocator::getEnrichment
+     */
+    base::RespOrError<json::Json> getEnrichment(const std::string& ip,
+                                                const std::vector<EnrichmentField>& fields) override;
+
     /**
      * @brief Retrieves the cached IP address.
      *
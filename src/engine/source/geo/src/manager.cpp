@@ -3,6 +3,7 @@
 #include <filesystem>
 #include <fstream>
 #include <mutex>
+#include <optional>
 
 #include <fmt/format.h>
 #include <maxminddb.h>
@@ -15,9 +16,12 @@
 
 namespace geo
 {
-Manager::Manager(const std::shared_ptr<store::IStoreInternal>& store, const std::shared_ptr<IDownloader>& downloader)
+Manager::Manager(const std::shared_ptr<store::IStoreInternal>& store,
+                 const std::shared_ptr<IDownloader>& downloader,
+                 std::size_t cacheSize)
     : m_store(store)
     , m_downloader(downloader)
+    , m_cacheSize(cacheSize)
 {
     if (m_store == nullptr)
     {
@@ -113,8 +117,8 @@ base::OptError Manager::addDbUnsafe(const std::string& path, Type type, bool ups
     }
 
     // Add the database
-    auto entry = std::make_shared<DbEntry>(path, type);
-    int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, entry->mmdb.get());
+    auto entry = std::make_shared<DbEntry>(path, type, m_cacheSize);
+    int status = entry->open();
     if (MMDB_SUCCESS != status)
     {
         return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
@@ -145,22 +149,9 @@ base::OptError Manager::removeDbUnsafe(const std::string& path)
         return base::Error {fmt::format("Database '{}' not found", name)};
     }
 
-    {
-        // We need to hold the entry so the lock is not released after the entry is removed
-        auto entry = m_dbs.at(name);
-
-        // Lock the database entry internal mutex for write
-        std::unique_lock<std::shared_mutex> lockEntry(entry->rwMutex);
-
-        // Remove the database
-        m_dbs.erase(name);
-
-        // Unlock the entry mutex
-        lockEntry.unlock();
-
-        // Freed the entry
-        entry.reset();
-    }
+    // Remove the database. In-flight lookups keep the mapping alive through their
+    // handle snapshot; locators notice the removal once the entry expires
+    m_dbs.erase(name);
 
     // Remove the type from the map if it was the one in use
     for (auto it = m_dbTypes.begin(); it != m_dbTypes.end(); ++it)
@@ -175,35 +166,19 @@ base::OptError Manager::removeDbUnsafe(const std::string& path)
     return removeInternalEntry(path);
 }
 
-base::OptError Manager::writeDb(const std::string& path, const std::string& content)
+base::OptError Manager::swapDb(const std::string& path)
 {
-    auto filePath = std::filesystem::path(path);
-
-    // Create directories if they do not exist
-    try
-    {
-        std::filesystem::create_directories(filePath.parent_path());
-    }
-    catch (const std::exception& e)
-    {
-        return base::Error {fmt::format("Cannot create directories for '{}': {}", path, e.what())};
-    }
-
-    // Write the content to the file
-    std::ofstream file(path, std::ios::binary);
-    if (!file.is_open())
-    {
-        return base::Error {fmt::format("Cannot open file '{}'", path)};
-    }
+    // Rename the staged file over the destination. The previous file may still be
+    // memory-mapped by in-flight lookups, the rename keeps its inode intact while
+    // new opens see the new content
+    auto tmpPath = path + ".tmp";
     try
     {
-        file.write(content.c_str(), content.size());
-        file.close();
+        std::filesystem::rename(tmpPath, path);
     }
     catch (const std::exception& e)
     {
-        file.close();
-        return base::Error {fmt::format("Cannot write to file '{}': {}", path, e.what())};
+        return base::Error {fmt::format("Cannot rename '{}' to '{}': {}", tmpPath, path, e.what())};
     }
 
     return base::noError();
@@ -232,13 +207,17 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
 {
     auto name = std::filesystem::path(path).filename().string();
 
-    // Hold write lock on the map
-    std::unique_lock lock(m_rwMapMutex);
+    // The download and hash phases run without the map lock, so lookups and
+    // locator requests are not stalled while the update is in flight
 
     // If the type has a different database, fail
-    if (m_dbTypes.find(type) != m_dbTypes.end() && m_dbTypes.at(type) != name)
     {
-        return base::Error {fmt::format("Type '{}' already has the database '{}'", typeName(type), m_dbTypes.at(type))};
+        std::shared_lock lock(m_rwMapMutex);
+        if (m_dbTypes.find(type) != m_dbTypes.end() && m_dbTypes.at(type) != name)
+        {
+            return base::Error {
+                fmt::format("Type '{}' already has the database '{}'", typeName(type), m_dbTypes.at(type))};
+        }
     }
 
     // Download the database hash
@@ -251,27 +230,58 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
     auto hash = base::getResponse(hashResp);
 
     // Check if it is already updated
-    auto entry = m_dbs.find(name);
-    if (entry != m_dbs.end())
     {
-        auto internalResp =
-            m_store->readInternalDoc(base::Name(fmt::format("{}{}{}", INTERNAL_NAME, base::Name::SEPARATOR_S, name)));
-        if (!base::isError(internalResp))
+        std::shared_lock lock(m_rwMapMutex);
+        if (m_dbs.find(name) != m_dbs.end())
         {
-            auto storedHash = base::getResponse(internalResp).getString(HASH_PATH).value();
-            if (storedHash == hash)
+            auto internalResp = m_store->readInternalDoc(
+                base::Name(fmt::format("{}{}{}", INTERNAL_NAME, base::Name::SEPARATOR_S, name)));
+            if (!base::isError(internalResp))
             {
-                return base::noError();
+                auto storedHash = base::getResponse(internalResp).getString(HASH_PATH).value();
+                if (storedHash == hash)
+                {
+                    return base::noError();
+                }
             }
         }
     }
 
+    // Stage the database next to its destination and stream the download straight into it, so
+    // the whole database is never resident in memory; the hash is verified from the digest
+    // computed while the bytes arrive
+    try
+    {
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Cannot create directories for '{}': {}", path, e.what())};
+    }
+
     // Download the database while MAX_RETRIES if failed
-    std::string content;
+    auto tmpPath = path + ".tmp";
     base::OptError error;
     for (int i = 0; i < MAX_RETRIES; ++i)
     {
-        auto dbResp = m_downloader->downloadHTTPS(dbUrl);
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            return base::Error {fmt::format("Cannot open file '{}'", tmpPath)};
+        }
+
+        auto dbResp = m_downloader->downloadHTTPSStream(dbUrl,
+                                                        [&file, &tmpPath](std::string_view chunk)
+                                                        {
+                                                            file.write(chunk.data(), chunk.size());
+                                                            if (!file)
+                                                            {
+                                                                throw std::runtime_error(
+                                                                    fmt::format("Cannot write to file '{}'", tmpPath));
+                                                            }
+                                                        });
+        file.close();
+
         if (base::isError(dbResp))
         {
             error = base::Error {
@@ -279,9 +289,7 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
             continue;
         }
 
-        content = base::getResponse(dbResp);
-        auto computedHash = m_downloader->computeMD5(content);
-        if (computedHash == hash)
+        if (base::getResponse(dbResp) == hash)
         {
             error = base::noError();
             break;
@@ -292,27 +300,36 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
 
     if (base::isError(error))
     {
+        std::error_code ec;
+        std::filesystem::remove(tmpPath, ec);
         return error;
     }
 
+    // Hold the write lock only for the swap phase; the type conflict is checked
+    // again since the map may have changed while the download ran unlocked
+    std::unique_lock lock(m_rwMapMutex);
+    if (m_dbTypes.find(type) != m_dbTypes.end() && m_dbTypes.at(type) != name)
+    {
+        return base::Error {fmt::format("Type '{}' already has the database '{}'", typeName(type), m_dbTypes.at(type))};
+    }
+
     // Write the database to the file
-    // If the database is already added, hold the internal mutex for write
+    // If the database is already added, publish a fresh mapping over the new file
+    auto entry = m_dbs.find(name);
     if (entry != m_dbs.end())
     {
-        std::unique_lock lockEntry(entry->second->rwMutex);
-        auto writeResp = writeDb(path, content);
+        auto writeResp = swapDb(path);
         if (base::isError(writeResp))
         {
             return base::getError(writeResp);
         }
 
-        // Close the MMDB and reopen it
-        MMDB_close(entry->second->mmdb.get());
-        int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, entry->second->mmdb.get());
+        // Open the new mapping and swap it in; lookups holding the old one finish
+        // over the old file contents and unmap it when done
+        int status = entry->second->open();
         if (MMDB_SUCCESS != status)
         {
             // Remove the database
-            lockEntry.unlock();
             removeDbUnsafe(path);
 
             return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
@@ -320,7 +337,7 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
     }
     else
     {
-        auto writeResp = writeDb(path, content);
+        auto writeResp = swapDb(path);
         if (base::isError(writeResp))
         {
             return base::getError(writeResp);
@@ -361,6 +378,75 @@ base::RespOrError<std::shared_ptr<ILocator>> Manager::getLocator(Type type) cons
     return locator;
 }
 
+base::RespOrError<json::Json> Manager::getFullEnrichment(const std::string& ip) const
+{
+    // ECS-shaped field tables per database type
+    static const std::vector<ILocator::EnrichmentField> CITY_FIELDS {{"city.names.en", "/geo/city_name"},
+                                                                     {"continent.code", "/geo/continent_code"},
+                                                                     {"continent.names.en", "/geo/continent_name"},
+                                                                     {"country.iso_code", "/geo/country_iso_code"},
+                                                                     {"country.names.en", "/geo/country_name"},
+                                                                     {"location.latitude", "/geo/location/lat"},
+                                                                     {"location.longitude", "/geo/location/lon"},
+                                                                     {"postal.code", "/geo/postal_code"},
+                                                                     {"location.time_zone", "/geo/timezone"},
+                                                                     {"subdivisions.0.iso_code", "/geo/region_iso_code"},
+                                                                     {"subdivisions.0.names.en", "/geo/region_name"}};
+    static const std::vector<ILocator::EnrichmentField> ASN_FIELDS {
+        {"autonomous_system_number", "/as/number"},
+        {"autonomous_system_organization", "/as/organization/name"}};
+
+    // Snapshot the configured databases with the read lock, then query without it
+    std::vector<std::pair<Type, std::shared_ptr<DbEntry>>> entries;
+    {
+        std::shared_lock lock(m_rwMapMutex);
+
+        if (m_dbTypes.empty())
+        {
+            return base::Error {"No database is configured"};
+        }
+
+        for (const auto& [type, name] : m_dbTypes)
+        {
+            entries.emplace_back(type, m_dbs.at(name));
+        }
+    }
+
+    json::Json fragment {};
+    fragment.setObject();
+
+    std::optional<base::Error> lastError;
+    auto enriched = false;
+
+    for (const auto& [type, entry] : entries)
+    {
+        Locator locator(entry);
+        const auto& fields = (Type::CITY == type) ? CITY_FIELDS : ASN_FIELDS;
+
+        auto resp = locator.getEnrichment(ip, fields);
+        if (base::isError(resp))
+        {
+            lastError = base::getError(resp);
+            continue;
+        }
+
+        auto& dbFragment = base::getResponse(resp);
+        if (dbFragment.size() > 0)
+        {
+            fragment.merge(false, dbFragment);
+            enriched = true;
+        }
+    }
+
+    // Only fail when every database failed to look the address up
+    if (!enriched && lastError.has_value())
+    {
+        return lastError.value();
+    }
+
+    return fragment;
+}
+
 std::vector<DbInfo> Manager::listDbs() const
 {
     std::shared_lock lock(m_rwMapMutex);
@@ -14,6 +14,10 @@ public:
     MOCK_METHOD(base::RespOrError<uint32_t>, getUint32, (const std::string& ip, const DotPath& path), (override));
     MOCK_METHOD(base::RespOrError<double>, getDouble, (const std::string& ip, const DotPath& path), (override));
     MOCK_METHOD(base::RespOrError<json::Json>, getAsJson, (const std::string& ip, const DotPath& path), (override));
+    MOCK_METHOD(base::RespOrError<json::Json>,
+                getEnrichment,
+                (const std::string& ip, const std::vector<EnrichmentField>& fields),
+                (override));
 };
 } // namespace geo::mocks
 #endif // _GEO_MOCK_LOCATOR_HPP
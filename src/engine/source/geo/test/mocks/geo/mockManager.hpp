@@ -18,6 +18,7 @@ public:
                 (override));
     MOCK_METHOD(std::vector<DbInfo>, listDbs, (), (const, override));
     MOCK_METHOD(base::RespOrError<std::shared_ptr<ILocator>>, getLocator, (Type type), (const, override));
+    MOCK_METHOD(base::RespOrError<json::Json>, getFullEnrichment, (const std::string& ip), (const, override));
 };
 } // namespace geo::mocks
 #endif // _GEO_MOCK_MANAGER_HPP
@@ -11,6 +11,10 @@ class MockDownloader : public IDownloader
 {
 public:
     MOCK_METHOD((base::RespOrError<std::string>), downloadHTTPS, (const std::string& url), (const override));
+    MOCK_METHOD((base::RespOrError<std::string>),
+                downloadHTTPSStream,
+                (const std::string& url, const std::function<void(std::string_view)>& onChunk),
+                (const override));
     MOCK_METHOD(std::string, computeMD5, (const std::string& data), (const override));
     MOCK_METHOD(base::RespOrError<std::string>, downloadMD5, (const std::string& url), (const override));
 };
@@ -347,3 +347,48 @@ TEST_F(LocatorTest, GetAsJson)
     expected.setBool(true);
     ASSERT_EQ(expected, base::getResponse<json::Json>(res));
 }
+
+TEST_F(LocatorTest, GetEnrichment)
+{
+    decltype(locator->getEnrichment({}, {})) res;
+
+    const std::vector<EnrichmentField> fields {
+        {"test_uint32", "/num"}, {"test_map.test_str1", "/str"}, {"not_found", "/missing"}};
+
+    ASSERT_NO_THROW(res = locator->getEnrichment(g_ipFullData, fields));
+    ASSERT_FALSE(base::isError(res));
+
+    json::Json expected;
+    expected.setInt(94043, "/num");
+    expected.setString("Wazuh", "/str");
+    ASSERT_EQ(expected, base::getResponse<json::Json>(res));
+
+    // Cached fields are served without a new lookup
+    ASSERT_NO_THROW(res = locator->getEnrichment(g_ipFullData, fields));
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(expected, base::getResponse<json::Json>(res));
+}
+
+TEST_F(LocatorTest, GetEnrichmentNotFoundIp)
+{
+    decltype(locator->getEnrichment({}, {})) res;
+
+    ASSERT_NO_THROW(res = locator->getEnrichment(g_ipNotFound, {{"test_uint32", "/num"}}));
+    ASSERT_TRUE(base::isError(res));
+}
+
+TEST_F(LocatorTest, GetFullEnrichment)
+{
+    decltype(manager->getFullEnrichment({})) res;
+
+    // The test database holds none of the ECS fields, the fragment is empty but not an error
+    ASSERT_NO_THROW(res = manager->getFullEnrichment(g_ipFullData));
+    ASSERT_FALSE(base::isError(res));
+    json::Json expected;
+    expected.setObject();
+    ASSERT_EQ(expected, base::getResponse<json::Json>(res));
+
+    // The address is not present in any configured database
+    ASSERT_NO_THROW(res = manager->getFullEnrichment(g_ipNotFound));
+    ASSERT_TRUE(base::isError(res));
+}
@@ -123,6 +123,18 @@ protected:
         return content;
     }
 
+    // Builds a downloadHTTPSStream action that delivers the content in one chunk and reports the
+    // given digest for it
+    static auto streamContent(const std::string& content, const std::string& digest)
+    {
+        return [content, digest](const std::string&, const std::function<void(std::string_view)>& onChunk)
+                   -> base::RespOrError<std::string>
+        {
+            onChunk(content);
+            return digest;
+        };
+    }
+
     auto getEmptyManager()
     {
         EXPECT_CALL(*mockStore, readInternalCol(base::Name(INTERNAL_NAME)))
@@ -402,6 +414,15 @@ TEST_F(GeoManagerTest, GetLocatorNonExists)
     ASSERT_TRUE(base::isError(locatorResp));
 }
 
+TEST_F(GeoManagerTest, GetFullEnrichmentNoDb)
+{
+    auto manager = getEmptyManager();
+
+    base::RespOrError<json::Json> enrichmentResp;
+    ASSERT_NO_THROW(enrichmentResp = manager.getFullEnrichment("1.2.3.4"));
+    ASSERT_TRUE(base::isError(enrichmentResp));
+}
+
 TEST_F(GeoManagerTest, RemoteUpsertDb)
 {
     auto manager = getEmptyManager();
@@ -416,9 +437,9 @@ TEST_F(GeoManagerTest, RemoteUpsertDb)
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
-    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash)).WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, downloadHTTPSStream(dbUrl, testing::_))
+        .WillOnce(testing::Invoke(streamContent(content, hash)));
+    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
 
     base::OptError error;
@@ -495,10 +516,10 @@ TEST_F(GeoManagerTest, RemoteUpsertDbFailOneDownload)
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
-    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
+    EXPECT_CALL(*mockDownloader, downloadHTTPSStream(dbUrl, testing::_))
         .WillOnce(testing::Return(base::Error {"error"}))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash)).WillOnce(testing::Return(hash));
+        .WillOnce(testing::Invoke(streamContent(content, hash)));
+    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
 
     base::OptError error;
@@ -523,13 +544,10 @@ TEST_F(GeoManagerTest, RemoteUpsertDbFailOneHash)
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
-    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content))
-        .WillOnce(testing::Return("other_hash"))
-        .WillOnce(testing::Return(hash))
-        .WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, downloadHTTPSStream(dbUrl, testing::_))
+        .WillOnce(testing::Invoke(streamContent(content, "other_hash")))
+        .WillOnce(testing::Invoke(streamContent(content, hash)));
+    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
 
     base::OptError error;
@@ -554,9 +572,6 @@ TEST_F(GeoManagerTest, RemoteUpsertDbErrorWriting)
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
-    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash));
 
     base::OptError error;
     ASSERT_NO_THROW(error = manager.remoteUpsertDb(dbPath, dbType, dbUrl, hashUrl));
@@ -578,9 +593,9 @@ TEST_F(GeoManagerTest, RemoteUpsertDbFailInternalStore)
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
-    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash)).WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, downloadHTTPSStream(dbUrl, testing::_))
+        .WillOnce(testing::Invoke(streamContent(content, hash)));
+    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeError()));
 
     base::OptError error;
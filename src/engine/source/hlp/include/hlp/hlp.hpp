@@ -1,6 +1,8 @@
 #ifndef _HLP_HPP
 #define _HLP_HPP
 
+#include <cstdint>
+
 #include "parser.hpp"
 
 namespace hlp
@@ -168,6 +170,20 @@ Parser getIPParser(const Params& params);
  */
 Parser getUriParser(const Params& params);
 
+/**
+ * @brief Hit/miss counters of the URI decomposition cache shared by the URI parsers.
+ */
+struct UriCacheStats
+{
+    uint64_t hits;
+    uint64_t misses;
+};
+
+/**
+ * @brief Returns the accumulated hit/miss counters of the URI decomposition cache.
+ */
+UriCacheStats getUriCacheStats();
+
 /**
  * Returns a parser which will consume input
  * until the str substring.
@@ -0,0 +1,123 @@
+#ifndef _HLP_CHAR_CLASS_HPP
+#define _HLP_CHAR_CLASS_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Shared constexpr-generated 256-entry character classification tables.
+ *
+ * The scalar parsers (alphanumeric, numbers, hex, case-insensitive literals) classify every byte
+ * of every field they consume. The tables turn the per-byte branch chains and locale-aware
+ * std::is* calls into single table loads.
+ */
+namespace hlp::syntax::charclass
+{
+
+constexpr uint8_t DIGIT = 1 << 0;
+constexpr uint8_t ALPHA = 1 << 1;
+constexpr uint8_t XDIGIT = 1 << 2;
+constexpr uint8_t ALNUM = DIGIT | ALPHA;
+
+namespace detail
+{
+constexpr std::array<uint8_t, 256> makeClassTable()
+{
+    std::array<uint8_t, 256> table {};
+    for (int c = '0'; c <= '9'; ++c)
+    {
+        table[c] |= DIGIT | XDIGIT;
+    }
+    for (int c = 'a'; c <= 'z'; ++c)
+    {
+        table[c] |= ALPHA;
+    }
+    for (int c = 'A'; c <= 'Z'; ++c)
+    {
+        table[c] |= ALPHA;
+    }
+    for (int c = 'a'; c <= 'f'; ++c)
+    {
+        table[c] |= XDIGIT;
+    }
+    for (int c = 'A'; c <= 'F'; ++c)
+    {
+        table[c] |= XDIGIT;
+    }
+    return table;
+}
+
+constexpr std::array<char, 256> makeLowerTable()
+{
+    std::array<char, 256> table {};
+    for (int c = 0; c < 256; ++c)
+    {
+        table[c] = static_cast<char>(c);
+    }
+    for (int c = 'A'; c <= 'Z'; ++c)
+    {
+        table[c] = static_cast<char>(c - 'A' + 'a');
+    }
+    return table;
+}
+} // namespace detail
+
+inline constexpr auto CLASS_TABLE = detail::makeClassTable();
+inline constexpr auto LOWER_TABLE = detail::makeLowerTable();
+
+constexpr bool is(char c, uint8_t mask)
+{
+    return (CLASS_TABLE[static_cast<unsigned char>(c)] & mask) != 0;
+}
+
+constexpr bool isDigit(char c)
+{
+    return is(c, DIGIT);
+}
+
+constexpr bool isAlnum(char c)
+{
+    return is(c, ALNUM);
+}
+
+constexpr bool isXdigit(char c)
+{
+    return is(c, XDIGIT);
+}
+
+constexpr char toLower(char c)
+{
+    return LOWER_TABLE[static_cast<unsigned char>(c)];
+}
+
+/**
+ * @brief Accept set combining a class mask with extra allowed characters.
+ *
+ * Built once at parser construction so the per-byte accept decision is a single table load
+ * instead of a classification branch plus a find over the additional characters.
+ */
+class AcceptSet
+{
+private:
+    std::array<bool, 256> m_table {};
+
+public:
+    AcceptSet(uint8_t mask, const std::string& additional = "")
+    {
+        for (int c = 0; c < 256; ++c)
+        {
+            m_table[c] = (CLASS_TABLE[c] & mask) != 0;
+        }
+        for (const auto c : additional)
+        {
+            m_table[static_cast<unsigned char>(c)] = true;
+        }
+    }
+
+    bool operator()(char c) const { return m_table[static_cast<unsigned char>(c)]; }
+};
+
+} // namespace hlp::syntax::charclass
+
+#endif // _HLP_CHAR_CLASS_HPP
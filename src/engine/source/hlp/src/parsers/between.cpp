@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 
 #include "hlp.hpp"
+#include "scan.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -39,7 +40,7 @@ syntax::Parser getSynParser(const std::string& startToken, const std::string& en
             return abs::makeFailure<syntax::ResultT>(input, {});
         }
 
-        auto endPos = input.find(endToken, startToken.size());
+        auto endPos = scan::findString(input, endToken, startToken.size());
         if (endPos == std::string_view::npos)
         {
             return abs::makeFailure<syntax::ResultT>(input, {});
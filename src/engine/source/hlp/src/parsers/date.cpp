@@ -1,4 +1,6 @@
+#include <array>
 #include <chrono>
+#include <limits>
 #include <locale>
 #include <stdexcept>
 #include <string>
@@ -157,6 +159,272 @@ std::string formatDateFromSample(const std::string& dateSample)
     // Return the matching format
     return matchingFormats[0];
 }
+
+/**
+ * Formats with a specialized hand-rolled parser. They cover the bulk of the traffic
+ * (syslog and ISO timestamps on every event), so they avoid the istringstream and
+ * locale machinery of the generic path. The format is fixed when the parser is built,
+ * so the specialization is selected once instead of per event.
+ */
+enum class FastFormat
+{
+    NONE,     ///< No specialization, use the generic path
+    ISO8601,  ///< %FT%T%Ez  e.g. 2018-08-14T14:30:02.203151+02:00
+    ISO8601Z, ///< %FT%TZ    e.g. 2018-08-14T14:30:02.203151Z
+    RFC3339,  ///< %FT%TZ%Ez e.g. 2006-01-02T15:04:05Z07:00
+    SYSLOG    ///< %b %d %T  e.g. Jun 14 15:16:01
+};
+
+FastFormat fastFormatFromStr(const std::string& format)
+{
+    if (format == "%FT%T%Ez")
+    {
+        return FastFormat::ISO8601;
+    }
+    if (format == "%FT%TZ")
+    {
+        return FastFormat::ISO8601Z;
+    }
+    if (format == "%FT%TZ%Ez")
+    {
+        return FastFormat::RFC3339;
+    }
+    if (format == "%b %d %T")
+    {
+        return FastFormat::SYSLOG;
+    }
+    return FastFormat::NONE;
+}
+
+// Scan between min and max digits, leaving pos after the last digit consumed
+bool scanDigits(std::string_view text, std::size_t& pos, std::size_t min, std::size_t max, int& out)
+{
+    std::size_t read {0};
+    int value {0};
+    while (read < max && pos + read < text.size() && text[pos + read] >= '0' && text[pos + read] <= '9')
+    {
+        value = value * 10 + (text[pos + read] - '0');
+        ++read;
+    }
+
+    if (read < min)
+    {
+        return false;
+    }
+
+    pos += read;
+    out = value;
+    return true;
+}
+
+bool scanChar(std::string_view text, std::size_t& pos, char c)
+{
+    if (pos < text.size() && text[pos] == c)
+    {
+        ++pos;
+        return true;
+    }
+    return false;
+}
+
+// HH:MM:SS with an optional fraction of up to nanosecond precision
+bool scanTime(std::string_view text, std::size_t& pos, std::chrono::nanoseconds& out)
+{
+    int hour {};
+    int minute {};
+    int second {};
+    if (!scanDigits(text, pos, 1, 2, hour) || !scanChar(text, pos, ':') || !scanDigits(text, pos, 1, 2, minute)
+        || !scanChar(text, pos, ':') || !scanDigits(text, pos, 1, 2, second))
+    {
+        return false;
+    }
+
+    if (hour > 23 || minute > 59 || second > 59)
+    {
+        return false;
+    }
+
+    int64_t nanos {0};
+    if (pos < text.size() && text[pos] == '.')
+    {
+        ++pos;
+        std::size_t digits {0};
+        int64_t scale {100000000};
+        while (digits < 9 && pos < text.size() && text[pos] >= '0' && text[pos] <= '9')
+        {
+            nanos += (text[pos] - '0') * scale;
+            scale /= 10;
+            ++digits;
+            ++pos;
+        }
+
+        if (digits == 0)
+        {
+            return false;
+        }
+    }
+
+    out = std::chrono::hours {hour} + std::chrono::minutes {minute} + std::chrono::seconds {second}
+          + std::chrono::nanoseconds {nanos};
+    return true;
+}
+
+// [+|-]HH:MM offset, the sign is optional as in %Ez
+bool scanOffset(std::string_view text, std::size_t& pos, std::chrono::minutes& out)
+{
+    int sign {1};
+    if (pos < text.size() && (text[pos] == '+' || text[pos] == '-'))
+    {
+        sign = text[pos] == '-' ? -1 : 1;
+        ++pos;
+    }
+
+    int hour {};
+    int minute {};
+    if (!scanDigits(text, pos, 1, 2, hour) || !scanChar(text, pos, ':') || !scanDigits(text, pos, 2, 2, minute))
+    {
+        return false;
+    }
+
+    if (hour > 23 || minute > 59)
+    {
+        return false;
+    }
+
+    out = std::chrono::minutes {sign * (hour * 60 + minute)};
+    return true;
+}
+
+// Case-insensitive three letter month abbreviation, as %b with the C locale. Fails on
+// longer names so full month names take the generic path.
+bool scanMonthAbbrev(std::string_view text, std::size_t& pos, int& out)
+{
+    static constexpr std::array<std::string_view, 12> abbrevs {
+        "jan", "feb", "mar", "apr", "may", "jun", "jul", "aug", "sep", "oct", "nov", "dec"};
+
+    if (pos + 3 > text.size())
+    {
+        return false;
+    }
+
+    const auto lower = [](char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    };
+
+    std::array<char, 3> month {lower(text[pos]), lower(text[pos + 1]), lower(text[pos + 2])};
+    for (std::size_t i = 0; i < abbrevs.size(); ++i)
+    {
+        if (abbrevs[i] == std::string_view {month.data(), month.size()})
+        {
+            // A longer name means this is not an abbreviation
+            auto next = pos + 3;
+            if (next < text.size() && ((text[next] >= 'a' && text[next] <= 'z') || (text[next] >= 'A' && text[next] <= 'Z')))
+            {
+                return false;
+            }
+
+            pos += 3;
+            out = static_cast<int>(i) + 1;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Hand-rolled parse of the specialized formats.
+ *
+ * On success fills the same fields the generic date::parse path produces, so the
+ * semantic parser is shared. On failure the caller falls back to the generic path.
+ */
+bool fastParseDate(std::string_view text,
+                   FastFormat format,
+                   date::fields<std::chrono::nanoseconds>& fds,
+                   std::chrono::minutes& offset,
+                   std::size_t& pos)
+{
+    pos = 0;
+    std::chrono::nanoseconds tod {};
+
+    if (format == FastFormat::SYSLOG)
+    {
+        int month {};
+        int day {};
+        if (!scanMonthAbbrev(text, pos, month) || !scanChar(text, pos, ' '))
+        {
+            return false;
+        }
+        // Space padded days as in 'Mar  1'
+        while (pos < text.size() && text[pos] == ' ')
+        {
+            ++pos;
+        }
+        if (!scanDigits(text, pos, 1, 2, day) || day < 1 || day > 31 || !scanChar(text, pos, ' ')
+            || !scanTime(text, pos, tod))
+        {
+            return false;
+        }
+
+        // No year in the format, flag it as not parsed so the current year is set
+        const auto ymd = date::year {std::numeric_limits<short>::min()} / date::month {static_cast<unsigned>(month)}
+                         / date::day {static_cast<unsigned>(day)};
+        fds = date::fields<std::chrono::nanoseconds> {ymd, date::hh_mm_ss<std::chrono::nanoseconds> {tod}};
+        offset = std::chrono::minutes {0};
+        return true;
+    }
+
+    // ISO/RFC3339 family: YYYY-MM-DDTHH:MM:SS[.frac] followed by the zone part
+    int year {};
+    int month {};
+    int day {};
+    if (!scanDigits(text, pos, 4, 4, year) || !scanChar(text, pos, '-') || !scanDigits(text, pos, 1, 2, month)
+        || !scanChar(text, pos, '-') || !scanDigits(text, pos, 1, 2, day) || !scanChar(text, pos, 'T')
+        || !scanTime(text, pos, tod))
+    {
+        return false;
+    }
+
+    if (month < 1 || month > 12 || day < 1 || day > 31)
+    {
+        return false;
+    }
+
+    offset = std::chrono::minutes {0};
+    switch (format)
+    {
+        case FastFormat::ISO8601:
+            if (!scanOffset(text, pos, offset))
+            {
+                return false;
+            }
+            break;
+        case FastFormat::ISO8601Z:
+            if (!scanChar(text, pos, 'Z'))
+            {
+                return false;
+            }
+            break;
+        case FastFormat::RFC3339:
+            if (!scanChar(text, pos, 'Z') || !scanOffset(text, pos, offset))
+            {
+                return false;
+            }
+            break;
+        default: return false;
+    }
+
+    const auto ymd =
+        date::year {year} / date::month {static_cast<unsigned>(month)} / date::day {static_cast<unsigned>(day)};
+    if (!ymd.ok())
+    {
+        return false;
+    }
+
+    fds = date::fields<std::chrono::nanoseconds> {ymd, date::hh_mm_ss<std::chrono::nanoseconds> {tod}};
+    return true;
+}
 } // namespace
 
 namespace hlp
@@ -277,8 +545,26 @@ Parser getDateParser(const Params& params)
 
     const auto target = params.targetField.empty() ? std::string {} : params.targetField;
 
-    return [format, parserLocale, outputLocale, name = params.name, target](std::string_view text)
+    // Specialized scanner for the dominant formats, only valid with the default locale
+    const auto fastFormat = parserLocale == std::locale::classic() ? fastFormatFromStr(format) : FastFormat::NONE;
+
+    return [format, parserLocale, outputLocale, name = params.name, target, fastFormat](std::string_view text)
     {
+        if (fastFormat != FastFormat::NONE)
+        {
+            date::fields<std::chrono::nanoseconds> fastFds {};
+            std::chrono::minutes fastOffset {0};
+            std::size_t pos {0};
+            if (fastParseDate(text, fastFormat, fastFds, fastOffset, pos))
+            {
+                return abs::makeSuccess(
+                    SemToken {text.substr(0, pos),
+                              getSemParser(target, fastFds, outputLocale, std::string {}, name, fastOffset)},
+                    text.substr(pos));
+            }
+            // The scanner is strict, let the generic path decide on anything it rejects
+        }
+
         auto ss = std::istringstream(std::string(text));
         ss.imbue(parserLocale);
 
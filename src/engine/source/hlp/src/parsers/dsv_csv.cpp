@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -17,19 +18,68 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(const json::Json& doc, std::string_view targetField)
+/**
+ * @brief Field value extracted during the syntax phase, written into the event only when the
+ * whole record parses.
+ */
+struct ExtractedField
 {
-    return [doc, targetField](json::Json& event)
+    enum class Kind
     {
-        event.set(targetField, doc);
+        Null, ///< Empty field, mapped as null
+        View, ///< View into the input, no rewriting needed
+        Owned ///< Unescaped copy, the raw field carried escape sequences
     };
+
+    Kind kind;
+    std::string_view view;
+    std::string owned;
+};
+
+ExtractedField extractField(std::string_view value, bool isEscaped, std::string_view escape)
+{
+    if (value.empty())
+    {
+        return {ExtractedField::Kind::Null, {}, {}};
+    }
+
+    if (!isEscaped)
+    {
+        return {ExtractedField::Kind::View, value, {}};
+    }
+
+    auto vs = std::string {value.data(), value.size()};
+    unescape(isEscaped, vs, escape);
+    return {ExtractedField::Kind::Owned, {}, std::move(vs)};
 }
 
-SemParser getSemParser(json::Json&& doc, const std::string& targetField)
+Mapper getMapper(std::shared_ptr<std::vector<ExtractedField>> fields,
+                 std::shared_ptr<const std::vector<std::string>> paths)
 {
-    return [targetField, doc](std::string_view)
+    // Fields are emitted directly into the event at the precompiled absolute paths,
+    // skipping the intermediate document and its copy into the target subtree
+    return [fields = std::move(fields), paths = std::move(paths)](json::Json& event)
     {
-        return getMapper(doc, targetField);
+        for (std::size_t i = 0; i < fields->size(); ++i)
+        {
+            const auto& field = (*fields)[i];
+            const auto& path = (*paths)[i];
+            switch (field.kind)
+            {
+                case ExtractedField::Kind::Null: event.setNull(path); break;
+                case ExtractedField::Kind::View: event.setString(field.view, path); break;
+                case ExtractedField::Kind::Owned: event.setString(field.owned, path); break;
+            }
+        }
+    };
+}
+
+SemParser getSemParser(std::shared_ptr<std::vector<ExtractedField>> fields,
+                       std::shared_ptr<const std::vector<std::string>> paths)
+{
+    return [fields = std::move(fields), paths = std::move(paths)](std::string_view)
+    {
+        return getMapper(fields, paths);
     };
 }
 
@@ -58,7 +108,21 @@ inline Parser dsvParserFunction(std::string name,
 
     const auto toStopP = syntax::parsers::toEnd(endTokens);
 
-    return [toStopP, target = targetField, delimiterChar, quoteChar, headers, escapeChar, name](std::string_view txt)
+    // Precompiled absolute paths, one per header, so fields are written into the event
+    // directly instead of through an intermediate document merged into the target
+    auto fieldPaths = std::make_shared<std::vector<std::string>>();
+    if (!targetField.empty())
+    {
+        fieldPaths->reserve(headers.size());
+        for (const auto& header : headers)
+        {
+            fieldPaths->emplace_back(targetField + header);
+        }
+    }
+
+    return
+        [toStopP, target = targetField, fieldPaths, delimiterChar, quoteChar, headers, escapeChar, name](
+            std::string_view txt)
     {
         auto synR = toStopP(txt);
         if (synR.failure())
@@ -71,10 +135,10 @@ inline Parser dsvParserFunction(std::string name,
 
         std::size_t start {0};
 
-        json::Json doc {};
-        auto i = 0;
+        auto values = std::make_shared<std::vector<ExtractedField>>();
+        values->reserve(headers.size());
 
-        while (start <= parsed.size() && i < headers.size())
+        while (start <= parsed.size() && values->size() < headers.size())
         {
             auto remaining = parsed.substr(start, parsed.size() - start);
             auto field = getField(remaining, delimiterChar, quoteChar, escapeChar, true);
@@ -87,10 +151,9 @@ inline Parser dsvParserFunction(std::string name,
             auto fValue = field.value();
 
             auto v = remaining.substr(fValue.start(), fValue.len());
-            updateDoc(doc, headers[i], v, fValue.isEscaped(), std::string_view {&escapeChar, 1}, fValue.isQuoted());
+            values->emplace_back(extractField(v, fValue.isEscaped(), std::string_view {&escapeChar, 1}));
 
             start += fValue.end() + 1;
-            i++;
         }
 
         // If start is 0, it means no fields were found
@@ -99,7 +162,7 @@ inline Parser dsvParserFunction(std::string name,
             return abs::makeFailure<ResultT>(fieldNotFound, name);
         }
 
-        if (headers.size() != i)
+        if (headers.size() != values->size())
         {
             return abs::makeFailure<ResultT>(txt.substr(start - 1), name);
         }
@@ -116,7 +179,7 @@ inline Parser dsvParserFunction(std::string name,
         }
         else
         {
-            semP = getSemParser(std::move(doc), target);
+            semP = getSemParser(std::move(values), fieldPaths);
         }
         return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, synR.remaining());
     };
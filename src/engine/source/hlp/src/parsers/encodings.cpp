@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 
 #include "hlp.hpp"
+#include "scan.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -13,31 +14,6 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-inline bool isBase64(const char c)
-{
-    if ((c >= 'A') && (c <= 'Z'))
-    {
-        return true;
-    }
-
-    if ((c >= 'a') && (c <= 'z'))
-    {
-        return true;
-    }
-
-    if ((c >= '0') && (c <= '9'))
-    {
-        return true;
-    }
-
-    if ((c == '+') || (c == '/'))
-    {
-        return true;
-    }
-
-    return false;
-}
-
 Mapper getMapper(std::string_view parsed, std::string_view targetField)
 {
     return [parsed, targetField](json::Json& event)
@@ -63,14 +39,7 @@ syntax::Parser getSynParser()
             return abs::makeFailure<syntax::ResultT>(input, {});
         }
 
-        auto i = 0;
-        for (; i != input.size(); ++i)
-        {
-            if (!isBase64(input[i]))
-            {
-                break;
-            }
-        }
+        auto i = scan::spanBase64(input);
 
         if (i == 0)
         {
@@ -6,6 +6,8 @@
 #include <arpa/inet.h>
 #include <fmt/format.h>
 
+#include <base/utils/ipUtils.hpp>
+
 #include "hlp.hpp"
 #include "syntax.hpp"
 
@@ -26,13 +28,28 @@ SemParser getSemParser(const std::string& targetField)
 {
     return [targetField](std::string_view parsed) -> std::variant<Mapper, base::Error>
     {
-        struct in_addr ip;
-        struct in6_addr ip6;
-
-        if (!inet_pton(AF_INET, std::string(parsed).c_str(), &ip)
-            && !inet_pton(AF_INET6, std::string(parsed).c_str(), &ip6))
+        // IPv4 is the common case and validates in a single pass without copies. The
+        // scanner accepts exactly the strict dotted-quad grammar of inet_pton.
+        uint32_t ipv4 {};
+        if (!utils::ip::tryIPv4ToUInt(parsed, ipv4))
         {
-            return base::Error {"Invalid IPv4 or IPv6 address"};
+            struct in6_addr ip6;
+
+            // inet_pton needs a null-terminated string, copy the view into a stack
+            // buffer instead of allocating. No valid address is longer than
+            // INET6_ADDRSTRLEN.
+            char addr[INET6_ADDRSTRLEN];
+            if (parsed.size() >= sizeof(addr))
+            {
+                return base::Error {"Invalid IPv4 or IPv6 address"};
+            }
+            parsed.copy(addr, parsed.size());
+            addr[parsed.size()] = '\0';
+
+            if (!inet_pton(AF_INET6, addr, &ip6))
+            {
+                return base::Error {"Invalid IPv4 or IPv6 address"};
+            }
         }
 
         if (targetField.empty())
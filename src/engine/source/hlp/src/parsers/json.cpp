@@ -5,6 +5,7 @@
 #include <fmt/format.h>
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
+#include <simdjson.h>
 
 #include "hlp.hpp"
 #include "syntax.hpp"
@@ -50,6 +51,19 @@ Parser getJSONParser(const Params& params)
             return abs::makeFailure<ResultT>(txt, name);
         }
 
+        // When the document is not mapped to a field there is nothing to mutate, so the input
+        // can be validated and consumed with simdjson without building a DOM. Any simdjson
+        // error (including trailing content after the document) falls back to the rapidjson
+        // stop-when-done path below.
+        if (target.empty())
+        {
+            static thread_local simdjson::dom::parser simdParser;
+            if (simdParser.parse(txt.data(), txt.size()).error() == simdjson::SUCCESS)
+            {
+                return abs::makeSuccess<ResultT>(SemToken {txt, noSemParser()}, txt.substr(txt.size()));
+            }
+        }
+
         rapidjson::Reader reader;
         const auto ssInput = std::string(txt);
         rapidjson::StringStream ss(ssInput.c_str());
@@ -1,8 +1,8 @@
 #include <iostream>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <vector>
 
 #include <fmt/format.h>
 
@@ -74,12 +74,23 @@ Parser getKVParser(const Params& params)
         size_t start {0}, end {0};
         json::Json doc;
 
-        std::vector<Field> kv;
+        // Pairs are written into the document as soon as both fields are scanned, one
+        // pass over the input with no intermediate field vector. The document is local,
+        // so pairs written before a later failure are discarded with it.
+        std::size_t fields {0};
+        std::optional<Field> key {};
+        // First empty key; an odd field count is reported over it, as it is only known
+        // once the scan finishes the failure is deferred until then
+        std::optional<std::size_t> badKey {};
+
+        // Reused across keys to avoid a fresh allocation per pair
+        std::string keyPath {};
+
         auto dlm = sep;
         while (start <= kvInput.size())
         {
-            auto remaining = kvInput.substr(start, kvInput.size() - start);
-            auto f = getField(remaining, dlm, quote, '\\', true);
+            auto rest = kvInput.substr(start, kvInput.size() - start);
+            auto f = getField(rest, dlm, quote, '\\', true);
             if (!f.has_value())
             {
                 break;
@@ -89,38 +100,52 @@ Parser getKVParser(const Params& params)
 
             auto fld = f.value();
             fld.addOffset(start);
+            start = fld.end() + 1;
+            ++fields;
+
+            if (!key.has_value())
+            {
+                key = fld;
+                continue;
+            }
+
+            auto k = kvInput.substr(key->start(), key->len());
             end = fld.end();
-            start = end + 1;
-            kv.insert(kv.end(), fld);
+            if (k.empty())
+            {
+                if (!badKey.has_value())
+                {
+                    badKey = key->start();
+                }
+            }
+            else if (!badKey.has_value())
+            {
+                auto v = kvInput.substr(fld.start(), fld.len());
+                keyPath.assign(1, '/');
+                keyPath.append(k);
+                updateDoc(doc, keyPath, v, fld.isEscaped(), std::string_view {&esc, 1}, fld.isQuoted());
+            }
+            key.reset();
         };
 
-        if (kv.size() <= 1)
+        if (fields <= 1)
         {
             return abs::makeFailure<ResultT>(txt, name);
             // return parsec::makeError<json::Json>(fmt::format("{}: No key-value fields found)", name), index);
         }
 
-        if (kv.size() % 2 != 0)
+        if (fields % 2 != 0)
         {
-            return abs::makeFailure<ResultT>(txt.substr(kv[kv.size() - 2].end()), name);
+            return abs::makeFailure<ResultT>(txt.substr(end), name);
             // return parsec::makeError<json::Json>(fmt::format("{}: Invalid number of key-value fields", name), index);
         }
 
-        for (auto i = 0; i < kv.size() - 1; i += 2)
+        if (badKey.has_value())
         {
-            auto k = kvInput.substr(kv[i].start(), kv[i].len());
-            auto v = kvInput.substr(kv[i + 1].start(), kv[i + 1].len());
-            if (k.empty())
-            {
-                return abs::makeFailure<ResultT>(txt.substr(kv[i].start()), name);
-                // return parsec::makeError<json::Json>(
-                //     fmt::format(
-                //         "{}: Unable to parse key-value between '{}'-'{}' chars", name, kv[i].start(), kv[i].end()),
-                //     index);
-            }
-            end = kv[i + 1].end();
-            updateDoc(
-                doc, fmt::format("/{}", k), v, kv[i + 1].isEscaped(), std::string_view {&esc, 1}, kv[i + 1].isQuoted());
+            return abs::makeFailure<ResultT>(txt.substr(badKey.value()), name);
+            // return parsec::makeError<json::Json>(
+            //     fmt::format("{}: Unable to parse key-value between '{}'-'{}' chars", name, badKey.value(), end),
+            //     index);
         }
 
         if (start - 1 != end)
@@ -1,9 +1,43 @@
 #include "parse_field.hpp"
 #include "fmt/format.h"
 #include "number.hpp"
+#include <algorithm>
 #include <base/json.hpp>
+#include <cstring>
 #include <iostream>
 #include <string_view>
+
+namespace
+{
+/**
+ * @brief Index of the next occurrence of a or b at or after from, input.size() if none.
+ *
+ * memchr scans the uninteresting bytes in bulk with vector instructions, so long runs
+ * between delimiters and quotes are not walked one character at a time.
+ */
+std::size_t nextStateChar(std::string_view input, std::size_t from, char a, char b)
+{
+    const auto* base = input.data() + from;
+    const auto len = input.size() - from;
+
+    const auto* pa = static_cast<const char*>(std::memchr(base, a, len));
+    const auto* pb = a == b ? nullptr : static_cast<const char*>(std::memchr(base, b, len));
+
+    if (pa == nullptr && pb == nullptr)
+    {
+        return input.size();
+    }
+    if (pa == nullptr)
+    {
+        return from + (pb - base);
+    }
+    if (pb == nullptr)
+    {
+        return from + (pa - base);
+    }
+    return from + std::min(pa - base, pb - base);
+}
+} // namespace
 namespace hlp
 {
 
@@ -24,6 +58,15 @@ getField(std::string_view input, const char delimiter, const char quote, const c
 
     for (auto i = 0ul; i < input.size(); i++)
     {
+        // Jump to the next character that can change the scan state; only the
+        // delimiter and quote matter outside quotes, only the quote and escape inside
+        i = quote_opened ? nextStateChar(input, i, quote, quote != escape ? escape : quote)
+                         : nextStateChar(input, i, delimiter, quote);
+        if (i >= input.size())
+        {
+            break;
+        }
+
         if (input[i] == delimiter && !quote_opened)
         {
             // Found delimiter outside quotes, return field
@@ -99,7 +142,14 @@ void updateDoc(json::Json& doc,
         return;
     }
 
-    // If the value is a string, unescape it if necessary and add it to the JSON document
+    // Most fields carry no escape sequences, set the view directly and materialize an
+    // owned string only when it has to be rewritten
+    if (!is_escaped)
+    {
+        doc.setString(value, key);
+        return;
+    }
+
     auto vs = std::string {value.data(), value.size()};
     unescape(is_escaped, vs, escape);
     doc.setString(vs, key);
@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 
 #include "hlp.hpp"
+#include "scan.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -45,41 +46,31 @@ syntax::Parser getSynParser(char quote, char escape)
             return abs::makeFailure<syntax::ResultT>(input, {});
         }
 
-        bool checkEscape = false;
-        bool closed = false;
-        auto it = input.begin() + 1;
-        for (; it < input.end(); ++it)
+        // Jump between special characters, skipping the plain runs with the vectorized scan
+        size_t pos = 1;
+        while (pos < input.size())
         {
-            if (checkEscape)
+            auto special = scan::findEither(input.substr(pos), quote, escape);
+            if (special == std::string_view::npos)
             {
-                if (*it != quote && *it != escape)
-                {
-                    return abs::makeFailure<syntax::ResultT>(input, {});
-                }
-                checkEscape = false;
-                continue;
+                break;
             }
-            else if (*it == escape)
+
+            pos += special;
+            if (input[pos] == quote)
             {
-                checkEscape = true;
-                continue;
+                return abs::makeSuccess<syntax::ResultT>(input.substr(pos + 1));
             }
-            else if (*it == quote)
+
+            // Escape, the next character must be the quote or another escape
+            if (pos + 1 >= input.size() || (input[pos + 1] != quote && input[pos + 1] != escape))
             {
-                ++it;
-                closed = true;
-                break;
+                return abs::makeFailure<syntax::ResultT>(input, {});
             }
+            pos += 2;
         }
 
-        if (closed)
-        {
-            return abs::makeSuccess<syntax::ResultT>(input.substr(it - input.begin()));
-        }
-        else
-        {
-            return abs::makeFailure<syntax::ResultT>(input, {});
-        }
+        return abs::makeFailure<syntax::ResultT>(input, {});
     };
 }
 
@@ -1,7 +1,10 @@
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -9,6 +12,8 @@
 #include <curl/curl.h>
 #include <fmt/format.h>
 
+#include <base/lruCache.hpp>
+
 #include "hlp.hpp"
 #include "syntax.hpp"
 
@@ -17,11 +22,36 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getUriMapper(std::map<std::string, std::string>&& uriAttrs, std::string_view targetField)
+using UriAttrs = std::map<std::string, std::string>;
+
+constexpr size_t URI_CACHE_CAPACITY = 4096;
+
+/**
+ * @brief Bounded cache of raw URI -> decomposed attributes.
+ *
+ * Proxy and web server logs repeat the same few thousand URLs constantly; interning the
+ * decomposition lets repeated URLs skip the curl parse entirely. Shared by every URI parser
+ * instance, guarded by a mutex as parsers run from multiple workers.
+ */
+struct UriCache
+{
+    std::mutex mutex;
+    LRUCache<std::string, std::shared_ptr<const UriAttrs>> cache {URI_CACHE_CAPACITY};
+    std::atomic<uint64_t> hits {0};
+    std::atomic<uint64_t> misses {0};
+};
+
+UriCache& uriCache()
 {
-    return [uriAttrs, targetField](json::Json& event)
+    static UriCache instance;
+    return instance;
+}
+
+Mapper getUriMapper(std::shared_ptr<const UriAttrs> uriAttrs, std::string_view targetField)
+{
+    return [uriAttrs = std::move(uriAttrs), targetField](json::Json& event)
     {
-        for (const auto& [attr, value] : uriAttrs)
+        for (const auto& [attr, value] : *uriAttrs)
         {
             const auto attrPath = std::string(targetField) + attr;
             event.setString(value, attrPath);
@@ -34,6 +64,22 @@ SemParser getUriSemParser(const std::map<CURLUPart, std::string>& mapCurlFields,
     return [mapCurlFields, targetField](std::string_view parsed) -> std::variant<Mapper, base::Error>
     {
         const auto urlstr = std::string(parsed);
+
+        // Repeated URLs resolve from the interned decomposition, skipping the curl parse
+        {
+            std::lock_guard lock {uriCache().mutex};
+            if (auto cached = uriCache().cache.getValue(urlstr))
+            {
+                uriCache().hits.fetch_add(1, std::memory_order_relaxed);
+                if (targetField.empty())
+                {
+                    return noMapper();
+                }
+                return getUriMapper(std::move(cached.value()), targetField);
+            }
+        }
+        uriCache().misses.fetch_add(1, std::memory_order_relaxed);
+
         auto urlCleanup = [](auto* url)
         {
             curl_url_cleanup(url);
@@ -55,33 +101,36 @@ SemParser getUriSemParser(const std::map<CURLUPart, std::string>& mapCurlFields,
         // char ptr and we will copy it again into the string for the result
         // Check if there's a way to avoid all the copying here
 
-        if (targetField.empty())
+        // Load the fild values into the result
+        auto uriAttrs = std::make_shared<UriAttrs>();
+        auto load = [&uriAttrs, &url](CURLUPart field, const std::string& path)
         {
-            return noMapper();
-        }
-        else
-        {
-            // Load the fild values into the result
-            std::map<std::string, std::string> uriAttrs;
-            auto load = [&uriAttrs, &url](CURLUPart field, const std::string& path)
-            {
-                char* str = nullptr;
-                auto uc = curl_url_get(url.get(), field, &str, 0);
-                if (uc == CURLUE_OK)
-                {
-                    uriAttrs[path] = std::string {str};
-                    curl_free(str);
-                }
-            };
-
-            for (auto& [field, path] : mapCurlFields)
+            char* str = nullptr;
+            auto uc = curl_url_get(url.get(), field, &str, 0);
+            if (uc == CURLUE_OK)
             {
-                load(field, path);
+                (*uriAttrs)[path] = std::string {str};
+                curl_free(str);
             }
-            // TODO Check if urlstr.size() == doc["original"].size()
+        };
+
+        for (auto& [field, path] : mapCurlFields)
+        {
+            load(field, path);
+        }
+        // TODO Check if urlstr.size() == doc["original"].size()
 
-            return getUriMapper(std::move(uriAttrs), targetField);
+        std::shared_ptr<const UriAttrs> attrs = std::move(uriAttrs);
+        {
+            std::lock_guard lock {uriCache().mutex};
+            uriCache().cache.insertKey(urlstr, attrs);
         }
+
+        if (targetField.empty())
+        {
+            return noMapper();
+        }
+        return getUriMapper(std::move(attrs), targetField);
     };
 }
 
@@ -162,6 +211,11 @@ syntax::Parser getFQDNSynParser()
 namespace hlp::parsers
 {
 
+UriCacheStats getUriCacheStats()
+{
+    return {uriCache().hits.load(std::memory_order_relaxed), uriCache().misses.load(std::memory_order_relaxed)};
+}
+
 Parser getUriParser(const Params& params)
 {
     if (params.stop.empty())
@@ -76,7 +76,8 @@ void xmlToJson(pugi::xml_node& docXml, json::Json& docJson, const xmlModule& mod
 
         if (!processed)
         {
-            localPath += "/" + std::string {node.name()};
+            localPath += '/';
+            localPath += node.name();
 
             // Check if the element already exists
             if (docJson.exists(localPath))
@@ -96,14 +97,20 @@ void xmlToJson(pugi::xml_node& docXml, json::Json& docJson, const xmlModule& mod
                 }
             }
 
+            const auto baseLen = localPath.size();
             if (!node.text().empty())
             {
-                docJson.setString(node.text().as_string(), localPath + "/#text");
+                localPath += "/#text";
+                docJson.setString(node.text().as_string(), localPath);
+                localPath.resize(baseLen);
             }
 
             for (auto attr : node.attributes())
             {
-                docJson.setString(attr.value(), localPath + "/@" + attr.name());
+                localPath += "/@";
+                localPath += attr.name();
+                docJson.setString(attr.value(), localPath);
+                localPath.resize(baseLen);
             }
 
             if (node.text().empty() && node.attributes().empty())
@@ -140,8 +147,10 @@ SemParser getSemParser(const std::string& targetField, xmlModule moduleFn)
     {
         json::Json jParsed;
         pugi::xml_document xmlDoc;
+        // In-situ parse over the mutable copy: pugixml mutates the buffer and keeps the node
+        // values pointing into it, avoiding its own internal copy of the whole document
         auto bufferInput = std::string(parsed);
-        auto parseResult = xmlDoc.load_buffer(bufferInput.data(), bufferInput.size());
+        auto parseResult = xmlDoc.load_buffer_inplace(bufferInput.data(), bufferInput.size());
 
         if (parseResult.status != pugi::status_ok)
         {
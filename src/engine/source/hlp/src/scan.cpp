@@ -0,0 +1,310 @@
+#include "scan.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HLP_SCAN_X86
+#endif
+
+namespace
+{
+using ScanCharFn = size_t (*)(const char*, size_t, char);
+using ScanEitherFn = size_t (*)(const char*, size_t, char, char);
+using SpanFn = size_t (*)(const char*, size_t);
+
+constexpr auto NPOS = std::string_view::npos;
+
+/********************************************************************************************
+ * Scalar kernels (memchr-style fallback)
+ ********************************************************************************************/
+size_t scalarFindChar(const char* data, size_t size, char needle)
+{
+    const auto* found = static_cast<const char*>(std::memchr(data, needle, size));
+    return found != nullptr ? static_cast<size_t>(found - data) : NPOS;
+}
+
+size_t scalarFindEither(const char* data, size_t size, char first, char second)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (data[i] == first || data[i] == second)
+        {
+            return i;
+        }
+    }
+    return NPOS;
+}
+
+bool scalarIsBase64(char c)
+{
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '+' || c == '/';
+}
+
+size_t scalarSpanBase64(const char* data, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (!scalarIsBase64(data[i]))
+        {
+            return i;
+        }
+    }
+    return size;
+}
+
+#ifdef HLP_SCAN_X86
+/********************************************************************************************
+ * SSE2 kernels, 16 bytes per iteration
+ ********************************************************************************************/
+__attribute__((target("sse2"))) size_t sse2FindChar(const char* data, size_t size, char needle)
+{
+    const auto pattern = _mm_set1_epi8(needle);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const auto mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, pattern));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    auto tail = scalarFindChar(data + i, size - i, needle);
+    return tail != NPOS ? i + tail : NPOS;
+}
+
+__attribute__((target("sse2"))) size_t sse2FindEither(const char* data, size_t size, char first, char second)
+{
+    const auto patternA = _mm_set1_epi8(first);
+    const auto patternB = _mm_set1_epi8(second);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const auto mask =
+            _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, patternA), _mm_cmpeq_epi8(chunk, patternB)));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    auto tail = scalarFindEither(data + i, size - i, first, second);
+    return tail != NPOS ? i + tail : NPOS;
+}
+
+__attribute__((target("sse2"))) size_t sse2SpanBase64(const char* data, size_t size)
+{
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const auto upper = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('A' - 1)),
+                                         _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), chunk));
+        const auto lower = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('a' - 1)),
+                                         _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), chunk));
+        const auto digit = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('0' - 1)),
+                                         _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), chunk));
+        const auto sign = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('+')),
+                                       _mm_cmpeq_epi8(chunk, _mm_set1_epi8('/')));
+        const auto valid = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, sign));
+        const auto invalid = ~static_cast<unsigned>(_mm_movemask_epi8(valid)) & 0xFFFFu;
+        if (invalid != 0)
+        {
+            return i + __builtin_ctz(invalid);
+        }
+    }
+
+    return i + scalarSpanBase64(data + i, size - i);
+}
+
+/********************************************************************************************
+ * AVX2 kernels, 32 bytes per iteration
+ ********************************************************************************************/
+__attribute__((target("avx2"))) size_t avx2FindChar(const char* data, size_t size, char needle)
+{
+    const auto pattern = _mm256_set1_epi8(needle);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, pattern));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    auto tail = scalarFindChar(data + i, size - i, needle);
+    return tail != NPOS ? i + tail : NPOS;
+}
+
+__attribute__((target("avx2"))) size_t avx2FindEither(const char* data, size_t size, char first, char second)
+{
+    const auto patternA = _mm256_set1_epi8(first);
+    const auto patternB = _mm256_set1_epi8(second);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto mask = _mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, patternA), _mm256_cmpeq_epi8(chunk, patternB)));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    auto tail = scalarFindEither(data + i, size - i, first, second);
+    return tail != NPOS ? i + tail : NPOS;
+}
+
+__attribute__((target("avx2"))) size_t avx2SpanBase64(const char* data, size_t size)
+{
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto upper = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('A' - 1)),
+                                            _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), chunk));
+        const auto lower = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('a' - 1)),
+                                            _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), chunk));
+        const auto digit = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('0' - 1)),
+                                            _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chunk));
+        const auto sign = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('+')),
+                                          _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('/')));
+        const auto valid = _mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, sign));
+        const auto invalid = ~static_cast<unsigned>(_mm256_movemask_epi8(valid));
+        if (invalid != 0)
+        {
+            return i + __builtin_ctz(invalid);
+        }
+    }
+
+    return i + scalarSpanBase64(data + i, size - i);
+}
+#endif // HLP_SCAN_X86
+
+/********************************************************************************************
+ * Runtime dispatch, resolved once at startup
+ ********************************************************************************************/
+ScanCharFn resolveFindChar()
+{
+#ifdef HLP_SCAN_X86
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return avx2FindChar;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return sse2FindChar;
+    }
+#endif
+    return scalarFindChar;
+}
+
+ScanEitherFn resolveFindEither()
+{
+#ifdef HLP_SCAN_X86
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return avx2FindEither;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return sse2FindEither;
+    }
+#endif
+    return scalarFindEither;
+}
+
+SpanFn resolveSpanBase64()
+{
+#ifdef HLP_SCAN_X86
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return avx2SpanBase64;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return sse2SpanBase64;
+    }
+#endif
+    return scalarSpanBase64;
+}
+
+const ScanCharFn g_findChar = resolveFindChar();
+const ScanEitherFn g_findEither = resolveFindEither();
+const SpanFn g_spanBase64 = resolveSpanBase64();
+
+} // namespace
+
+namespace hlp::scan
+{
+
+size_t findChar(std::string_view haystack, char needle)
+{
+    if (haystack.empty())
+    {
+        return NPOS;
+    }
+    return g_findChar(haystack.data(), haystack.size(), needle);
+}
+
+size_t findEither(std::string_view haystack, char first, char second)
+{
+    if (haystack.empty())
+    {
+        return NPOS;
+    }
+    return g_findEither(haystack.data(), haystack.size(), first, second);
+}
+
+size_t findString(std::string_view haystack, std::string_view needle, size_t from)
+{
+    if (needle.empty())
+    {
+        return from <= haystack.size() ? from : NPOS;
+    }
+    if (from >= haystack.size())
+    {
+        return NPOS;
+    }
+
+    auto pos = from;
+    while (pos + needle.size() <= haystack.size())
+    {
+        auto candidate = g_findChar(haystack.data() + pos, haystack.size() - pos, needle.front());
+        if (candidate == NPOS)
+        {
+            return NPOS;
+        }
+
+        pos += candidate;
+        if (pos + needle.size() > haystack.size())
+        {
+            return NPOS;
+        }
+
+        if (std::memcmp(haystack.data() + pos, needle.data(), needle.size()) == 0)
+        {
+            return pos;
+        }
+        ++pos;
+    }
+
+    return NPOS;
+}
+
+size_t spanBase64(std::string_view input)
+{
+    if (input.empty())
+    {
+        return 0;
+    }
+    return g_spanBase64(input.data(), input.size());
+}
+
+} // namespace hlp::scan
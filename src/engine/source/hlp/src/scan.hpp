@@ -0,0 +1,63 @@
+#ifndef _HLP_SCAN_HPP
+#define _HLP_SCAN_HPP
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @brief Vectorized scanning primitives shared by the text parsers.
+ *
+ * Delimiter and literal search dominates parse time on text-heavy traffic, so the scans are
+ * implemented with AVX2/SSE2 kernels selected once at startup by CPU feature detection, with a
+ * scalar (memchr-style) fallback. All the functions are position searches over a string_view,
+ * returning std::string_view::npos when there is no match.
+ */
+namespace hlp::scan
+{
+
+/**
+ * @brief Find the first occurrence of a character.
+ *
+ * @param haystack The input to scan.
+ * @param needle The character to find.
+ * @return size_t Position of the first occurrence, npos if not found.
+ */
+size_t findChar(std::string_view haystack, char needle);
+
+/**
+ * @brief Find the first occurrence of either of two characters.
+ *
+ * @param haystack The input to scan.
+ * @param first One character to find.
+ * @param second The other character to find.
+ * @return size_t Position of the first occurrence of any of the two, npos if not found.
+ */
+size_t findEither(std::string_view haystack, char first, char second);
+
+/**
+ * @brief Find the first occurrence of a substring.
+ *
+ * Scans for the first character of the needle with the vectorized kernel and verifies the rest
+ * of the match, so the cost per skipped byte stays that of the character scan.
+ *
+ * @param haystack The input to scan.
+ * @param needle The substring to find.
+ * @param from Position to start the scan from.
+ * @return size_t Position of the first occurrence, npos if not found.
+ */
+size_t findString(std::string_view haystack, std::string_view needle, size_t from = 0);
+
+/**
+ * @brief Measure the leading run of base64 alphabet characters.
+ *
+ * The alphabet is A-Z, a-z, 0-9, '+' and '/'; padding characters are not part of the run. Used by
+ * the binary parser, where the alphabet scan dominates the parse cost of large payloads.
+ *
+ * @param input The input to scan.
+ * @return size_t Length of the leading base64 run, input.size() when every character belongs.
+ */
+size_t spanBase64(std::string_view input);
+
+} // namespace hlp::scan
+
+#endif // _HLP_SCAN_HPP
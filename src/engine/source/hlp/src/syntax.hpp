@@ -5,6 +5,8 @@
 #include <stdexcept>
 
 #include "abstractParser.hpp"
+#include "charClass.hpp"
+#include "scan.hpp"
 
 /**
  * @brief Contains the Parser and Result types for the syntax parsers
@@ -188,7 +190,7 @@ inline Parser digit()
 {
     return [](std::string_view input) -> Result
     {
-        if (input.empty() || !std::isdigit(input[0]))
+        if (input.empty() || !charclass::isDigit(input[0]))
         {
             return abs::makeFailure<ResultT>(input, {});
         }
@@ -221,7 +223,7 @@ inline Parser literal(const std::string lit, bool caseSensitive = true)
     else
     {
         auto lowerLit = lit;
-        std::transform(lowerLit.begin(), lowerLit.end(), lowerLit.begin(), [](char c) { return std::tolower(c); });
+        std::transform(lowerLit.begin(), lowerLit.end(), lowerLit.begin(), [](char c) { return charclass::toLower(c); });
         return [lowerLit](std::string_view input) -> Result
         {
             if (input.size() < lowerLit.size())
@@ -231,7 +233,7 @@ inline Parser literal(const std::string lit, bool caseSensitive = true)
 
             for (auto i = 0; i < lowerLit.size(); ++i)
             {
-                if (std::tolower(input[i]) != lowerLit[i])
+                if (charclass::toLower(input[i]) != lowerLit[i])
                 {
                     return abs::makeFailure<ResultT>(input, {});
                 }
@@ -253,7 +255,7 @@ inline Parser toEnd(char endToken)
 {
     return [endToken](std::string_view input) -> Result
     {
-        const auto pos = input.find(endToken);
+        const auto pos = scan::findChar(input, endToken);
         if (pos == std::string_view::npos || pos == 0)
         {
             return abs::makeFailure<ResultT>(input, {});
@@ -274,7 +276,7 @@ inline Parser toEnd(const std::string& endToken)
 {
     return [endToken](std::string_view input) -> Result
     {
-        const auto pos = input.find(endToken);
+        const auto pos = scan::findString(input, endToken);
         if (pos == std::string_view::npos || pos == 0)
         {
             return abs::makeFailure<ResultT>(input, {});
@@ -355,9 +357,9 @@ inline Parser toEnd(const std::vector<std::string>& endTokens)
  */
 inline Parser alnum(const std::string& additional = "")
 {
-    return [additional](std::string_view input) -> Result
+    return [accept = charclass::AcceptSet {charclass::ALNUM, additional}](std::string_view input) -> Result
     {
-        if (!input.empty() && (std::isalnum(input[0]) || additional.find(input[0]) != std::string::npos))
+        if (!input.empty() && accept(input[0]))
         {
             return abs::makeSuccess<ResultT>(input.substr(1));
         }
@@ -375,7 +377,7 @@ inline Parser hex()
 {
     return [](std::string_view input) -> Result
     {
-        if (input.empty() || !std::isxdigit(input[0]))
+        if (input.empty() || !charclass::isXdigit(input[0]))
         {
             return abs::makeFailure<ResultT>(input, {});
         }
@@ -75,6 +75,25 @@ INSTANTIATE_TEST_SUITE_P(
 //     fn(R"({"original":"ldap://[2001:db8::7]/c=GB?objectClass?one","domain":"[2001:db8::7]","path":"/c=GB","scheme":"ldap","query":"objectClass?one"})"),
 //      41}
 
+TEST(UriCacheTest, RepeatedUriResolvesFromCache)
+{
+    auto parser = getUriParser({NAME, TARGET, {""}, {}});
+    const std::string input = "https://cache.wazuh.test:8080/index.html?name=pepe";
+
+    json::Json first;
+    ASSERT_FALSE(hlp::parser::run(parser, input, first));
+    const auto before = hlp::parsers::getUriCacheStats();
+
+    // Same URI again: decomposition comes from the interned cache
+    json::Json second;
+    ASSERT_FALSE(hlp::parser::run(parser, input, second));
+    const auto after = hlp::parsers::getUriCacheStats();
+
+    EXPECT_EQ(first.str(), second.str());
+    EXPECT_EQ(after.hits, before.hits + 1);
+    EXPECT_EQ(after.misses, before.misses);
+}
+
 /************************************
  *  User Agent test
  ************************************/
@@ -13,6 +13,7 @@
 #define _INDEXER_CONNECTOR_HPP
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
@@ -47,8 +48,11 @@ struct IndexerConnectorOptions
     } sslOptions;                        ///< The SSL options to connect to OpenSearch.
 
     uint32_t timeout = 60000u;  ///< The timeout in milliseconds to connect to OpenSearch.
-    uint8_t workingThreads = 1; ///< The number of threads to dequeue and send the data.
+    uint8_t workingThreads = 1; ///< Concurrent in-flight bulks; values above 1 relax per-document ordering.
     std::string databasePath;   ///< The path to the database file.
+    bool compressRequests = false; ///< Gzip-compress the bulk request bodies sent to the configured hosts.
+    uint32_t catchUpEventsPerSecond =
+        0; ///< Throughput cap applied while draining a persisted backlog, in events per second. 0 disables the cap.
 };
 
 template<typename TMonitoring = void>
@@ -73,6 +77,70 @@ class EXPORTED IndexerConnector final : public IIndexerConnector
     std::mutex m_syncMutex;
     std::unique_ptr<ThreadDispatchQueue> m_dispatcher;
 
+    /**
+     * @brief Byte size at which a bulk request is flushed, auto-tuned from the indexer response latency.
+     */
+    std::atomic<uint64_t> m_bulkBytesTarget {0};
+
+    /**
+     * @brief Document count target handed to the dispatcher, auto-tuned from the indexer response latency.
+     */
+    uint64_t m_bulkElementsTarget {0};
+
+    /**
+     * @brief Exponential moving average of the indexer bulk response latency, in milliseconds.
+     */
+    double m_latencyEwmaMs {0.0};
+
+    /**
+     * @brief Whether bulk request bodies are gzip-compressed before being sent.
+     */
+    bool m_compressRequests {false};
+
+    /**
+     * @brief Events per second allowed while draining a persisted backlog, 0 means unlimited.
+     */
+    uint32_t m_catchUpEventsPerSecond {0};
+
+    /**
+     * @brief Start of the current catch-up accounting window.
+     */
+    std::chrono::steady_clock::time_point m_rateWindowStart;
+
+    /**
+     * @brief Documents flushed within the current catch-up accounting window.
+     */
+    uint64_t m_rateWindowCount {0};
+
+    /**
+     * @brief Rotates the end-of-batch flush order across the per-index bulk buffers, so no target
+     * index is systematically posted last.
+     */
+    std::atomic<uint64_t> m_flushRotation {0};
+
+    /**
+     * @brief Paces the drain of a persisted backlog so recovery does not starve live traffic.
+     *
+     * Only kicks in when a catch-up cap is configured and the persistent queue holds a backlog;
+     * steady-state traffic is never throttled. Once the cap is reached within a one-second window
+     * the calling worker sleeps until the window ends, waking early on shutdown. Takes m_syncMutex
+     * since workers flush concurrently.
+     *
+     * @param documentsSent Amount of documents in the bulk that was just flushed.
+     */
+    void throttleCatchUp(uint64_t documentsSent);
+
+    /**
+     * @brief Re-tunes the bulk byte and document count targets from the observed response latency.
+     *
+     * Called after every bulk request; takes m_syncMutex since workers run concurrently. Shrinks the
+     * targets when the smoothed latency is above the slow threshold and grows them back when it is
+     * below the fast one.
+     *
+     * @param latencyMs Latency of the last bulk request, in milliseconds.
+     */
+    void adjustBulkTargets(uint64_t latencyMs);
+
 public:
     /**
      * @brief Class constructor
@@ -82,8 +150,8 @@ public:
      * 2. Selects the server to be used through a round-robin algorithm among the available servers (servers are
      * health-checked using the API endpoint (/_cat/health)
      * 3. Sets up the dispatcher to process messages asynchronously using a persistent queue. Messages are dispatched in
-     * bulk either when the maximum bulk size or the time interval is reached. The bulk size is 1000 messages and the
-     * interval is 5 seconds.
+     * bulk when the byte size target, the document count target or the max-linger interval is reached, whichever comes
+     * first. Both targets are auto-tuned from the observed indexer response latency.
      * 4. In each bulk query, the index name "$(date)" placeholder will be replaced by the current date.
      *
      * @param config Indexer connector configuration
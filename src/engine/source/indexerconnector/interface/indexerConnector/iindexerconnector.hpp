@@ -13,7 +13,9 @@ public:
      * @brief Publishes a message (in JSON string format) to a persistent queue.
      * This method returns immediately without waiting for the message to be processed.
      *
-     * @param message The message to be published (must be in JSON string format).
+     * @param message The message to be published (must be in JSON string format). An optional
+     * "index" field overrides the configured index for that document; documents are bulked and
+     * posted per target index.
      */
     virtual void publish(const std::string& message) = 0;
 };
@@ -9,12 +9,18 @@
  * Foundation.
  */
 
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <map>
+#include <vector>
 #include <grp.h>
 #include <pwd.h>
 #include <unistd.h>
 
+#include <zlib.h>
+
 #include <HTTPRequest.hpp>
 #include <base/logging.hpp>
 #include <base/utils/stringUtils.hpp>
@@ -28,6 +34,22 @@ constexpr auto INDEXER_COLUMN {"indexer"};
 constexpr auto USER_KEY {"username"};
 constexpr auto PASSWORD_KEY {"password"};
 constexpr auto ELEMENTS_PER_BULK {1000};
+
+// Adaptive batching: a bulk is flushed when the byte target, the document count target or the
+// max-linger interval is reached, whichever comes first. Both targets are re-tuned after every
+// request from the smoothed indexer response latency.
+constexpr auto MIN_ELEMENTS_PER_BULK {25};
+constexpr uint64_t MIN_BULK_BYTES {64ULL * 1024};
+constexpr uint64_t INITIAL_BULK_BYTES {1024ULL * 1024};
+constexpr uint64_t MAX_BULK_BYTES {4096ULL * 1024};
+constexpr auto MAX_BULK_LINGER = std::chrono::milliseconds(500);
+constexpr auto LATENCY_FAST_MS {250.0};
+constexpr auto LATENCY_SLOW_MS {1000.0};
+constexpr auto LATENCY_EWMA_WEIGHT {0.2};
+
+// The catch-up throughput cap only engages while the persistent queue holds at least this many
+// events, so steady-state traffic is never throttled.
+constexpr uint64_t CATCH_UP_BACKLOG_THRESHOLD {10 * ELEMENTS_PER_BULK};
 constexpr auto WAZUH_OWNER {"wazuh"};
 constexpr auto WAZUH_GROUP {"wazuh"};
 constexpr auto MERGED_CA_PATH {"/tmp/wazuh-server/root-ca-merged.pem"};
@@ -139,6 +161,41 @@ static void initConfiguration(SecureCommunication& secureCommunication, const In
         .caRootCertificate(caRootCertificate);
 }
 
+/**
+ * @brief Compresses a request body with gzip.
+ * @param input The uncompressed body.
+ * @return The gzip-compressed body.
+ * @throws std::runtime_error If the compressor could not be initialized or the compression failed.
+ */
+static std::string gzipCompress(const std::string& input)
+{
+    z_stream stream {};
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        throw std::runtime_error("Could not initialize the gzip compressor.");
+    }
+
+    std::string output;
+    output.resize(deflateBound(&stream, input.size()));
+
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+    stream.next_out = reinterpret_cast<Bytef*>(output.data());
+    stream.avail_out = static_cast<uInt>(output.size());
+
+    const auto result = deflate(&stream, Z_FINISH);
+    const auto compressedSize = stream.total_out;
+    deflateEnd(&stream);
+
+    if (result != Z_STREAM_END)
+    {
+        throw std::runtime_error("Could not compress the request body.");
+    }
+
+    output.resize(compressedSize);
+    return output;
+}
+
 static void builderBulkDelete(std::string& bulkData, std::string_view id, std::string_view index)
 {
     bulkData.append(R"({"delete":{"_index":")");
@@ -189,24 +246,111 @@ IndexerConnector::IndexerConnector(const IndexerConnectorOptions& indexerConnect
         LOG_DEBUG("Invalid number of working threads, using default value.");
     }
 
+    m_bulkBytesTarget.store(INITIAL_BULK_BYTES);
+    m_bulkElementsTarget = ELEMENTS_PER_BULK;
+    m_compressRequests = indexerConnectorOptions.compressRequests;
+    m_catchUpEventsPerSecond = indexerConnectorOptions.catchUpEventsPerSecond;
+    m_rateWindowStart = std::chrono::steady_clock::now();
+
     m_dispatcher = std::make_unique<ThreadDispatchQueue>(
+        ThreadEventDispatcherParams {.dbPath = indexerConnectorOptions.databasePath + m_indexName,
+                                     .bulkSize = ELEMENTS_PER_BULK,
+                                     .bulkTimeout = MAX_BULK_LINGER,
+                                     .dispatcherType =
+                                         (indexerConnectorOptions.workingThreads <= SINGLE_ORDERED_DISPATCHING
+                                              ? ThreadEventDispatcherType::SINGLE_THREADED_ORDERED
+                                              : ThreadEventDispatcherType::MULTI_THREADED_UNORDERED),
+                                     .workersCount = indexerConnectorOptions.workingThreads});
+
+    m_dispatcher->startWorker(
         [this, selector, secureCommunication, functionName = logging::getLambdaName(__FUNCTION__, "processEventQueue")](
             std::queue<std::string>& dataQueue)
         {
-            std::scoped_lock lock(m_syncMutex);
-
+            // No lock here: workers post their bulks concurrently, each one taking the next healthy
+            // server from the selector. The shared tuning state is guarded inside adjustBulkTargets.
             if (m_stopping.load())
             {
                 LOG_DEBUG_L(functionName.c_str(), "IndexerConnector is stopping, event processing will be skipped.");
                 throw std::runtime_error("IndexerConnector is stopping, event processing will be skipped.");
             }
 
-            auto url = selector->getNext();
-            std::string bulkData;
-            url.append("/_bulk?refresh=wait_for");
+            // One bulk buffer per target index: documents carrying an "index" override are
+            // assembled and posted independently of the configured index, so a slow or verbose
+            // index does not hold back the others.
+            struct BulkBuffer
+            {
+                std::string index;
+                std::string data;
+                uint64_t documents {0};
+            };
+            std::map<std::string, BulkBuffer> bulks;
+
+            // Posts the accumulated bulk and re-tunes the flush targets from the response latency.
+            // Each bulk takes the currently cheapest server and reports the outcome back, feeding
+            // the latency-weighted selection.
+            const auto flushBulk = [&](BulkBuffer& bulk)
+            {
+                auto& bulkData = bulk.data;
+                if (bulkData.empty())
+                {
+                    return;
+                }
 
-            std::string indexNameCurrentDate = m_indexName;
-            base::utils::string::replaceAll(indexNameCurrentDate, "$(date)", base::utils::time::getCurrentDate("."));
+                const auto server = selector->getNext();
+
+                RequestParameters requestParameters {.url = HttpURL(server + "/_bulk?refresh=wait_for"),
+                                                     .secureCommunication = secureCommunication};
+                if (m_compressRequests)
+                {
+                    try
+                    {
+                        requestParameters.data = gzipCompress(bulkData);
+                        requestParameters.httpHeaders.insert("Content-Encoding: gzip");
+                    }
+                    catch (const std::exception& e)
+                    {
+                        LOG_WARNING_L(functionName.c_str(),
+                                      "Could not compress the bulk request, sending it uncompressed: {}",
+                                      e.what());
+                        requestParameters.data = bulkData;
+                    }
+                }
+                else
+                {
+                    requestParameters.data = bulkData;
+                }
+
+                const auto postStart = std::chrono::steady_clock::now();
+                try
+                {
+                    HTTPRequest::instance().post(
+                        std::move(requestParameters),
+                        {.onSuccess =
+                             [functionName = logging::getLambdaName(__FUNCTION__, "handleSuccessfulPostResponse")](
+                                 const std::string& response)
+                         { LOG_DEBUG_L(functionName.c_str(), "Response: {}", response.c_str()); },
+                         .onError =
+                             [functionName = logging::getLambdaName(__FUNCTION__, "handlePostResponseError")](
+                                 const std::string& error, const long statusCode)
+                         {
+                             LOG_ERROR_L(functionName.c_str(), "{}, status code: {}.", error.c_str(), statusCode);
+                             throw std::runtime_error(error);
+                         }});
+                }
+                catch (...)
+                {
+                    selector->reportFailure(server);
+                    throw;
+                }
+                const auto latency =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - postStart);
+
+                selector->reportSuccess(server, latency);
+                adjustBulkTargets(latency.count());
+                throttleCatchUp(bulk.documents);
+                bulkData.clear();
+                bulk.documents = 0;
+            };
 
             while (!dataQueue.empty())
             {
@@ -219,42 +363,116 @@ IndexerConnector::IndexerConnector(const IndexerConnectorOptions& indexerConnect
                     continue;
                 }
 
+                const auto& targetIndex =
+                    parsedData.contains("index") ? parsedData.at("index").get_ref<const std::string&>() : m_indexName;
+
+                auto bulkIt = bulks.find(targetIndex);
+                if (bulkIt == bulks.end())
+                {
+                    auto resolvedIndex = targetIndex;
+                    base::utils::string::replaceAll(
+                        resolvedIndex, "$(date)", base::utils::time::getCurrentDate("."));
+                    bulkIt = bulks.emplace(targetIndex, BulkBuffer {std::move(resolvedIndex), {}, 0}).first;
+                }
+                auto& bulk = bulkIt->second;
+
                 if (parsedData.at("operation").get_ref<const std::string&>().compare("DELETED") == 0)
                 {
                     const auto& id = parsedData.at("id").get_ref<const std::string&>();
-                    builderBulkDelete(bulkData, id, indexNameCurrentDate);
+                    builderBulkDelete(bulk.data, id, bulk.index);
                 }
                 else
                 {
                     const auto& id = parsedData.contains("id") ? parsedData.at("id").get_ref<const std::string&>() : "";
                     const auto dataString = parsedData.at("data").dump();
-                    builderBulkIndex(bulkData, id, indexNameCurrentDate, dataString);
+                    builderBulkIndex(bulk.data, id, bulk.index, dataString);
+                }
+
+                ++bulk.documents;
+
+                // Flush early if the byte target is reached, so a burst of large documents does not
+                // overshoot the indexer bulk limits. Only the offending index flushes; the others
+                // keep accumulating towards their own targets.
+                if (bulk.data.size() >= m_bulkBytesTarget.load(std::memory_order_relaxed))
+                {
+                    flushBulk(bulk);
                 }
             }
 
-            if (!bulkData.empty())
+            // Rotate the end-of-batch flush order so no index is systematically posted last when
+            // several indices share a batch.
+            std::vector<BulkBuffer*> pendingBulks;
+            pendingBulks.reserve(bulks.size());
+            for (auto& [name, bulk] : bulks)
             {
-                // Process data.
-                HTTPRequest::instance().post(
-                    {.url = HttpURL(url), .data = bulkData, .secureCommunication = secureCommunication},
-                    {.onSuccess = [functionName = logging::getLambdaName(__FUNCTION__, "handleSuccessfulPostResponse")](
-                                      const std::string& response)
-                     { LOG_DEBUG_L(functionName.c_str(), "Response: {}", response.c_str()); },
-                     .onError =
-                         [functionName = logging::getLambdaName(__FUNCTION__, "handlePostResponseError")](
-                             const std::string& error, const long statusCode)
-                     {
-                         LOG_ERROR_L(functionName.c_str(), "{}, status code: {}.", error.c_str(), statusCode);
-                         throw std::runtime_error(error);
-                     }});
+                pendingBulks.push_back(&bulk);
             }
-        },
-        ThreadEventDispatcherParams {.dbPath = indexerConnectorOptions.databasePath + m_indexName,
-                                     .bulkSize = ELEMENTS_PER_BULK,
-                                     .dispatcherType =
-                                         (indexerConnectorOptions.workingThreads <= SINGLE_ORDERED_DISPATCHING
-                                              ? ThreadEventDispatcherType::SINGLE_THREADED_ORDERED
-                                              : ThreadEventDispatcherType::MULTI_THREADED_UNORDERED)});
+
+            if (!pendingBulks.empty())
+            {
+                const auto start = m_flushRotation.fetch_add(1, std::memory_order_relaxed) % pendingBulks.size();
+                for (size_t i = 0; i < pendingBulks.size(); ++i)
+                {
+                    flushBulk(*pendingBulks.at((start + i) % pendingBulks.size()));
+                }
+            }
+        });
+}
+
+void IndexerConnector::adjustBulkTargets(uint64_t latencyMs)
+{
+    std::scoped_lock lock(m_syncMutex);
+
+    m_latencyEwmaMs =
+        LATENCY_EWMA_WEIGHT * static_cast<double>(latencyMs) + (1.0 - LATENCY_EWMA_WEIGHT) * m_latencyEwmaMs;
+
+    auto bytesTarget = m_bulkBytesTarget.load(std::memory_order_relaxed);
+    auto elementsTarget = m_bulkElementsTarget;
+
+    if (m_latencyEwmaMs > LATENCY_SLOW_MS)
+    {
+        // The indexer is struggling, back off multiplicatively
+        bytesTarget = std::max<uint64_t>(bytesTarget / 2, MIN_BULK_BYTES);
+        elementsTarget = std::max<uint64_t>(elementsTarget / 2, MIN_ELEMENTS_PER_BULK);
+    }
+    else if (m_latencyEwmaMs < LATENCY_FAST_MS)
+    {
+        // The indexer keeps up, grow back towards the maximum targets
+        bytesTarget = std::min<uint64_t>(bytesTarget + bytesTarget / 4, MAX_BULK_BYTES);
+        elementsTarget = std::min<uint64_t>(elementsTarget + elementsTarget / 4, ELEMENTS_PER_BULK);
+    }
+
+    m_bulkBytesTarget.store(bytesTarget, std::memory_order_relaxed);
+    m_bulkElementsTarget = elementsTarget;
+    m_dispatcher->setBulkSize(elementsTarget);
+}
+
+void IndexerConnector::throttleCatchUp(uint64_t documentsSent)
+{
+    if (m_catchUpEventsPerSecond == 0 || m_dispatcher->size() < CATCH_UP_BACKLOG_THRESHOLD)
+    {
+        return;
+    }
+
+    std::unique_lock lock(m_syncMutex);
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - m_rateWindowStart >= std::chrono::seconds(1))
+    {
+        m_rateWindowStart = now;
+        m_rateWindowCount = 0;
+    }
+
+    m_rateWindowCount += documentsSent;
+
+    if (m_rateWindowCount >= m_catchUpEventsPerSecond)
+    {
+        // Budget exhausted, sleep until the window ends. Shutdown wakes the worker early.
+        m_cv.wait_until(lock, m_rateWindowStart + std::chrono::seconds(1), [this]() { return m_stopping.load(); });
+
+        m_rateWindowStart = std::chrono::steady_clock::now();
+        m_rateWindowCount = 0;
+    }
 }
 
 IndexerConnector::~IndexerConnector()
@@ -24,8 +24,10 @@
 #include <thread>
 #include <vector>
 
-// 60 seconds interval for monitoring
-constexpr auto HEALTH_CHECK_INTERVAL_MS = 60000u;
+// 15 seconds interval for monitoring. The sweep probes every node concurrently, so its cost is
+// bounded by the slowest single probe and it is cheap enough to run this often; a short interval
+// lets the server selector pick a recovered node up in seconds.
+constexpr auto HEALTH_CHECK_INTERVAL_MS = 15000u;
 
 // 5 seconds timeout for health check requests
 constexpr auto HEALTH_CHECK_TIMEOUT_MS = 5000u;
@@ -54,22 +56,21 @@ class TMonitoring final
     uint32_t m_interval {HEALTH_CHECK_INTERVAL_MS};
 
     /**
-     * @brief Checks the health of a server.
+     * @brief Probes the health of a single server.
      *
-     * @note It sends a request to the \p serverAddress and update the serverStatus. The \p authentication object is
+     * @note It sends a request to the \p serverAddress with its own timeout. The \p authentication object is
      * used to provide secure communication.
      *
-     * @note The serverStatus is updated to true if the server is green or yellow, otherwise it is updated to false.
+     * @note The server is reported available if it is green or yellow, unavailable otherwise.
      *
      * @param serverAddress Server's address.
      * @param authentication Object that provides secure communication.
+     * @return true if the server is green or yellow, false otherwise.
      */
-    void healthCheck(const std::string& serverAddress, const SecureCommunication& authentication)
+    static bool healthCheck(const std::string& serverAddress, const SecureCommunication& authentication)
     {
-        auto& serverStatus = m_servers[serverAddress];
-
         // Set the server status to unavailable by default
-        serverStatus = false;
+        bool serverStatus {false};
 
         // On success callback
         const auto onSuccess = [&serverStatus](std::string response)
@@ -117,27 +118,71 @@ class TMonitoring final
             RequestParameters {.url = HttpURL(serverAddress + "/_cat/health"), .secureCommunication = authentication},
             PostRequestParameters {.onSuccess = onSuccess, .onError = onError},
             ConfigurationParameters {.timeout = HEALTH_CHECK_TIMEOUT_MS});
+
+        return serverStatus;
     }
 
     /**
-     * @brief Initializes the status of the servers and adds them to the monitoring list.
+     * @brief Probes every monitored server concurrently and publishes the merged statuses.
+     *
+     * @note Each server is probed on its own thread with its own timeout, so one unresponsive node delays the
+     * sweep by at most HEALTH_CHECK_TIMEOUT_MS instead of pushing back the probes of the healthy nodes. The
+     * statuses are published together once every probe returned.
      *
      * @param authentication Object that provides secure communication.
      */
-    void initialize(const std::vector<std::string>& serverAddresses, const SecureCommunication& authentication)
+    void checkAllServers(const SecureCommunication& authentication)
     {
+        std::vector<std::string> serverAddresses;
+        {
+            std::scoped_lock lock(m_mutex);
+            for (const auto& [serverAddress, _] : m_servers)
+            {
+                serverAddresses.push_back(serverAddress);
+            }
+        }
+
+        // Plain bytes instead of std::vector<bool>: each probe thread writes its own slot.
+        std::vector<uint8_t> statuses(serverAddresses.size(), false);
+        std::vector<std::thread> probes;
+        probes.reserve(serverAddresses.size());
+
+        for (size_t i = 0; i < serverAddresses.size(); ++i)
+        {
+            probes.emplace_back([i, &serverAddresses, &statuses, &authentication]()
+                                { statuses[i] = healthCheck(serverAddresses[i], authentication); });
+        }
+
+        for (auto& probe : probes)
+        {
+            probe.join();
+        }
+
         std::scoped_lock lock(m_mutex);
+        for (size_t i = 0; i < serverAddresses.size(); ++i)
+        {
+            m_servers[serverAddresses[i]] = statuses[i];
+        }
+    }
 
-        // Initialize the status of the servers
-        for (const auto& serverAddress : serverAddresses)
+    /**
+     * @brief Initializes the status of the servers and adds them to the monitoring list.
+     *
+     * @param authentication Object that provides secure communication.
+     */
+    void initialize(const std::vector<std::string>& serverAddresses, const SecureCommunication& authentication)
+    {
         {
-            if (m_stop)
+            std::scoped_lock lock(m_mutex);
+
+            // Register the servers as unavailable until the first sweep reports back.
+            for (const auto& serverAddress : serverAddresses)
             {
-                // If the thread is stopped, break the loop.
-                return;
+                m_servers[serverAddress] = false;
             }
-            healthCheck(serverAddress, authentication);
         }
+
+        checkAllServers(authentication);
     }
 
 public:
@@ -172,19 +217,18 @@ public:
             {
                 while (!m_stop)
                 {
-                    // Wait for the interval.
-                    std::unique_lock lock(m_mutex);
-                    m_condition.wait_for(
-                        lock, std::chrono::milliseconds(m_interval), [this]() { return m_stop.load(); });
+                    // Wait for the interval. The lock is released before the sweep so probes do not
+                    // block isAvailable() queries.
+                    {
+                        std::unique_lock lock(m_mutex);
+                        m_condition.wait_for(
+                            lock, std::chrono::milliseconds(m_interval), [this]() { return m_stop.load(); });
+                    }
 
                     // If the thread is not stopped, check the health of the servers.
                     if (!m_stop)
                     {
-                        // Check the health of the servers.
-                        for (const auto& [serverAddress, _] : m_servers)
-                        {
-                            healthCheck(serverAddress, authentication);
-                        }
+                        checkAllServers(authentication);
                     }
                 }
             });
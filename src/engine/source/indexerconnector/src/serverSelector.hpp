@@ -12,26 +12,63 @@
 #ifndef _SERVER_SELECTOR_HPP
 #define _SERVER_SELECTOR_HPP
 
-#include "base/utils/roundRobinSelector.hpp"
 #include "monitoring.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 /**
  * @brief ServerSelector class.
  *
+ * Selects among the available servers weighting each one by an exponentially weighted moving
+ * average of its response latency and its current in-flight request count, so fast servers absorb
+ * proportionally more traffic and a degrading server sheds load before it fails health checks.
+ * Servers with equal scores are rotated round-robin. Callers feed the weights back through
+ * reportSuccess()/reportFailure() after each request.
  */
 template<typename TMonitoring>
-class TServerSelector final : private RoundRobinSelector<std::string>
+class TServerSelector final
 {
 private:
+    /**
+     * @brief Latency estimate used for servers without any reported sample, low so new servers are
+     * tried promptly.
+     */
+    static constexpr double DEFAULT_LATENCY_MS = 1.0;
+
+    /**
+     * @brief Latency assigned on a failure of a server without any reported sample.
+     */
+    static constexpr double FAILURE_LATENCY_MS = 1000.0;
+
+    /**
+     * @brief Weight of the newest sample in the latency moving average.
+     */
+    static constexpr double EWMA_WEIGHT = 0.2;
+
+    /**
+     * @brief Per-server selection state.
+     */
+    struct ServerStats
+    {
+        std::atomic<double> ewmaLatencyMs {0.0}; ///< Smoothed response latency, 0 until the first sample.
+        std::atomic<int64_t> inFlight {0};       ///< Requests selected but not yet reported.
+    };
+
+    std::vector<std::string> m_servers;
+    std::unordered_map<std::string, ServerStats> m_stats;
+    std::atomic<std::size_t> m_index {0};
     std::shared_ptr<TMonitoring> monitoring;
 
 public:
     ~TServerSelector() = default;
 
     /**
-     * @brief Class constructor. Initializes Round Robin selector and monitoring.
+     * @brief Class constructor. Initializes the weighted selector and monitoring.
      *
      * @param values Servers to be selected.
      * @param timeout Timeout for monitoring.
@@ -40,30 +77,113 @@ public:
     explicit TServerSelector(const std::vector<std::string>& values,
                              const uint32_t timeout = HEALTH_CHECK_TIMEOUT_MS,
                              const SecureCommunication& secureCommunication = {})
-        : RoundRobinSelector<std::string>(values)
+        : m_servers(values)
         , monitoring(std::make_shared<TMonitoring>(values, timeout, secureCommunication))
     {
+        for (const auto& server : m_servers)
+        {
+            m_stats.try_emplace(server);
+        }
     }
 
     /**
      * @brief Get next selected server.
      *
+     * Picks the available server with the lowest expected cost (smoothed latency times queued
+     * requests) and accounts an in-flight request against it; the caller must balance the
+     * selection with reportSuccess() or reportFailure().
+     *
      * @return std::string Server address.
      */
     std::string getNext()
     {
-        auto initialValue {RoundRobinSelector<std::string>::getNext()};
-        auto retValue {initialValue};
+        const auto start = m_index.load(std::memory_order_relaxed);
+
+        ServerStats* bestStats {nullptr};
+        const std::string* best {nullptr};
+        std::size_t bestIndex {0};
+        double bestScore {0.0};
 
-        while (!monitoring->isAvailable(retValue))
+        for (std::size_t i = 0; i < m_servers.size(); ++i)
         {
-            retValue = RoundRobinSelector<std::string>::getNext();
-            if (retValue.compare(initialValue) == 0)
+            const auto index = (start + i) % m_servers.size();
+            const auto& server = m_servers[index];
+            if (!monitoring->isAvailable(server))
+            {
+                continue;
+            }
+
+            auto& stats = m_stats.at(server);
+            const auto ewma = stats.ewmaLatencyMs.load(std::memory_order_relaxed);
+            const auto queued = std::max<int64_t>(stats.inFlight.load(std::memory_order_relaxed), 0);
+            const auto score = (ewma > 0.0 ? ewma : DEFAULT_LATENCY_MS) * static_cast<double>(queued + 1);
+
+            if (best == nullptr || score < bestScore)
             {
-                throw std::runtime_error("No available server");
+                best = &server;
+                bestStats = &stats;
+                bestIndex = index;
+                bestScore = score;
             }
         }
-        return retValue;
+
+        if (best == nullptr)
+        {
+            throw std::runtime_error("No available server");
+        }
+
+        // Next scan starts past the chosen server, rotating servers with equal scores
+        m_index.store((bestIndex + 1) % m_servers.size(), std::memory_order_relaxed);
+        bestStats->inFlight.fetch_add(1, std::memory_order_relaxed);
+        return *best;
+    }
+
+    /**
+     * @brief Reports a finished request, feeding its latency into the server moving average.
+     *
+     * @param server Server address returned by getNext().
+     * @param latency Observed response latency.
+     */
+    void reportSuccess(const std::string& server, const std::chrono::milliseconds& latency)
+    {
+        const auto it = m_stats.find(server);
+        if (it == m_stats.end())
+        {
+            return;
+        }
+
+        it->second.inFlight.fetch_sub(1, std::memory_order_relaxed);
+
+        const auto sample = static_cast<double>(latency.count());
+        auto expected = it->second.ewmaLatencyMs.load(std::memory_order_relaxed);
+        double desired {};
+        do
+        {
+            desired = expected > 0.0 ? EWMA_WEIGHT * sample + (1.0 - EWMA_WEIGHT) * expected : sample;
+        } while (!it->second.ewmaLatencyMs.compare_exchange_weak(expected, desired, std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Reports a failed request, doubling the server latency estimate so it sheds load.
+     *
+     * @param server Server address returned by getNext().
+     */
+    void reportFailure(const std::string& server)
+    {
+        const auto it = m_stats.find(server);
+        if (it == m_stats.end())
+        {
+            return;
+        }
+
+        it->second.inFlight.fetch_sub(1, std::memory_order_relaxed);
+
+        auto expected = it->second.ewmaLatencyMs.load(std::memory_order_relaxed);
+        double desired {};
+        do
+        {
+            desired = expected > 0.0 ? expected * 2.0 : FAILURE_LATENCY_MS;
+        } while (!it->second.ewmaLatencyMs.compare_exchange_weak(expected, desired, std::memory_order_relaxed));
     }
 };
 
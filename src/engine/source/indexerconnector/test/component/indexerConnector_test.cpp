@@ -9,6 +9,7 @@
  * Foundation.
  */
 
+#include <array>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
@@ -22,6 +23,8 @@
 #include <thread>
 #include <utility>
 
+#include <zlib.h>
+
 #include <base/logging.hpp>
 #include <base/utils/stringUtils.hpp>
 #include <base/utils/timeUtils.hpp>
@@ -33,6 +36,44 @@
 
 #define BUFFER_SIZE 256
 
+/**
+ * @brief Decompresses a gzip payload, used to check compressed publications.
+ *
+ * @param input Gzip-compressed data.
+ * @return The decompressed data.
+ */
+static std::string gzipDecompress(const std::string& input)
+{
+    z_stream stream {};
+    if (inflateInit2(&stream, 15 + 16) != Z_OK)
+    {
+        throw std::runtime_error("Could not initialize the gzip decompressor.");
+    }
+
+    std::string output;
+    std::array<char, 16384> buffer {};
+
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+
+    int result {Z_OK};
+    do
+    {
+        stream.next_out = reinterpret_cast<Bytef*>(buffer.data());
+        stream.avail_out = static_cast<uInt>(buffer.size());
+        result = inflate(&stream, Z_NO_FLUSH);
+        if (result != Z_OK && result != Z_STREAM_END)
+        {
+            inflateEnd(&stream);
+            throw std::runtime_error("Could not decompress the gzip data.");
+        }
+        output.append(buffer.data(), buffer.size() - stream.avail_out);
+    } while (result != Z_STREAM_END);
+
+    inflateEnd(&stream);
+    return output;
+}
+
 class IndexerConnectorTest : public ::testing::Test
 {
 protected:
@@ -409,6 +450,87 @@ TEST_F(IndexerConnectorTest, Publish)
     ASSERT_NO_THROW(waitUntil([&callbackCalled]() { return callbackCalled; }, MAX_INDEXER_PUBLISH_TIME_MS));
 }
 
+/**
+ * @brief Test the publication of a document carrying an index override. The published metadata is expected to
+ * target the overridden index instead of the configured one.
+ *
+ */
+TEST_F(IndexerConnectorTest, PublishIndexOverride)
+{
+    constexpr auto OVERRIDDEN_INDEX {"indexer_connector_test_override"};
+
+    nlohmann::json expectedMetadata;
+    expectedMetadata["index"]["_index"] = OVERRIDDEN_INDEX;
+    expectedMetadata["index"]["_id"] = INDEX_ID_A;
+
+    // Callback that checks the expected data to be published.
+    constexpr auto INDEX_DATA {"content"};
+    auto callbackCalled {false};
+    const auto checkPublishedData {[&expectedMetadata, &callbackCalled, &INDEX_DATA](const std::string& data)
+                                   {
+                                       const auto splitData {base::utils::string::split(data, '\n')};
+                                       ASSERT_EQ(nlohmann::json::parse(splitData.front()), expectedMetadata);
+                                       ASSERT_EQ(nlohmann::json::parse(splitData.back()), INDEX_DATA);
+                                       callbackCalled = true;
+                                   }};
+    m_indexerServers[A_IDX]->setPublishCallback(checkPublishedData);
+
+    // Create connector and wait until the connection is established.
+    IndexerConnectorOptions indexerConfig {
+        .name = INDEXER_NAME, .hosts = {A_ADDRESS}, .timeout = INDEXER_TIMEOUT, .databasePath = DATABASE_BASE_PATH};
+    auto indexerConnector {IndexerConnector(indexerConfig)};
+
+    // Publish content targeting the overridden index and wait until the publication finishes.
+    nlohmann::json publishData;
+    publishData["id"] = INDEX_ID_A;
+    publishData["operation"] = "INSERT";
+    publishData["index"] = OVERRIDDEN_INDEX;
+    publishData["data"] = INDEX_DATA;
+    ASSERT_NO_THROW(indexerConnector.publish(publishData.dump()));
+    ASSERT_NO_THROW(waitUntil([&callbackCalled]() { return callbackCalled; }, MAX_INDEXER_PUBLISH_TIME_MS));
+}
+
+/**
+ * @brief Test the data publication into a server with request compression enabled. The received payload is
+ * decompressed and checked against the expected one.
+ *
+ */
+TEST_F(IndexerConnectorTest, PublishCompressed)
+{
+    nlohmann::json expectedMetadata;
+    expectedMetadata["index"]["_index"] = INDEXER_NAME;
+    expectedMetadata["index"]["_id"] = INDEX_ID_A;
+
+    // Callback that decompresses the received data and checks it against the expected publication.
+    constexpr auto INDEX_DATA {"content"};
+    auto callbackCalled {false};
+    const auto checkPublishedData {[&expectedMetadata, &callbackCalled, &INDEX_DATA](const std::string& data)
+                                   {
+                                       const auto decompressed {gzipDecompress(data)};
+                                       const auto splitData {base::utils::string::split(decompressed, '\n')};
+                                       ASSERT_EQ(nlohmann::json::parse(splitData.front()), expectedMetadata);
+                                       ASSERT_EQ(nlohmann::json::parse(splitData.back()), INDEX_DATA);
+                                       callbackCalled = true;
+                                   }};
+    m_indexerServers[A_IDX]->setPublishCallback(checkPublishedData);
+
+    // Create connector with compression enabled and wait until the connection is established.
+    IndexerConnectorOptions indexerConfig {.name = INDEXER_NAME,
+                                           .hosts = {A_ADDRESS},
+                                           .timeout = INDEXER_TIMEOUT,
+                                           .databasePath = DATABASE_BASE_PATH,
+                                           .compressRequests = true};
+    auto indexerConnector {IndexerConnector(indexerConfig)};
+
+    // Publish content and wait until the publication finishes.
+    nlohmann::json publishData;
+    publishData["id"] = INDEX_ID_A;
+    publishData["operation"] = "INSERT";
+    publishData["data"] = INDEX_DATA;
+    ASSERT_NO_THROW(indexerConnector.publish(publishData.dump()));
+    ASSERT_NO_THROW(waitUntil([&callbackCalled]() { return callbackCalled; }, MAX_INDEXER_PUBLISH_TIME_MS));
+}
+
 /**
  * @brief Test the connection and posterior data publication into a server. The published data is checked against the
  * expected one. The publication contains a DELETED operation.
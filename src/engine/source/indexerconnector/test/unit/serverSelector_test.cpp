@@ -183,6 +183,70 @@ TEST_F(ServerSelectorTest, TestGetNextBeforeAndAfterHealthCheck)
     EXPECT_EQ(nextServer, GREEN_SERVER);
 }
 
+/**
+ * @brief Test that the selection favors the server with the lowest reported latency.
+ *
+ */
+TEST_F(ServerSelectorTest, TestWeightedSelectionPrefersFastServer)
+{
+    // Set up the expectations for the MockHTTPRequest
+    EXPECT_CALL(*spHTTPRequest, get(::testing::_, ::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke(mockHTTPRequestLambda));
+
+    // Instantiate the Server Selector object
+    auto m_selector = std::make_shared<TServerSelector<TMonitoring<TrampolineHTTPRequest>>>(
+        m_servers, MONITORING_HEALTH_CHECK_INTERVAL);
+
+    // Report a slow response on the first server and a fast one on the second
+    const auto slowServer = m_selector->getNext();
+    m_selector->reportSuccess(slowServer, std::chrono::milliseconds(500));
+
+    const auto fastServer = m_selector->getNext();
+    m_selector->reportSuccess(fastServer, std::chrono::milliseconds(10));
+
+    // The fast server absorbs the traffic while its latency stays low
+    for (auto i = 0; i < 5; ++i)
+    {
+        const auto nextServer = m_selector->getNext();
+        EXPECT_EQ(nextServer, fastServer);
+        m_selector->reportSuccess(nextServer, std::chrono::milliseconds(10));
+    }
+}
+
+/**
+ * @brief Test that a failure penalizes the server latency estimate and sheds its load.
+ *
+ */
+TEST_F(ServerSelectorTest, TestFailurePenaltyShedsLoad)
+{
+    // Set up the expectations for the MockHTTPRequest
+    EXPECT_CALL(*spHTTPRequest, get(::testing::_, ::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke(mockHTTPRequestLambda));
+
+    // Instantiate the Server Selector object
+    auto m_selector = std::make_shared<TServerSelector<TMonitoring<TrampolineHTTPRequest>>>(
+        m_servers, MONITORING_HEALTH_CHECK_INTERVAL);
+
+    // Both servers start with the same reported latency
+    auto server = m_selector->getNext();
+    m_selector->reportSuccess(server, std::chrono::milliseconds(10));
+
+    server = m_selector->getNext();
+    m_selector->reportSuccess(server, std::chrono::milliseconds(10));
+
+    // A failure doubles the latency estimate of the failing server
+    const auto failingServer = m_selector->getNext();
+    m_selector->reportFailure(failingServer);
+
+    // The failing server sheds load while the other keeps its latency
+    for (auto i = 0; i < 5; ++i)
+    {
+        const auto nextServer = m_selector->getNext();
+        EXPECT_NE(nextServer, failingServer);
+        m_selector->reportSuccess(nextServer, std::chrono::milliseconds(10));
+    }
+}
+
 /**
  * @brief Test instantiation and getNext when there are no available servers.
  *
@@ -4,6 +4,7 @@
 #include <kvdb/ikvdbhandler.hpp>
 #include <kvdb/ikvdbhandlercollection.hpp>
 
+#include <base/utils/rocksDBCompactionScheduler.hpp>
 #include <rocksdb/slice.h>
 
 /**
@@ -34,18 +35,22 @@ public:
      * @param cfHandle Pointer to the RocksDB:ColumnFamilyHandle instance.
      * @param dbName Name of the DB.
      * @param scopeName Name of the Scope.
+     * @param compactionHandle Idle-window compaction handle of the main DB, writes are noted
+     * on it. May be nullptr.
      *
      */
     KVDBHandler(std::weak_ptr<rocksdb::DB> weakDB,
                 std::weak_ptr<rocksdb::ColumnFamilyHandle> weakCFHandle,
                 std::shared_ptr<IKVDBHandlerCollection> collection,
                 const std::string& dbName,
-                const std::string& scopeName)
+                const std::string& scopeName,
+                std::shared_ptr<::utils::rocksdb::RocksDBCompactionScheduler::StoreHandle> compactionHandle = nullptr)
         : m_weakDB {weakDB}
         , m_weakCFHandle {weakCFHandle}
         , m_dbName {dbName}
         , m_scopeName {scopeName}
         , m_spCollection {collection}
+        , m_compactionHandle {std::move(compactionHandle)}
     {
     }
 
@@ -91,6 +96,13 @@ public:
      */
     base::RespOrError<std::string> get(const std::string& key) override;
 
+    /**
+     * @copydoc IKVDBHandler::multiGet
+     *
+     */
+    base::RespOrError<std::list<std::pair<std::string, std::string>>>
+    multiGet(const std::vector<std::string>& keys) override;
+
     /**
      * @copydoc IKVDBHandler::dump
      *
@@ -98,6 +110,12 @@ public:
     base::RespOrError<std::list<std::pair<std::string, std::string>>> dump(const unsigned int page,
                                                                            const unsigned int records) override;
 
+    /**
+     * @copydoc IKVDBHandler::dump
+     *
+     */
+    base::OptError dump(const unsigned int page, const unsigned int records, const DumpVisitor& visitor) override;
+
     /**
      * @copydoc IKVDBHandler::search
      *
@@ -118,6 +136,12 @@ protected:
      */
     std::weak_ptr<rocksdb::DB> m_weakDB;
 
+    /**
+     * @brief Idle-window compaction handle of the main DB, writes are noted on it. May be nullptr.
+     *
+     */
+    std::shared_ptr<::utils::rocksdb::RocksDBCompactionScheduler::StoreHandle> m_compactionHandle;
+
     /**
      * @brief Name of the Database. Kept reference to remove handler from collection.
      *
@@ -3,10 +3,11 @@
 
 #include <kvdb/ikvdbhandlercollection.hpp>
 
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
-#include <shared_mutex>
 
 #include <kvdb/kvdbHandler.hpp>
 #include <kvdb/refCounter.hpp>
@@ -18,10 +19,22 @@ namespace kvdbManager
  * @brief Helper class to manage the reference counters for a given DB.
  * This is used to track how many scopes are using a given DB.
  *
+ * The scope set is published as an immutable snapshot swapped atomically: counting a reference
+ * on an already known scope is lock-free, only adding or retiring a scope entry takes the write
+ * mutex and rebuilds the snapshot.
  */
 class KVDBHandlerInstance
 {
 public:
+    /**
+     * @brief Add a reference to an already known scope, lock-free.
+     *
+     * @param scopeName Name of the Scope.
+     * @return true The reference was counted.
+     * @return false The scope is not in the snapshot, use addScope().
+     */
+    bool tryAddScope(const std::string& scopeName);
+
     /**
      * @brief Add a new scope to the reference counter.
      *
@@ -60,22 +73,27 @@ public:
     std::map<std::string, uint32_t> getRefMap(void);
 
 private:
+    using ScopeMap = std::map<std::string, std::shared_ptr<std::atomic<uint32_t>>>;
+
     /**
-     * @brief Basically a wrapper to std::map<std::string, int> with some helper functions.
+     * @brief Immutable snapshot of the scope counters, read with std::atomic_load.
      *
      */
-    RefCounter m_scopeCounter;
+    std::shared_ptr<const ScopeMap> m_scopes {std::make_shared<const ScopeMap>()};
 
     /**
-     * @brief Mutex to protect the internal counter.
+     * @brief Serializes snapshot rebuilds when scope entries are added or retired.
      *
      */
-    std::shared_mutex m_mutex;
+    std::mutex m_writeMutex;
 };
 
 /**
  * @brief Collection of KVDB Handlers for a given DB and the Scopes referencing them.
  *
+ * The DB map is published as an immutable snapshot swapped atomically. Checking out a handler
+ * for a DB and scope that are already registered is lock-free; the instance set only changes at
+ * policy deploy, where structural changes rebuild the snapshot under the write mutex.
  */
 class KVDBHandlerCollection : public IKVDBHandlerCollection
 {
@@ -116,17 +134,20 @@ public:
     std::map<std::string, uint32_t> getRefMap(const std::string& dbName);
 
 private:
+    using InstanceMap = std::map<std::string, std::shared_ptr<KVDBHandlerInstance>>;
+
     /**
-     * @brief Internal map holding DB names and their KVDBHandlerInstance with extra info.
+     * @brief Immutable snapshot of DB names and their KVDBHandlerInstance, read with
+     * std::atomic_load.
      *
      */
-    std::map<std::string, std::shared_ptr<KVDBHandlerInstance>> m_mapInstances;
+    std::shared_ptr<const InstanceMap> m_snapshot {std::make_shared<const InstanceMap>()};
 
     /**
-     * @brief Mutex to protect the internal map.
+     * @brief Serializes snapshot rebuilds when instances are added or removed.
      *
      */
-    std::shared_mutex m_mutex;
+    std::mutex m_writeMutex;
 };
 
 } // namespace kvdbManager
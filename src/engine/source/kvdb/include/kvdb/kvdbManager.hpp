@@ -10,6 +10,7 @@
 #include <rocksdb/options.h>
 
 #include <base/error.hpp>
+#include <base/utils/rocksDBCompactionScheduler.hpp>
 
 #include <kvdb/ikvdbmanager.hpp>
 #include <kvdb/kvdbHandler.hpp>
@@ -19,6 +20,8 @@ namespace metricsManager
 {
 class IMetricsManager;
 class IMetricsScope;
+template<typename T>
+class iCounter;
 } // namespace metricsManager
 
 namespace kvdbManager
@@ -26,6 +29,13 @@ namespace kvdbManager
 
 constexpr static const char* DEFAULT_CF_NAME {"default"};
 
+/**
+ * @brief Minimum number of entries for which loading a DB goes through SST bulk ingestion
+ * instead of sequential writes.
+ *
+ */
+constexpr static size_t BULK_LOAD_MIN_ENTRIES {4096};
+
 /**
  * @brief Options for the KVDBManager.
  *
@@ -34,6 +44,8 @@ struct KVDBManagerOptions
 {
     std::filesystem::path dbStoragePath;
     std::string dbName;
+    size_t blockCacheSize {64 * 1024 * 1024}; ///< Size in bytes of the block cache shared by all the DBs.
+    int64_t compactionRateLimitBytesPerSec {0}; ///< Cap on background I/O (flush and compaction), 0 is unlimited.
 };
 
 /**
@@ -157,6 +169,28 @@ private:
      */
     base::RespOrError<json::Json> getContentFromJsonFile(const std::string& path);
 
+    /**
+     * @brief Bulk load the entries into the DB through an SST file ingested atomically.
+     *
+     * Builds an SST file from the sorted entries and ingests it with
+     * rocksdb::DB::IngestExternalFile, avoiding the write amplification of sequential puts
+     * when loading large lists.
+     *
+     * @param name Name of the DB -> mapped to Column Family.
+     * @param cfHandle Handle of the Column Family.
+     * @param entries Key-value entries to load, reordered in place.
+     * @return base::OptError Specific error.
+     */
+    base::OptError ingestDBFromEntries(const std::string& name,
+                                       const std::shared_ptr<rocksdb::ColumnFamilyHandle>& cfHandle,
+                                       std::vector<std::tuple<std::string, json::Json>>& entries);
+
+    /**
+     * @brief Push the block cache hit/miss deltas from the RocksDB statistics into the metrics scope.
+     *
+     */
+    void updateCacheMetrics();
+
     /**
      * @brief Create a Shared Column Family Shared Pointer with custom delete function.
      *
@@ -197,11 +231,37 @@ private:
      */
     rocksdb::Options m_rocksDBOptions;
 
+    /**
+     * @brief Block cache shared by all the Column Families.
+     *
+     */
+    std::shared_ptr<rocksdb::Cache> m_blockCache;
+
+    /**
+     * @brief Counters of block cache hits and misses exposed through the metrics scope.
+     *
+     */
+    std::shared_ptr<metricsManager::iCounter<uint64_t>> m_spCacheHitsCounter;
+    std::shared_ptr<metricsManager::iCounter<uint64_t>> m_spCacheMissesCounter;
+
+    /**
+     * @brief Last values read from the RocksDB tickers, used to report deltas to the counters.
+     *
+     */
+    uint64_t m_lastCacheHits {0};
+    uint64_t m_lastCacheMisses {0};
+
     /**
      * @brief Internal rocksdb::DB object. This is the main object through which all operations are done.
      *
      */
     std::shared_ptr<rocksdb::DB> m_pRocksDB;
+
+    /**
+     * @brief Idle-window compaction handle, writes through the handlers are noted on it.
+     *
+     */
+    std::shared_ptr<::utils::rocksdb::RocksDBCompactionScheduler::StoreHandle> m_compactionHandle;
     /**
      * @brief Internal map of Column Family Handles.
      * This is the loaded CFs or KVDBs.
@@ -1,11 +1,14 @@
 #ifndef _I_KVDB_HANDLER_H
 #define _I_KVDB_HANDLER_H
 
+#include <functional>
 #include <list>
 #include <map>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <base/error.hpp>
 #include <base/json.hpp>
@@ -80,6 +83,19 @@ public:
      */
     virtual base::RespOrError<std::string> get(const std::string& key) = 0;
 
+    /**
+     * @brief Gets the values of several keys in a single batched lookup.
+     *
+     * Keys that do not exist in the database are omitted from the result, they do not
+     * generate an error.
+     *
+     * @param keys Provided keys.
+     * @return base::RespOrError<std::list<std::pair<std::string, std::string>>> Key-value pairs found.
+     * Specific error otherwise.
+     */
+    virtual base::RespOrError<std::list<std::pair<std::string, std::string>>>
+    multiGet(const std::vector<std::string>& keys) = 0;
+
     /**
      * @brief Retrieves all content with pagination from the database.
      *
@@ -102,6 +118,27 @@ public:
      */
     inline base::RespOrError<std::list<std::pair<std::string, std::string>>> dump() { return dump(0, 0); };
 
+    /**
+     * @brief Visitor invoked once per dumped key-value pair.
+     *
+     * @return true to continue the iteration, false to stop it.
+     */
+    using DumpVisitor = std::function<bool(std::string_view key, std::string_view value)>;
+
+    /**
+     * @brief Streams the content of the database through a visitor, with pagination.
+     *
+     * Unlike \ref dump, the entries are handed to the visitor one at a time while the
+     * database is iterated, so the whole page is never materialized in memory. To
+     * iterate the entire database the parameters page and records must be sent in 0.
+     *
+     * @param page Page number.
+     * @param records Quantity of records for page.
+     * @param visitor Invoked once per entry, returns false to stop the iteration.
+     * @return base::OptError If base::Error not exists the iteration completed. Specific error otherwise.
+     */
+    virtual base::OptError dump(const unsigned int page, const unsigned int records, const DumpVisitor& visitor) = 0;
+
     /**
      * @brief Retrieves all filtered content with pagination of the database.
      *
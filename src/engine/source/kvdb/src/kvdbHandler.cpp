@@ -26,6 +26,10 @@ std::optional<base::Error> KVDBHandler::set(const std::string& key, const std::s
 
             if (status.ok())
             {
+                if (m_compactionHandle)
+                {
+                    m_compactionHandle->noteWrite();
+                }
                 return std::nullopt;
             }
             else
@@ -65,6 +69,10 @@ std::optional<base::Error> KVDBHandler::remove(const std::string& key)
 
             if (status.ok())
             {
+                if (m_compactionHandle)
+                {
+                    m_compactionHandle->noteWrite();
+                }
                 return std::nullopt;
             }
             else
@@ -158,12 +166,102 @@ std::variant<std::string, base::Error> KVDBHandler::get(const std::string& key)
     return base::Error {"Can not access RocksDB::DB"};
 }
 
+std::variant<std::list<std::pair<std::string, std::string>>, base::Error>
+KVDBHandler::multiGet(const std::vector<std::string>& keys)
+{
+    auto pRocksDB = m_weakDB.lock();
+    if (pRocksDB)
+    {
+        auto pCFhandle = m_weakCFHandle.lock();
+        if (pCFhandle)
+        {
+            std::vector<rocksdb::Slice> slices;
+            slices.reserve(keys.size());
+            for (const auto& key : keys)
+            {
+                slices.emplace_back(key);
+            }
+
+            std::vector<rocksdb::ColumnFamilyHandle*> cfHandles(keys.size(), pCFhandle.get());
+            std::vector<std::string> values;
+            auto statuses = pRocksDB->MultiGet(rocksdb::ReadOptions(), cfHandles, slices, &values);
+
+            std::list<std::pair<std::string, std::string>> content;
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                if (statuses[i].ok())
+                {
+                    content.emplace_back(std::make_pair(keys[i], std::move(values[i])));
+                }
+                else if (!statuses[i].IsNotFound())
+                {
+                    std::string_view error = statuses[i].getState() != nullptr ? statuses[i].getState() : "Unknown";
+                    return base::Error {fmt::format("Can not get key '{}'. Error: {}", keys[i], error)};
+                }
+            }
+
+            return content;
+        }
+        else
+        {
+            return base::Error {"Can not access RocksDB Column Family Handle"};
+        }
+    }
+
+    return base::Error {"Can not access RocksDB::DB"};
+}
+
 std::variant<std::list<std::pair<std::string, std::string>>, base::Error> KVDBHandler::dump(const unsigned int page,
                                                                                             const unsigned int records)
 {
     return pageContent(page, records);
 }
 
+base::OptError KVDBHandler::dump(const unsigned int page, const unsigned int records, const DumpVisitor& visitor)
+{
+    auto pRocksDB = m_weakDB.lock();
+    if (pRocksDB)
+    {
+        auto pCFhandle = m_weakCFHandle.lock();
+        if (pCFhandle)
+        {
+            std::unique_ptr<rocksdb::Iterator> iter(pRocksDB->NewIterator(rocksdb::ReadOptions(), pCFhandle.get()));
+
+            unsigned int fromRecords = (page - 1) * records;
+            unsigned int toRecords = fromRecords + records;
+
+            unsigned int i = 0;
+            for (iter->SeekToFirst(); iter->Valid() && i < toRecords; iter->Next())
+            {
+                if (i >= fromRecords)
+                {
+                    // Hand the entry to the visitor without materializing it
+                    const auto key = iter->key();
+                    const auto value = iter->value();
+                    if (!visitor(std::string_view {key.data(), key.size()},
+                                 std::string_view {value.data(), value.size()}))
+                    {
+                        break;
+                    }
+                }
+                i++;
+            }
+
+            if (!iter->status().ok())
+            {
+                return base::Error {fmt::format(
+                    "Database '{}': Could not iterate over database: '{}'", m_dbName, iter->status().ToString())};
+            }
+
+            return base::noError();
+        }
+
+        return base::Error {"Can not access RocksDB Column Family Handle"};
+    }
+
+    return base::Error {"Can not access RocksDB::DB"};
+}
+
 std::variant<std::list<std::pair<std::string, std::string>>, base::Error>
 KVDBHandler::search(const std::string& prefix, const unsigned int page, const unsigned int records)
 {
@@ -9,46 +9,73 @@ namespace kvdbManager
 
 void KVDBHandlerCollection::addKVDBHandler(const std::string& dbName, const std::string& scopeName)
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
-
-    const auto it = m_mapInstances.find(dbName);
-    if (it != m_mapInstances.end())
+    // Fast path: DB and scope already registered, count the reference lock-free
     {
-        auto& instance = it->second;
-        instance->addScope(scopeName);
+        const auto snapshot = std::atomic_load(&m_snapshot);
+        const auto it = snapshot->find(dbName);
+        if (it != snapshot->end() && it->second->tryAddScope(scopeName))
+        {
+            // Confirm the instance was not retired concurrently; instances only change at
+            // policy deploy, so this almost never has to fall back
+            const auto current = std::atomic_load(&m_snapshot);
+            if (current == snapshot)
+            {
+                return;
+            }
+            const auto reIt = current->find(dbName);
+            if (reIt != current->end() && reIt->second == it->second)
+            {
+                return;
+            }
+            it->second->removeScope(scopeName);
+        }
     }
-    else
+
+    std::lock_guard lock {m_writeMutex};
+
+    const auto current = std::atomic_load(&m_snapshot);
+    const auto it = current->find(dbName);
+    if (it != current->end())
     {
-        auto spInstance = std::make_shared<KVDBHandlerInstance>();
-        spInstance->addScope(scopeName);
-        m_mapInstances.emplace(dbName, std::move(spInstance));
+        it->second->addScope(scopeName);
+        return;
     }
+
+    auto spInstance = std::make_shared<KVDBHandlerInstance>();
+    spInstance->addScope(scopeName);
+
+    auto next = std::make_shared<InstanceMap>(*current);
+    next->emplace(dbName, std::move(spInstance));
+    std::atomic_store(&m_snapshot, std::shared_ptr<const InstanceMap> {std::move(next)});
 }
 
 void KVDBHandlerCollection::removeKVDBHandler(const std::string& dbName, const std::string& scopeName)
 {
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    std::lock_guard lock {m_writeMutex};
 
-    const auto it = m_mapInstances.find(dbName);
-    if (it != m_mapInstances.end())
+    const auto current = std::atomic_load(&m_snapshot);
+    const auto it = current->find(dbName);
+    if (it != current->end())
     {
         auto& instance = it->second;
         instance->removeScope(scopeName);
         if (instance->emptyScopes())
         {
-            m_mapInstances.erase(it);
+            auto next = std::make_shared<InstanceMap>(*current);
+            next->erase(dbName);
+            std::atomic_store(&m_snapshot, std::shared_ptr<const InstanceMap> {std::move(next)});
         }
     }
 }
 
 std::vector<std::string> KVDBHandlerCollection::getDBNames()
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    const auto snapshot = std::atomic_load(&m_snapshot);
 
     std::vector<std::string> dbNames;
-    dbNames.reserve(m_mapInstances.size());
+    dbNames.reserve(snapshot->size());
 
-    for (const auto& instance : m_mapInstances)
+    for (const auto& instance : *snapshot)
     {
         dbNames.push_back(instance.first);
     }
@@ -58,10 +85,10 @@ std::vector<std::string> KVDBHandlerCollection::getDBNames()
 
 std::map<std::string, uint32_t> KVDBHandlerCollection::getRefMap(const std::string& dbName)
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    const auto snapshot = std::atomic_load(&m_snapshot);
 
-    const auto it = m_mapInstances.find(dbName);
-    if (it != m_mapInstances.end())
+    const auto it = snapshot->find(dbName);
+    if (it != snapshot->end())
     {
         return it->second->getRefMap();
     }
@@ -69,39 +96,98 @@ std::map<std::string, uint32_t> KVDBHandlerCollection::getRefMap(const std::stri
     return {};
 }
 
+bool KVDBHandlerInstance::tryAddScope(const std::string& scopeName)
+{
+    const auto scopes = std::atomic_load(&m_scopes);
+    const auto it = scopes->find(scopeName);
+    if (it == scopes->end())
+    {
+        return false;
+    }
+
+    it->second->fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
 void KVDBHandlerInstance::addScope(const std::string& scopeName)
 {
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (tryAddScope(scopeName))
+    {
+        return;
+    }
 
-    m_scopeCounter.addRef(scopeName);
+    std::lock_guard lock {m_writeMutex};
+
+    const auto current = std::atomic_load(&m_scopes);
+    const auto it = current->find(scopeName);
+    if (it != current->end())
+    {
+        it->second->fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    auto next = std::make_shared<ScopeMap>(*current);
+    next->emplace(scopeName, std::make_shared<std::atomic<uint32_t>>(1));
+    std::atomic_store(&m_scopes, std::shared_ptr<const ScopeMap> {std::move(next)});
 }
 
 void KVDBHandlerInstance::removeScope(const std::string& scopeName)
 {
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    const auto scopes = std::atomic_load(&m_scopes);
+    const auto it = scopes->find(scopeName);
+    if (it == scopes->end())
+    {
+        return;
+    }
 
-    m_scopeCounter.removeRef(scopeName);
+    if (it->second->fetch_sub(1, std::memory_order_relaxed) == 1)
+    {
+        // Last reference of the scope, retire its entry
+        std::lock_guard lock {m_writeMutex};
+
+        const auto current = std::atomic_load(&m_scopes);
+        const auto reIt = current->find(scopeName);
+        if (reIt != current->end() && reIt->second->load(std::memory_order_relaxed) == 0)
+        {
+            auto next = std::make_shared<ScopeMap>(*current);
+            next->erase(scopeName);
+            std::atomic_store(&m_scopes, std::shared_ptr<const ScopeMap> {std::move(next)});
+        }
+    }
 }
 
 bool KVDBHandlerInstance::emptyScopes()
 {
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
-
-    return m_scopeCounter.empty();
+    const auto scopes = std::atomic_load(&m_scopes);
+    return scopes->empty();
 }
 
 std::vector<std::string> KVDBHandlerInstance::getRefNames()
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    const auto scopes = std::atomic_load(&m_scopes);
+
+    std::vector<std::string> refNames;
+    refNames.reserve(scopes->size());
+
+    for (const auto& scope : *scopes)
+    {
+        refNames.push_back(scope.first);
+    }
 
-    return m_scopeCounter.getRefNames();
+    return refNames;
 }
 
 std::map<std::string, uint32_t> KVDBHandlerInstance::getRefMap()
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    const auto scopes = std::atomic_load(&m_scopes);
+
+    std::map<std::string, uint32_t> refMap;
+    for (const auto& [name, counter] : *scopes)
+    {
+        refMap.emplace(name, counter->load(std::memory_order_relaxed));
+    }
 
-    return m_scopeCounter.getRefMap();
+    return refMap;
 }
 
 } // namespace kvdbManager
@@ -3,10 +3,19 @@
 #include <fstream>
 #include <optional>
 
+#include <algorithm>
+
+#include "rocksdb/cache.h"
 #include "rocksdb/db.h"
+#include "rocksdb/filter_policy.h"
 #include "rocksdb/options.h"
+#include "rocksdb/rate_limiter.h"
+#include "rocksdb/sst_file_writer.h"
+#include "rocksdb/statistics.h"
+#include "rocksdb/table.h"
 
 #include <base/logging.hpp>
+#include <base/utils/rocksDBOptions.hpp>
 #include <kvdb/kvdbManager.hpp>
 #include <metrics/metricsManager.hpp>
 
@@ -18,6 +27,8 @@ KVDBManager::KVDBManager(const KVDBManagerOptions& options,
 {
     m_ManagerOptions = options;
     m_spMetricsScope = metricsManager->getMetricsScope("KVDB");
+    m_spCacheHitsCounter = m_spMetricsScope->getCounterUInteger("BlockCacheHits");
+    m_spCacheMissesCounter = m_spMetricsScope->getCounterUInteger("BlockCacheMisses");
     m_kvdbHandlerCollection = std::make_shared<KVDBHandlerCollection>();
 }
 
@@ -46,6 +57,40 @@ void KVDBManager::initializeOptions()
     m_rocksDBOptions.IncreaseParallelism();
     m_rocksDBOptions.OptimizeLevelStyleCompaction();
     m_rocksDBOptions.create_if_missing = true;
+
+    // Most lookups against IOC lists are misses, so keep a bloom filter per column family
+    // to answer the common negative path from memory without touching the SST data blocks.
+    // RocksDB maintains the filters on every write, so they never go stale.
+    rocksdb::BlockBasedTableOptions tableOptions;
+    tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10, false));
+    tableOptions.cache_index_and_filter_blocks = true;
+    tableOptions.pin_l0_filter_and_index_blocks_in_cache = true;
+
+    // The KVDBs join the process-wide block cache shared with the other embedded RocksDB
+    // stores; the configured size sets the global cap, so memory flows to whichever store
+    // is hot instead of being statically partitioned.
+    ::utils::rocksdb::RocksDBSharedResources::setBlockCacheCapacity(m_ManagerOptions.blockCacheSize);
+    m_blockCache = ::utils::rocksdb::RocksDBSharedResources::blockCache();
+    tableOptions.block_cache = m_blockCache;
+    m_rocksDBOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+
+    // Memtables also come out of the shared global budget.
+    m_rocksDBOptions.write_buffer_manager = ::utils::rocksdb::RocksDBSharedResources::writeBufferManager();
+
+    // Cap background I/O so flushes and compactions do not starve event processing.
+    if (m_ManagerOptions.compactionRateLimitBytesPerSec > 0)
+    {
+        m_rocksDBOptions.rate_limiter.reset(
+            rocksdb::NewGenericRateLimiter(m_ManagerOptions.compactionRateLimitBytesPerSec));
+    }
+
+    // Track cache effectiveness so hits and misses can be surfaced as metrics.
+    m_rocksDBOptions.statistics = rocksdb::CreateDBStatistics();
+
+    // Cover keys still in the memtable as well, the whole key filter needs a non-zero
+    // prefix bloom ratio to be enabled.
+    m_rocksDBOptions.memtable_prefix_bloom_size_ratio = 0.02;
+    m_rocksDBOptions.memtable_whole_key_filtering = true;
 }
 
 void KVDBManager::initializeMainDB()
@@ -72,7 +117,7 @@ void KVDBManager::initializeMainDB()
                 hasDefaultCF = true;
             }
 
-            auto newDescriptor = rocksdb::ColumnFamilyDescriptor(cfName, rocksdb::ColumnFamilyOptions());
+            auto newDescriptor = rocksdb::ColumnFamilyDescriptor(cfName, rocksdb::ColumnFamilyOptions(m_rocksDBOptions));
             cfDescriptors.push_back(newDescriptor);
         }
     }
@@ -80,7 +125,7 @@ void KVDBManager::initializeMainDB()
     if (!hasDefaultCF)
     {
         auto newDescriptor =
-            rocksdb::ColumnFamilyDescriptor(rocksdb::kDefaultColumnFamilyName, rocksdb::ColumnFamilyOptions());
+            rocksdb::ColumnFamilyDescriptor(rocksdb::kDefaultColumnFamilyName, rocksdb::ColumnFamilyOptions(m_rocksDBOptions));
         cfDescriptors.push_back(newDescriptor);
     }
 
@@ -107,6 +152,18 @@ void KVDBManager::initializeMainDB()
                 m_pDefaultCFHandle = createSharedCFHandle(cfHandles[cfDescriptorIndex]);
             }
         }
+
+        // Compact during ingestion idle windows instead of colliding with write peaks. The
+        // callback holds the DB weakly so a stale trigger after finalize is a no-op.
+        m_compactionHandle = ::utils::rocksdb::RocksDBCompactionScheduler::instance().registerStore(
+            m_ManagerOptions.dbName,
+            [weakDb = std::weak_ptr<rocksdb::DB>(m_pRocksDB)]()
+            {
+                if (auto db = weakDb.lock())
+                {
+                    db->CompactRange(rocksdb::CompactRangeOptions(), nullptr, nullptr);
+                }
+            });
     }
     else
     {
@@ -117,6 +174,7 @@ void KVDBManager::initializeMainDB()
 
 void KVDBManager::finalizeMainDB()
 {
+    m_compactionHandle.reset();
     m_mapCFHandles.clear();
     m_pDefaultCFHandle.reset();
     m_pRocksDB.reset();
@@ -138,11 +196,31 @@ base::RespOrError<std::shared_ptr<IKVDBHandler>> KVDBManager::getKVDBHandler(con
 
     m_kvdbHandlerCollection->addKVDBHandler(dbName, scopeName);
 
-    auto kvdbHandler = std::make_shared<KVDBHandler>(m_pRocksDB, cfHandle, m_kvdbHandlerCollection, dbName, scopeName);
+    auto kvdbHandler = std::make_shared<KVDBHandler>(
+        m_pRocksDB, cfHandle, m_kvdbHandlerCollection, dbName, scopeName, m_compactionHandle);
+
+    updateCacheMetrics();
 
     return kvdbHandler;
 }
 
+void KVDBManager::updateCacheMetrics()
+{
+    if (!m_rocksDBOptions.statistics)
+    {
+        return;
+    }
+
+    const auto hits = m_rocksDBOptions.statistics->getTickerCount(rocksdb::BLOCK_CACHE_HIT);
+    const auto misses = m_rocksDBOptions.statistics->getTickerCount(rocksdb::BLOCK_CACHE_MISS);
+
+    m_spCacheHitsCounter->addValue(hits - m_lastCacheHits);
+    m_spCacheMissesCounter->addValue(misses - m_lastCacheMisses);
+
+    m_lastCacheHits = hits;
+    m_lastCacheMisses = misses;
+}
+
 std::vector<std::string> KVDBManager::listDBs(const bool loaded)
 {
     std::vector<std::string> spaces;
@@ -212,6 +290,14 @@ base::OptError KVDBManager::loadDBFromJson(const std::string& name, const json::
 
     entries = content.getObject().value();
 
+    // Large lists are bulk loaded through an SST file ingested atomically, which avoids
+    // row-at-a-time write amplification and compaction stalls. Small lists keep the plain
+    // write path, an extra L0 file per tiny DB is not worth it.
+    if (entries.size() >= BULK_LOAD_MIN_ENTRIES)
+    {
+        return ingestDBFromEntries(name, cfHandle, entries);
+    }
+
     for (const auto& [key, value] : entries)
     {
         const auto status = m_pRocksDB->Put(rocksdb::WriteOptions(), cfHandle.get(), key, value.str());
@@ -225,6 +311,65 @@ base::OptError KVDBManager::loadDBFromJson(const std::string& name, const json::
     return std::nullopt;
 }
 
+base::OptError KVDBManager::ingestDBFromEntries(const std::string& name,
+                                                const std::shared_ptr<rocksdb::ColumnFamilyHandle>& cfHandle,
+                                                std::vector<std::tuple<std::string, json::Json>>& entries)
+{
+    // SstFileWriter requires strictly ascending keys, keep the last occurrence of
+    // duplicated keys to match the semantics of the sequential write path.
+    std::stable_sort(entries.begin(),
+                     entries.end(),
+                     [](const auto& lhs, const auto& rhs) { return std::get<0>(lhs) < std::get<0>(rhs); });
+
+    const auto sstPath =
+        std::filesystem::path(m_ManagerOptions.dbStoragePath) / fmt::format("{}_bulkload.sst", name);
+
+    rocksdb::SstFileWriter sstWriter(rocksdb::EnvOptions(), m_rocksDBOptions, cfHandle.get());
+    auto status = sstWriter.Open(sstPath.string());
+    if (!status.ok())
+    {
+        return base::Error {fmt::format("Could not create SST file '{}': {}", sstPath.string(), status.ToString())};
+    }
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        // Skip all but the last occurrence of a duplicated key
+        if (i + 1 < entries.size() && std::get<0>(entries[i]) == std::get<0>(entries[i + 1]))
+        {
+            continue;
+        }
+
+        const auto& [key, value] = entries[i];
+        status = sstWriter.Put(key, value.str());
+        if (!status.ok())
+        {
+            std::filesystem::remove(sstPath);
+            return base::Error {fmt::format(
+                "An error occurred while inserting data key {}, value {}: {}", key, value.str(), status.ToString())};
+        }
+    }
+
+    status = sstWriter.Finish();
+    if (!status.ok())
+    {
+        std::filesystem::remove(sstPath);
+        return base::Error {fmt::format("Could not finish SST file '{}': {}", sstPath.string(), status.ToString())};
+    }
+
+    rocksdb::IngestExternalFileOptions ingestOptions;
+    ingestOptions.move_files = true;
+    status = m_pRocksDB->IngestExternalFile(cfHandle.get(), {sstPath.string()}, ingestOptions);
+
+    // The file is moved into the DB on success, clean up only on failure
+    if (!status.ok())
+    {
+        std::filesystem::remove(sstPath);
+        return base::Error {fmt::format("Could not ingest SST file '{}': {}", sstPath.string(), status.ToString())};
+    }
+
+    return std::nullopt;
+}
+
 base::OptError KVDBManager::createDB(const std::string& name, const std::string& path)
 {
     auto result = getContentFromJsonFile(path);
@@ -344,7 +489,7 @@ uint32_t KVDBManager::getKVDBHandlersCount(const std::string& dbName) const
 base::OptError KVDBManager::createColumnFamily(const std::string& name)
 {
     rocksdb::ColumnFamilyHandle* cfHandle {nullptr};
-    rocksdb::Status s {m_pRocksDB->CreateColumnFamily(rocksdb::ColumnFamilyOptions(), name, &cfHandle)};
+    rocksdb::Status s {m_pRocksDB->CreateColumnFamily(rocksdb::ColumnFamilyOptions(m_rocksDBOptions), name, &cfHandle)};
 
     if (s.ok())
     {
@@ -52,6 +52,17 @@ inline base::RespOrError<std::string> kvdbGetError(const std::string& error)
     return base::Error {error};
 }
 
+inline base::RespOrError<std::list<std::pair<std::string, std::string>>>
+kvdbMultiGetOk(const std::list<std::pair<std::string, std::string>>& result)
+{
+    return result;
+}
+
+inline base::RespOrError<std::list<std::pair<std::string, std::string>>> kvdbMultiGetError(const std::string& error)
+{
+    return base::Error {error};
+}
+
 inline base::RespOrError<std::list<std::pair<std::string, std::string>>> kvdbDumpOk()
 {
     return std::list<std::pair<std::string, std::string>>();
@@ -69,11 +80,19 @@ public:
     MOCK_METHOD((base::OptError), remove, (const std::string& key), (override));
     MOCK_METHOD((base::RespOrError<bool>), contains, (const std::string& key), (override));
     MOCK_METHOD((base::RespOrError<std::string>), get, (const std::string& key), (override));
+    MOCK_METHOD((base::RespOrError<std::list<std::pair<std::string, std::string>>>),
+                multiGet,
+                (const std::vector<std::string>& keys),
+                (override));
     MOCK_METHOD((base::RespOrError<std::list<std::pair<std::string, std::string>>>),
                 dump,
                 (const unsigned int page, const unsigned int records),
                 (override));
     MOCK_METHOD((base::RespOrError<std::list<std::pair<std::string, std::string>>>), dump, (), ());
+    MOCK_METHOD((base::OptError),
+                dump,
+                (const unsigned int page, const unsigned int records, const DumpVisitor& visitor),
+                (override));
     MOCK_METHOD((base::RespOrError<std::list<std::pair<std::string, std::string>>>),
                 search,
                 (const std::string& prefix, const unsigned int page, const unsigned int records),
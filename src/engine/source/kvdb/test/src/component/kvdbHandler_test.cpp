@@ -240,6 +240,59 @@ TEST_F(KVDBHandlerTest, GetKeyWithoutValue)
     ASSERT_EQ(std::get<std::string>(resultGet), "");
 }
 
+TEST_F(KVDBHandlerTest, MultiGetKeysWithValues)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("MultiGetKeysWithValues"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("MultiGetKeysWithValues", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    ASSERT_TRUE(handler->set("key1", "value1") == std::nullopt);
+    ASSERT_TRUE(handler->set("key2", "value2") == std::nullopt);
+
+    auto resultMultiGet = handler->multiGet({"key1", "key2"});
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultMultiGet));
+    const auto& content = std::get<std::list<std::pair<std::string, std::string>>>(resultMultiGet);
+    ASSERT_EQ(content.size(), 2);
+    ASSERT_EQ(content.front().first, "key1");
+    ASSERT_EQ(content.front().second, "value1");
+    ASSERT_EQ(content.back().first, "key2");
+    ASSERT_EQ(content.back().second, "value2");
+}
+
+TEST_F(KVDBHandlerTest, MultiGetOmitsMissingKeys)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("MultiGetOmitsMissingKeys"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("MultiGetOmitsMissingKeys", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    ASSERT_TRUE(handler->set("key1", "value1") == std::nullopt);
+
+    auto resultMultiGet = handler->multiGet({"unknow_key", "key1"});
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultMultiGet));
+    const auto& content = std::get<std::list<std::pair<std::string, std::string>>>(resultMultiGet);
+    ASSERT_EQ(content.size(), 1);
+    ASSERT_EQ(content.front().first, "key1");
+    ASSERT_EQ(content.front().second, "value1");
+}
+
+TEST_F(KVDBHandlerTest, MultiGetEmptyKeys)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("MultiGetEmptyKeys"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("MultiGetEmptyKeys", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+    auto resultMultiGet = handler->multiGet({});
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultMultiGet));
+    ASSERT_TRUE(std::get<std::list<std::pair<std::string, std::string>>>(resultMultiGet).empty());
+}
+
 TEST_F(KVDBHandlerTest, DumpOkValidateOrder)
 {
     ASSERT_FALSE(m_kvdbManager->createDB("DumpOkValidateOrder"));
@@ -292,6 +345,60 @@ TEST_F(KVDBHandlerTest, DumpWihoutKeys)
     ASSERT_EQ(result.size(), 0);
 }
 
+TEST_F(KVDBHandlerTest, DumpVisitorStreamsEntries)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("DumpVisitorStreamsEntries"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("DumpVisitorStreamsEntries", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+    for (auto i = 1; i <= 5; i++)
+    {
+        auto result = handler->set(fmt::format("key{0}", i), fmt::format("value{0}", i));
+        ASSERT_EQ(result, std::nullopt);
+    }
+
+    std::list<std::pair<std::string, std::string>> visited;
+    const auto error = handler->dump(1,
+                                     10,
+                                     [&visited](std::string_view key, std::string_view value)
+                                     {
+                                         visited.emplace_back(std::string {key}, std::string {value});
+                                         return true;
+                                     });
+    ASSERT_FALSE(base::isError(error));
+
+    // Same entries, same order as the materialized dump
+    const auto resultDump = handler->dump(1, 10);
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultDump));
+    ASSERT_EQ(visited, std::get<std::list<std::pair<std::string, std::string>>>(resultDump));
+}
+
+TEST_F(KVDBHandlerTest, DumpVisitorStopsWhenVisitorReturnsFalse)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("DumpVisitorStops"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("DumpVisitorStops", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+    for (auto i = 1; i <= 5; i++)
+    {
+        auto result = handler->set(fmt::format("key{0}", i), fmt::format("value{0}", i));
+        ASSERT_EQ(result, std::nullopt);
+    }
+
+    auto visited = 0;
+    const auto error = handler->dump(1,
+                                     10,
+                                     [&visited](std::string_view, std::string_view)
+                                     {
+                                         ++visited;
+                                         return visited < 2;
+                                     });
+    ASSERT_FALSE(base::isError(error));
+    ASSERT_EQ(visited, 2);
+}
+
 TEST_P(DumpWithMultiplePages, Dump)
 {
     auto [inserts, page, records, expected] = GetParam();
@@ -5,6 +5,8 @@
 #include <thread>
 #include <unistd.h>
 
+#include <fmt/format.h>
+
 #include "fakeMetric.hpp"
 #include <base/json.hpp>
 #include <base/logging.hpp>
@@ -100,6 +102,33 @@ TEST_F(KVDBManagerTest, InitializeDBInUseWithOtherManager)
     ASSERT_THROW(kvdbManager->initialize(), std::runtime_error);
 }
 
+TEST_F(KVDBManagerTest, LoadDBFromJsonBulkIngestion)
+{
+    ASSERT_EQ(m_kvdbManager->createDB("LoadDBFromJsonBulkIngestion"), std::nullopt);
+
+    // Cross the bulk-load threshold so the SST ingestion path is exercised
+    json::Json content;
+    content.setObject();
+    for (size_t i = 0; i < kvdbManager::BULK_LOAD_MIN_ENTRIES + 1; i++)
+    {
+        content.setString(fmt::format("value{}", i), fmt::format("/key{}", i));
+    }
+
+    ASSERT_EQ(m_kvdbManager->loadDBFromJson("LoadDBFromJsonBulkIngestion", content), std::nullopt);
+
+    auto resultHandler = m_kvdbManager->getKVDBHandler("LoadDBFromJsonBulkIngestion", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+    auto resultGet = handler->get("key0");
+    ASSERT_TRUE(std::holds_alternative<std::string>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), R"("value0")");
+
+    resultGet = handler->get(fmt::format("key{}", kvdbManager::BULK_LOAD_MIN_ENTRIES));
+    ASSERT_TRUE(std::holds_alternative<std::string>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), fmt::format(R"("value{}")", kvdbManager::BULK_LOAD_MIN_ENTRIES));
+}
+
 TEST_F(KVDBManagerTest, DeleteDB)
 {
     // Create a DB
@@ -5,6 +5,7 @@
 #include <memory>
 #include <stack>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -44,6 +45,7 @@ public:
     ExpressionType m_type;
     FunctionType m_function;
     std::shared_ptr<ThisType> m_left, m_right;
+    int m_cost {0}; ///< Relative evaluation cost of a term, used by reorderByCost
 
     /**
      * @brief Get the Ptr object
@@ -211,6 +213,100 @@ typename Expression<Event>::FunctionType getDijstraEvaluator(const std::shared_p
     };
 }
 
+/**
+ * @brief Reorder commutative operands of a logic expression tree by cost
+ *
+ * The cost of a term is its m_cost, the cost of NOT is the cost of its operand
+ * and the cost of AND and OR is the sum of both operands. Operands of AND and
+ * OR are swapped so that the cheaper subtree is the left one, which a
+ * short-circuit evaluator runs first. Only valid when term functions are free
+ * of side effects, as it changes the evaluation order chosen by the author.
+ *
+ * @tparam Event
+ * @param expression root expression, reordered in place
+ * @return int Cost of the whole subtree
+ */
+template<typename Event>
+int reorderByCost(const std::shared_ptr<Expression<Event>>& expression)
+{
+    if (!expression)
+    {
+        return 0;
+    }
+
+    switch (expression->m_type)
+    {
+        case ExpressionType::TERM: return expression->m_cost;
+        case ExpressionType::NOT: return reorderByCost<Event>(expression->m_left);
+        case ExpressionType::AND:
+        case ExpressionType::OR:
+        {
+            auto leftCost = reorderByCost<Event>(expression->m_left);
+            auto rightCost = reorderByCost<Event>(expression->m_right);
+            if (rightCost < leftCost)
+            {
+                std::swap(expression->m_left, expression->m_right);
+            }
+            return leftCost + rightCost;
+        }
+        default: throw std::runtime_error("Engine logic expression evaluator got unknown operator type.");
+    }
+}
+
+/**
+ * @brief Get a short-circuit evaluator function from a logic expression tree
+ *
+ * Unlike the Dijstra evaluator, which runs every term before combining the
+ * results, operands of AND and OR are evaluated lazily: the right subtree is
+ * skipped whenever the left one already decides the result. Both evaluators
+ * are equivalent only when term functions are free of side effects.
+ *
+ * @tparam Event
+ * @param expression root expression
+ * @return Expression<Event>::FunctionType
+ */
+template<typename Event>
+typename Expression<Event>::FunctionType
+getShortCircuitEvaluator(const std::shared_ptr<const Expression<Event>>& expression)
+{
+    if (!expression)
+    {
+        throw std::runtime_error("Engine logic expression evaluator got empty expression.");
+    }
+
+    switch (expression->m_type)
+    {
+        case ExpressionType::TERM: return expression->m_function;
+        case ExpressionType::NOT:
+        {
+            auto operand = getShortCircuitEvaluator<Event>(expression->m_left);
+            return [operand](Event event) -> bool
+            {
+                return !operand(event);
+            };
+        }
+        case ExpressionType::AND:
+        {
+            auto left = getShortCircuitEvaluator<Event>(expression->m_left);
+            auto right = getShortCircuitEvaluator<Event>(expression->m_right);
+            return [left, right](Event event) -> bool
+            {
+                return left(event) && right(event);
+            };
+        }
+        case ExpressionType::OR:
+        {
+            auto left = getShortCircuitEvaluator<Event>(expression->m_left);
+            auto right = getShortCircuitEvaluator<Event>(expression->m_right);
+            return [left, right](Event event) -> bool
+            {
+                return left(event) || right(event);
+            };
+        }
+        default: throw std::runtime_error("Engine logic expression evaluator got unknown operator type.");
+    }
+}
+
 } // namespace logicexpr::evaluator
 
 #endif // _LOGICEXPR_EVALUATOR_H
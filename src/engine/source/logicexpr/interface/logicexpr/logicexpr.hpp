@@ -82,6 +82,85 @@ buildDijstraEvaluator(const std::string& expression, TermBuilder&& termBuilder,
     return evaluatorFunction;
 }
 
+/**
+ * @brief Generate a cost-ordered, short-circuit evaluation function from a string
+ * logic expression.
+ *
+ * Same contract as buildDijstraEvaluator, with an additional term cost function
+ * used to reorder commutative AND/OR operands so cheap terms run first, and a
+ * short-circuit evaluator so expensive terms are skipped whenever a cheap one
+ * already decides the result. Use only when term functions are free of side
+ * effects; when the evaluation order of a chain is semantically relevant use
+ * buildDijstraEvaluator, which preserves authoring order.
+ *
+ * @tparam Event Type of the event to be evaluated.
+ * @param expression String logic expression.
+ * @param termBuilder Builder to generate the term's evaluation function from
+ * its description.
+ * @param termParser Parser to parse the term's of the expression.
+ * @param termCost Function returning the relative evaluation cost of a term
+ * from its description.
+ * @return std::function<bool(Event)> Evaluation function.
+ */
+template<typename Event, typename TermType, typename TermBuilder, typename TermParser, typename TermCost>
+std::function<bool(Event)> buildCostOrderedEvaluator(const std::string& expression,
+                                                     TermBuilder&& termBuilder,
+                                                     TermParser&& termParser,
+                                                     TermCost&& termCost)
+{
+
+    // visitor to generate an evaluator::Expression tree from a
+    // parser::Expression tree, a term builder function and a term cost function.
+    auto visit = [termBuilder, termCost](const std::shared_ptr<const parser::Expression>& tokenExpr,
+                                         auto& visitRef) -> std::shared_ptr<evaluator::Expression<Event>>
+    {
+        auto builtExpr = evaluator::Expression<Event>::create();
+
+        if (tokenExpr->m_token->isTerm())
+        {
+            auto termToken = tokenExpr->m_token->getPtr<parser::TermToken<TermType>>();
+            builtExpr->m_type = evaluator::ExpressionType::TERM;
+            builtExpr->m_cost = termCost(termToken->buildToken());
+            builtExpr->m_function = termBuilder(termToken->buildToken());
+            return builtExpr;
+        }
+
+        if (tokenExpr->m_token->isNot())
+        {
+            builtExpr->m_type = evaluator::ExpressionType::NOT;
+            builtExpr->m_left = visitRef(tokenExpr->m_left, visitRef);
+            return builtExpr;
+        }
+
+        if (tokenExpr->m_token->isOr())
+        {
+            builtExpr->m_type = evaluator::ExpressionType::OR;
+            builtExpr->m_left = visitRef(tokenExpr->m_left, visitRef);
+            builtExpr->m_right = visitRef(tokenExpr->m_right, visitRef);
+            return builtExpr;
+        }
+
+        if (tokenExpr->m_token->isAnd())
+        {
+            builtExpr->m_type = evaluator::ExpressionType::AND;
+            builtExpr->m_left = visitRef(tokenExpr->m_left, visitRef);
+            builtExpr->m_right = visitRef(tokenExpr->m_right, visitRef);
+            return builtExpr;
+        }
+
+        throw std::runtime_error(
+            fmt::format("Engine logic expression: Unexpected token type of token '{}'", tokenExpr->m_token->text()));
+    };
+
+    // Parse, build, reorder and return the evaluator function.
+    auto tokenExpression = parser::parse(expression, std::forward<TermParser>(termParser));
+    auto builtExprPtr = visit(tokenExpression, visit);
+    evaluator::reorderByCost<Event>(builtExprPtr);
+    auto evaluatorFunction = evaluator::getShortCircuitEvaluator<Event>(builtExprPtr);
+
+    return evaluatorFunction;
+}
+
 } // namespace logicexpr
 
 #endif // _LOGIC_EXPRESSION_H
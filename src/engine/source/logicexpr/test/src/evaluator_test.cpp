@@ -88,6 +88,82 @@ TEST(LogicExpressionEvaluator, getDijstraEvaluatorNotTerm)
     EXPECT_TRUE(evaluator(7));
 }
 
+TEST(LogicExpressionEvaluator, reorderByCost)
+{
+    // (expensive AND cheap) OR mid -> mid OR (cheap AND expensive)
+    auto root = Expression<int>::create(ExpressionType::OR);
+    root->m_left = Expression<int>::create(ExpressionType::AND);
+    root->m_left->m_left = Expression<int>::create([](int i) { return i > 5; });
+    root->m_left->m_left->m_cost = 100;
+    root->m_left->m_right = Expression<int>::create([](int i) { return i % 2 == 0; });
+    root->m_left->m_right->m_cost = 1;
+    root->m_right = Expression<int>::create([](int i) { return i > 1; });
+    root->m_right->m_cost = 10;
+
+    auto expensive = root->m_left->m_left;
+    auto cheap = root->m_left->m_right;
+    auto andExpr = root->m_left;
+    auto mid = root->m_right;
+
+    int cost {};
+    ASSERT_NO_THROW(cost = reorderByCost<int>(root));
+    EXPECT_EQ(cost, 111);
+
+    // AND children swapped, cheap first
+    EXPECT_TRUE(andExpr->m_left == cheap);
+    EXPECT_TRUE(andExpr->m_right == expensive);
+
+    // OR children swapped, the AND subtree costs 101 so the mid term moves left
+    EXPECT_TRUE(root->m_left == mid);
+    EXPECT_TRUE(root->m_right == andExpr);
+}
+
+TEST(LogicExpressionEvaluator, getShortCircuitEvaluator)
+{
+    // Same truth table as getDijstraEvaluator
+    // True if: (pair or odd and not i>5) and i>1
+    auto root = Expression<int>::create(ExpressionType::AND);
+    root->m_left = Expression<int>::create([](int i) { return i > 1; });
+    root->m_right = Expression<int>::create(ExpressionType::OR);
+    root->m_right->m_left = Expression<int>::create([](int i) { return i % 2 == 0; });
+    root->m_right->m_right = Expression<int>::create(ExpressionType::NOT);
+    root->m_right->m_right->m_left = Expression<int>::create([](int i) { return i > 5; });
+
+    std::function<bool(int)> evaluator;
+    ASSERT_NO_THROW(evaluator = getShortCircuitEvaluator<int>(root));
+
+    EXPECT_FALSE(evaluator(0));
+    EXPECT_FALSE(evaluator(1));
+    EXPECT_TRUE(evaluator(2));
+    EXPECT_TRUE(evaluator(3));
+    EXPECT_TRUE(evaluator(4));
+    EXPECT_TRUE(evaluator(5));
+    EXPECT_TRUE(evaluator(6));
+    EXPECT_FALSE(evaluator(7));
+}
+
+TEST(LogicExpressionEvaluator, getShortCircuitEvaluatorSkipsRight)
+{
+    // The right operand must not run when the left one decides the result
+    int calls {0};
+    auto root = Expression<int>::create(ExpressionType::AND);
+    root->m_left = Expression<int>::create([](int i) { return i > 1; });
+    root->m_right = Expression<int>::create(
+        [&calls](int)
+        {
+            ++calls;
+            return true;
+        });
+
+    std::function<bool(int)> evaluator;
+    ASSERT_NO_THROW(evaluator = getShortCircuitEvaluator<int>(root));
+
+    EXPECT_FALSE(evaluator(0));
+    EXPECT_EQ(calls, 0);
+    EXPECT_TRUE(evaluator(2));
+    EXPECT_EQ(calls, 1);
+}
+
 TEST(LogicExpressionEvaluator, getDijstraEvaluatorSingleTerm)
 {
     // True if: not pair
@@ -0,0 +1,99 @@
+#ifndef _LOGPAR_ADAPTIVECHOICE_HPP
+#define _LOGPAR_ADAPTIVECHOICE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <hlp/parser.hpp>
+
+namespace hlp::logpar::combinator
+{
+
+/**
+ * @brief Choice over parser alternatives tried in an order that adapts to observed hit rate.
+ *
+ * Alternatives start in declaration order. Each successful match bumps a per-alternative hit
+ * counter and, once per reorder period, the try order is resorted by accumulated hits so the
+ * alternatives that dominate the traffic are attempted first. The sort is stable over the
+ * declaration order, so alternatives with equal hit counts keep their declared precedence.
+ *
+ * The try order is published as an immutable snapshot read lock-free on the hot path; counter
+ * updates are relaxed atomics and only the periodic reorder takes a lock.
+ *
+ * @param parsers Alternatives in declaration order, at least one.
+ * @return hlp::parser::Parser
+ */
+inline parser::Parser adaptiveChoice(std::vector<parser::Parser> parsers)
+{
+    constexpr uint64_t REORDER_PERIOD = 1024;
+
+    struct State
+    {
+        std::vector<std::atomic<uint64_t>> hits;
+        std::atomic<uint64_t> sinceReorder {0};
+        std::shared_ptr<const std::vector<size_t>> order;
+        std::mutex reorderMutex;
+
+        explicit State(size_t size)
+            : hits(size)
+        {
+            for (auto& hit : hits)
+            {
+                hit.store(0, std::memory_order_relaxed);
+            }
+            auto initial = std::make_shared<std::vector<size_t>>(size);
+            std::iota(initial->begin(), initial->end(), 0);
+            order = std::move(initial);
+        }
+    };
+
+    if (parsers.empty())
+    {
+        throw std::runtime_error("adaptiveChoice needs at least one alternative");
+    }
+
+    auto state = std::make_shared<State>(parsers.size());
+
+    return [parsers = std::move(parsers), state](std::string_view input) -> parser::Result
+    {
+        const auto order = std::atomic_load(&state->order);
+        for (const auto idx : *order)
+        {
+            auto result = parsers[idx](input);
+            if (result.success())
+            {
+                state->hits[idx].fetch_add(1, std::memory_order_relaxed);
+                if (state->sinceReorder.fetch_add(1, std::memory_order_relaxed) + 1 >= REORDER_PERIOD)
+                {
+                    std::lock_guard lock {state->reorderMutex};
+                    state->sinceReorder.store(0, std::memory_order_relaxed);
+
+                    // Resort from declaration order so ties keep their declared precedence
+                    auto next = std::make_shared<std::vector<size_t>>(parsers.size());
+                    std::iota(next->begin(), next->end(), 0);
+                    std::stable_sort(next->begin(),
+                                     next->end(),
+                                     [&state](size_t lhs, size_t rhs) {
+                                         return state->hits[lhs].load(std::memory_order_relaxed)
+                                                > state->hits[rhs].load(std::memory_order_relaxed);
+                                     });
+                    std::atomic_store(&state->order,
+                                      std::shared_ptr<const std::vector<size_t>> {std::move(next)});
+                }
+                return result;
+            }
+        }
+
+        return abs::makeFailure<parser::ResultT>(input, "choice: all alternatives failed");
+    };
+}
+
+} // namespace hlp::logpar::combinator
+
+#endif // _LOGPAR_ADAPTIVECHOICE_HPP
@@ -0,0 +1,97 @@
+#ifndef _LOGPAR_LITERALDISPATCHER_HPP
+#define _LOGPAR_LITERALDISPATCHER_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace hlp::logpar
+{
+
+/**
+ * @brief Prefix trie over the leading literal anchors of a set of logpar expressions.
+ *
+ * When several logpar expressions are tried against the same input, most of them fail
+ * after parsing their leading literal. The dispatcher indexes those literals in a trie
+ * so the candidate expressions for a given input can be obtained by a single walk over
+ * the input prefix, instead of running every alternative until it fails.
+ *
+ * Expressions without a leading literal (those starting with a field, a choice or an
+ * optional group) cannot be discriminated by prefix and are candidates for every input.
+ *
+ * Once built, lookups are read-only and thread-safe.
+ */
+class LiteralDispatcher
+{
+private:
+    /**
+     * @brief Trie node, children are indexes into m_nodes.
+     *
+     */
+    struct Node
+    {
+        std::vector<std::pair<char, std::size_t>> children; ///< Edges by character
+        std::vector<std::size_t> terminals;                 ///< Alternatives whose anchor ends at this node
+    };
+
+    std::vector<Node> m_nodes;               ///< Trie nodes, root at index 0
+    std::vector<std::size_t> m_unanchored;   ///< Alternatives without a leading literal
+    std::vector<std::string> m_anchors;      ///< Anchor of each alternative, empty if unanchored
+    std::size_t m_size;                      ///< Number of registered alternatives
+
+    // Get the child of a node for the given character, nullopt if not present
+    std::optional<std::size_t> child(std::size_t node, char c) const;
+
+public:
+    LiteralDispatcher()
+        : m_nodes(1)
+        , m_size(0)
+    {
+    }
+
+    /**
+     * @brief Register an alternative with its leading literal anchor.
+     *
+     * @param anchor the leading literal of the expression, nullopt if the expression
+     * does not start with a literal
+     * @return std::size_t the index assigned to the alternative, in registration order
+     */
+    std::size_t add(const std::optional<std::string>& anchor);
+
+    /**
+     * @brief Get the alternatives whose anchor is a prefix of the input.
+     *
+     * Walks the trie along the input once, so the cost is bounded by the longest anchor
+     * rather than by the number of alternatives. Unanchored alternatives are always
+     * included.
+     *
+     * @param input the input to dispatch
+     * @return std::vector<std::size_t> candidate indexes in registration order
+     */
+    std::vector<std::size_t> candidates(std::string_view input) const;
+
+    /**
+     * @brief Check if a single alternative is a candidate for the input.
+     *
+     * Intended for callers that evaluate alternatives independently and cannot share
+     * the result of a candidates() walk. The check is bounded by the anchor length.
+     *
+     * @param index the alternative index returned by add
+     * @param input the input to dispatch
+     * @return true if the alternative may match the input
+     */
+    bool isCandidate(std::size_t index, std::string_view input) const;
+
+    /**
+     * @brief Get the number of registered alternatives.
+     *
+     * @return std::size_t
+     */
+    std::size_t size() const { return m_size; }
+};
+
+} // namespace hlp::logpar
+
+#endif // _LOGPAR_LITERALDISPATCHER_HPP
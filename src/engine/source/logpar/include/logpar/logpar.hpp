@@ -3,6 +3,7 @@
 
 #include <list>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -430,6 +431,18 @@ public:
      * @throws std::runtime_error if errors occur while building the parser
      */
     Hlp build(std::string_view logpar) const;
+
+    /**
+     * @brief Get the leading literal of the given logpar expression
+     *
+     * The leading literal is the anchor used to dispatch between alternative
+     * expressions, see LiteralDispatcher.
+     *
+     * @param logpar the logpar expression
+     * @return std::optional<std::string> the leading literal, nullopt if the expression
+     * does not start with a literal or cannot be parsed
+     */
+    static std::optional<std::string> extractLeadingLiteral(std::string_view logpar);
 };
 } // namespace logpar
 } // namespace hlp
@@ -0,0 +1,87 @@
+#include "literalDispatcher.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace hlp::logpar
+{
+
+std::optional<std::size_t> LiteralDispatcher::child(std::size_t node, char c) const
+{
+    for (const auto& [edge, next] : m_nodes[node].children)
+    {
+        if (edge == c)
+        {
+            return next;
+        }
+    }
+
+    return std::nullopt;
+}
+
+std::size_t LiteralDispatcher::add(const std::optional<std::string>& anchor)
+{
+    const auto index = m_size++;
+
+    if (!anchor || anchor.value().empty())
+    {
+        m_unanchored.emplace_back(index);
+        m_anchors.emplace_back();
+        return index;
+    }
+
+    std::size_t node = 0;
+    for (const auto c : anchor.value())
+    {
+        auto next = child(node, c);
+        if (!next)
+        {
+            m_nodes.emplace_back();
+            next = m_nodes.size() - 1;
+            m_nodes[node].children.emplace_back(c, next.value());
+        }
+        node = next.value();
+    }
+    m_nodes[node].terminals.emplace_back(index);
+    m_anchors.emplace_back(anchor.value());
+
+    return index;
+}
+
+std::vector<std::size_t> LiteralDispatcher::candidates(std::string_view input) const
+{
+    auto found = m_unanchored;
+
+    std::size_t node = 0;
+    for (const auto c : input)
+    {
+        auto next = child(node, c);
+        if (!next)
+        {
+            break;
+        }
+        node = next.value();
+
+        const auto& terminals = m_nodes[node].terminals;
+        found.insert(found.end(), terminals.begin(), terminals.end());
+    }
+
+    // Preserve registration order so the caller tries alternatives as declared
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+bool LiteralDispatcher::isCandidate(std::size_t index, std::string_view input) const
+{
+    if (index >= m_size)
+    {
+        throw std::runtime_error(fmt::format("Alternative index '{}' out of range", index));
+    }
+
+    const auto& anchor = m_anchors[index];
+    return input.substr(0, anchor.size()) == anchor;
+}
+
+} // namespace hlp::logpar
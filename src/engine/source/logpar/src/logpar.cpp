@@ -7,6 +7,8 @@
 
 #include <fmt/format.h>
 
+#include <logpar/adaptiveChoice.hpp>
+
 namespace hlp::logpar::parser
 {
 parsec::Parser<char> pChar(std::string chars)
@@ -442,7 +444,8 @@ Logpar::Hlp Logpar::buildChoiceParser(const parser::Choice& choice, const std::v
     auto p1 = buildFieldParser(choice.left, {});
     auto p2 = buildFieldParser(choice.right, endTokens);
 
-    return hlp::parser::combinator::choice(p1, p2);
+    // Declared alternatives are tried in hit-rate order so the dominant log shape matches first
+    return combinator::adaptiveChoice({p1, p2});
 }
 
 Logpar::Hlp Logpar::buildGroupOptParser(const parser::Group& group, size_t recurLvl) const
@@ -648,4 +651,21 @@ Logpar::Hlp Logpar::build(std::string_view logpar) const
     return hlp::parser::combinator::all({p, hlp::parsers::getEofParser({.name = "EOF"})});
 }
 
+std::optional<std::string> Logpar::extractLeadingLiteral(std::string_view logpar)
+{
+    auto result = parser::pLogpar()(logpar, 0);
+    if (result.failure())
+    {
+        return std::nullopt;
+    }
+
+    auto parserInfos = result.value();
+    if (parserInfos.empty() || !std::holds_alternative<parser::Literal>(parserInfos.front()))
+    {
+        return std::nullopt;
+    }
+
+    return std::get<parser::Literal>(parserInfos.front()).value;
+}
+
 } // namespace hlp::logpar
@@ -1,11 +1,16 @@
 #include "logpar_test.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
+#include <vector>
 
 #include <fmt/format.h>
 
+#include <logpar/adaptiveChoice.hpp>
+#include <logpar/literalDispatcher.hpp>
 #include <schemf/mockSchema.hpp>
 
 using namespace hlp;
@@ -433,3 +438,119 @@ INSTANTIATE_TEST_SUITE_P(
                        logp::Literal {":"},
                        logp::Field {logp::FieldName {"~"}, {}, false}},
                       40)));
+
+using LeadingLiteralT = std::tuple<std::string, std::optional<std::string>>;
+class LogparLeadingLiteralTest : public ::testing::TestWithParam<LeadingLiteralT>
+{
+};
+
+TEST_P(LogparLeadingLiteralTest, Extracts)
+{
+    auto [expression, expected] = GetParam();
+    ASSERT_EQ(expected, logpar::Logpar::extractLeadingLiteral(expression));
+}
+
+INSTANTIATE_TEST_SUITE_P(Extracts,
+                         LogparLeadingLiteralTest,
+                         ::testing::Values(LeadingLiteralT("literal", "literal"),
+                                           LeadingLiteralT("lit<text>:<~a/long>", "lit"),
+                                           LeadingLiteralT("[date] <~host> <text>", "[date] "),
+                                           LeadingLiteralT(R"(lit\<eral<~>)", "lit<eral"),
+                                           LeadingLiteralT("<text>end", std::nullopt),
+                                           LeadingLiteralT("<choice1>?<choice2>lit", std::nullopt),
+                                           LeadingLiteralT("(?literal)after", std::nullopt),
+                                           LeadingLiteralT("", std::nullopt)));
+
+using DispatchT = std::tuple<std::vector<std::optional<std::string>>, std::string, std::vector<std::size_t>>;
+class LiteralDispatcherTest : public ::testing::TestWithParam<DispatchT>
+{
+};
+
+TEST_P(LiteralDispatcherTest, Candidates)
+{
+    auto [anchors, input, expected] = GetParam();
+
+    logpar::LiteralDispatcher dispatcher;
+    for (const auto& anchor : anchors)
+    {
+        dispatcher.add(anchor);
+    }
+
+    ASSERT_EQ(anchors.size(), dispatcher.size());
+    ASSERT_EQ(expected, dispatcher.candidates(input));
+
+    // isCandidate must agree with candidates for every alternative
+    for (std::size_t i = 0; i < dispatcher.size(); ++i)
+    {
+        auto isExpected = std::find(expected.begin(), expected.end(), i) != expected.end();
+        ASSERT_EQ(isExpected, dispatcher.isCandidate(i, input)) << fmt::format("alternative {}", i);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Candidates,
+    LiteralDispatcherTest,
+    ::testing::Values(DispatchT({"[date", "ERROR", std::nullopt}, "[date] host message", {0, 2}),
+                      DispatchT({"[date", "ERROR", std::nullopt}, "ERROR message", {1, 2}),
+                      DispatchT({"[date", "ERROR", std::nullopt}, "unanchored match", {2}),
+                      DispatchT({"[date", "ERROR"}, "no candidates", {}),
+                      DispatchT({"ab", "abc", "a"}, "abcd", {0, 1, 2}),
+                      DispatchT({"ab", "abc", "a"}, "abx", {0, 2}),
+                      DispatchT({"lit", "lit"}, "literal", {0, 1}),
+                      DispatchT({"lit", std::nullopt}, "", {1}),
+                      DispatchT({}, "anything", {})));
+
+TEST(LiteralDispatcher, OutOfRangeIndex)
+{
+    logpar::LiteralDispatcher dispatcher;
+    dispatcher.add(std::string {"lit"});
+
+    ASSERT_NO_THROW(dispatcher.isCandidate(0, "literal"));
+    ASSERT_THROW(dispatcher.isCandidate(1, "literal"), std::runtime_error);
+}
+
+TEST(AdaptiveChoice, ReordersTowardObservedHits)
+{
+    // Consumes two characters when the input starts with "ab"
+    hlp::parser::Parser twoChar = [](std::string_view input) -> hlp::parser::Result
+    {
+        if (input.substr(0, 2) == "ab")
+        {
+            return abs::makeSuccess<hlp::parser::ResultT>(input.substr(2));
+        }
+        return abs::makeFailure<hlp::parser::ResultT>(input, "twoChar");
+    };
+    // Consumes any single character
+    hlp::parser::Parser oneChar = [](std::string_view input) -> hlp::parser::Result
+    {
+        if (input.empty())
+        {
+            return abs::makeFailure<hlp::parser::ResultT>(input, "oneChar");
+        }
+        return abs::makeSuccess<hlp::parser::ResultT>(input.substr(1));
+    };
+
+    auto choice = logpar::combinator::adaptiveChoice({twoChar, oneChar});
+
+    // While tied, declaration order decides: the two-char alternative wins
+    auto result = choice("ab");
+    ASSERT_TRUE(result.success());
+    ASSERT_EQ(result.remaining().size(), 0);
+
+    // Train the one-char alternative past the reorder period
+    for (int i = 0; i < 2048; ++i)
+    {
+        auto trained = choice("xy");
+        ASSERT_TRUE(trained.success());
+    }
+
+    // The dominant alternative is now tried first
+    result = choice("ab");
+    ASSERT_TRUE(result.success());
+    ASSERT_EQ(result.remaining().size(), 1);
+}
+
+TEST(AdaptiveChoice, NoAlternativesThrows)
+{
+    ASSERT_THROW(logpar::combinator::adaptiveChoice({}), std::runtime_error);
+}
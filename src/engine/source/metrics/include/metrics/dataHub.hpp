@@ -1,8 +1,10 @@
 #ifndef _METRICS_DATAHUB_H
 #define _METRICS_DATAHUB_H
 
+#include <cstdint>
 #include <map>
 #include <mutex>
+#include <string_view>
 #include <variant>
 
 #include <base/json.hpp>
@@ -34,12 +36,54 @@ public:
      */
     json::Json getAllResources();
 
+    /**
+     * @brief Gets a json representation of the resources that changed since the previous delta scrape.
+     *
+     * @details Most resources are unchanged between consecutive scrapes, so the delta keeps the scrape
+     * payload proportional to the activity instead of the metrics tree size. Every
+     * FULL_SNAPSHOT_EVERY-th scrape (and the first one) returns the full tree, so a consumer that
+     * missed deltas converges without extra coordination.
+     *
+     * @return JSON object with the changed resources.
+     */
+    json::Json getDeltaResources();
+
+    /**
+     * @brief Serializes the delta resources, reusing an internal buffer across scrapes.
+     *
+     * @details Same semantics as getDeltaResources(), serialized into a buffer that keeps its
+     * allocation between scrapes.
+     *
+     * @return View over the serialized delta, valid until the next call.
+     */
+    std::string_view dumpDeltaResources();
+
 private:
     /**
      * @brief Map of strings to json objects containing resources
      */
     std::map<std::string, json::Json> m_resources;
 
+    /**
+     * @brief Per-resource version, bumped only when setResource stores a different value.
+     */
+    std::map<std::string, uint64_t> m_versions;
+
+    /**
+     * @brief Per-resource version included in the last delta scrape.
+     */
+    std::map<std::string, uint64_t> m_scrapedVersions;
+
+    /**
+     * @brief Number of delta scrapes served, used to schedule the periodic full snapshots.
+     */
+    uint64_t m_deltaScrapes {0};
+
+    /**
+     * @brief Serialization buffer reused across scrapes.
+     */
+    rapidjson::StringBuffer m_scrapeBuffer;
+
     /**
      * @brief Synchronization object
      *
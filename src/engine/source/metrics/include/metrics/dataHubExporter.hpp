@@ -8,6 +8,7 @@
 #include "opentelemetry/version.h"
 #include <base/json.hpp>
 #include <iostream>
+#include <map>
 #include <string>
 
 #include <metrics/iDataHub.hpp>
@@ -76,6 +77,13 @@ private:
      */
     std::shared_ptr<metricsManager::IDataHub> m_dataHub;
 
+    /**
+     * @brief Per-scope fingerprint of the last exported payload, without the per-scrape timestamps.
+     * Used to skip hub updates when only the timestamps changed, so the per-resource versions in
+     * DataHub only advance on real changes and the delta scrapes stay small.
+     */
+    std::map<std::string, json::Json> m_lastFingerprint;
+
     /**
      * @brief Control variable to flag shutdown cycle.
      */
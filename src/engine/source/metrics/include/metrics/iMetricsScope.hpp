@@ -1,6 +1,10 @@
 #ifndef _I_METRICS_SCOPE_H
 #define _I_METRICS_SCOPE_H
 
+#include <functional>
+
+#include <base/json.hpp>
+
 #include <metrics/iMetricsInstruments.hpp>
 
 namespace metricsManager
@@ -25,6 +29,34 @@ public:
      */
     virtual std::shared_ptr<iCounter<uint64_t>> getCounterUInteger(const std::string& name) = 0;
 
+    /**
+     * @brief Gets a double counter backed by per-thread slots, aggregated on scrape.
+     *
+     * Defaults to the shared counter so implementations without a thread-local
+     * recording mode keep working.
+     *
+     * @param name The name of the counter.
+     * @return A shared pointer to the counter.
+     */
+    virtual std::shared_ptr<iCounter<double>> getThreadLocalCounterDouble(const std::string& name)
+    {
+        return getCounterDouble(name);
+    }
+
+    /**
+     * @brief Gets an unsigned integer counter backed by per-thread slots, aggregated on scrape.
+     *
+     * Defaults to the shared counter so implementations without a thread-local
+     * recording mode keep working.
+     *
+     * @param name The name of the counter.
+     * @return A shared pointer to the counter.
+     */
+    virtual std::shared_ptr<iCounter<uint64_t>> getThreadLocalCounterUInteger(const std::string& name)
+    {
+        return getCounterUInteger(name);
+    }
+
     /**
      * @brief Gets a double up-down counter.
      *
@@ -57,6 +89,20 @@ public:
      */
     virtual std::shared_ptr<iHistogram<uint64_t>> getHistogramUInteger(const std::string& name) = 0;
 
+    /**
+     * @brief Gets a log-bucketed histogram with a lock-free record path, aggregated on scrape.
+     *
+     * Defaults to the shared histogram so implementations without the sparse
+     * instrument keep working.
+     *
+     * @param name The name of the histogram.
+     * @return A shared pointer to the histogram.
+     */
+    virtual std::shared_ptr<iHistogram<uint64_t>> getLogHistogramUInteger(const std::string& name)
+    {
+        return getHistogramUInteger(name);
+    }
+
     /**
      * @brief Gets an integer gauge.
      *
@@ -74,6 +120,22 @@ public:
      * @return A shared pointer to the gauge.
      */
     virtual std::shared_ptr<iGauge<double>> getGaugeDouble(const std::string& name, double defaultValue) = 0;
+
+    /**
+     * @brief Registers a callback invoked at scrape time, publishing its result
+     * as a record of the named instrument.
+     *
+     * Defaults to unsupported so implementations without scrape-time
+     * publication keep working.
+     *
+     * @param name The name the record is published under.
+     * @param callback Callback producing the record.
+     * @return true if the implementation publishes the record on scrape.
+     */
+    virtual bool registerScrapeCallback(const std::string& name, const std::function<json::Json()>& callback)
+    {
+        return false;
+    }
 };
 
 } // namespace metricsManager
@@ -1,7 +1,10 @@
 #ifndef _METRICS_INSTRUMENTS_H
 #define _METRICS_INSTRUMENTS_H
 
+#include <array>
+#include <atomic>
 #include <mutex>
+#include <type_traits>
 
 #include "opentelemetry/metrics/async_instruments.h"
 #include "opentelemetry/sdk/metrics/meter_provider.h"
@@ -87,6 +90,237 @@ private:
     OTstd::unique_ptr<T> m_counter;
 };
 
+/**
+ * @brief Counter that records into per-thread slots and is summed on scrape.
+ *
+ * addValue only touches the slot assigned to the calling thread with a relaxed
+ * atomic add, so per-event instrumentation does not contend on a shared
+ * OpenTelemetry instrument. The total is computed by aggregate when the scope
+ * is scraped.
+ *
+ * @tparam U Basic value type held by the counter.
+ */
+template<typename U>
+class ThreadLocalCounter
+    : public iCounter<U>
+    , public Instrument
+{
+public:
+    /**
+     * @brief Adds a value to the slot of the calling thread.
+     *
+     * @param value The value itself.
+     */
+    void addValue(const U& value) override
+    {
+        if (!getEnabledStatus())
+        {
+            return;
+        }
+
+        auto& slot = m_slots[slotIndex()].value;
+        if constexpr (std::is_integral_v<U>)
+        {
+            slot.fetch_add(value, std::memory_order_relaxed);
+        }
+        else
+        {
+            auto current = slot.load(std::memory_order_relaxed);
+            while (!slot.compare_exchange_weak(current, current + value, std::memory_order_relaxed))
+            {
+            }
+        }
+    }
+
+    /**
+     * @brief Sums every per-thread slot into the cumulative total.
+     *
+     * @return The total recorded since the counter was created.
+     */
+    U aggregate() const
+    {
+        U total {};
+        for (const auto& slot : m_slots)
+        {
+            total += slot.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    /**
+     * @brief Fixed number of per-thread slots. More threads than slots stay
+     * correct, the extra threads share a slot through the atomic add.
+     */
+    static constexpr std::size_t SLOTS = 128;
+
+    /**
+     * @brief A per-thread slot, padded to its own cache line to avoid false
+     * sharing between workers.
+     */
+    struct alignas(64) Slot
+    {
+        std::atomic<U> value {};
+    };
+
+    /**
+     * @brief Gets the slot index assigned to the calling thread, assigning one
+     * on the first call.
+     *
+     * @return The slot index.
+     */
+    static std::size_t slotIndex()
+    {
+        static std::atomic<std::size_t> nextIndex {0};
+        thread_local const std::size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed) % SLOTS;
+        return index;
+    }
+
+    /**
+     * @brief The per-thread slots.
+     */
+    std::array<Slot, SLOTS> m_slots {};
+};
+
+/**
+ * @brief Sparse log-bucketed histogram with a lock-free record path.
+ *
+ * Values are counted into power-of-two buckets with relaxed atomic increments,
+ * so recording on the event hot path never takes a lock or allocates.
+ * Percentiles are estimated from the bucket upper bounds when the scope is
+ * scraped, which bounds the relative error by the bucket width.
+ */
+class LogHistogram
+    : public iHistogram<uint64_t>
+    , public Instrument
+{
+public:
+    /**
+     * @brief One bucket per power of two, covering the full uint64_t range.
+     */
+    static constexpr std::size_t BUCKETS = 64;
+
+    /**
+     * @brief Snapshot of the bucket counts.
+     */
+    using Snapshot = std::array<uint64_t, BUCKETS>;
+
+    /**
+     * @brief Records a value into its power-of-two bucket.
+     *
+     * @param value The value itself.
+     */
+    void recordValue(const uint64_t& value) override
+    {
+        if (!getEnabledStatus())
+        {
+            return;
+        }
+
+        m_buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the number of recorded values.
+     */
+    uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Gets the sum of the recorded values.
+     */
+    uint64_t sum() const { return m_sum.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Takes a snapshot of the bucket counts.
+     *
+     * @return The bucket counts.
+     */
+    Snapshot snapshot() const
+    {
+        Snapshot counts {};
+        for (std::size_t i = 0; i < BUCKETS; i++)
+        {
+            counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+        }
+        return counts;
+    }
+
+    /**
+     * @brief Gets the inclusive upper bound of a bucket.
+     *
+     * @param index The bucket index.
+     * @return The largest value counted into the bucket.
+     */
+    static uint64_t bucketUpperBound(std::size_t index)
+    {
+        if (index >= BUCKETS - 1)
+        {
+            return UINT64_MAX;
+        }
+        return (uint64_t {1} << (index + 1)) - 1;
+    }
+
+    /**
+     * @brief Estimates a percentile from a snapshot of the bucket counts.
+     *
+     * @param counts Snapshot of the bucket counts.
+     * @param percentile The percentile to estimate, between 0 and 1.
+     * @return The upper bound of the bucket holding the requested rank, 0 if empty.
+     */
+    static uint64_t estimatePercentile(const Snapshot& counts, double percentile)
+    {
+        uint64_t total = 0;
+        for (const auto& bucketCount : counts)
+        {
+            total += bucketCount;
+        }
+        if (total == 0)
+        {
+            return 0;
+        }
+
+        auto rank = static_cast<uint64_t>(percentile * static_cast<double>(total));
+        if (rank >= total)
+        {
+            rank = total - 1;
+        }
+
+        uint64_t cumulative = 0;
+        for (std::size_t i = 0; i < BUCKETS; i++)
+        {
+            cumulative += counts[i];
+            if (cumulative > rank)
+            {
+                return bucketUpperBound(i);
+            }
+        }
+
+        return bucketUpperBound(BUCKETS - 1);
+    }
+
+private:
+    /**
+     * @brief Gets the bucket index for a value: the position of its highest set bit.
+     *
+     * @param value The value to bucket.
+     * @return The bucket index.
+     */
+    static std::size_t bucketIndex(uint64_t value)
+    {
+        if (value <= 1)
+        {
+            return 0;
+        }
+        return static_cast<std::size_t>(63 - __builtin_clzll(value));
+    }
+
+    std::array<std::atomic<uint64_t>, BUCKETS> m_buckets {}; ///< Per-power-of-two counts.
+    std::atomic<uint64_t> m_count {0};                       ///< Number of recorded values.
+    std::atomic<uint64_t> m_sum {0};                         ///< Sum of the recorded values.
+};
+
 /**
  * @brief Template class to build Histogram Class. Instrument
  * that encapsulates the Internal OpenTelemetry Object.
@@ -50,6 +50,16 @@ public:
      */
     std::shared_ptr<iCounter<uint64_t>> getCounterUInteger(const std::string& name) override;
 
+    /**
+     * @copydoc IMetricsScope::getThreadLocalCounterDouble()
+     */
+    std::shared_ptr<iCounter<double>> getThreadLocalCounterDouble(const std::string& name) override;
+
+    /**
+     * @copydoc IMetricsScope::getThreadLocalCounterUInteger()
+     */
+    std::shared_ptr<iCounter<uint64_t>> getThreadLocalCounterUInteger(const std::string& name) override;
+
     /**
      * @copydoc IMetricsScope::getUpDownCounterDouble()
      */
@@ -70,6 +80,11 @@ public:
      */
     std::shared_ptr<iHistogram<uint64_t>> getHistogramUInteger(const std::string& name) override;
 
+    /**
+     * @copydoc IMetricsScope::getLogHistogramUInteger()
+     */
+    std::shared_ptr<iHistogram<uint64_t>> getLogHistogramUInteger(const std::string& name) override;
+
     /**
      * @copydoc IMetricsScope::getGaugeInteger()
      */
@@ -80,6 +95,11 @@ public:
      */
     std::shared_ptr<iGauge<double>> getGaugeDouble(const std::string& name, double defaultValue) override;
 
+    /**
+     * @copydoc IMetricsScope::registerScrapeCallback()
+     */
+    bool registerScrapeCallback(const std::string& name, const std::function<json::Json()>& callback) override;
+
     /**
      * @brief Sets the enabled status of the specified instrument.
      *
@@ -159,11 +179,43 @@ private:
      */
     InstrumentCollection<Gauge<double>, OTstd::shared_ptr<OTMetrics::ObservableInstrument>> m_collection_gauge_double;
 
+    /**
+     * @brief Collection of double counters backed by per-thread slots.
+     */
+    std::unordered_map<std::string, std::shared_ptr<ThreadLocalCounter<double>>> m_threadLocalCountersDouble;
+
+    /**
+     * @brief Collection of unsigned integer counters backed by per-thread slots.
+     */
+    std::unordered_map<std::string, std::shared_ptr<ThreadLocalCounter<uint64_t>>> m_threadLocalCountersUInteger;
+
+    /**
+     * @brief Collection of log-bucketed histograms.
+     */
+    std::unordered_map<std::string, std::shared_ptr<LogHistogram>> m_logHistograms;
+
+    /**
+     * @brief Callbacks invoked at scrape time, publishing their result into the DataHub.
+     */
+    std::unordered_map<std::string, std::function<json::Json()>> m_scrapeCallbacks;
+
+    /**
+     * @brief Synchronization object for the scrape-aggregated instrument collections.
+     */
+    std::mutex m_threadLocalMutex;
+
     /**
      * @brief Mapping of instruments indexed by name.
      */
     std::unordered_map<std::string, std::shared_ptr<Instrument>> m_namesMap;
 
+    /**
+     * @brief Aggregates every thread-local counter and log histogram and publishes
+     * the results into the DataHub, so scrapes see up-to-date values without the
+     * exporter interval.
+     */
+    void publishThreadLocalCounters();
+
     /**
      * @brief Register a new instrument in the name index.
      *
@@ -4,6 +4,12 @@
 #include <mutex>
 #include <thread>
 
+namespace
+{
+// Every Nth delta scrape returns the full tree instead of the changed resources only.
+constexpr auto FULL_SNAPSHOT_EVERY {30u};
+} // namespace
+
 namespace metricsManager
 {
 
@@ -24,7 +30,15 @@ json::Json DataHub::getResource(const std::string& scope)
 void DataHub::setResource(const std::string& scope, const json::Json& object)
 {
     const std::lock_guard<std::mutex> lock(m_mutex);
+
+    // An identical value does not bump the version, so the resource stays out of the next delta.
+    if (const auto foundRes = m_resources.find(scope); m_resources.end() != foundRes && foundRes->second == object)
+    {
+        return;
+    }
+
     m_resources[scope] = json::Json {object};
+    ++m_versions[scope];
 }
 
 json::Json DataHub::getAllResources()
@@ -40,4 +54,35 @@ json::Json DataHub::getAllResources()
 
     return retValue;
 }
+
+json::Json DataHub::getDeltaResources()
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    // The first scrape and every FULL_SNAPSHOT_EVERY-th one return the full tree.
+    const auto fullSnapshot = (m_deltaScrapes % FULL_SNAPSHOT_EVERY) == 0;
+    ++m_deltaScrapes;
+
+    json::Json retValue;
+
+    for (auto& r : m_resources)
+    {
+        const auto version = m_versions[r.first];
+        if (fullSnapshot || m_scrapedVersions[r.first] != version)
+        {
+            retValue.set("/" + r.first, r.second);
+            m_scrapedVersions[r.first] = version;
+        }
+    }
+
+    return retValue;
+}
+
+std::string_view DataHub::dumpDeltaResources()
+{
+    const auto delta = getDeltaResources();
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    return delta.str(m_scrapeBuffer);
+}
 } // namespace metricsManager
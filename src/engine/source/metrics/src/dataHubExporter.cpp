@@ -114,6 +114,7 @@ void DataHubExporter::printInstrumentationInfoMetricData(const sdk::metrics::Sco
     jMetricData.setString(version, "/version");
 
     json::Json jDataRecords;
+    json::Json jFingerprintRecords;
 
     for (const auto& record : infoMetric.metric_data_)
     {
@@ -126,8 +127,6 @@ void DataHubExporter::printInstrumentationInfoMetricData(const sdk::metrics::Sco
         auto unit = record.instrument_descriptor.unit_;
         auto type = getInstrumentTypeName(record.instrument_descriptor.type_);
 
-        jRecord.setString(startTime, "/start_time");
-        jRecord.setString(endTime, "/start_time");
         jRecord.setString(instrumentName, "/instrument_name");
         jRecord.setString(description, "/instrument_description");
         jRecord.setString(unit, "/unit");
@@ -146,10 +145,27 @@ void DataHubExporter::printInstrumentationInfoMetricData(const sdk::metrics::Sco
         }
 
         jRecord.set("/attributes", jAttributes);
+
+        // The fingerprint excludes the per-scrape timestamps, which advance on every collection
+        // even when the samples did not change.
+        jFingerprintRecords.appendJson(jRecord);
+
+        jRecord.setString(startTime, "/start_time");
+        jRecord.setString(endTime, "/end_time");
         jDataRecords.appendJson(jRecord);
 
         jMetricData.set("/records", jDataRecords);
     }
+
+    // Only the timestamps changed: skip the hub update so the per-resource version in DataHub does
+    // not advance and the resource stays out of the next delta scrape.
+    if (const auto lastFingerprint = m_lastFingerprint.find(scopeName);
+        m_lastFingerprint.end() != lastFingerprint && lastFingerprint->second == jFingerprintRecords)
+    {
+        return;
+    }
+
+    m_lastFingerprint[scopeName] = json::Json {jFingerprintRecords};
     m_dataHub->setResource(scopeName, jMetricData);
 }
 
@@ -35,6 +35,9 @@ void MetricsScope::initialize(bool delta, int exporterIntervalMS, int exporterTi
 
 json::Json MetricsScope::getAllMetrics(const std::string& metricsInstrumentName)
 {
+    // Thread-local counters are aggregated at scrape time, not exported periodically
+    publishThreadLocalCounters();
+
     if (metricsInstrumentName.empty())
     {
         return m_dataHub->getAllResources();
@@ -73,6 +76,122 @@ std::shared_ptr<iCounter<uint64_t>> MetricsScope::getCounterUInteger(const std::
     return retValue;
 }
 
+std::shared_ptr<iCounter<double>> MetricsScope::getThreadLocalCounterDouble(const std::string& name)
+{
+    const std::lock_guard<std::mutex> lock(m_threadLocalMutex);
+    auto it = m_threadLocalCountersDouble.find(name);
+    if (it == m_threadLocalCountersDouble.end())
+    {
+        it = m_threadLocalCountersDouble.insert(std::make_pair(name, std::make_shared<ThreadLocalCounter<double>>()))
+                 .first;
+        registerInstrument(name, it->second);
+    }
+
+    return it->second;
+}
+
+std::shared_ptr<iCounter<uint64_t>> MetricsScope::getThreadLocalCounterUInteger(const std::string& name)
+{
+    const std::lock_guard<std::mutex> lock(m_threadLocalMutex);
+    auto it = m_threadLocalCountersUInteger.find(name);
+    if (it == m_threadLocalCountersUInteger.end())
+    {
+        it = m_threadLocalCountersUInteger
+                 .insert(std::make_pair(name, std::make_shared<ThreadLocalCounter<uint64_t>>()))
+                 .first;
+        registerInstrument(name, it->second);
+    }
+
+    return it->second;
+}
+
+std::shared_ptr<iHistogram<uint64_t>> MetricsScope::getLogHistogramUInteger(const std::string& name)
+{
+    const std::lock_guard<std::mutex> lock(m_threadLocalMutex);
+    auto it = m_logHistograms.find(name);
+    if (it == m_logHistograms.end())
+    {
+        it = m_logHistograms.insert(std::make_pair(name, std::make_shared<LogHistogram>())).first;
+        registerInstrument(name, it->second);
+    }
+
+    return it->second;
+}
+
+bool MetricsScope::registerScrapeCallback(const std::string& name, const std::function<json::Json()>& callback)
+{
+    const std::lock_guard<std::mutex> lock(m_threadLocalMutex);
+    m_scrapeCallbacks[name] = callback;
+    return true;
+}
+
+void MetricsScope::publishThreadLocalCounters()
+{
+    const std::lock_guard<std::mutex> lock(m_threadLocalMutex);
+
+    auto publish = [this](const std::string& name, json::Json&& jRecord, const std::string& type)
+    {
+        jRecord.setString(name, "/instrument_name");
+        jRecord.setString(type, "/type");
+
+        json::Json jDataRecords;
+        jDataRecords.appendJson(jRecord);
+
+        json::Json jMetricData;
+        jMetricData.set("/records", jDataRecords);
+
+        m_dataHub->setResource(name, jMetricData);
+    };
+
+    for (const auto& [name, counter] : m_threadLocalCountersDouble)
+    {
+        json::Json jRecord;
+        jRecord.setDouble(counter->aggregate(), "/value");
+        publish(name, std::move(jRecord), "ThreadLocalCounter");
+    }
+
+    for (const auto& [name, counter] : m_threadLocalCountersUInteger)
+    {
+        json::Json jRecord;
+        jRecord.setInt64(static_cast<int64_t>(counter->aggregate()), "/value");
+        publish(name, std::move(jRecord), "ThreadLocalCounter");
+    }
+
+    for (const auto& [name, histogram] : m_logHistograms)
+    {
+        const auto counts = histogram->snapshot();
+
+        json::Json jRecord;
+        jRecord.setInt64(static_cast<int64_t>(histogram->count()), "/count");
+        jRecord.setInt64(static_cast<int64_t>(histogram->sum()), "/sum");
+        jRecord.setInt64(static_cast<int64_t>(LogHistogram::estimatePercentile(counts, 0.50)), "/p50");
+        jRecord.setInt64(static_cast<int64_t>(LogHistogram::estimatePercentile(counts, 0.90)), "/p90");
+        jRecord.setInt64(static_cast<int64_t>(LogHistogram::estimatePercentile(counts, 0.99)), "/p99");
+
+        // Sparse bucket list, empty buckets are omitted
+        json::Json jBuckets;
+        for (std::size_t i = 0; i < LogHistogram::BUCKETS; i++)
+        {
+            if (counts[i] == 0)
+            {
+                continue;
+            }
+            json::Json jBucket;
+            jBucket.setInt64(static_cast<int64_t>(LogHistogram::bucketUpperBound(i)), "/le");
+            jBucket.setInt64(static_cast<int64_t>(counts[i]), "/count");
+            jBuckets.appendJson(jBucket);
+        }
+        jRecord.set("/buckets", jBuckets);
+
+        publish(name, std::move(jRecord), "LogHistogram");
+    }
+
+    for (const auto& [name, callback] : m_scrapeCallbacks)
+    {
+        publish(name, callback(), "ScrapeCallback");
+    }
+}
+
 std::shared_ptr<iCounter<double>> MetricsScope::getUpDownCounterDouble(const std::string& name)
 {
     auto retValue = m_collection_updowncounter_double.getInstrument(name,
@@ -53,3 +53,64 @@ TEST_F(DataHubTest, GetAllResources_ReturnsAllResources)
     ASSERT_TRUE(allResources.exists("/scope1"));
     ASSERT_TRUE(allResources.exists("/scope2"));
 }
+
+TEST_F(DataHubTest, GetDeltaResources_FirstScrapeReturnsFullSnapshot)
+{
+    json::Json resourceJson1, resourceJson2;
+    resourceJson1.setInt(1, "/value");
+    resourceJson2.setInt(2, "/value");
+
+    dataHub.setResource("scope1", resourceJson1);
+    dataHub.setResource("scope2", resourceJson2);
+
+    auto delta = dataHub.getDeltaResources();
+
+    ASSERT_TRUE(delta.exists("/scope1"));
+    ASSERT_TRUE(delta.exists("/scope2"));
+}
+
+TEST_F(DataHubTest, GetDeltaResources_ReturnsOnlyChangedResources)
+{
+    json::Json resourceJson1, resourceJson2;
+    resourceJson1.setInt(1, "/value");
+    resourceJson2.setInt(2, "/value");
+
+    dataHub.setResource("scope1", resourceJson1);
+    dataHub.setResource("scope2", resourceJson2);
+    dataHub.getDeltaResources();
+
+    // Re-setting an identical value does not mark the resource as changed
+    dataHub.setResource("scope1", resourceJson1);
+    resourceJson2.setInt(3, "/value");
+    dataHub.setResource("scope2", resourceJson2);
+
+    auto delta = dataHub.getDeltaResources();
+
+    ASSERT_FALSE(delta.exists("/scope1"));
+    ASSERT_TRUE(delta.exists("/scope2"));
+}
+
+TEST_F(DataHubTest, GetDeltaResources_NothingChangedReturnsEmptyDelta)
+{
+    json::Json resourceJson;
+    resourceJson.setInt(1, "/value");
+
+    dataHub.setResource("scope1", resourceJson);
+    dataHub.getDeltaResources();
+
+    auto delta = dataHub.getDeltaResources();
+
+    ASSERT_FALSE(delta.exists("/scope1"));
+}
+
+TEST_F(DataHubTest, DumpDeltaResources_SerializesChangedResources)
+{
+    json::Json resourceJson;
+    resourceJson.setInt(1, "/value");
+
+    dataHub.setResource("scope1", resourceJson);
+
+    auto dump = dataHub.dumpDeltaResources();
+
+    ASSERT_EQ(json::Json(std::string(dump).c_str()), dataHub.getAllResources());
+}
@@ -1,3 +1,6 @@
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <metrics/dataHubExporter.hpp>
@@ -102,6 +105,95 @@ TEST_F(MetricsScopeTest, MetricsHistogram)
     EXPECT_EQ(expected, arrayHistogram[0]);
 }
 
+TEST_F(MetricsScopeTest, MetricsThreadLocalCounter)
+{
+    auto counter = m_spMetricsScope->getThreadLocalCounterUInteger("tlCounter_0");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back(
+            [&counter]()
+            {
+                for (int i = 0; i < 1000; i++)
+                {
+                    counter->addValue(1);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Aggregated at scrape time, no exporter interval to wait for
+    auto arrayCounter = m_spMetricsScope->getAllMetrics().getJson("/tlCounter_0").value().getArray("/records").value();
+
+    auto expected = json::Json {R"({
+        "instrument_name":"tlCounter_0",
+        "type":"ThreadLocalCounter",
+        "value":4000})"};
+
+    EXPECT_EQ(expected, arrayCounter[0]);
+}
+
+TEST_F(MetricsScopeTest, MetricsThreadLocalCounterSameInstance)
+{
+    auto counter = m_spMetricsScope->getThreadLocalCounterUInteger("tlCounter_1");
+    auto sameCounter = m_spMetricsScope->getThreadLocalCounterUInteger("tlCounter_1");
+    EXPECT_EQ(counter, sameCounter);
+}
+
+TEST_F(MetricsScopeTest, MetricsLogHistogram)
+{
+    auto histogram = m_spMetricsScope->getLogHistogramUInteger("logHistogram_0");
+
+    // 99 fast samples and one slow outlier
+    for (int i = 0; i < 99; i++)
+    {
+        histogram->recordValue(100); // Bucket [64, 127]
+    }
+    histogram->recordValue(5000); // Bucket [4096, 8191]
+
+    // Aggregated at scrape time, no exporter interval to wait for
+    auto record =
+        m_spMetricsScope->getAllMetrics().getJson("/logHistogram_0").value().getArray("/records").value()[0];
+
+    EXPECT_EQ(record.getString("/type").value(), "LogHistogram");
+    EXPECT_EQ(record.getInt64("/count").value(), 100);
+    EXPECT_EQ(record.getInt64("/sum").value(), 99 * 100 + 5000);
+    EXPECT_EQ(record.getInt64("/p50").value(), 127);
+    EXPECT_EQ(record.getInt64("/p99").value(), 8191);
+
+    auto buckets = record.getArray("/buckets").value();
+    ASSERT_EQ(buckets.size(), 2);
+    EXPECT_EQ(buckets[0].getInt64("/le").value(), 127);
+    EXPECT_EQ(buckets[0].getInt64("/count").value(), 99);
+    EXPECT_EQ(buckets[1].getInt64("/le").value(), 8191);
+    EXPECT_EQ(buckets[1].getInt64("/count").value(), 1);
+}
+
+TEST_F(MetricsScopeTest, MetricsScrapeCallback)
+{
+    EXPECT_TRUE(m_spMetricsScope->registerScrapeCallback("report_0",
+                                                         []()
+                                                         {
+                                                             json::Json jRecord;
+                                                             jRecord.setInt64(42, "/value");
+                                                             return jRecord;
+                                                         }));
+
+    // Invoked at scrape time, no exporter interval to wait for
+    auto record = m_spMetricsScope->getAllMetrics().getJson("/report_0").value().getArray("/records").value()[0];
+
+    auto expected = json::Json {R"({
+        "instrument_name":"report_0",
+        "type":"ScrapeCallback",
+        "value":42})"};
+
+    EXPECT_EQ(expected, record);
+}
+
 TEST_F(MetricsScopeTest, MetricsGauge)
 {
     auto gauge = m_spMetricsScope->getGaugeDouble("gauge_0", 1);
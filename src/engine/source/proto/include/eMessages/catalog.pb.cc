@@ -42,6 +42,37 @@ struct ResourcePost_RequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResourcePost_RequestDefaultTypeInternal _ResourcePost_Request_default_instance_;
+PROTOBUF_CONSTEXPR ResourceBulkPost_Request_Asset::ResourceBulkPost_Request_Asset(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0} {}
+struct ResourceBulkPost_Request_AssetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResourceBulkPost_Request_AssetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResourceBulkPost_Request_AssetDefaultTypeInternal() {}
+  union {
+    ResourceBulkPost_Request_Asset _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResourceBulkPost_Request_AssetDefaultTypeInternal _ResourceBulkPost_Request_Asset_default_instance_;
+PROTOBUF_CONSTEXPR ResourceBulkPost_Request::ResourceBulkPost_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.assets_)*/{}
+  , /*decltype(_impl_.namespaceid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.format_)*/0} {}
+struct ResourceBulkPost_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResourceBulkPost_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResourceBulkPost_RequestDefaultTypeInternal() {}
+  union {
+    ResourceBulkPost_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResourceBulkPost_RequestDefaultTypeInternal _ResourceBulkPost_Request_default_instance_;
 PROTOBUF_CONSTEXPR ResourceGet_Request::ResourceGet_Request(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_._has_bits_)*/{}
@@ -155,7 +186,7 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 }  // namespace api
 }  // namespace wazuh
 }  // namespace com
-static ::_pb::Metadata file_level_metadata_catalog_2eproto[8];
+static ::_pb::Metadata file_level_metadata_catalog_2eproto[10];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_catalog_2eproto[2];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_catalog_2eproto = nullptr;
 
@@ -174,6 +205,28 @@ const uint32_t TableStruct_catalog_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   3,
   0,
   1,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset, _impl_.content_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceBulkPost_Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceBulkPost_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceBulkPost_Request, _impl_.format_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceBulkPost_Request, _impl_.namespaceid_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceBulkPost_Request, _impl_.assets_),
+  1,
+  0,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceGet_Request, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::catalog::ResourceGet_Request, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -257,17 +310,21 @@ const uint32_t TableStruct_catalog_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 10, -1, sizeof(::com::wazuh::api::engine::catalog::ResourcePost_Request)},
-  { 14, 23, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceGet_Request)},
-  { 26, 35, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceGet_Response)},
-  { 38, 48, -1, sizeof(::com::wazuh::api::engine::catalog::ResourcePut_Request)},
-  { 52, 60, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceDelete_Request)},
-  { 62, 72, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceValidate_Request)},
-  { 76, -1, -1, sizeof(::com::wazuh::api::engine::catalog::NamespacesGet_Request)},
-  { 82, 91, -1, sizeof(::com::wazuh::api::engine::catalog::NamespacesGet_Response)},
+  { 14, 22, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset)},
+  { 24, 33, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceBulkPost_Request)},
+  { 36, 45, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceGet_Request)},
+  { 48, 57, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceGet_Response)},
+  { 60, 70, -1, sizeof(::com::wazuh::api::engine::catalog::ResourcePut_Request)},
+  { 74, 82, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceDelete_Request)},
+  { 84, 94, -1, sizeof(::com::wazuh::api::engine::catalog::ResourceValidate_Request)},
+  { 98, -1, -1, sizeof(::com::wazuh::api::engine::catalog::NamespacesGet_Request)},
+  { 104, 113, -1, sizeof(::com::wazuh::api::engine::catalog::NamespacesGet_Response)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::com::wazuh::api::engine::catalog::_ResourcePost_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::catalog::_ResourceBulkPost_Request_Asset_default_instance_._instance,
+  &::com::wazuh::api::engine::catalog::_ResourceBulkPost_Request_default_instance_._instance,
   &::com::wazuh::api::engine::catalog::_ResourceGet_Request_default_instance_._instance,
   &::com::wazuh::api::engine::catalog::_ResourceGet_Response_default_instance_._instance,
   &::com::wazuh::api::engine::catalog::_ResourcePut_Request_default_instance_._instance,
@@ -285,45 +342,54 @@ const char descriptor_table_protodef_catalog_2eproto[] PROTOBUF_SECTION_VARIABLE
   "\001(\0162,.com.wazuh.api.engine.catalog.Resou"
   "rceFormatH\001\210\001\001\022\024\n\007content\030\003 \001(\tH\002\210\001\001\022\030\n\013"
   "namespaceid\030\004 \001(\tH\003\210\001\001B\007\n\005_typeB\t\n\007_form"
-  "atB\n\n\010_contentB\016\n\014_namespaceid\"\251\001\n\023Resou"
-  "rceGet_Request\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022A\n\006for"
-  "mat\030\002 \001(\0162,.com.wazuh.api.engine.catalog"
-  ".ResourceFormatH\001\210\001\001\022\030\n\013namespaceid\030\003 \001("
-  "\tH\002\210\001\001B\007\n\005_nameB\t\n\007_formatB\016\n\014_namespace"
-  "id\"\212\001\n\024ResourceGet_Response\0222\n\006status\030\001 "
-  "\001(\0162\".com.wazuh.api.engine.ReturnStatus\022"
-  "\022\n\005error\030\002 \001(\tH\000\210\001\001\022\024\n\007content\030\003 \001(\tH\001\210\001"
-  "\001B\010\n\006_errorB\n\n\010_content\"\313\001\n\023ResourcePut_"
-  "Request\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022A\n\006format\030\002 \001"
-  "(\0162,.com.wazuh.api.engine.catalog.Resour"
-  "ceFormatH\001\210\001\001\022\024\n\007content\030\003 \001(\tH\002\210\001\001\022\030\n\013n"
-  "amespaceid\030\004 \001(\tH\003\210\001\001B\007\n\005_nameB\t\n\007_forma"
-  "tB\n\n\010_contentB\016\n\014_namespaceid\"^\n\026Resourc"
-  "eDelete_Request\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022\030\n\013na"
-  "mespaceid\030\002 \001(\tH\001\210\001\001B\007\n\005_nameB\016\n\014_namesp"
-  "aceid\"\320\001\n\030ResourceValidate_Request\022\021\n\004na"
-  "me\030\001 \001(\tH\000\210\001\001\022A\n\006format\030\002 \001(\0162,.com.wazu"
-  "h.api.engine.catalog.ResourceFormatH\001\210\001\001"
-  "\022\024\n\007content\030\003 \001(\tH\002\210\001\001\022\030\n\013namespaceid\030\004 "
-  "\001(\tH\003\210\001\001B\007\n\005_nameB\t\n\007_formatB\n\n\010_content"
-  "B\016\n\014_namespaceid\"\027\n\025NamespacesGet_Reques"
-  "t\"~\n\026NamespacesGet_Response\0222\n\006status\030\001 "
-  "\001(\0162\".com.wazuh.api.engine.ReturnStatus\022"
-  "\022\n\005error\030\002 \001(\tH\000\210\001\001\022\022\n\nnamespaces\030\003 \003(\tB"
-  "\010\n\006_error*1\n\016ResourceFormat\022\010\n\004json\020\000\022\010\n"
-  "\004yaml\020\001\022\007\n\003yml\020\001\032\002\020\001*w\n\014ResourceType\022\013\n\007"
-  "UNKNOWN\020\000\022\013\n\007decoder\020\001\022\010\n\004rule\020\002\022\n\n\006filt"
-  "er\020\003\022\n\n\006output\020\004\022\n\n\006schema\020\005\022\016\n\ncollecti"
-  "on\020\006\022\017\n\013integration\020\007b\006proto3"
+  "atB\n\n\010_contentB\016\n\014_namespaceid\"\323\002\n\030Resou"
+  "rceBulkPost_Request\022A\n\006format\030\001 \001(\0162,.co"
+  "m.wazuh.api.engine.catalog.ResourceForma"
+  "tH\000\210\001\001\022\030\n\013namespaceid\030\002 \001(\tH\001\210\001\001\022L\n\006asse"
+  "ts\030\003 \003(\0132<.com.wazuh.api.engine.catalog."
+  "ResourceBulkPost_Request.Asset\032q\n\005Asset\022"
+  "=\n\004type\030\001 \001(\0162*.com.wazuh.api.engine.cat"
+  "alog.ResourceTypeH\000\210\001\001\022\024\n\007content\030\002 \001(\tH"
+  "\001\210\001\001B\007\n\005_typeB\n\n\010_contentB\t\n\007_formatB\016\n\014"
+  "_namespaceid\"\251\001\n\023ResourceGet_Request\022\021\n\004"
+  "name\030\001 \001(\tH\000\210\001\001\022A\n\006format\030\002 \001(\0162,.com.wa"
+  "zuh.api.engine.catalog.ResourceFormatH\001\210"
+  "\001\001\022\030\n\013namespaceid\030\003 \001(\tH\002\210\001\001B\007\n\005_nameB\t\n"
+  "\007_formatB\016\n\014_namespaceid\"\212\001\n\024ResourceGet"
+  "_Response\0222\n\006status\030\001 \001(\0162\".com.wazuh.ap"
+  "i.engine.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001"
+  "\001\022\024\n\007content\030\003 \001(\tH\001\210\001\001B\010\n\006_errorB\n\n\010_co"
+  "ntent\"\313\001\n\023ResourcePut_Request\022\021\n\004name\030\001 "
+  "\001(\tH\000\210\001\001\022A\n\006format\030\002 \001(\0162,.com.wazuh.api"
+  ".engine.catalog.ResourceFormatH\001\210\001\001\022\024\n\007c"
+  "ontent\030\003 \001(\tH\002\210\001\001\022\030\n\013namespaceid\030\004 \001(\tH\003"
+  "\210\001\001B\007\n\005_nameB\t\n\007_formatB\n\n\010_contentB\016\n\014_"
+  "namespaceid\"^\n\026ResourceDelete_Request\022\021\n"
+  "\004name\030\001 \001(\tH\000\210\001\001\022\030\n\013namespaceid\030\002 \001(\tH\001\210"
+  "\001\001B\007\n\005_nameB\016\n\014_namespaceid\"\320\001\n\030Resource"
+  "Validate_Request\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022A\n\006f"
+  "ormat\030\002 \001(\0162,.com.wazuh.api.engine.catal"
+  "og.ResourceFormatH\001\210\001\001\022\024\n\007content\030\003 \001(\tH"
+  "\002\210\001\001\022\030\n\013namespaceid\030\004 \001(\tH\003\210\001\001B\007\n\005_nameB"
+  "\t\n\007_formatB\n\n\010_contentB\016\n\014_namespaceid\"\027"
+  "\n\025NamespacesGet_Request\"~\n\026NamespacesGet"
+  "_Response\0222\n\006status\030\001 \001(\0162\".com.wazuh.ap"
+  "i.engine.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001"
+  "\001\022\022\n\nnamespaces\030\003 \003(\tB\010\n\006_error*1\n\016Resou"
+  "rceFormat\022\010\n\004json\020\000\022\010\n\004yaml\020\001\022\007\n\003yml\020\001\032\002"
+  "\020\001*w\n\014ResourceType\022\013\n\007UNKNOWN\020\000\022\013\n\007decod"
+  "er\020\001\022\010\n\004rule\020\002\022\n\n\006filter\020\003\022\n\n\006output\020\004\022\n"
+  "\n\006schema\020\005\022\016\n\ncollection\020\006\022\017\n\013integratio"
+  "n\020\007b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_catalog_2eproto_deps[1] = {
   &::descriptor_table_engine_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_catalog_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_catalog_2eproto = {
-    false, false, 1469, descriptor_table_protodef_catalog_2eproto,
+    false, false, 1811, descriptor_table_protodef_catalog_2eproto,
     "catalog.proto",
-    &descriptor_table_catalog_2eproto_once, descriptor_table_catalog_2eproto_deps, 1, 8,
+    &descriptor_table_catalog_2eproto_once, descriptor_table_catalog_2eproto_deps, 1, 10,
     schemas, file_default_instances, TableStruct_catalog_2eproto::offsets,
     file_level_metadata_catalog_2eproto, file_level_enum_descriptors_catalog_2eproto,
     file_level_service_descriptors_catalog_2eproto,
@@ -730,6 +796,552 @@ void ResourcePost_Request::InternalSwap(ResourcePost_Request* other) {
 
 // ===================================================================
 
+class ResourceBulkPost_Request_Asset::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ResourceBulkPost_Request_Asset>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_content(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ResourceBulkPost_Request_Asset::ResourceBulkPost_Request_Asset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset)
+}
+ResourceBulkPost_Request_Asset::ResourceBulkPost_Request_Asset(const ResourceBulkPost_Request_Asset& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResourceBulkPost_Request_Asset* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_content()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset)
+}
+
+inline void ResourceBulkPost_Request_Asset::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.type_){0}
+  };
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ResourceBulkPost_Request_Asset::~ResourceBulkPost_Request_Asset() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResourceBulkPost_Request_Asset::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.content_.Destroy();
+}
+
+void ResourceBulkPost_Request_Asset::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResourceBulkPost_Request_Asset::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.content_.ClearNonDefaultToEmpty();
+  }
+  _impl_.type_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResourceBulkPost_Request_Asset::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .com.wazuh.api.engine.catalog.ResourceType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::com::wazuh::api::engine::catalog::ResourceType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string content = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset.content"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResourceBulkPost_Request_Asset::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional .com.wazuh.api.engine.catalog.ResourceType type = 1;
+  if (_internal_has_type()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional string content = 2;
+  if (_internal_has_content()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset.content");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_content(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset)
+  return target;
+}
+
+size_t ResourceBulkPost_Request_Asset::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string content = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_content());
+    }
+
+    // optional .com.wazuh.api.engine.catalog.ResourceType type = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResourceBulkPost_Request_Asset::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResourceBulkPost_Request_Asset::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResourceBulkPost_Request_Asset::GetClassData() const { return &_class_data_; }
+
+
+void ResourceBulkPost_Request_Asset::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResourceBulkPost_Request_Asset*>(&to_msg);
+  auto& from = static_cast<const ResourceBulkPost_Request_Asset&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_content(from._internal_content());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResourceBulkPost_Request_Asset::CopyFrom(const ResourceBulkPost_Request_Asset& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResourceBulkPost_Request_Asset::IsInitialized() const {
+  return true;
+}
+
+void ResourceBulkPost_Request_Asset::InternalSwap(ResourceBulkPost_Request_Asset* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  swap(_impl_.type_, other->_impl_.type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResourceBulkPost_Request_Asset::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
+      file_level_metadata_catalog_2eproto[1]);
+}
+
+// ===================================================================
+
+class ResourceBulkPost_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ResourceBulkPost_Request>()._impl_._has_bits_);
+  static void set_has_format(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_namespaceid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ResourceBulkPost_Request::ResourceBulkPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.catalog.ResourceBulkPost_Request)
+}
+ResourceBulkPost_Request::ResourceBulkPost_Request(const ResourceBulkPost_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResourceBulkPost_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.assets_){from._impl_.assets_}
+    , decltype(_impl_.namespaceid_){}
+    , decltype(_impl_.format_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.namespaceid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_namespaceid()) {
+    _this->_impl_.namespaceid_.Set(from._internal_namespaceid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.format_ = from._impl_.format_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.catalog.ResourceBulkPost_Request)
+}
+
+inline void ResourceBulkPost_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.assets_){arena}
+    , decltype(_impl_.namespaceid_){}
+    , decltype(_impl_.format_){0}
+  };
+  _impl_.namespaceid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ResourceBulkPost_Request::~ResourceBulkPost_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.catalog.ResourceBulkPost_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResourceBulkPost_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.assets_.~RepeatedPtrField();
+  _impl_.namespaceid_.Destroy();
+}
+
+void ResourceBulkPost_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResourceBulkPost_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.catalog.ResourceBulkPost_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.assets_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.namespaceid_.ClearNonDefaultToEmpty();
+  }
+  _impl_.format_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResourceBulkPost_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .com.wazuh.api.engine.catalog.ResourceFormat format = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_format(static_cast<::com::wazuh::api::engine::catalog::ResourceFormat>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string namespaceid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_namespaceid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.catalog.ResourceBulkPost_Request.namespaceid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset assets = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_assets(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResourceBulkPost_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.catalog.ResourceBulkPost_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional .com.wazuh.api.engine.catalog.ResourceFormat format = 1;
+  if (_internal_has_format()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_format(), target);
+  }
+
+  // optional string namespaceid = 2;
+  if (_internal_has_namespaceid()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_namespaceid().data(), static_cast<int>(this->_internal_namespaceid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.catalog.ResourceBulkPost_Request.namespaceid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_namespaceid(), target);
+  }
+
+  // repeated .com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset assets = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_assets_size()); i < n; i++) {
+    const auto& repfield = this->_internal_assets(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.catalog.ResourceBulkPost_Request)
+  return target;
+}
+
+size_t ResourceBulkPost_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.catalog.ResourceBulkPost_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset assets = 3;
+  total_size += 1UL * this->_internal_assets_size();
+  for (const auto& msg : this->_impl_.assets_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string namespaceid = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_namespaceid());
+    }
+
+    // optional .com.wazuh.api.engine.catalog.ResourceFormat format = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_format());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResourceBulkPost_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResourceBulkPost_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResourceBulkPost_Request::GetClassData() const { return &_class_data_; }
+
+
+void ResourceBulkPost_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResourceBulkPost_Request*>(&to_msg);
+  auto& from = static_cast<const ResourceBulkPost_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.catalog.ResourceBulkPost_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.assets_.MergeFrom(from._impl_.assets_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_namespaceid(from._internal_namespaceid());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.format_ = from._impl_.format_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResourceBulkPost_Request::CopyFrom(const ResourceBulkPost_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.catalog.ResourceBulkPost_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResourceBulkPost_Request::IsInitialized() const {
+  return true;
+}
+
+void ResourceBulkPost_Request::InternalSwap(ResourceBulkPost_Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.assets_.InternalSwap(&other->_impl_.assets_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.namespaceid_, lhs_arena,
+      &other->_impl_.namespaceid_, rhs_arena
+  );
+  swap(_impl_.format_, other->_impl_.format_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResourceBulkPost_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
+      file_level_metadata_catalog_2eproto[2]);
+}
+
+// ===================================================================
+
 class ResourceGet_Request::_Internal {
  public:
   using HasBits = decltype(std::declval<ResourceGet_Request>()._impl_._has_bits_);
@@ -1038,7 +1650,7 @@ void ResourceGet_Request::InternalSwap(ResourceGet_Request* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ResourceGet_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
-      file_level_metadata_catalog_2eproto[1]);
+      file_level_metadata_catalog_2eproto[3]);
 }
 
 // ===================================================================
@@ -1347,7 +1959,7 @@ void ResourceGet_Response::InternalSwap(ResourceGet_Response* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ResourceGet_Response::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
-      file_level_metadata_catalog_2eproto[2]);
+      file_level_metadata_catalog_2eproto[4]);
 }
 
 // ===================================================================
@@ -1715,7 +2327,7 @@ void ResourcePut_Request::InternalSwap(ResourcePut_Request* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ResourcePut_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
-      file_level_metadata_catalog_2eproto[3]);
+      file_level_metadata_catalog_2eproto[5]);
 }
 
 // ===================================================================
@@ -1994,7 +2606,7 @@ void ResourceDelete_Request::InternalSwap(ResourceDelete_Request* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ResourceDelete_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
-      file_level_metadata_catalog_2eproto[4]);
+      file_level_metadata_catalog_2eproto[6]);
 }
 
 // ===================================================================
@@ -2362,7 +2974,7 @@ void ResourceValidate_Request::InternalSwap(ResourceValidate_Request* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ResourceValidate_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
-      file_level_metadata_catalog_2eproto[5]);
+      file_level_metadata_catalog_2eproto[7]);
 }
 
 // ===================================================================
@@ -2402,7 +3014,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NamespacesGet_Request::GetClas
 ::PROTOBUF_NAMESPACE_ID::Metadata NamespacesGet_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
-      file_level_metadata_catalog_2eproto[6]);
+      file_level_metadata_catalog_2eproto[8]);
 }
 
 // ===================================================================
@@ -2688,7 +3300,7 @@ void NamespacesGet_Response::InternalSwap(NamespacesGet_Response* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata NamespacesGet_Response::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_catalog_2eproto_getter, &descriptor_table_catalog_2eproto_once,
-      file_level_metadata_catalog_2eproto[7]);
+      file_level_metadata_catalog_2eproto[9]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -2702,6 +3314,14 @@ template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::catalog::ResourcePost_Re
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::catalog::ResourcePost_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::catalog::ResourcePost_Request >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request >(arena);
+}
 template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::catalog::ResourceGet_Request*
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::catalog::ResourceGet_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::catalog::ResourceGet_Request >(arena);
@@ -58,6 +58,12 @@ extern NamespacesGet_RequestDefaultTypeInternal _NamespacesGet_Request_default_i
 class NamespacesGet_Response;
 struct NamespacesGet_ResponseDefaultTypeInternal;
 extern NamespacesGet_ResponseDefaultTypeInternal _NamespacesGet_Response_default_instance_;
+class ResourceBulkPost_Request;
+struct ResourceBulkPost_RequestDefaultTypeInternal;
+extern ResourceBulkPost_RequestDefaultTypeInternal _ResourceBulkPost_Request_default_instance_;
+class ResourceBulkPost_Request_Asset;
+struct ResourceBulkPost_Request_AssetDefaultTypeInternal;
+extern ResourceBulkPost_Request_AssetDefaultTypeInternal _ResourceBulkPost_Request_Asset_default_instance_;
 class ResourceDelete_Request;
 struct ResourceDelete_RequestDefaultTypeInternal;
 extern ResourceDelete_RequestDefaultTypeInternal _ResourceDelete_Request_default_instance_;
@@ -84,6 +90,8 @@ extern ResourceValidate_RequestDefaultTypeInternal _ResourceValidate_Request_def
 PROTOBUF_NAMESPACE_OPEN
 template<> ::com::wazuh::api::engine::catalog::NamespacesGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::NamespacesGet_Request>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::NamespacesGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::NamespacesGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceBulkPost_Request>(Arena*);
+template<> ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::ResourceDelete_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceDelete_Request>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::ResourceGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceGet_Request>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::ResourceGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceGet_Response>(Arena*);
@@ -364,6 +372,374 @@ class ResourcePost_Request final :
 };
 // -------------------------------------------------------------------
 
+class ResourceBulkPost_Request_Asset final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset) */ {
+ public:
+  inline ResourceBulkPost_Request_Asset() : ResourceBulkPost_Request_Asset(nullptr) {}
+  ~ResourceBulkPost_Request_Asset() override;
+  explicit PROTOBUF_CONSTEXPR ResourceBulkPost_Request_Asset(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResourceBulkPost_Request_Asset(const ResourceBulkPost_Request_Asset& from);
+  ResourceBulkPost_Request_Asset(ResourceBulkPost_Request_Asset&& from) noexcept
+    : ResourceBulkPost_Request_Asset() {
+    *this = ::std::move(from);
+  }
+
+  inline ResourceBulkPost_Request_Asset& operator=(const ResourceBulkPost_Request_Asset& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResourceBulkPost_Request_Asset& operator=(ResourceBulkPost_Request_Asset&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResourceBulkPost_Request_Asset& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResourceBulkPost_Request_Asset* internal_default_instance() {
+    return reinterpret_cast<const ResourceBulkPost_Request_Asset*>(
+               &_ResourceBulkPost_Request_Asset_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ResourceBulkPost_Request_Asset& a, ResourceBulkPost_Request_Asset& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResourceBulkPost_Request_Asset* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResourceBulkPost_Request_Asset* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResourceBulkPost_Request_Asset* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResourceBulkPost_Request_Asset>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResourceBulkPost_Request_Asset& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResourceBulkPost_Request_Asset& from) {
+    ResourceBulkPost_Request_Asset::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResourceBulkPost_Request_Asset* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset";
+  }
+  protected:
+  explicit ResourceBulkPost_Request_Asset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
+  // optional string content = 2;
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // optional .com.wazuh.api.engine.catalog.ResourceType type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::com::wazuh::api::engine::catalog::ResourceType type() const;
+  void set_type(::com::wazuh::api::engine::catalog::ResourceType value);
+  private:
+  ::com::wazuh::api::engine::catalog::ResourceType _internal_type() const;
+  void _internal_set_type(::com::wazuh::api::engine::catalog::ResourceType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_catalog_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResourceBulkPost_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.ResourceBulkPost_Request) */ {
+ public:
+  inline ResourceBulkPost_Request() : ResourceBulkPost_Request(nullptr) {}
+  ~ResourceBulkPost_Request() override;
+  explicit PROTOBUF_CONSTEXPR ResourceBulkPost_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResourceBulkPost_Request(const ResourceBulkPost_Request& from);
+  ResourceBulkPost_Request(ResourceBulkPost_Request&& from) noexcept
+    : ResourceBulkPost_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline ResourceBulkPost_Request& operator=(const ResourceBulkPost_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResourceBulkPost_Request& operator=(ResourceBulkPost_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResourceBulkPost_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResourceBulkPost_Request* internal_default_instance() {
+    return reinterpret_cast<const ResourceBulkPost_Request*>(
+               &_ResourceBulkPost_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ResourceBulkPost_Request& a, ResourceBulkPost_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResourceBulkPost_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResourceBulkPost_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResourceBulkPost_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResourceBulkPost_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResourceBulkPost_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResourceBulkPost_Request& from) {
+    ResourceBulkPost_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResourceBulkPost_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.catalog.ResourceBulkPost_Request";
+  }
+  protected:
+  explicit ResourceBulkPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ResourceBulkPost_Request_Asset Asset;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAssetsFieldNumber = 3,
+    kNamespaceidFieldNumber = 2,
+    kFormatFieldNumber = 1,
+  };
+  // repeated .com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset assets = 3;
+  int assets_size() const;
+  private:
+  int _internal_assets_size() const;
+  public:
+  void clear_assets();
+  ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset* mutable_assets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset >*
+      mutable_assets();
+  private:
+  const ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset& _internal_assets(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset* _internal_add_assets();
+  public:
+  const ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset& assets(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset* add_assets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset >&
+      assets() const;
+
+  // optional string namespaceid = 2;
+  bool has_namespaceid() const;
+  private:
+  bool _internal_has_namespaceid() const;
+  public:
+  void clear_namespaceid();
+  const std::string& namespaceid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_namespaceid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_namespaceid();
+  PROTOBUF_NODISCARD std::string* release_namespaceid();
+  void set_allocated_namespaceid(std::string* namespaceid);
+  private:
+  const std::string& _internal_namespaceid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_namespaceid(const std::string& value);
+  std::string* _internal_mutable_namespaceid();
+  public:
+
+  // optional .com.wazuh.api.engine.catalog.ResourceFormat format = 1;
+  bool has_format() const;
+  private:
+  bool _internal_has_format() const;
+  public:
+  void clear_format();
+  ::com::wazuh::api::engine::catalog::ResourceFormat format() const;
+  void set_format(::com::wazuh::api::engine::catalog::ResourceFormat value);
+  private:
+  ::com::wazuh::api::engine::catalog::ResourceFormat _internal_format() const;
+  void _internal_set_format(::com::wazuh::api::engine::catalog::ResourceFormat value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.ResourceBulkPost_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset > assets_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr namespaceid_;
+    int format_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_catalog_2eproto;
+};
+// -------------------------------------------------------------------
+
 class ResourceGet_Request final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.ResourceGet_Request) */ {
  public:
@@ -412,7 +788,7 @@ class ResourceGet_Request final :
                &_ResourceGet_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    3;
 
   friend void swap(ResourceGet_Request& a, ResourceGet_Request& b) {
     a.Swap(&b);
@@ -605,7 +981,7 @@ class ResourceGet_Response final :
                &_ResourceGet_Response_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    4;
 
   friend void swap(ResourceGet_Response& a, ResourceGet_Response& b) {
     a.Swap(&b);
@@ -794,7 +1170,7 @@ class ResourcePut_Request final :
                &_ResourcePut_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    5;
 
   friend void swap(ResourcePut_Request& a, ResourcePut_Request& b) {
     a.Swap(&b);
@@ -1007,7 +1383,7 @@ class ResourceDelete_Request final :
                &_ResourceDelete_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    6;
 
   friend void swap(ResourceDelete_Request& a, ResourceDelete_Request& b) {
     a.Swap(&b);
@@ -1185,7 +1561,7 @@ class ResourceValidate_Request final :
                &_ResourceValidate_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    7;
 
   friend void swap(ResourceValidate_Request& a, ResourceValidate_Request& b) {
     a.Swap(&b);
@@ -1397,7 +1773,7 @@ class NamespacesGet_Request final :
                &_NamespacesGet_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    8;
 
   friend void swap(NamespacesGet_Request& a, NamespacesGet_Request& b) {
     a.Swap(&b);
@@ -1516,7 +1892,7 @@ class NamespacesGet_Response final :
                &_NamespacesGet_Response_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    9;
 
   friend void swap(NamespacesGet_Response& a, NamespacesGet_Response& b) {
     a.Swap(&b);
@@ -1866,6 +2242,246 @@ inline void ResourcePost_Request::set_allocated_namespaceid(std::string* namespa
 
 // -------------------------------------------------------------------
 
+// ResourceBulkPost_Request_Asset
+
+// optional .com.wazuh.api.engine.catalog.ResourceType type = 1;
+inline bool ResourceBulkPost_Request_Asset::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ResourceBulkPost_Request_Asset::has_type() const {
+  return _internal_has_type();
+}
+inline void ResourceBulkPost_Request_Asset::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::com::wazuh::api::engine::catalog::ResourceType ResourceBulkPost_Request_Asset::_internal_type() const {
+  return static_cast< ::com::wazuh::api::engine::catalog::ResourceType >(_impl_.type_);
+}
+inline ::com::wazuh::api::engine::catalog::ResourceType ResourceBulkPost_Request_Asset::type() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset.type)
+  return _internal_type();
+}
+inline void ResourceBulkPost_Request_Asset::_internal_set_type(::com::wazuh::api::engine::catalog::ResourceType value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void ResourceBulkPost_Request_Asset::set_type(::com::wazuh::api::engine::catalog::ResourceType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset.type)
+}
+
+// optional string content = 2;
+inline bool ResourceBulkPost_Request_Asset::_internal_has_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResourceBulkPost_Request_Asset::has_content() const {
+  return _internal_has_content();
+}
+inline void ResourceBulkPost_Request_Asset::clear_content() {
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ResourceBulkPost_Request_Asset::content() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResourceBulkPost_Request_Asset::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset.content)
+}
+inline std::string* ResourceBulkPost_Request_Asset::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset.content)
+  return _s;
+}
+inline const std::string& ResourceBulkPost_Request_Asset::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void ResourceBulkPost_Request_Asset::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResourceBulkPost_Request_Asset::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResourceBulkPost_Request_Asset::release_content() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset.content)
+  if (!_internal_has_content()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ResourceBulkPost_Request_Asset::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset.content)
+}
+
+// -------------------------------------------------------------------
+
+// ResourceBulkPost_Request
+
+// optional .com.wazuh.api.engine.catalog.ResourceFormat format = 1;
+inline bool ResourceBulkPost_Request::_internal_has_format() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ResourceBulkPost_Request::has_format() const {
+  return _internal_has_format();
+}
+inline void ResourceBulkPost_Request::clear_format() {
+  _impl_.format_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourceBulkPost_Request::_internal_format() const {
+  return static_cast< ::com::wazuh::api::engine::catalog::ResourceFormat >(_impl_.format_);
+}
+inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourceBulkPost_Request::format() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.format)
+  return _internal_format();
+}
+inline void ResourceBulkPost_Request::_internal_set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.format_ = value;
+}
+inline void ResourceBulkPost_Request::set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.format)
+}
+
+// optional string namespaceid = 2;
+inline bool ResourceBulkPost_Request::_internal_has_namespaceid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResourceBulkPost_Request::has_namespaceid() const {
+  return _internal_has_namespaceid();
+}
+inline void ResourceBulkPost_Request::clear_namespaceid() {
+  _impl_.namespaceid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ResourceBulkPost_Request::namespaceid() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.namespaceid)
+  return _internal_namespaceid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResourceBulkPost_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.namespaceid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.namespaceid)
+}
+inline std::string* ResourceBulkPost_Request::mutable_namespaceid() {
+  std::string* _s = _internal_mutable_namespaceid();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.namespaceid)
+  return _s;
+}
+inline const std::string& ResourceBulkPost_Request::_internal_namespaceid() const {
+  return _impl_.namespaceid_.Get();
+}
+inline void ResourceBulkPost_Request::_internal_set_namespaceid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.namespaceid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResourceBulkPost_Request::_internal_mutable_namespaceid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.namespaceid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResourceBulkPost_Request::release_namespaceid() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.namespaceid)
+  if (!_internal_has_namespaceid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.namespaceid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.namespaceid_.IsDefault()) {
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ResourceBulkPost_Request::set_allocated_namespaceid(std::string* namespaceid) {
+  if (namespaceid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.namespaceid_.SetAllocated(namespaceid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.namespaceid_.IsDefault()) {
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.namespaceid)
+}
+
+// repeated .com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset assets = 3;
+inline int ResourceBulkPost_Request::_internal_assets_size() const {
+  return _impl_.assets_.size();
+}
+inline int ResourceBulkPost_Request::assets_size() const {
+  return _internal_assets_size();
+}
+inline void ResourceBulkPost_Request::clear_assets() {
+  _impl_.assets_.Clear();
+}
+inline ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset* ResourceBulkPost_Request::mutable_assets(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.assets)
+  return _impl_.assets_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset >*
+ResourceBulkPost_Request::mutable_assets() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.assets)
+  return &_impl_.assets_;
+}
+inline const ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset& ResourceBulkPost_Request::_internal_assets(int index) const {
+  return _impl_.assets_.Get(index);
+}
+inline const ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset& ResourceBulkPost_Request::assets(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.assets)
+  return _internal_assets(index);
+}
+inline ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset* ResourceBulkPost_Request::_internal_add_assets() {
+  return _impl_.assets_.Add();
+}
+inline ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset* ResourceBulkPost_Request::add_assets() {
+  ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset* _add = _internal_add_assets();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.assets)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceBulkPost_Request_Asset >&
+ResourceBulkPost_Request::assets() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.catalog.ResourceBulkPost_Request.assets)
+  return _impl_.assets_;
+}
+
+// -------------------------------------------------------------------
+
 // ResourceGet_Request
 
 // optional string name = 1;
@@ -2992,6 +3608,10 @@ NamespacesGet_Response::mutable_namespaces() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
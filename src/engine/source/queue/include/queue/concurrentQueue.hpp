@@ -1,18 +1,25 @@
 #ifndef _QUEUE_CONCURRENTQUEUE_HPP
 #define _QUEUE_CONCURRENTQUEUE_HPP
 
+#include <atomic>
 #include <cstring>
 #include <fcntl.h>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include <concurrentqueue/blockingconcurrentqueue.h>
 #include <queue/iqueue.hpp>
+#include <queue/spillQueue.hpp>
 
 #include <base/logging.hpp>
 #include <metrics/iMetricsManager.hpp>
@@ -23,6 +30,22 @@ namespace base::queue
 
 constexpr int64_t WAIT_DEQUEUE_TIMEOUT_USEC = 1 * 100000; ///< Timeout for the wait_dequeue_timed method
 
+constexpr std::size_t FLOOD_RING_CAPACITY = 8192; ///< Capacity of the in-memory ring of pending flooded messages
+constexpr std::size_t FLOOD_WRITE_BATCH = 256;    ///< Maximum messages written to disk per writer iteration
+
+/**
+ * @brief Tuning of the underlying moodycamel queue for the main event pipeline.
+ *
+ * Larger blocks and a bigger implicit index amortize allocation at the event rates the production
+ * queue sustains. Naming the traits here lets consumers spell the concrete queue type, e.g. to
+ * bind to it at compile time, instead of redefining them.
+ */
+struct EventQueueTraits : public moodycamel::ConcurrentQueueDefaultTraits
+{
+    static constexpr size_t BLOCK_SIZE = 2048;
+    static constexpr size_t IMPLICIT_INITIAL_INDEX_SIZE = 8192;
+};
+
 // Check if T has a str method
 template<typename T, typename = std::void_t<>>
 struct has_str_method : std::false_type
@@ -39,6 +62,10 @@ inline constexpr bool has_str_method_v = has_str_method<T>::value;
 /**
  * @brief Provides a wrapper for the flooding file
  *
+ * Writes are asynchronous: write() enqueues the message into a bounded in-memory ring and a
+ * dedicated writer thread drains it in batches, so producers never pay the disk latency. If
+ * the ring is full the message is dropped. Pending messages are drained on destruction.
+ *
  * @warning this is thread safe for the write operation
  */
 class FloodingFile
@@ -46,7 +73,42 @@ class FloodingFile
 private:
     std::ofstream m_file; ///< File stream for the flooding file
     std::string m_error;  ///< Error message if the file is not good
-    std::mutex m_mutex;   ///< Mutex for the write operation
+    moodycamel::BlockingConcurrentQueue<std::string> m_pending; ///< Ring of messages waiting to be written
+    std::thread m_writer;                                       ///< Writer thread draining the ring
+    std::atomic_bool m_running;                                 ///< Flag to stop the writer thread
+
+    /**
+     * @brief Writer thread loop, drains the ring in batches and flushes on idle.
+     */
+    void run()
+    {
+        std::vector<std::string> batch(FLOOD_WRITE_BATCH);
+        while (m_running.load(std::memory_order_relaxed))
+        {
+            auto count = m_pending.wait_dequeue_bulk_timed(batch.begin(), batch.size(), WAIT_DEQUEUE_TIMEOUT_USEC);
+            if (count == 0)
+            {
+                m_file.flush();
+                continue;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                m_file << batch[i] << '\n';
+            }
+        }
+
+        // Drain whatever is left before stopping
+        for (auto count = m_pending.try_dequeue_bulk(batch.begin(), batch.size()); count > 0;
+             count = m_pending.try_dequeue_bulk(batch.begin(), batch.size()))
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                m_file << batch[i] << '\n';
+            }
+        }
+        m_file.flush();
+    }
 
 public:
     /**
@@ -58,12 +120,30 @@ public:
     explicit FloodingFile(const std::string& path)
         : m_file(path, std::ios::out | std::ios::app | std::ios::ate)
         , m_error {}
-        , m_mutex {}
+        , m_pending(FLOOD_RING_CAPACITY)
+        , m_running(false)
     {
         if (!m_file.good())
         {
             m_error = strerror(errno);
         }
+        else
+        {
+            m_running = true;
+            m_writer = std::thread([this]() { run(); });
+        }
+    }
+
+    ~FloodingFile()
+    {
+        if (m_running)
+        {
+            m_running = false;
+            if (m_writer.joinable())
+            {
+                m_writer.join();
+            }
+        }
     }
 
     /**
@@ -85,24 +165,113 @@ public:
     }
 
     /**
-     * @brief Writes a message to the flooding file
+     * @brief Enqueues a message to be written to the flooding file
      *
      * @param message (const std::string&) Message to write
      *
-     * @return true if the write operation was successful, false otherwise
+     * @return true if the message was enqueued, false if the file is not open or the ring is full
      */
     bool write(const std::string& message)
     {
         if (m_file.is_open())
         {
-            std::lock_guard<std::mutex> lock {m_mutex};
-            m_file << message << std::endl;
-            return true;
+            return m_pending.try_enqueue(message);
         }
         return false;
     }
 };
 
+/**
+ * @brief Instrumented metrics policy for ConcurrentQueue (the default).
+ *
+ * Binds the queue counters of the given scopes and forwards every hook to them through the
+ * iMetricsScope virtual interfaces.
+ */
+struct ScopedQueueMetrics
+{
+    std::shared_ptr<metricsManager::IMetricsScope> m_metricsScope;  ///< Metrics scope for the queue
+    std::shared_ptr<metricsManager::iCounter<int64_t>> m_used;      ///< Counter for the used queue
+    std::shared_ptr<metricsManager::iCounter<uint64_t>> m_queued;   ///< Counter for the queued events
+    std::shared_ptr<metricsManager::iCounter<uint64_t>> m_flooded;  ///< Counter for the flooded events
+    std::shared_ptr<metricsManager::iCounter<uint64_t>> m_consumed; ///< Counter for the consumed events
+
+    std::shared_ptr<metricsManager::iCounter<uint64_t>> m_spilled;  ///< Counter for the spilled events
+    std::shared_ptr<metricsManager::iCounter<int64_t>> m_spillDepth; ///< Counter for the spill depth
+
+    std::shared_ptr<metricsManager::IMetricsScope> m_metricsScopeDelta;       ///< Metrics scope for the queue
+    std::shared_ptr<metricsManager::iCounter<uint64_t>> m_consumendPerSecond; ///< Counter for the used queue
+
+    /**
+     * @brief Binds the counters of the given scopes.
+     */
+    void bind(std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+              std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta)
+    {
+        m_metricsScope = std::move(metricsScope);
+        m_queued = m_metricsScope->getCounterUInteger("QueuedEvents");
+        m_used = m_metricsScope->getUpDownCounterInteger("UsedQueue");
+        m_consumed = m_metricsScope->getCounterUInteger("ConsumedEvents");
+        m_flooded = m_metricsScope->getCounterUInteger("FloodedEvents");
+        m_spilled = m_metricsScope->getCounterUInteger("SpilledEvents");
+        m_spillDepth = m_metricsScope->getUpDownCounterInteger("SpillDepth");
+
+        m_metricsScopeDelta = std::move(metricsScopeDelta);
+        m_consumendPerSecond = m_metricsScopeDelta->getCounterUInteger("ConsumedEventsPerSecond");
+    }
+
+    void onQueued(uint64_t count)
+    {
+        m_queued->addValue(count);
+        m_used->addValue(static_cast<int64_t>(count));
+    }
+
+    void onFlooded(uint64_t count) { m_flooded->addValue(count); }
+
+    void onConsumed(uint64_t count)
+    {
+        m_consumed->addValue(count);
+        m_used->addValue(-static_cast<int64_t>(count));
+        m_consumendPerSecond->addValue(count);
+    }
+
+    void onSpilled(uint64_t count)
+    {
+        m_spilled->addValue(count);
+        m_spillDepth->addValue(static_cast<int64_t>(count));
+    }
+
+    void onSpillDrained(uint64_t count)
+    {
+        m_spillDepth->addValue(-static_cast<int64_t>(count));
+        m_consumendPerSecond->addValue(count);
+    }
+};
+
+/**
+ * @brief No-op metrics policy for ConcurrentQueue.
+ *
+ * Every hook is an empty inline resolved at compile time, so latency-critical deployments can
+ * instantiate the queue with literally zero metrics overhead. The scopes passed to the queue
+ * constructor are ignored and may be null.
+ */
+struct NullQueueMetrics
+{
+    void bind(const std::shared_ptr<metricsManager::IMetricsScope>&,
+              const std::shared_ptr<metricsManager::IMetricsScope>&)
+    {
+    }
+
+    void onQueued(uint64_t) {}
+
+    void onFlooded(uint64_t) {}
+
+    void onConsumed(uint64_t) {}
+
+    void onSpilled(uint64_t) {}
+
+    void onSpillDrained(uint64_t) {}
+};
+
 /**
  * @brief A thread-safe queue that can be used to pass messages between threads.
  *
@@ -112,24 +281,15 @@ public:
  * The queue will be flooded when the push method is called and the queue is full
  * and the pathFloodedFile is provided.
  * @tparam T The type of the data to be stored in the queue.
+ * @tparam D The traits of the underlying moodycamel queue.
+ * @tparam M The metrics policy, ScopedQueueMetrics (instrumented, the default) or NullQueueMetrics.
  */
-template<typename T, typename D = moodycamel::ConcurrentQueueDefaultTraits>
+template<typename T, typename D = moodycamel::ConcurrentQueueDefaultTraits, typename M = ScopedQueueMetrics>
 class ConcurrentQueue : public iQueue<T>
 {
 private:
     static_assert(std::is_base_of_v<moodycamel::ConcurrentQueueDefaultTraits, D>,
                   "The template parameter D must be a subclass of ConcurrentQueueDefaultTraits");
-    struct Metrics
-    {
-        std::shared_ptr<metricsManager::IMetricsScope> m_metricsScope;  ///< Metrics scope for the queue
-        std::shared_ptr<metricsManager::iCounter<int64_t>> m_used;      ///< Counter for the used queue
-        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_queued;   ///< Counter for the queued events
-        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_flooded;  ///< Counter for the flooded events
-        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_consumed; ///< Counter for the consumed events
-
-        std::shared_ptr<metricsManager::IMetricsScope> m_metricsScopeDelta;       ///< Metrics scope for the queue
-        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_consumendPerSecond; ///< Counter for the used queue
-    };
 
     moodycamel::BlockingConcurrentQueue<T, D> m_queue {}; ///< The queue itself.
     std::size_t m_minCapacity;                            ///< The minimum capacity of the queue.
@@ -139,7 +299,33 @@ private:
     bool m_discard; ///< If true, the queue will discard the events when it is full instead of flooding the file or
                     ///< blocking.
 
-    Metrics m_metrics; ///< Metrics for the queue
+    std::shared_ptr<SpillQueue> m_spill;          ///< The persistent spill queue, tried before the flooding file.
+    std::function<T(std::string&&)> m_rehydrate;  ///< Rebuilds an element from its spilled representation.
+
+    M m_metrics; ///< Metrics policy for the queue
+
+    std::mutex m_consumerTokensMutex; ///< Mutex protecting the consumer token registry
+    std::unordered_map<std::thread::id, moodycamel::ConsumerToken>
+        m_consumerTokens; ///< Per-consumer-thread tokens for the bulk dequeue path
+
+    /**
+     * @brief Gets (creating it on first use) the consumer token of the calling thread.
+     *
+     * Tokens are owned by the queue so they cannot outlive it. The lookup cost is paid once per
+     * batch, not per element.
+     *
+     * @return moodycamel::ConsumerToken& The token of the calling thread.
+     */
+    moodycamel::ConsumerToken& getConsumerToken()
+    {
+        std::lock_guard<std::mutex> lock {m_consumerTokensMutex};
+        auto it = m_consumerTokens.find(std::this_thread::get_id());
+        if (it == m_consumerTokens.end())
+        {
+            it = m_consumerTokens.emplace(std::this_thread::get_id(), moodycamel::ConsumerToken(m_queue)).first;
+        }
+        return it->second;
+    }
 
     template<typename U = T>
     std::enable_if_t<has_str_method_v<U>, void> pushWithStr(U&& element)
@@ -150,16 +336,15 @@ private:
             {
                 if (m_queue.try_enqueue(std::move(element)))
                 {
-                    m_metrics.m_queued->addValue(1UL);
-                    m_metrics.m_used->addValue(1UL);
+                    m_metrics.onQueued(1UL);
                     return;
                 }
             }
-            m_metrics.m_flooded->addValue(1UL);
+            m_metrics.onFlooded(1UL);
             return;
         }
 
-        if (!m_floodingFile)
+        if (!m_floodingFile && !m_spill)
         {
             while (!m_queue.try_enqueue(std::move(element))) // TODO Wait whats? Move more than once?
             {
@@ -167,8 +352,7 @@ private:
                 // of 5 because we are saturating the queue and we don't want to.
                 std::this_thread::sleep_for(std::chrono::microseconds(500));
             }
-            m_metrics.m_queued->addValue(1UL);
-            m_metrics.m_used->addValue(1);
+            m_metrics.onQueued(1UL);
         }
         else
         {
@@ -176,18 +360,25 @@ private:
             {
                 if (m_queue.try_enqueue(std::move(element))) // TODO Wait whats? Move more than once?
                 {
-                    m_metrics.m_queued->addValue(1UL);
-                    m_metrics.m_used->addValue(1UL);
+                    m_metrics.onQueued(1UL);
                     return;
                 }
                 std::this_thread::sleep_for(m_waitTime);
             }
-            if (element != nullptr)
+
+            // Spill to the persistent ring first, the event is only delayed, not lost
+            if (m_spill && element != nullptr && m_spill->push(element->str()))
+            {
+                m_metrics.onSpilled(1UL);
+                return;
+            }
+
+            if (m_floodingFile && element != nullptr)
             {
                 m_floodingFile->write(element->str());
             }
 
-            m_metrics.m_flooded->addValue(1UL);
+            m_metrics.onFlooded(1UL);
         }
     }
 
@@ -197,6 +388,32 @@ private:
         throw std::logic_error("The type T must have a ->str() method");
     }
 
+    /**
+     * @brief Pops and rehydrates the oldest spilled element, skipping unreadable records.
+     *
+     * @param element A reference to store the rehydrated element.
+     * @return true if an element was recovered, false if the spill ring is empty.
+     */
+    bool popSpill(T& element)
+    {
+        std::string raw;
+        while (m_spill->tryPop(raw))
+        {
+            try
+            {
+                element = m_rehydrate(std::move(raw));
+                m_metrics.onSpillDrained(1UL);
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Cannot rehydrate spilled event: '{}' (discarding...)", e.what());
+                m_metrics.onSpillDrained(1UL);
+            }
+        }
+        return false;
+    }
+
 public:
     /**
      * @brief Construct a new Concurrent Queue object
@@ -208,10 +425,15 @@ public:
      * @param maxAttempts The maximum number of attempts to push an element to the queue. (ignored if
      * pathFloodedFile is not provided)
      * @param waitTime The time to wait for the queue to be not full. (ignored if pathFloodedFile is not provided)
+     * @param discard If true, the queue will discard the events when it is full.
+     * @param spill (Optional) Persistent spill queue, tried before the flooding file when the
+     * queue is full. Consumers drain it opportunistically when the live queue empties.
+     * @param rehydrate Rebuilds an element from its spilled representation, required with spill.
      *
      * @throw std::runtime_error if the capacity is less than or equal to 0
      * @throw std::runtime_error if the pathFloodedFile is provided and the maxAttempts is less than or equal to 0
      * @throw std::runtime_error if the pathFloodedFile is provided and the waitTime is less than or equal to 0
+     * @throw std::runtime_error if the spill queue is provided without a rehydrate function
      * @note If the pathFloodedFile is not provided, the queue will not be flooded,and the
      * push method will block until there is space in the queue.
      */
@@ -221,7 +443,9 @@ public:
                              const std::string& pathFloodedFile = {},
                              const int maxAttempts = -1,
                              const int waitTime = -1,
-                             const bool discard = false)
+                             const bool discard = false,
+                             std::shared_ptr<SpillQueue> spill = nullptr,
+                             std::function<T(std::string&&)> rehydrate = {})
         : m_floodingFile {nullptr}
         , m_discard {discard}
     {
@@ -264,14 +488,95 @@ public:
             LOG_INFO("No flooding file provided, the queue will not be flooded.");
         }
 
-        m_metrics.m_metricsScope = std::move(metricsScope);
-        m_metrics.m_queued = m_metrics.m_metricsScope->getCounterUInteger("QueuedEvents");
-        m_metrics.m_used = m_metrics.m_metricsScope->getUpDownCounterInteger("UsedQueue");
-        m_metrics.m_consumed = m_metrics.m_metricsScope->getCounterUInteger("ConsumedEvents");
-        m_metrics.m_flooded = m_metrics.m_metricsScope->getCounterUInteger("FloodedEvents");
+        if (spill)
+        {
+            if (!rehydrate)
+            {
+                throw std::runtime_error("A rehydrate function must be provided with the spill queue");
+            }
+
+            if (maxAttempts <= 0)
+            {
+                throw std::runtime_error("The maximum number of attempts must be greater than 0");
+            }
+
+            if (waitTime <= 0)
+            {
+                throw std::runtime_error("The wait time must be greater than 0");
+            }
+
+            m_maxAttempts = maxAttempts;
+            m_waitTime = std::chrono::microseconds(waitTime);
+            m_spill = std::move(spill);
+            m_rehydrate = std::move(rehydrate);
+            LOG_INFO("The queue will spill overflow to a persistent ring ({} pending events recovered).",
+                     m_spill->size());
+        }
+
+        m_metrics.bind(std::move(metricsScope), std::move(metricsScopeDelta));
+    }
+
+    /**
+     * @brief Construct a new Concurrent Queue that floods into an already-open FloodingFile.
+     *
+     * Used when several queues must spill into the same file (e.g. the shards of a
+     * ShardedQueue), so all of them share a single writer thread and messages are never
+     * interleaved mid-line.
+     *
+     * @param capacity The capacity of the queue. (Approximate)
+     * @param metricsScope The metrics scope for the queue.
+     * @param metricsScopeDelta The metrics scope for the per-second counters.
+     * @param floodingFile The shared flooding file, must be open and without errors.
+     * @param maxAttempts The maximum number of attempts to push an element to the queue.
+     * @param waitTime The time to wait for the queue to be not full (in microseconds).
+     * @param discard If true, the queue will discard the events when it is full.
+     * @param spill (Optional) Persistent spill queue, may also be shared between queues.
+     * @param rehydrate Rebuilds an element from its spilled representation, required with spill.
+     *
+     * @throw std::runtime_error if any of the parameters is invalid.
+     */
+    explicit ConcurrentQueue(const int capacity,
+                             std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                             std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                             std::shared_ptr<FloodingFile> floodingFile,
+                             const int maxAttempts,
+                             const int waitTime,
+                             const bool discard = false,
+                             std::shared_ptr<SpillQueue> spill = nullptr,
+                             std::function<T(std::string&&)> rehydrate = {})
+        : ConcurrentQueue(capacity,
+                          std::move(metricsScope),
+                          std::move(metricsScopeDelta),
+                          std::string {},
+                          maxAttempts,
+                          waitTime,
+                          discard,
+                          std::move(spill),
+                          std::move(rehydrate))
+    {
+        if (!floodingFile)
+        {
+            throw std::runtime_error("The flooding file must be provided");
+        }
+
+        if (floodingFile->getError())
+        {
+            throw std::runtime_error("Error opening the flooding file: " + floodingFile->getError().value());
+        }
+
+        if (maxAttempts <= 0)
+        {
+            throw std::runtime_error("The maximum number of attempts must be greater than 0");
+        }
+
+        if (waitTime <= 0)
+        {
+            throw std::runtime_error("The wait time must be greater than 0");
+        }
 
-        m_metrics.m_metricsScopeDelta = std::move(metricsScopeDelta);
-        m_metrics.m_consumendPerSecond = m_metrics.m_metricsScopeDelta->getCounterUInteger("ConsumedEventsPerSecond");
+        m_floodingFile = std::move(floodingFile);
+        m_maxAttempts = maxAttempts;
+        m_waitTime = std::chrono::microseconds(waitTime);
     }
 
     void push(T&& element) override
@@ -286,6 +591,36 @@ public:
         }
     }
 
+    /**
+     * @brief Pushes a batch of elements with a single enqueue operation.
+     *
+     * The bulk enqueue is all-or-nothing: when the queue cannot take the whole batch the
+     * elements fall back to the per-element path, keeping its backpressure, spill and
+     * flooding handling.
+     *
+     * @param elements The elements to be pushed, they will be moved. Left empty.
+     */
+    void pushBulk(std::vector<T>&& elements) override
+    {
+        if (elements.empty())
+        {
+            return;
+        }
+
+        if (m_queue.try_enqueue_bulk(std::make_move_iterator(elements.begin()), elements.size()))
+        {
+            m_metrics.onQueued(elements.size());
+            elements.clear();
+            return;
+        }
+
+        for (auto& element : elements)
+        {
+            push(std::move(element));
+        }
+        elements.clear();
+    }
+
     /**
      * @brief Pushes a new element to the queue.
      *
@@ -307,8 +642,7 @@ public:
         auto result = m_queue.try_enqueue(element);
         if (result)
         {
-            m_metrics.m_queued->addValue(1UL);
-            m_metrics.m_used->addValue(1);
+            m_metrics.onQueued(1UL);
         }
         return result;
     }
@@ -327,15 +661,16 @@ public:
      */
     bool waitPop(T& element, int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
     {
-        auto result = m_queue.wait_dequeue_timed(element, timeout);
+        // With spilled events pending, don't block on an empty live queue: drain the backlog
+        const bool spillPending = m_spill && !m_spill->empty();
+        auto result = m_queue.wait_dequeue_timed(element, spillPending ? 0 : timeout);
         if (result)
         {
-            m_metrics.m_consumed->addValue(1UL);
-            m_metrics.m_used->addValue(-1);
-            m_metrics.m_consumendPerSecond->addValue(1UL);
+            m_metrics.onConsumed(1UL);
+            return true;
         }
 
-        return result;
+        return spillPending && popSpill(element);
     }
 
     bool tryPop(T& element) override
@@ -343,11 +678,48 @@ public:
         auto result = m_queue.try_dequeue(element);
         if (result)
         {
-            m_metrics.m_consumed->addValue(1UL);
-            m_metrics.m_used->addValue(-1);
-            m_metrics.m_consumendPerSecond->addValue(1UL);
+            m_metrics.onConsumed(1UL);
+            return true;
         }
-        return result;
+        return m_spill && !m_spill->empty() && popSpill(element);
+    }
+
+    /**
+     * @brief Waits for and pops up to maxElements elements from the queue in a single operation.
+     *
+     * Uses a per-consumer-thread token so the synchronization cost of the dequeue is amortized
+     * across the whole batch instead of being paid per element.
+     *
+     * @param elements Output buffer, it will be cleared and filled with the popped elements.
+     * @param maxElements The maximum number of elements to pop.
+     * @param timeout The maximum time to wait for the first element (in microseconds).
+     * @return The number of elements popped, 0 if the timeout was reached.
+     */
+    size_t waitPopBulk(std::vector<T>& elements,
+                       size_t maxElements,
+                       int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
+    {
+        const bool spillPending = m_spill && !m_spill->empty();
+        elements.clear();
+        elements.resize(maxElements);
+        auto popped = m_queue.wait_dequeue_bulk_timed(
+            getConsumerToken(), elements.begin(), maxElements, spillPending ? 0 : timeout);
+        elements.resize(popped);
+        if (popped > 0)
+        {
+            m_metrics.onConsumed(static_cast<uint64_t>(popped));
+            return popped;
+        }
+
+        if (spillPending)
+        {
+            T element {};
+            while (elements.size() < maxElements && popSpill(element))
+            {
+                elements.emplace_back(std::move(element));
+            }
+        }
+        return elements.size();
     }
 
     /**
@@ -357,14 +729,14 @@ public:
      * @return true if the queue is empty.
      * @return false otherwise.
      */
-    bool empty() const override { return m_queue.size_approx() == 0; }
+    bool empty() const override { return m_queue.size_approx() == 0 && (!m_spill || m_spill->empty()); }
     /**
-     * @brief Gets the size of the queue.
+     * @brief Gets the size of the queue, including the spilled backlog.
      *
      * @note The size is approximate.
      * @return size_t The size of the queue.
      */
-    inline size_t size() const override { return m_queue.size_approx(); }
+    inline size_t size() const override { return m_queue.size_approx() + (m_spill ? m_spill->size() : 0); }
 
     /**
      * @brief Gets the approximate free capacity of the queue.
@@ -0,0 +1,325 @@
+#ifndef _QUEUE_SHARDEDQUEUE_HPP
+#define _QUEUE_SHARDEDQUEUE_HPP
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <queue/concurrentQueue.hpp>
+#include <queue/iqueue.hpp>
+
+namespace base::queue
+{
+
+/**
+ * @brief A queue split into per-worker shards with work stealing.
+ *
+ * Each consumer thread is pinned to its own shard, so under uniform traffic workers never
+ * contend on the same underlying queue. When a worker finds its shard empty it steals a batch
+ * from the most loaded shard before blocking, so skewed traffic (one chatty producer) cannot
+ * leave workers idle.
+ *
+ * Producers are routed by the optional key extractor (e.g. a hash of the agent location), so
+ * events with the same key always land in the same shard and their relative order is preserved
+ * as long as no stealing happens. Without an extractor the shards are fed round-robin.
+ *
+ * All shards share a single FloodingFile, so the flooding behavior is the same as a plain
+ * ConcurrentQueue of the aggregated capacity.
+ *
+ * @tparam T The type of the data to be stored in the queue.
+ * @tparam D The traits of the underlying moodycamel queues.
+ * @tparam M The metrics policy forwarded to the shard queues, see ConcurrentQueue.
+ */
+template<typename T, typename D = moodycamel::ConcurrentQueueDefaultTraits, typename M = ScopedQueueMetrics>
+class ShardedQueue : public iQueue<T>
+{
+public:
+    using KeyExtractor = std::function<std::size_t(const T&)>; ///< Maps an element to an affinity key
+
+private:
+    std::vector<std::shared_ptr<ConcurrentQueue<T, D, M>>> m_shardQueues; ///< The underlying shard queues
+    KeyExtractor m_keyExtractor;        ///< Optional producer affinity, round-robin when not set
+    std::atomic_size_t m_nextProducer;  ///< Round-robin cursor for producers without affinity
+    std::atomic_size_t m_nextConsumer;  ///< Next shard to assign to a new consumer thread
+
+    std::mutex m_consumersMutex; ///< Mutex protecting the consumer shard registry
+    std::unordered_map<std::thread::id, std::size_t> m_consumerShards; ///< Shard owned by each consumer thread
+
+    /**
+     * @brief Gets the shard an element should be pushed to.
+     */
+    std::size_t producerShard(const T& element)
+    {
+        if (m_keyExtractor)
+        {
+            return m_keyExtractor(element) % m_shardQueues.size();
+        }
+        return m_nextProducer.fetch_add(1, std::memory_order_relaxed) % m_shardQueues.size();
+    }
+
+    /**
+     * @brief Gets (assigning it on first use) the shard owned by the calling consumer thread.
+     */
+    std::size_t consumerShard()
+    {
+        std::lock_guard<std::mutex> lock {m_consumersMutex};
+        auto it = m_consumerShards.find(std::this_thread::get_id());
+        if (it == m_consumerShards.end())
+        {
+            const auto shard = m_nextConsumer.fetch_add(1, std::memory_order_relaxed) % m_shardQueues.size();
+            it = m_consumerShards.emplace(std::this_thread::get_id(), shard).first;
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Gets the most loaded shard other than the given one, if any has elements.
+     */
+    std::size_t victimShard(std::size_t own) const
+    {
+        std::size_t victim = own;
+        std::size_t maxSize = 0;
+        for (std::size_t i = 0; i < m_shardQueues.size(); ++i)
+        {
+            if (i == own)
+            {
+                continue;
+            }
+            const auto size = m_shardQueues[i]->size();
+            if (size > maxSize)
+            {
+                maxSize = size;
+                victim = i;
+            }
+        }
+        return victim;
+    }
+
+public:
+    /**
+     * @brief Construct a new Sharded Queue object
+     *
+     * @param shards The number of shards, should match the number of consumer threads.
+     * @param capacity The aggregated capacity of the queue, split evenly among the shards.
+     * @param metricsScope The metrics scope for the queue, shared by all the shards.
+     * @param metricsScopeDelta The metrics scope for the per-second counters.
+     * @param keyExtractor (Optional) Producer affinity, events with the same key keep their order.
+     * @param pathFloodedFile The path to the file where the queue will be flooded.
+     * @param maxAttempts The maximum number of attempts to push an element to the queue.
+     * @param waitTime The time to wait for the queue to be not full (in microseconds).
+     * @param discard If true, the queue will discard the events when it is full.
+     * @param spill (Optional) Persistent spill queue shared by all the shards, tried before the
+     * flooding file when a shard is full.
+     * @param rehydrate Rebuilds an element from its spilled representation, required with spill.
+     *
+     * @throw std::runtime_error if the number of shards is less than or equal to 0, or if any of
+     * the parameters forwarded to the shards is invalid.
+     */
+    explicit ShardedQueue(const int shards,
+                          const int capacity,
+                          std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                          std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                          KeyExtractor keyExtractor = {},
+                          const std::string& pathFloodedFile = {},
+                          const int maxAttempts = -1,
+                          const int waitTime = -1,
+                          const bool discard = false,
+                          std::shared_ptr<SpillQueue> spill = nullptr,
+                          std::function<T(std::string&&)> rehydrate = {})
+        : m_keyExtractor {std::move(keyExtractor)}
+        , m_nextProducer {0}
+        , m_nextConsumer {0}
+    {
+        if (shards <= 0)
+        {
+            throw std::runtime_error("The number of shards must be greater than 0");
+        }
+
+        if (capacity <= 0)
+        {
+            throw std::runtime_error("The capacity of the queue must be greater than 0");
+        }
+
+        const auto shardCapacity = (capacity + shards - 1) / shards;
+
+        std::shared_ptr<FloodingFile> floodingFile {};
+        if (!pathFloodedFile.empty())
+        {
+            floodingFile = std::make_shared<FloodingFile>(pathFloodedFile);
+            if (floodingFile->getError())
+            {
+                throw std::runtime_error("Error opening the flooding file: " + floodingFile->getError().value());
+            }
+        }
+
+        m_shardQueues.reserve(shards);
+        for (int i = 0; i < shards; ++i)
+        {
+            if (floodingFile)
+            {
+                m_shardQueues.emplace_back(std::make_shared<ConcurrentQueue<T, D, M>>(shardCapacity,
+                                                                                      metricsScope,
+                                                                                      metricsScopeDelta,
+                                                                                      floodingFile,
+                                                                                      maxAttempts,
+                                                                                      waitTime,
+                                                                                      discard,
+                                                                                      spill,
+                                                                                      rehydrate));
+            }
+            else
+            {
+                m_shardQueues.emplace_back(std::make_shared<ConcurrentQueue<T, D, M>>(shardCapacity,
+                                                                                      metricsScope,
+                                                                                      metricsScopeDelta,
+                                                                                      std::string {},
+                                                                                      spill ? maxAttempts : -1,
+                                                                                      spill ? waitTime : -1,
+                                                                                      discard,
+                                                                                      spill,
+                                                                                      rehydrate));
+            }
+        }
+    }
+
+    void push(T&& element) override { m_shardQueues[producerShard(element)]->push(std::move(element)); }
+
+    /**
+     * @brief Pushes a batch to one shard with a single bulk enqueue.
+     *
+     * With a key extractor the elements may belong to different shards, so they are routed
+     * one by one; otherwise the whole batch lands on the next round-robin shard.
+     *
+     * @param elements The elements to be pushed, they will be moved. Left empty.
+     */
+    void pushBulk(std::vector<T>&& elements) override
+    {
+        if (elements.empty())
+        {
+            return;
+        }
+
+        if (m_keyExtractor)
+        {
+            for (auto& element : elements)
+            {
+                push(std::move(element));
+            }
+            elements.clear();
+            return;
+        }
+
+        m_shardQueues[producerShard(elements.front())]->pushBulk(std::move(elements));
+    }
+
+    bool tryPush(const T& element) override { return m_shardQueues[producerShard(element)]->tryPush(element); }
+
+    /**
+     * @brief Waits for and pops an element, stealing from other shards if the own one is empty.
+     *
+     * @param element A reference to store the popped element.
+     * @param timeout The maximum time to wait on the own shard (in microseconds).
+     * @return true if an element was popped, false if the timeout was reached.
+     */
+    bool waitPop(T& element, int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
+    {
+        const auto own = consumerShard();
+        if (m_shardQueues[own]->tryPop(element))
+        {
+            return true;
+        }
+
+        const auto victim = victimShard(own);
+        if (victim != own && m_shardQueues[victim]->tryPop(element))
+        {
+            return true;
+        }
+
+        return m_shardQueues[own]->waitPop(element, timeout);
+    }
+
+    bool tryPop(T& element) override
+    {
+        const auto own = consumerShard();
+        if (m_shardQueues[own]->tryPop(element))
+        {
+            return true;
+        }
+
+        const auto victim = victimShard(own);
+        return victim != own && m_shardQueues[victim]->tryPop(element);
+    }
+
+    /**
+     * @brief Waits for and pops up to maxElements elements, stealing a batch from the most
+     * loaded shard if the own one is empty.
+     *
+     * @param elements Output buffer, it will be cleared and filled with the popped elements.
+     * @param maxElements The maximum number of elements to pop.
+     * @param timeout The maximum time to wait on the own shard (in microseconds).
+     * @return The number of elements popped, 0 if the timeout was reached.
+     */
+    size_t waitPopBulk(std::vector<T>& elements,
+                       size_t maxElements,
+                       int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
+    {
+        const auto own = consumerShard();
+        auto popped = m_shardQueues[own]->waitPopBulk(elements, maxElements, 0);
+        if (popped > 0)
+        {
+            return popped;
+        }
+
+        const auto victim = victimShard(own);
+        if (victim != own)
+        {
+            popped = m_shardQueues[victim]->waitPopBulk(elements, maxElements, 0);
+            if (popped > 0)
+            {
+                return popped;
+            }
+        }
+
+        return m_shardQueues[own]->waitPopBulk(elements, maxElements, timeout);
+    }
+
+    bool empty() const override
+    {
+        for (const auto& shard : m_shardQueues)
+        {
+            if (!shard->empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t size() const override
+    {
+        size_t total = 0;
+        for (const auto& shard : m_shardQueues)
+        {
+            total += shard->size();
+        }
+        return total;
+    }
+
+    size_t aproxFreeSlots() const override
+    {
+        size_t total = 0;
+        for (const auto& shard : m_shardQueues)
+        {
+            total += shard->aproxFreeSlots();
+        }
+        return total;
+    }
+};
+
+} // namespace base::queue
+
+#endif // _QUEUE_SHARDEDQUEUE_HPP
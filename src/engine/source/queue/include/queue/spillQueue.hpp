@@ -0,0 +1,328 @@
+#ifndef _QUEUE_SPILLQUEUE_HPP
+#define _QUEUE_SPILLQUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <base/logging.hpp>
+
+namespace base::queue
+{
+
+constexpr std::size_t SPILL_SEGMENT_SIZE = 4 * 1024 * 1024; ///< Default size of each spill segment file
+constexpr std::size_t SPILL_MAX_SEGMENTS = 64;              ///< Default maximum number of live spill segments
+
+/**
+ * @brief A persistent overflow queue backed by a ring of memory-mapped segment files.
+ *
+ * Messages are appended sequentially to fixed-size mmap'd segments as [length][payload]
+ * records, so producers only pay a memcpy and the kernel writes the pages back. When a
+ * segment fills a new one is mapped, and fully drained segments are unlinked, bounding the
+ * ring to maxSegments. The record length is written after the payload, so a record cut by a
+ * crash reads as length 0 and is invisible to recovery.
+ *
+ * On construction the surviving segments are scanned and their records become poppable
+ * again, turning an ingestion spike or a restart into delayed processing instead of data
+ * loss. Consumption progress is not persisted, so records of a partially drained segment are
+ * replayed after a restart: delivery is at-least-once.
+ *
+ * @warning Thread safe, push and pop serialize on an internal mutex. The spill path is off
+ * the hot path by design, so the lock is not contended in normal operation.
+ */
+class SpillQueue
+{
+private:
+    /**
+     * @brief A memory-mapped segment file of the ring.
+     */
+    struct Segment
+    {
+        std::size_t seq; ///< Monotonic sequence number, also the file name
+        int fd;          ///< File descriptor backing the mapping
+        char* map;       ///< Base address of the mapping
+    };
+
+    std::filesystem::path m_dir;  ///< Directory holding the segment files
+    std::size_t m_segmentSize;    ///< Size of each segment file
+    std::size_t m_maxSegments;    ///< Maximum number of live segments
+
+    mutable std::mutex m_mutex;     ///< Serializes push and pop
+    std::deque<Segment> m_segments; ///< Live segments, oldest first
+    std::size_t m_writeOffset {0};  ///< Append offset into the newest segment
+    std::size_t m_readOffset {0};   ///< Read offset into the oldest segment
+    std::size_t m_nextSeq {0};      ///< Sequence number of the next segment to create
+    std::atomic_size_t m_depth {0}; ///< Records currently spilled (the spill depth)
+
+    /**
+     * @brief Gets the path of the segment file with the given sequence number.
+     */
+    std::filesystem::path segmentPath(std::size_t seq) const { return m_dir / (std::to_string(seq) + ".seg"); }
+
+    /**
+     * @brief Opens (creating it if needed) and memory-maps the segment with the given sequence number.
+     *
+     * @throw std::runtime_error if the file cannot be opened, sized or mapped.
+     */
+    Segment mapSegment(std::size_t seq)
+    {
+        const auto path = segmentPath(seq);
+        const int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0640);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Cannot open spill segment '" + path.string() + "': " + strerror(errno));
+        }
+
+        // ftruncate zero-fills, so the untouched area reads as length 0 (end of valid data)
+        if (::ftruncate(fd, m_segmentSize) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Cannot size spill segment '" + path.string() + "': " + strerror(errno));
+        }
+
+        auto* map = static_cast<char*>(::mmap(nullptr, m_segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+        if (map == MAP_FAILED)
+        {
+            ::close(fd);
+            throw std::runtime_error("Cannot map spill segment '" + path.string() + "': " + strerror(errno));
+        }
+
+        return {seq, fd, map};
+    }
+
+    /**
+     * @brief Unmaps a segment, unlinking its file when it has been fully drained.
+     */
+    void unmapSegment(const Segment& segment, bool unlink)
+    {
+        ::munmap(segment.map, m_segmentSize);
+        ::close(segment.fd);
+        if (unlink)
+        {
+            std::error_code ec;
+            std::filesystem::remove(segmentPath(segment.seq), ec);
+        }
+    }
+
+    /**
+     * @brief Reads a record length at the given position.
+     */
+    static uint32_t readLength(const char* at)
+    {
+        uint32_t length;
+        std::memcpy(&length, at, sizeof(length));
+        return length;
+    }
+
+    /**
+     * @brief Scans the records of a segment.
+     *
+     * @return The number of valid records and the offset just past the last one.
+     */
+    std::pair<std::size_t, std::size_t> scanSegment(const char* map) const
+    {
+        std::size_t offset = 0;
+        std::size_t count = 0;
+        while (offset + sizeof(uint32_t) <= m_segmentSize)
+        {
+            const auto length = readLength(map + offset);
+            if (length == 0 || offset + sizeof(uint32_t) + length > m_segmentSize)
+            {
+                break;
+            }
+            ++count;
+            offset += sizeof(uint32_t) + length;
+        }
+        return {count, offset};
+    }
+
+public:
+    /**
+     * @brief Construct a new SpillQueue, recovering the records of any surviving segments.
+     *
+     * @param dir Directory for the segment files, created if it does not exist.
+     * @param segmentSize Size of each segment file, must fit at least one record.
+     * @param maxSegments Maximum number of live segments, bounds the disk usage.
+     *
+     * @throw std::runtime_error if the parameters are invalid or the directory/segments
+     * cannot be prepared.
+     */
+    explicit SpillQueue(const std::string& dir,
+                        const std::size_t segmentSize = SPILL_SEGMENT_SIZE,
+                        const std::size_t maxSegments = SPILL_MAX_SEGMENTS)
+        : m_dir {dir}
+        , m_segmentSize {segmentSize}
+        , m_maxSegments {maxSegments}
+    {
+        if (dir.empty())
+        {
+            throw std::runtime_error("The spill directory must be provided");
+        }
+
+        if (m_segmentSize <= sizeof(uint32_t) || m_maxSegments == 0)
+        {
+            throw std::runtime_error("The spill segment size and maximum segments must be greater than 0");
+        }
+
+        std::filesystem::create_directories(m_dir);
+
+        // Recover the surviving segments, oldest first
+        std::vector<std::size_t> seqs;
+        for (const auto& entry : std::filesystem::directory_iterator(m_dir))
+        {
+            if (entry.path().extension() != ".seg")
+            {
+                continue;
+            }
+            try
+            {
+                seqs.emplace_back(std::stoull(entry.path().stem().string()));
+            }
+            catch (const std::exception&)
+            {
+                LOG_WARNING("Ignoring unrecognized spill segment: '{}'", entry.path().string());
+            }
+        }
+        std::sort(seqs.begin(), seqs.end());
+
+        for (const auto seq : seqs)
+        {
+            auto segment = mapSegment(seq);
+            const auto [count, end] = scanSegment(segment.map);
+            m_depth.fetch_add(count, std::memory_order_relaxed);
+            m_writeOffset = end; // Only the newest segment's end matters, overwritten each iteration
+            m_segments.emplace_back(segment);
+        }
+
+        if (!m_segments.empty())
+        {
+            m_nextSeq = m_segments.back().seq + 1;
+            if (m_depth.load(std::memory_order_relaxed) > 0)
+            {
+                LOG_INFO("Recovered {} spilled events from '{}'", m_depth.load(std::memory_order_relaxed), dir);
+            }
+        }
+    }
+
+    ~SpillQueue()
+    {
+        std::lock_guard<std::mutex> lock {m_mutex};
+        // Keep the files, pending records are recovered on the next start
+        for (const auto& segment : m_segments)
+        {
+            unmapSegment(segment, false);
+        }
+        m_segments.clear();
+    }
+
+    /**
+     * @brief Appends a message to the spill ring.
+     *
+     * @param message The message to spill.
+     * @return true if the message was spilled, false if it does not fit in a segment or the
+     * ring is at its maximum number of segments.
+     */
+    bool push(const std::string& message)
+    {
+        const auto needed = sizeof(uint32_t) + message.size();
+        if (needed > m_segmentSize)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock {m_mutex};
+        if (m_segments.empty() || m_writeOffset + needed > m_segmentSize)
+        {
+            if (m_segments.size() >= m_maxSegments)
+            {
+                return false;
+            }
+            try
+            {
+                m_segments.emplace_back(mapSegment(m_nextSeq));
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Cannot roll spill segment: {}", e.what());
+                return false;
+            }
+            ++m_nextSeq;
+            m_writeOffset = 0;
+        }
+
+        auto* at = m_segments.back().map + m_writeOffset;
+        std::memcpy(at + sizeof(uint32_t), message.data(), message.size());
+        // The length is written last so a record cut by a crash stays invisible
+        const uint32_t length = static_cast<uint32_t>(message.size());
+        std::memcpy(at, &length, sizeof(length));
+        m_writeOffset += needed;
+        m_depth.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Pops the oldest spilled message, recycling drained segments.
+     *
+     * @param message A reference to store the popped message.
+     * @return true if a message was popped, false if the ring is empty.
+     */
+    bool tryPop(std::string& message)
+    {
+        std::lock_guard<std::mutex> lock {m_mutex};
+        while (!m_segments.empty())
+        {
+            const auto& front = m_segments.front();
+            const bool isNewest = m_segments.size() == 1;
+            if (isNewest && m_readOffset >= m_writeOffset)
+            {
+                return false;
+            }
+
+            const auto length =
+                (m_readOffset + sizeof(uint32_t) <= m_segmentSize) ? readLength(front.map + m_readOffset) : 0;
+            if (length == 0 || m_readOffset + sizeof(uint32_t) + length > m_segmentSize)
+            {
+                if (isNewest)
+                {
+                    return false;
+                }
+                // The oldest segment is drained, recycle it and move to the next one
+                unmapSegment(front, true);
+                m_segments.pop_front();
+                m_readOffset = 0;
+                continue;
+            }
+
+            message.assign(front.map + m_readOffset + sizeof(uint32_t), length);
+            m_readOffset += sizeof(uint32_t) + length;
+            m_depth.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks if the spill ring has no pending records.
+     */
+    bool empty() const { return m_depth.load(std::memory_order_relaxed) == 0; }
+
+    /**
+     * @brief Gets the number of pending records (the spill depth).
+     */
+    std::size_t size() const { return m_depth.load(std::memory_order_relaxed); }
+};
+
+} // namespace base::queue
+
+#endif // _QUEUE_SPILLQUEUE_HPP
@@ -0,0 +1,205 @@
+#ifndef _QUEUE_TWOLANEQUEUE_HPP
+#define _QUEUE_TWOLANEQUEUE_HPP
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <queue/concurrentQueue.hpp>
+#include <queue/iqueue.hpp>
+
+namespace base::queue
+{
+
+constexpr std::size_t HIGH_LANE_CAPACITY = 1024; ///< Default capacity of the high-priority lane
+constexpr std::size_t HIGH_LANE_BURST = 8;  ///< Consecutive high-lane pops before the bulk lane is guaranteed a turn
+constexpr int64_t HIGH_WAIT_SLICE_USEC = 1000; ///< Blocking wait on the high lane before falling back to the bulk lane
+
+/**
+ * @brief A queue with a high-priority lane drained preferentially over the bulk lane.
+ *
+ * High-value traffic (active-response triggers, correlation streams) is pushed through
+ * pushHigh() into a small dedicated lane that consumers drain first, so it keeps low latency
+ * even when the bulk lane is at high watermark. Starvation of the bulk lane is bounded: after
+ * HIGH_LANE_BURST consecutive high-lane pops the bulk lane is guaranteed a turn.
+ *
+ * Flooding, discarding and metrics behave as in the underlying ConcurrentQueue and apply to the
+ * bulk lane; the high lane is small, never floods and blocks when full, so it must only receive
+ * the low-volume streams it exists for.
+ *
+ * @tparam T The type of the data to be stored in the queue.
+ * @tparam D The traits of the underlying moodycamel queues.
+ * @tparam M The metrics policy forwarded to the lanes, see ConcurrentQueue.
+ */
+template<typename T, typename D = moodycamel::ConcurrentQueueDefaultTraits, typename M = ScopedQueueMetrics>
+class TwoLaneQueue : public iQueue<T>
+{
+private:
+    std::shared_ptr<ConcurrentQueue<T, D, M>> m_high; ///< The high-priority lane
+    std::shared_ptr<ConcurrentQueue<T, D, M>> m_bulk; ///< The bulk lane
+    std::atomic_size_t m_highStreak;                  ///< Consecutive pops served from the high lane
+
+    /**
+     * @brief Pops from the high lane unless its burst allowance is exhausted and the bulk lane
+     * has work, which guarantees the bulk lane a turn.
+     */
+    bool popHighBounded(T& element)
+    {
+        if (m_highStreak.load(std::memory_order_relaxed) >= HIGH_LANE_BURST && !m_bulk->empty())
+        {
+            m_highStreak.store(0, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (m_high->tryPop(element))
+        {
+            m_highStreak.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        return false;
+    }
+
+public:
+    /**
+     * @brief Construct a new Two Lane Queue object
+     *
+     * @param capacity The capacity of the bulk lane. (Approximate)
+     * @param metricsScope The metrics scope for the queue, shared by both lanes.
+     * @param metricsScopeDelta The metrics scope for the per-second counters.
+     * @param highCapacity The capacity of the high-priority lane. (Approximate)
+     * @param pathFloodedFile The path to the file where the bulk lane will be flooded.
+     * @param maxAttempts The maximum number of attempts to push an element to the bulk lane.
+     * @param waitTime The time to wait for the bulk lane to be not full (in microseconds).
+     * @param discard If true, the bulk lane will discard the events when it is full.
+     *
+     * @throw std::runtime_error if any of the parameters forwarded to the lanes is invalid.
+     */
+    explicit TwoLaneQueue(const int capacity,
+                          std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                          std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                          const int highCapacity = HIGH_LANE_CAPACITY,
+                          const std::string& pathFloodedFile = {},
+                          const int maxAttempts = -1,
+                          const int waitTime = -1,
+                          const bool discard = false)
+        : m_highStreak {0}
+    {
+        m_high = std::make_shared<ConcurrentQueue<T, D, M>>(highCapacity, metricsScope, metricsScopeDelta);
+        m_bulk = std::make_shared<ConcurrentQueue<T, D, M>>(
+            capacity, metricsScope, metricsScopeDelta, pathFloodedFile, maxAttempts, waitTime, discard);
+    }
+
+    void push(T&& element) override { m_bulk->push(std::move(element)); }
+
+    void pushBulk(std::vector<T>&& elements) override { m_bulk->pushBulk(std::move(elements)); }
+
+    /**
+     * @brief Push an element into the high-priority lane.
+     *
+     * @param element The element to push, it will be moved.
+     */
+    void pushHigh(T&& element) override { m_high->push(std::move(element)); }
+
+    bool tryPush(const T& element) override { return m_bulk->tryPush(element); }
+
+    /**
+     * @brief Waits for and pops an element, draining the high lane preferentially.
+     *
+     * @param element A reference to store the popped element.
+     * @param timeout The maximum time to wait on the bulk lane (in microseconds).
+     * @return true if an element was popped, false if the timeout was reached.
+     */
+    bool waitPop(T& element, int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
+    {
+        if (popHighBounded(element))
+        {
+            return true;
+        }
+
+        if (m_bulk->tryPop(element))
+        {
+            m_highStreak.store(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Both lanes look empty: block briefly on the high lane so critical traffic is seen
+        // first, then on the bulk lane for the rest of the timeout.
+        if (m_high->waitPop(element, HIGH_WAIT_SLICE_USEC))
+        {
+            m_highStreak.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        return m_bulk->waitPop(element, timeout);
+    }
+
+    bool tryPop(T& element) override
+    {
+        if (popHighBounded(element))
+        {
+            return true;
+        }
+
+        if (m_bulk->tryPop(element))
+        {
+            m_highStreak.store(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        return m_high->tryPop(element);
+    }
+
+    /**
+     * @brief Waits for and pops up to maxElements elements, draining the high lane first.
+     *
+     * @param elements Output buffer, it will be cleared and filled with the popped elements.
+     * @param maxElements The maximum number of elements to pop.
+     * @param timeout The maximum time to wait on the bulk lane (in microseconds).
+     * @return The number of elements popped, 0 if the timeout was reached.
+     */
+    size_t waitPopBulk(std::vector<T>& elements,
+                       size_t maxElements,
+                       int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
+    {
+        if (m_highStreak.load(std::memory_order_relaxed) < HIGH_LANE_BURST || m_bulk->empty())
+        {
+            const auto popped = m_high->waitPopBulk(elements, maxElements, 0);
+            if (popped > 0)
+            {
+                m_highStreak.fetch_add(popped, std::memory_order_relaxed);
+                return popped;
+            }
+        }
+        else
+        {
+            m_highStreak.store(0, std::memory_order_relaxed);
+        }
+
+        const auto popped = m_bulk->waitPopBulk(elements, maxElements, 0);
+        if (popped > 0)
+        {
+            m_highStreak.store(0, std::memory_order_relaxed);
+            return popped;
+        }
+
+        if (m_high->waitPopBulk(elements, maxElements, HIGH_WAIT_SLICE_USEC) > 0)
+        {
+            m_highStreak.fetch_add(elements.size(), std::memory_order_relaxed);
+            return elements.size();
+        }
+
+        return m_bulk->waitPopBulk(elements, maxElements, timeout);
+    }
+
+    bool empty() const override { return m_high->empty() && m_bulk->empty(); }
+
+    size_t size() const override { return m_high->size() + m_bulk->size(); }
+
+    size_t aproxFreeSlots() const override { return m_bulk->aproxFreeSlots(); }
+};
+
+} // namespace base::queue
+
+#endif // _QUEUE_TWOLANEQUEUE_HPP
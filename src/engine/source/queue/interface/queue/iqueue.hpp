@@ -1,6 +1,8 @@
 #ifndef _QUEUE_IQUEUE_HPP
 #define _QUEUE_IQUEUE_HPP
 
+#include <vector>
+
 namespace base::queue
 {
 
@@ -28,6 +30,35 @@ public:
      */
     virtual void push(T&& element) = 0;
 
+    /**
+     * @brief Push an element into the high-priority lane of the queue.
+     *
+     * Implementations with priority lanes (see TwoLaneQueue) drain this lane preferentially.
+     * The default implementation falls back to the single lane.
+     *
+     * @param element The element to push into the queue
+     */
+    virtual void pushHigh(T&& element) { push(std::move(element)); }
+
+    /**
+     * @brief Push a batch of elements into the queue.
+     *
+     * Pairs with waitPopBulk on the consumer side to make the whole path batch-oriented.
+     * The default implementation pushes the elements one by one; implementations may
+     * override it to amortize the queue synchronization cost over the batch. The vector
+     * is left empty.
+     *
+     * @param elements The elements to push, they will be moved.
+     */
+    virtual void pushBulk(std::vector<T>&& elements)
+    {
+        for (auto& element : elements)
+        {
+            push(std::move(element));
+        }
+        elements.clear();
+    }
+
     /**
      * @brief Try to push an element into the queue
      *
@@ -52,6 +83,33 @@ public:
      */
     virtual bool tryPop(T& element) = 0;
 
+    /**
+     * @brief Wait for and pop up to maxElements elements from the queue in a single operation.
+     *
+     * Implementations should amortize the synchronization cost across the whole batch. The default
+     * implementation waits for the first element and then drains the queue without blocking.
+     *
+     * @param elements Output buffer, it will be cleared and filled with the popped elements.
+     * @param maxElements The maximum number of elements to pop.
+     * @param timeout The maximum time to wait for the first element (in microseconds).
+     * @return The number of elements popped, 0 if the timeout was reached.
+     */
+    virtual size_t waitPopBulk(std::vector<T>& elements, size_t maxElements, int64_t timeout = 0)
+    {
+        elements.clear();
+        T element {};
+        if (!waitPop(element, timeout))
+        {
+            return 0;
+        }
+        elements.emplace_back(std::move(element));
+        while (elements.size() < maxElements && tryPop(element))
+        {
+            elements.emplace_back(std::move(element));
+        }
+        return elements.size();
+    }
+
     /**
      * @brief Check if the queue is empty.
      *
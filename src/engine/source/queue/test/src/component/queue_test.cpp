@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <queue/concurrentQueue.hpp>
+#include <queue/shardedQueue.hpp>
+#include <queue/twoLaneQueue.hpp>
 
 #include "fakeMetric.hpp" // TODO Remove after implementing metrics mocks
 
@@ -89,21 +91,37 @@ TEST_F(ConcurrentQueueTest, CanPushAndPop)
     ASSERT_EQ(cq.size(), 0);
 }
 
+TEST_F(ConcurrentQueueTest, NullMetricsPolicy)
+{
+    // The no-op policy ignores the scopes, null is fine
+    ConcurrentQueue<std::shared_ptr<Dummy>, moodycamel::ConcurrentQueueDefaultTraits, NullQueueMetrics> cq(
+        2, nullptr, nullptr);
+    ASSERT_TRUE(cq.empty());
+    cq.push(std::make_shared<Dummy>(1));
+    auto d = std::make_shared<Dummy>(0);
+    ASSERT_TRUE(cq.waitPop(d));
+    ASSERT_EQ(d->value, 1);
+    ASSERT_TRUE(cq.empty());
+}
+
 TEST_F(ConcurrentQueueTest, FloodsWhenFull)
 {
     std::string flood_file = "floodfile.txt";
-    // 32 is the size of one block in the queue, for 1 producer and 1 consumer thread
-    // the queue has 1 block, so it will flood after 32 pushes
-    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
-        32, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>(), flood_file, 3, 500);
-
-    for (int i = 0; i < 35; i++)
     {
-        cq.push(std::make_shared<Dummy>(i));
-    }
+        // 32 is the size of one block in the queue, for 1 producer and 1 consumer thread
+        // the queue has 1 block, so it will flood after 32 pushes
+        ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+            32, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>(), flood_file, 3, 500);
 
-    ASSERT_FALSE(cq.empty());
-    ASSERT_EQ(cq.size(), 32);
+        for (int i = 0; i < 35; i++)
+        {
+            cq.push(std::make_shared<Dummy>(i));
+        }
+
+        ASSERT_FALSE(cq.empty());
+        ASSERT_EQ(cq.size(), 32);
+        // Destroying the queue drains the flooding writer thread
+    }
 
     std::ifstream floodfile(flood_file);
     int num_flooded = 0;
@@ -126,3 +144,331 @@ TEST_F(ConcurrentQueueTest, Timeout)
     ASSERT_FALSE(cq.waitPop(d, 0));
     ASSERT_EQ(d->value, 0);
 }
+
+TEST_F(ConcurrentQueueTest, CanPopBulk)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+        64, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+
+    for (int i = 0; i < 10; i++)
+    {
+        cq.push(std::make_shared<Dummy>(i));
+    }
+
+    std::vector<std::shared_ptr<Dummy>> elements {};
+    ASSERT_EQ(cq.waitPopBulk(elements, 64), 10);
+    ASSERT_EQ(elements.size(), 10);
+    ASSERT_TRUE(cq.empty());
+
+    // The batch size is honored even if more elements are available
+    for (int i = 0; i < 10; i++)
+    {
+        cq.push(std::make_shared<Dummy>(i));
+    }
+    ASSERT_EQ(cq.waitPopBulk(elements, 4), 4);
+    ASSERT_EQ(elements.size(), 4);
+    ASSERT_EQ(cq.size(), 6);
+}
+
+TEST_F(ConcurrentQueueTest, PopBulkTimeout)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+        2, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+    std::vector<std::shared_ptr<Dummy>> elements {};
+    ASSERT_EQ(cq.waitPopBulk(elements, 32, 0), 0);
+    ASSERT_TRUE(elements.empty());
+}
+
+class ShardedQueueTest : public ::testing::Test
+{
+protected:
+    void SetUp() override { logging::testInit(); }
+};
+
+TEST_F(ShardedQueueTest, CanConstruct)
+{
+    ShardedQueue<std::shared_ptr<Dummy>> sq(
+        4, 64, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+    ASSERT_TRUE(sq.empty());
+    ASSERT_EQ(sq.size(), 0);
+}
+
+TEST_F(ShardedQueueTest, errorConstructor)
+{
+    ASSERT_THROW(ShardedQueue<std::shared_ptr<Dummy>> sq(
+                     0, 64, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>()),
+                 std::runtime_error);
+    ASSERT_THROW(ShardedQueue<std::shared_ptr<Dummy>> sq(
+                     4, 0, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>()),
+                 std::runtime_error);
+}
+
+TEST_F(ShardedQueueTest, CanPushAndPop)
+{
+    ShardedQueue<std::shared_ptr<Dummy>> sq(
+        4, 64, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+
+    for (int i = 0; i < 10; i++)
+    {
+        sq.push(std::make_shared<Dummy>(i));
+    }
+    ASSERT_EQ(sq.size(), 10);
+
+    // One consumer thread drains all the shards through work stealing
+    int popped = 0;
+    auto d = std::make_shared<Dummy>(0);
+    while (sq.waitPop(d, 0))
+    {
+        popped++;
+    }
+    ASSERT_EQ(popped, 10);
+    ASSERT_TRUE(sq.empty());
+}
+
+TEST_F(ShardedQueueTest, AffinityPreservesOrder)
+{
+    // All the elements share the same key, so they land in the same shard in push order
+    ShardedQueue<std::shared_ptr<Dummy>> sq(
+        4,
+        64,
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        [](const std::shared_ptr<Dummy>&) -> std::size_t { return 42; });
+
+    for (int i = 0; i < 10; i++)
+    {
+        sq.push(std::make_shared<Dummy>(i));
+    }
+
+    auto d = std::make_shared<Dummy>(-1);
+    for (int i = 0; i < 10; i++)
+    {
+        ASSERT_TRUE(sq.waitPop(d, 0));
+        ASSERT_EQ(d->value, i);
+    }
+    ASSERT_TRUE(sq.empty());
+}
+
+TEST_F(ShardedQueueTest, StealsBatches)
+{
+    // Everything lands in one shard, a consumer pinned to another shard must steal the batch
+    ShardedQueue<std::shared_ptr<Dummy>> sq(
+        4,
+        64,
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        [](const std::shared_ptr<Dummy>&) -> std::size_t { return 0; });
+
+    // Pin the main thread to the first shard, where all the elements will land
+    std::vector<std::shared_ptr<Dummy>> elements {};
+    ASSERT_EQ(sq.waitPopBulk(elements, 32, 0), 0);
+
+    for (int i = 0; i < 10; i++)
+    {
+        sq.push(std::make_shared<Dummy>(i));
+    }
+
+    // A consumer pinned to another shard steals the whole batch from the loaded one
+    size_t stolen = 0;
+    std::thread consumer([&]() { stolen = sq.waitPopBulk(elements, 32, 0); });
+    consumer.join();
+    ASSERT_EQ(stolen, 10);
+    ASSERT_EQ(elements.size(), 10);
+    ASSERT_TRUE(sq.empty());
+}
+
+class TwoLaneQueueTest : public ::testing::Test
+{
+protected:
+    void SetUp() override { logging::testInit(); }
+};
+
+TEST_F(TwoLaneQueueTest, HighLaneDrainedFirst)
+{
+    TwoLaneQueue<std::shared_ptr<Dummy>> tq(
+        64, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+
+    for (int i = 0; i < 5; i++)
+    {
+        tq.push(std::make_shared<Dummy>(i));
+    }
+    tq.pushHigh(std::make_shared<Dummy>(100));
+    ASSERT_EQ(tq.size(), 6);
+
+    // The high-lane element jumps ahead of the queued bulk traffic
+    auto d = std::make_shared<Dummy>(0);
+    ASSERT_TRUE(tq.waitPop(d, 0));
+    ASSERT_EQ(d->value, 100);
+
+    for (int i = 0; i < 5; i++)
+    {
+        ASSERT_TRUE(tq.waitPop(d, 0));
+        ASSERT_EQ(d->value, i);
+    }
+    ASSERT_TRUE(tq.empty());
+}
+
+TEST_F(TwoLaneQueueTest, BoundedStarvationOfBulkLane)
+{
+    TwoLaneQueue<std::shared_ptr<Dummy>> tq(
+        64, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+
+    for (size_t i = 0; i < HIGH_LANE_BURST + 1; i++)
+    {
+        tq.pushHigh(std::make_shared<Dummy>(100 + i));
+    }
+    tq.push(std::make_shared<Dummy>(0));
+
+    // After a full burst from the high lane, the bulk lane is guaranteed a turn
+    auto d = std::make_shared<Dummy>(-1);
+    for (size_t i = 0; i < HIGH_LANE_BURST; i++)
+    {
+        ASSERT_TRUE(tq.waitPop(d, 0));
+        ASSERT_EQ(d->value, static_cast<int>(100 + i));
+    }
+    ASSERT_TRUE(tq.waitPop(d, 0));
+    ASSERT_EQ(d->value, 0);
+    ASSERT_TRUE(tq.waitPop(d, 0));
+    ASSERT_EQ(d->value, static_cast<int>(100 + HIGH_LANE_BURST));
+    ASSERT_TRUE(tq.empty());
+}
+
+class SpillQueueTest : public ::testing::Test
+{
+protected:
+    std::filesystem::path m_dir;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        m_dir = std::filesystem::temp_directory_path() / "spill_queue_test";
+        std::filesystem::remove_all(m_dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_dir); }
+};
+
+TEST_F(SpillQueueTest, PushPopRoundtrip)
+{
+    SpillQueue sq(m_dir.string());
+    ASSERT_TRUE(sq.empty());
+
+    for (int i = 0; i < 10; i++)
+    {
+        ASSERT_TRUE(sq.push("message " + std::to_string(i)));
+    }
+    ASSERT_EQ(sq.size(), 10);
+
+    std::string message;
+    for (int i = 0; i < 10; i++)
+    {
+        ASSERT_TRUE(sq.tryPop(message));
+        ASSERT_EQ(message, "message " + std::to_string(i));
+    }
+    ASSERT_TRUE(sq.empty());
+    ASSERT_FALSE(sq.tryPop(message));
+}
+
+TEST_F(SpillQueueTest, RollsAndRecyclesSegments)
+{
+    // Tiny segments force a roll every few records, drained ones are unlinked
+    SpillQueue sq(m_dir.string(), 64, 4);
+
+    for (int i = 0; i < 12; i++)
+    {
+        ASSERT_TRUE(sq.push("0123456789")); // 14 bytes per record, 4 per segment
+    }
+
+    std::string message;
+    for (int i = 0; i < 12; i++)
+    {
+        ASSERT_TRUE(sq.tryPop(message));
+    }
+    ASSERT_TRUE(sq.empty());
+
+    // Only the write segment survives
+    int segments = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(m_dir))
+    {
+        segments += entry.path().extension() == ".seg";
+    }
+    ASSERT_EQ(segments, 1);
+}
+
+TEST_F(SpillQueueTest, BoundedByMaxSegments)
+{
+    SpillQueue sq(m_dir.string(), 64, 2);
+
+    int accepted = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        accepted += sq.push("0123456789");
+    }
+    ASSERT_EQ(accepted, 8); // 4 records per segment, 2 segments
+    ASSERT_FALSE(sq.push("0123456789"));
+}
+
+TEST_F(SpillQueueTest, RecoversAfterReopen)
+{
+    {
+        SpillQueue sq(m_dir.string(), 64, 4);
+        for (int i = 0; i < 6; i++)
+        {
+            ASSERT_TRUE(sq.push("message " + std::to_string(i)));
+        }
+    }
+
+    SpillQueue recovered(m_dir.string(), 64, 4);
+    ASSERT_EQ(recovered.size(), 6);
+
+    std::string message;
+    for (int i = 0; i < 6; i++)
+    {
+        ASSERT_TRUE(recovered.tryPop(message));
+        ASSERT_EQ(message, "message " + std::to_string(i));
+    }
+    ASSERT_TRUE(recovered.empty());
+
+    // New records append after the recovered ones
+    ASSERT_TRUE(recovered.push("later"));
+    ASSERT_TRUE(recovered.tryPop(message));
+    ASSERT_EQ(message, "later");
+}
+
+TEST_F(SpillQueueTest, ConcurrentQueueSpillsAndDrains)
+{
+    auto spill = std::make_shared<SpillQueue>(m_dir.string());
+    auto rehydrate = [](std::string&& raw)
+    {
+        // Dummy::str() is "Dummy: N"
+        return std::make_shared<Dummy>(std::stoi(raw.substr(7)));
+    };
+
+    // 32 is the size of one block in the queue, so it spills after 32 pushes
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(32,
+                                               std::make_shared<FakeMetricScope>(),
+                                               std::make_shared<FakeMetricScope>(),
+                                               std::string {},
+                                               3,
+                                               500,
+                                               false,
+                                               spill,
+                                               rehydrate);
+
+    for (int i = 0; i < 40; i++)
+    {
+        cq.push(std::make_shared<Dummy>(i));
+    }
+    ASSERT_EQ(spill->size(), 8);
+    ASSERT_EQ(cq.size(), 40);
+
+    // The live queue drains first, then the spilled backlog in order
+    auto d = std::make_shared<Dummy>(-1);
+    for (int i = 0; i < 40; i++)
+    {
+        ASSERT_TRUE(cq.waitPop(d, 0));
+        ASSERT_EQ(d->value, i);
+    }
+    ASSERT_TRUE(cq.empty());
+    ASSERT_TRUE(spill->empty());
+}
@@ -14,6 +14,7 @@ namespace detail
 {
 auto constexpr OP_JPATH = "/operation";
 auto constexpr RES_JPATH = "/resource";
+auto constexpr OP_COUNT = 3; ///< Number of Operation values, used to flatten permissions into bit positions
 } // namespace detail
 
 class Permission
@@ -41,6 +42,17 @@ public:
 
     std::string getName() const { return std::string(resToStr(m_resource)) + "." + std::string(opToStr(m_operation)); }
 
+    /**
+     * @brief Bit position of this permission inside a compiled permission bitmap.
+     *
+     * Flattens the (resource, operation) pair so the effective permissions of a role fit in a
+     * single bitmap word.
+     */
+    std::size_t bit() const
+    {
+        return static_cast<std::size_t>(m_resource) * detail::OP_COUNT + static_cast<std::size_t>(m_operation);
+    }
+
     friend inline bool operator==(const Permission& lhs, const Permission& rhs)
     {
         return lhs.m_resource == rhs.m_resource && lhs.m_operation == rhs.m_operation;
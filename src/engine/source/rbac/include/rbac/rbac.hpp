@@ -1,6 +1,7 @@
 #ifndef _RBAC_RBAC_HPP
 #define _RBAC_RBAC_HPP
 
+#include <cstdint>
 #include <map>
 #include <optional>
 #include <stdexcept>
@@ -31,6 +32,7 @@ class RBAC : public IRBAC
 {
 private:
     std::map<std::string, Role> m_roles;
+    std::map<std::string, uint64_t> m_compiled; ///< Permission bitmap per role, derived from m_roles
     // std::unordered_map<std::string, Subject> m_subjects;
 
     std::weak_ptr<store::IStoreInternal> m_store;
@@ -97,6 +99,26 @@ private:
         return std::nullopt;
     }
 
+    /**
+     * @brief Compile the effective permissions of each role into a fixed bitmap.
+     *
+     * Called whenever the roles change. The model in m_roles remains the source of truth; the
+     * bitmaps only exist so the per-call authorization check is a constant-time bit test.
+     */
+    void compileModel()
+    {
+        m_compiled.clear();
+        for (const auto& [roleName, role] : m_roles)
+        {
+            uint64_t bitmap {0};
+            for (const auto& permission : role.getPermissions())
+            {
+                bitmap |= uint64_t {1} << permission.bit();
+            }
+            m_compiled[roleName] = bitmap;
+        }
+    }
+
     void defaultModel()
     {
         auto permissions = std::set<Permission>();
@@ -128,26 +150,18 @@ public:
                 LOG_WARNING("Could not save RBAC model: {}", saveError->message);
             }
         }
+
+        compileModel();
     }
 
     AuthFn getAuthFn(Resource res, Operation op) const override
     {
-        auto permission = Permission(res, op);
+        const auto mask = uint64_t {1} << Permission(res, op).bit();
 
-        return [permission, roles = m_roles](const std::string& roleName)
+        return [mask, compiled = m_compiled](const std::string& roleName)
         {
-            auto role = roles.find(roleName);
-            if (role == roles.end())
-            {
-                return false;
-            }
-
-            if (role->second.getPermissions().find(permission) == role->second.getPermissions().end())
-            {
-                return false;
-            }
-
-            return true;
+            auto role = compiled.find(roleName);
+            return role != compiled.end() && (role->second & mask) != 0;
         };
     }
 
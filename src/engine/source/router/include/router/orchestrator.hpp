@@ -1,13 +1,20 @@
 #ifndef _ROUTER_ORCHESTATOR_HPP
 #define _ROUTER_ORCHESTATOR_HPP
 
+#include <condition_variable>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
 
+#include <base/eventTrace.hpp>
 #include <base/parseEvent.hpp>
 #include <bk/icontroller.hpp>
 #include <builder/ibuilder.hpp>
+#include <metrics/iMetricsScope.hpp>
 #include <queue/iqueue.hpp>
 #include <store/istore.hpp>
 
@@ -53,6 +60,20 @@ protected:
     base::Name m_storeTesterName;                  ///< Path of internal configuration state for testers
     base::Name m_storeRouterName;                  ///< Path of internal configuration state for routers
     std::size_t m_testTimeout;                     ///< Timeout for the tests
+    std::string m_priorityQueueIds;                ///< Queue id chars routed to the high-priority lane
+    std::vector<int> m_workerCores;                ///< Cores the worker threads are pinned to, empty for no pinning
+
+    // Dynamic worker scaling. The first m_runningWorkers workers of m_workers are running, the
+    // rest are parked (initialized but without a thread). m_runningWorkers is written by start()
+    // before the scaler thread exists and by the scaler thread only afterwards.
+    std::size_t m_minWorkers {0};     ///< Workers kept running at all times
+    std::size_t m_maxWorkers {0};     ///< Upper bound of running workers
+    std::size_t m_runningWorkers {0}; ///< Currently running workers
+    IWorker::EpsLimit m_epsLimit;     ///< Limit shared by every started worker
+    std::thread m_scalerThread;       ///< Control loop starting and parking workers
+    std::mutex m_scalerMutex;         ///< Protects m_scalerStop and paces the control loop
+    std::condition_variable m_scalerCv; ///< Wakes the control loop on shutdown
+    bool m_scalerStop {false};          ///< Shutdown flag for the control loop
 
     using WorkerOp = std::function<base::OptError(const std::shared_ptr<IWorker>&)>;
     base::OptError forEachWorker(const WorkerOp& f); ///< Apply the function f to each worker
@@ -77,17 +98,30 @@ protected:
     base::OptError addWorker(std::shared_ptr<IWorker> worker); ///< Add a new worker to the list
     base::OptError removeWorker();                             ///< Remove a worker from the list
 
+    /**
+     * @brief Control loop of the dynamic worker scaling, runs on m_scalerThread.
+     *
+     * Polls the event queue depth: a sustained backlog starts a parked worker (up to
+     * m_maxWorkers), a sustained idle queue parks a running one (down to m_minWorkers).
+     */
+    void scaleLoop();
+
     Orchestrator() = default; ///< Default constructor for testing purposes
 
 public:
-    ~Orchestrator() = default;
+    ~Orchestrator(); ///< Joins the scaler thread if stop() was not called
     /**
      * @brief Configuration for the Orchestrator
      *
      */
     struct Options
     {
-        int m_numThreads; ///< Number of workers to create
+        int m_numThreads; ///< Number of workers to create (kept running at all times)
+
+        /// Upper bound for dynamic worker scaling. 0 keeps the worker count fixed at
+        /// m_numThreads; otherwise a control loop starts and parks workers between
+        /// m_numThreads and this bound following the event queue depth.
+        int m_maxNumThreads {0};
 
         std::weak_ptr<store::IStore> m_wStore;      ///< Store to read namespaces and configurations
         std::weak_ptr<builder::IBuilder> m_builder; ///< Builder use for creating environments
@@ -96,6 +130,15 @@ public:
         std::shared_ptr<ProdQueueType> m_prodQueue;              ///< The event queue
         std::shared_ptr<TestQueueType> m_testQueue;              ///< The test queue
 
+        /// Optional scope for the worker latency histograms, no instrumentation when null
+        std::shared_ptr<metricsManager::IMetricsScope> m_metricsScope {};
+
+        /// Queue id chars whose events go to the high-priority lane, empty to disable
+        std::string m_priorityQueueIds {};
+
+        /// Core set the worker threads are pinned to (e.g. "0-3,8"), empty for no pinning
+        std::string m_workerCoreSet {};
+
         int m_testTimeout; ///< Timeout for handlers of testers
 
         void validate() const; ///< Validate the configuration options if is invalid throw an  std::runtime_error
@@ -118,15 +161,37 @@ public:
     /**
      * @brief Push an event to the event queue
      *
+     * Events whose queue id char (first byte of the raw event) is in the configured priority set
+     * go through the high-priority lane of the queue, see TwoLaneQueue.
+     *
      * @param eventStr The event to push
      */
-    void pushEvent(const std::string& eventStr)
+    void pushEvent(std::string_view eventStr)
     {
+        const bool priority =
+            !eventStr.empty() && m_priorityQueueIds.find(eventStr[0]) != std::string::npos;
         base::Event event;
         try
         {
             event = base::parseEvent::parseWazuhEvent(eventStr);
-            m_eventQueue->push(std::move(event));
+            // Receive stamp for sampled events
+            if (base::eventTrace::enabled() && base::eventTrace::sample())
+            {
+                base::eventTrace::stamp(event);
+            }
+            if (priority)
+            {
+                // Enqueue stamp for sampled events
+                if (base::eventTrace::enabled() && base::eventTrace::isTraced(event))
+                {
+                    base::eventTrace::stamp(event);
+                }
+                m_eventQueue->pushHigh(std::move(event));
+            }
+            else
+            {
+                postEvent(std::move(event));
+            }
         }
         catch (const std::exception& e)
         {
@@ -134,6 +199,59 @@ public:
         }
     }
 
+    /**
+     * @brief Push a batch of raw events to the event queue with a single bulk push.
+     *
+     * Entry point of the batched datagram frames: the endpoint splits the frame and hands the
+     * raw events here, so the queue synchronization cost is paid once per batch instead of
+     * once per event. Priority events keep going through the high-priority lane one by one,
+     * events that fail to parse are logged and discarded without affecting the rest.
+     *
+     * @param rawEvents The raw events of the batch, in order.
+     */
+    void pushEventBatch(const std::vector<std::string_view>& rawEvents)
+    {
+        std::vector<base::Event> batch {};
+        batch.reserve(rawEvents.size());
+
+        for (const auto& eventStr : rawEvents)
+        {
+            const bool priority =
+                !eventStr.empty() && m_priorityQueueIds.find(eventStr[0]) != std::string::npos;
+            try
+            {
+                auto event = base::parseEvent::parseWazuhEvent(eventStr);
+                // Receive stamp for sampled events
+                if (base::eventTrace::enabled() && base::eventTrace::sample())
+                {
+                    base::eventTrace::stamp(event);
+                }
+                // Enqueue stamp for sampled events
+                if (base::eventTrace::enabled() && base::eventTrace::isTraced(event))
+                {
+                    base::eventTrace::stamp(event);
+                }
+                if (priority)
+                {
+                    m_eventQueue->pushHigh(std::move(event));
+                }
+                else
+                {
+                    batch.emplace_back(std::move(event));
+                }
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Error parsing event: '{}' (discarding...)", e.what());
+            }
+        }
+
+        if (!batch.empty())
+        {
+            m_eventQueue->pushBulk(std::move(batch));
+        }
+    }
+
     /**************************************************************************
      * IRouterAPI
      *************************************************************************/
@@ -171,7 +289,15 @@ public:
     /**
      * @copydoc router::IRouterAPI::postEvent
      */
-    void postEvent(base::Event&& event) override { m_eventQueue->push(std::move(event)); }
+    void postEvent(base::Event&& event) override
+    {
+        // Enqueue stamp for sampled events
+        if (base::eventTrace::enabled() && base::eventTrace::isTraced(event))
+        {
+            base::eventTrace::stamp(event);
+        }
+        m_eventQueue->push(std::move(event));
+    }
 
     /**
      * @copydoc router::IRouterAPI::postStrEvent
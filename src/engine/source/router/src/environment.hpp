@@ -5,6 +5,7 @@
 
 #include <base/expression.hpp>
 #include <bk/icontroller.hpp>
+#include <builder/ipolicy.hpp>
 
 #include <router/types.hpp>
 
@@ -18,6 +19,7 @@ private:
     base::Expression m_filter;                     ///< Filter of the route
     std::shared_ptr<bk::IController> m_controller; ///< Controller of the policy
     std::string m_hash;                            ///< Hash of the current policy (controller)
+    std::shared_ptr<builder::IPolicy> m_policy;    ///< Built policy, pins it in the builder cache while in use
 
     /**
      * @brief Stop the controller
@@ -37,11 +39,17 @@ public:
      *
      * @param filter of the route
      * @param controller of the policy
+     * @param hash of the policy
+     * @param policy (Optional) Built policy, held so the builder cache can reuse it while alive
      */
-    Environment(base::Expression&& filter, std::shared_ptr<bk::IController>&& controller, std::string&& hash)
+    Environment(base::Expression&& filter,
+                std::shared_ptr<bk::IController>&& controller,
+                std::string&& hash,
+                std::shared_ptr<builder::IPolicy> policy = nullptr)
         : m_filter {filter}
         , m_controller {controller}
         , m_hash {hash}
+        , m_policy {std::move(policy)}
     {
         if (!m_controller)
         {
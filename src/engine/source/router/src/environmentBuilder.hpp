@@ -1,7 +1,12 @@
 #ifndef _ROUTER_ENVIRONMENT_BUILD_HPP
 #define _ROUTER_ENVIRONMENT_BUILD_HPP
 
+#include <list>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -23,6 +28,103 @@ private:
     std::weak_ptr<builder::IBuilder> m_builder;              ///< The builder used to construct the policy and filter.
     std::shared_ptr<bk::IControllerMaker> m_controllerMaker; ///< The controller maker used to construct the controller.
 
+    /// Number of recently built policies kept alive so a rollback resolves from the cache.
+    static constexpr std::size_t POLICY_RETENTION = 4;
+
+    std::unordered_map<std::string, std::shared_ptr<builder::IPolicy>>
+        m_policyCache;              ///< Policies built during the current build session, by name.
+    std::weak_ptr<void> m_buildSession; ///< Alive while at least one build session token exists.
+    std::mutex m_policyCacheMutex;      ///< Protects the policy caches and the session token.
+
+    /// Content-addressed registry of built policies, alive while any environment or tester
+    /// session still references them.
+    std::unordered_map<std::string, std::weak_ptr<builder::IPolicy>> m_policyByHash;
+    std::list<std::shared_ptr<builder::IPolicy>> m_retainedPolicies; ///< Strong refs to recent builds.
+
+    /**
+     * @brief Keeps a strong reference to the most recently used policies.
+     *
+     * Must be called with the cache mutex held. The retention window keeps the previous policy
+     * version alive after a rebuild, so rolling the catalog back to it is a cache hit instead of
+     * a full rebuild.
+     */
+    void retainPolicy(const std::shared_ptr<builder::IPolicy>& policy)
+    {
+        m_retainedPolicies.remove(policy);
+        m_retainedPolicies.push_front(policy);
+        if (m_retainedPolicies.size() > POLICY_RETENTION)
+        {
+            m_retainedPolicies.pop_back();
+        }
+    }
+
+    /**
+     * @brief Build a policy, reusing a previously built one when the content is unchanged.
+     *
+     * During a build session the policy built earlier in the session is reused by name. Outside
+     * the session path, the content hash is read from the stored policy document (cheap compared
+     * to a build) and resolved against the content-addressed registry, so building the same
+     * policy content for another entry, a tester session or a rollback reuses the immutable
+     * built policy instead of rebuilding its expression graph.
+     *
+     * @param policyName The name of the policy.
+     * @param builder The builder used to construct the policy.
+     * @return std::shared_ptr<builder::IPolicy> The built policy.
+     */
+    std::shared_ptr<builder::IPolicy> buildPolicy(const base::Name& policyName,
+                                                  const std::shared_ptr<builder::IBuilder>& builder)
+    {
+        {
+            std::lock_guard lock {m_policyCacheMutex};
+            if (!m_buildSession.expired())
+            {
+                auto it = m_policyCache.find(policyName.toStr());
+                if (it != m_policyCache.end())
+                {
+                    return it->second;
+                }
+            }
+        }
+
+        const auto hash = builder->getPolicyHash(policyName);
+        if (!hash.empty())
+        {
+            std::lock_guard lock {m_policyCacheMutex};
+            auto it = m_policyByHash.find(hash);
+            if (it != m_policyByHash.end())
+            {
+                auto cached = it->second.lock();
+                if (cached != nullptr && cached->name() == policyName)
+                {
+                    retainPolicy(cached);
+                    if (!m_buildSession.expired())
+                    {
+                        m_policyCache.emplace(policyName.toStr(), cached);
+                    }
+                    return cached;
+                }
+            }
+        }
+
+        auto policy = builder->buildPolicy(policyName);
+
+        {
+            std::lock_guard lock {m_policyCacheMutex};
+            // Drop registry entries whose last consumer is gone
+            for (auto it = m_policyByHash.begin(); it != m_policyByHash.end();)
+            {
+                it = it->second.expired() ? m_policyByHash.erase(it) : std::next(it);
+            }
+            m_policyByHash[policy->hash()] = policy;
+            retainPolicy(policy);
+            if (!m_buildSession.expired())
+            {
+                m_policyCache.emplace(policyName.toStr(), policy);
+            }
+        }
+        return policy;
+    }
+
     /**
      * @brief Get the Expression object for a given filter.
      *
@@ -69,16 +171,47 @@ public:
 
     EnvironmentBuilder() = delete;
 
+    /**
+     * @brief Start a build session during which built policies are reused.
+     *
+     * While the returned token (or a copy of it) is alive, makeController and create memoize the
+     * policies they build, keyed by policy name, so fanning the same entry out to every worker
+     * builds the policy once instead of once per worker. The cache is dropped together with the
+     * last token, so builds outside a session always observe the current catalog content.
+     *
+     * @return std::shared_ptr<void> Token keeping the session (and its cache) alive.
+     */
+    std::shared_ptr<void> startBuildSession()
+    {
+        std::lock_guard lock {m_policyCacheMutex};
+        auto session = m_buildSession.lock();
+        if (session == nullptr)
+        {
+            session = std::shared_ptr<void>(nullptr,
+                                            [this](void*)
+                                            {
+                                                std::lock_guard lock {m_policyCacheMutex};
+                                                m_policyCache.clear();
+                                            });
+            m_buildSession = session;
+        }
+        return session;
+    }
+
     /**
      * @brief Get the Controller object for a given policy.
      *
      * @param policyName The name of the policy.
-     * @param builder The builder used to construct the policy.
-     * @return std::shared_ptr<bk::IController> The constructed controller.
+     * @param withTraces Whether the controller is built with every asset traceable. Tester
+     * sessions need the traces, production controllers are built traceless so the backend emits
+     * plain term callables with no trace hook per event.
+     * @return The constructed controller, the policy hash and the built policy. Holding the
+     * policy pins it in the content-addressed cache while the consumer uses it.
      * @throws std::runtime_error if the policy has no assets or if the backend cannot be built. // TODO Move to
      * base::Error
      */
-    auto makeController(const base::Name& policyName) -> std::pair<std::shared_ptr<bk::IController>, std::string>
+    auto makeController(const base::Name& policyName, bool withTraces = true)
+        -> std::tuple<std::shared_ptr<bk::IController>, std::string, std::shared_ptr<builder::IPolicy>>
     {
         if (policyName.parts().size() == 0 || policyName.parts()[0] != "policy")
         {
@@ -91,20 +224,23 @@ public:
             throw std::runtime_error {"The builder is not available"};
         }
 
-        auto policy = builder->buildPolicy(policyName);
+        auto policy = buildPolicy(policyName, builder);
         if (policy->assets().empty())
         {
             throw std::runtime_error {fmt::format("Policy '{}' has no assets", policyName)};
         }
 
         std::unordered_set<std::string> assetNames;
-        std::transform(policy->assets().begin(),
-                       policy->assets().end(),
-                       std::inserter(assetNames, assetNames.begin()),
-                       [](const auto& name) { return name.toStr(); });
+        if (withTraces)
+        {
+            std::transform(policy->assets().begin(),
+                           policy->assets().end(),
+                           std::inserter(assetNames, assetNames.begin()),
+                           [](const auto& name) { return name.toStr(); });
+        }
 
         auto controller = m_controllerMaker->create(policy->expression(), assetNames);
-        return {controller, policy->hash()};
+        return {controller, policy->hash(), policy};
     }
 
     /**
@@ -121,9 +257,12 @@ public:
         try
         {
             std::string hash {};
-            std::tie(controller, hash) = makeController(policyName);
+            std::shared_ptr<builder::IPolicy> policy {};
+            // Production environments never subscribe to traces, build the controller traceless
+            std::tie(controller, hash, policy) = makeController(policyName, false);
             auto expression = getExpression(filterName);
-            return std::make_unique<Environment>(std::move(expression), std::move(controller), std::move(hash));
+            return std::make_unique<Environment>(
+                std::move(expression), std::move(controller), std::move(hash), std::move(policy));
         }
         catch (const std::runtime_error& e)
         {
@@ -1,8 +1,12 @@
 #ifndef _ROUTER_EPS_COUNTER_HPP
 #define _ROUTER_EPS_COUNTER_HPP
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <thread>
+
+#include <base/utils/coarseClock.hpp>
 
 namespace router
 {
@@ -10,6 +14,10 @@ constexpr auto DEFAULT_EPS = 1000;
 constexpr auto DEFAULT_INTERVAL = 10;
 constexpr auto DEFAULT_STATE = false;
 
+constexpr std::size_t EPS_SHARDS = 16;    ///< Number of per-worker counter shards
+constexpr uint EPS_PUBLISH_STRIDE = 32;   ///< Local increments per publish to the shared counter
+constexpr uint EPS_EXACT_LIMIT = EPS_SHARDS * EPS_PUBLISH_STRIDE * 4; ///< Below this limit accounting stays exact
+
 /**
  * @brief Class to count events per second and reset the counter after a given interval
  *
@@ -17,6 +25,15 @@ constexpr auto DEFAULT_STATE = false;
 class Orchestrator::EpsCounter
 {
 private:
+    /**
+     * @brief Cache-line padded per-worker counter shard.
+     */
+    struct alignas(64) Shard
+    {
+        std::atomic_uint count {0}; ///< Events counted by this shard in the current window
+    };
+
+    std::array<Shard, EPS_SHARDS> m_shards; ///< Per-worker shards, indexed by thread id hash
     std::atomic_uint m_count;     ///< Counter for the number of events
     std::atomic_bool m_canReset;  ///< Flag to ensure only one thread resets the counter
     std::atomic_uint m_limit;     ///< Limit for the number of events per interval
@@ -67,14 +84,36 @@ public:
 
     bool limitReached()
     {
-        // Preemptively check the limit, only then check and reset the counter
-        auto current = m_count.fetch_add(1, std::memory_order_relaxed);
-        if (++current <= m_limit.load(std::memory_order_relaxed))
+        const auto limit = m_limit.load(std::memory_order_relaxed);
+        uint current;
+        if (limit < EPS_EXACT_LIMIT)
+        {
+            // Small limits need exact accounting, pay the shared fetch_add
+            current = m_count.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+        else
+        {
+            // Sharded accounting: each worker bumps its own cache line and publishes to the
+            // shared counter once per stride, so the shared line is touched 1/stride of the
+            // time. The count error is bounded by EPS_SHARDS * EPS_PUBLISH_STRIDE, which is
+            // negligible against limits this large.
+            static thread_local const auto shardIdx =
+                std::hash<std::thread::id> {}(std::this_thread::get_id()) % EPS_SHARDS;
+            const auto local = m_shards[shardIdx].count.fetch_add(1, std::memory_order_relaxed) + 1;
+            if (0 == local % EPS_PUBLISH_STRIDE)
+            {
+                m_count.fetch_add(EPS_PUBLISH_STRIDE, std::memory_order_relaxed);
+            }
+            current = m_count.load(std::memory_order_relaxed) + (local % EPS_PUBLISH_STRIDE);
+        }
+
+        if (current <= limit)
         {
             return false;
         }
 
-        auto now = std::chrono::steady_clock::now();
+        // Coarse cached read: window sizes are in seconds, one tick of staleness is harmless
+        auto now = base::utils::time::CoarseClock::instance().steadyNow();
         auto especulativeElapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastReset).count();
 
         if (especulativeElapsedTime >= m_interval.load(std::memory_order_relaxed))
@@ -88,6 +127,10 @@ public:
                 {
                     m_lastReset = now;
                     m_count.store(0, std::memory_order_relaxed);
+                    for (auto& shard : m_shards)
+                    {
+                        shard.count.store(0, std::memory_order_relaxed);
+                    }
                 }
 
                 m_canReset.store(true, std::memory_order_release);
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <string_view>
@@ -5,6 +8,9 @@
 
 #include <base/json.hpp>
 #include <base/logging.hpp>
+#include <base/utils/threadAffinity.hpp>
+#include <queue/concurrentQueue.hpp>
+#include <queue/shardedQueue.hpp>
 
 #include <router/orchestrator.hpp>
 
@@ -17,6 +23,53 @@ namespace router
 
 namespace
 {
+constexpr auto SCALER_POLL_PERIOD = std::chrono::seconds(1); ///< Queue depth sampling period
+
+/// Consecutive busy polls before starting a parked worker, so short bursts the running workers
+/// absorb by themselves do not scale up
+constexpr std::size_t SCALER_UP_POLLS = 3;
+
+/// Consecutive idle polls before parking a worker, long enough to ride out the valleys between
+/// bursts and avoid start/park flapping
+constexpr std::size_t SCALER_DOWN_POLLS = 30;
+
+/// Queued events per running worker above which a poll counts as busy, a few batches of backlog
+constexpr std::size_t SCALER_BUSY_DEPTH_PER_WORKER = 4 * WORKER_BULK_SIZE;
+
+/**
+ * @brief Creates a worker bound to the concrete queue types when they match the production ones.
+ *
+ * Binding the worker template to the concrete types lets the compiler inline the queue operations
+ * into the hot loop instead of dispatching them virtually per batch. Queues of any other type,
+ * such as the mocks used by the tests, fall back to the interface-bound worker.
+ */
+std::shared_ptr<IWorker> makeWorker(const std::shared_ptr<EnvironmentBuilder>& envBuilder,
+                                    const std::shared_ptr<ProdQueueType>& eventQueue,
+                                    const std::shared_ptr<TestQueueType>& testQueue,
+                                    const std::shared_ptr<metricsManager::IMetricsScope>& metricsScope,
+                                    const std::vector<int>& coreSet)
+{
+    using ProdConcurrent = base::queue::ConcurrentQueue<base::Event, base::queue::EventQueueTraits>;
+    using ProdSharded = base::queue::ShardedQueue<base::Event, base::queue::EventQueueTraits>;
+    using TestConcurrent = base::queue::ConcurrentQueue<test::QueueType>;
+
+    if (auto tQueue = std::dynamic_pointer_cast<TestConcurrent>(testQueue))
+    {
+        if (auto rQueue = std::dynamic_pointer_cast<ProdSharded>(eventQueue))
+        {
+            return std::make_shared<Worker<ProdSharded, TestConcurrent>>(
+                envBuilder, rQueue, tQueue, metricsScope, coreSet);
+        }
+        if (auto rQueue = std::dynamic_pointer_cast<ProdConcurrent>(eventQueue))
+        {
+            return std::make_shared<Worker<ProdConcurrent, TestConcurrent>>(
+                envBuilder, rQueue, tQueue, metricsScope, coreSet);
+        }
+    }
+
+    return std::make_shared<Worker<>>(envBuilder, eventQueue, testQueue, metricsScope, coreSet);
+}
+
 /**
  * @brief Validates that the pointer is not empty
  */
@@ -74,6 +127,11 @@ inline std::vector<base::Event> createEventsFromBatch(const std::list<std::strin
                 continue;
             }
             event->merge(true, agentInfo);
+            // Receive stamp for sampled events
+            if (base::eventTrace::enabled() && base::eventTrace::sample())
+            {
+                base::eventTrace::stamp(event);
+            }
             events.emplace_back(event);
         }
         catch (const std::exception& e)
@@ -266,6 +324,11 @@ void Orchestrator::Options::validate() const
     {
         throw std::runtime_error {"Configuration error: numThreads must be between 1 and 128"};
     }
+    if (m_maxNumThreads != 0 && (m_maxNumThreads < m_numThreads || m_maxNumThreads > 128))
+    {
+        throw std::runtime_error {"Configuration error: maxNumThreads must be between numThreads and 128, or 0 to "
+                                  "disable dynamic scaling"};
+    }
     validatePointer(m_wStore, "store");
     validatePointer(m_builder, "builder");
     validatePointer(m_controllerMaker, "controllerMaker");
@@ -315,6 +378,8 @@ Orchestrator::Orchestrator(const Options& opt)
 
     m_envBuilder = std::make_shared<EnvironmentBuilder>(opt.m_builder, opt.m_controllerMaker);
     m_testTimeout = opt.m_testTimeout;
+    m_priorityQueueIds = opt.m_priorityQueueIds;
+    m_workerCores = base::utils::affinity::parseCoreSet(opt.m_workerCoreSet);
     m_wStore = opt.m_wStore;
 
     // Get the initial states from the store
@@ -327,10 +392,15 @@ Orchestrator::Orchestrator(const Options& opt)
     auto routerEntries = getEntriesFromStore(store, m_storeRouterName);
     auto testerEntries = getEntriesFromStore(store, m_storeTesterName);
 
-    // Create the workers
-    for (std::size_t i = 0; i < opt.m_numThreads; ++i)
+    // Create the workers, sharing the policy builds between them. The workers above the minimum
+    // are created too so the scaler can start them without rebuilding environments, they stay
+    // parked (no thread) until the queue depth demands them.
+    m_minWorkers = opt.m_numThreads;
+    m_maxWorkers = std::max<std::size_t>(m_minWorkers, opt.m_maxNumThreads);
+    auto buildSession = m_envBuilder->startBuildSession();
+    for (std::size_t i = 0; i < m_maxWorkers; ++i)
     {
-        auto worker = std::make_shared<Worker>(m_envBuilder, m_eventQueue, m_testQueue);
+        auto worker = makeWorker(m_envBuilder, m_eventQueue, m_testQueue, opt.m_metricsScope, m_workerCores);
         auto error = initWorker(worker, routerEntries, testerEntries);
         if (error)
         {
@@ -346,7 +416,7 @@ Orchestrator::Orchestrator(const Options& opt)
 void Orchestrator::start()
 {
     std::shared_lock lock {m_syncMutex};
-    IWorker::EpsLimit epsLimit = [epsCounter = m_epsCounter]() -> bool
+    m_epsLimit = [epsCounter = m_epsCounter]() -> bool
     {
         if (epsCounter->isActive())
         {
@@ -355,14 +425,38 @@ void Orchestrator::start()
         return false;
     };
 
+    std::size_t started = 0;
     for (const auto& worker : m_workers)
     {
-        worker->start(epsLimit);
+        if (started == m_minWorkers)
+        {
+            break;
+        }
+        worker->start(m_epsLimit);
+        ++started;
+    }
+    m_runningWorkers = started;
+
+    if (m_maxWorkers > m_minWorkers)
+    {
+        m_scalerStop = false;
+        m_scalerThread = std::thread([this]() { scaleLoop(); });
     }
 }
 
 void Orchestrator::stop()
 {
+    // Stop the scaler first so the running worker set stays stable
+    {
+        std::lock_guard scalerLock {m_scalerMutex};
+        m_scalerStop = true;
+    }
+    m_scalerCv.notify_all();
+    if (m_scalerThread.joinable())
+    {
+        m_scalerThread.join();
+    }
+
     std::shared_lock lock {m_syncMutex};
     dumpTesters(); // TODO: For save the last used time
     for (const auto& worker : m_workers)
@@ -371,6 +465,67 @@ void Orchestrator::stop()
     }
 }
 
+Orchestrator::~Orchestrator()
+{
+    {
+        std::lock_guard scalerLock {m_scalerMutex};
+        m_scalerStop = true;
+    }
+    m_scalerCv.notify_all();
+    if (m_scalerThread.joinable())
+    {
+        m_scalerThread.join();
+    }
+}
+
+void Orchestrator::scaleLoop()
+{
+    std::size_t busyPolls = 0;
+    std::size_t idlePolls = 0;
+
+    std::unique_lock lock {m_scalerMutex};
+    while (!m_scalerCv.wait_for(lock, SCALER_POLL_PERIOD, [this]() { return m_scalerStop; }))
+    {
+        const auto depth = m_eventQueue->size();
+        if (depth >= SCALER_BUSY_DEPTH_PER_WORKER * m_runningWorkers)
+        {
+            ++busyPolls;
+            idlePolls = 0;
+        }
+        else if (depth < WORKER_BULK_SIZE)
+        {
+            ++idlePolls;
+            busyPolls = 0;
+        }
+        else
+        {
+            busyPolls = 0;
+            idlePolls = 0;
+        }
+
+        if (busyPolls >= SCALER_UP_POLLS && m_runningWorkers < m_maxWorkers)
+        {
+            std::shared_lock sync {m_syncMutex};
+            (*std::next(m_workers.begin(), m_runningWorkers))->start(m_epsLimit);
+            ++m_runningWorkers;
+            busyPolls = 0;
+            LOG_INFO("Router: sustained queue backlog, started a worker ({} of {} running)",
+                     m_runningWorkers,
+                     m_maxWorkers);
+        }
+        else if (idlePolls >= SCALER_DOWN_POLLS && m_runningWorkers > m_minWorkers)
+        {
+            std::shared_lock sync {m_syncMutex};
+            (*std::next(m_workers.begin(), m_runningWorkers - 1))->stop();
+            --m_runningWorkers;
+            idlePolls = 0;
+            LOG_INFO("Router: sustained idle queue, parked a worker ({} of {} running)",
+                     m_runningWorkers,
+                     m_maxWorkers);
+        }
+    }
+}
+
 /**************************************************************************
  * IRouterAPI
  *************************************************************************/
@@ -382,6 +537,7 @@ base::OptError Orchestrator::postEntry(const prod::EntryPost& entry)
     }
 
     std::unique_lock lock {m_syncMutex};
+    auto buildSession = m_envBuilder->startBuildSession();
     auto error = forEachWorker([&entry](const auto& worker) { return worker->getRouter()->addEntry(entry); });
 
     if (error)
@@ -434,6 +590,7 @@ base::OptError Orchestrator::reloadEntry(const std::string& name)
     }
 
     std::unique_lock lock {m_syncMutex};
+    auto buildSession = m_envBuilder->startBuildSession();
     auto err = forEachWorker([&name](const auto& worker) { return worker->getRouter()->rebuildEntry(name); });
     if (err)
     {
@@ -478,6 +635,11 @@ base::OptError Orchestrator::postStrEvent(std::string_view event)
     try
     {
         base::Event ev = base::parseEvent::parseWazuhEvent(event.data());
+        // Receive stamp for sampled events
+        if (base::eventTrace::enabled() && base::eventTrace::sample())
+        {
+            base::eventTrace::stamp(ev);
+        }
         this->postEvent(std::move(ev));
     }
     catch (const std::exception& e)
@@ -545,6 +707,11 @@ void Orchestrator::postRawNdjson(std::string&& batch)
     std::vector<base::Event> events = createEventsFromBatch(rawJson, freeSlots);
     for (const auto& event : events)
     {
+        // Enqueue stamp for sampled events
+        if (base::eventTrace::enabled() && base::eventTrace::isTraced(event))
+        {
+            base::eventTrace::stamp(event);
+        }
         if (!m_eventQueue->tryPush(event))
         {
             LOG_DEBUG("Router: Event queue is full, discarding event");
@@ -610,6 +777,7 @@ base::OptError Orchestrator::postTestEntry(const test::EntryPost& entry)
     }
 
     std::unique_lock lock {m_syncMutex};
+    auto buildSession = m_envBuilder->startBuildSession();
     auto error = forEachWorker([&entry](const auto& worker) { return worker->getTester()->addEntry(entry); });
     if (error)
     {
@@ -662,6 +830,7 @@ base::OptError Orchestrator::reloadTestEntry(const std::string& name)
     }
 
     std::unique_lock lock {m_syncMutex};
+    auto buildSession = m_envBuilder->startBuildSession();
     auto error = forEachWorker([&name](const auto& worker) { return worker->getTester()->rebuildEntry(name); });
     if (error)
     {
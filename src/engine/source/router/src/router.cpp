@@ -55,6 +55,7 @@ base::OptError Router::addEntry(const prod::EntryPost& entryPost, bool ignoreFai
             return base::Error {"The priority of the route  is already in use"};
         }
         m_table.insert(entryPost.name(), entryPost.priority(), std::move(entry));
+        publishSnapshot();
     }
 
     return std::nullopt;
@@ -69,30 +70,55 @@ base::OptError Router::removeEntry(const std::string& name)
         return base::Error {"The route not exist"};
     }
     m_table.erase(name);
+    publishSnapshot();
     return std::nullopt;
 }
 
 base::OptError Router::rebuildEntry(const std::string& name)
 {
-    std::unique_lock lock {m_mutex};
-    if (!m_table.nameExists(name))
+    // Snapshot the policy and filter of the entry, the build happens without holding the lock
+    base::Name policy;
+    base::Name filter;
     {
-        return base::Error {"The route not exist"};
+        std::shared_lock lock {m_mutex};
+        if (!m_table.nameExists(name))
+        {
+            return base::Error {"The route not exist"};
+        }
+        const auto& entry = m_table.get(name);
+        policy = entry.policy();
+        filter = entry.filter();
     }
-    auto& entry = m_table.get(name);
+
+    // Build the new environment off the table lock, so ingestion keeps draining with the old one
+    std::shared_ptr<Environment> newEnv;
     try
     {
-        auto uniqueEnv = m_envBuilder->create(entry.policy(), entry.filter());
-        entry.environment() = std::move(uniqueEnv);
-        entry.lastUpdate(getStartTime());
-        entry.hash(entry.environment()->hash());
-        // Mantaing the status of the environment
+        newEnv = m_envBuilder->create(policy, filter);
     }
     catch (const std::exception& e)
     {
         return base::Error {fmt::format("Failed to reload the route: {}", e.what())};
     }
 
+    // Publish the new environment with a snapshot swap, the old one is retired once the last
+    // in-flight event drops its snapshot reference
+    std::shared_ptr<Environment> oldEnv;
+    {
+        std::unique_lock lock {m_mutex};
+        if (!m_table.nameExists(name))
+        {
+            return base::Error {"The route was removed while rebuilding"};
+        }
+        auto& entry = m_table.get(name);
+        oldEnv = std::move(entry.environment());
+        entry.environment() = std::move(newEnv);
+        entry.lastUpdate(getStartTime());
+        entry.hash(entry.environment()->hash());
+        // Mantaing the status of the environment
+        publishSnapshot();
+    }
+
     return std::nullopt;
 }
 
@@ -110,6 +136,7 @@ base::OptError Router::enableEntry(const std::string& name)
     }
     entry.status(env::State::ENABLED);
     entry.lastUpdate(getStartTime());
+    publishSnapshot();
     return {};
 }
 
@@ -140,6 +167,7 @@ base::OptError Router::changePriority(const std::string& name, size_t priority)
     }
     // Sync the priority
     m_table.get(name).priority(priority);
+    publishSnapshot();
 
     return {};
 }
@@ -168,13 +196,15 @@ base::RespOrError<prod::Entry> Router::getEntry(const std::string& name) const
 
 void Router::ingest(base::Event&& event)
 {
-    std::shared_lock lock {m_mutex};
+    // Wait-free route resolution: the snapshot already holds only the enabled environments in
+    // priority order, and keeps them alive while this event is in flight
+    const auto snapshot = std::atomic_load(&m_snapshot);
 
-    for (const auto& entry : m_table)
+    for (const auto& environment : *snapshot)
     {
-        if (entry.status() == env::State::ENABLED && entry.environment()->isAccepted(event))
+        if (environment->isAccepted(event))
         {
-            entry.environment()->ingest(std::move(event));
+            environment->ingest(std::move(event));
             event = nullptr;
             break;
         }
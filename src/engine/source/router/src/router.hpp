@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <shared_mutex>
+#include <vector>
 
 #include <builder/ibuilder.hpp>
 
@@ -21,21 +22,48 @@ private:
     class RuntimeEntry : public prod::Entry
     {
     private:
-        std::unique_ptr<Environment> m_env; ///< The environment associated with the entry.
+        std::shared_ptr<Environment> m_env; ///< The environment associated with the entry.
 
     public:
         explicit RuntimeEntry(const prod::EntryPost& entry)
             : prod::Entry(entry) {};
 
-        const std::unique_ptr<Environment>& environment() const { return m_env; }
-        std::unique_ptr<Environment>& environment() { return m_env; }
+        const std::shared_ptr<Environment>& environment() const { return m_env; }
+        std::shared_ptr<Environment>& environment() { return m_env; }
     };
 
+    /// Flat priority array of the enabled environments, precompiled from the table
+    using Snapshot = std::vector<std::shared_ptr<Environment>>;
+
     internal::Table<RuntimeEntry> m_table; ///< Internal table for managing Production Environments.
-    mutable std::shared_mutex m_mutex;     ///< Mutex for the table.
+    mutable std::shared_mutex m_mutex;     ///< Mutex for the table (configuration path only).
+
+    /// Current snapshot of the table for the ingest path, accessed with std::atomic_load/store.
+    /// The shared ownership keeps retired environments alive until the last in-flight event drops them.
+    std::shared_ptr<const Snapshot> m_snapshot;
 
     std::shared_ptr<EnvironmentBuilder> m_envBuilder; ///< Environment builder for create new entries
 
+    /**
+     * @brief Recompiles and atomically publishes the snapshot of the table.
+     *
+     * Must be called with the table lock held after every mutation. The enabled environments are
+     * laid out in priority order, so the ingest path resolves routes without taking the lock.
+     */
+    void publishSnapshot()
+    {
+        auto snapshot = std::make_shared<Snapshot>();
+        snapshot->reserve(m_table.size());
+        for (const auto& entry : m_table)
+        {
+            if (entry.status() == env::State::ENABLED && entry.environment() != nullptr)
+            {
+                snapshot->emplace_back(entry.environment());
+            }
+        }
+        std::atomic_store(&m_snapshot, std::shared_ptr<const Snapshot> {std::move(snapshot)});
+    }
+
 public:
     /**
      * @brief Constructs a Router with the specified environment builder.
@@ -44,6 +72,7 @@ public:
     Router(const std::shared_ptr<EnvironmentBuilder>& envBuilder)
         : m_table()
         , m_mutex()
+        , m_snapshot(std::make_shared<const Snapshot>())
         , m_envBuilder(envBuilder) {};
 
     /**
@@ -53,6 +82,7 @@ public:
     Router(const std::weak_ptr<builder::IBuilder>& builder, std::shared_ptr<bk::IControllerMaker> controllerMaker)
         : m_table()
         , m_mutex()
+        , m_snapshot(std::make_shared<const Snapshot>())
         , m_envBuilder(std::make_shared<EnvironmentBuilder>(builder, controllerMaker)) {};
 
     /**
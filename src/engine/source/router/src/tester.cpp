@@ -69,9 +69,10 @@ base::OptError Tester::addEntry(const test::EntryPost& entryPost, bool ignoreFai
     auto entry = RuntimeEntry(entryPost);
     try
     {
-        auto [controller, hash] = m_envBuilder->makeController(entry.policy());
+        auto [controller, hash, policy] = m_envBuilder->makeController(entry.policy());
         entry.controller() = controller;
         entry.hash(hash);
+        entry.builtPolicy() = policy;
     }
     catch (const std::exception& e)
     {
@@ -122,9 +123,10 @@ base::OptError Tester::rebuildEntry(const std::string& name)
     auto& entry = it->second;
     try
     {
-        auto [controller, hash] = m_envBuilder->makeController(entry.policy());
+        auto [controller, hash, policy] = m_envBuilder->makeController(entry.policy());
         entry.controller() = controller;
         entry.hash(hash);
+        entry.builtPolicy() = policy;
     }
     catch (const std::exception& e)
     {
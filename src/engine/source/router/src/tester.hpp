@@ -25,7 +25,8 @@ private:
     class RuntimeEntry : public test::Entry
     {
     private:
-        std::shared_ptr<bk::IController> m_controller; ///< Controller of the policy to be tested.
+        std::shared_ptr<bk::IController> m_controller;   ///< Controller of the policy to be tested.
+        std::shared_ptr<builder::IPolicy> m_builtPolicy; ///< Built policy, pins it in the builder cache.
 
     public:
         explicit RuntimeEntry(const test::EntryPost& entry)
@@ -43,8 +44,10 @@ private:
         RuntimeEntry(RuntimeEntry&& other) noexcept
             : test::Entry(std::move(other))
             , m_controller(std::move(other.m_controller))
+            , m_builtPolicy(std::move(other.m_builtPolicy))
         {
             other.m_controller = nullptr;
+            other.m_builtPolicy = nullptr;
         };
 
         // Move assignment
@@ -54,13 +57,18 @@ private:
             {
                 test::Entry::operator=(std::move(other));
                 m_controller = std::move(other.m_controller);
+                m_builtPolicy = std::move(other.m_builtPolicy);
                 other.m_controller = nullptr;
+                other.m_builtPolicy = nullptr;
             }
             return *this;
         }
 
         const std::shared_ptr<bk::IController>& controller() const { return m_controller; }
         std::shared_ptr<bk::IController>& controller() { return m_controller; }
+
+        const std::shared_ptr<builder::IPolicy>& builtPolicy() const { return m_builtPolicy; }
+        std::shared_ptr<builder::IPolicy>& builtPolicy() { return m_builtPolicy; }
     };
 
     std::shared_ptr<bk::IController> createController(const base::Name& policy);
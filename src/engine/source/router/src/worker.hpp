@@ -1,10 +1,18 @@
 #ifndef ROUTER_WORKER_HPP
 #define ROUTER_WORKER_HPP
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <thread>
+#include <type_traits>
+#include <vector>
 
+#include <base/eventTrace.hpp>
+#include <base/logging.hpp>
+#include <base/utils/threadAffinity.hpp>
+#include <metrics/iMetricsScope.hpp>
 #include <queue/iqueue.hpp>
 
 #include <router/types.hpp>
@@ -18,30 +26,70 @@ namespace router
 {
 
 constexpr auto WAIT_DEQUEUE_TIMEOUT_USEC = 1 * 100000;
+constexpr std::size_t WORKER_BULK_SIZE = 128; ///< Maximum events dequeued per batch by a worker
 
+/**
+ * @brief Worker that consumes the router and tester queues and processes their events.
+ *
+ * Templated on the concrete queue types so the queue operations of the hot loop are resolved at
+ * compile time and can be inlined. The defaults keep the worker bound to the queue interfaces,
+ * for tests and for queue types the router does not know about.
+ *
+ * @tparam ProdQueue The concrete type of the router queue.
+ * @tparam TestQueue The concrete type of the tester queue.
+ */
+template<typename ProdQueue = base::queue::iQueue<base::Event>,
+         typename TestQueue = base::queue::iQueue<test::QueueType>>
 class Worker : public IWorker
 {
+    static_assert(std::is_base_of_v<base::queue::iQueue<base::Event>, ProdQueue>,
+                  "ProdQueue must implement iQueue<base::Event>");
+    static_assert(std::is_base_of_v<base::queue::iQueue<test::QueueType>, TestQueue>,
+                  "TestQueue must implement iQueue<test::QueueType>");
+
 private:
     std::shared_ptr<IRouter> m_router; ///< The router instance
     std::shared_ptr<ITester> m_tester; ///< The tester instance
     std::atomic_bool m_isRunning;      ///< Flag to know if the worker is running
     std::thread m_thread;              ///< The thread for the worker
+    std::vector<int> m_coreSet;        ///< Cores the worker thread is pinned to, empty for no pinning
+
+    std::shared_ptr<ProdQueue> m_rQueue; ///< The router queue
+    std::shared_ptr<TestQueue> m_tQueue; ///< The tester queue
+
+    /// Time spent waiting to pop a batch from the router queue, in microseconds.
+    /// Shared by every worker of the orchestrator. Null when metrics are off.
+    std::shared_ptr<metricsManager::iHistogram<uint64_t>> m_queueWaitTime;
+    /// Per-event processing time in microseconds. Shared by every worker of the
+    /// orchestrator. Null when metrics are off.
+    std::shared_ptr<metricsManager::iHistogram<uint64_t>> m_eventProcessTime;
 
-    std::shared_ptr<base::queue::iQueue<base::Event>> m_rQueue;     ///< The router queue
-    std::shared_ptr<base::queue::iQueue<test::QueueType>> m_tQueue; ///< The tester queue
+    /// Sampled receive-to-enqueue latency in microseconds, from the event trace.
+    std::shared_ptr<metricsManager::iHistogram<uint64_t>> m_stageReceiveToEnqueueTime;
+    /// Sampled queue residency (enqueue to dequeue) in microseconds, from the event trace.
+    std::shared_ptr<metricsManager::iHistogram<uint64_t>> m_stageQueueResidencyTime;
 
 public:
     /**
      * @brief Construct a new Worker object
      *
+     * @param envBuilder The environment builder.
+     * @param rQueue The router queue.
+     * @param tQueue The tester queue.
+     * @param metricsScope Optional scope for the latency histograms, no
+     * instrumentation when null.
+     * @param coreSet Cores the worker thread is pinned to, empty for no pinning.
      */
     Worker(std::shared_ptr<EnvironmentBuilder> envBuilder,
-           std::shared_ptr<base::queue::iQueue<base::Event>> rQueue,
-           std::shared_ptr<base::queue::iQueue<test::QueueType>> tQueue)
+           std::shared_ptr<ProdQueue> rQueue,
+           std::shared_ptr<TestQueue> tQueue,
+           std::shared_ptr<metricsManager::IMetricsScope> metricsScope = nullptr,
+           std::vector<int> coreSet = {})
         : m_router(std::make_shared<Router>(envBuilder))
         , m_tester(std::make_shared<Tester>(envBuilder))
         , m_isRunning(false)
         , m_thread()
+        , m_coreSet(std::move(coreSet))
         , m_rQueue(rQueue)
         , m_tQueue(tQueue)
     {
@@ -49,6 +97,14 @@ public:
         {
             throw std::logic_error("Invalid queues for the worker");
         }
+
+        if (metricsScope)
+        {
+            m_queueWaitTime = metricsScope->getLogHistogramUInteger("QueueWaitTimeUsec");
+            m_eventProcessTime = metricsScope->getLogHistogramUInteger("EventProcessTimeUsec");
+            m_stageReceiveToEnqueueTime = metricsScope->getLogHistogramUInteger("StageReceiveToEnqueueUsec");
+            m_stageQueueResidencyTime = metricsScope->getLogHistogramUInteger("StageQueueResidencyUsec");
+        }
     }
 
     ~Worker() { stop(); }
@@ -56,12 +112,115 @@ public:
     /**
      * @copydoc IWorker::start
      */
-    void start(const EpsLimit& epsLimit) override;
+    void start(const EpsLimit& epsLimit) override
+    {
+        if (m_isRunning)
+        {
+            return;
+        }
+
+        m_isRunning = true;
+        m_thread = std::thread(
+            [this, epsLimit, functionName = logging::getLambdaName(__FUNCTION__, "routerWorkerThread")]()
+            {
+                std::size_t tID = std::hash<std::thread::id> {}(std::this_thread::get_id());
+                LOG_DEBUG_L(functionName.c_str(), "Router Worker {} started", tID);
+                if (!m_coreSet.empty() && !base::utils::affinity::pinCurrentThread(m_coreSet))
+                {
+                    LOG_WARNING_L(functionName.c_str(), "Router Worker {} could not be pinned to its core set", tID);
+                }
+                std::vector<base::Event> events {};
+                events.reserve(WORKER_BULK_SIZE);
+                while (m_isRunning)
+                {
+                    // Process test queue
+                    test::QueueType testEvent {};
+                    if (m_tQueue->tryPop(testEvent) && testEvent != nullptr)
+                    {
+                        auto& [event, opt, callback] = *testEvent;
+                        auto output = m_tester->ingestTest(std::move(event), opt);
+                        try
+                        {
+                            callback(std::move(output));
+                        }
+                        catch (const std::exception& e)
+                        {
+                            LOG_ERROR_L(functionName.c_str(), "Error when executing API callback: ", e.what());
+                        }
+                    }
+
+                    // Process production queue in batches to amortize the queue synchronization cost
+                    const auto waitStart =
+                        m_queueWaitTime ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point {};
+                    if (!epsLimit() && m_rQueue->waitPopBulk(events, WORKER_BULK_SIZE, WAIT_DEQUEUE_TIMEOUT_USEC) > 0)
+                    {
+                        if (m_queueWaitTime)
+                        {
+                            const auto waited = std::chrono::steady_clock::now() - waitStart;
+                            m_queueWaitTime->recordValue(
+                                std::chrono::duration_cast<std::chrono::microseconds>(waited).count());
+                        }
+
+                        for (auto& event : events)
+                        {
+                            if (event != nullptr)
+                            {
+                                // Consume the trace of sampled events before processing
+                                if (base::eventTrace::enabled() && base::eventTrace::isTraced(event))
+                                {
+                                    const auto dequeued = base::eventTrace::now();
+                                    const auto stamps = base::eventTrace::take(event);
+                                    if (stamps.has_value() && stamps->size() >= 2 && m_stageQueueResidencyTime)
+                                    {
+                                        m_stageReceiveToEnqueueTime->recordValue(
+                                            static_cast<uint64_t>(std::max<int64_t>((*stamps)[1] - (*stamps)[0], 0)));
+                                        m_stageQueueResidencyTime->recordValue(
+                                            static_cast<uint64_t>(std::max<int64_t>(dequeued - (*stamps)[1], 0)));
+                                    }
+                                }
+
+                                if (m_eventProcessTime)
+                                {
+                                    const auto processStart = std::chrono::steady_clock::now();
+                                    m_router->ingest(std::move(event));
+                                    const auto processed = std::chrono::steady_clock::now() - processStart;
+                                    m_eventProcessTime->recordValue(
+                                        std::chrono::duration_cast<std::chrono::microseconds>(processed).count());
+                                }
+                                else
+                                {
+                                    m_router->ingest(std::move(event));
+                                }
+                            }
+                        }
+
+                        // The first event of the batch was accounted by the initial check, account the rest
+                        for (std::size_t i = 1; i < events.size(); ++i)
+                        {
+                            epsLimit();
+                        }
+                    }
+                }
+                LOG_DEBUG_L(functionName.c_str(), "Router Worker {} finished", tID);
+            });
+    }
 
     /**
      * @copydoc IWorker::stop
      */
-    void stop() override;
+    void stop() override
+    {
+        if (!m_isRunning)
+        {
+            return;
+        }
+
+        m_isRunning = false;
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
 
     const std::shared_ptr<IRouter>& getRouter() const { return m_router; }
     const std::shared_ptr<ITester>& getTester() const { return m_tester; }
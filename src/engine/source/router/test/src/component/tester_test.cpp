@@ -100,7 +100,8 @@ public:
         m_orchestrator = std::make_shared<router::Orchestrator>(config);
 
         EXPECT_CALL(*m_mockQueueTester, tryPop(testing::_)).WillRepeatedly(testing::Return(false));
-        EXPECT_CALL(*m_mockQueueRouter, waitPop(testing::_, testing::_)).WillRepeatedly(testing::Return(true));
+        EXPECT_CALL(*m_mockQueueRouter, waitPopBulk(testing::_, testing::_, testing::_))
+            .WillRepeatedly(testing::Return(0));
         m_orchestrator->start();
     }
 };
@@ -48,6 +48,112 @@ TEST(EnvironmentBuilderTest, Create_ValidPolicyAndFilter)
     EXPECT_NE(environment, nullptr);
 }
 
+TEST(EnvironmentBuilderTest, MakeController_BuildSessionReusesPolicy)
+{
+    auto builder = std::make_shared<builder::mocks::MockBuilder>();
+    auto controllerMaker = std::make_shared<bk::mocks::MockMakerController>();
+
+    EnvironmentBuilder eBuilder(builder, controllerMaker);
+
+    auto policyName = base::Name("policy/test/0");
+
+    auto mockPolicy = std::make_shared<builder::mocks::MockPolicy>();
+
+    std::shared_ptr<builder::IPolicy> resPolicy(mockPolicy);
+    std::unordered_set<base::Name> fakeAssets {};
+    fakeAssets.insert(base::Name("asset/test/0"));
+    // The policy is built once and shared by both controllers of the session
+    EXPECT_CALL(*builder, buildPolicy(policyName)).WillOnce(Return(resPolicy));
+    EXPECT_CALL(*mockPolicy, assets()).WillRepeatedly(ReturnRef(fakeAssets));
+
+    auto mockController = std::make_shared<bk::mocks::MockController>();
+    EXPECT_CALL(*controllerMaker, create(testing::_, testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(::testing::Return(mockController));
+
+    auto emptyExpression = base::Expression {};
+    EXPECT_CALL(*mockPolicy, expression()).WillRepeatedly(ReturnRef(emptyExpression));
+    std::string hash = "hash";
+    EXPECT_CALL(*mockPolicy, hash()).WillRepeatedly(ReturnRef(hash));
+
+    auto session = eBuilder.startBuildSession();
+    auto [firstController, firstHash, firstPolicy] = eBuilder.makeController(policyName);
+    auto [secondController, secondHash, secondPolicy] = eBuilder.makeController(policyName);
+
+    EXPECT_EQ(firstHash, secondHash);
+}
+
+TEST(EnvironmentBuilderTest, MakeController_ContentHashReusesPolicy)
+{
+    auto builder = std::make_shared<builder::mocks::MockBuilder>();
+    auto controllerMaker = std::make_shared<bk::mocks::MockMakerController>();
+
+    EnvironmentBuilder eBuilder(builder, controllerMaker);
+
+    auto policyName = base::Name("policy/test/0");
+
+    auto mockPolicy = std::make_shared<builder::mocks::MockPolicy>();
+
+    std::shared_ptr<builder::IPolicy> resPolicy(mockPolicy);
+    std::unordered_set<base::Name> fakeAssets {};
+    fakeAssets.insert(base::Name("asset/test/0"));
+    std::string hash = "hash";
+    // Unchanged content resolves from the content-addressed cache, no session needed
+    EXPECT_CALL(*builder, getPolicyHash(policyName)).Times(2).WillRepeatedly(Return(hash));
+    EXPECT_CALL(*builder, buildPolicy(policyName)).WillOnce(Return(resPolicy));
+    EXPECT_CALL(*mockPolicy, name()).WillRepeatedly(ReturnRef(policyName));
+    EXPECT_CALL(*mockPolicy, assets()).WillRepeatedly(ReturnRef(fakeAssets));
+
+    auto mockController = std::make_shared<bk::mocks::MockController>();
+    EXPECT_CALL(*controllerMaker, create(testing::_, testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(::testing::Return(mockController));
+
+    auto emptyExpression = base::Expression {};
+    EXPECT_CALL(*mockPolicy, expression()).WillRepeatedly(ReturnRef(emptyExpression));
+    EXPECT_CALL(*mockPolicy, hash()).WillRepeatedly(ReturnRef(hash));
+
+    auto [firstController, firstHash, firstPolicy] = eBuilder.makeController(policyName);
+    auto [secondController, secondHash, secondPolicy] = eBuilder.makeController(policyName);
+
+    EXPECT_EQ(firstPolicy, secondPolicy);
+}
+
+TEST(EnvironmentBuilderTest, MakeController_CacheDroppedWithSession)
+{
+    auto builder = std::make_shared<builder::mocks::MockBuilder>();
+    auto controllerMaker = std::make_shared<bk::mocks::MockMakerController>();
+
+    EnvironmentBuilder eBuilder(builder, controllerMaker);
+
+    auto policyName = base::Name("policy/test/0");
+
+    auto mockPolicy = std::make_shared<builder::mocks::MockPolicy>();
+
+    std::shared_ptr<builder::IPolicy> resPolicy(mockPolicy);
+    std::unordered_set<base::Name> fakeAssets {};
+    fakeAssets.insert(base::Name("asset/test/0"));
+    // Each build outside a session (or in a new one) rebuilds the policy
+    EXPECT_CALL(*builder, buildPolicy(policyName)).Times(2).WillRepeatedly(Return(resPolicy));
+    EXPECT_CALL(*mockPolicy, assets()).WillRepeatedly(ReturnRef(fakeAssets));
+
+    auto mockController = std::make_shared<bk::mocks::MockController>();
+    EXPECT_CALL(*controllerMaker, create(testing::_, testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(::testing::Return(mockController));
+
+    auto emptyExpression = base::Expression {};
+    EXPECT_CALL(*mockPolicy, expression()).WillRepeatedly(ReturnRef(emptyExpression));
+    std::string hash = "hash";
+    EXPECT_CALL(*mockPolicy, hash()).WillRepeatedly(ReturnRef(hash));
+
+    {
+        auto session = eBuilder.startBuildSession();
+        eBuilder.makeController(policyName);
+    }
+    eBuilder.makeController(policyName);
+}
+
 TEST(EnvironmentBuilderTest, Create_inValidPolicy)
 {
     auto builder = std::make_shared<builder::mocks::MockBuilder>();
@@ -369,3 +369,17 @@ TEST_F(RouterTest, IngestSuccess)
 
     EXPECT_TRUE(ingestEvent());
 }
+
+TEST_F(RouterTest, IngestAfterRemovalNotRouted)
+{
+    auto entryPost = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    addEntry(entryPost);
+
+    enableEntry(ENVIRONMENT_NAME);
+    EXPECT_TRUE(removeEntry(ENVIRONMENT_NAME));
+
+    // The published snapshot no longer contains the route, so the event is not routed
+    EXPECT_CALL(*m_mockController, ingest(testing::_)).Times(0);
+    auto event = std::make_shared<json::Json>(R"({"key": "value"})");
+    m_router->ingest(std::move(event));
+}
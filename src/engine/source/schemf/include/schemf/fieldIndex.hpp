@@ -0,0 +1,95 @@
+#ifndef _SCHEMF_FIELD_INDEX_HPP
+#define _SCHEMF_FIELD_INDEX_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <schemf/type.hpp>
+
+namespace schemf
+{
+
+/**
+ * @brief Stable integer handle to a schema field, valid until the index is rebuilt.
+ *
+ * Builders can resolve a field name once and store the id instead of the name, turning later
+ * metadata queries into array lookups.
+ */
+using FieldId = uint32_t;
+
+/**
+ * @brief Frozen perfect-hash table over the flattened schema fields.
+ *
+ * Built once after the schema loads using a two-level FKS scheme: a first-level hash distributes
+ * the field paths over as many buckets as there are fields, then each bucket searches a seed
+ * giving its keys collision-free slots. Lookups are O(1) with a single string comparison to
+ * confirm the match, with no collision chains to walk.
+ */
+class FieldIndex
+{
+public:
+    /**
+     * @brief Flattened metadata of one schema field.
+     */
+    struct Entry
+    {
+        std::string path; ///< Full dot-separated path of the field.
+        Type type;        ///< The type of the field.
+        bool isArray;     ///< Whether the field is an array.
+    };
+
+    FieldIndex() = default;
+
+    /**
+     * @brief Freeze the index over the given entries, replacing any previous content.
+     *
+     * @param entries Flattened fields, one per schema node. Paths must be unique.
+     *
+     * @throw std::runtime_error If two entries share the same path.
+     */
+    void build(std::vector<Entry> entries);
+
+    /**
+     * @brief Resolve a field path to its id.
+     *
+     * @param path Full dot-separated path of the field.
+     * @return std::optional<FieldId> The id, or nullopt if the path is not indexed.
+     */
+    std::optional<FieldId> find(std::string_view path) const;
+
+    /**
+     * @brief Get the entry of a field id.
+     *
+     * @param id Id previously obtained from find().
+     * @return const Entry&
+     *
+     * @throw std::out_of_range If the id is not valid.
+     */
+    const Entry& entry(FieldId id) const { return m_entries.at(id); }
+
+    /**
+     * @brief Number of indexed fields.
+     */
+    size_t size() const { return m_entries.size(); }
+
+private:
+    struct Bucket
+    {
+        uint64_t seed;   ///< Seed giving this bucket's keys collision-free slots.
+        uint32_t offset; ///< First slot of the bucket in m_slots.
+        uint32_t slots;  ///< Number of slots reserved for the bucket, 0 if empty.
+    };
+
+    std::vector<Entry> m_entries;
+    std::vector<Bucket> m_buckets;
+    std::vector<uint32_t> m_slots; ///< Entry index + 1, 0 means empty slot.
+
+    static uint64_t hash(std::string_view key, uint64_t seed);
+};
+
+} // namespace schemf
+
+#endif // _SCHEMF_FIELD_INDEX_HPP
@@ -6,6 +6,7 @@
 #include <string>
 
 #include <schemf/field.hpp>
+#include <schemf/fieldIndex.hpp>
 #include <schemf/ischema.hpp>
 #include <schemf/ivalidator.hpp>
 
@@ -22,8 +23,16 @@ private:
     class Validator;
     std::experimental::propagate_const<std::unique_ptr<Validator>> m_validator;
 
+    mutable FieldIndex m_index;       ///< Frozen perfect-hash index over the flattened fields.
+    mutable bool m_indexDirty = true; ///< Whether the index must be rebuilt before use.
+
     Field get(const DotPath& name) const;
 
+    /**
+     * @brief Get the field index, rebuilding it if the fields changed since the last build.
+     */
+    const FieldIndex& index() const;
+
     /**
      * @brief Convert a field JSON entry to a Schema Field object.
      *
@@ -88,6 +97,47 @@ public:
      */
     inline bool isArray(const DotPath& name) const override { return get(name).isArray(); }
 
+    /**
+     * @brief Resolve a field path to its integer id.
+     *
+     * The id stays valid until the schema is modified and can be stored by builders instead of
+     * the name, turning later metadata queries into array lookups.
+     *
+     * @param name Dot-separated path to the field.
+     * @return std::optional<FieldId> The id, or nullopt if the field does not exist.
+     */
+    std::optional<FieldId> resolveField(const DotPath& name) const { return index().find(name.str()); }
+
+    /**
+     * @brief Get the Type of a field by id.
+     *
+     * @param id Id previously obtained from resolveField().
+     * @return Type
+     *
+     * @throw std::out_of_range If the id is not valid.
+     */
+    Type getType(FieldId id) const { return index().entry(id).type; }
+
+    /**
+     * @brief Get the Json Type of a field by id.
+     *
+     * @param id Id previously obtained from resolveField().
+     * @return json::Json::Type
+     *
+     * @throw std::out_of_range If the id is not valid.
+     */
+    json::Json::Type getJsonType(FieldId id) const { return typeToJType(index().entry(id).type); }
+
+    /**
+     * @brief Query if a field is an array by id.
+     *
+     * @param id Id previously obtained from resolveField().
+     * @return bool
+     *
+     * @throw std::out_of_range If the id is not valid.
+     */
+    bool isArray(FieldId id) const { return index().entry(id).isArray; }
+
     /**
      * @brief Load a schema from a JSON object, adding each field to the schema.
      *
@@ -0,0 +1,113 @@
+#include <schemf/fieldIndex.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace schemf
+{
+
+uint64_t FieldIndex::hash(std::string_view key, uint64_t seed)
+{
+    // FNV-1a mixed with the seed, good enough for the per-bucket seed search
+    uint64_t h = 14695981039346656037ULL ^ (seed * 0x9E3779B97F4A7C15ULL);
+    for (const auto c : key)
+    {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+void FieldIndex::build(std::vector<Entry> entries)
+{
+    m_entries = std::move(entries);
+    m_buckets.clear();
+    m_slots.clear();
+
+    const auto n = m_entries.size();
+    if (n == 0)
+    {
+        return;
+    }
+
+    // First level: distribute the keys over n buckets
+    std::vector<std::vector<uint32_t>> buckets(n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        buckets[hash(m_entries[i].path, 0) % n].push_back(i);
+    }
+
+    // Second level: per bucket, search a seed mapping its keys to distinct slots
+    m_buckets.resize(n, Bucket {0, 0, 0});
+    for (size_t b = 0; b < n; ++b)
+    {
+        const auto& keys = buckets[b];
+        if (keys.empty())
+        {
+            continue;
+        }
+
+        const auto slots = static_cast<uint32_t>(keys.size() * keys.size());
+        const auto offset = static_cast<uint32_t>(m_slots.size());
+        m_slots.resize(m_slots.size() + slots, 0);
+
+        uint64_t seed = 1;
+        while (true)
+        {
+            bool collided = false;
+            for (const auto key : keys)
+            {
+                auto& slot = m_slots[offset + hash(m_entries[key].path, seed) % slots];
+                if (slot != 0)
+                {
+                    collided = true;
+                    break;
+                }
+                slot = key + 1;
+            }
+
+            if (!collided)
+            {
+                break;
+            }
+
+            std::fill(m_slots.begin() + offset, m_slots.begin() + offset + slots, 0);
+            ++seed;
+
+            // Duplicated paths can never be separated, bail out instead of spinning
+            if (seed > 10000)
+            {
+                throw std::runtime_error(
+                    fmt::format("Field index cannot be built, duplicated field path '{}'?", m_entries[keys[0]].path));
+            }
+        }
+
+        m_buckets[b] = Bucket {seed, offset, slots};
+    }
+}
+
+std::optional<FieldId> FieldIndex::find(std::string_view path) const
+{
+    if (m_entries.empty())
+    {
+        return std::nullopt;
+    }
+
+    const auto& bucket = m_buckets[hash(path, 0) % m_entries.size()];
+    if (bucket.slots == 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto slot = m_slots[bucket.offset + hash(path, bucket.seed) % bucket.slots];
+    if (slot == 0 || m_entries[slot - 1].path != path)
+    {
+        return std::nullopt;
+    }
+
+    return slot - 1;
+}
+
+} // namespace schemf
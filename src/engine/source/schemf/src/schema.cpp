@@ -1,7 +1,9 @@
 #include "schema.hpp"
 #include "validator.hpp"
 
+#include <functional>
 #include <stdexcept>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -52,6 +54,7 @@ void Schema::addField(const DotPath& name, const Field& field)
     }
 
     current->emplace(name.parts().back(), field);
+    m_indexDirty = true;
 }
 
 void Schema::removeField(const DotPath& name)
@@ -81,6 +84,35 @@ void Schema::removeField(const DotPath& name)
     }
 
     current->erase(entry);
+    m_indexDirty = true;
+}
+
+const FieldIndex& Schema::index() const
+{
+    if (m_indexDirty)
+    {
+        std::vector<FieldIndex::Entry> entries;
+        // Flatten the field graph into full dot paths, one entry per node
+        std::function<void(const std::map<std::string, Field>&, const std::string&)> flatten =
+            [&](const std::map<std::string, Field>& fields, const std::string& prefix)
+        {
+            for (const auto& [key, field] : fields)
+            {
+                auto path = prefix.empty() ? key : prefix + "." + key;
+                entries.push_back({path, field.type(), field.isArray()});
+                if (hasProperties(field.type()))
+                {
+                    flatten(field.properties(), path);
+                }
+            }
+        };
+        flatten(m_fields, "");
+
+        m_index.build(std::move(entries));
+        m_indexDirty = false;
+    }
+
+    return m_index;
 }
 
 Field Schema::get(const DotPath& name) const
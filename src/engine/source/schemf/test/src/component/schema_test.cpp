@@ -168,3 +168,46 @@ TEST(SchemaTest, ArrayItem)
     ASSERT_THROW(schema.getType("a.n"), std::runtime_error);
     ASSERT_THROW(schema.getJsonType("a.n"), std::runtime_error);
 }
+
+TEST(SchemaTest, FieldIndex)
+{
+    Schema schema;
+    schema.addField("a.b", {Type::KEYWORD});
+    schema.addField("a.c", {Type::INTEGER, true});
+
+    auto idB = schema.resolveField("a.b");
+    ASSERT_TRUE(idB.has_value());
+    ASSERT_EQ(schema.getType(idB.value()), Type::KEYWORD);
+    ASSERT_EQ(schema.getJsonType(idB.value()), json::Json::Type::String);
+    ASSERT_FALSE(schema.isArray(idB.value()));
+
+    auto idC = schema.resolveField("a.c");
+    ASSERT_TRUE(idC.has_value());
+    ASSERT_TRUE(schema.isArray(idC.value()));
+
+    // Intermediate objects are indexed too
+    ASSERT_TRUE(schema.resolveField("a").has_value());
+    ASSERT_FALSE(schema.resolveField("a.d").has_value());
+
+    // The same id resolves again after unrelated queries
+    ASSERT_EQ(schema.resolveField("a.b"), idB);
+}
+
+TEST(SchemaTest, FieldIndexManyFields)
+{
+    Schema schema;
+    // Enough fields to exercise multi-key buckets in the perfect-hash table
+    for (auto i = 0; i < 500; ++i)
+    {
+        schema.addField(fmt::format("f{}.sub{}", i % 50, i), {Type::KEYWORD});
+    }
+
+    for (auto i = 0; i < 500; ++i)
+    {
+        auto name = fmt::format("f{}.sub{}", i % 50, i);
+        auto id = schema.resolveField(name);
+        ASSERT_TRUE(id.has_value()) << name;
+        ASSERT_EQ(schema.getType(id.value()), Type::KEYWORD);
+    }
+    ASSERT_FALSE(schema.resolveField("f0.sub500").has_value());
+}
@@ -0,0 +1,103 @@
+#ifndef _SERVER_ENDPOINT_CLIENT_SEND_QUEUE_HPP
+#define _SERVER_ENDPOINT_CLIENT_SEND_QUEUE_HPP
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <uvw.hpp>
+
+namespace engineserver::endpoint
+{
+
+/**
+ * @brief Per-connection output queue that coalesces responses into few stream writes.
+ *
+ * Responses produced during a loop iteration (a burst of parsed requests, or several
+ * worker responses dispatched in the same tick) are queued and flushed together on the
+ * check phase of the loop: consecutive small buffers are copied into one contiguous
+ * write and large buffers go out untouched, so a burst of small responses costs one
+ * write instead of one per response. The queue also exposes a high-watermark signal so
+ * the endpoint can stop reading from a client that is not draining its responses and
+ * resume once the queue drains.
+ *
+ * @note All methods must be called from the loop thread.
+ */
+class ClientSendQueue
+{
+public:
+    constexpr static std::size_t MAX_COALESCE_BYTES {256 * 1024};  ///< Maximum size of a coalesced write
+    constexpr static std::size_t HIGH_WATERMARK {4 * 1024 * 1024}; ///< Queued bytes to pause reading
+    constexpr static std::size_t LOW_WATERMARK {1024 * 1024};      ///< Queued bytes to resume reading
+
+private:
+    std::weak_ptr<uvw::PipeHandle> m_wClient;  ///< Client the queue writes to
+    std::shared_ptr<uvw::CheckHandle> m_check; ///< Flushes the queue on the check phase of the loop
+
+    std::vector<std::pair<std::unique_ptr<char[]>, std::size_t>> m_pending; ///< Queued buffers, in send order
+    std::size_t m_pendingBytes {0};                                         ///< Total queued bytes
+    bool m_readPaused {false}; ///< Whether reading from the client is paused
+
+    explicit ClientSendQueue(std::shared_ptr<uvw::PipeHandle> client)
+        : m_wClient(client)
+    {
+    }
+
+    /**
+     * @brief Write the queued buffers, grouping consecutive small ones into single writes.
+     */
+    void flush();
+
+    /**
+     * @brief Bytes queued here plus bytes already handed to the stream and not yet written.
+     */
+    std::size_t outstandingBytes() const;
+
+public:
+    ClientSendQueue(const ClientSendQueue&) = delete;
+    ClientSendQueue& operator=(const ClientSendQueue&) = delete;
+
+    ~ClientSendQueue() { close(); }
+
+    /**
+     * @brief Create a queue bound to a client, flushing on the check phase of the loop.
+     *
+     * @param loop Loop the client belongs to
+     * @param client Client the queue writes to
+     * @return std::shared_ptr<ClientSendQueue> The queue
+     */
+    static std::shared_ptr<ClientSendQueue> create(std::shared_ptr<uvw::Loop> loop,
+                                                   std::shared_ptr<uvw::PipeHandle> client);
+
+    /**
+     * @brief Queue a buffer to be written on the next flush.
+     *
+     * @param buffer Buffer to write
+     * @param size Size of the buffer
+     */
+    void send(std::unique_ptr<char[]>&& buffer, std::size_t size);
+
+    /**
+     * @brief Check if the outstanding output is above the high watermark.
+     */
+    bool overHighWatermark() const { return outstandingBytes() >= HIGH_WATERMARK; }
+
+    /**
+     * @brief Stop reading from the client if the output is above the high watermark.
+     */
+    void pauseReadIfNeeded();
+
+    /**
+     * @brief Resume reading from the client once the output drained below the low watermark.
+     */
+    void resumeReadIfDrained();
+
+    /**
+     * @brief Drop the queued buffers and release the flush handle.
+     */
+    void close();
+};
+
+} // namespace engineserver::endpoint
+
+#endif // _SERVER_ENDPOINT_CLIENT_SEND_QUEUE_HPP
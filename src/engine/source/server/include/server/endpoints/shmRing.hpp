@@ -0,0 +1,189 @@
+#ifndef _SERVER_ENDPOINT_SHM_RING_HPP
+#define _SERVER_ENDPOINT_SHM_RING_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <metrics/iMetricsManager.hpp>
+
+#include <server/endpoint.hpp>
+
+namespace engineserver::endpoint
+{
+
+namespace shmring
+{
+constexpr uint64_t MAGIC {0x53544E5645485A57ULL}; ///< "WZHEVNTS", identifies the segment layout.
+constexpr uint32_t VERSION {1};                   ///< Layout version, bumped on incompatible changes.
+constexpr uint32_t WRAP_MARKER {0xFFFFFFFFU};     ///< Record length marking a jump back to the ring start.
+constexpr uint32_t DEFAULT_CAPACITY {1 << 22};    ///< Default ring capacity in bytes (4 MiB).
+constexpr std::size_t BATCH_RECORDS {64};         ///< Producer records per publish by default.
+
+/**
+ * @brief Control block at the start of the shared segment, agreed between producer and consumer.
+ *
+ * head and tail are monotonically increasing byte offsets (position is offset modulo capacity);
+ * records are a 4 byte length followed by the payload, padded to 4 bytes, and are always
+ * contiguous: when a record does not fit before the end of the ring the producer writes a
+ * WRAP_MARKER length and restarts at offset 0. The counters live on their own cache lines so the
+ * producer and the consumer do not false-share.
+ */
+struct Header
+{
+    std::atomic<uint64_t> magic;          ///< Segment layout identifier, published last at creation.
+    uint32_t version;                     ///< Segment layout version.
+    uint32_t capacity;                    ///< Ring capacity in bytes, power of two.
+    alignas(64) std::atomic<uint64_t> head;    ///< Publish offset, written by the producer.
+    alignas(64) std::atomic<uint64_t> tail;    ///< Consume offset, written by the consumer.
+    alignas(64) std::atomic<uint32_t> futexSeq; ///< Futex word, bumped by the producer on publish.
+    std::atomic<uint32_t> waiting;             ///< Whether the consumer is (about to be) waiting.
+};
+} // namespace shmring
+
+/**
+ * @brief Shared-memory ring consumer endpoint for the event socket.
+ *
+ * Alternative transport to the unix datagram socket for local producers (remoted): a
+ * single-producer, single-consumer byte ring in a POSIX shared memory segment. The producer
+ * appends length-prefixed records and publishes a batch of them with a single atomic store; the
+ * consumer drains everything published in one pass and parks on a futex when the ring is empty,
+ * so the steady-state cost per event is a couple of loads instead of a sendto/recvfrom syscall
+ * pair. The segment is mapped with a transparent huge page hint (best effort).
+ *
+ * The endpoint owns the segment and a consumer thread; events are delivered to the callback from
+ * that thread, in order. It is meant to be registered next to the unix datagram endpoint, which
+ * stays as the negotiation fallback for producers that do not support the ring.
+ */
+class ShmRing : public Endpoint
+{
+private:
+    std::function<void(std::string_view)> m_callback; ///< Callback invoked per consumed event.
+
+    int m_shmFd;              ///< Shared memory segment descriptor.
+    void* m_map;              ///< Segment mapping.
+    std::size_t m_mapSize;    ///< Mapping size (header + ring).
+    shmring::Header* m_header; ///< Control block inside the mapping.
+    char* m_ring;             ///< Ring data area inside the mapping.
+
+    std::thread m_consumer;          ///< Consumer thread draining the ring.
+    std::atomic<bool> m_stop;        ///< Stop request for the consumer thread.
+    std::atomic<bool> m_paused;      ///< Pause request, the consumer idles while set.
+
+    struct Metric
+    {
+        std::shared_ptr<metricsManager::IMetricsScope> m_metricsScope;     ///< Metrics scope for the endpoint
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_byteRecv;    ///< Counter for the received bytes
+        std::shared_ptr<metricsManager::iHistogram<uint64_t>> m_eventSize; ///< Histogram for the event size
+
+        std::shared_ptr<metricsManager::IMetricsScope> m_metricsScopeDelta; ///< Metrics scope for the endpoint rate
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_byteRecvPerSecond; ///< Byte received per second
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_eventPerSecond;    ///< Event received per second
+    };
+    Metric m_metric;
+
+    /**
+     * @brief Consumer loop: drain published records, park on the futex when the ring is empty.
+     */
+    void consume();
+
+public:
+    /**
+     * @brief Create a shared-memory ring endpoint.
+     *
+     * @param address Segment name (e.g. "/wazuh-engine-events"), must start with '/'.
+     * @param callback Callback to be called, on the consumer thread, for each event.
+     * @param metricsScope Metrics scope for the endpoint.
+     * @param metricsScopeDelta Metrics scope for the endpoint rate.
+     * @param capacity Ring capacity in bytes, power of two.
+     */
+    ShmRing(const std::string& address,
+            const std::function<void(std::string_view)>& callback,
+            std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+            std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+            const uint32_t capacity = shmring::DEFAULT_CAPACITY);
+    ~ShmRing();
+
+    /**
+     * @copydoc link-object::Endpoint::bind
+     *
+     * @note The loop is not used: the ring is drained by a dedicated consumer thread. It is kept
+     * to honor the Endpoint contract (isBound) and the EngineServer registration flow.
+     */
+    void bind(std::shared_ptr<uvw::Loop> loop) override;
+
+    /**
+     * @copydoc link-object::Endpoint::close
+     */
+    void close(void) override;
+
+    /**
+     * @copydoc link-object::Endpoint::pause
+     */
+    bool pause(void) override;
+
+    /**
+     * @copydoc link-object::Endpoint::resume
+     */
+    bool resume(void) override;
+};
+
+/**
+ * @brief Producer side of the shared-memory ring, linked by the local event producers.
+ *
+ * Opens a segment created by the ShmRing endpoint (the producer negotiates at startup by trying
+ * to open the segment and falling back to the unix datagram socket if it is absent or
+ * incompatible). push() writes a record but does not make it visible; records become visible in
+ * batches, either every BATCH_RECORDS pushes or on an explicit flush(), with one release store
+ * and at most one futex wake per batch.
+ */
+class ShmRingProducer
+{
+private:
+    int m_shmFd;               ///< Shared memory segment descriptor.
+    void* m_map;               ///< Segment mapping.
+    std::size_t m_mapSize;     ///< Mapping size (header + ring).
+    shmring::Header* m_header; ///< Control block inside the mapping.
+    char* m_ring;              ///< Ring data area inside the mapping.
+
+    uint64_t m_localHead;     ///< Write offset of the records not yet published.
+    std::size_t m_pending;    ///< Records written since the last publish.
+    std::size_t m_batchSize;  ///< Records per automatic publish.
+
+public:
+    /**
+     * @brief Open an existing ring segment.
+     *
+     * @param address Segment name, must match the consumer endpoint address.
+     * @param batchSize Records per automatic publish.
+     * @throw std::runtime_error If the segment does not exist or its layout is incompatible, in
+     * which case the producer should fall back to the unix datagram socket.
+     */
+    explicit ShmRingProducer(const std::string& address, const std::size_t batchSize = shmring::BATCH_RECORDS);
+    ~ShmRingProducer();
+
+    ShmRingProducer(const ShmRingProducer&) = delete;
+    ShmRingProducer& operator=(const ShmRingProducer&) = delete;
+
+    /**
+     * @brief Write an event record into the ring.
+     *
+     * @param event Event payload.
+     * @return false if the ring does not have room for the record (the caller should retry or
+     * fall back to the socket), true otherwise.
+     */
+    bool push(std::string_view event);
+
+    /**
+     * @brief Publish the pending records and wake the consumer if it is waiting.
+     */
+    void flush();
+};
+
+} // namespace engineserver::endpoint
+
+#endif // _SERVER_ENDPOINT_SHM_RING_HPP
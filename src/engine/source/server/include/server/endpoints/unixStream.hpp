@@ -7,6 +7,7 @@
 #include <metrics/iMetricsManager.hpp>
 
 #include <server/endpoint.hpp>
+#include <server/endpoints/clientSendQueue.hpp>
 #include <server/protocolHandler.hpp>
 
 namespace engineserver::endpoint
@@ -29,6 +30,9 @@ namespace engineserver::endpoint
 class UnixStream : public Endpoint
 {
 private:
+    constexpr static std::size_t CHUNKED_RESPONSE_THRESHOLD {1024 * 1024}; ///< Responses this big are sent in chunks
+    constexpr static std::size_t RESPONSE_CHUNK_SIZE {256 * 1024};         ///< Size of each response chunk
+
     std::shared_ptr<uvw::PipeHandle> m_handle;         ///< Handle to the socket
     std::size_t m_timeout;                             ///< Timeout for the connection in milliseconds
     std::shared_ptr<ProtocolHandlerFactory> m_factory; ///< Factory to create protocol handlers for each client
@@ -62,12 +66,14 @@ private:
      * This function is used to process the messages received from the client, it is called when a stream is parsed.
      * @param client Handle to the client that sent the message
      * @param asyncs Array of AsyncHandler instance that will be used to send the event using send()
+     * @param sendQueue Output queue of the client, coalesces the responses
      * @param protocolHandler Protocol handler to process the message
      * @param requests Messages to be processed
      * @param response Shared memory where the callback executed by the AsyncHandle will write the response
      */
     void processMessages(std::weak_ptr<uvw::PipeHandle> clientRef,
                          std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs,
+                         std::shared_ptr<ClientSendQueue> sendQueue,
                          std::shared_ptr<ProtocolHandler> protocolHandler,
                          std::vector<std::string>&& requests);
 
@@ -78,11 +84,13 @@ private:
      * is received and enqueued for processing by the thread pool.
      * @param client Handle to the client that sent the message
      * @param asyncs Array of AsyncHandler instance that will be used to send the event using send()
+     * @param sendQueue Output queue of the client, coalesces the responses
      * @param protocolHandler Protocol handler to process the message
      * @param request Message to be processed
      */
     void createAndEnqueueTask(std::weak_ptr<uvw::PipeHandle> wClient,
                               std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs,
+                              std::shared_ptr<ClientSendQueue> sendQueue,
                               std::shared_ptr<ProtocolHandler> protocolHandler,
                               std::string&& request);
 
@@ -92,10 +100,12 @@ private:
      * @param client Client to close
      * @param async Array of AsyncHandler instance that will be used to send the event using send()
      * @param timer Timer to close if the client closes the connection
+     * @param sendQueue Output queue of the client, closed together with the client
      */
     void configureCloseClient(std::shared_ptr<uvw::PipeHandle> client,
                               std::shared_ptr<uvw::TimerHandle> timer,
-                              std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> async);
+                              std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> async,
+                              std::shared_ptr<ClientSendQueue> sendQueue);
 
     /**
      * @brief Create a Timer resource, this timer will be used to close the client connection if it doesn't send any
@@ -5,6 +5,8 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <uvw.hpp>
 #include <uvw/async.h>
@@ -41,6 +43,11 @@ private:
     std::shared_ptr<uvw::AsyncHandle> m_stopHandle;                         ///< The handle used to stop the server.
     std::unordered_map<std::string, std::shared_ptr<Endpoint>> m_endpoints; ///< The endpoints of the server.
 
+    std::vector<std::shared_ptr<uvw::Loop>> m_ingestLoops; ///< Extra loops for the distributed endpoints.
+    std::vector<std::shared_ptr<uvw::AsyncHandle>> m_ingestStopHandles; ///< Stop handles, one per extra loop.
+    std::vector<std::thread> m_ingestThreads;                           ///< Threads running the extra loops.
+    std::vector<int> m_coreSet; ///< Cores the loop threads are pinned to, empty for no pinning.
+
     void stop();
 
 public:
@@ -48,9 +55,14 @@ public:
      * @brief Construct a new Engine Server object
      * @param threadPoolSize The size of the thread pool worker. This is the number of threads that will be used
      * to process the requests if the request is not processed in the main thread.
+     * @param eventLoops The total number of event loops. The first one is the main loop; the extra ones each run
+     * in their own thread and serve the endpoints added with distribute set, so ingestion scales past a single
+     * loop thread.
+     * @param coreSet Cores the loop threads (main and ingest) are pinned to, empty for no pinning. Pinning the
+     * ingestion loops to the same NUMA node as the event queue consumers keeps the event buffers node-local.
      *
      */
-    EngineServer(int threadPoolSize = 1);
+    EngineServer(int threadPoolSize = 1, int eventLoops = 1, std::vector<int> coreSet = {});
     ~EngineServer();
 
     /**
@@ -58,10 +70,12 @@ public:
      *
      * @param name (const std::string&) The name of the endpoint.
      * @param endpoint (std::shared_ptr<Endpoint>) The endpoint to add.
+     * @param distribute (bool) If true, the endpoint is also bound to every extra event loop, each one reading
+     * from the shared socket independently.
      *
      * @throw std::runtime_error If the endpoint name is already in use.
      */
-    void addEndpoint(const std::string& name, std::shared_ptr<Endpoint> endpoint);
+    void addEndpoint(const std::string& name, std::shared_ptr<Endpoint> endpoint, bool distribute = false);
 
     /**
      * @brief Start the server. This method will start the main loop in blocking mode. (same thread)
@@ -1,10 +1,12 @@
 #ifndef _SERVER_PROTOCOL_HANDLER_BASE_HPP
 #define _SERVER_PROTOCOL_HANDLER_BASE_HPP
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
@@ -78,6 +80,31 @@ public:
      */
     virtual std::tuple<std::unique_ptr<char[]>, std::size_t> streamToSend(const std::string& message) = 0;
 
+    /**
+     * @brief Generate the data to send to the client in bounded chunks
+     *
+     * Generate the frame of a large response as a sequence of buffers instead of one
+     * contiguous allocation of the full frame. The buffers must be written to the client
+     * back to back, in order, and each one is released as soon as its write completes,
+     * so the peak memory held by the send path is bounded by the chunk size instead of
+     * the response size.
+     *
+     * The default implementation falls back to a single buffer built with \ref streamToSend.
+     *
+     * @param message Message to send to the client
+     * @param maxChunkSize Maximum size of each buffer
+     * @return Ordered buffers to send to the client, each one with its size
+     *
+     * @note this method not throw any exception.
+     */
+    virtual std::vector<std::tuple<std::unique_ptr<char[]>, std::size_t>>
+    streamToSendChunked(std::shared_ptr<std::string> message, std::size_t maxChunkSize)
+    {
+        std::vector<std::tuple<std::unique_ptr<char[]>, std::size_t>> buffers {};
+        buffers.emplace_back(streamToSend(std::move(message)));
+        return buffers;
+    }
+
     /**
      * @brief Get busy response to send to the client (if the server is busy)
      *
@@ -108,6 +135,70 @@ public:
     virtual std::shared_ptr<ProtocolHandler> create() = 0;
 };
 
+/**
+ * @brief Batched datagram framing of the event protocol.
+ *
+ * A legacy datagram carries exactly one event and always starts with the queue id character,
+ * never a NUL byte. A batched frame starts with a NUL marker and a version byte, followed by
+ * one length-prefixed event per entry up to the datagram size limit:
+ *
+ *   [0x00][version][len0 u32 LE][event0][len1 u32 LE][event1]...
+ *
+ * The marker makes the frame self-describing, so the receiver accepts both formats on the same
+ * socket and keeps no negotiation state: a capable sender opts in by emitting batched frames
+ * once the engine advertises the capability, a legacy sender keeps sending one event per
+ * datagram. Batching amortizes the syscall pair per datagram over the batch and pairs with the
+ * bulk queue push/pop of the ingress path.
+ */
+namespace framing
+{
+constexpr char BATCH_FRAME_MARKER = '\0';                         ///< First byte of a batched frame
+constexpr char BATCH_FRAME_VERSION = 0x01;                        ///< Current frame format version
+constexpr std::size_t BATCH_FRAME_HEADER_SIZE = 2;                ///< Marker + version
+constexpr std::size_t BATCH_FRAME_LENGTH_SIZE = sizeof(uint32_t); ///< Size of each event length prefix
+
+/**
+ * @brief Whether the datagram is a batched frame (starts with the marker).
+ *
+ * @param data The datagram payload.
+ */
+inline bool isBatchFrame(std::string_view data)
+{
+    return !data.empty() && BATCH_FRAME_MARKER == data[0];
+}
+
+/**
+ * @brief Split a batched frame into views of its events.
+ *
+ * The views point into the frame, the caller keeps it alive while they are used.
+ *
+ * @param frame The batched frame, including the header.
+ * @return std::vector<std::string_view> One view per non-empty event, in frame order.
+ * @throw std::runtime_error If the frame is truncated or its version is not supported.
+ */
+std::vector<std::string_view> splitBatchFrame(std::string_view frame);
+
+/**
+ * @brief Count the events of a batched frame without materializing the views.
+ *
+ * Intended for metrics on the receive path: a malformed tail stops the count instead of
+ * throwing.
+ *
+ * @param frame The batched frame, including the header.
+ * @return std::size_t The number of non-empty events counted.
+ */
+std::size_t batchFrameEventCount(std::string_view frame) noexcept;
+
+/**
+ * @brief Build a batched frame from a list of events.
+ *
+ * @param events The events to frame, in order.
+ * @return std::string The frame, ready to send as one datagram.
+ */
+std::string buildBatchFrame(const std::vector<std::string_view>& events);
+
+} // namespace framing
+
 } // namespace engineserver
 
 #endif // _SERVER_PROTOCOL_HANDLER_BASE_HPP
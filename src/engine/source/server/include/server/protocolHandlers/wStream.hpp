@@ -117,6 +117,12 @@ public:
      */
     std::tuple<std::unique_ptr<char[]>, std::size_t> streamToSend(const std::string& message) override;
 
+    /**
+     * @copydoc ProtocolHandler::streamToSendChunked
+     */
+    std::vector<std::tuple<std::unique_ptr<char[]>, std::size_t>>
+    streamToSendChunked(std::shared_ptr<std::string> message, std::size_t maxChunkSize) override;
+
     /**
      * @copydoc ProtocolHandler::getBusyResponse
      */
@@ -0,0 +1,153 @@
+#include <server/endpoints/clientSendQueue.hpp>
+
+#include <cstring>
+
+#include <base/logging.hpp>
+
+namespace engineserver::endpoint
+{
+
+std::shared_ptr<ClientSendQueue> ClientSendQueue::create(std::shared_ptr<uvw::Loop> loop,
+                                                         std::shared_ptr<uvw::PipeHandle> client)
+{
+    auto queue = std::shared_ptr<ClientSendQueue>(new ClientSendQueue(std::move(client)));
+
+    queue->m_check = loop->resource<uvw::CheckHandle>();
+    queue->m_check->on<uvw::CheckEvent>(
+        [wQueue = std::weak_ptr<ClientSendQueue>(queue)](const uvw::CheckEvent&, uvw::CheckHandle& check)
+        {
+            auto queue = wQueue.lock();
+            if (!queue)
+            {
+                check.close();
+                return;
+            }
+
+            queue->flush();
+            check.stop();
+        });
+
+    return queue;
+}
+
+void ClientSendQueue::send(std::unique_ptr<char[]>&& buffer, std::size_t size)
+{
+    if (0 == size)
+    {
+        return;
+    }
+
+    m_pendingBytes += size;
+    m_pending.emplace_back(std::move(buffer), size);
+
+    if (m_check && !m_check->closing())
+    {
+        m_check->start();
+    }
+}
+
+void ClientSendQueue::flush()
+{
+    auto client = m_wClient.lock();
+    if (!client || client->closing())
+    {
+        m_pending.clear();
+        m_pendingBytes = 0;
+        return;
+    }
+
+    for (std::size_t i = 0; i < m_pending.size();)
+    {
+        // Find how many consecutive buffers fit in a single bounded write
+        auto groupEnd = i;
+        std::size_t groupBytes = 0;
+        do
+        {
+            groupBytes += m_pending[groupEnd].second;
+            ++groupEnd;
+        } while (groupEnd < m_pending.size() && groupBytes + m_pending[groupEnd].second <= MAX_COALESCE_BYTES);
+
+        if (groupEnd == i + 1)
+        {
+            // Single buffer, write it untouched
+            auto& [buffer, size] = m_pending[i];
+            client->write(std::move(buffer), static_cast<unsigned int>(size));
+        }
+        else
+        {
+            // Coalesce the group into one contiguous write
+            auto coalesced = std::make_unique<char[]>(groupBytes);
+            std::size_t offset = 0;
+            for (auto j = i; j < groupEnd; ++j)
+            {
+                auto& [buffer, size] = m_pending[j];
+                std::memcpy(coalesced.get() + offset, buffer.get(), size);
+                offset += size;
+            }
+            client->write(std::move(coalesced), static_cast<unsigned int>(groupBytes));
+        }
+
+        i = groupEnd;
+    }
+
+    m_pending.clear();
+    m_pendingBytes = 0;
+}
+
+std::size_t ClientSendQueue::outstandingBytes() const
+{
+    auto client = m_wClient.lock();
+    auto inFlight = (client && !client->closing()) ? client->writeQueueSize() : 0;
+    return m_pendingBytes + inFlight;
+}
+
+void ClientSendQueue::pauseReadIfNeeded()
+{
+    if (m_readPaused || !overHighWatermark())
+    {
+        return;
+    }
+
+    auto client = m_wClient.lock();
+    if (client && !client->closing())
+    {
+        LOG_DEBUG("Client output above high watermark ({} bytes), pausing read", outstandingBytes());
+        client->stop();
+        m_readPaused = true;
+    }
+}
+
+void ClientSendQueue::resumeReadIfDrained()
+{
+    if (!m_readPaused)
+    {
+        return;
+    }
+
+    auto client = m_wClient.lock();
+    if (!client || client->closing())
+    {
+        m_readPaused = false;
+        return;
+    }
+
+    if (outstandingBytes() <= LOW_WATERMARK)
+    {
+        client->read();
+        m_readPaused = false;
+    }
+}
+
+void ClientSendQueue::close()
+{
+    m_pending.clear();
+    m_pendingBytes = 0;
+
+    if (m_check && !m_check->closing())
+    {
+        m_check->close();
+    }
+    m_check.reset();
+}
+
+} // namespace engineserver::endpoint
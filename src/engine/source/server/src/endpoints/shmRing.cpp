@@ -0,0 +1,400 @@
+#include <server/endpoints/shmRing.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>        // shm_open
+#include <linux/futex.h>  // FUTEX_WAIT / FUTEX_WAKE
+#include <sys/mman.h>     // mmap, madvise
+#include <sys/stat.h>     // shm_open mode
+#include <sys/syscall.h>  // SYS_futex
+#include <sys/time.h>     // timespec for FUTEX_WAIT
+#include <unistd.h>       // ftruncate, close
+
+#include <base/logging.hpp>
+#include <fmt/format.h>
+
+namespace
+{
+constexpr std::size_t RECORD_ALIGN {4}; ///< Record payloads are padded to this boundary
+
+/// @brief Align a ring offset up to the record boundary
+inline uint64_t alignUp(uint64_t offset)
+{
+    return (offset + (RECORD_ALIGN - 1)) & ~static_cast<uint64_t>(RECORD_ALIGN - 1);
+}
+
+/// @brief Wait on the futex word until it changes from expected or the timeout expires
+void futexWait(std::atomic<uint32_t>* word, uint32_t expected, long timeoutMs)
+{
+    struct timespec timeout
+    {
+        timeoutMs / 1000, (timeoutMs % 1000) * 1000000L
+    };
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+}
+
+/// @brief Wake the consumer waiting on the futex word
+void futexWake(std::atomic<uint32_t>* word)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+}
+} // namespace
+
+namespace engineserver::endpoint
+{
+
+ShmRing::ShmRing(const std::string& address,
+                 const std::function<void(std::string_view)>& callback,
+                 std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                 std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                 const uint32_t capacity)
+    : Endpoint(address, 0)
+    , m_callback(callback)
+    , m_shmFd(-1)
+    , m_map(nullptr)
+    , m_mapSize(0)
+    , m_header(nullptr)
+    , m_ring(nullptr)
+    , m_stop(false)
+    , m_paused(false)
+{
+    if (address.empty() || address[0] != '/')
+    {
+        throw std::runtime_error("Address must be a shared memory name starting with '/'");
+    }
+
+    if (!callback)
+    {
+        throw std::runtime_error("Callback must be set");
+    }
+
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+    {
+        throw std::runtime_error(fmt::format("Ring capacity [{}] must be a power of two", capacity));
+    }
+
+    m_mapSize = sizeof(shmring::Header) + capacity;
+
+    m_metric.m_metricsScope = std::move(metricsScope);
+    m_metric.m_byteRecv = m_metric.m_metricsScope->getCounterUInteger("BytesReceived");
+    m_metric.m_eventSize = m_metric.m_metricsScope->getHistogramUInteger("EventSizeHistory");
+
+    m_metric.m_metricsScopeDelta = std::move(metricsScopeDelta);
+    m_metric.m_byteRecvPerSecond = m_metric.m_metricsScopeDelta->getCounterUInteger("BytesReceivedPerSeconds");
+    m_metric.m_eventPerSecond = m_metric.m_metricsScopeDelta->getCounterUInteger("EventsReceivedPerSeconds");
+
+    // Recreate the segment so a stale one from a previous run cannot leak old offsets
+    shm_unlink(m_address.c_str());
+    m_shmFd = shm_open(m_address.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+    if (m_shmFd == -1)
+    {
+        throw std::runtime_error(
+            fmt::format("Cannot create shared memory segment '{}': {} ({})", m_address, strerror(errno), errno));
+    }
+
+    if (ftruncate(m_shmFd, m_mapSize) == -1)
+    {
+        auto msg =
+            fmt::format("Cannot size shared memory segment '{}': {} ({})", m_address, strerror(errno), errno);
+        ::close(m_shmFd);
+        shm_unlink(m_address.c_str());
+        throw std::runtime_error(msg);
+    }
+
+    m_map = mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_shmFd, 0);
+    if (m_map == MAP_FAILED)
+    {
+        auto msg = fmt::format("Cannot map shared memory segment '{}': {} ({})", m_address, strerror(errno), errno);
+        ::close(m_shmFd);
+        shm_unlink(m_address.c_str());
+        throw std::runtime_error(msg);
+    }
+
+    // shm_open segments cannot be MAP_HUGETLB backed, so the huge page coverage is a THP hint
+    if (madvise(m_map, m_mapSize, MADV_HUGEPAGE) == -1)
+    {
+        LOG_DEBUG("Shared memory segment '{}' could not be hinted as huge page backed: {} ({})",
+                  m_address,
+                  strerror(errno),
+                  errno);
+    }
+
+    m_header = static_cast<shmring::Header*>(m_map);
+    m_ring = static_cast<char*>(m_map) + sizeof(shmring::Header);
+
+    m_header->capacity = capacity;
+    m_header->head.store(0, std::memory_order_relaxed);
+    m_header->tail.store(0, std::memory_order_relaxed);
+    m_header->futexSeq.store(0, std::memory_order_relaxed);
+    m_header->waiting.store(0, std::memory_order_relaxed);
+    m_header->version = shmring::VERSION;
+    // The magic is published last so producers never see a half initialized control block
+    m_header->magic.store(shmring::MAGIC, std::memory_order_release);
+}
+
+ShmRing::~ShmRing()
+{
+    close();
+
+    // Never bound: the segment was created by the constructor and still has to be torn down
+    if (m_map != nullptr)
+    {
+        munmap(m_map, m_mapSize);
+        ::close(m_shmFd);
+        shm_unlink(m_address.c_str());
+    }
+}
+
+void ShmRing::bind(std::shared_ptr<uvw::Loop> loop)
+{
+    if (isBound())
+    {
+        throw std::runtime_error("Endpoint already bound");
+    }
+
+    m_loop = loop;
+    m_stop.store(false, std::memory_order_relaxed);
+    m_consumer = std::thread(
+        [this]()
+        {
+            try
+            {
+                consume();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Shared memory ring '{}' consumer stopped: {}", m_address, e.what());
+            }
+        });
+    m_running = true;
+}
+
+void ShmRing::consume()
+{
+    const auto capacity = m_header->capacity;
+    const auto mask = static_cast<uint64_t>(capacity) - 1;
+
+    while (!m_stop.load(std::memory_order_relaxed))
+    {
+        auto tail = m_header->tail.load(std::memory_order_relaxed);
+        const auto head = m_header->head.load(std::memory_order_acquire);
+
+        if (m_paused.load(std::memory_order_relaxed) || tail == head)
+        {
+            // Park until the producer publishes (or re-check periodically for stop/resume); the
+            // waiting flag and the re-read of head close the lost wake-up window
+            const auto seq = m_header->futexSeq.load(std::memory_order_relaxed);
+            m_header->waiting.store(1, std::memory_order_seq_cst);
+            if (m_header->head.load(std::memory_order_acquire) == tail || m_paused.load(std::memory_order_relaxed))
+            {
+                futexWait(&m_header->futexSeq, seq, 100);
+            }
+            m_header->waiting.store(0, std::memory_order_relaxed);
+            continue;
+        }
+
+        // Drain everything published by this point in one pass, then release the whole batch
+        while (tail != head)
+        {
+            uint32_t length {};
+            std::memcpy(&length, m_ring + (tail & mask), sizeof(length));
+
+            if (shmring::WRAP_MARKER == length)
+            {
+                // Skip the unused end of the ring
+                tail += capacity - (tail & mask);
+                continue;
+            }
+
+            if (length > capacity - sizeof(length))
+            {
+                throw std::runtime_error(fmt::format(
+                    "Corrupted record of [{}] bytes at offset [{}], ring capacity [{}]", length, tail, capacity));
+            }
+
+            std::string_view event {m_ring + ((tail + sizeof(length)) & mask), length};
+
+            m_metric.m_byteRecv->addValue(length);
+            m_metric.m_byteRecvPerSecond->addValue(length);
+            m_metric.m_eventPerSecond->addValue(1UL);
+            m_metric.m_eventSize->recordValue(static_cast<uint64_t>(length));
+
+            m_callback(event);
+
+            tail = alignUp(tail + sizeof(length) + length);
+        }
+        m_header->tail.store(tail, std::memory_order_release);
+    }
+}
+
+void ShmRing::close()
+{
+    if (!isBound())
+    {
+        return;
+    }
+
+    m_stop.store(true, std::memory_order_relaxed);
+    // Kick the consumer out of its futex wait so it observes the stop flag promptly
+    m_header->futexSeq.fetch_add(1, std::memory_order_relaxed);
+    futexWake(&m_header->futexSeq);
+    if (m_consumer.joinable())
+    {
+        m_consumer.join();
+    }
+
+    munmap(m_map, m_mapSize);
+    m_map = nullptr;
+    m_header = nullptr;
+    m_ring = nullptr;
+    ::close(m_shmFd);
+    m_shmFd = -1;
+    shm_unlink(m_address.c_str());
+
+    m_loop.reset();
+    m_running = false;
+}
+
+bool ShmRing::pause()
+{
+    if (isBound() && m_running)
+    {
+        m_paused.store(true, std::memory_order_relaxed);
+        m_running = false;
+        return true;
+    }
+    return false;
+}
+
+bool ShmRing::resume()
+{
+    if (isBound() && !m_running)
+    {
+        m_paused.store(false, std::memory_order_relaxed);
+        m_header->futexSeq.fetch_add(1, std::memory_order_relaxed);
+        futexWake(&m_header->futexSeq);
+        m_running = true;
+        return true;
+    }
+    return false;
+}
+
+ShmRingProducer::ShmRingProducer(const std::string& address, const std::size_t batchSize)
+    : m_shmFd(-1)
+    , m_map(nullptr)
+    , m_mapSize(0)
+    , m_header(nullptr)
+    , m_ring(nullptr)
+    , m_localHead(0)
+    , m_pending(0)
+    , m_batchSize(batchSize)
+{
+    m_shmFd = shm_open(address.c_str(), O_RDWR, 0660);
+    if (m_shmFd == -1)
+    {
+        throw std::runtime_error(
+            fmt::format("Cannot open shared memory segment '{}': {} ({})", address, strerror(errno), errno));
+    }
+
+    struct stat segmentStat {};
+    if (fstat(m_shmFd, &segmentStat) == -1 || static_cast<std::size_t>(segmentStat.st_size) < sizeof(shmring::Header))
+    {
+        ::close(m_shmFd);
+        throw std::runtime_error(fmt::format("Shared memory segment '{}' is not a ring segment", address));
+    }
+    m_mapSize = segmentStat.st_size;
+
+    m_map = mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_shmFd, 0);
+    if (m_map == MAP_FAILED)
+    {
+        auto msg = fmt::format("Cannot map shared memory segment '{}': {} ({})", address, strerror(errno), errno);
+        ::close(m_shmFd);
+        throw std::runtime_error(msg);
+    }
+
+    m_header = static_cast<shmring::Header*>(m_map);
+    if (m_header->magic.load(std::memory_order_acquire) != shmring::MAGIC || m_header->version != shmring::VERSION)
+    {
+        munmap(m_map, m_mapSize);
+        ::close(m_shmFd);
+        throw std::runtime_error(
+            fmt::format("Shared memory segment '{}' has an incompatible layout, falling back", address));
+    }
+
+    m_ring = static_cast<char*>(m_map) + sizeof(shmring::Header);
+    m_localHead = m_header->head.load(std::memory_order_relaxed);
+}
+
+ShmRingProducer::~ShmRingProducer()
+{
+    if (m_map != nullptr)
+    {
+        flush();
+        munmap(m_map, m_mapSize);
+    }
+    if (m_shmFd != -1)
+    {
+        ::close(m_shmFd);
+    }
+}
+
+bool ShmRingProducer::push(std::string_view event)
+{
+    const auto capacity = m_header->capacity;
+    const auto mask = static_cast<uint64_t>(capacity) - 1;
+    const auto recordSize = alignUp(sizeof(uint32_t) + event.size());
+    const auto tail = m_header->tail.load(std::memory_order_acquire);
+
+    auto head = m_localHead;
+    auto position = head & mask;
+
+    // A record never straddles the end of the ring: jump to the start when it does not fit
+    if (position + recordSize > capacity)
+    {
+        const auto wrapBytes = capacity - position;
+        if (head + wrapBytes + recordSize - tail > capacity)
+        {
+            return false;
+        }
+        const uint32_t marker {shmring::WRAP_MARKER};
+        std::memcpy(m_ring + position, &marker, sizeof(marker));
+        head += wrapBytes;
+        position = 0;
+    }
+    else if (head + recordSize - tail > capacity)
+    {
+        return false;
+    }
+
+    const auto length = static_cast<uint32_t>(event.size());
+    std::memcpy(m_ring + position, &length, sizeof(length));
+    std::memcpy(m_ring + position + sizeof(length), event.data(), event.size());
+
+    m_localHead = head + recordSize;
+    if (++m_pending >= m_batchSize)
+    {
+        flush();
+    }
+    return true;
+}
+
+void ShmRingProducer::flush()
+{
+    if (0 == m_pending)
+    {
+        return;
+    }
+
+    m_header->head.store(m_localHead, std::memory_order_release);
+    m_pending = 0;
+
+    m_header->futexSeq.fetch_add(1, std::memory_order_seq_cst);
+    if (m_header->waiting.load(std::memory_order_seq_cst) != 0)
+    {
+        futexWake(&m_header->futexSeq);
+    }
+}
+
+} // namespace engineserver::endpoint
@@ -6,7 +6,10 @@
 #include <sys/un.h>     // Unix socket datagram bind
 #include <unistd.h>     // Unix socket datagram bind
 
+#include <algorithm>
+
 #include <base/logging.hpp>
+#include <server/protocolHandler.hpp>
 #include <uvw.hpp>
 
 namespace
@@ -17,14 +20,16 @@ constexpr unsigned int MAX_MSG_SIZE {65536 + 512}; ///< Maximum message size (TO
 namespace engineserver::endpoint
 {
 UnixDatagram::UnixDatagram(const std::string& address,
-                           const std::function<void(const std::string&)>& callback,
+                           const std::function<void(std::string_view)>& callback,
                            std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
                            std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
-                           const std::size_t taskQueueSize)
+                           const std::size_t taskQueueSize,
+                           const std::size_t drainBatchSize)
     : Endpoint(address, taskQueueSize)
     , m_callback(callback)
-    , m_handle(nullptr)
+    , m_socketFd(-1)
     , m_bufferSize(-1)
+    , m_drainBatchSize(drainBatchSize)
 {
     if (address.empty())
     {
@@ -58,47 +63,113 @@ UnixDatagram::UnixDatagram(const std::string& address,
     m_metric.m_eventPerSecond = m_metric.m_metricsScopeDelta->getCounterUInteger("EventsReceivedPerSeconds");
 }
 
+std::shared_ptr<std::string> UnixDatagram::leaseBuffer()
+{
+    {
+        std::lock_guard<std::mutex> lock {m_bufferPoolMutex};
+        if (!m_bufferPool.empty())
+        {
+            auto buffer = std::move(m_bufferPool.back());
+            m_bufferPool.pop_back();
+            return buffer;
+        }
+    }
+
+    auto buffer = std::make_shared<std::string>();
+    buffer->reserve(MAX_MSG_SIZE);
+    return buffer;
+}
+
+void UnixDatagram::returnBuffer(std::shared_ptr<std::string>&& buffer)
+{
+    buffer->clear();
+    std::lock_guard<std::mutex> lock {m_bufferPoolMutex};
+    // The synchronous drain path holds one buffer per loop even with no task queue
+    const auto poolBound = std::max(m_taskQueueSize, m_drainBatchSize > 0 ? m_handles.size() : 0);
+    if (m_bufferPool.size() < poolBound)
+    {
+        m_bufferPool.emplace_back(std::move(buffer));
+    }
+}
+
 UnixDatagram::~UnixDatagram()
 {
     if (isBound())
     {
         // Close
-        m_handle->close();
-        m_handle = nullptr;
+        for (auto& loopHandle : m_handles)
+        {
+            loopHandle->handle->close();
+        }
+        m_handles.clear();
         unlink(m_address.c_str());
     }
 }
 
 void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
 {
+    int socketFd {-1};
     if (isBound())
     {
-        throw std::runtime_error("Endpoint already bound");
+        // Additional loops share the already bound socket; the kernel balances the datagrams
+        // between the listening handles (AF_UNIX has no SO_REUSEPORT, a shared descriptor is
+        // the equivalent).
+        socketFd = dup(m_socketFd);
+        if (-1 == socketFd)
+        {
+            throw std::runtime_error(
+                fmt::format("Cannot share the socket '{}': {} ({})", m_address, strerror(errno), errno));
+        }
     }
+    else
+    {
+        // Fresh bind, drop the handles of a previously closed socket
+        m_handles.clear();
+        m_loop = loop;
+        socketFd = bindUnixDatagramSocket(m_bufferSize);
+        m_socketFd = socketFd;
+    }
+
+    auto loopHandle = std::make_shared<LoopHandle>();
+    loopHandle->loop = loop;
+    loopHandle->handle = loop->resource<uvw::UDPHandle>();
+    m_handles.push_back(loopHandle);
+
+    configureHandle(loopHandle);
+
+    // Bind the socket
+    loopHandle->handle->open(socketFd);
+    loopHandle->handle->recv();
+    loopHandle->running = true;
+    m_running = true;
+}
 
-    m_loop = loop;
-    m_handle = m_loop->resource<uvw::UDPHandle>();
+void UnixDatagram::configureHandle(const std::shared_ptr<LoopHandle>& loopHandle)
+{
+    // The raw pointer is safe: the LoopHandle outlives its handle, whose events are the only users
+    auto* handleCtx = loopHandle.get();
 
     // Listen for incoming data
-    m_handle->on<uvw::UDPDataEvent>(
-        [this, functionName = logging::getLambdaName(__FUNCTION__, "handleUDPDataEvent")](
+    loopHandle->handle->on<uvw::UDPDataEvent>(
+        [this, handleCtx, functionName = logging::getLambdaName(__FUNCTION__, "handleUDPDataEvent")](
             const uvw::UDPDataEvent& event, uvw::UDPHandle& handle)
         {
-            // Get the data
-            auto data = std::string {event.data.get(), event.length};
-
-            // Update metrics
+            // Update metrics, a batched frame counts every event it carries
+            const std::string_view received {event.data.get(), event.length};
+            const auto eventCount =
+                framing::isBatchFrame(received) ? std::max<std::size_t>(framing::batchFrameEventCount(received), 1) : 1;
             m_metric.m_byteRecv->addValue(event.length);
             m_metric.m_byteRecvPerSecond->addValue(event.length);
-            m_metric.m_eventPerSecond->addValue(1UL);
+            m_metric.m_eventPerSecond->addValue(eventCount);
             m_metric.m_eventSize->recordValue(event.length);
 
-            // Call the callback if is synchronous
+            // Call the callback if is synchronous, passing a view of the receive buffer
+            // without copying the datagram
             if (0 == m_taskQueueSize)
             {
                 try
                 {
-                    m_callback(data);
+                    m_callback(std::string_view {event.data.get(), event.length});
                 }
                 catch (const std::exception& e)
                 {
@@ -106,70 +177,21 @@ void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
                         functionName.c_str(), "[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
                 }
 
+                // Traffic is arriving, service the rest of the burst before going back to the loop
+                drainSocket(handleCtx);
                 return;
             }
 
-            // Call the callback if is asynchronous, (TODO: Should be decrement the size of the workers?)
-            if (++m_currentTaskQueueSize >= m_taskQueueSize)
-
-            {
-                LOG_WARNING_L(functionName.c_str(), "[Endpoint: {}] Queue is full, pause listening.", m_address);
-                pause();
-                // Update metric
-                m_metric.m_busyQueue->addValue(1UL);
-            }
-            m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
-
-            // Create a job to the worker thread
-            std::shared_ptr<std::string> dataPtr {std::make_shared<std::string>(std::move(data))};
-            auto workerJob = m_loop->resource<uvw::WorkReq>(
-                [this, dataPtr, functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerRequest")]()
-                {
-                    try
-                    {
-                        m_callback(*dataPtr);
-                    }
-                    catch (const std::exception& e)
-                    {
-                        LOG_WARNING_L(
-                            functionName.c_str(), "[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
-                    }
-                });
-
-            // Listen for the job completion
-            workerJob->on<uvw::WorkEvent>(
-                [this, functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerEvent")](const uvw::WorkEvent&,
-                                                                                                 uvw::WorkReq& work)
-                {
-                    m_currentTaskQueueSize--;
-                    if (resume())
-                    {
-                        LOG_WARNING_L(functionName.c_str(), "[Endpoint: {}] Resume listening.", m_address);
-                    }
-                    m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
-                });
-
-            workerJob->on<uvw::ErrorEvent>(
-                [this, functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerErrorEvent")](
-                    const uvw::ErrorEvent& error, uvw::WorkReq& work)
-                {
-                    LOG_WARNING_L(functionName.c_str(),
-                                  "[Endpoint: {}] Error calling the callback: {}",
-                                  m_address,
-                                  error.what(),
-                                  error.code());
-                    m_currentTaskQueueSize--;
-                    if (resume())
-                    {
-                        LOG_WARNING_L(functionName.c_str(), "[Endpoint: {}] Resume listening.", m_address);
-                    }
-                    m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
-                });
-            workerJob->queue();
+            // Call the callback if is asynchronous, copying the datagram once into a buffer
+            // leased from the pool instead of allocating a fresh string per event
+            auto dataPtr = leaseBuffer();
+            dataPtr->assign(event.data.get(), event.length);
+            queueWorkerJob(handleCtx, std::move(dataPtr));
+            drainSocket(handleCtx);
         });
 
     // Listen for errors
-    m_handle->on<uvw::ErrorEvent>(
+    loopHandle->handle->on<uvw::ErrorEvent>(
         [this, functionName = logging::getLambdaName(__FUNCTION__, "handleErrorEvent")](const uvw::ErrorEvent& event,
                                                                                         uvw::UDPHandle& handle)
         {
@@ -182,25 +204,146 @@ void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
                           event.what());
         });
 
-    m_handle->on<uvw::CloseEvent>(
+    loopHandle->handle->on<uvw::CloseEvent>(
         [this, functionName = logging::getLambdaName(__FUNCTION__, "handleCloseEvent")](const uvw::CloseEvent& event,
                                                                                         uvw::UDPHandle& handle)
         {
             // Log the error
             LOG_INFO_L(functionName.c_str(), "[Endpoint: {}] Closed.", m_address);
         });
-    // Bind the socket
-    auto socketFd = bindUnixDatagramSocket(m_bufferSize);
-    m_handle->open(socketFd);
-    resume();
+}
+
+void UnixDatagram::queueWorkerJob(LoopHandle* handleCtx, std::shared_ptr<std::string>&& dataPtr)
+{
+    // (TODO: Should be decrement the size of the workers?)
+    if (++m_currentTaskQueueSize >= m_taskQueueSize)
+    {
+        LOG_WARNING("[Endpoint: {}] Queue is full, pause listening.", m_address);
+        // Pause only this loop's handle, the other loops pause themselves when saturated
+        if (handleCtx->running)
+        {
+            handleCtx->handle->stop();
+            handleCtx->running = false;
+        }
+        // Update metric
+        m_metric.m_busyQueue->addValue(1UL);
+    }
+    m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
+
+    // Create a job to the worker thread
+    auto workerJob = handleCtx->loop->resource<uvw::WorkReq>(
+        [this, dataPtr, functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerRequest")]()
+        {
+            try
+            {
+                m_callback(std::string_view {*dataPtr});
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING_L(
+                    functionName.c_str(), "[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
+            }
+        });
+
+    // Listen for the job completion
+    workerJob->on<uvw::WorkEvent>(
+        [this, handleCtx, dataPtr, functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerEvent")](
+            const uvw::WorkEvent&, uvw::WorkReq& work)
+        {
+            returnBuffer(std::shared_ptr<std::string> {dataPtr});
+            m_currentTaskQueueSize--;
+            if (!handleCtx->running && isBound())
+            {
+                handleCtx->handle->recv();
+                handleCtx->running = true;
+                LOG_WARNING_L(functionName.c_str(), "[Endpoint: {}] Resume listening.", m_address);
+            }
+            m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
+        });
+
+    workerJob->on<uvw::ErrorEvent>(
+        [this, handleCtx, dataPtr, functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerErrorEvent")](
+            const uvw::ErrorEvent& error, uvw::WorkReq& work)
+        {
+            returnBuffer(std::shared_ptr<std::string> {dataPtr});
+            LOG_WARNING_L(functionName.c_str(),
+                          "[Endpoint: {}] Error calling the callback: {}",
+                          m_address,
+                          error.what(),
+                          error.code());
+            m_currentTaskQueueSize--;
+            if (!handleCtx->running && isBound())
+            {
+                handleCtx->handle->recv();
+                handleCtx->running = true;
+                LOG_WARNING_L(functionName.c_str(), "[Endpoint: {}] Resume listening.", m_address);
+            }
+            m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
+        });
+    workerJob->queue();
+}
+
+void UnixDatagram::drainSocket(LoopHandle* handleCtx)
+{
+    if (0 == m_drainBatchSize)
+    {
+        return;
+    }
+
+    auto dataPtr = leaseBuffer();
+    for (std::size_t drained = 0; drained < m_drainBatchSize && handleCtx->running; ++drained)
+    {
+        dataPtr->resize(MAX_MSG_SIZE);
+        const auto length = ::recv(m_socketFd, dataPtr->data(), MAX_MSG_SIZE, MSG_DONTWAIT);
+        if (length < 0)
+        {
+            // Socket is dry (EAGAIN) or errored, fall back to the loop's epoll sleep
+            break;
+        }
+        dataPtr->resize(length);
+
+        // Update metrics, a batched frame counts every event it carries
+        const std::string_view datagram {*dataPtr};
+        const auto eventCount =
+            framing::isBatchFrame(datagram) ? std::max<std::size_t>(framing::batchFrameEventCount(datagram), 1) : 1;
+        m_metric.m_byteRecv->addValue(length);
+        m_metric.m_byteRecvPerSecond->addValue(length);
+        m_metric.m_eventPerSecond->addValue(eventCount);
+        m_metric.m_eventSize->recordValue(length);
+
+        // Synchronous path reuses the same buffer for the whole batch
+        if (0 == m_taskQueueSize)
+        {
+            try
+            {
+                m_callback(datagram);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
+            }
+            continue;
+        }
+
+        // Asynchronous path hands the buffer to the worker, pausing the handle stops the drain
+        queueWorkerJob(handleCtx, std::move(dataPtr));
+        dataPtr = leaseBuffer();
+    }
+    returnBuffer(std::move(dataPtr));
 }
 
 void UnixDatagram::close()
 {
     if (isBound())
     {
-        m_handle->close();
-        m_handle.reset();
+        // The LoopHandle objects are kept alive for any pending worker completion, the next
+        // fresh bind drops them
+        for (auto& loopHandle : m_handles)
+        {
+            loopHandle->handle->close();
+            loopHandle->running = false;
+        }
+        m_socketFd = -1;
         m_loop.reset();
         m_running = false;
     }
@@ -210,7 +353,14 @@ bool UnixDatagram::pause()
 {
     if (m_running && isBound())
     {
-        m_handle->stop();
+        for (auto& loopHandle : m_handles)
+        {
+            if (loopHandle->running)
+            {
+                loopHandle->handle->stop();
+                loopHandle->running = false;
+            }
+        }
         m_running = false;
         return true;
     }
@@ -221,7 +371,14 @@ bool UnixDatagram::resume()
 {
     if (!m_running && isBound())
     {
-        m_handle->recv();
+        for (auto& loopHandle : m_handles)
+        {
+            if (!loopHandle->running)
+            {
+                loopHandle->handle->recv();
+                loopHandle->running = true;
+            }
+        }
         m_running = true;
         return true;
     }
@@ -155,11 +155,18 @@ std::shared_ptr<uvw::PipeHandle> UnixStream::createClient()
 
     auto sharedAsyncs = std::make_shared<std::vector<std::weak_ptr<uvw::AsyncHandle>>>();
 
+    // Create the output queue for the client, responses are coalesced on the loop tick
+    auto sendQueue = ClientSendQueue::create(m_loop, client);
+
     // Create a new timer for the client timeout
     auto timer = createTimer(weakClient, sharedAsyncs);
 
     // Configure the close events for the client
-    configureCloseClient(client, timer, sharedAsyncs);
+    configureCloseClient(client, timer, sharedAsyncs, sendQueue);
+
+    // Resume reading once the pending output drained below the watermark
+    client->on<uvw::WriteEvent>([sendQueue](const uvw::WriteEvent&, uvw::PipeHandle&)
+                                { sendQueue->resumeReadIfDrained(); });
 
     // Create protocol handler per client
     auto protocolHandler = m_factory->create();
@@ -168,6 +175,7 @@ std::shared_ptr<uvw::PipeHandle> UnixStream::createClient()
         [this,
          weakClient,
          sharedAsyncs,
+         sendQueue,
          timer,
          protocolHandler,
          functionName = logging::getLambdaName(__FUNCTION__, "clientDataEvent")](const uvw::DataEvent& data,
@@ -210,7 +218,10 @@ std::shared_ptr<uvw::PipeHandle> UnixStream::createClient()
             m_metric.m_totalRequest->addValue(result->size());
             m_metric.m_requestPerSecond->addValue(result->size());
 
-            processMessages(weakClient, sharedAsyncs, protocolHandler, std::move(result.value()));
+            processMessages(weakClient, sharedAsyncs, sendQueue, protocolHandler, std::move(result.value()));
+
+            // Backpressure: stop reading from a client whose responses are not draining
+            sendQueue->pauseReadIfNeeded();
         });
 
     // Accept the connection
@@ -220,6 +231,7 @@ std::shared_ptr<uvw::PipeHandle> UnixStream::createClient()
 
 void UnixStream::processMessages(std::weak_ptr<uvw::PipeHandle> wClient,
                                  std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs,
+                                 std::shared_ptr<ClientSendQueue> sendQueue,
                                  std::shared_ptr<ProtocolHandler> protocolHandler,
                                  std::vector<std::string>&& requests)
 {
@@ -229,6 +241,7 @@ void UnixStream::processMessages(std::weak_ptr<uvw::PipeHandle> wClient,
         if (0 == m_taskQueueSize)
         {
             auto callbackFn = [wClient,
+                               sendQueue,
                                address = m_address,
                                protocolHandler,
                                metric = m_metric,
@@ -252,9 +265,9 @@ void UnixStream::processMessages(std::weak_ptr<uvw::PipeHandle> wClient,
                     return;
                 }
 
-                // Send the response
+                // Queue the response, it goes out coalesced with the rest of the burst
                 auto [buffer, size] = protocolHandler->streamToSend(response);
-                client->write(std::move(buffer), size);
+                sendQueue->send(std::move(buffer), size);
                 auto elapsedTime = responseTimer->elapsed<std::chrono::milliseconds>();
                 metric.m_responseTime->recordValue(static_cast<uint64_t>(elapsedTime));
             };
@@ -275,7 +288,7 @@ void UnixStream::processMessages(std::weak_ptr<uvw::PipeHandle> wClient,
                 LOG_WARNING("[Endpoint: {}] endpoint: Client already closed", m_address);
                 return;
             }
-            client->write(std::move(buffer), size);
+            sendQueue->send(std::move(buffer), size);
 
             auto elapsedTime = responseTimer.elapsed<std::chrono::milliseconds>();
             m_metric.m_responseTime->recordValue(static_cast<uint64_t>(elapsedTime));
@@ -283,12 +296,13 @@ void UnixStream::processMessages(std::weak_ptr<uvw::PipeHandle> wClient,
             continue;
         }
 
-        createAndEnqueueTask(wClient, asyncs, protocolHandler, std::move(request));
+        createAndEnqueueTask(wClient, asyncs, sendQueue, protocolHandler, std::move(request));
     }
 }
 
 void UnixStream::createAndEnqueueTask(std::weak_ptr<uvw::PipeHandle> wClient,
                                       std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs,
+                                      std::shared_ptr<ClientSendQueue> sendQueue,
                                       std::shared_ptr<ProtocolHandler> protocolHandler,
                                       std::string&& request)
 {
@@ -304,6 +318,7 @@ void UnixStream::createAndEnqueueTask(std::weak_ptr<uvw::PipeHandle> wClient,
 
     async->on<uvw::AsyncEvent>(
         [wClient,
+         sendQueue,
          address = m_address,
          metric = m_metric,
          responseTimer,
@@ -329,9 +344,21 @@ void UnixStream::createAndEnqueueTask(std::weak_ptr<uvw::PipeHandle> wClient,
                 return;
             }
 
-            // Send the response
-            auto [buffer, size] = protocolHandler->streamToSend(response);
-            client->write(std::move(buffer), size);
+            // Send the response. Large responses go out as a sequence of bounded writes, so
+            // the send path never needs one contiguous allocation of the whole frame and each
+            // chunk is released as soon as its write completes
+            if (response->size() >= CHUNKED_RESPONSE_THRESHOLD)
+            {
+                for (auto&& [buffer, size] : protocolHandler->streamToSendChunked(response, RESPONSE_CHUNK_SIZE))
+                {
+                    sendQueue->send(std::move(buffer), size);
+                }
+            }
+            else
+            {
+                auto [buffer, size] = protocolHandler->streamToSend(response);
+                sendQueue->send(std::move(buffer), size);
+            }
             auto elapsedTime = responseTimer->elapsed<std::chrono::milliseconds>();
             metric.m_responseTime->recordValue(static_cast<uint64_t>(elapsedTime));
 
@@ -474,11 +501,13 @@ UnixStream::createTimer(std::weak_ptr<uvw::PipeHandle> wClient,
 
 void UnixStream::configureCloseClient(std::shared_ptr<uvw::PipeHandle> client,
                                       std::shared_ptr<uvw::TimerHandle> timer,
-                                      std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs)
+                                      std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs,
+                                      std::shared_ptr<ClientSendQueue> sendQueue)
 {
 
     auto gracefullEnd = [timer,
                          asyncs,
+                         sendQueue,
                          metric = m_metric,
                          address = m_address,
                          functionName = logging::getLambdaName(__FUNCTION__, "gracefullEnd")](uvw::PipeHandle& client)
@@ -488,6 +517,7 @@ void UnixStream::configureCloseClient(std::shared_ptr<uvw::PipeHandle> client,
             timer->stop();
             timer->close();
         }
+        sendQueue->close();
         for (auto& wAsync : *asyncs)
         {
             auto sAsync = wAsync.lock();
@@ -9,6 +9,7 @@
 #include <exception>
 
 #include <base/logging.hpp>
+#include <base/utils/threadAffinity.hpp>
 
 namespace
 { /**
@@ -41,14 +42,50 @@ void changeUVTreadPoolWorkerSize(int newSize)
 namespace engineserver
 {
 
-EngineServer::EngineServer(int threadPoolSize)
+EngineServer::EngineServer(int threadPoolSize, int eventLoops, std::vector<int> coreSet)
+    : m_coreSet(std::move(coreSet))
 {
     // Change the size of the thread pool worker
     changeUVTreadPoolWorkerSize(threadPoolSize);
 
+    if (eventLoops < 1)
+    {
+        throw std::runtime_error("Invalid number of event loops.");
+    }
+
     m_loop = uvw::Loop::getDefault();
     m_status = Status::STOPPED;
 
+    // Extra loops for the distributed endpoints, each one runs in its own thread
+    for (int i = 1; i < eventLoops; ++i)
+    {
+        auto loop = uvw::Loop::create();
+
+        auto stopHandle = loop->resource<uvw::AsyncHandle>();
+        stopHandle->on<uvw::AsyncEvent>(
+            [loop](const uvw::AsyncEvent&, uvw::AsyncHandle&)
+            {
+                loop->walk(
+                    [](auto& handle)
+                    {
+                        if (!handle.closing())
+                        {
+                            handle.close();
+                        }
+                    });
+                loop->stop();
+                loop->run<uvw::Loop::Mode::ONCE>();
+            });
+
+        loop->on<uvw::ErrorEvent>(
+            [functionName = logging::getLambdaName(__FUNCTION__, "handleIngestErrorEvent")](const uvw::ErrorEvent& e,
+                                                                                            uvw::Loop&)
+            { LOG_ERROR_L(functionName.c_str(), "Error: {} - {}", e.name(), e.what()); });
+
+        m_ingestStopHandles.emplace_back(std::move(stopHandle));
+        m_ingestLoops.emplace_back(std::move(loop));
+    }
+
     m_stopHandle = m_loop->resource<uvw::AsyncHandle>();
     m_stopHandle->on<uvw::AsyncEvent>(
         [this](const uvw::AsyncEvent&, uvw::AsyncHandle&)
@@ -70,6 +107,27 @@ EngineServer::~EngineServer()
     { // The log should be initialized
         this->stop();
     }
+    for (auto& thread : m_ingestThreads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+    for (auto& loop : m_ingestLoops)
+    {
+        // Flush any handle left open (e.g. the loop never ran) before closing the loop
+        loop->walk(
+            [](auto& handle)
+            {
+                if (!handle.closing())
+                {
+                    handle.close();
+                }
+            });
+        loop->run<uvw::Loop::Mode::ONCE>();
+        loop->close();
+    }
     m_loop->close();
 };
 
@@ -77,7 +135,36 @@ void EngineServer::start()
 {
     LOG_INFO("Starting the server...");
     m_status = Status::RUNNING;
+
+    // Pin the loop threads so the ingestion endpoints stay on the configured cores and the
+    // event buffers they first touch stay local to that NUMA node
+    if (!m_coreSet.empty() && !base::utils::affinity::pinCurrentThread(m_coreSet))
+    {
+        LOG_WARNING("Could not pin the server loop to its core set");
+    }
+
+    // Run the extra loops, each in its own thread
+    m_ingestThreads.reserve(m_ingestLoops.size());
+    for (auto& loop : m_ingestLoops)
+    {
+        m_ingestThreads.emplace_back(
+            [loop, coreSet = m_coreSet]()
+            {
+                if (!coreSet.empty() && !base::utils::affinity::pinCurrentThread(coreSet))
+                {
+                    LOG_WARNING("Could not pin an ingest loop to its core set");
+                }
+                loop->run<uvw::Loop::Mode::DEFAULT>();
+            });
+    }
+
     m_loop->run<uvw::Loop::Mode::DEFAULT>();
+
+    for (auto& thread : m_ingestThreads)
+    {
+        thread.join();
+    }
+    m_ingestThreads.clear();
     LOG_INFO("Server stopped");
 }
 
@@ -85,6 +172,11 @@ void EngineServer::stop()
 {
 
     LOG_INFO("Stopping the server");
+    LOG_DEBUG("Stopping ingest loops");
+    for (auto& stopHandle : m_ingestStopHandles)
+    {
+        stopHandle->send();
+    }
     LOG_DEBUG("Closing handlers");
     m_loop->walk(
         [](auto& handle)
@@ -107,7 +199,7 @@ void EngineServer::request_stop()
     m_stopHandle->send();
 }
 
-void EngineServer::addEndpoint(const std::string& name, std::shared_ptr<Endpoint> endpoint)
+void EngineServer::addEndpoint(const std::string& name, std::shared_ptr<Endpoint> endpoint, bool distribute)
 {
     LOG_DEBUG("Adding endpoint {}", name);
     // first check if the endpoint already exists
@@ -117,6 +209,14 @@ void EngineServer::addEndpoint(const std::string& name, std::shared_ptr<Endpoint
     }
     // add the endpoint
     endpoint->bind(m_loop);
+    if (distribute)
+    {
+        // Bind the endpoint to every extra loop too, each one reads from the shared socket
+        for (auto& loop : m_ingestLoops)
+        {
+            endpoint->bind(loop);
+        }
+    }
     m_endpoints[name] = endpoint;
 }
 } // namespace engineserver
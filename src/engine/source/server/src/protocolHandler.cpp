@@ -1,5 +1,112 @@
 #include <server/protocolHandler.hpp>
 
-namespace engineserver
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace engineserver::framing
+{
+
+namespace
+{
+/**
+ * @brief Read an event length prefix. The frame is little-endian, as every platform the engine
+ * targets.
+ */
+inline uint32_t readLength(const char* data)
 {
-} // namespace engineserver
+    uint32_t length {};
+    std::memcpy(&length, data, sizeof(length));
+    return length;
+}
+} // namespace
+
+std::vector<std::string_view> splitBatchFrame(std::string_view frame)
+{
+    if (!isBatchFrame(frame) || frame.size() < BATCH_FRAME_HEADER_SIZE)
+    {
+        throw std::runtime_error {"Batched frame is too short"};
+    }
+
+    if (BATCH_FRAME_VERSION != frame[1])
+    {
+        throw std::runtime_error {fmt::format("Unsupported batched frame version: {}", static_cast<int>(frame[1]))};
+    }
+
+    std::vector<std::string_view> events {};
+    std::size_t offset = BATCH_FRAME_HEADER_SIZE;
+    while (offset < frame.size())
+    {
+        if (frame.size() - offset < BATCH_FRAME_LENGTH_SIZE)
+        {
+            throw std::runtime_error {"Batched frame has a truncated length prefix"};
+        }
+        const auto length = readLength(frame.data() + offset);
+        offset += BATCH_FRAME_LENGTH_SIZE;
+
+        if (frame.size() - offset < length)
+        {
+            throw std::runtime_error {"Batched frame has a truncated event"};
+        }
+        if (length > 0)
+        {
+            events.emplace_back(frame.data() + offset, length);
+        }
+        offset += length;
+    }
+
+    return events;
+}
+
+std::size_t batchFrameEventCount(std::string_view frame) noexcept
+{
+    if (!isBatchFrame(frame) || frame.size() < BATCH_FRAME_HEADER_SIZE || BATCH_FRAME_VERSION != frame[1])
+    {
+        return 0;
+    }
+
+    std::size_t count = 0;
+    std::size_t offset = BATCH_FRAME_HEADER_SIZE;
+    while (frame.size() - offset >= BATCH_FRAME_LENGTH_SIZE)
+    {
+        const auto length = readLength(frame.data() + offset);
+        offset += BATCH_FRAME_LENGTH_SIZE;
+
+        if (frame.size() - offset < length)
+        {
+            break;
+        }
+        if (length > 0)
+        {
+            ++count;
+        }
+        offset += length;
+    }
+
+    return count;
+}
+
+std::string buildBatchFrame(const std::vector<std::string_view>& events)
+{
+    std::size_t frameSize = BATCH_FRAME_HEADER_SIZE;
+    for (const auto& event : events)
+    {
+        frameSize += BATCH_FRAME_LENGTH_SIZE + event.size();
+    }
+
+    std::string frame {};
+    frame.reserve(frameSize);
+    frame.push_back(BATCH_FRAME_MARKER);
+    frame.push_back(BATCH_FRAME_VERSION);
+    for (const auto& event : events)
+    {
+        const uint32_t length = static_cast<uint32_t>(event.size());
+        frame.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        frame.append(event.data(), event.size());
+    }
+
+    return frame;
+}
+
+} // namespace engineserver::framing
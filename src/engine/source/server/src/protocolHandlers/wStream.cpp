@@ -1,5 +1,6 @@
 #include <server/protocolHandlers/wStream.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 
@@ -14,37 +15,64 @@ const std::shared_ptr<std::string> WStream::m_errorResponse = std::make_shared<s
 std::optional<std::vector<std::string>> WStream::onData(std::string_view data)
 {
     std::vector<std::string> messages;
+    std::size_t offset {0};
 
-    for (auto c : data)
+    // Extract every complete frame of the read buffer in one pass; only the trailing partial
+    // frame (and a partial header) is buffered between reads
+    while (offset < data.size())
     {
         if (m_stage == Stage::HEADER)
         {
-            m_header.push_back(c);
-            if (m_header.size() == m_headerSize)
+            const auto take = std::min(data.size() - offset, static_cast<std::size_t>(m_headerSize) - m_header.size());
+            m_header.append(data.data() + offset, take);
+            offset += take;
+
+            if (m_header.size() < static_cast<std::size_t>(m_headerSize))
+            {
+                break; // Partial header, wait for the next read
+            }
+
+            std::memcpy(&m_pending, m_header.data(), m_headerSize);
+            if (m_pending < 0 || m_pending > maxPayloadSize)
             {
-                std::memcpy(&m_pending, m_header.data(), m_headerSize);
-                if (m_pending > maxPayloadSize)
-                {
-                    auto msg = fmt::format(
-                        "Payload size [{} bytes] exceeded the maximum allowed [{} bytes]", m_pending, maxPayloadSize);
-                    reset();
-                    throw std::runtime_error(msg);
-                }
-                m_stage = Stage::PAYLOAD;
+                auto msg = fmt::format(
+                    "Payload size [{} bytes] exceeded the maximum allowed [{} bytes]", m_pending, maxPayloadSize);
+                reset();
+                throw std::runtime_error(msg);
             }
+            m_stage = Stage::PAYLOAD;
         }
         else
         {
-            m_payload.push_back(c);
-            if (m_payload.size() == m_pending)
+            const auto pending = static_cast<std::size_t>(m_pending) - m_payload.size();
+            const auto available = data.size() - offset;
+
+            if (available < pending)
             {
-                messages.push_back(m_payload);
-                m_payload.clear();
-                m_header.clear();
-                m_stage = Stage::HEADER;
+                // Trailing partial frame, the only payload bytes copied without emitting a message
+                m_payload.append(data.data() + offset, available);
+                break;
             }
+
+            if (m_payload.empty())
+            {
+                // Frame fully contained in the read buffer, copy it once straight into the message
+                messages.emplace_back(data.substr(offset, pending));
+            }
+            else
+            {
+                // Frame started in a previous read, complete it
+                m_payload.append(data.data() + offset, pending);
+                messages.emplace_back(std::move(m_payload));
+            }
+            offset += pending;
+
+            m_payload.clear();
+            m_header.clear();
+            m_stage = Stage::HEADER;
         }
     }
+
     return messages.empty() ? std::nullopt : std::optional<std::vector<std::string>>(std::move(messages));
 }
 
@@ -66,6 +94,30 @@ std::tuple<std::unique_ptr<char[]>, std::size_t> WStream::streamToSend(const std
     return {std::move(buffer), size + 4};
 }
 
+std::vector<std::tuple<std::unique_ptr<char[]>, std::size_t>>
+WStream::streamToSendChunked(std::shared_ptr<std::string> message, std::size_t maxChunkSize)
+{
+    const auto size = message->size();
+
+    std::vector<std::tuple<std::unique_ptr<char[]>, std::size_t>> buffers {};
+    buffers.reserve(2 + size / maxChunkSize);
+
+    // Header with the total payload size, the payload follows split in bounded buffers
+    auto header = std::make_unique<char[]>(m_headerSize);
+    std::memcpy(header.get(), &size, m_headerSize);
+    buffers.emplace_back(std::move(header), m_headerSize);
+
+    for (std::size_t offset = 0; offset < size; offset += maxChunkSize)
+    {
+        const auto chunkSize = std::min(maxChunkSize, size - offset);
+        auto chunk = std::make_unique<char[]>(chunkSize);
+        std::memcpy(chunk.get(), message->data() + offset, chunkSize);
+        buffers.emplace_back(std::move(chunk), chunkSize);
+    }
+
+    return buffers;
+}
+
 std::tuple<std::unique_ptr<char[]>, std::size_t> WStream::getBusyResponse()
 {
     return streamToSend(m_busyResponse);
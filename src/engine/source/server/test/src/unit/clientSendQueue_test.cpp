@@ -0,0 +1,193 @@
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+#include <uvw.hpp>
+
+#include <base/logging.hpp>
+#include <server/endpoints/clientSendQueue.hpp>
+
+using namespace engineserver::endpoint;
+
+namespace
+{
+std::filesystem::path uniquePath()
+{
+    auto pid = getpid();
+    auto tid = std::this_thread::get_id();
+    std::stringstream ss;
+    ss << pid << "_" << tid; // Unique path per thread and process
+    return std::filesystem::path("/tmp") / (ss.str() + "_clientSendQueue_test.sock");
+}
+
+std::unique_ptr<char[]> makeBuffer(const std::string& content)
+{
+    auto buffer = std::make_unique<char[]>(content.size());
+    std::memcpy(buffer.get(), content.data(), content.size());
+    return buffer;
+}
+} // namespace
+
+class ClientSendQueueTest : public ::testing::Test
+{
+protected:
+    std::string m_path;
+    std::shared_ptr<uvw::Loop> m_loop;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        m_path = uniquePath().string();
+        ::unlink(m_path.c_str());
+        m_loop = uvw::Loop::create();
+    }
+
+    void TearDown() override
+    {
+        m_loop->walk([](auto& handle) { handle.close(); });
+        m_loop->run<uvw::Loop::Mode::NOWAIT>();
+        m_loop->close();
+        ::unlink(m_path.c_str());
+    }
+
+    int connectRawClient()
+    {
+        auto fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        EXPECT_NE(fd, -1);
+
+        sockaddr_un addr {};
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, m_path.c_str(), sizeof(addr.sun_path) - 1);
+        EXPECT_EQ(::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+        return fd;
+    }
+};
+
+TEST_F(ClientSendQueueTest, FlushesBurstInOrder)
+{
+    auto server = m_loop->resource<uvw::PipeHandle>();
+    server->bind(m_path);
+
+    std::shared_ptr<uvw::PipeHandle> accepted;
+    std::shared_ptr<ClientSendQueue> queue;
+    server->on<uvw::ListenEvent>(
+        [&](const uvw::ListenEvent&, uvw::PipeHandle& handle)
+        {
+            accepted = m_loop->resource<uvw::PipeHandle>();
+            handle.accept(*accepted);
+
+            queue = ClientSendQueue::create(m_loop, accepted);
+            queue->send(makeBuffer("one"), 3);
+            queue->send(makeBuffer("two"), 3);
+            queue->send(makeBuffer("three"), 5);
+        });
+    server->listen();
+
+    auto fd = connectRawClient();
+
+    std::string received;
+    for (auto i = 0; i < 500 && received.size() < 11; ++i)
+    {
+        m_loop->run<uvw::Loop::Mode::NOWAIT>();
+
+        char buffer[64];
+        auto bytes = ::recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (bytes > 0)
+        {
+            received.append(buffer, bytes);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_EQ(received, "onetwothree");
+    ::close(fd);
+}
+
+TEST_F(ClientSendQueueTest, LargeBuffersKeepOrderWithSmallOnes)
+{
+    auto server = m_loop->resource<uvw::PipeHandle>();
+    server->bind(m_path);
+
+    const std::string large(ClientSendQueue::MAX_COALESCE_BYTES + 1, 'X');
+    const auto expectedSize = 5 + large.size() + 4;
+
+    std::shared_ptr<uvw::PipeHandle> accepted;
+    std::shared_ptr<ClientSendQueue> queue;
+    server->on<uvw::ListenEvent>(
+        [&](const uvw::ListenEvent&, uvw::PipeHandle& handle)
+        {
+            accepted = m_loop->resource<uvw::PipeHandle>();
+            handle.accept(*accepted);
+
+            queue = ClientSendQueue::create(m_loop, accepted);
+            queue->send(makeBuffer("head:"), 5);
+            queue->send(makeBuffer(large), large.size());
+            queue->send(makeBuffer("tail"), 4);
+        });
+    server->listen();
+
+    auto fd = connectRawClient();
+
+    std::string received;
+    received.reserve(expectedSize);
+    for (auto i = 0; i < 5000 && received.size() < expectedSize; ++i)
+    {
+        m_loop->run<uvw::Loop::Mode::NOWAIT>();
+
+        char buffer[64 * 1024];
+        auto bytes = ::recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (bytes > 0)
+        {
+            received.append(buffer, bytes);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_EQ(received, "head:" + large + "tail");
+    ::close(fd);
+}
+
+TEST_F(ClientSendQueueTest, CloseDropsPending)
+{
+    auto server = m_loop->resource<uvw::PipeHandle>();
+    server->bind(m_path);
+
+    std::shared_ptr<uvw::PipeHandle> accepted;
+    std::shared_ptr<ClientSendQueue> queue;
+    server->on<uvw::ListenEvent>(
+        [&](const uvw::ListenEvent&, uvw::PipeHandle& handle)
+        {
+            accepted = m_loop->resource<uvw::PipeHandle>();
+            handle.accept(*accepted);
+
+            queue = ClientSendQueue::create(m_loop, accepted);
+            queue->send(makeBuffer("dropped"), 7);
+            queue->close();
+        });
+    server->listen();
+
+    auto fd = connectRawClient();
+
+    std::string received;
+    for (auto i = 0; i < 50; ++i)
+    {
+        m_loop->run<uvw::Loop::Mode::NOWAIT>();
+
+        char buffer[64];
+        auto bytes = ::recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (bytes > 0)
+        {
+            received.append(buffer, bytes);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_TRUE(received.empty());
+    ::close(fd);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <server/protocolHandler.hpp>
+
+using namespace engineserver;
+
+TEST(BatchFraming, SingleEventIsNotABatch)
+{
+    EXPECT_FALSE(framing::isBatchFrame("1:location:message"));
+    EXPECT_FALSE(framing::isBatchFrame(""));
+}
+
+TEST(BatchFraming, RoundTrip)
+{
+    const std::vector<std::string_view> events {"1:loc:first", "2:loc:second", "4:loc:third"};
+    const auto frame = framing::buildBatchFrame(events);
+
+    ASSERT_TRUE(framing::isBatchFrame(frame));
+    EXPECT_EQ(framing::batchFrameEventCount(frame), events.size());
+
+    const auto split = framing::splitBatchFrame(frame);
+    ASSERT_EQ(split.size(), events.size());
+    for (std::size_t i = 0; i < events.size(); ++i)
+    {
+        EXPECT_EQ(split[i], events[i]);
+    }
+}
+
+TEST(BatchFraming, EmptyBatch)
+{
+    const auto frame = framing::buildBatchFrame({});
+    ASSERT_TRUE(framing::isBatchFrame(frame));
+    EXPECT_EQ(framing::batchFrameEventCount(frame), 0);
+    EXPECT_TRUE(framing::splitBatchFrame(frame).empty());
+}
+
+TEST(BatchFraming, EmptyEventsAreSkipped)
+{
+    const auto frame = framing::buildBatchFrame({"", "1:loc:event", ""});
+    EXPECT_EQ(framing::batchFrameEventCount(frame), 1);
+    const auto split = framing::splitBatchFrame(frame);
+    ASSERT_EQ(split.size(), 1);
+    EXPECT_EQ(split[0], "1:loc:event");
+}
+
+TEST(BatchFraming, UnsupportedVersion)
+{
+    auto frame = framing::buildBatchFrame({"1:loc:event"});
+    frame[1] = 0x7F;
+    EXPECT_THROW(framing::splitBatchFrame(frame), std::runtime_error);
+    EXPECT_EQ(framing::batchFrameEventCount(frame), 0);
+}
+
+TEST(BatchFraming, TruncatedFrame)
+{
+    const auto frame = framing::buildBatchFrame({"1:loc:event"});
+
+    // Cut inside the event payload
+    EXPECT_THROW(framing::splitBatchFrame(std::string_view {frame.data(), frame.size() - 3}), std::runtime_error);
+    EXPECT_EQ(framing::batchFrameEventCount(std::string_view {frame.data(), frame.size() - 3}), 0);
+
+    // Cut inside a length prefix
+    EXPECT_THROW(framing::splitBatchFrame(std::string_view {frame.data(), framing::BATCH_FRAME_HEADER_SIZE + 2}),
+                 std::runtime_error);
+
+    // Only the marker
+    EXPECT_THROW(framing::splitBatchFrame(std::string_view {"\0", 1}), std::runtime_error);
+}
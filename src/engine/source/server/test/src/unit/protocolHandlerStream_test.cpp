@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <cstring>
+
 #include "server/protocolHandlers/wStream.hpp"
 
 using namespace engineserver::ph;
@@ -70,6 +72,39 @@ TEST_F(WStreamTest, onDataProcessingPartialData)
     EXPECT_EQ((*result2)[0], "HELLO WORLD");
 }
 
+TEST_F(WStreamTest, onDataProcessingBatchedFrames)
+{
+    // Several complete frames in a single read are all extracted in one call
+    std::string data;
+    for (const auto& payload : {"HELLO", "BIG", "WORLD"})
+    {
+        data += uintToLittleEndianBytes(std::strlen(payload)) + payload;
+    }
+
+    auto result = wstream.onData(data);
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 3);
+    EXPECT_EQ((*result)[0], "HELLO");
+    EXPECT_EQ((*result)[1], "BIG");
+    EXPECT_EQ((*result)[2], "WORLD");
+}
+
+TEST_F(WStreamTest, onDataProcessingPartialHeader)
+{
+    std::string payload("HELLO");
+    std::string header = uintToLittleEndianBytes(payload.size());
+
+    // Header split between two reads
+    auto result1 = wstream.onData(header.substr(0, 2));
+    ASSERT_FALSE(result1.has_value());
+
+    auto result2 = wstream.onData(header.substr(2) + payload);
+    ASSERT_TRUE(result2.has_value());
+    ASSERT_EQ(result2->size(), 1);
+    EXPECT_EQ((*result2)[0], "HELLO");
+}
+
 TEST_F(WStreamTest, onMessageProcessing)
 {
     std::string response;
@@ -93,6 +128,35 @@ TEST_F(WStreamTest, streamToSend)
     EXPECT_EQ(payloadExpected, message);
 }
 
+TEST_F(WStreamTest, streamToSendChunked)
+{
+    std::string message("HELLO WORLD, THIS IS A LONG MESSAGE");
+    auto buffers = wstream.streamToSendChunked(std::make_shared<std::string>(message), 8);
+
+    // First buffer is the header with the total payload size, the rest are bounded chunks
+    ASSERT_GE(buffers.size(), 2);
+    auto headerExpected = uintToLittleEndianBytes(message.size());
+    EXPECT_EQ(headerExpected, std::string(std::get<0>(buffers[0]).get(), std::get<1>(buffers[0])));
+
+    std::string reassembled;
+    for (std::size_t i = 1; i < buffers.size(); ++i)
+    {
+        auto& [buffer, size] = buffers[i];
+        EXPECT_LE(size, 8);
+        reassembled.append(buffer.get(), size);
+    }
+    EXPECT_EQ(reassembled, message);
+}
+
+TEST_F(WStreamTest, streamToSendChunkedSingleChunk)
+{
+    std::string message("HELLO");
+    auto buffers = wstream.streamToSendChunked(std::make_shared<std::string>(message), 1024);
+
+    ASSERT_EQ(buffers.size(), 2);
+    EXPECT_EQ(std::string(std::get<0>(buffers[1]).get(), std::get<1>(buffers[1])), message);
+}
+
 TEST_F(WStreamTest, getBusyResponse)
 {
     auto [buffer, size] = wstream.getBusyResponse();
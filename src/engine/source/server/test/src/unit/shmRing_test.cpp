@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <uvw.hpp>
+
+#include "fakeMetric.hpp"
+#include <base/logging.hpp>
+#include <server/endpoints/shmRing.hpp>
+
+using namespace engineserver::endpoint;
+
+namespace
+{
+std::string uniqueName()
+{
+    auto pid = getpid();
+    auto tid = std::this_thread::get_id();
+    std::stringstream ss;
+    ss << "/" << pid << "_" << tid << "_shmRing_test"; // Unique segment per thread and process
+    return ss.str();
+}
+} // namespace
+
+class ShmRingTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<uvw::Loop> loop;
+    std::string segmentName;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::string> received;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        segmentName = uniqueName();
+        loop = uvw::Loop::create();
+    }
+
+    void TearDown() override { loop->close(); }
+
+    std::function<void(std::string_view)> collector()
+    {
+        return [this](std::string_view event)
+        {
+            std::unique_lock lock {mutex};
+            received.emplace_back(event);
+            cv.notify_one();
+        };
+    }
+
+    bool waitForEvents(std::size_t count, std::chrono::seconds timeout = std::chrono::seconds(5))
+    {
+        std::unique_lock lock {mutex};
+        return cv.wait_for(lock, timeout, [&]() { return received.size() >= count; });
+    }
+};
+
+TEST_F(ShmRingTest, BindAndClose)
+{
+    ShmRing endpoint(segmentName, collector(), std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+    endpoint.bind(loop);
+    ASSERT_TRUE(endpoint.isBound());
+    endpoint.close();
+    ASSERT_FALSE(endpoint.isBound());
+}
+
+TEST_F(ShmRingTest, InvalidCapacity)
+{
+    EXPECT_THROW(ShmRing(segmentName,
+                         collector(),
+                         std::make_shared<FakeMetricScope>(),
+                         std::make_shared<FakeMetricScope>(),
+                         1000), // Not a power of two
+                 std::runtime_error);
+}
+
+TEST_F(ShmRingTest, ProducerRequiresSegment)
+{
+    EXPECT_THROW(ShmRingProducer {"/shmRing_test_absent_segment"}, std::runtime_error);
+}
+
+TEST_F(ShmRingTest, ProduceAndConsume)
+{
+    ShmRing endpoint(segmentName, collector(), std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+    endpoint.bind(loop);
+
+    {
+        ShmRingProducer producer(segmentName);
+        ASSERT_TRUE(producer.push("hello"));
+        ASSERT_TRUE(producer.push("shared"));
+        ASSERT_TRUE(producer.push("memory"));
+        producer.flush();
+    }
+
+    ASSERT_TRUE(waitForEvents(3));
+    EXPECT_EQ(received[0], "hello");
+    EXPECT_EQ(received[1], "shared");
+    EXPECT_EQ(received[2], "memory");
+
+    endpoint.close();
+}
+
+TEST_F(ShmRingTest, BatchIsPublishedWithoutExplicitFlush)
+{
+    ShmRing endpoint(segmentName, collector(), std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+    endpoint.bind(loop);
+
+    ShmRingProducer producer(segmentName, 4); // Batch of 4 records
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(producer.push("event " + std::to_string(i)));
+    }
+
+    ASSERT_TRUE(waitForEvents(4));
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(received[i], "event " + std::to_string(i));
+    }
+
+    endpoint.close();
+}
+
+TEST_F(ShmRingTest, WrapAround)
+{
+    // Small ring so the offsets wrap several times
+    ShmRing endpoint(
+        segmentName, collector(), std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>(), 256);
+    endpoint.bind(loop);
+
+    ShmRingProducer producer(segmentName, 1); // Publish every record
+    const std::size_t total {64};
+    for (std::size_t i = 0; i < total; ++i)
+    {
+        const auto event = "wrap around event number " + std::to_string(i);
+        while (!producer.push(event)) // Full ring, wait for the consumer to drain
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    ASSERT_TRUE(waitForEvents(total));
+    for (std::size_t i = 0; i < total; ++i)
+    {
+        EXPECT_EQ(received[i], "wrap around event number " + std::to_string(i));
+    }
+
+    endpoint.close();
+}
+
+TEST_F(ShmRingTest, PauseAndResume)
+{
+    ShmRing endpoint(segmentName, collector(), std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+
+    ASSERT_FALSE(endpoint.pause());
+    ASSERT_FALSE(endpoint.resume());
+
+    endpoint.bind(loop);
+    ASSERT_TRUE(endpoint.pause());
+    ASSERT_FALSE(endpoint.pause());
+
+    ShmRingProducer producer(segmentName, 1);
+    ASSERT_TRUE(producer.push("paused"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    {
+        std::unique_lock lock {mutex};
+        EXPECT_TRUE(received.empty());
+    }
+
+    ASSERT_TRUE(endpoint.resume());
+    ASSERT_FALSE(endpoint.resume());
+    ASSERT_TRUE(waitForEvents(1));
+    EXPECT_EQ(received[0], "paused");
+
+    endpoint.close();
+}
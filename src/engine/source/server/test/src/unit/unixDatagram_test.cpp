@@ -110,7 +110,7 @@ TEST_F(UnixDatagramTest, BindAndClose)
 {
     UnixDatagram endpoint(
         socketPath,
-        [](const std::string&) {},
+        [](std::string_view) {},
         std::make_shared<FakeMetricScope>(),
         std::make_shared<FakeMetricScope>());
     ASSERT_FALSE(endpoint.isBound());
@@ -124,7 +124,7 @@ TEST_F(UnixDatagramTest, PauseAndResume)
 {
     UnixDatagram endpoint(
         socketPath,
-        [](const std::string&) {},
+        [](std::string_view) {},
         std::make_shared<FakeMetricScope>(),
         std::make_shared<FakeMetricScope>());
     endpoint.bind(loop);
@@ -141,7 +141,7 @@ TEST_F(UnixDatagramTest, ReceiveData)
     std::string receivedData;
     UnixDatagram endpoint(
         socketPath,
-        [&](const std::string& data) { receivedData = std::move(data); },
+        [&](std::string_view data) { receivedData = std::string(data); },
         std::make_shared<FakeMetricScope>(),
         std::make_shared<FakeMetricScope>());
     endpoint.bind(loop);
@@ -155,12 +155,80 @@ TEST_F(UnixDatagramTest, ReceiveData)
     endpoint.close();
 }
 
+TEST_F(UnixDatagramTest, DrainBatchReceiveData)
+{
+    std::vector<std::string> receivedData;
+    const std::size_t taskQueueSize = 0;  // Synchronous callback
+    const std::size_t drainBatchSize = 8; // Drain the burst in the same wakeup
+    UnixDatagram endpoint(
+        socketPath,
+        [&](std::string_view data) { receivedData.emplace_back(data); },
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        taskQueueSize,
+        drainBatchSize);
+    endpoint.bind(loop);
+
+    // The whole burst is queued in the socket buffer before the loop runs
+    const std::size_t messages = 8;
+    for (std::size_t i = 0; i < messages; ++i)
+    {
+        sendUnixDatagram(socketPath, "Message " + std::to_string(i));
+    }
+
+    loop->run<uvw::Loop::Mode::ONCE>();
+
+    ASSERT_EQ(receivedData.size(), messages);
+    for (std::size_t i = 0; i < messages; ++i)
+    {
+        ASSERT_EQ(receivedData[i], "Message " + std::to_string(i));
+    }
+    endpoint.close();
+}
+
+TEST_F(UnixDatagramTest, ReceiveDataOnTwoLoops)
+{
+    std::atomic<std::size_t> receivedMessages(0);
+    UnixDatagram endpoint(
+        socketPath,
+        [&](std::string_view) { receivedMessages++; },
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>());
+
+    // Both loops read the same socket
+    auto secondLoop = uvw::Loop::create();
+    ASSERT_NO_THROW(endpoint.bind(loop));
+    ASSERT_NO_THROW(endpoint.bind(secondLoop));
+
+    const std::size_t messages = 8;
+    for (std::size_t i = 0; i < messages; ++i)
+    {
+        sendUnixDatagram(socketPath, "Message " + std::to_string(i));
+    }
+
+    // Every datagram is delivered to one of the two loops
+    const auto maxAttempts = 500;
+    auto attempts = 0;
+    while (receivedMessages < messages)
+    {
+        loop->run<uvw::Loop::Mode::NOWAIT>();
+        secondLoop->run<uvw::Loop::Mode::NOWAIT>();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ASSERT_LE(attempts++, maxAttempts) << "Not all messages were received: " << receivedMessages;
+    }
+
+    endpoint.close();
+    loop->run<uvw::Loop::Mode::ONCE>();
+    secondLoop->run<uvw::Loop::Mode::ONCE>();
+    secondLoop->close();
+}
+
 TEST_F(UnixDatagramTest, PauseResumeReceiveData)
 {
     std::atomic<bool> receivedData(false);
     UnixDatagram endpoint(
         socketPath,
-        [&](const std::string& data) { receivedData = true; },
+        [&](std::string_view data) { receivedData = true; },
         std::make_shared<FakeMetricScope>(),
         std::make_shared<FakeMetricScope>());
     endpoint.bind(loop);
@@ -210,7 +278,7 @@ TEST_F(UnixDatagramTest, taskQueueSizeTestAndOverflow)
     UnixDatagram endpoint(
         socketPath,
         [&, functionName = logging::getLambdaName(__FUNCTION__, "handleIncomingDataAndManageWorker")](
-            const std::string& data)
+            std::string_view data)
         {
             if (enableBlockQueueWorkers)
             {
@@ -229,7 +297,7 @@ TEST_F(UnixDatagramTest, taskQueueSizeTestAndOverflow)
             LOG_INFO_L(functionName.c_str(),
                        "Processing message [{}]: {}",
                        static_cast<std::size_t>(processedMessages),
-                       data.substr(0, 100).c_str());
+                       std::string(data.substr(0, 100)).c_str());
         },
         std::make_shared<FakeMetricScope>(),
         std::make_shared<FakeMetricScope>(),
@@ -368,7 +436,7 @@ TEST_F(UnixDatagramTest, StopWhenBufferIsFull)
     UnixDatagram endpoint(
         socketPath,
         [&, functionName = logging::getLambdaName(__FUNCTION__, "handleIncomingDataAndManageWorker")](
-            const std::string& data)
+            std::string_view data)
         {
             if (enableBlockQueueWorkers)
             {
@@ -387,7 +455,7 @@ TEST_F(UnixDatagramTest, StopWhenBufferIsFull)
             LOG_INFO_L(functionName.c_str(),
                        "Processing message [{}]: {}",
                        static_cast<std::size_t>(processedMessages),
-                       data.substr(0, 100).c_str());
+                       std::string(data.substr(0, 100)).c_str());
         },
         std::make_shared<FakeMetricScope>(),
         std::make_shared<FakeMetricScope>(),
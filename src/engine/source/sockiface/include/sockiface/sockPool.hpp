@@ -0,0 +1,95 @@
+#ifndef _SOCKIFACE_SOCKPOOL_HPP
+#define _SOCKIFACE_SOCKPOOL_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <sockiface/isockFactory.hpp>
+#include <sockiface/isockHandler.hpp>
+
+namespace sockiface
+{
+
+/**
+ * @brief Pool of persistent, health-checked socket connections.
+ *
+ * Keeps a per-endpoint set of connected handlers so concurrent clients can reuse
+ * established connections instead of reconnecting for every exchange. Handlers are
+ * checked out exclusively, and checked back in once the caller is done with them.
+ * Liveness is verified with \ref ISockHandler::isAlive both when parking and when
+ * handing out a connection, dead sockets are dropped and replaced with fresh ones.
+ *
+ * @note Connections are keyed by socket path, an endpoint is expected to always be
+ * used with the same protocol and maximum message size.
+ */
+class SockPool
+{
+public:
+    constexpr static std::size_t DEFAULT_MAX_IDLE = 8; ///< Default idle connections kept per endpoint
+
+private:
+    std::shared_ptr<ISockFactory> m_factory; ///< Factory used to create replacement handlers
+    std::size_t m_maxIdle;                   ///< Maximum idle connections kept per endpoint
+
+    std::unordered_map<std::string, std::vector<std::shared_ptr<ISockHandler>>>
+        m_idle;            ///< Idle connections by socket path
+    std::mutex m_mutex;    ///< Protects the idle connections
+
+    /**
+     * @brief Pop an alive idle handler for the given path, discarding dead ones.
+     *
+     * @param path path to the socket.
+     * @return an alive handler or nullptr if none is available.
+     */
+    std::shared_ptr<ISockHandler> popIdle(const std::string& path);
+
+public:
+    /**
+     * @brief Construct a new socket pool.
+     *
+     * @param factory factory used to create new handlers.
+     * @param maxIdlePerEndpoint maximum idle connections kept per endpoint.
+     *
+     * @throws std::runtime_error if the factory is null.
+     */
+    explicit SockPool(std::shared_ptr<ISockFactory> factory, std::size_t maxIdlePerEndpoint = DEFAULT_MAX_IDLE);
+
+    /**
+     * @brief Check out a connected handler for the given endpoint.
+     *
+     * Reuses an alive idle connection when available, otherwise creates and connects a
+     * new one.
+     *
+     * @param proto protocol type.
+     * @param path path to the socket.
+     * @param maxMsgSize maximum message size.
+     * @return connected handler, owned exclusively by the caller until checked in.
+     *
+     * @throws std::runtime_error if a new connection cannot be established.
+     */
+    std::shared_ptr<ISockHandler> checkout(ISockHandler::Protocol proto, std::string_view path, uint32_t maxMsgSize);
+
+    /**
+     * @copydoc SockPool::checkout
+     */
+    std::shared_ptr<ISockHandler> checkout(ISockHandler::Protocol proto, std::string_view path);
+
+    /**
+     * @brief Return a handler to the pool.
+     *
+     * Dead connections are disconnected and discarded, alive ones are parked for reuse
+     * unless the endpoint already holds the maximum idle connections.
+     *
+     * @param handler handler previously obtained from \ref checkout.
+     */
+    void checkin(std::shared_ptr<ISockHandler> handler);
+};
+
+} // namespace sockiface
+
+#endif // _SOCKIFACE_SOCKPOOL_HPP
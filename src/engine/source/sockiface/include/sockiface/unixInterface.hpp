@@ -110,6 +110,15 @@ public:
      * @copydoc ISockHandler::isConnected
      */
     bool isConnected() const noexcept override;
+
+    /**
+     * @copydoc ISockHandler::isAlive
+     *
+     * For stream sockets the peer is probed with a non-blocking peek, detecting an
+     * idle connection that was closed remotely. Datagram sockets have no peer state,
+     * so the local descriptor state is reported.
+     */
+    bool isAlive() const noexcept override;
 };
 
 } // namespace sockiface
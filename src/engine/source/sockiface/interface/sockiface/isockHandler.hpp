@@ -80,6 +80,17 @@ public:
      */
     virtual bool isConnected() const noexcept = 0;
 
+    /**
+     * @brief Check if the connection is still usable, probing the peer when possible.
+     *
+     * Unlike \ref isConnected, which only reflects the local descriptor state, this also
+     * detects an idle connection whose peer went away, so pooled connections can be
+     * replaced before being handed out.
+     *
+     * @return true if the connection can still be used, false otherwise.
+     */
+    virtual bool isAlive() const noexcept { return isConnected(); }
+
     /**
      * @brief Send a message to the socket. Open the socket if it is not already open.
      *
@@ -0,0 +1,111 @@
+#include "sockPool.hpp"
+
+#include <base/logging.hpp>
+
+namespace sockiface
+{
+
+SockPool::SockPool(std::shared_ptr<ISockFactory> factory, std::size_t maxIdlePerEndpoint)
+    : m_factory {std::move(factory)}
+    , m_maxIdle {maxIdlePerEndpoint}
+{
+    if (!m_factory)
+    {
+        throw std::runtime_error("Engine socket pool: Socket factory cannot be null");
+    }
+}
+
+std::shared_ptr<ISockHandler> SockPool::popIdle(const std::string& path)
+{
+    std::vector<std::shared_ptr<ISockHandler>> dead {};
+    std::shared_ptr<ISockHandler> handler {};
+
+    {
+        std::lock_guard lock {m_mutex};
+        auto it = m_idle.find(path);
+        if (it == m_idle.end())
+        {
+            return nullptr;
+        }
+
+        auto& idle = it->second;
+        while (!idle.empty())
+        {
+            auto candidate = std::move(idle.back());
+            idle.pop_back();
+
+            if (candidate->isAlive())
+            {
+                handler = std::move(candidate);
+                break;
+            }
+            dead.push_back(std::move(candidate));
+        }
+    }
+
+    // Disconnect outside the lock, dead sockets are replaced by a fresh connection
+    for (const auto& deadHandler : dead)
+    {
+        LOG_DEBUG("Engine socket pool: Discarding dead idle connection to '{}'.", path);
+        deadHandler->socketDisconnect();
+    }
+
+    return handler;
+}
+
+std::shared_ptr<ISockHandler>
+SockPool::checkout(ISockHandler::Protocol proto, std::string_view path, uint32_t maxMsgSize)
+{
+    auto handler = popIdle(std::string(path));
+    if (handler)
+    {
+        return handler;
+    }
+
+    handler = m_factory->getHandler(proto, path, maxMsgSize);
+    handler->socketConnect();
+    return handler;
+}
+
+std::shared_ptr<ISockHandler> SockPool::checkout(ISockHandler::Protocol proto, std::string_view path)
+{
+    auto handler = popIdle(std::string(path));
+    if (handler)
+    {
+        return handler;
+    }
+
+    handler = m_factory->getHandler(proto, path);
+    handler->socketConnect();
+    return handler;
+}
+
+void SockPool::checkin(std::shared_ptr<ISockHandler> handler)
+{
+    if (!handler)
+    {
+        return;
+    }
+
+    if (!handler->isAlive())
+    {
+        LOG_DEBUG("Engine socket pool: Discarding dead connection to '{}'.", handler->getPath());
+        handler->socketDisconnect();
+        return;
+    }
+
+    {
+        std::lock_guard lock {m_mutex};
+        auto& idle = m_idle[handler->getPath()];
+        if (idle.size() < m_maxIdle)
+        {
+            idle.push_back(std::move(handler));
+            return;
+        }
+    }
+
+    // The endpoint already holds its maximum idle connections
+    handler->socketDisconnect();
+}
+
+} // namespace sockiface
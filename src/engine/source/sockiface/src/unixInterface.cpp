@@ -81,6 +81,34 @@ bool unixInterface::isConnected() const noexcept
     return (0 < m_sock);
 }
 
+bool unixInterface::isAlive() const noexcept
+{
+    if (0 >= m_sock)
+    {
+        return false;
+    }
+
+    if (Protocol::DATAGRAM == m_protocol)
+    {
+        // Connectionless, there is no peer state to probe
+        return true;
+    }
+
+    /* Peek without blocking nor consuming data: 0 means the peer closed the connection */
+    char byte {};
+    const auto peeked {recv(m_sock, &byte, sizeof(byte), MSG_PEEK | MSG_DONTWAIT)};
+    if (0 == peeked)
+    {
+        return false;
+    }
+    if (0 > peeked)
+    {
+        return (EAGAIN == errno || EWOULDBLOCK == errno);
+    }
+
+    return true;
+}
+
 void unixInterface::socketConnect()
 {
     /* Check reconexion */
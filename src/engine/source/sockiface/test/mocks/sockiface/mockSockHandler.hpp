@@ -43,6 +43,7 @@ public:
     MOCK_METHOD(void, socketConnect, (), (override));
     MOCK_METHOD(void, socketDisconnect, (), (override));
     MOCK_METHOD(bool, isConnected, (), (const, noexcept, override));
+    MOCK_METHOD(bool, isAlive, (), (const, noexcept, override));
     MOCK_METHOD(SendRetval, sendMsg, (const std::string& msg), (override));
     MOCK_METHOD(std::vector<char>, recvMsg, (), (override));
 };
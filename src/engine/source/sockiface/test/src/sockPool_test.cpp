@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <sockiface/mockSockFactory.hpp>
+#include <sockiface/mockSockHandler.hpp>
+#include <sockiface/sockPool.hpp>
+
+using namespace sockiface;
+using namespace sockiface::mocks;
+
+using ::testing::Return;
+
+constexpr auto TEST_PATH {"/tmp/sockPool_test.sock"};
+
+class SockPoolTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<MockSockFactory> m_factory;
+
+    void SetUp() override { m_factory = std::make_shared<MockSockFactory>(); }
+};
+
+TEST_F(SockPoolTest, NullFactoryThrows)
+{
+    ASSERT_THROW(SockPool(nullptr), std::runtime_error);
+}
+
+TEST_F(SockPoolTest, CheckoutCreatesAndConnects)
+{
+    SockPool pool {m_factory};
+
+    auto handler = std::make_shared<MockSockHandler>();
+    EXPECT_CALL(*m_factory, getHandler(ISockHandler::Protocol::STREAM, std::string_view {TEST_PATH}))
+        .WillOnce(Return(handler));
+    EXPECT_CALL(*handler, socketConnect()).Times(1);
+
+    auto checkedOut = pool.checkout(ISockHandler::Protocol::STREAM, TEST_PATH);
+    ASSERT_EQ(checkedOut, handler);
+}
+
+TEST_F(SockPoolTest, CheckinThenCheckoutReuses)
+{
+    SockPool pool {m_factory};
+
+    auto handler = std::make_shared<MockSockHandler>();
+    EXPECT_CALL(*m_factory, getHandler(ISockHandler::Protocol::STREAM, std::string_view {TEST_PATH}))
+        .WillOnce(Return(handler));
+    EXPECT_CALL(*handler, socketConnect()).Times(1);
+    EXPECT_CALL(*handler, getPath()).WillRepeatedly(Return(TEST_PATH));
+    EXPECT_CALL(*handler, isAlive()).WillRepeatedly(Return(true));
+
+    auto checkedOut = pool.checkout(ISockHandler::Protocol::STREAM, TEST_PATH);
+    pool.checkin(checkedOut);
+
+    // Reused without going through the factory again
+    auto reused = pool.checkout(ISockHandler::Protocol::STREAM, TEST_PATH);
+    ASSERT_EQ(reused, handler);
+}
+
+TEST_F(SockPoolTest, DeadIdleConnectionIsReplaced)
+{
+    SockPool pool {m_factory};
+
+    auto deadHandler = std::make_shared<MockSockHandler>();
+    auto freshHandler = std::make_shared<MockSockHandler>();
+    EXPECT_CALL(*m_factory, getHandler(ISockHandler::Protocol::STREAM, std::string_view {TEST_PATH}))
+        .WillOnce(Return(deadHandler))
+        .WillOnce(Return(freshHandler));
+    EXPECT_CALL(*deadHandler, socketConnect()).Times(1);
+    EXPECT_CALL(*deadHandler, getPath()).WillRepeatedly(Return(TEST_PATH));
+    // Alive when parked, dead by the time it would be reused
+    EXPECT_CALL(*deadHandler, isAlive()).WillOnce(Return(true)).WillOnce(Return(false));
+    EXPECT_CALL(*deadHandler, socketDisconnect()).Times(1);
+    EXPECT_CALL(*freshHandler, socketConnect()).Times(1);
+
+    pool.checkin(pool.checkout(ISockHandler::Protocol::STREAM, TEST_PATH));
+
+    auto replaced = pool.checkout(ISockHandler::Protocol::STREAM, TEST_PATH);
+    ASSERT_EQ(replaced, freshHandler);
+}
+
+TEST_F(SockPoolTest, CheckinDeadConnectionDiscards)
+{
+    SockPool pool {m_factory};
+
+    auto deadHandler = std::make_shared<MockSockHandler>();
+    auto freshHandler = std::make_shared<MockSockHandler>();
+    EXPECT_CALL(*m_factory, getHandler(ISockHandler::Protocol::STREAM, std::string_view {TEST_PATH}))
+        .WillOnce(Return(deadHandler))
+        .WillOnce(Return(freshHandler));
+    EXPECT_CALL(*deadHandler, socketConnect()).Times(1);
+    EXPECT_CALL(*deadHandler, getPath()).WillRepeatedly(Return(TEST_PATH));
+    EXPECT_CALL(*deadHandler, isAlive()).WillOnce(Return(false));
+    EXPECT_CALL(*deadHandler, socketDisconnect()).Times(1);
+    EXPECT_CALL(*freshHandler, socketConnect()).Times(1);
+
+    pool.checkin(pool.checkout(ISockHandler::Protocol::STREAM, TEST_PATH));
+
+    auto replaced = pool.checkout(ISockHandler::Protocol::STREAM, TEST_PATH);
+    ASSERT_EQ(replaced, freshHandler);
+}
+
+TEST_F(SockPoolTest, IdleConnectionsAreCappedPerEndpoint)
+{
+    SockPool pool {m_factory, 1};
+
+    auto firstHandler = std::make_shared<MockSockHandler>();
+    auto secondHandler = std::make_shared<MockSockHandler>();
+    EXPECT_CALL(*m_factory, getHandler(ISockHandler::Protocol::STREAM, std::string_view {TEST_PATH}))
+        .WillOnce(Return(firstHandler))
+        .WillOnce(Return(secondHandler));
+    EXPECT_CALL(*firstHandler, socketConnect()).Times(1);
+    EXPECT_CALL(*firstHandler, getPath()).WillRepeatedly(Return(TEST_PATH));
+    EXPECT_CALL(*firstHandler, isAlive()).WillRepeatedly(Return(true));
+    EXPECT_CALL(*secondHandler, socketConnect()).Times(1);
+    EXPECT_CALL(*secondHandler, getPath()).WillRepeatedly(Return(TEST_PATH));
+    EXPECT_CALL(*secondHandler, isAlive()).WillRepeatedly(Return(true));
+    // The second checkin overflows the idle cap and is disconnected
+    EXPECT_CALL(*secondHandler, socketDisconnect()).Times(1);
+
+    auto first = pool.checkout(ISockHandler::Protocol::STREAM, TEST_PATH);
+    auto second = pool.checkout(ISockHandler::Protocol::STREAM, TEST_PATH);
+    pool.checkin(first);
+    pool.checkin(second);
+}
@@ -24,10 +24,20 @@ namespace store::drivers
 class FileDriver : public IDriver
 {
 private:
+    static const std::string COMPILED_DIR_NAME; ///< Shadow directory holding the precompiled binary docs.
+
     std::filesystem::path m_path;
 
     std::filesystem::path nameToPath(const base::Name& name) const;
 
+    /**
+     * @brief Path of the precompiled binary doc for a given document name.
+     *
+     * Compiled docs live in a shadow tree under the base path, so document collections are not
+     * polluted with sidecar entries.
+     */
+    std::filesystem::path nameToCompiledPath(const base::Name& name) const;
+
     base::OptError removeEmptyParentDirs(const std::filesystem::path& path, const base::Name& name);
 
 public:
@@ -0,0 +1,363 @@
+#include "binaryDoc.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include <rapidjson/document.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+
+namespace
+{
+constexpr char MAGIC[4] = {'E', 'S', 'T', 'B'};
+constexpr uint8_t FORMAT_VERSION = 1;
+// magic + version + source hash + source size
+constexpr size_t HEADER_SIZE = sizeof(MAGIC) + sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint64_t);
+
+// SAX event tags of the encoded stream.
+enum class Tag : uint8_t
+{
+    Null = 0,
+    False,
+    True,
+    Int,
+    Uint,
+    Int64,
+    Uint64,
+    Double,
+    String,
+    Key,
+    StartObject,
+    EndObject,
+    StartArray,
+    EndArray
+};
+
+// Deterministic fingerprint of the source text (FNV-1a, stable across runs and toolchains).
+uint64_t fingerprint(const std::string& data)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const unsigned char byte : data)
+    {
+        hash ^= byte;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+template<typename T>
+void appendValue(std::string& out, const T value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void appendTag(std::string& out, const Tag tag)
+{
+    out.push_back(static_cast<char>(tag));
+}
+
+// SAX handler that serializes the event stream of a document being parsed.
+class BinaryWriter
+{
+private:
+    std::string& m_out;
+
+    void appendString(const Tag tag, const char* str, const rapidjson::SizeType length)
+    {
+        appendTag(m_out, tag);
+        appendValue<uint32_t>(m_out, length);
+        m_out.append(str, length);
+    }
+
+public:
+    explicit BinaryWriter(std::string& out)
+        : m_out(out)
+    {
+    }
+
+    bool Null()
+    {
+        appendTag(m_out, Tag::Null);
+        return true;
+    }
+    bool Bool(const bool value)
+    {
+        appendTag(m_out, value ? Tag::True : Tag::False);
+        return true;
+    }
+    bool Int(const int value)
+    {
+        appendTag(m_out, Tag::Int);
+        appendValue(m_out, value);
+        return true;
+    }
+    bool Uint(const unsigned value)
+    {
+        appendTag(m_out, Tag::Uint);
+        appendValue(m_out, value);
+        return true;
+    }
+    bool Int64(const int64_t value)
+    {
+        appendTag(m_out, Tag::Int64);
+        appendValue(m_out, value);
+        return true;
+    }
+    bool Uint64(const uint64_t value)
+    {
+        appendTag(m_out, Tag::Uint64);
+        appendValue(m_out, value);
+        return true;
+    }
+    bool Double(const double value)
+    {
+        appendTag(m_out, Tag::Double);
+        appendValue(m_out, value);
+        return true;
+    }
+    bool RawNumber(const char* str, const rapidjson::SizeType length, bool)
+    {
+        // Numbers are parsed to their native representation; raw numbers are not produced.
+        appendString(Tag::String, str, length);
+        return true;
+    }
+    bool String(const char* str, const rapidjson::SizeType length, bool)
+    {
+        appendString(Tag::String, str, length);
+        return true;
+    }
+    bool Key(const char* str, const rapidjson::SizeType length, bool)
+    {
+        appendString(Tag::Key, str, length);
+        return true;
+    }
+    bool StartObject()
+    {
+        appendTag(m_out, Tag::StartObject);
+        return true;
+    }
+    bool EndObject(const rapidjson::SizeType memberCount)
+    {
+        appendTag(m_out, Tag::EndObject);
+        appendValue<uint32_t>(m_out, memberCount);
+        return true;
+    }
+    bool StartArray()
+    {
+        appendTag(m_out, Tag::StartArray);
+        return true;
+    }
+    bool EndArray(const rapidjson::SizeType elementCount)
+    {
+        appendTag(m_out, Tag::EndArray);
+        appendValue<uint32_t>(m_out, elementCount);
+        return true;
+    }
+};
+
+// Generator that replays an encoded event stream into a rapidjson handler.
+class BinaryReader
+{
+private:
+    const std::string& m_blob;
+    size_t m_offset;
+
+    template<typename T>
+    bool readValue(T& value)
+    {
+        if (m_blob.size() - m_offset < sizeof(value))
+        {
+            return false;
+        }
+        std::memcpy(&value, m_blob.data() + m_offset, sizeof(value));
+        m_offset += sizeof(value);
+        return true;
+    }
+
+    bool readString(const char*& str, uint32_t& length)
+    {
+        if (!readValue(length) || m_blob.size() - m_offset < length)
+        {
+            return false;
+        }
+        str = m_blob.data() + m_offset;
+        m_offset += length;
+        return true;
+    }
+
+public:
+    explicit BinaryReader(const std::string& blob)
+        : m_blob(blob)
+        , m_offset(HEADER_SIZE)
+    {
+    }
+
+    template<typename Handler>
+    bool operator()(Handler& handler)
+    {
+        size_t depth = 0;
+        bool rootDone = false;
+
+        while (m_offset < m_blob.size())
+        {
+            if (rootDone && depth == 0)
+            {
+                // Trailing data after the root value.
+                return false;
+            }
+
+            const auto tag = static_cast<Tag>(m_blob[m_offset++]);
+            bool ok = false;
+
+            switch (tag)
+            {
+                case Tag::Null: ok = handler.Null(); break;
+                case Tag::False: ok = handler.Bool(false); break;
+                case Tag::True: ok = handler.Bool(true); break;
+                case Tag::Int:
+                {
+                    int value {};
+                    ok = readValue(value) && handler.Int(value);
+                    break;
+                }
+                case Tag::Uint:
+                {
+                    unsigned value {};
+                    ok = readValue(value) && handler.Uint(value);
+                    break;
+                }
+                case Tag::Int64:
+                {
+                    int64_t value {};
+                    ok = readValue(value) && handler.Int64(value);
+                    break;
+                }
+                case Tag::Uint64:
+                {
+                    uint64_t value {};
+                    ok = readValue(value) && handler.Uint64(value);
+                    break;
+                }
+                case Tag::Double:
+                {
+                    double value {};
+                    ok = readValue(value) && handler.Double(value);
+                    break;
+                }
+                case Tag::String:
+                {
+                    const char* str {};
+                    uint32_t length {};
+                    ok = readString(str, length) && handler.String(str, length, true);
+                    break;
+                }
+                case Tag::Key:
+                {
+                    const char* str {};
+                    uint32_t length {};
+                    ok = depth > 0 && readString(str, length) && handler.Key(str, length, true);
+                    break;
+                }
+                case Tag::StartObject:
+                    ++depth;
+                    ok = handler.StartObject();
+                    break;
+                case Tag::EndObject:
+                {
+                    uint32_t memberCount {};
+                    ok = depth > 0 && readValue(memberCount) && handler.EndObject(memberCount);
+                    depth = depth > 0 ? depth - 1 : 0;
+                    break;
+                }
+                case Tag::StartArray:
+                    ++depth;
+                    ok = handler.StartArray();
+                    break;
+                case Tag::EndArray:
+                {
+                    uint32_t elementCount {};
+                    ok = depth > 0 && readValue(elementCount) && handler.EndArray(elementCount);
+                    depth = depth > 0 ? depth - 1 : 0;
+                    break;
+                }
+                default: return false;
+            }
+
+            if (!ok)
+            {
+                return false;
+            }
+
+            if (depth == 0)
+            {
+                rootDone = true;
+            }
+        }
+
+        return rootDone && depth == 0;
+    }
+};
+} // namespace
+
+namespace store::drivers::binarydoc
+{
+
+std::string encode(const std::string& jsonText)
+{
+    std::string out;
+    out.reserve(HEADER_SIZE + jsonText.size());
+    out.append(MAGIC, sizeof(MAGIC));
+    out.push_back(static_cast<char>(FORMAT_VERSION));
+    appendValue(out, fingerprint(jsonText));
+    appendValue<uint64_t>(out, jsonText.size());
+
+    BinaryWriter writer(out);
+    rapidjson::Reader reader;
+    rapidjson::StringStream stream(jsonText.c_str());
+    if (reader.Parse(stream, writer).IsError())
+    {
+        return {};
+    }
+
+    return out;
+}
+
+std::optional<json::Json> decode(const std::string& blob, const std::string& jsonText)
+{
+    if (blob.size() <= HEADER_SIZE || std::memcmp(blob.data(), MAGIC, sizeof(MAGIC)) != 0
+        || static_cast<uint8_t>(blob[sizeof(MAGIC)]) != FORMAT_VERSION)
+    {
+        return std::nullopt;
+    }
+
+    uint64_t sourceHash {};
+    uint64_t sourceSize {};
+    std::memcpy(&sourceHash, blob.data() + sizeof(MAGIC) + sizeof(uint8_t), sizeof(sourceHash));
+    std::memcpy(&sourceSize, blob.data() + sizeof(MAGIC) + sizeof(uint8_t) + sizeof(sourceHash), sizeof(sourceSize));
+
+    // A stale sidecar means the JSON source was edited out of band; fall back to parsing it.
+    if (sourceSize != jsonText.size() || sourceHash != fingerprint(jsonText))
+    {
+        return std::nullopt;
+    }
+
+    rapidjson::Document document;
+    BinaryReader reader(blob);
+
+    bool replayed = false;
+    auto generator = [&reader, &replayed](rapidjson::Document& handler)
+    {
+        replayed = reader(handler);
+        return replayed;
+    };
+    document.Populate(generator);
+
+    if (!replayed)
+    {
+        return std::nullopt;
+    }
+
+    return json::Json(std::move(document));
+}
+
+} // namespace store::drivers::binarydoc
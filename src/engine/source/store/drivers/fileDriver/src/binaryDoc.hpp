@@ -0,0 +1,41 @@
+#ifndef _BINARY_DOC_H
+#define _BINARY_DOC_H
+
+#include <optional>
+#include <string>
+
+#include <base/json.hpp>
+
+/**
+ * @brief Precompiled binary document format for the file driver.
+ *
+ * A binary sidecar is written next to each JSON document at write time, containing the SAX event
+ * stream of the already validated document plus a fingerprint of the source text. Reads replay the
+ * event stream straight into a rapidjson document, skipping text parsing and duplicate-key
+ * validation; the fingerprint guards against sidecars left stale by out-of-band edits to the JSON
+ * source, in which case the reader falls back to parsing the text.
+ */
+namespace store::drivers::binarydoc
+{
+
+/**
+ * @brief Encodes a JSON document into the binary sidecar format.
+ *
+ * @param jsonText Serialized JSON document.
+ * @return std::string Encoded sidecar content, or an empty string if the text could not be parsed.
+ */
+std::string encode(const std::string& jsonText);
+
+/**
+ * @brief Decodes a binary sidecar into a document.
+ *
+ * @param blob Sidecar content.
+ * @param jsonText Current JSON source text, used to verify the sidecar is not stale.
+ * @return std::optional<json::Json> The decoded document, or std::nullopt if the sidecar is stale,
+ * truncated or malformed.
+ */
+std::optional<json::Json> decode(const std::string& blob, const std::string& jsonText);
+
+} // namespace store::drivers::binarydoc
+
+#endif // _BINARY_DOC_H
@@ -3,8 +3,36 @@
 #include <base/logging.hpp>
 #include <fmt/format.h>
 
+#include "binaryDoc.hpp"
+
+namespace
+{
+// Best effort: a missing or stale compiled doc only costs a text parse on the next read.
+void writeCompiledDoc(const std::filesystem::path& compiledPath, const std::string& content)
+{
+    const auto encoded = store::drivers::binarydoc::encode(content);
+    if (encoded.empty())
+    {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(compiledPath.parent_path(), ec);
+
+    std::ofstream file(compiledPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        LOG_DEBUG("Compiled doc '{}' could not be opened on writing mode.", compiledPath.string());
+        return;
+    }
+    file << encoded;
+}
+} // namespace
+
 namespace store::drivers
 {
+
+const std::string FileDriver::COMPILED_DIR_NAME {".compiled"};
 FileDriver::FileDriver(const std::filesystem::path& path, bool create)
 {
     LOG_DEBUG("Engine file driver init with path '{}' and create '{}'.", path.string(), create);
@@ -43,6 +71,18 @@ std::filesystem::path FileDriver::nameToPath(const base::Name& name) const
     return path;
 }
 
+std::filesystem::path FileDriver::nameToCompiledPath(const base::Name& name) const
+{
+    std::filesystem::path path {m_path / COMPILED_DIR_NAME};
+    for (const auto& part : name.parts())
+    {
+        path /= part;
+    }
+    path += ".bin";
+
+    return path;
+}
+
 base::OptError FileDriver::createDoc(const base::Name& name, const Doc& content)
 {
     auto error = base::noError();
@@ -78,7 +118,9 @@ base::OptError FileDriver::createDoc(const base::Name& name, const Doc& content)
             }
             else
             {
-                file << content.str();
+                const auto contentStr = content.str();
+                file << contentStr;
+                writeCompiledDoc(nameToCompiledPath(name), contentStr);
             }
         }
     }
@@ -104,6 +146,21 @@ base::RespOrError<Doc> FileDriver::readDoc(const base::Name& name) const
         buffer << file.rdbuf();
         std::string content {buffer.str()};
         file.close();
+
+        // Prefer the precompiled doc: it replays the already validated document, skipping parsing.
+        if (const auto compiledPath = nameToCompiledPath(name); std::filesystem::exists(compiledPath))
+        {
+            std::ifstream compiledFile(compiledPath, std::ios::binary);
+            std::stringstream compiledBuffer;
+            compiledBuffer << compiledFile.rdbuf();
+
+            if (auto decoded = binarydoc::decode(compiledBuffer.str(), content); decoded)
+            {
+                return std::move(decoded.value());
+            }
+            LOG_DEBUG("Compiled doc '{}' is stale or malformed, falling back to parsing.", compiledPath.string());
+        }
+
         try
         {
             result = Doc {content.c_str()};
@@ -152,7 +209,9 @@ base::OptError FileDriver::updateDoc(const base::Name& name, const Doc& content)
         }
         else
         {
-            file << content.str();
+            const auto contentStr = content.str();
+            file << contentStr;
+            writeCompiledDoc(nameToCompiledPath(name), contentStr);
         }
     }
 
@@ -216,6 +275,7 @@ base::OptError FileDriver::deleteDoc(const base::Name& name)
             error = base::Error {
                 fmt::format("File '{}' could not be removed: ({}) {}", path.string(), ec.value(), ec.message())};
         }
+        std::filesystem::remove(nameToCompiledPath(name), ec);
 
         // Remove empty parent directories
         error = removeEmptyParentDirs(path, name);
@@ -277,6 +337,10 @@ base::RespOrError<Col> FileDriver::readRoot() const
 
             for (const auto& entry : std::filesystem::directory_iterator(path))
             {
+                if (entry.path().filename() == COMPILED_DIR_NAME)
+                {
+                    continue;
+                }
                 names.emplace_back(entry.path().filename().string());
             }
 
@@ -315,6 +379,14 @@ base::OptError FileDriver::deleteCol(const base::Name& name)
                 fmt::format("File '{}' could not be removed: ({}) {}", path.string(), ec.value(), ec.message())};
         }
 
+        // Remove the compiled docs of the collection; .bin suffix only applies to documents.
+        auto compiledPath = m_path / COMPILED_DIR_NAME;
+        for (const auto& part : name.parts())
+        {
+            compiledPath /= part;
+        }
+        std::filesystem::remove_all(compiledPath, ec);
+
         // Remove empty parent directories
         error = removeEmptyParentDirs(path, name);
     }
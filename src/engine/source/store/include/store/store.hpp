@@ -1,8 +1,12 @@
 #ifndef _STORE_HPP
 #define _STORE_HPP
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <thread>
+#include <vector>
 
 #include <store/idriver.hpp>
 #include <store/istore.hpp>
@@ -21,6 +25,24 @@ private:
     std::unique_ptr<DBDocNames> m_cache; ///< Cache for the doc names and virtual space names.
     mutable std::shared_mutex m_mutex;   ///< sync the m_cache with the store. and protect the m_cache access.
 
+    class DocCache;                              ///< PImpl for the parsed document cache.
+    mutable std::unique_ptr<DocCache> m_docCache; ///< Cache of parsed documents, keyed by real name.
+    mutable std::mutex m_docCacheMutex;           ///< Protects the m_docCache access.
+
+    mutable std::vector<base::Name> m_pendingNamespaces; ///< Namespaces listed at boot, pending the document walk.
+    mutable std::atomic_bool m_namesLoaded;              ///< Whether the name index has been materialized.
+    std::thread m_preloader;                             ///< Background thread warming the name index.
+
+    /**
+     * @brief Materialize the name index from the pending namespaces, if not done yet.
+     *
+     * The constructor only lists and validates the namespaces; the recursive walk that indexes every
+     * document is deferred to the first access, so a large catalog does not inflate engine boot. The
+     * background preloader triggers it right after construction, and any access arriving earlier
+     * performs it synchronously.
+     */
+    void ensureNamesLoaded() const;
+
     /**
      * @brief Translate a virtual name to a real name in the store driver.
      *
@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <list>
+#include <optional>
 #include <set>
+#include <unordered_map>
 
 #include <base/logging.hpp>
 
@@ -279,17 +281,158 @@ public:
     }
 };
 
+/**
+ * @brief Store::DocCache
+ *
+ * Caches parsed documents by their real name, so repeated reads during policy builds and catalog
+ * sessions are served from memory instead of re-reading and re-parsing through the driver. Each
+ * name carries a generation counter bumped on every write, so a cached document is only served
+ * while its generation matches the last write. It is NOT thread safe.
+ */
+class Store::DocCache
+{
+private:
+    /**
+     * @brief A cached document stamped with the generation it was read at.
+     */
+    struct Entry
+    {
+        Doc doc;             ///< Parsed document.
+        uint64_t generation; ///< Generation of the name when the document was cached.
+    };
+
+    std::unordered_map<base::Name, Entry> m_docs;           ///< Cached documents by real name.
+    std::unordered_map<base::Name, uint64_t> m_generations; ///< Current generation of each written name.
+
+    uint64_t generationOf(const base::Name& name) const
+    {
+        auto it = m_generations.find(name);
+        return it != m_generations.end() ? it->second : 0;
+    }
+
+public:
+    /**
+     * @brief Retrieve the cached document for a name, if still current.
+     *
+     * @param name Real name of the document.
+     * @return The cached document if present and not invalidated; otherwise, std::nullopt.
+     */
+    std::optional<Doc> get(const base::Name& name) const
+    {
+        auto it = m_docs.find(name);
+        if (it == m_docs.end() || it->second.generation != generationOf(name))
+        {
+            return std::nullopt;
+        }
+
+        return it->second.doc;
+    }
+
+    /**
+     * @brief Cache a document at the current generation of its name.
+     *
+     * @param name Real name of the document.
+     * @param doc Parsed document.
+     */
+    void put(const base::Name& name, const Doc& doc) { m_docs.insert_or_assign(name, Entry {doc, generationOf(name)}); }
+
+    /**
+     * @brief Bump the generation of a name, invalidating any cached document for it.
+     *
+     * @param name Real name of the written document.
+     */
+    void invalidate(const base::Name& name)
+    {
+        ++m_generations[name];
+        m_docs.erase(name);
+    }
+
+    /**
+     * @brief Drop every cached document, keeping the generations.
+     */
+    void clear() { m_docs.clear(); }
+};
+
 Store::Store(std::shared_ptr<IDriver> driver)
     : m_driver(std::move(driver))
     , m_cache(std::make_unique<DBDocNames>())
+    , m_docCache(std::make_unique<DocCache>())
     , m_mutex()
+    , m_namesLoaded(false)
 {
     if (m_driver == nullptr)
     {
         throw std::runtime_error("Store driver cannot be null");
     }
 
-    // Load the cache
+    // No namespaces to load
+    if (!m_driver->existsCol(sm_prefixNS))
+    {
+        m_namesLoaded.store(true, std::memory_order_release);
+        return;
+    }
+
+    // List and validate the namespaces only; the per-namespace document walk is deferred
+    const auto namespaces = m_driver->readCol(sm_prefixNS);
+
+    if (const auto err = std::get_if<base::Error>(&namespaces))
+    {
+        throw std::runtime_error(fmt::format("Error loading namespaces: {}", err->message));
+    }
+
+    const auto& list = std::get<Col>(namespaces);
+    for (const auto& name : list)
+    {
+        if (name.parts().size() == sm_prefixNS.parts().size() + NamespaceId::PARTS_NAMESPACE_SIZE
+            && m_driver->existsCol(name))
+        {
+            m_pendingNamespaces.push_back(name);
+        }
+        else
+        {
+            throw std::runtime_error(fmt::format("Invalid namespace '{}', part size: {}, is collection: {}",
+                                                 name.fullName(),
+                                                 name.parts().size(),
+                                                 m_driver->existsCol(name)));
+        }
+    }
+
+    // Warm the name index in the background so the first event does not pay the walk
+    m_preloader = std::thread(
+        [this]()
+        {
+            try
+            {
+                ensureNamesLoaded();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Store name index preload failed, deferring to first access: {}", e.what());
+            }
+        });
+}
+
+Store::~Store()
+{
+    if (m_preloader.joinable())
+    {
+        m_preloader.join();
+    }
+}
+
+void Store::ensureNamesLoaded() const
+{
+    if (m_namesLoaded.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (m_namesLoaded.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
     auto visitor = [this, functionName = logging::getLambdaName(__FUNCTION__, "visitor")](
                        const base::Name& name, const NamespaceId& nsid, auto& visitorRef) -> void
     {
@@ -327,47 +470,23 @@ Store::Store(std::shared_ptr<IDriver> driver)
         }
     };
 
-    // No namespaces to load
-    if (!m_driver->existsCol(sm_prefixNS))
+    for (const auto& name : m_pendingNamespaces)
     {
-        return;
+        visitor(name, NamespaceId(name.parts().back()), visitor);
+        LOG_DEBUG("Loaded namespace '{}'", name.fullName());
     }
 
-    // Get all namespaces and load the cache
-    const auto namespaces = m_driver->readCol(sm_prefixNS);
-
-    if (const auto err = std::get_if<base::Error>(&namespaces))
-    {
-        throw std::runtime_error(fmt::format("Error loading namespaces: {}", err->message));
-    }
-
-    const auto& list = std::get<Col>(namespaces);
-    for (const auto& name : list)
-    {
-        if (name.parts().size() == sm_prefixNS.parts().size() + NamespaceId::PARTS_NAMESPACE_SIZE
-            && m_driver->existsCol(name))
-        {
-            visitor(name, NamespaceId(name.parts().back()), visitor);
-            LOG_DEBUG("Loaded namespace '{}'", name.fullName());
-        }
-        else
-        {
-            throw std::runtime_error(fmt::format("Invalid namespace '{}', part size: {}, is collection: {}",
-                                                 name.fullName(),
-                                                 name.parts().size(),
-                                                 m_driver->existsCol(name)));
-        }
-    }
+    m_pendingNamespaces.clear();
+    m_namesLoaded.store(true, std::memory_order_release);
 }
 
-Store::~Store() = default;
-
 //----------------------------------------------------------------------------------------
 //                                Read interface definition
 //----------------------------------------------------------------------------------------
 
 std::optional<NamespaceId> Store::getNamespace(const base::Name& name) const
 {
+    ensureNamesLoaded();
     // If the document is a collection, then it does not have a NamespaceId
     std::shared_lock<std::shared_mutex> lock(m_mutex);
     return m_cache->getNamespaceId(name);
@@ -375,6 +494,7 @@ std::optional<NamespaceId> Store::getNamespace(const base::Name& name) const
 
 base::RespOrError<Doc> Store::readDoc(const base::Name& name) const
 {
+    ensureNamesLoaded();
     std::shared_lock<std::shared_mutex> lock(m_mutex);
 
     // Check if the document exists
@@ -387,17 +507,34 @@ base::RespOrError<Doc> Store::readDoc(const base::Name& name) const
     // Transform the virtual name to the real name
     const auto rname = virtualToRealName(name, *namespaceId);
 
-    return m_driver->readDoc(rname);
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        if (auto cached = m_docCache->get(rname); cached)
+        {
+            return std::move(cached.value());
+        }
+    }
+
+    auto result = m_driver->readDoc(rname);
+    if (!base::isError(result))
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->put(rname, base::getResponse<Doc>(result));
+    }
+
+    return result;
 }
 
 std::vector<NamespaceId> Store::listNamespaces() const
 {
+    ensureNamesLoaded();
     std::shared_lock<std::shared_mutex> lock(m_mutex);
     return m_cache->getNamespaceIds();
 }
 
 base::RespOrError<Col> Store::readCol(const base::Name& name, const NamespaceId& namespaceId) const
 {
+    ensureNamesLoaded();
     // Retrieve real collection from cache
     std::shared_lock<std::shared_mutex> lock(m_mutex);
     auto vcol = m_cache->filterByPrefix(name, namespaceId);
@@ -412,12 +549,14 @@ base::RespOrError<Col> Store::readCol(const base::Name& name, const NamespaceId&
 
 bool Store::existsDoc(const base::Name& name) const
 {
+    ensureNamesLoaded();
     std::shared_lock<std::shared_mutex> lock(m_mutex);
     return m_cache->existsName(name);
 }
 
 bool Store::existsCol(const base::Name& name, const NamespaceId& namespaceId) const
 {
+    ensureNamesLoaded();
     std::shared_lock<std::shared_mutex> lock(m_mutex);
     auto col = m_cache->filterByPrefix(name, namespaceId);
     return !col.empty();
@@ -429,6 +568,7 @@ bool Store::existsCol(const base::Name& name, const NamespaceId& namespaceId) co
 
 base::OptError Store::createDoc(const base::Name& name, const NamespaceId& namespaceId, const Doc& content)
 {
+    ensureNamesLoaded();
 
     // Check if the document already exists
     std::unique_lock<std::shared_mutex> lock(m_mutex);
@@ -445,12 +585,18 @@ base::OptError Store::createDoc(const base::Name& name, const NamespaceId& names
         return error;
     }
 
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->invalidate(rName);
+    }
+
     m_cache->add(name, namespaceId);
     return std::nullopt;
 }
 
 base::OptError Store::updateDoc(const base::Name& name, const Doc& content)
 {
+    ensureNamesLoaded();
     // Shared lock because we only read the cache here
     std::shared_lock<std::shared_mutex> lock(m_mutex);
     auto namespaceId = m_cache->getNamespaceId(name);
@@ -461,11 +607,19 @@ base::OptError Store::updateDoc(const base::Name& name, const Doc& content)
 
     // update the document
     auto rName = virtualToRealName(name, *namespaceId);
-    return m_driver->updateDoc(rName, content);
+    auto error = m_driver->updateDoc(rName, content);
+    if (!error)
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->invalidate(rName);
+    }
+
+    return error;
 }
 
 base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& namespaceId, const Doc& content)
 {
+    ensureNamesLoaded();
 
     std::unique_lock<std::shared_mutex> lock(m_mutex);
     auto namespaceIdCache = m_cache->getNamespaceId(name);
@@ -482,6 +636,11 @@ base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& names
         return error;
     }
 
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->invalidate(rName);
+    }
+
     if (!namespaceIdCache)
     {
         m_cache->add(name, namespaceId);
@@ -492,6 +651,7 @@ base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& names
 
 base::OptError Store::deleteDoc(const base::Name& name)
 {
+    ensureNamesLoaded();
 
     std::unique_lock<std::shared_mutex> lock(m_mutex);
 
@@ -510,6 +670,11 @@ base::OptError Store::deleteDoc(const base::Name& name)
         return error;
     }
 
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->invalidate(rName);
+    }
+
     m_cache->del(name);
 
     return std::nullopt;
@@ -517,6 +682,7 @@ base::OptError Store::deleteDoc(const base::Name& name)
 
 base::OptError Store::deleteCol(const base::Name& name, const NamespaceId& namespaceId)
 {
+    ensureNamesLoaded();
     std::unique_lock<std::shared_mutex> lock(m_mutex);
     // Check if the namespace exists and the collection exists
     if (m_cache->filterByPrefix(name, namespaceId).empty())
@@ -531,6 +697,12 @@ base::OptError Store::deleteCol(const base::Name& name, const NamespaceId& names
         return error;
     }
 
+    {
+        // The deleted names are not enumerated here, so drop every cached document.
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->clear();
+    }
+
     // Update the cache
     m_cache->delCol(name, namespaceId);
 
@@ -549,13 +721,35 @@ base::OptError Store::createInternalDoc(const base::Name& name, const Doc& conte
                                         sm_prefixNS.parts()[0])};
     }
 
-    return m_driver->createDoc(name, content);
+    auto error = m_driver->createDoc(name, content);
+    if (!error)
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->invalidate(name);
+    }
+
+    return error;
 }
 
 base::RespOrError<Doc> Store::readInternalDoc(const base::Name& name) const
 {
     // No check if the document starts with the internal namespace, allow to read any document
-    return m_driver->readDoc(name);
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        if (auto cached = m_docCache->get(name); cached)
+        {
+            return std::move(cached.value());
+        }
+    }
+
+    auto result = m_driver->readDoc(name);
+    if (!base::isError(result))
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->put(name, base::getResponse<Doc>(result));
+    }
+
+    return result;
 }
 
 base::OptError Store::updateInternalDoc(const base::Name& name, const Doc& content)
@@ -567,7 +761,14 @@ base::OptError Store::updateInternalDoc(const base::Name& name, const Doc& conte
                                         name.fullName(),
                                         sm_prefixNS.parts()[0])};
     }
-    return m_driver->updateDoc(name, content);
+    auto error = m_driver->updateDoc(name, content);
+    if (!error)
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->invalidate(name);
+    }
+
+    return error;
 }
 
 base::OptError Store::upsertInternalDoc(const base::Name& name, const Doc& content)
@@ -580,12 +781,14 @@ base::OptError Store::upsertInternalDoc(const base::Name& name, const Doc& conte
                                         sm_prefixNS.parts()[0])};
     }
 
-    if (!m_driver->existsDoc(name))
+    auto error = m_driver->existsDoc(name) ? m_driver->updateDoc(name, content) : m_driver->createDoc(name, content);
+    if (!error)
     {
-        return m_driver->createDoc(name, content);
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->invalidate(name);
     }
 
-    return m_driver->updateDoc(name, content);
+    return error;
 }
 
 base::OptError Store::deleteInternalDoc(const base::Name& name)
@@ -597,7 +800,14 @@ base::OptError Store::deleteInternalDoc(const base::Name& name)
                                         name.fullName(),
                                         sm_prefixNS.parts()[0])};
     }
-    return m_driver->deleteDoc(name);
+    auto error = m_driver->deleteDoc(name);
+    if (!error)
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->invalidate(name);
+    }
+
+    return error;
 }
 
 base::RespOrError<Col> Store::readInternalCol(const base::Name& name) const
@@ -299,3 +299,96 @@ TEST_F(FileDriverTest, Exists)
     ASSERT_FALSE(fDriver.existsDoc(TEST_NAME_COLLECTION));
     ASSERT_TRUE(fDriver.existsCol(TEST_NAME_COLLECTION));
 }
+
+TEST_F(FileDriverTest, AddWritesCompiledDoc)
+{
+    FileDriver fDriver(m_path);
+    base::OptError error;
+    ASSERT_NO_THROW(error = fDriver.createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(error);
+
+    auto compiledPath = m_path / ".compiled" / TEST_NAME.parts()[0] / TEST_NAME.parts()[1]
+                        / (std::string {TEST_NAME.parts()[2]} + ".bin");
+    ASSERT_TRUE(std::filesystem::exists(compiledPath));
+    ASSERT_TRUE(std::filesystem::is_regular_file(compiledPath));
+
+    base::RespOrError<store::Doc> result;
+    ASSERT_NO_THROW(result = fDriver.readDoc(TEST_NAME));
+    ASSERT_TRUE(std::holds_alternative<json::Json>(result));
+    ASSERT_EQ(std::get<json::Json>(result), TEST_JSON);
+}
+
+TEST_F(FileDriverTest, GetFallsBackOnStaleCompiledDoc)
+{
+    FileDriver fDriver(m_path);
+    ASSERT_FALSE(fDriver.createDoc(TEST_NAME, TEST_JSON));
+
+    // Edit the JSON source out of band; the compiled doc is now stale.
+    auto path = m_path / TEST_NAME.parts()[0] / TEST_NAME.parts()[1] / TEST_NAME.parts()[2];
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << TEST_JSON2.str();
+    }
+
+    base::RespOrError<store::Doc> result;
+    ASSERT_NO_THROW(result = fDriver.readDoc(TEST_NAME));
+    ASSERT_TRUE(std::holds_alternative<json::Json>(result));
+    ASSERT_EQ(std::get<json::Json>(result), TEST_JSON2);
+}
+
+TEST_F(FileDriverTest, GetFallsBackOnCorruptCompiledDoc)
+{
+    FileDriver fDriver(m_path);
+    ASSERT_FALSE(fDriver.createDoc(TEST_NAME, TEST_JSON));
+
+    auto compiledPath = m_path / ".compiled" / TEST_NAME.parts()[0] / TEST_NAME.parts()[1]
+                        / (std::string {TEST_NAME.parts()[2]} + ".bin");
+    {
+        std::ofstream file(compiledPath, std::ios::binary | std::ios::trunc);
+        file << "garbage";
+    }
+
+    base::RespOrError<store::Doc> result;
+    ASSERT_NO_THROW(result = fDriver.readDoc(TEST_NAME));
+    ASSERT_TRUE(std::holds_alternative<json::Json>(result));
+    ASSERT_EQ(std::get<json::Json>(result), TEST_JSON);
+}
+
+TEST_F(FileDriverTest, UpdateRefreshesCompiledDoc)
+{
+    FileDriver fDriver(m_path);
+    ASSERT_FALSE(fDriver.createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(fDriver.updateDoc(TEST_NAME, TEST_JSON2));
+
+    base::RespOrError<store::Doc> result;
+    ASSERT_NO_THROW(result = fDriver.readDoc(TEST_NAME));
+    ASSERT_TRUE(std::holds_alternative<json::Json>(result));
+    ASSERT_EQ(std::get<json::Json>(result), TEST_JSON2);
+}
+
+TEST_F(FileDriverTest, EraseRemovesCompiledDoc)
+{
+    FileDriver fDriver(m_path);
+    ASSERT_FALSE(fDriver.createDoc(TEST_NAME, TEST_JSON));
+
+    auto compiledPath = m_path / ".compiled" / TEST_NAME.parts()[0] / TEST_NAME.parts()[1]
+                        / (std::string {TEST_NAME.parts()[2]} + ".bin");
+    ASSERT_TRUE(std::filesystem::exists(compiledPath));
+
+    ASSERT_FALSE(fDriver.deleteDoc(TEST_NAME));
+    ASSERT_FALSE(std::filesystem::exists(compiledPath));
+}
+
+TEST_F(FileDriverTest, ReadRootSkipsCompiledDir)
+{
+    FileDriver fDriver(m_path);
+    ASSERT_FALSE(fDriver.createDoc(TEST_NAME, TEST_JSON));
+
+    base::RespOrError<store::Col> result;
+    ASSERT_NO_THROW(result = fDriver.readRoot());
+    ASSERT_TRUE(std::holds_alternative<store::Col>(result));
+    for (const auto& name : std::get<store::Col>(result))
+    {
+        ASSERT_NE(name.fullName(), ".compiled");
+    }
+}
@@ -234,6 +234,39 @@ TEST_F(StoreTest, ReadDoc_ok)
     ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
 }
 
+TEST_F(StoreTest, ReadDoc_cached)
+{
+    // The driver is consulted once; the second read is served from the document cache.
+    EXPECT_CALL(*driver, readDoc(rDoc_1A)).WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+    auto res = store->readDoc(doc_1A);
+
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
+
+    res = store->readDoc(doc_1A);
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
+}
+
+TEST_F(StoreTest, ReadDoc_cacheInvalidatedOnWrite)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1A))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1B))));
+
+    auto res = store->readDoc(doc_1A);
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
+
+    // An update bumps the generation, so the next read goes back to the driver.
+    EXPECT_CALL(*driver, updateDoc(rDoc_1A, jdoc_1B)).WillOnce(testing::Return(std::nullopt));
+    ASSERT_FALSE(base::isError(store->updateDoc(doc_1A, jdoc_1B)));
+
+    res = store->readDoc(doc_1A);
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(std::get<Doc>(res), jdoc_1B);
+}
+
 /*******************************************************************************
                         Store::readCol
 *******************************************************************************/
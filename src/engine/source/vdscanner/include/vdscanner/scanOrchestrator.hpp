@@ -22,7 +22,8 @@ namespace vdscanner
 enum class PayloadType
 {
     PackageList = 0,
-    FullScan = 1
+    FullScan = 1,
+    Checkpoint = 2
 };
 
 /**
@@ -319,7 +319,8 @@ private:
     bool versionMatch(const std::string& cnaName,
                       const PackageData& package,
                       const NSVulnerabilityScanner::ScanVulnerabilityCandidate& callbackData,
-                      std::shared_ptr<TScanContext> contextData)
+                      std::shared_ptr<TScanContext> contextData,
+                      VersionObjectCache& versionCache)
     {
         std::variant<VersionObjectType, VersionMatcherStrategy> objectType = VersionMatcherStrategy::Unspecified;
         if (const auto it = m_packageMap.find(package.format); it != m_packageMap.end())
@@ -348,7 +349,7 @@ private:
             // No version range specified, check if the installed version is equal to the required version.
             if (versionStringLessThan.empty() && versionStringLessThanOrEqual.empty())
             {
-                if (VersionMatcher::compare(packageVersion, versionString, objectType)
+                if (VersionMatcher::compare(packageVersion, versionString, objectType, versionCache)
                     == VersionComparisonResult::A_EQUAL_B)
                 {
                     // Version match found, the package status is defined by the vulnerability status.
@@ -385,7 +386,8 @@ private:
                 }
                 else
                 {
-                    const auto matchResult = VersionMatcher::compare(packageVersion, versionString, objectType);
+                    const auto matchResult =
+                        VersionMatcher::compare(packageVersion, versionString, objectType, versionCache);
                     lowerBoundMatch = matchResult == VersionComparisonResult::A_GREATER_THAN_B
                                       || matchResult == VersionComparisonResult::A_EQUAL_B;
                 }
@@ -397,13 +399,13 @@ private:
                     if (!versionStringLessThan.empty() && versionStringLessThan.compare("*") != 0)
                     {
                         const auto matchResult =
-                            VersionMatcher::compare(packageVersion, versionStringLessThan, objectType);
+                            VersionMatcher::compare(packageVersion, versionStringLessThan, objectType, versionCache);
                         upperBoundMatch = matchResult == VersionComparisonResult::A_LESS_THAN_B;
                     }
                     else if (!versionStringLessThanOrEqual.empty())
                     {
-                        const auto matchResult =
-                            VersionMatcher::compare(packageVersion, versionStringLessThanOrEqual, objectType);
+                        const auto matchResult = VersionMatcher::compare(
+                            packageVersion, versionStringLessThanOrEqual, objectType, versionCache);
                         upperBoundMatch = matchResult == VersionComparisonResult::A_LESS_THAN_B
                                           || matchResult == VersionComparisonResult::A_EQUAL_B;
                     }
@@ -558,7 +560,12 @@ public:
      */
     std::shared_ptr<TScanContext> handleRequest(std::shared_ptr<TScanContext> data) override
     {
-        auto vulnerabilityScan = [&data, this, functionName = logging::getLambdaName(__FUNCTION__, "scanPackage")](
+        // Parse cache scoped to this scan: the same package version is compared against every CVE candidate, so
+        // memoizing the parsed objects turns hundreds of identical parses into one.
+        VersionObjectCache versionCache;
+
+        auto vulnerabilityScan = [&data, &versionCache, this,
+                                  functionName = logging::getLambdaName(__FUNCTION__, "scanPackage")](
                                      const std::string& cnaName,
                                      const PackageData& package,
                                      const NSVulnerabilityScanner::ScanVulnerabilityCandidate& callbackData)
@@ -580,7 +587,7 @@ public:
                 }
 
                 /* Real version analysis of the candidate. */
-                if (versionMatch(cnaName, package, callbackData, data))
+                if (versionMatch(cnaName, package, callbackData, data, versionCache))
                 {
                     // The candidate version matches the package. Post-match filtering.
                     if (data->osPlatform().compare("windows") == 0
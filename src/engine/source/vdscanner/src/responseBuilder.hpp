@@ -143,7 +143,21 @@ public:
             throw std::invalid_argument("Package item id is empty");
         }
 
-        nlohmann::json dataElements = nlohmann::json::array();
+        // Per-scan constants, resolved once and reused for every finding of the burst
+        nlohmann::json skeleton;
+        switch (data->scannerType())
+        {
+            case ScannerType::Package:
+                skeleton["category"] = "Packages";
+                skeleton["item_id"] = data->packageItemId();
+                break;
+
+            case ScannerType::Os: skeleton["category"] = "OS"; break;
+
+            default: throw std::invalid_argument("Invalid scanner type"); break;
+        }
+        skeleton["detected_at"] = base::utils::time::getCurrentISO8601();
+        skeleton["enumeration"] = "CVE";
 
         // For each element, we get the vulnerability descriptive information and build the event details.
         for (auto& [cve, json] : data->m_elements)
@@ -152,23 +166,12 @@ public:
             m_databaseFeedManager->getVulnerabiltyDescriptiveInformation(cve, returnData);
             if (returnData.data)
             {
-                switch (data->scannerType())
-                {
-                    case ScannerType::Package:
-                        json["category"] = "Packages";
-                        json["item_id"] = data->packageItemId();
-                        break;
-
-                    case ScannerType::Os: json["category"] = "OS"; break;
-
-                    default: throw std::invalid_argument("Invalid scanner type"); break;
-                }
+                // Copy the preallocated skeleton nodes instead of rebuilding them per finding
+                json.update(skeleton);
 
                 // Status date
                 json["classification"] = returnData.data->classification()->str();
                 json["description"] = returnData.data->description()->str();
-                json["detected_at"] = base::utils::time::getCurrentISO8601();
-                json["enumeration"] = "CVE";
                 json["id"] = cve;
                 json["published_at"] = returnData.data->datePublished()->str();
                 json["reference"] = returnData.data->reference()->str();
@@ -13,7 +13,9 @@
 #define _SCAN_CONTEXT_HPP
 
 #include "base/utils/stringUtils.hpp"
+#include <memory>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <string>
 
 enum class ScannerType
@@ -49,6 +51,19 @@ struct MatchCondition
     MatchRuleCondition condition; ///< Condition.
 };
 
+/**
+ * @brief Per-agent values shared by every package of a batch scan.
+ *
+ * The OS derived values only depend on the agent, so a batch primes them once and
+ * every package context of the scan reads the shared copy instead of recomputing it.
+ * The cache must be primed before the scan fans out to workers; after that it is
+ * read-only and safe to share between threads.
+ */
+struct AgentScanCache
+{
+    std::optional<std::string> osCPE; ///< Memoized OS CPE name, empty string if the OS is not supported.
+};
+
 /**
  * @brief ScanContext structure.
  *
@@ -77,13 +92,15 @@ public:
                          const nlohmann::json& os,
                          const nlohmann::json& package,
                          const nlohmann::json& hotfixes,
-                         nlohmann::json& response)
+                         nlohmann::json& response,
+                         std::shared_ptr<AgentScanCache> agentCache = nullptr)
         : m_type {type}
-        , packageData {package}
-        , agentData {agent}
-        , osData {os}
-        , hotfixesData {hotfixes}
-        , responseData {response}
+        , packageData {&package}
+        , agentData {&agent}
+        , osData {&os}
+        , hotfixesData {&hotfixes}
+        , responseData {&response}
+        , m_agentCache {std::move(agentCache)}
     {
     }
 
@@ -95,14 +112,49 @@ public:
     ~ScanContext() = default;
     // LCOV_EXCL_STOP
 
+    /**
+     * @brief Rebinds the context to the next event so a pooled instance can be reused.
+     *
+     * @details Clearing the collections keeps their allocated buckets, so a context reused between
+     * events on the same dispatcher thread stops paying the per-event allocation cost after the
+     * first events warm it up. The parameters mirror the constructor.
+     *
+     * @param type Scanner type.
+     * @param agent Agent data.
+     * @param os OS data.
+     * @param package Package data.
+     * @param hotfixes Hotfixes data.
+     * @param response Response accumulator.
+     * @param agentCache Primed per-agent cache, shared by every package of the batch.
+     */
+    void reset(const ScannerType type,
+               const nlohmann::json& agent,
+               const nlohmann::json& os,
+               const nlohmann::json& package,
+               const nlohmann::json& hotfixes,
+               nlohmann::json& response,
+               std::shared_ptr<AgentScanCache> agentCache = nullptr)
+    {
+        m_type = type;
+        packageData = &package;
+        agentData = &agent;
+        osData = &os;
+        hotfixesData = &hotfixes;
+        responseData = &response;
+        m_elements.clear();
+        m_matchConditions.clear();
+        m_osCPE.clear();
+        m_agentCache = std::move(agentCache);
+    }
+
     /**
      * @brief Gets package name.
      * @return Package name.
      */
     std::string_view packageName() const
     {
-        return packageData.contains("/name"_json_pointer)
-                   ? packageData.at("/name"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/name"_json_pointer)
+                   ? packageData->at("/name"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -112,8 +164,8 @@ public:
      */
     std::string_view packageVersion() const
     {
-        return packageData.contains("/version"_json_pointer)
-                   ? packageData.at("/version"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/version"_json_pointer)
+                   ? packageData->at("/version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -123,8 +175,8 @@ public:
      */
     std::string_view packageVendor() const
     {
-        return packageData.contains("/vendor"_json_pointer)
-                   ? packageData.at("/vendor"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/vendor"_json_pointer)
+                   ? packageData->at("/vendor"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -134,8 +186,8 @@ public:
      */
     std::string_view packageInstallTime() const
     {
-        return packageData.contains("/install_time"_json_pointer)
-                   ? packageData.at("/install_time"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/install_time"_json_pointer)
+                   ? packageData->at("/install_time"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -145,8 +197,8 @@ public:
      */
     std::string_view packageLocation() const
     {
-        return packageData.contains("/location"_json_pointer)
-                   ? packageData.at("/location"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/location"_json_pointer)
+                   ? packageData->at("/location"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -156,8 +208,8 @@ public:
      */
     std::string_view packageArchitecture() const
     {
-        return packageData.contains("/architecture"_json_pointer)
-                   ? packageData.at("/architecture"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/architecture"_json_pointer)
+                   ? packageData->at("/architecture"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -167,8 +219,8 @@ public:
      */
     std::string_view packageGroups() const
     {
-        return packageData.contains("/groups"_json_pointer)
-                   ? packageData.at("/groups"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/groups"_json_pointer)
+                   ? packageData->at("/groups"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -178,8 +230,8 @@ public:
      */
     std::string_view packageDescription() const
     {
-        return packageData.contains("/description"_json_pointer)
-                   ? packageData.at("/description"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/description"_json_pointer)
+                   ? packageData->at("/description"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -189,7 +241,7 @@ public:
      */
     uint64_t packageSize() const
     {
-        return packageData.contains("/size"_json_pointer) ? packageData.at("/size"_json_pointer).get<uint64_t>() : 0;
+        return packageData->contains("/size"_json_pointer) ? packageData->at("/size"_json_pointer).get<uint64_t>() : 0;
     }
 
     /**
@@ -198,8 +250,8 @@ public:
      */
     std::string_view packagePriority() const
     {
-        return packageData.contains("/priority"_json_pointer)
-                   ? packageData.at("/priority"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/priority"_json_pointer)
+                   ? packageData->at("/priority"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -209,8 +261,8 @@ public:
      */
     std::string_view packageMultiarch() const
     {
-        return packageData.contains("/multiarch"_json_pointer)
-                   ? packageData.at("/multiarch"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/multiarch"_json_pointer)
+                   ? packageData->at("/multiarch"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -220,8 +272,8 @@ public:
      */
     std::string_view packageSource() const
     {
-        return packageData.contains("/source"_json_pointer)
-                   ? packageData.at("/source"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/source"_json_pointer)
+                   ? packageData->at("/source"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -231,8 +283,8 @@ public:
      */
     std::string_view packageFormat() const
     {
-        return packageData.contains("/format"_json_pointer)
-                   ? packageData.at("/format"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/format"_json_pointer)
+                   ? packageData->at("/format"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -242,8 +294,8 @@ public:
      */
     std::string_view packageItemId() const
     {
-        return packageData.contains("/item_id"_json_pointer)
-                   ? packageData.at("/item_id"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/item_id"_json_pointer)
+                   ? packageData->at("/item_id"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -253,8 +305,8 @@ public:
      */
     std::string_view agentId() const
     {
-        return agentData.contains("/id"_json_pointer)
-                   ? agentData.at("/id"_json_pointer).get_ref<const std::string&>().c_str()
+        return agentData->contains("/id"_json_pointer)
+                   ? agentData->at("/id"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -265,8 +317,8 @@ public:
      */
     std::string_view agentIp() const
     {
-        return agentData.contains("/ip"_json_pointer)
-                   ? agentData.at("/ip"_json_pointer).get_ref<const std::string&>().c_str()
+        return agentData->contains("/ip"_json_pointer)
+                   ? agentData->at("/ip"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -277,8 +329,8 @@ public:
      */
     std::string_view agentName() const
     {
-        return agentData.contains("/name"_json_pointer)
-                   ? agentData.at("/name"_json_pointer).get_ref<const std::string&>().c_str()
+        return agentData->contains("/name"_json_pointer)
+                   ? agentData->at("/name"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -289,8 +341,8 @@ public:
      */
     std::string_view agentVersion() const
     {
-        return agentData.contains("/version"_json_pointer)
-                   ? agentData.at("/version"_json_pointer).get_ref<const std::string&>().c_str()
+        return agentData->contains("/version"_json_pointer)
+                   ? agentData->at("/version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -300,8 +352,8 @@ public:
      */
     std::string_view osHostName() const
     {
-        return osData.contains("/hostname"_json_pointer)
-                   ? osData.at("/hostname"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/hostname"_json_pointer)
+                   ? osData->at("/hostname"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -311,8 +363,8 @@ public:
      */
     std::string_view osArchitecture() const
     {
-        return osData.contains("/architecture"_json_pointer)
-                   ? osData.at("/architecture"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/architecture"_json_pointer)
+                   ? osData->at("/architecture"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -322,8 +374,8 @@ public:
      */
     std::string_view osName() const
     {
-        return osData.contains("/name"_json_pointer)
-                   ? osData.at("/name"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/name"_json_pointer)
+                   ? osData->at("/name"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -333,8 +385,8 @@ public:
      */
     std::string_view osVersion() const
     {
-        return osData.contains("/version"_json_pointer)
-                   ? osData.at("/version"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/version"_json_pointer)
+                   ? osData->at("/version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -344,8 +396,8 @@ public:
      */
     std::string_view osCodeName() const
     {
-        return osData.contains("/codename"_json_pointer)
-                   ? osData.at("/codename"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/codename"_json_pointer)
+                   ? osData->at("/codename"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -355,8 +407,8 @@ public:
      */
     std::string_view osMajorVersion() const
     {
-        return osData.contains("/major_version"_json_pointer)
-                   ? osData.at("/major_version"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/major_version"_json_pointer)
+                   ? osData->at("/major_version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -366,8 +418,8 @@ public:
      */
     std::string_view osMinorVersion() const
     {
-        return osData.contains("/minor_version"_json_pointer)
-                   ? osData.at("/minor_version"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/minor_version"_json_pointer)
+                   ? osData->at("/minor_version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -377,8 +429,8 @@ public:
      */
     std::string_view osPatch() const
     {
-        return osData.contains("/patch"_json_pointer)
-                   ? osData.at("/patch"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/patch"_json_pointer)
+                   ? osData->at("/patch"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -388,8 +440,8 @@ public:
      */
     std::string_view osBuild() const
     {
-        return osData.contains("/build"_json_pointer)
-                   ? osData.at("/build"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/build"_json_pointer)
+                   ? osData->at("/build"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -399,8 +451,8 @@ public:
      */
     std::string_view osPlatform() const
     {
-        return osData.contains("/platform"_json_pointer)
-                   ? osData.at("/platform"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/platform"_json_pointer)
+                   ? osData->at("/platform"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -410,8 +462,8 @@ public:
      */
     std::string_view osKernelSysName() const
     {
-        return osData.contains("/kernel_name"_json_pointer)
-                   ? osData.at("/kernel_name"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/kernel_name"_json_pointer)
+                   ? osData->at("/kernel_name"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -421,8 +473,8 @@ public:
      */
     std::string_view osKernelRelease() const
     {
-        return osData.contains("/kernel_release"_json_pointer)
-                   ? osData.at("/kernel_release"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/kernel_release"_json_pointer)
+                   ? osData->at("/kernel_release"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -432,8 +484,8 @@ public:
      */
     std::string_view osKernelVersion() const
     {
-        return osData.contains("/kernel_version"_json_pointer)
-                   ? osData.at("/kernel_version"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/kernel_version"_json_pointer)
+                   ? osData->at("/kernel_version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -443,8 +495,8 @@ public:
      */
     std::string_view osRelease() const
     {
-        return osData.contains("/release"_json_pointer)
-                   ? osData.at("/release"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/release"_json_pointer)
+                   ? osData->at("/release"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -454,8 +506,8 @@ public:
      */
     std::string_view osDisplayVersion() const
     {
-        return osData.contains("/display_version"_json_pointer)
-                   ? osData.at("/display_version"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/display_version"_json_pointer)
+                   ? osData->at("/display_version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -465,6 +517,12 @@ public:
      */
     std::string_view osCPEName(const nlohmann::json& osCpeMaps)
     {
+        // A primed batch cache already holds the agent's CPE, skip the recomputation
+        if (m_agentCache && m_agentCache->osCPE)
+        {
+            return *m_agentCache->osCPE;
+        }
+
         if (m_osCPE.empty())
         {
             m_osCPE = "cpe:/o:";
@@ -502,6 +560,11 @@ public:
                 // Clear the cpeName if the OS is not supported
                 m_osCPE = "";
             }
+
+            if (m_agentCache)
+            {
+                m_agentCache->osCPE = m_osCPE;
+            }
         }
         return m_osCPE;
     }
@@ -513,7 +576,7 @@ public:
      *
      * @return std::string_view hotfix identifier.
      */
-    const nlohmann::json& hotfixes() const { return hotfixesData; }
+    const nlohmann::json& hotfixes() const { return *hotfixesData; }
 
     /**
      * @brief Elements to process.
@@ -532,16 +595,17 @@ public:
      * @brief Move response data.
      * @param data Data to append.
      */
-    void moveResponseData(nlohmann::json& data) { responseData.push_back(std::move(data)); }
+    void moveResponseData(nlohmann::json& data) { responseData->push_back(std::move(data)); }
 
 private:
-    const ScannerType m_type;
-    const nlohmann::json& packageData;
-    const nlohmann::json& agentData;
-    const nlohmann::json& osData;
-    const nlohmann::json& hotfixesData;
-    nlohmann::json& responseData;
+    ScannerType m_type;
+    const nlohmann::json* packageData;
+    const nlohmann::json* agentData;
+    const nlohmann::json* osData;
+    const nlohmann::json* hotfixesData;
+    nlohmann::json* responseData;
     std::string m_osCPE;
+    std::shared_ptr<AgentScanCache> m_agentCache;
 };
 
 #endif // _SCAN_CONTEXT_HPP
@@ -2,11 +2,25 @@
 #include "base/logging.hpp"
 #include "factoryOrchestrator.hpp"
 #include "scanContext.hpp"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 using namespace vdscanner;
 
 static const std::map<std::string, PayloadType, std::less<>> SCAN_TYPE {{"packagelist", PayloadType::PackageList},
-                                                                        {"fullscan", PayloadType::FullScan}};
+                                                                        {"fullscan", PayloadType::FullScan},
+                                                                        {"checkpoint", PayloadType::Checkpoint}};
+
+// Package lists smaller than this are scanned serially: the fan-out cost exceeds the win.
+constexpr size_t PARALLEL_SCAN_MIN_PACKAGES {16};
+
+static void
+scanPackages(const std::shared_ptr<utils::patterns::AbstractHandler<std::shared_ptr<ScanContext>>>& packageScan,
+             const std::shared_ptr<DatabaseFeedManager>& databaseFeedManager,
+             const nlohmann::json& request,
+             nlohmann::json& responseJson);
 
 ScanOrchestrator::ScanOrchestrator()
 {
@@ -39,27 +53,33 @@ void ScanOrchestrator::run(const PayloadType type, const nlohmann::json& request
         osScan->handleRequest(std::make_shared<ScanContext>(
             ScannerType::Os, request.at("agent"), request.at("os"), nullptr, request.at("hotfixes"), responseJson));
 
-        for (const auto& package : request.at("packages"))
+        scanPackages(packageScan, m_databaseFeedManager, request, responseJson);
+
+        // Record the completed scan so an interrupted fleet rescan can resume from the pending agents.
+        if (const auto feedVersion = request.value("feed_version", std::string {}); !feedVersion.empty())
         {
-            packageScan->handleRequest(std::make_shared<ScanContext>(ScannerType::Package,
-                                                                     request.at("agent"),
-                                                                     request.at("os"),
-                                                                     package,
-                                                                     request.at("hotfixes"),
-                                                                     responseJson));
+            m_databaseFeedManager->setAgentScanCheckpoint(request.at("agent").at("id").get<std::string>(),
+                                                          feedVersion);
         }
     }
     else if (type == PayloadType::PackageList)
     {
-        for (const auto& package : request.at("packages"))
+        scanPackages(packageScan, m_databaseFeedManager, request, responseJson);
+    }
+    else if (type == PayloadType::Checkpoint)
+    {
+        const auto& feedVersion = request.at("feed_version").get_ref<const std::string&>();
+        auto pendingAgents = nlohmann::json::array();
+
+        for (const auto& agentId : request.at("agents"))
         {
-            packageScan->handleRequest(std::make_shared<ScanContext>(ScannerType::Package,
-                                                                     request.at("agent"),
-                                                                     request.at("os"),
-                                                                     package,
-                                                                     request.at("hotfixes"),
-                                                                     responseJson));
+            if (m_databaseFeedManager->getAgentScanCheckpoint(agentId.get<std::string>()) != feedVersion)
+            {
+                pendingAgents.push_back(agentId);
+            }
         }
+
+        responseJson["pending_agents"] = std::move(pendingAgents);
     }
     else
     {
@@ -68,3 +88,142 @@ void ScanOrchestrator::run(const PayloadType type, const nlohmann::json& request
 
     response = responseJson.dump();
 }
+
+// Scans a package list, stealing packages off a shared index across a core-sized worker pool when the list is
+// large enough to amortize the fan-out.
+static void
+scanPackages(const std::shared_ptr<utils::patterns::AbstractHandler<std::shared_ptr<ScanContext>>>& packageScan,
+             const std::shared_ptr<DatabaseFeedManager>& databaseFeedManager,
+             const nlohmann::json& request,
+             nlohmann::json& responseJson)
+{
+    const auto& packages = request.at("packages");
+
+    // Prime the per-agent values once, every package context of the batch then reads the
+    // shared copy; priming happens before the fan-out so the cache is read-only afterwards.
+    auto agentCache = std::make_shared<AgentScanCache>();
+    {
+        static const nlohmann::json emptyPackage;
+        nlohmann::json primeResponse;
+        ScanContext primeContext {ScannerType::Package,
+                                  request.at("agent"),
+                                  request.at("os"),
+                                  emptyPackage,
+                                  request.at("hotfixes"),
+                                  primeResponse,
+                                  agentCache};
+        primeContext.osCPEName(databaseFeedManager->cpeMappings());
+    }
+
+    const auto workerCount =
+        std::min<size_t>(std::max<size_t>(std::thread::hardware_concurrency(), 1), packages.size());
+
+    if (workerCount < 2 || packages.size() < PARALLEL_SCAN_MIN_PACKAGES)
+    {
+        // A single pooled context is reused across the packages: reset() rebinds it to the next
+        // package while keeping the collections allocated by the previous one.
+        std::shared_ptr<ScanContext> context;
+        for (const auto& package : packages)
+        {
+            if (context)
+            {
+                context->reset(ScannerType::Package,
+                               request.at("agent"),
+                               request.at("os"),
+                               package,
+                               request.at("hotfixes"),
+                               responseJson,
+                               agentCache);
+            }
+            else
+            {
+                context = std::make_shared<ScanContext>(ScannerType::Package,
+                                                        request.at("agent"),
+                                                        request.at("os"),
+                                                        package,
+                                                        request.at("hotfixes"),
+                                                        responseJson,
+                                                        agentCache);
+            }
+            packageScan->handleRequest(context);
+        }
+        return;
+    }
+
+    // Workers steal the next package off a shared index, so a few heavyweight packages do not leave cores idle,
+    // and each worker appends its findings to its own response fragment to avoid contention on the shared one.
+    std::atomic<size_t> nextPackage {0};
+    std::vector<nlohmann::json> partialResponses(workerCount);
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+
+    auto worker = [&](const size_t workerIndex)
+    {
+        try
+        {
+            // Each worker keeps one pooled context and resets it between packages, so after the
+            // first package the per-event collections are reused instead of reallocated.
+            std::shared_ptr<ScanContext> context;
+            for (auto i = nextPackage.fetch_add(1); i < packages.size(); i = nextPackage.fetch_add(1))
+            {
+                if (context)
+                {
+                    context->reset(ScannerType::Package,
+                                   request.at("agent"),
+                                   request.at("os"),
+                                   packages.at(i),
+                                   request.at("hotfixes"),
+                                   partialResponses.at(workerIndex),
+                                   agentCache);
+                }
+                else
+                {
+                    context = std::make_shared<ScanContext>(ScannerType::Package,
+                                                            request.at("agent"),
+                                                            request.at("os"),
+                                                            packages.at(i),
+                                                            request.at("hotfixes"),
+                                                            partialResponses.at(workerIndex),
+                                                            agentCache);
+                }
+                packageScan->handleRequest(context);
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError)
+            {
+                firstError = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (size_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+    {
+        workers.emplace_back(worker, workerIndex);
+    }
+
+    for (auto& thread : workers)
+    {
+        thread.join();
+    }
+
+    if (firstError)
+    {
+        std::rethrow_exception(firstError);
+    }
+
+    for (auto& partialResponse : partialResponses)
+    {
+        if (partialResponse.is_array())
+        {
+            for (auto& element : partialResponse)
+            {
+                responseJson.push_back(std::move(element));
+            }
+        }
+    }
+}
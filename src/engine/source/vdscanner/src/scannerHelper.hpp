@@ -13,6 +13,7 @@
 #define _SCANNER_HELPER_HPP
 
 #include "base/utils/stringUtils.hpp"
+#include <array>
 #include <string>
 
 /**
@@ -79,21 +80,26 @@ public:
     static CPE parseCPE(std::string_view cpeString)
     {
         CPE cpe {};
-        std::vector<std::string> cpeParts = base::utils::string::split(cpeString, ':');
+        // A 2.3 CPE has at most 13 colon separated parts, split into views over the input to
+        // avoid allocating a string per part on this per-candidate path.
+        std::array<std::string_view, 13> cpeParts {};
+        const auto partsCount = base::utils::string::splitView(cpeString, ':', cpeParts);
 
         // Check if is 2.2 or 2.3
         // If is 2.2, the first part is "cpe"
         // If is 2.3, the first part is "cpe" and the second part is "2.3"
         const auto offset = base::utils::string::startsWith(cpeString, "cpe:2.3") ? 1 : 0;
 
-        cpe.cpeVersion = offset == 0 ? "2.2" : cpeParts[CPE_VERSION_INDEX];
-        cpe.indexQuantity = cpeParts.size() - offset - 1; // -1 because the first part is "cpe"
+        cpe.cpeVersion = offset == 0 ? std::string_view {"2.2"} : cpeParts[CPE_VERSION_INDEX];
+        cpe.indexQuantity = partsCount - offset - 1; // -1 because the first part is "cpe"
 
-        const auto maxAvailableIndex {cpeParts.empty() ? 0 : cpeParts.size() - 1};
+        const auto maxAvailableIndex {partsCount == 0 ? 0 : partsCount - 1};
 
         if (maxAvailableIndex >= CPEFIELDS::product + offset)
         {
-            cpe.part = base::utils::string::leftTrim(cpeParts[CPEFIELDS::part + offset], "/");
+            auto partView = cpeParts[CPEFIELDS::part + offset];
+            partView.remove_prefix(std::min(partView.find_first_not_of('/'), partView.size()));
+            cpe.part = partView;
             cpe.vendor = cpeParts[CPEFIELDS::vendor + offset];
             cpe.product = cpeParts[CPEFIELDS::product + offset];
         }
@@ -28,6 +28,20 @@ enum class VersionObjectType : int
  */
 class IVersionObject
 {
+private:
+    VersionObjectType m_type; ///< Scheme of the concrete class, stored to keep getType() non-virtual.
+
+protected:
+    /**
+     * @brief Constructor.
+     *
+     * @param type Scheme of the concrete class.
+     */
+    explicit IVersionObject(VersionObjectType type)
+        : m_type {type}
+    {
+    }
+
 public:
     // LCOV_EXCL_START
     virtual ~IVersionObject() = default;
@@ -36,9 +50,11 @@ public:
     /**
      * @brief Returns the VersionObjectType of the concrete class.
      *
+     * @note The type is stored at construction, so the query is a member read instead of a virtual call.
+     *
      * @return VersionObjectType.
      */
-    virtual VersionObjectType getType() = 0;
+    VersionObjectType getType() const { return m_type; }
 
     /**
      * @brief Comparison operator ==.
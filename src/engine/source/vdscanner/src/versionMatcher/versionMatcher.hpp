@@ -19,9 +19,12 @@
 #include "versionObjectPEP440.hpp"
 #include "versionObjectRpm.hpp"
 #include "versionObjectSemVer.hpp"
+#include <array>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <variant>
 
 enum class VersionComparisonResult : int
@@ -44,6 +47,80 @@ enum class VersionMatcherStrategy : int
 
 using PackageMap = std::unordered_map<std::string_view, std::variant<VersionObjectType, VersionMatcherStrategy>>;
 
+/**
+ * @brief Memoization cache of parsed version objects.
+ *
+ * @details Comparing one package version against many CVE candidates parses the same version string once per
+ * comparison. Routing the comparisons through a cache parses each distinct (version, type) pair once and reuses the
+ * resulting object. Failed parses are cached too, so invalid strings are not re-tried. The cache is not thread safe:
+ * it is meant to live in a single scan context and be discarded with it.
+ */
+class VersionObjectCache final
+{
+public:
+    /**
+     * @brief Builds the cache key for a version string and its version type or matcher strategy.
+     *
+     * @param version Version string.
+     * @param type Version object or matcher strategy.
+     * @return std::string Cache key.
+     */
+    static std::string makeKey(const std::string& version,
+                               const std::variant<VersionObjectType, VersionMatcherStrategy>& type)
+    {
+        // Strategies are offset so their tags never collide with version object types.
+        constexpr auto STRATEGY_TAG_OFFSET {100};
+        const auto typeTag = std::holds_alternative<VersionObjectType>(type)
+                                 ? static_cast<int>(std::get<VersionObjectType>(type))
+                                 : STRATEGY_TAG_OFFSET + static_cast<int>(std::get<VersionMatcherStrategy>(type));
+        return std::to_string(typeTag) + ':' + version;
+    }
+
+    /**
+     * @brief Looks up a cached parse result.
+     *
+     * @param key Cache key built with makeKey.
+     * @param object Output parse result. May be set to nullptr if the cached parse failed.
+     * @return true If the key was found in the cache.
+     * @return false If the key has not been cached yet.
+     */
+    bool find(const std::string& key, std::shared_ptr<IVersionObject>& object) const
+    {
+        const auto it = m_entries.find(key);
+        if (it == m_entries.end())
+        {
+            return false;
+        }
+
+        object = it->second;
+        return true;
+    }
+
+    /**
+     * @brief Stores a parse result, including failed parses (nullptr).
+     *
+     * @param key Cache key built with makeKey.
+     * @param object Parse result to store.
+     */
+    void insert(const std::string& key, std::shared_ptr<IVersionObject> object)
+    {
+        m_entries.emplace(key, std::move(object));
+    }
+
+    /**
+     * @brief Returns the number of cached parse results.
+     *
+     * @return size_t Cache size.
+     */
+    size_t size() const
+    {
+        return m_entries.size();
+    }
+
+private:
+    std::unordered_map<std::string, std::shared_ptr<IVersionObject>> m_entries;
+};
+
 /**
  * @brief VersionMatcher class.
  *
@@ -242,6 +319,100 @@ private:
         }
     }
 
+    /**
+     * @brief Creates a version object through a memoization cache.
+     *
+     * @details The cache is consulted first; on a miss the object is created and stored, including failed parses
+     * (nullptr), so each distinct (version, type) pair is parsed at most once per cache lifetime.
+     *
+     * @param version string version item to create object from
+     * @param type Version object or matcher strategy.
+     * @param cache Parse cache to consult and fill.
+     * @return std::shared_ptr<IVersionObject>
+     */
+    static std::shared_ptr<IVersionObject> createVersionObject(
+        const std::string& version, std::variant<VersionObjectType, VersionMatcherStrategy> type,
+        VersionObjectCache& cache)
+    {
+        std::shared_ptr<IVersionObject> object;
+        const auto key = VersionObjectCache::makeKey(version, type);
+
+        if (!cache.find(key, object))
+        {
+            object = createVersionObject(version, type);
+            cache.insert(key, object);
+        }
+
+        return object;
+    }
+
+    /**
+     * @brief Typed comparison path for a concrete versioning scheme.
+     *
+     * @details Both operands are known to be of type T, so the comparison runs through the typed
+     * non-virtual methods of the concrete class, with no virtual dispatch and no RTTI cast.
+     *
+     * @tparam T Concrete version object class of both operands.
+     * @param a Version object A.
+     * @param b Version object B.
+     * @return VersionComparisonResult result of the comparison.
+     */
+    template<typename T>
+    static VersionComparisonResult compareTyped(const IVersionObject& a, const IVersionObject& b)
+    {
+        const auto& objA = static_cast<const T&>(a);
+        const auto& objB = static_cast<const T&>(b);
+
+        if (objA.equals(objB))
+        {
+            return VersionComparisonResult::A_EQUAL_B;
+        }
+        else if (objA.lessThan(objB))
+        {
+            return VersionComparisonResult::A_LESS_THAN_B;
+        }
+        else
+        {
+            return VersionComparisonResult::A_GREATER_THAN_B;
+        }
+    }
+
+    using TypedCompareFn = VersionComparisonResult (*)(const IVersionObject&, const IVersionObject&);
+
+    /// Comparison paths indexed by VersionObjectType, bound at compile time per scheme.
+    static constexpr std::array<TypedCompareFn, 6> TYPED_COMPARE_TABLE {compareTyped<VersionObjectCalVer>,
+                                                                        compareTyped<VersionObjectPEP440>,
+                                                                        compareTyped<VersionObjectMajorMinor>,
+                                                                        compareTyped<VersionObjectSemVer>,
+                                                                        compareTyped<VersionObjectDpkg>,
+                                                                        compareTyped<VersionObjectRpm>};
+
+    /**
+     * @brief Compares 2 parsed version objects.
+     *
+     * @details Once both objects are known to share a scheme, the comparison is dispatched through
+     * the typed path of that scheme, avoiding virtual calls and RTTI casts in the candidate loop.
+     *
+     * @param pVersionObjectA Parsed version object A. May be nullptr if the parse failed.
+     * @param pVersionObjectB Parsed version object B. May be nullptr if the parse failed.
+     * @param versionA string version item A, used for the error message.
+     * @param versionB string version item B, used for the error message.
+     * @return VersionComparisonResult result of the comparison.
+     */
+    static VersionComparisonResult compareObjects(const std::shared_ptr<IVersionObject>& pVersionObjectA,
+                                                  const std::shared_ptr<IVersionObject>& pVersionObjectB,
+                                                  const std::string& versionA,
+                                                  const std::string& versionB)
+    {
+        if (pVersionObjectA && pVersionObjectB && pVersionObjectA->getType() == pVersionObjectB->getType())
+        {
+            return TYPED_COMPARE_TABLE[static_cast<size_t>(pVersionObjectA->getType())](*pVersionObjectA,
+                                                                                        *pVersionObjectB);
+        }
+
+        throw std::invalid_argument("Unable to compare versions (" + versionA + " vs " + versionB + ").");
+    }
+
 public:
     /**
      * @brief Compares 2 version strings.
@@ -259,24 +430,30 @@ public:
         auto pVersionObjectA = createVersionObject(versionA, type);
         auto pVersionObjectB = createVersionObject(versionB, type);
 
-        if (pVersionObjectA && pVersionObjectB && pVersionObjectA->getType() == pVersionObjectB->getType())
-        {
+        return compareObjects(pVersionObjectA, pVersionObjectB, versionA, versionB);
+    }
 
-            if (*pVersionObjectA == *pVersionObjectB)
-            {
-                return VersionComparisonResult::A_EQUAL_B;
-            }
-            else if (*pVersionObjectA < *pVersionObjectB)
-            {
-                return VersionComparisonResult::A_LESS_THAN_B;
-            }
-            else
-            {
-                return VersionComparisonResult::A_GREATER_THAN_B;
-            }
-        }
+    /**
+     * @brief Compares 2 version strings, memoizing the parsed objects in a cache.
+     *
+     * @details Behaves like compare(), but each distinct (version, type) pair is parsed at most once per cache
+     * lifetime. Intended for scan loops that compare one installed version against many candidate versions.
+     *
+     * @param versionA string version item A to compare
+     * @param versionB string version item B to compare
+     * @param type Version object or matcher strategy to compare A and B.
+     * @param cache Parse cache to consult and fill.
+     * @return VersionComparisonResult result of the comparison.
+     */
+    static VersionComparisonResult compare(const std::string& versionA,
+                                           const std::string& versionB,
+                                           std::variant<VersionObjectType, VersionMatcherStrategy> type,
+                                           VersionObjectCache& cache)
+    {
+        auto pVersionObjectA = createVersionObject(versionA, type, cache);
+        auto pVersionObjectB = createVersionObject(versionB, type, cache);
 
-        throw std::invalid_argument("Unable to compare versions (" + versionA + " vs " + versionB + ").");
+        return compareObjects(pVersionObjectA, pVersionObjectB, versionA, versionB);
     }
 
     /**
@@ -293,6 +470,24 @@ public:
     {
         return (nullptr != createVersionObject(version, type));
     }
+
+    /**
+     * @brief Checks whether a version string matches the given version type, memoizing the parse result.
+     *
+     * @details An unspecified version type is not allowed.
+     *
+     * @param version Version to validate.
+     * @param type Version object or matcher strategy.
+     * @param cache Parse cache to consult and fill.
+     * @return true If the version is valid.
+     * @return false If the version is not valid.
+     */
+    static bool match(const std::string& version,
+                      std::variant<VersionObjectType, VersionMatcherStrategy> type,
+                      VersionObjectCache& cache)
+    {
+        return (nullptr != createVersionObject(version, type, cache));
+    }
 };
 
 #endif // _VERSION_MATCHER_HPP
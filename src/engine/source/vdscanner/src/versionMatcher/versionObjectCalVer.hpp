@@ -101,7 +101,8 @@ public:
      * @param version CalVer object.
      */
     explicit VersionObjectCalVer(const CalVer& version)
-        : m_year {version.year}
+        : IVersionObject(VersionObjectType::CalVer)
+        , m_year {version.year}
         , m_month {version.month}
         , m_day {version.day}
         , m_micro {version.micro}
@@ -113,70 +114,85 @@ public:
     // LCOV_EXCL_STOP
 
     /**
-     * @brief Returns the VersionObjectType of this class.
-     *
-     * @return VersionObjectType.
-     */
-    VersionObjectType getType() override { return VersionObjectType::CalVer; }
-
-    /**
-     * @brief Comparison operator ==.
+     * @brief Typed equality comparison, free of virtual dispatch and casts.
      *
      * @param b comparison rhs object.
      * @return true/false according to equality condition.
      */
-    bool operator==(const IVersionObject& b) const override
+    bool equals(const VersionObjectCalVer& b) const
     {
-        const auto* pB = dynamic_cast<const VersionObjectCalVer*>(&b);
-        if (pB == nullptr)
-        {
-            throw std::runtime_error {"Error casting VersionObject type"};
-        }
-        return (m_year == pB->m_year && m_month == pB->m_month && m_day == pB->m_day && m_micro == pB->m_micro);
+        return (m_year == b.m_year && m_month == b.m_month && m_day == b.m_day && m_micro == b.m_micro);
     }
 
     /**
-     * @brief Comparison operator <.
+     * @brief Typed less than comparison, free of virtual dispatch and casts.
      *
      * @param b comparison rhs object.
      * @return true/false according to less than condition.
      */
-    bool operator<(const IVersionObject& b) const override
+    bool lessThan(const VersionObjectCalVer& b) const
     {
-        const auto* pB = dynamic_cast<const VersionObjectCalVer*>(&b);
-        if (pB == nullptr)
+        if (m_year < b.m_year)
         {
-            throw std::runtime_error {"Error casting VersionObject type"};
+            return true;
+        }
+        else if (m_year > b.m_year)
+        {
+            return false;
         }
 
-        if (m_year < pB->m_year)
+        if (m_month < b.m_month)
         {
             return true;
         }
-        else if (m_year > pB->m_year)
+        else if (m_month > b.m_month)
         {
             return false;
         }
 
-        if (m_month < pB->m_month)
+        if (m_day < b.m_day)
         {
             return true;
         }
-        else if (m_month > pB->m_month)
+        else if (m_day > b.m_day)
         {
             return false;
         }
 
-        if (m_day < pB->m_day)
+        return m_micro < b.m_micro;
+    }
+
+    /**
+     * @brief Comparison operator ==.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
+     */
+    bool operator==(const IVersionObject& b) const override
+    {
+        const auto* pB = dynamic_cast<const VersionObjectCalVer*>(&b);
+        if (pB == nullptr)
         {
-            return true;
+            throw std::runtime_error {"Error casting VersionObject type"};
         }
-        else if (m_day > pB->m_day)
+        return equals(*pB);
+    }
+
+    /**
+     * @brief Comparison operator <.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
+     */
+    bool operator<(const IVersionObject& b) const override
+    {
+        const auto* pB = dynamic_cast<const VersionObjectCalVer*>(&b);
+        if (pB == nullptr)
         {
-            return false;
+            throw std::runtime_error {"Error casting VersionObject type"};
         }
 
-        return m_micro < pB->m_micro;
+        return lessThan(*pB);
     }
 };
 
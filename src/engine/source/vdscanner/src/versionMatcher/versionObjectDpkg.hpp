@@ -269,7 +269,8 @@ public:
      * @param version version SemVer object.
      */
     explicit VersionObjectDpkg(const Dpkg& version)
-        : m_epoch {version.epoch}
+        : IVersionObject(VersionObjectType::DPKG)
+        , m_epoch {version.epoch}
         , m_version {version.version}
         , m_revision {version.revision}
     {
@@ -279,11 +280,26 @@ public:
     // LCOV_EXCL_STOP
 
     /**
-     * @brief Returns the VersionObjectType of this class.
+     * @brief Typed equality comparison, free of virtual dispatch and casts.
      *
-     * @return VersionObjectType.
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
+     */
+    bool equals(const VersionObjectDpkg& b) const
+    {
+        return compareDpkgVersion(b.m_epoch, b.m_version, b.m_revision) == 0;
+    }
+
+    /**
+     * @brief Typed less than comparison, free of virtual dispatch and casts.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
      */
-    VersionObjectType getType() override { return VersionObjectType::DPKG; }
+    bool lessThan(const VersionObjectDpkg& b) const
+    {
+        return compareDpkgVersion(b.m_epoch, b.m_version, b.m_revision) < 0;
+    }
 
     /**
      * @brief Comparison operator ==.
@@ -298,7 +314,7 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
-        return compareDpkgVersion(pB->m_epoch, pB->m_version, pB->m_revision) == 0;
+        return equals(*pB);
     }
 
     /**
@@ -314,7 +330,7 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
-        return compareDpkgVersion(pB->m_epoch, pB->m_version, pB->m_revision) < 0;
+        return lessThan(*pB);
     }
 };
 
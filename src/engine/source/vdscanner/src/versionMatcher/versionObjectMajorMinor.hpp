@@ -66,7 +66,8 @@ public:
      * @param version version MajorMinor object.
      */
     explicit VersionObjectMajorMinor(const MajorMinor& version)
-        : m_major {version.major}
+        : IVersionObject(VersionObjectType::MajorMinor)
+        , m_major {version.major}
         , m_minor {version.minor}
     {
     }
@@ -76,11 +77,32 @@ public:
     // LCOV_EXCL_STOP
 
     /**
-     * @brief Returns the VersionObjectType of this class.
+     * @brief Typed equality comparison, free of virtual dispatch and casts.
      *
-     * @return VersionObjectType.
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
+     */
+    bool equals(const VersionObjectMajorMinor& b) const { return (m_major == b.m_major && m_minor == b.m_minor); }
+
+    /**
+     * @brief Typed less than comparison, free of virtual dispatch and casts.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
      */
-    VersionObjectType getType() override { return VersionObjectType::MajorMinor; }
+    bool lessThan(const VersionObjectMajorMinor& b) const
+    {
+        if (m_major < b.m_major)
+        {
+            return true;
+        }
+        else if (m_major > b.m_major)
+        {
+            return false;
+        }
+
+        return m_minor < b.m_minor;
+    }
 
     /**
      * @brief Comparison operator ==.
@@ -95,7 +117,7 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
-        return (m_major == pB->m_major && m_minor == pB->m_minor);
+        return equals(*pB);
     }
 
     /**
@@ -112,16 +134,7 @@ public:
             throw std::runtime_error {"Error casting VersionObject type"};
         }
 
-        if (m_major < pB->m_major)
-        {
-            return true;
-        }
-        else if (m_major > pB->m_major)
-        {
-            return false;
-        }
-
-        return m_minor < pB->m_minor;
+        return lessThan(*pB);
     }
 };
 
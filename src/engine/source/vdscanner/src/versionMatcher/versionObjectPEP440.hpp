@@ -178,7 +178,8 @@ public:
      * @param version version PEP440 struct.
      */
     explicit VersionObjectPEP440(const PEP440& version)
-        : m_epoch(version.epoch)
+        : IVersionObject(VersionObjectType::PEP440)
+        , m_epoch(version.epoch)
         , m_versionStr(version.versionStr)
         , m_preReleaseStr(version.preReleaseStr)
         , m_preReleaseNumber(version.preReleaseNumber)
@@ -194,11 +195,19 @@ public:
     // LCOV_EXCL_STOP
 
     /**
-     * @brief Returns the VersionObjectType of this class.
+     * @brief Typed equality comparison, free of virtual dispatch and casts.
      *
-     * @return VersionObjectType.
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
      */
-    VersionObjectType getType() override { return VersionObjectType::PEP440; }
+    bool equals(const VersionObjectPEP440& b) const
+    {
+        return (m_epoch == b.m_epoch && !compareVersionStr(m_versionStr, b.m_versionStr)
+                && m_preReleaseStr == b.m_preReleaseStr && m_preReleaseNumber == b.m_preReleaseNumber
+                && m_postReleaseNumber == b.m_postReleaseNumber && m_devReleaseNumber == b.m_devReleaseNumber
+                && m_hasPreRelease == b.m_hasPreRelease && m_hasPostRelease == b.m_hasPostRelease
+                && m_hasDevRelease == b.m_hasDevRelease);
+    }
 
     /**
      * @brief Comparison operator ==.
@@ -213,26 +222,18 @@ public:
         {
             throw std::runtime_error {"Error casting VersionObject type"};
         }
-        return (m_epoch == pB->m_epoch && !compareVersionStr(m_versionStr, pB->m_versionStr)
-                && m_preReleaseStr == pB->m_preReleaseStr && m_preReleaseNumber == pB->m_preReleaseNumber
-                && m_postReleaseNumber == pB->m_postReleaseNumber && m_devReleaseNumber == pB->m_devReleaseNumber
-                && m_hasPreRelease == pB->m_hasPreRelease && m_hasPostRelease == pB->m_hasPostRelease
-                && m_hasDevRelease == pB->m_hasDevRelease);
+        return equals(*pB);
     }
 
     /**
-     * @brief Comparison operator <.
+     * @brief Typed less than comparison, free of virtual dispatch and casts.
      *
      * @param b comparison rhs object.
      * @return true/false according to less than condition.
      */
-    bool operator<(const IVersionObject& b) const override
+    bool lessThan(const VersionObjectPEP440& b) const
     {
-        const auto* pB = dynamic_cast<const VersionObjectPEP440*>(&b);
-        if (pB == nullptr)
-        {
-            throw std::runtime_error {"Error casting VersionObject type"};
-        }
+        const auto* pB = &b;
 
         if (m_epoch < pB->m_epoch)
         {
@@ -325,6 +326,23 @@ public:
 
         return false;
     }
+
+    /**
+     * @brief Comparison operator <.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
+     */
+    bool operator<(const IVersionObject& b) const override
+    {
+        const auto* pB = dynamic_cast<const VersionObjectPEP440*>(&b);
+        if (pB == nullptr)
+        {
+            throw std::runtime_error {"Error casting VersionObject type"};
+        }
+
+        return lessThan(*pB);
+    }
 };
 
 #endif // _VERSION_OBJECT_PEP440_HPP
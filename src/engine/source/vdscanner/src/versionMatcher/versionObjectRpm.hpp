@@ -339,7 +339,8 @@ public:
      * @param version version SemVer object.
      */
     explicit VersionObjectRpm(const Rpm& version)
-        : m_epoch(version.epoch)
+        : IVersionObject(VersionObjectType::RPM)
+        , m_epoch(version.epoch)
         , m_version(version.version)
         , m_release(version.release)
     {
@@ -349,11 +350,26 @@ public:
     // LCOV_EXCL_STOP
 
     /**
-     * @brief Returns the VersionObjectType of this class.
+     * @brief Typed equality comparison, free of virtual dispatch and casts.
      *
-     * @return VersionObjectType.
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
+     */
+    bool equals(const VersionObjectRpm& b) const
+    {
+        return compareRpmVersion(b.m_epoch, b.m_version, b.m_release) == LEFT_EQ_RIGHT;
+    }
+
+    /**
+     * @brief Typed less than comparison, free of virtual dispatch and casts.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
      */
-    VersionObjectType getType() override { return VersionObjectType::RPM; }
+    bool lessThan(const VersionObjectRpm& b) const
+    {
+        return compareRpmVersion(b.m_epoch, b.m_version, b.m_release) == RIGHT_IS_NEWER;
+    }
 
     /**
      * @brief Comparison operator ==.
@@ -369,7 +385,7 @@ public:
             throw std::runtime_error {"Error casting VersionObject type"};
         }
 
-        return compareRpmVersion(pB->m_epoch, pB->m_version, pB->m_release) == LEFT_EQ_RIGHT;
+        return equals(*pB);
     }
 
     /**
@@ -386,7 +402,7 @@ public:
             throw std::runtime_error {"Error casting VersionObject type"};
         }
 
-        return compareRpmVersion(pB->m_epoch, pB->m_version, pB->m_release) == RIGHT_IS_NEWER;
+        return lessThan(*pB);
     }
 };
 
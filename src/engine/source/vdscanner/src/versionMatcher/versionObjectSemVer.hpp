@@ -75,7 +75,8 @@ public:
      * @param version version SemVer object.
      */
     explicit VersionObjectSemVer(const SemVer& version)
-        : m_major {version.major}
+        : IVersionObject(VersionObjectType::SemVer)
+        , m_major {version.major}
         , m_minor {version.minor}
         , m_patch {version.patch}
         , m_preRelease {version.preRelease}
@@ -87,77 +88,59 @@ public:
     // LCOV_EXCL_STOP
 
     /**
-     * @brief Returns the VersionObjectType of this class.
-     *
-     * @return VersionObjectType.
-     */
-    VersionObjectType getType() override { return VersionObjectType::SemVer; }
-
-    /**
-     * @brief Comparison operator ==.
+     * @brief Typed equality comparison, free of virtual dispatch and casts.
      *
      * @param b comparison rhs object.
      * @return true/false according to equality condition.
      */
-    bool operator==(const IVersionObject& b) const override
+    bool equals(const VersionObjectSemVer& b) const
     {
-        const auto* pB = dynamic_cast<const VersionObjectSemVer*>(&b);
-        if (pB == nullptr)
-        {
-            throw std::runtime_error {"Error casting VersionObject type"};
-        }
-        return (m_major == pB->m_major && m_minor == pB->m_minor && m_patch == pB->m_patch
-                && m_preRelease == pB->m_preRelease);
+        return (m_major == b.m_major && m_minor == b.m_minor && m_patch == b.m_patch
+                && m_preRelease == b.m_preRelease);
     }
 
     /**
-     * @brief Comparison operator <.
+     * @brief Typed less than comparison, free of virtual dispatch and casts.
      *
      * @param b comparison rhs object.
      * @return true/false according to less than condition.
      */
-    bool operator<(const IVersionObject& b) const override
+    bool lessThan(const VersionObjectSemVer& b) const
     {
-        const auto* pB = dynamic_cast<const VersionObjectSemVer*>(&b);
-        if (pB == nullptr)
-        {
-            throw std::runtime_error {"Error casting VersionObject type"};
-        }
-
-        if (m_major < pB->m_major)
+        if (m_major < b.m_major)
         {
             return true;
         }
-        else if (m_major > pB->m_major)
+        else if (m_major > b.m_major)
         {
             return false;
         }
 
-        if (m_minor < pB->m_minor)
+        if (m_minor < b.m_minor)
         {
             return true;
         }
-        else if (m_minor > pB->m_minor)
+        else if (m_minor > b.m_minor)
         {
             return false;
         }
 
-        if (m_patch < pB->m_patch)
+        if (m_patch < b.m_patch)
         {
             return true;
         }
-        else if (m_patch > pB->m_patch)
+        else if (m_patch > b.m_patch)
         {
             return false;
         }
 
-        if (!m_preRelease.empty() && pB->m_preRelease.empty())
+        if (!m_preRelease.empty() && b.m_preRelease.empty())
         {
             return true;
         }
-        else if (!m_preRelease.empty() && !pB->m_preRelease.empty())
+        else if (!m_preRelease.empty() && !b.m_preRelease.empty())
         {
-            if (m_preRelease.compare(pB->m_preRelease) < 0)
+            if (m_preRelease.compare(b.m_preRelease) < 0)
             {
                 return true;
             }
@@ -165,6 +148,39 @@ public:
 
         return false;
     }
+
+    /**
+     * @brief Comparison operator ==.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to equality condition.
+     */
+    bool operator==(const IVersionObject& b) const override
+    {
+        const auto* pB = dynamic_cast<const VersionObjectSemVer*>(&b);
+        if (pB == nullptr)
+        {
+            throw std::runtime_error {"Error casting VersionObject type"};
+        }
+        return equals(*pB);
+    }
+
+    /**
+     * @brief Comparison operator <.
+     *
+     * @param b comparison rhs object.
+     * @return true/false according to less than condition.
+     */
+    bool operator<(const IVersionObject& b) const override
+    {
+        const auto* pB = dynamic_cast<const VersionObjectSemVer*>(&b);
+        if (pB == nullptr)
+        {
+            throw std::runtime_error {"Error casting VersionObject type"};
+        }
+
+        return lessThan(*pB);
+    }
 };
 
 #endif // _VERSION_OBJECT_SEMVER_HPP
@@ -370,3 +370,56 @@ TEST_F(ScanContextTest, HotfixesTest)
     nlohmann::json actual = scanContext->hotfixes();
     EXPECT_EQ(expected, actual);
 }
+
+// Test case for the shared agent scan cache
+TEST_F(ScanContextTest, SharedAgentCacheReusesOsCPE)
+{
+    const auto cpeMaps = R"(
+        {
+            "test-platform": "test:os:$(MAJOR_VERSION)"
+        }
+    )"_json;
+
+    auto agentCache = std::make_shared<AgentScanCache>();
+    ScanContext primeContext {ScannerType::Package, agentData, osData, packageData, hotfixesData, responseData,
+                              agentCache};
+
+    const std::string expected {"cpe:/o:test:os:1"};
+    EXPECT_EQ(primeContext.osCPEName(cpeMaps), expected);
+    ASSERT_TRUE(agentCache->osCPE.has_value());
+
+    // A second context of the batch reads the primed value, even with no maps to scan
+    ScanContext batchContext {ScannerType::Package, agentData, osData, packageData, hotfixesData, responseData,
+                              agentCache};
+    EXPECT_EQ(batchContext.osCPEName(nlohmann::json::object()), expected);
+}
+
+// Test case for rebinding a pooled context to a new event
+TEST_F(ScanContextTest, ResetRebindsContextToNewEvent)
+{
+    const auto newPackage = R"(
+        {
+            "name": "other-package",
+            "version": "2.0.0"
+        }
+    )"_json;
+
+    nlohmann::json newResponse;
+    scanContext->m_elements.emplace("CVE-0000-0000", nlohmann::json::object());
+    scanContext->m_matchConditions.emplace("CVE-0000-0000",
+                                           MatchCondition {"1.0.0", MatchRuleCondition::LessThan});
+
+    scanContext->reset(ScannerType::Package, agentData, osData, newPackage, hotfixesData, newResponse);
+
+    EXPECT_EQ(scanContext->scannerType(), ScannerType::Package);
+    EXPECT_EQ(scanContext->packageName(), "other-package");
+    EXPECT_EQ(scanContext->packageVersion(), "2.0.0");
+    EXPECT_TRUE(scanContext->m_elements.empty());
+    EXPECT_TRUE(scanContext->m_matchConditions.empty());
+
+    // The response accumulator is rebound too
+    auto finding = R"({"cve": "CVE-0000-0001"})"_json;
+    scanContext->moveResponseData(finding);
+    EXPECT_EQ(newResponse.size(), 1);
+    EXPECT_TRUE(responseData.empty());
+}
@@ -0,0 +1,142 @@
+/*
+ * Wazuh cmdLineParser
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _CMD_ARGS_PARSER_HPP_
+#define _CMD_ARGS_PARSER_HPP_
+
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Class to parse command line arguments.
+ */
+class CmdLineArgs
+{
+public:
+    /**
+     * @brief Constructor for CmdLineArgs.
+     * @param argc Number of arguments.
+     * @param argv Arguments.
+     */
+    explicit CmdLineArgs(const int argc, const char* argv[])
+        : m_logFilePath {paramValueOf(argc, argv, "-l", std::make_pair(false, "/dev/null"))}
+        , m_templatesFilePath {paramValueOf(argc, argv, "-i", std::make_pair(false, ""))}
+        , m_eventMix {paramValueOf(argc, argv, "-m", std::make_pair(false, "fullscan:20,packagelist:80"))}
+        , m_targetEps {std::stoul(paramValueOf(argc, argv, "-r", std::make_pair(false, "0")))}
+        , m_durationSeconds {std::stoul(paramValueOf(argc, argv, "-d", std::make_pair(false, "60")))}
+        , m_warmupSeconds {std::stoul(paramValueOf(argc, argv, "-w", std::make_pair(false, "5")))}
+        , m_threads {std::stoul(paramValueOf(argc, argv, "-t", std::make_pair(false, "1")))}
+    {
+    }
+
+    /**
+     * @brief Gets the log file path.
+     *
+     * @return Path to the log file.
+     */
+    const std::string& getLogFilePath() const { return m_logFilePath; }
+
+    /**
+     * @brief Gets the request templates file path.
+     *
+     * @return Path to the templates file, or an empty string to use the built-in templates.
+     */
+    const std::string& getTemplatesFilePath() const { return m_templatesFilePath; }
+
+    /**
+     * @brief Gets the event mix specification.
+     *
+     * @return Comma separated list of `type:weight` pairs.
+     */
+    const std::string& getEventMix() const { return m_eventMix; }
+
+    /**
+     * @brief Gets the target event rate.
+     *
+     * @return Target events per second, or 0 for an unthrottled run.
+     */
+    size_t getTargetEps() const { return m_targetEps; }
+
+    /**
+     * @brief Gets the measured run duration.
+     *
+     * @return Duration in seconds, excluding the warmup.
+     */
+    size_t getDurationSeconds() const { return m_durationSeconds; }
+
+    /**
+     * @brief Gets the warmup duration.
+     *
+     * @return Warmup in seconds, excluded from the report.
+     */
+    size_t getWarmupSeconds() const { return m_warmupSeconds; }
+
+    /**
+     * @brief Gets the number of load generator threads.
+     *
+     * @return Thread count.
+     */
+    size_t getThreads() const { return m_threads; }
+
+    /**
+     * @brief Shows the help to the user.
+     */
+    static void showHelp()
+    {
+        std::cout << "\nUsage: vdscanner_loadtester <option(s)>\n"
+                  << "Options:\n"
+                  << "\t-h \t\t\tShow this help message\n"
+                  << "\t-i TEMPLATES_FILE\tJSON file with request templates per event type.\n"
+                  << "\t-m EVENT_MIX\t\tEvent mix as type:weight pairs. Default: fullscan:20,packagelist:80\n"
+                  << "\t-r TARGET_EPS\t\tTarget events per second. 0 (default) runs unthrottled.\n"
+                  << "\t-d DURATION\t\tMeasured duration in seconds. Default: 60\n"
+                  << "\t-w WARMUP\t\tWarmup in seconds, excluded from the report. Default: 5\n"
+                  << "\t-t THREADS\t\tLoad generator threads. Default: 1\n"
+                  << "\t-l LOG_FILE\t\tSpecifies the log file to write. Default: /dev/null\n"
+                  << "\nExample:"
+                  << "\n\t./vdscanner_loadtester -r 500 -d 120 -w 10 -t 4 -m fullscan:10,packagelist:90\n"
+                  << std::endl;
+    }
+
+private:
+    static std::string paramValueOf(const int argc,
+                                    const char* argv[],
+                                    const std::string& switchValue,
+                                    const std::pair<bool, std::string>& required = std::make_pair(true, ""))
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string currentValue {argv[i]};
+
+            if (currentValue == switchValue && i + 1 < argc)
+            {
+                // Switch found
+                return argv[i + 1];
+            }
+        }
+
+        if (required.first)
+        {
+            throw std::runtime_error {"Switch value: " + switchValue + " not found."};
+        }
+
+        return required.second;
+    }
+
+    const std::string m_logFilePath;
+    const std::string m_templatesFilePath;
+    const std::string m_eventMix;
+    const size_t m_targetEps;
+    const size_t m_durationSeconds;
+    const size_t m_warmupSeconds;
+    const size_t m_threads;
+};
+
+#endif // _CMD_ARGS_PARSER_HPP_
@@ -0,0 +1,338 @@
+/*
+ * Wazuh Vulnerability scanner
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "base/logging.hpp"
+#include "vdscanner/scanOrchestrator.hpp"
+
+#include "argsParser.hpp"
+
+namespace
+{
+/**
+ * @brief A request template together with its weight in the generated event mix.
+ */
+struct EventTemplate final
+{
+    std::string type;    ///< Scan request type.
+    std::string request; ///< Serialized request payload.
+    size_t weight;       ///< Relative weight in the event mix.
+};
+
+/**
+ * @brief Per-thread latency samples, merged into the report after the run.
+ */
+struct WorkerStats final
+{
+    std::map<std::string, std::vector<uint64_t>> latenciesUs; ///< Latency samples in microseconds, per event type.
+    size_t errors {0};                                        ///< Requests that threw.
+};
+
+// Built-in request templates, used when no templates file is provided. The shapes mirror the scanner unit test
+// fixtures so the harness runs standalone against any feed content.
+const auto BUILTIN_TEMPLATES = R"({
+    "fullscan": {
+        "type": "fullscan",
+        "agent": {"id": "001", "ip": "192.168.0.1", "name": "load-agent", "version": "4.10.0"},
+        "os": {
+            "hostname": "load-host",
+            "architecture": "x86_64",
+            "name": "Ubuntu",
+            "version": "22.04",
+            "codename": "jammy",
+            "major_version": "22",
+            "minor_version": "04",
+            "patch": "0",
+            "build": "",
+            "platform": "ubuntu",
+            "kernel_name": "Linux",
+            "kernel_release": "5.15.0-86-generic",
+            "kernel_version": "5.15.0",
+            "release": "5.15.0-86-generic",
+            "display_version": "22.04.3 LTS"
+        },
+        "hotfixes": [],
+        "packages": [
+            {
+                "name": "openssl",
+                "version": "3.0.2-0ubuntu1.10",
+                "vendor": "Ubuntu",
+                "architecture": "amd64",
+                "format": "deb",
+                "item_id": "load-item-openssl"
+            },
+            {
+                "name": "curl",
+                "version": "7.81.0-1ubuntu1.13",
+                "vendor": "Ubuntu",
+                "architecture": "amd64",
+                "format": "deb",
+                "item_id": "load-item-curl"
+            }
+        ]
+    },
+    "packagelist": {
+        "type": "packagelist",
+        "agent": {"id": "001", "ip": "192.168.0.1", "name": "load-agent", "version": "4.10.0"},
+        "os": {
+            "hostname": "load-host",
+            "architecture": "x86_64",
+            "name": "Ubuntu",
+            "version": "22.04",
+            "codename": "jammy",
+            "major_version": "22",
+            "minor_version": "04",
+            "patch": "0",
+            "build": "",
+            "platform": "ubuntu",
+            "kernel_name": "Linux",
+            "kernel_release": "5.15.0-86-generic",
+            "kernel_version": "5.15.0",
+            "release": "5.15.0-86-generic",
+            "display_version": "22.04.3 LTS"
+        },
+        "hotfixes": [],
+        "packages": [
+            {
+                "name": "zlib1g",
+                "version": "1:1.2.11.dfsg-2ubuntu9.2",
+                "vendor": "Ubuntu",
+                "architecture": "amd64",
+                "format": "deb",
+                "item_id": "load-item-zlib"
+            }
+        ]
+    }
+})"_json;
+
+/**
+ * @brief Builds the weighted event templates from the mix specification and the templates source.
+ *
+ * @param eventMix Comma separated `type:weight` pairs.
+ * @param templates JSON object mapping each event type to its request template.
+ * @return std::vector<EventTemplate> Weighted templates.
+ */
+std::vector<EventTemplate> buildEventTemplates(const std::string& eventMix, const nlohmann::json& templates)
+{
+    std::vector<EventTemplate> eventTemplates;
+
+    size_t start {0};
+    while (start < eventMix.size())
+    {
+        auto end = eventMix.find(',', start);
+        if (end == std::string::npos)
+        {
+            end = eventMix.size();
+        }
+
+        const auto entry = eventMix.substr(start, end - start);
+        const auto separator = entry.find(':');
+        if (separator == std::string::npos)
+        {
+            throw std::runtime_error {"Invalid event mix entry: " + entry};
+        }
+
+        const auto type = entry.substr(0, separator);
+        const auto weight = std::stoul(entry.substr(separator + 1));
+
+        if (!templates.contains(type))
+        {
+            throw std::runtime_error {"No request template for event type: " + type};
+        }
+
+        if (weight > 0)
+        {
+            eventTemplates.push_back({type, templates.at(type).dump(), weight});
+        }
+
+        start = end + 1;
+    }
+
+    if (eventTemplates.empty())
+    {
+        throw std::runtime_error {"Event mix is empty: " + eventMix};
+    }
+
+    return eventTemplates;
+}
+
+/**
+ * @brief Prints count and percentiles for one event type.
+ *
+ * @param type Event type.
+ * @param latenciesUs Latency samples in microseconds. Sorted in place.
+ */
+void reportLatencies(const std::string& type, std::vector<uint64_t>& latenciesUs)
+{
+    if (latenciesUs.empty())
+    {
+        return;
+    }
+
+    std::sort(latenciesUs.begin(), latenciesUs.end());
+    const auto percentile = [&latenciesUs](const double p)
+    {
+        const auto index = std::min(latenciesUs.size() - 1, static_cast<size_t>(p * latenciesUs.size()));
+        return latenciesUs.at(index);
+    };
+
+    std::cout << "  " << type << ": " << latenciesUs.size() << " events"
+              << " | p50 " << percentile(0.50) << " us"
+              << " | p90 " << percentile(0.90) << " us"
+              << " | p99 " << percentile(0.99) << " us"
+              << " | max " << latenciesUs.back() << " us" << std::endl;
+}
+} // namespace
+
+int main(const int argc, const char* argv[])
+{
+    try
+    {
+        CmdLineArgs args(argc, argv);
+        logging::start({args.getLogFilePath(), logging::Level::Err});
+
+        auto templates = BUILTIN_TEMPLATES;
+        if (!args.getTemplatesFilePath().empty())
+        {
+            std::ifstream templatesFile(args.getTemplatesFilePath());
+            if (!templatesFile.is_open())
+            {
+                throw std::runtime_error {"Unable to open templates file: " + args.getTemplatesFilePath()};
+            }
+            templates = nlohmann::json::parse(templatesFile);
+        }
+
+        const auto eventTemplates = buildEventTemplates(args.getEventMix(), templates);
+        std::vector<size_t> weights;
+        weights.reserve(eventTemplates.size());
+        for (const auto& eventTemplate : eventTemplates)
+        {
+            weights.push_back(eventTemplate.weight);
+        }
+
+        vdscanner::ScanOrchestrator scanOrchestrator;
+
+        const auto threadCount = std::max<size_t>(args.getThreads(), 1);
+        const auto warmup = std::chrono::seconds(args.getWarmupSeconds());
+        const auto duration = std::chrono::seconds(args.getDurationSeconds());
+        const auto startTime = std::chrono::steady_clock::now();
+        const auto measureStart = startTime + warmup;
+        const auto stopTime = measureStart + duration;
+
+        // Spread the target rate evenly across the generator threads; 0 runs unthrottled.
+        const auto perThreadInterval = args.getTargetEps() > 0
+                                           ? std::chrono::nanoseconds(std::chrono::seconds(1)) * threadCount
+                                                 / args.getTargetEps()
+                                           : std::chrono::nanoseconds::zero();
+
+        std::cout << "Running load: " << args.getEventMix() << " | target "
+                  << (args.getTargetEps() > 0 ? std::to_string(args.getTargetEps()) + " EPS" : "unthrottled") << " | "
+                  << args.getWarmupSeconds() << "s warmup + " << args.getDurationSeconds() << "s measured | "
+                  << threadCount << " thread(s)" << std::endl;
+
+        std::vector<WorkerStats> workerStats(threadCount);
+        std::vector<std::thread> workers;
+        workers.reserve(threadCount);
+
+        for (size_t workerIndex = 0; workerIndex < threadCount; ++workerIndex)
+        {
+            workers.emplace_back(
+                [&, workerIndex]()
+                {
+                    auto& stats = workerStats.at(workerIndex);
+                    std::mt19937 generator {std::random_device {}() + static_cast<unsigned>(workerIndex)};
+                    std::discrete_distribution<size_t> pickTemplate(weights.begin(), weights.end());
+                    auto nextDeadline = std::chrono::steady_clock::now();
+
+                    while (std::chrono::steady_clock::now() < stopTime)
+                    {
+                        const auto& eventTemplate = eventTemplates.at(pickTemplate(generator));
+                        std::string response;
+
+                        const auto requestStart = std::chrono::steady_clock::now();
+                        try
+                        {
+                            scanOrchestrator.processEvent(eventTemplate.request, response);
+                        }
+                        catch (const std::exception&)
+                        {
+                            ++stats.errors;
+                            continue;
+                        }
+                        const auto requestEnd = std::chrono::steady_clock::now();
+
+                        if (requestStart >= measureStart)
+                        {
+                            stats.latenciesUs[eventTemplate.type].push_back(
+                                std::chrono::duration_cast<std::chrono::microseconds>(requestEnd - requestStart)
+                                    .count());
+                        }
+
+                        if (perThreadInterval != std::chrono::nanoseconds::zero())
+                        {
+                            nextDeadline += perThreadInterval;
+                            std::this_thread::sleep_until(nextDeadline);
+                        }
+                    }
+                });
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        // Merge the per-thread samples and report.
+        std::map<std::string, std::vector<uint64_t>> latenciesByType;
+        size_t errors {0};
+        size_t totalEvents {0};
+        for (auto& stats : workerStats)
+        {
+            errors += stats.errors;
+            for (auto& [type, samples] : stats.latenciesUs)
+            {
+                totalEvents += samples.size();
+                auto& merged = latenciesByType[type];
+                merged.insert(merged.end(), samples.begin(), samples.end());
+            }
+        }
+
+        const auto measuredSeconds = std::chrono::duration<double>(duration).count();
+        std::cout << "\nReport (" << std::fixed << std::setprecision(1) << measuredSeconds << "s measured):\n"
+                  << "  throughput: " << std::setprecision(1) << (totalEvents / measuredSeconds) << " events/s ("
+                  << totalEvents << " events, " << errors << " errors)" << std::endl;
+
+        for (auto& [type, samples] : latenciesByType)
+        {
+            reportLatencies(type, samples);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        CmdLineArgs::showHelp();
+        return 1;
+    }
+    return 0;
+}
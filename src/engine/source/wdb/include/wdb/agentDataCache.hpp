@@ -0,0 +1,100 @@
+#ifndef _WDB_AGENT_DATA_CACHE_HPP
+#define _WDB_AGENT_DATA_CACHE_HPP
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <base/lruCache.hpp>
+#include <wdb/iwdbManager.hpp>
+
+namespace wazuhdb
+{
+
+/**
+ * @brief TTL'd LRU cache of agent metadata in front of wazuh-db lookups.
+ *
+ * Decoders query the same agent metadata (name, IP, OS, labels) for every event from
+ * that agent, making it the highest-volume cross-process query. This cache turns the
+ * per-event lookup into a memory access: the first query for an agent goes to wazuh-db
+ * and the payload is kept until its TTL expires, it is evicted as least recently used,
+ * or it is explicitly invalidated because an agent-update message was received.
+ *
+ * @note Thread-safe, a single instance can be shared by concurrent workers.
+ */
+class AgentDataCache
+{
+public:
+    constexpr static std::size_t DEFAULT_CAPACITY = 4096;            ///< Default maximum cached agents
+    constexpr static std::chrono::seconds DEFAULT_TTL {60};          ///< Default entry time to live
+
+private:
+    /**
+     * @brief Cached payload with its expiration time.
+     */
+    struct Entry
+    {
+        std::string payload;                           ///< Agent metadata payload as returned by wazuh-db
+        std::chrono::steady_clock::time_point expiry;  ///< Instant after which the entry is stale
+    };
+
+    std::shared_ptr<IWDBManager> m_wdbManager; ///< Manager used to open the wazuh-db connection
+    std::chrono::seconds m_ttl;                ///< Entry time to live
+
+    std::shared_ptr<IWDBHandler> m_connection;  ///< Lazily opened wazuh-db connection
+    LRUCache<std::string, Entry> m_cache;       ///< Agent metadata keyed by agent id
+    std::mutex m_mutex;                         ///< Protects the cache and the connection
+
+    /**
+     * @brief Fetch the agent metadata from wazuh-db.
+     *
+     * @param agentId id of the agent.
+     * @return the payload or std::nullopt if the query failed.
+     */
+    std::optional<std::string> fetch(const std::string& agentId);
+
+public:
+    /**
+     * @brief Construct a new agent data cache.
+     *
+     * @param wdbManager manager used to open the wazuh-db connection.
+     * @param capacity maximum number of cached agents.
+     * @param ttl entry time to live.
+     *
+     * @throws std::runtime_error if the manager is null.
+     */
+    explicit AgentDataCache(std::shared_ptr<IWDBManager> wdbManager,
+                            std::size_t capacity = DEFAULT_CAPACITY,
+                            std::chrono::seconds ttl = DEFAULT_TTL);
+
+    /**
+     * @brief Get the metadata payload for an agent.
+     *
+     * Served from the cache when a fresh entry exists, otherwise fetched from wazuh-db
+     * and cached.
+     *
+     * @param agentId id of the agent.
+     * @return the payload or std::nullopt if the agent is unknown or the query failed.
+     */
+    std::optional<std::string> getAgentData(const std::string& agentId);
+
+    /**
+     * @brief Invalidate the cached metadata of an agent.
+     *
+     * Hook for agent-update messages, the next lookup for the agent goes to wazuh-db.
+     *
+     * @param agentId id of the agent.
+     */
+    void invalidate(const std::string& agentId);
+
+    /**
+     * @brief Invalidate the whole cache.
+     */
+    void clear();
+};
+
+} // namespace wazuhdb
+
+#endif // _WDB_AGENT_DATA_CACHE_HPP
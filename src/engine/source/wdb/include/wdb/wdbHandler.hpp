@@ -6,6 +6,7 @@
 #include <map>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <sockiface/isockHandler.hpp>
 #include <wdb/iwdbHandler.hpp>
@@ -105,6 +106,33 @@ public:
     std::tuple<QueryResultCodes, std::optional<std::string>>
     tryQueryAndParseResult(const std::string& query, const unsigned int attempts) noexcept override;
 
+    /**
+     * @brief Perform a batch of independent queries in a single pipelined exchange
+     *
+     * @param queries Queries to perform
+     * @return std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>> One
+     * parsed result per query, in order. Empty or too long queries map to an UNKNOWN
+     * result without being sent.
+     *
+     * @throw socketinterface::RecoverableError if cannot perform the exchange because
+     * the remote socket is closed (EPIPE, ECONNRESET or gracefully closed).
+     * @throw std::runtime_error if cannot perform the exchange because of other reasons.
+     */
+    std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>>
+    queryAndParseResultPipelined(const std::vector<std::string>& queries) override;
+
+    /**
+     * @brief Try perform a batch of independent queries in a single pipelined exchange
+     * `attempts` times
+     *
+     * @param queries Queries to perform
+     * @param attempts Number of attempts to perform the exchange
+     * @return std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>> One
+     * parsed result per query, in order. UNKNOWN results if the exchange failed.
+     */
+    std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>>
+    tryQueryAndParseResultPipelined(const std::vector<std::string>& queries, uint attempts) noexcept override;
+
     size_t getQueryMaxSize() const noexcept override { return this->m_socket->getMaxMsgSize(); };
 };
 } // namespace wazuhdb
@@ -4,6 +4,7 @@
 #include <optional>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace wazuhdb
 {
@@ -141,6 +142,53 @@ public:
         return tryQueryAndParseResult(query, DEFAULT_TRY_ATTEMPTS);
     }
 
+    /**
+     * @brief Perform a batch of independent queries in a single pipelined exchange
+     *
+     * All the queries are written to the wdb socket before reading any response, so the
+     * batch costs one socket round trip instead of one per query. The responses are
+     * returned in the same order as the queries.
+     *
+     * @param queries Queries to perform
+     * @return std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>> One
+     * parsed result per query, in order. Empty or too long queries map to an UNKNOWN
+     * result without being sent.
+     *
+     * @throw socketinterface::RecoverableError if cannot perform the exchange because
+     * the remote socket is closed (EPIPE, ECONNRESET or gracefully closed).
+     * @throw std::runtime_error if cannot perform the exchange because of other reasons.
+     */
+    virtual std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>>
+    queryAndParseResultPipelined(const std::vector<std::string>& queries) = 0;
+
+    /**
+     * @brief Try perform a batch of independent queries in a single pipelined exchange
+     * `attempts` times
+     *
+     * @warning On a recoverable socket error the whole batch is replayed after
+     * reconnecting, so the queries must tolerate being executed more than once.
+     *
+     * @param queries Queries to perform
+     * @param attempts Number of attempts to perform the exchange
+     * @return std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>> One
+     * parsed result per query, in order. UNKNOWN results if the exchange failed.
+     */
+    virtual std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>>
+    tryQueryAndParseResultPipelined(const std::vector<std::string>& queries, uint attempts) noexcept = 0;
+
+    /**
+     * @brief Try perform a batch of independent queries in a single pipelined exchange
+     *
+     * @param queries Queries to perform
+     * @return std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>> One
+     * parsed result per query, in order. UNKNOWN results if the exchange failed.
+     */
+    std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>>
+    tryQueryAndParseResultPipelined(const std::vector<std::string>& queries) noexcept
+    {
+        return tryQueryAndParseResultPipelined(queries, DEFAULT_TRY_ATTEMPTS);
+    }
+
     virtual size_t getQueryMaxSize() const noexcept = 0;
 };
 } // namespace wazuhdb
@@ -0,0 +1,79 @@
+#include "agentDataCache.hpp"
+
+#include <base/logging.hpp>
+
+namespace wazuhdb
+{
+
+AgentDataCache::AgentDataCache(std::shared_ptr<IWDBManager> wdbManager,
+                               std::size_t capacity,
+                               std::chrono::seconds ttl)
+    : m_wdbManager {std::move(wdbManager)}
+    , m_ttl {ttl}
+    , m_cache {capacity}
+{
+    if (!m_wdbManager)
+    {
+        throw std::runtime_error("Engine WDB: Agent data cache needs a non-null WDB manager");
+    }
+}
+
+std::optional<std::string> AgentDataCache::fetch(const std::string& agentId)
+{
+    if (!m_connection)
+    {
+        m_connection = m_wdbManager->connection();
+    }
+
+    const auto query {fmt::format("global get-agent-info {}", agentId)};
+    const auto [code, payload] = m_connection->tryQueryAndParseResult(query, DEFAULT_TRY_ATTEMPTS);
+
+    if (QueryResultCodes::OK != code)
+    {
+        LOG_DEBUG("Engine WDB: Agent data lookup for agent '{}' failed (Result code is '{}').",
+                  agentId,
+                  qrcToStr(code));
+        return std::nullopt;
+    }
+
+    return payload.value_or("");
+}
+
+std::optional<std::string> AgentDataCache::getAgentData(const std::string& agentId)
+{
+    std::lock_guard lock {m_mutex};
+
+    auto entry = m_cache.getValue(agentId);
+    if (entry.has_value() && std::chrono::steady_clock::now() < entry->expiry)
+    {
+        return entry->payload;
+    }
+
+    auto payload = fetch(agentId);
+    if (payload.has_value())
+    {
+        m_cache.insertKey(agentId, Entry {payload.value(), std::chrono::steady_clock::now() + m_ttl});
+    }
+
+    return payload;
+}
+
+void AgentDataCache::invalidate(const std::string& agentId)
+{
+    std::lock_guard lock {m_mutex};
+
+    // The cache cannot drop a single key, overwrite it with an already expired entry so
+    // the next lookup goes to wazuh-db
+    if (m_cache.isHit(agentId))
+    {
+        m_cache.insertKey(agentId, Entry {{}, std::chrono::steady_clock::time_point {}});
+    }
+}
+
+void AgentDataCache::clear()
+{
+    std::lock_guard lock {m_mutex};
+    m_cache.clear();
+}
+
+} // namespace wazuhdb
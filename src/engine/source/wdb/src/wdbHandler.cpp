@@ -154,4 +154,116 @@ WDBHandler::tryQueryAndParseResult(const std::string& q, const uint attempts) no
     return parseResult(result);
 }
 
+std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>>
+WDBHandler::queryAndParseResultPipelined(const std::vector<std::string>& queries)
+{
+    std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>> results {};
+    results.resize(queries.size(), parseResult({}));
+
+    // Indexes of the queries actually written to the socket, responses arrive in the
+    // same order they were sent.
+    std::vector<std::size_t> sentIndexes {};
+    sentIndexes.reserve(queries.size());
+
+    const auto maxMsgSize = m_socket->getMaxMsgSize();
+    for (std::size_t i = 0; i < queries.size(); i++)
+    {
+        const auto& query = queries[i];
+        if (0 == query.length())
+        {
+            LOG_WARNING("Engine WDB: The query to send is empty.");
+            continue;
+        }
+        else if (query.length() > maxMsgSize)
+        {
+            LOG_WARNING(
+                "Engine WDB: The query to send is too long: {} characters (Maximum allowed size is {} characters).",
+                query.length(),
+                maxMsgSize);
+            continue;
+        }
+
+        // Send the query (connect if not connected), throw runtime_error if cannot send
+        const auto sendStatus {m_socket->sendMsg(query)};
+        if (SendRetval::SUCCESS == sendStatus)
+        {
+            sentIndexes.push_back(i);
+        }
+        else if (SendRetval::SOCKET_ERROR == sendStatus)
+        {
+            const auto msgError {fmt::format("Engine WDB: sendMsg() method failed: {} ({})", strerror(errno), errno)};
+            throw std::runtime_error(msgError);
+        }
+        else
+        {
+            // SIZE_ZERO, SIZE_TOO_LONG never reach here
+            const auto logicErrorStr {fmt::format(
+                "Engine WDB: sendMsg() method reached a condition that should never happen (Query status = {})",
+                sendStatus == SendRetval::SIZE_ZERO ? 1 : 2)};
+            throw std::logic_error(logicErrorStr);
+        }
+    }
+
+    // Receive the results in order, throw runtime_error if cannot receive
+    for (const auto index : sentIndexes)
+    {
+        results[index] = parseResult(m_socket->recvString());
+    }
+
+    return results;
+}
+
+std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>>
+WDBHandler::tryQueryAndParseResultPipelined(const std::vector<std::string>& queries, const uint attempts) noexcept
+{
+    std::optional<std::string> disconnectError {};
+
+    for (unsigned int i {0}; i < attempts; i++)
+    {
+        try
+        {
+            return queryAndParseResultPipelined(queries);
+        }
+        catch (const RecoverableError& e)
+        {
+            // The whole batch is replayed after reconnecting, part of it may have
+            // already been processed by the remote end.
+            LOG_DEBUG("Engine WDB: Pipelined exchange failed (attempt {}): {}.", i, e.what());
+            disconnectError = e.what();
+            try
+            {
+                this->m_socket->socketConnect();
+            }
+            catch (const std::runtime_error& e)
+            {
+                LOG_ERROR("Engine WDB: Reconnect attempt {} failed: {}.", i + 1, e.what());
+                continue;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Engine WDB: WDBHandler::tryQueryAndParseResultPipelined() method failed in an irrecuperable "
+                        "way: {}.",
+                        e.what());
+            this->m_socket->socketDisconnect();
+            break;
+        }
+        catch (...)
+        {
+            LOG_WARNING("Engine WDB: WDBHandler::tryQueryAndParseResultPipelined() method failed in an irrecuperable "
+                        "way: unknown error.");
+            this->m_socket->socketDisconnect();
+            break;
+        }
+    }
+
+    if (disconnectError.has_value())
+    {
+        LOG_WARNING("Engine WDB: WDBHandler::tryQueryAndParseResultPipelined() method failed: {}.",
+                    disconnectError.value());
+    }
+
+    return std::vector<std::tuple<QueryResultCodes, std::optional<std::string>>>(queries.size(), parseResult({}));
+}
+
 } // namespace wazuhdb
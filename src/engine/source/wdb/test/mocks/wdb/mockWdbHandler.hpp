@@ -53,6 +53,14 @@ public:
                 tryQueryAndParseResult,
                 (const std::string& query, uint32_t attempts),
                 (noexcept, override));
+    MOCK_METHOD((std::vector<std::tuple<wazuhdb::QueryResultCodes, std::optional<std::string>>>),
+                queryAndParseResultPipelined,
+                (const std::vector<std::string>& queries),
+                (override));
+    MOCK_METHOD((std::vector<std::tuple<wazuhdb::QueryResultCodes, std::optional<std::string>>>),
+                tryQueryAndParseResultPipelined,
+                (const std::vector<std::string>& queries, uint32_t attempts),
+                (noexcept, override));
     MOCK_METHOD(size_t, getQueryMaxSize, (), (const, noexcept, override));
 };
 } // namespace wazuhdb::mocks
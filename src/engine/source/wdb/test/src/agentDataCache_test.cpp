@@ -0,0 +1,114 @@
+#include <wdb/agentDataCache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <base/logging.hpp>
+#include <wdb/mockWdbHandler.hpp>
+#include <wdb/mockWdbManager.hpp>
+
+using namespace wazuhdb;
+using namespace wazuhdb::mocks;
+
+using ::testing::Return;
+
+constexpr const char* TEST_AGENT_ID {"001"};
+constexpr const char* TEST_AGENT_QUERY {"global get-agent-info 001"};
+constexpr const char* TEST_AGENT_PAYLOAD {R"([{"id":1,"name":"agent1","ip":"any"}])"};
+
+class AgentDataCacheTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<MockWdbManager> m_manager;
+    std::shared_ptr<MockWdbHandler> m_handler;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        m_manager = std::make_shared<MockWdbManager>();
+        m_handler = std::make_shared<MockWdbHandler>();
+    }
+};
+
+TEST_F(AgentDataCacheTest, NullManagerThrows)
+{
+    ASSERT_THROW(AgentDataCache(nullptr), std::runtime_error);
+}
+
+TEST_F(AgentDataCacheTest, FirstLookupQueriesThenServesFromCache)
+{
+    AgentDataCache cache {m_manager};
+
+    EXPECT_CALL(*m_manager, connection()).WillOnce(Return(m_handler));
+    EXPECT_CALL(*m_handler, tryQueryAndParseResult(TEST_AGENT_QUERY, DEFAULT_TRY_ATTEMPTS))
+        .WillOnce(Return(okQueryRes(TEST_AGENT_PAYLOAD)));
+
+    auto first = cache.getAgentData(TEST_AGENT_ID);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_EQ(first.value(), TEST_AGENT_PAYLOAD);
+
+    // Second lookup is a memory hit, no additional query is expected
+    auto second = cache.getAgentData(TEST_AGENT_ID);
+    ASSERT_TRUE(second.has_value());
+    ASSERT_EQ(second.value(), TEST_AGENT_PAYLOAD);
+}
+
+TEST_F(AgentDataCacheTest, FailedLookupIsNotCached)
+{
+    AgentDataCache cache {m_manager};
+
+    EXPECT_CALL(*m_manager, connection()).WillOnce(Return(m_handler));
+    EXPECT_CALL(*m_handler, tryQueryAndParseResult(TEST_AGENT_QUERY, DEFAULT_TRY_ATTEMPTS))
+        .WillOnce(Return(errorQueryRes("agent not found")))
+        .WillOnce(Return(okQueryRes(TEST_AGENT_PAYLOAD)));
+
+    ASSERT_FALSE(cache.getAgentData(TEST_AGENT_ID).has_value());
+
+    // The failure was not cached, the next lookup queries wazuh-db again
+    auto retried = cache.getAgentData(TEST_AGENT_ID);
+    ASSERT_TRUE(retried.has_value());
+    ASSERT_EQ(retried.value(), TEST_AGENT_PAYLOAD);
+}
+
+TEST_F(AgentDataCacheTest, InvalidateForcesRefetch)
+{
+    AgentDataCache cache {m_manager};
+
+    EXPECT_CALL(*m_manager, connection()).WillOnce(Return(m_handler));
+    EXPECT_CALL(*m_handler, tryQueryAndParseResult(TEST_AGENT_QUERY, DEFAULT_TRY_ATTEMPTS))
+        .WillOnce(Return(okQueryRes(TEST_AGENT_PAYLOAD)))
+        .WillOnce(Return(okQueryRes(R"([{"id":1,"name":"renamed"}])")));
+
+    ASSERT_EQ(cache.getAgentData(TEST_AGENT_ID).value(), TEST_AGENT_PAYLOAD);
+
+    cache.invalidate(TEST_AGENT_ID);
+
+    ASSERT_EQ(cache.getAgentData(TEST_AGENT_ID).value(), R"([{"id":1,"name":"renamed"}])");
+}
+
+TEST_F(AgentDataCacheTest, ClearForcesRefetch)
+{
+    AgentDataCache cache {m_manager};
+
+    EXPECT_CALL(*m_manager, connection()).WillOnce(Return(m_handler));
+    EXPECT_CALL(*m_handler, tryQueryAndParseResult(TEST_AGENT_QUERY, DEFAULT_TRY_ATTEMPTS))
+        .Times(2)
+        .WillRepeatedly(Return(okQueryRes(TEST_AGENT_PAYLOAD)));
+
+    ASSERT_TRUE(cache.getAgentData(TEST_AGENT_ID).has_value());
+    cache.clear();
+    ASSERT_TRUE(cache.getAgentData(TEST_AGENT_ID).has_value());
+}
+
+TEST_F(AgentDataCacheTest, ExpiredEntryIsRefetched)
+{
+    AgentDataCache cache {m_manager, AgentDataCache::DEFAULT_CAPACITY, std::chrono::seconds {0}};
+
+    EXPECT_CALL(*m_manager, connection()).WillOnce(Return(m_handler));
+    EXPECT_CALL(*m_handler, tryQueryAndParseResult(TEST_AGENT_QUERY, DEFAULT_TRY_ATTEMPTS))
+        .Times(2)
+        .WillRepeatedly(Return(okQueryRes(TEST_AGENT_PAYLOAD)));
+
+    // With a zero TTL every entry is stale as soon as it is stored
+    ASSERT_TRUE(cache.getAgentData(TEST_AGENT_ID).has_value());
+    ASSERT_TRUE(cache.getAgentData(TEST_AGENT_ID).has_value());
+}
@@ -318,3 +318,76 @@ TEST_F(wdb_tryQueryAndParseResult, SendQueryIrrecoverable)
     ASSERT_EQ(std::get<0>(retval), QueryResultCodes::UNKNOWN);
     ASSERT_FALSE(std::get<1>(retval));
 }
+
+TEST_F(wdb_tryQueryAndParseResult, PipelinedSendAllBeforeRecvAll)
+{
+    auto [wdb, MockSockHandler] = getWDBHandler();
+    EXPECT_CALL(*MockSockHandler, getMaxMsgSize()).WillRepeatedly(testing::Return(1024));
+
+    // Both queries must be written before any response is read
+    testing::InSequence seq;
+    EXPECT_CALL(*MockSockHandler, sendMsg(testing::StrEq("query 1"))).WillOnce(testing::Return(successSendMsgRes()));
+    EXPECT_CALL(*MockSockHandler, sendMsg(testing::StrEq("query 2"))).WillOnce(testing::Return(successSendMsgRes()));
+    EXPECT_CALL(*MockSockHandler, recvMsg()).WillOnce(testing::Return(recvMsgRes("ok")));
+    EXPECT_CALL(*MockSockHandler, recvMsg()).WillOnce(testing::Return(recvMsgRes("ok payload")));
+
+    auto retval {wdb->tryQueryAndParseResultPipelined({"query 1", "query 2"}, 1)};
+
+    ASSERT_EQ(retval.size(), 2);
+    ASSERT_EQ(std::get<0>(retval[0]), QueryResultCodes::OK);
+    ASSERT_FALSE(std::get<1>(retval[0]));
+    ASSERT_EQ(std::get<0>(retval[1]), QueryResultCodes::OK);
+    ASSERT_STREQ(std::get<1>(retval[1]).value().c_str(), "payload");
+}
+
+TEST_F(wdb_tryQueryAndParseResult, PipelinedSkipsEmptyQuery)
+{
+    auto [wdb, MockSockHandler] = getWDBHandler();
+    EXPECT_CALL(*MockSockHandler, getMaxMsgSize()).WillRepeatedly(testing::Return(1024));
+    EXPECT_CALL(*MockSockHandler, sendMsg(testing::StrEq(TEST_MESSAGE))).WillOnce(testing::Return(successSendMsgRes()));
+    EXPECT_CALL(*MockSockHandler, recvMsg()).WillOnce(testing::Return(recvMsgRes("ok")));
+
+    auto retval {wdb->tryQueryAndParseResultPipelined({"", TEST_MESSAGE}, 1)};
+
+    ASSERT_EQ(retval.size(), 2);
+    ASSERT_EQ(std::get<0>(retval[0]), QueryResultCodes::UNKNOWN);
+    ASSERT_EQ(std::get<0>(retval[1]), QueryResultCodes::OK);
+}
+
+TEST_F(wdb_tryQueryAndParseResult, PipelinedSkipsTooLongQueryKeepsPairing)
+{
+    auto [wdb, MockSockHandler] = getWDBHandler();
+    EXPECT_CALL(*MockSockHandler, getMaxMsgSize()).WillRepeatedly(testing::Return(4));
+
+    // The oversized query in the middle is skipped; the responses must still be paired
+    // with the queries that were actually sent
+    testing::InSequence seq;
+    EXPECT_CALL(*MockSockHandler, sendMsg(testing::StrEq("one"))).WillOnce(testing::Return(successSendMsgRes()));
+    EXPECT_CALL(*MockSockHandler, sendMsg(testing::StrEq("two"))).WillOnce(testing::Return(successSendMsgRes()));
+    EXPECT_CALL(*MockSockHandler, recvMsg()).WillOnce(testing::Return(recvMsgRes("ok first")));
+    EXPECT_CALL(*MockSockHandler, recvMsg()).WillOnce(testing::Return(recvMsgRes("ok second")));
+
+    auto retval {wdb->tryQueryAndParseResultPipelined({"one", "too long query", "two"}, 1)};
+
+    ASSERT_EQ(retval.size(), 3);
+    ASSERT_EQ(std::get<0>(retval[0]), QueryResultCodes::OK);
+    ASSERT_STREQ(std::get<1>(retval[0]).value().c_str(), "first");
+    ASSERT_EQ(std::get<0>(retval[1]), QueryResultCodes::UNKNOWN);
+    ASSERT_EQ(std::get<0>(retval[2]), QueryResultCodes::OK);
+    ASSERT_STREQ(std::get<1>(retval[2]).value().c_str(), "second");
+}
+
+TEST_F(wdb_tryQueryAndParseResult, PipelinedIrrecoverable)
+{
+    auto [wdb, MockSockHandler] = getWDBHandler();
+    EXPECT_CALL(*MockSockHandler, getMaxMsgSize()).WillRepeatedly(testing::Return(1024));
+    EXPECT_CALL(*MockSockHandler, sendMsg(testing::_)).WillOnce(testing::Throw(std::runtime_error("test error")));
+    EXPECT_CALL(*MockSockHandler, socketDisconnect()).Times(1);
+
+    // One UNKNOWN result per query on error
+    auto retval {wdb->tryQueryAndParseResultPipelined({"query 1", "query 2"}, 2)};
+
+    ASSERT_EQ(retval.size(), 2);
+    ASSERT_EQ(std::get<0>(retval[0]), QueryResultCodes::UNKNOWN);
+    ASSERT_EQ(std::get<0>(retval[1]), QueryResultCodes::UNKNOWN);
+}
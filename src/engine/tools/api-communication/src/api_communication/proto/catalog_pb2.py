@@ -14,7 +14,7 @@ _sym_db = _symbol_database.Default()
 import api_communication.proto.engine_pb2 as _engine_pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rcatalog.proto\x12\x1c\x63om.wazuh.api.engine.catalog\x1a\x0c\x65ngine.proto\"\xf8\x01\n\x14ResourcePost_Request\x12=\n\x04type\x18\x01 \x01(\x0e\x32*.com.wazuh.api.engine.catalog.ResourceTypeH\x00\x88\x01\x01\x12\x41\n\x06\x66ormat\x18\x02 \x01(\x0e\x32,.com.wazuh.api.engine.catalog.ResourceFormatH\x01\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x03 \x01(\tH\x02\x88\x01\x01\x12\x18\n\x0bnamespaceid\x18\x04 \x01(\tH\x03\x88\x01\x01\x42\x07\n\x05_typeB\t\n\x07_formatB\n\n\x08_contentB\x0e\n\x0c_namespaceid\"\xa9\x01\n\x13ResourceGet_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x41\n\x06\x66ormat\x18\x02 \x01(\x0e\x32,.com.wazuh.api.engine.catalog.ResourceFormatH\x01\x88\x01\x01\x12\x18\n\x0bnamespaceid\x18\x03 \x01(\tH\x02\x88\x01\x01\x42\x07\n\x05_nameB\t\n\x07_formatB\x0e\n\x0c_namespaceid\"\x8a\x01\n\x14ResourceGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x03 \x01(\tH\x01\x88\x01\x01\x42\x08\n\x06_errorB\n\n\x08_content\"\xcb\x01\n\x13ResourcePut_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x41\n\x06\x66ormat\x18\x02 \x01(\x0e\x32,.com.wazuh.api.engine.catalog.ResourceFormatH\x01\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x03 \x01(\tH\x02\x88\x01\x01\x12\x18\n\x0bnamespaceid\x18\x04 \x01(\tH\x03\x88\x01\x01\x42\x07\n\x05_nameB\t\n\x07_formatB\n\n\x08_contentB\x0e\n\x0c_namespaceid\"^\n\x16ResourceDelete_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x18\n\x0bnamespaceid\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x07\n\x05_nameB\x0e\n\x0c_namespaceid\"\xd0\x01\n\x18ResourceValidate_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x41\n\x06\x66ormat\x18\x02 \x01(\x0e\x32,.com.wazuh.api.engine.catalog.ResourceFormatH\x01\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x03 \x01(\tH\x02\x88\x01\x01\x12\x18\n\x0bnamespaceid\x18\x04 \x01(\tH\x03\x88\x01\x01\x42\x07\n\x05_nameB\t\n\x07_formatB\n\n\x08_contentB\x0e\n\x0c_namespaceid\"\x17\n\x15NamespacesGet_Request\"~\n\x16NamespacesGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x12\n\nnamespaces\x18\x03 \x03(\tB\x08\n\x06_error*1\n\x0eResourceFormat\x12\x08\n\x04json\x10\x00\x12\x08\n\x04yaml\x10\x01\x12\x07\n\x03yml\x10\x01\x1a\x02\x10\x01*w\n\x0cResourceType\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x0b\n\x07\x64\x65\x63oder\x10\x01\x12\x08\n\x04rule\x10\x02\x12\n\n\x06\x66ilter\x10\x03\x12\n\n\x06output\x10\x04\x12\n\n\x06schema\x10\x05\x12\x0e\n\ncollection\x10\x06\x12\x0f\n\x0bintegration\x10\x07\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rcatalog.proto\x12\x1c\x63om.wazuh.api.engine.catalog\x1a\x0c\x65ngine.proto\"\xf8\x01\n\x14ResourcePost_Request\x12=\n\x04type\x18\x01 \x01(\x0e\x32*.com.wazuh.api.engine.catalog.ResourceTypeH\x00\x88\x01\x01\x12\x41\n\x06\x66ormat\x18\x02 \x01(\x0e\x32,.com.wazuh.api.engine.catalog.ResourceFormatH\x01\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x03 \x01(\tH\x02\x88\x01\x01\x12\x18\n\x0bnamespaceid\x18\x04 \x01(\tH\x03\x88\x01\x01\x42\x07\n\x05_typeB\t\n\x07_formatB\n\n\x08_contentB\x0e\n\x0c_namespaceid\"\xd3\x02\n\x18ResourceBulkPost_Request\x12\x41\n\x06\x66ormat\x18\x01 \x01(\x0e\x32,.com.wazuh.api.engine.catalog.ResourceFormatH\x00\x88\x01\x01\x12\x18\n\x0bnamespaceid\x18\x02 \x01(\tH\x01\x88\x01\x01\x12L\n\x06\x61ssets\x18\x03 \x03(\x0b\x32<.com.wazuh.api.engine.catalog.ResourceBulkPost_Request.Asset\x1aq\n\x05\x41sset\x12=\n\x04type\x18\x01 \x01(\x0e\x32*.com.wazuh.api.engine.catalog.ResourceTypeH\x00\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x07\n\x05_typeB\n\n\x08_contentB\t\n\x07_formatB\x0e\n\x0c_namespaceid\"\xa9\x01\n\x13ResourceGet_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x41\n\x06\x66ormat\x18\x02 \x01(\x0e\x32,.com.wazuh.api.engine.catalog.ResourceFormatH\x01\x88\x01\x01\x12\x18\n\x0bnamespaceid\x18\x03 \x01(\tH\x02\x88\x01\x01\x42\x07\n\x05_nameB\t\n\x07_formatB\x0e\n\x0c_namespaceid\"\x8a\x01\n\x14ResourceGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x03 \x01(\tH\x01\x88\x01\x01\x42\x08\n\x06_errorB\n\n\x08_content\"\xcb\x01\n\x13ResourcePut_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x41\n\x06\x66ormat\x18\x02 \x01(\x0e\x32,.com.wazuh.api.engine.catalog.ResourceFormatH\x01\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x03 \x01(\tH\x02\x88\x01\x01\x12\x18\n\x0bnamespaceid\x18\x04 \x01(\tH\x03\x88\x01\x01\x42\x07\n\x05_nameB\t\n\x07_formatB\n\n\x08_contentB\x0e\n\x0c_namespaceid\"^\n\x16ResourceDelete_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x18\n\x0bnamespaceid\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x07\n\x05_nameB\x0e\n\x0c_namespaceid\"\xd0\x01\n\x18ResourceValidate_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x41\n\x06\x66ormat\x18\x02 \x01(\x0e\x32,.com.wazuh.api.engine.catalog.ResourceFormatH\x01\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x03 \x01(\tH\x02\x88\x01\x01\x12\x18\n\x0bnamespaceid\x18\x04 \x01(\tH\x03\x88\x01\x01\x42\x07\n\x05_nameB\t\n\x07_formatB\n\n\x08_contentB\x0e\n\x0c_namespaceid\"\x17\n\x15NamespacesGet_Request\"~\n\x16NamespacesGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x12\n\nnamespaces\x18\x03 \x03(\tB\x08\n\x06_error*1\n\x0eResourceFormat\x12\x08\n\x04json\x10\x00\x12\x08\n\x04yaml\x10\x01\x12\x07\n\x03yml\x10\x01\x1a\x02\x10\x01*w\n\x0cResourceType\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x0b\n\x07\x64\x65\x63oder\x10\x01\x12\x08\n\x04rule\x10\x02\x12\n\n\x06\x66ilter\x10\x03\x12\n\n\x06output\x10\x04\x12\n\n\x06schema\x10\x05\x12\x0e\n\ncollection\x10\x06\x12\x0f\n\x0bintegration\x10\x07\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'catalog_pb2', globals())
@@ -23,24 +23,28 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   DESCRIPTOR._options = None
   _RESOURCEFORMAT._options = None
   _RESOURCEFORMAT._serialized_options = b'\020\001'
-  _RESOURCEFORMAT._serialized_start=1291
-  _RESOURCEFORMAT._serialized_end=1340
-  _RESOURCETYPE._serialized_start=1342
-  _RESOURCETYPE._serialized_end=1461
+  _RESOURCEFORMAT._serialized_start=1633
+  _RESOURCEFORMAT._serialized_end=1682
+  _RESOURCETYPE._serialized_start=1684
+  _RESOURCETYPE._serialized_end=1803
   _RESOURCEPOST_REQUEST._serialized_start=62
   _RESOURCEPOST_REQUEST._serialized_end=310
-  _RESOURCEGET_REQUEST._serialized_start=313
-  _RESOURCEGET_REQUEST._serialized_end=482
-  _RESOURCEGET_RESPONSE._serialized_start=485
-  _RESOURCEGET_RESPONSE._serialized_end=623
-  _RESOURCEPUT_REQUEST._serialized_start=626
-  _RESOURCEPUT_REQUEST._serialized_end=829
-  _RESOURCEDELETE_REQUEST._serialized_start=831
-  _RESOURCEDELETE_REQUEST._serialized_end=925
-  _RESOURCEVALIDATE_REQUEST._serialized_start=928
-  _RESOURCEVALIDATE_REQUEST._serialized_end=1136
-  _NAMESPACESGET_REQUEST._serialized_start=1138
-  _NAMESPACESGET_REQUEST._serialized_end=1161
-  _NAMESPACESGET_RESPONSE._serialized_start=1163
-  _NAMESPACESGET_RESPONSE._serialized_end=1289
+  _RESOURCEBULKPOST_REQUEST._serialized_start=313
+  _RESOURCEBULKPOST_REQUEST._serialized_end=652
+  _RESOURCEBULKPOST_REQUEST_ASSET._serialized_start=512
+  _RESOURCEBULKPOST_REQUEST_ASSET._serialized_end=625
+  _RESOURCEGET_REQUEST._serialized_start=655
+  _RESOURCEGET_REQUEST._serialized_end=824
+  _RESOURCEGET_RESPONSE._serialized_start=827
+  _RESOURCEGET_RESPONSE._serialized_end=965
+  _RESOURCEPUT_REQUEST._serialized_start=968
+  _RESOURCEPUT_REQUEST._serialized_end=1171
+  _RESOURCEDELETE_REQUEST._serialized_start=1173
+  _RESOURCEDELETE_REQUEST._serialized_end=1267
+  _RESOURCEVALIDATE_REQUEST._serialized_start=1270
+  _RESOURCEVALIDATE_REQUEST._serialized_end=1478
+  _NAMESPACESGET_REQUEST._serialized_start=1480
+  _NAMESPACESGET_REQUEST._serialized_end=1503
+  _NAMESPACESGET_RESPONSE._serialized_start=1505
+  _NAMESPACESGET_RESPONSE._serialized_end=1631
 # @@protoc_insertion_point(module_scope)
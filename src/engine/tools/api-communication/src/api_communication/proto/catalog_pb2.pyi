@@ -3,7 +3,7 @@ from google.protobuf.internal import containers as _containers
 from google.protobuf.internal import enum_type_wrapper as _enum_type_wrapper
 from google.protobuf import descriptor as _descriptor
 from google.protobuf import message as _message
-from typing import ClassVar as _ClassVar, Iterable as _Iterable, Optional as _Optional, Union as _Union
+from typing import ClassVar as _ClassVar, Iterable as _Iterable, Mapping as _Mapping, Optional as _Optional, Union as _Union
 
 DESCRIPTOR: _descriptor.FileDescriptor
 UNKNOWN: ResourceType
@@ -32,6 +32,23 @@ class NamespacesGet_Response(_message.Message):
     status: _engine_pb2.ReturnStatus
     def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., namespaces: _Optional[_Iterable[str]] = ...) -> None: ...
 
+class ResourceBulkPost_Request(_message.Message):
+    __slots__ = ["assets", "format", "namespaceid"]
+    class Asset(_message.Message):
+        __slots__ = ["content", "type"]
+        CONTENT_FIELD_NUMBER: _ClassVar[int]
+        TYPE_FIELD_NUMBER: _ClassVar[int]
+        content: str
+        type: ResourceType
+        def __init__(self, type: _Optional[_Union[ResourceType, str]] = ..., content: _Optional[str] = ...) -> None: ...
+    ASSETS_FIELD_NUMBER: _ClassVar[int]
+    FORMAT_FIELD_NUMBER: _ClassVar[int]
+    NAMESPACEID_FIELD_NUMBER: _ClassVar[int]
+    assets: _containers.RepeatedCompositeFieldContainer[ResourceBulkPost_Request.Asset]
+    format: ResourceFormat
+    namespaceid: str
+    def __init__(self, format: _Optional[_Union[ResourceFormat, str]] = ..., namespaceid: _Optional[str] = ..., assets: _Optional[_Iterable[_Union[ResourceBulkPost_Request.Asset, _Mapping]]] = ...) -> None: ...
+
 class ResourceDelete_Request(_message.Message):
     __slots__ = ["name", "namespaceid"]
     NAMESPACEID_FIELD_NUMBER: _ClassVar[int]
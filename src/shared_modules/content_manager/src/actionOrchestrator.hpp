@@ -262,8 +262,8 @@ private:
         if (0 == spUpdaterContext->currentOffset && "cti-offset" == contentSource)
 
         {
-            // Copy original data.
-            auto originalData = spUpdaterContext->data;
+            // Move the original data aside; the full-content download works on a fresh document.
+            auto originalData = spUpdaterContext->extractData();
 
             try
             {
@@ -20,6 +20,9 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -177,10 +180,40 @@ protected:
         return parameters;
     }
 
+    /**
+     * @brief Appends the downloaded tail file, if any, to the partially downloaded file.
+     *
+     * @param tailFilepath File with the tail of an interrupted download.
+     * @param outputFilepath Partially downloaded file where the tail will be appended.
+     */
+    void appendTailFile(const std::string& tailFilepath, const std::string& outputFilepath) const
+    {
+        if (!std::filesystem::exists(tailFilepath))
+        {
+            return;
+        }
+
+        std::ifstream tailFile {tailFilepath, std::ios::in | std::ios::binary};
+        std::ofstream outputFile {outputFilepath, std::ios::out | std::ios::binary | std::ios::app};
+        if (!tailFile || !(outputFile << tailFile.rdbuf()))
+        {
+            throw std::runtime_error {"Couldn't append '" + tailFilepath + "' into '" + outputFilepath + "'"};
+        }
+
+        tailFile.close();
+        outputFile.close();
+        std::filesystem::remove(tailFilepath);
+    }
+
     /**
      * @brief Loop for retrying the downloads from the server until the download is successful, there is an HTTP error
      * different from 5xx, or in case of an interruption.
      *
+     * @details Interrupted file downloads are resumed on the following attempts with an HTTP range request from the
+     * last received byte, so only the missing tail of the file is re-transferred. The resumed URL doesn't change
+     * between attempts and the CTI snapshot links are content addressed, so the range is known to belong to the same
+     * representation of the resource.
+     *
      * @param URL URL to download from.
      * @param onSuccess Callback on success download.
      * @param queryParameters Parameters to the GET query.
@@ -216,21 +249,55 @@ protected:
 
         while (!stopCondition->waitFor(std::chrono::seconds(sleepTime)))
         {
+            // If a previous attempt left a partial file, request just the missing tail into a side file.
+            auto headers {DEFAULT_HEADERS};
+            auto attemptOutputFilepath {outputFilepath};
+            uintmax_t partialSize {0};
+
+            if (!outputFilepath.empty())
+            {
+                std::error_code errorCode;
+                if (const auto fileSize {std::filesystem::file_size(outputFilepath, errorCode)};
+                    !errorCode && fileSize > 0)
+                {
+                    partialSize = fileSize;
+                    headers.insert("Range: bytes=" + std::to_string(partialSize) + "-");
+                    attemptOutputFilepath = outputFilepath + ".tail";
+
+                    logDebug2(WM_CONTENTUPDATER,
+                              "Resuming download of '%s' from byte %llu",
+                              outputFilepath.c_str(),
+                              static_cast<unsigned long long>(partialSize));
+                }
+            }
+
             try
             {
                 m_urlRequest.get(HttpURL(URL + queryParameters),
                                  onSuccess,
                                  onError,
-                                 outputFilepath,
-                                 DEFAULT_HEADERS,
+                                 attemptOutputFilepath,
+                                 headers,
                                  {},
                                  m_spUpdaterContext->spUpdaterBaseContext->httpUserAgent);
+
+                if (partialSize > 0)
+                {
+                    appendTailFile(attemptOutputFilepath, outputFilepath);
+                }
                 return;
             }
             catch (const cti_server_error& e)
             {
                 logDebug1(WM_CONTENTUPDATER, e.what());
 
+                if (partialSize > 0)
+                {
+                    // Fold any received portion of the tail into the partial file so that the next attempt
+                    // resumes from the last received byte.
+                    appendTailFile(attemptOutputFilepath, outputFilepath);
+                }
+
                 switch (e.type())
                 {
                     case CtiErrorType::GENERIC_SERVER_ERROR:
@@ -17,8 +17,17 @@
 #include "IURLRequest.hpp"
 #include "updaterContext.hpp"
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
+
+static const unsigned int OFFSET_PAGES_IN_FLIGHT {4};
 
 /**
  * @class CtiOffsetDownloader
@@ -32,6 +41,11 @@ private:
     /**
      * @brief Download the content from the API.
      *
+     * @details The offset pages to download are known beforehand, so they are fetched by a bounded window of
+     * concurrent workers while this thread applies each page as its turn arrives, keeping the applied order
+     * identical to the sequential download. Catching up a large offset gap is then bounded by bandwidth rather
+     * than by the accumulated round-trip time of each page.
+     *
      * @param context Updater context.
      */
     void download(UpdaterContext& context) override
@@ -59,37 +73,141 @@ private:
         }
         const auto& consumerLastOffset {ctiParameters.lastOffset.value()};
 
-        // Iterate until the current offset is equal to the consumer offset.
+        // Amount of offsets to download on each query.
+        constexpr auto OFFSETS_DELTA {1000};
+
+        // Page of offsets to download.
+        struct OffsetsPage
+        {
+            int fromOffset;           ///< Start offset of the page.
+            int toOffset;             ///< End offset of the page.
+            std::string fullFilePath; ///< Full path where the page content will be saved.
+        };
+
+        // Build the list of pages needed to reach the consumer offset.
+        std::vector<OffsetsPage> pages;
+        for (auto fromOffset {context.currentOffset}; fromOffset < consumerLastOffset;)
+        {
+            const auto toOffset {std::min(consumerLastOffset, fromOffset + OFFSETS_DELTA)};
+
+            // full path where the content will be saved.
+            std::ostringstream filePathStream;
+            filePathStream << m_outputFolder << "/" << toOffset << "-" << m_fileName;
+
+            pages.push_back({fromOffset, toOffset, filePathStream.str()});
+            fromOffset = toOffset;
+        }
+
+        enum class PageStatus
+        {
+            PENDING,
+            DONE,
+            FAILED
+        };
+
+        std::vector<PageStatus> pagesStatus(pages.size(), PageStatus::PENDING);
+        std::mutex mutex;
+        std::condition_variable statusChanged;
+        std::atomic<size_t> nextPage {0};
+        std::atomic<bool> downloadAborted {false};
+        std::exception_ptr downloadError;
+
+        // Worker routine. Claims the next page and downloads it into its own file until there are no pages
+        // left, a page fails, or the process is interrupted.
+        const auto worker {[&]()
+                           {
+                               while (!downloadAborted && !stopCondition->check())
+                               {
+                                   const auto pageIndex {nextPage.fetch_add(1)};
+                                   if (pageIndex >= pages.size())
+                                   {
+                                       break;
+                                   }
+
+                                   const auto& page {pages[pageIndex]};
+                                   try
+                                   {
+                                       downloadContent(page.fromOffset, page.toOffset, page.fullFilePath);
+
+                                       std::lock_guard<std::mutex> lock {mutex};
+                                       pagesStatus[pageIndex] = PageStatus::DONE;
+                                   }
+                                   catch (...)
+                                   {
+                                       {
+                                           std::lock_guard<std::mutex> lock {mutex};
+                                           pagesStatus[pageIndex] = PageStatus::FAILED;
+                                           if (!downloadError)
+                                           {
+                                               downloadError = std::current_exception();
+                                           }
+                                       }
+                                       downloadAborted = true;
+                                   }
+                                   statusChanged.notify_all();
+                               }
+
+                               // Wake the applier on interruption, since pending pages will never arrive.
+                               statusChanged.notify_all();
+                           }};
+
+        std::vector<std::thread> workers;
+        const auto workersAmount {std::min<size_t>(OFFSET_PAGES_IN_FLIGHT, pages.size())};
+        for (size_t i {0}; i < workersAmount; ++i)
+        {
+            workers.emplace_back(worker);
+        }
+
+        const auto joinWorkers {[&workers]()
+                                {
+                                    for (auto& workerThread : workers)
+                                    {
+                                        workerThread.join();
+                                    }
+                                }};
+
+        // Apply each page as its turn arrives, in the same order as the sequential download.
         auto pathsArray = nlohmann::json::array();
-        while (context.currentOffset < consumerLastOffset)
+        for (size_t pageIndex {0}; pageIndex < pages.size(); ++pageIndex)
         {
+            std::unique_lock<std::mutex> lock {mutex};
+            statusChanged.wait(lock,
+                               [&]() {
+                                   return pagesStatus[pageIndex] != PageStatus::PENDING || downloadAborted ||
+                                          stopCondition->check();
+                               });
+            const auto pageStatus {pagesStatus[pageIndex]};
+            lock.unlock();
+
             if (stopCondition->check())
             {
+                joinWorkers();
                 logWarn(WM_CONTENTUPDATER, "The offsets download has been interrupted.");
                 return;
             }
 
-            // Amount of offsets to download on each query.
-            constexpr auto OFFSETS_DELTA {1000};
-
-            // Calculate the offset to download
-            const auto toOffset {std::min(consumerLastOffset, context.currentOffset + OFFSETS_DELTA)};
-
-            // full path where the content will be saved.
-            std::ostringstream filePathStream;
-            filePathStream << m_outputFolder << "/" << toOffset << "-" << m_fileName;
-            const std::string fullFilePath = filePathStream.str();
-
-            // Download the content.
-            downloadContent(toOffset, fullFilePath, context);
+            if (PageStatus::DONE != pageStatus)
+            {
+                joinWorkers();
+                std::rethrow_exception(downloadError);
+            }
 
             // Update the current offset.
-            context.currentOffset = toOffset;
+            context.currentOffset = pages[pageIndex].toOffset;
 
             // Save the path of the downloaded content in a temporary variable.
-            pathsArray.push_back(fullFilePath);
+            pathsArray.push_back(pages[pageIndex].fullFilePath);
+
+            // Report the finished file so the pipelined mode can start decompressing it while the
+            // next pages download.
+            if (context.onFileDownloaded)
+            {
+                context.onFileDownloaded(pages[pageIndex].fullFilePath);
+            }
         }
 
+        joinWorkers();
+
         // Commit changes.
         context.data.at("paths") = std::move(pathsArray);
         context.data.at("offset") = context.currentOffset;
@@ -118,14 +236,15 @@ private:
     /**
      * @brief Download the content from the API.
      *
+     * @param fromOffset start offset to download.
      * @param toOffset end offset to download.
      * @param fullFilePath full path where the content will be saved.
      */
-    void downloadContent(int toOffset, const std::string& fullFilePath, const UpdaterContext& context) const
+    void downloadContent(int fromOffset, int toOffset, const std::string& fullFilePath) const
     {
         // Define the parameters for the request.
         const auto queryParameters =
-            "/changes?from_offset=" + std::to_string(context.currentOffset) + "&to_offset=" + std::to_string(toOffset);
+            "/changes?from_offset=" + std::to_string(fromOffset) + "&to_offset=" + std::to_string(toOffset);
 
         // Empty on download success routine.
         const auto onSuccess {[]([[maybe_unused]] const std::string& data) {
@@ -140,7 +259,6 @@ private:
     std::string m_url {};          ///< URL of the API to connect to.
     std::string m_outputFolder {}; ///< output folder where the file will be saved
     std::string m_fileName {};     ///< name of the file where the content will be saved
-
 public:
     /**
      * @brief Class constructor.
@@ -16,8 +16,22 @@
 #include "CtiDownloader.hpp"
 #include "IURLRequest.hpp"
 #include "updaterContext.hpp"
+#include "utils/timeHelper.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
 #include <filesystem>
+#include <fstream>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+static const unsigned int SNAPSHOT_DEFAULT_PARALLEL_WORKERS {4};
+static const uintmax_t SNAPSHOT_DEFAULT_CHUNK_SIZE {64 * 1024 * 1024};
+static const unsigned int SNAPSHOT_CHUNK_MAX_ATTEMPTS {5};
 
 /**
  * @class CtiSnapshotDownloader
@@ -28,6 +42,228 @@
 class CtiSnapshotDownloader final : public CtiDownloader
 {
 private:
+    /**
+     * @brief Returns the last fully downloaded snapshot link from the database.
+     *
+     * @param context Updater context.
+     * @return std::string Last downloaded snapshot link. If there is no available data, an empty string is returned.
+     */
+    std::string getLastDownloadedSnapshotLink(const UpdaterContext& context) const
+    {
+        try
+        {
+            return context.spUpdaterBaseContext->spRocksDB->getLastKeyValue(Components::Columns::LAST_SNAPSHOT_LINK)
+                .second.ToString();
+        }
+        catch (const std::runtime_error&)
+        {
+            // First execution: no snapshot has been downloaded yet.
+            return "";
+        }
+    }
+
+    /**
+     * @brief Downloads a single chunk of the snapshot with a range request, retrying on server errors.
+     *
+     * @param URL Snapshot URL to download from.
+     * @param chunkFilepath File where to store the chunk.
+     * @param chunkStart Offset of the first byte of the chunk within the snapshot.
+     * @return true If the chunk file was written. A chunk starting past the end of the snapshot is written as an
+     * empty file.
+     * @return false If the download failed or was interrupted.
+     */
+    bool downloadChunk(const std::string& URL, const std::string& chunkFilepath, const uintmax_t chunkStart) const
+    {
+        auto rangeNotSatisfiable {false};
+
+        // On download error routine. Same status code mapping as the base retry loop, plus the detection of
+        // ranges past the end of the snapshot.
+        const auto onError {
+            [&rangeNotSatisfiable](const std::string& message, const long statusCode)
+            {
+                const std::string exceptionMessage {"Error " + std::to_string(statusCode) + " from server: " + message};
+
+                if (statusCode == 429)
+                {
+                    throw cti_server_error {exceptionMessage, CtiErrorType::TOO_MANY_REQUESTS};
+                }
+
+                if (statusCode >= 500 && statusCode <= 599)
+                {
+                    throw cti_server_error {exceptionMessage, CtiErrorType::GENERIC_SERVER_ERROR};
+                }
+
+                if (statusCode == 416)
+                {
+                    rangeNotSatisfiable = true;
+                }
+                throw std::runtime_error {exceptionMessage};
+            }};
+
+        auto& stopCondition {m_spUpdaterContext->spUpdaterBaseContext->spStopCondition};
+        unsigned int sleepTime {0};
+
+        for (unsigned int retryAttempt {0}; retryAttempt < SNAPSHOT_CHUNK_MAX_ATTEMPTS; ++retryAttempt)
+        {
+            if (stopCondition->waitFor(std::chrono::seconds(sleepTime)))
+            {
+                return false;
+            }
+
+            // A failed attempt may leave a partial chunk behind. Chunks are small enough to be re-requested
+            // whole, which keeps every received chunk file consistent with its requested range.
+            std::error_code errorCode;
+            std::filesystem::remove(chunkFilepath, errorCode);
+
+            auto headers {DEFAULT_HEADERS};
+            headers.insert("Range: bytes=" + std::to_string(chunkStart) + "-" +
+                           std::to_string(chunkStart + m_chunkSize - 1));
+
+            try
+            {
+                m_urlRequest.get(HttpURL(URL),
+                                 []([[maybe_unused]] const std::string& data) {},
+                                 onError,
+                                 chunkFilepath,
+                                 headers,
+                                 {},
+                                 m_spUpdaterContext->spUpdaterBaseContext->httpUserAgent);
+                return true;
+            }
+            catch (const cti_server_error& e)
+            {
+                logDebug1(WM_CONTENTUPDATER, e.what());
+
+                sleepTime = (CtiErrorType::TOO_MANY_REQUESTS == e.type()) ? m_tooManyRequestsRetryTime
+                                                                          : std::min(30U, 1U << retryAttempt);
+
+                logDebug1(WM_CONTENTUPDATER, "Retrying chunk download in %d seconds", sleepTime);
+            }
+            catch (const std::exception& e)
+            {
+                if (rangeNotSatisfiable)
+                {
+                    // The chunk starts past the end of the snapshot: materialize it as an empty file so that
+                    // the reassembly finds no gaps.
+                    std::ofstream {chunkFilepath, std::ios::out | std::ios::binary};
+                    return true;
+                }
+
+                logDebug1(WM_CONTENTUPDATER, e.what());
+                return false;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Downloads the snapshot with parallel range requests, reassembled in order into the output file.
+     *
+     * @details Worker threads pull consecutive chunk indexes from a shared counter and download each chunk into
+     * its own side file with an HTTP range request. The snapshot links are content addressed and the total
+     * snapshot size is not known beforehand, so the end of the content is detected when a chunk comes back
+     * shorter than requested (or its range is not satisfiable). Once every chunk is received, the side files
+     * are appended in order into the output file.
+     *
+     * @param URL Snapshot URL to download from.
+     * @param outputFilepath File where to store the downloaded snapshot.
+     * @return true If the snapshot was fully downloaded and reassembled.
+     * @return false If any chunk persistently failed or the download was interrupted. No output is left behind,
+     * so the caller can fall back to the sequential download.
+     */
+    bool downloadSnapshotInChunks(const std::string& URL, const std::string& outputFilepath) const
+    {
+        std::atomic<size_t> nextChunk {0};
+        std::atomic<bool> lastChunkFound {false};
+        std::atomic<bool> chunkFailed {false};
+        auto& stopCondition {m_spUpdaterContext->spUpdaterBaseContext->spStopCondition};
+
+        const auto chunkFilepathFor {[&outputFilepath](const size_t chunkIndex)
+                                     {
+                                         return outputFilepath + ".chunk" + std::to_string(chunkIndex);
+                                     }};
+
+        // Worker routine. Claims the next chunk index and downloads it until the last chunk is found, a chunk
+        // fails, or the process is interrupted.
+        const auto worker {[&]()
+                           {
+                               while (!lastChunkFound && !chunkFailed && !stopCondition->check())
+                               {
+                                   const auto chunkIndex {nextChunk.fetch_add(1)};
+                                   const auto chunkFilepath {chunkFilepathFor(chunkIndex)};
+
+                                   if (!downloadChunk(URL, chunkFilepath, chunkIndex * m_chunkSize))
+                                   {
+                                       chunkFailed = true;
+                                       return;
+                                   }
+
+                                   // A chunk shorter than requested is the last one. A longer one means the
+                                   // server ignored the range and sent the whole snapshot, which the
+                                   // reassembly below also resolves.
+                                   std::error_code errorCode;
+                                   const auto chunkSize {std::filesystem::file_size(chunkFilepath, errorCode)};
+                                   if (errorCode || chunkSize != m_chunkSize)
+                                   {
+                                       lastChunkFound = true;
+                                   }
+                               }
+                           }};
+
+        std::vector<std::thread> workers;
+        for (unsigned int i {0}; i < m_parallelWorkers; ++i)
+        {
+            workers.emplace_back(worker);
+        }
+        for (auto& workerThread : workers)
+        {
+            workerThread.join();
+        }
+
+        // Routine that removes the chunk files that were not consumed by the reassembly.
+        const auto removeChunkFiles {[&chunkFilepathFor, &nextChunk]()
+                                     {
+                                         for (size_t chunkIndex {0}; chunkIndex < nextChunk; ++chunkIndex)
+                                         {
+                                             std::error_code errorCode;
+                                             std::filesystem::remove(chunkFilepathFor(chunkIndex), errorCode);
+                                         }
+                                     }};
+
+        if (chunkFailed || stopCondition->check())
+        {
+            removeChunkFiles();
+            return false;
+        }
+
+        // Reassemble the chunks in order. appendTailFile() appends each chunk and removes its file. The
+        // content ends on the first chunk shorter than requested; a chunk can only exceed the requested size
+        // when the server ignored the range, in which case the first chunk already holds the whole snapshot.
+        std::ofstream {outputFilepath, std::ios::out | std::ios::binary | std::ios::app};
+        for (size_t chunkIndex {0}; chunkIndex < nextChunk; ++chunkIndex)
+        {
+            const auto chunkFilepath {chunkFilepathFor(chunkIndex)};
+            std::error_code errorCode;
+            const auto chunkSize {std::filesystem::file_size(chunkFilepath, errorCode)};
+
+            if (errorCode || chunkSize == 0)
+            {
+                break;
+            }
+
+            appendTailFile(chunkFilepath, outputFilepath);
+
+            if (chunkSize != m_chunkSize)
+            {
+                break;
+            }
+        }
+
+        removeChunkFiles();
+        return true;
+    }
+
     /**
      * @brief Download the content from the API.
      *
@@ -48,30 +284,68 @@ private:
         const auto lastSnapshotURL {std::filesystem::path(baseParameters.lastSnapshotLink.value())};
         context.currentOffset = baseParameters.lastSnapshotOffset.value();
 
+        // The snapshot links are content addressed, so an unchanged link means unchanged content: skip the
+        // transfer and leave nothing to publish.
+        if (context.spUpdaterBaseContext->spRocksDB &&
+            getLastDownloadedSnapshotLink(context) == baseParameters.lastSnapshotLink.value())
+        {
+            logDebug1(WM_CONTENTUPDATER,
+                      "Snapshot from '%s' already downloaded: skipping download",
+                      lastSnapshotURL.string().c_str());
+            context.data.at("offset") = context.currentOffset;
+            return;
+        }
+
         // Set output path. The snapshot is always compressed, so the output folder is the downloads folder.
         const auto outputFilepath {context.spUpdaterBaseContext->downloadsFolder / lastSnapshotURL.filename()};
 
-        // On success routine. Append output file path to the to-publish paths.
-        const auto onSuccess {[&context, outputFilepath]([[maybe_unused]] const std::string& data)
+        // On success routine. Append output file path to the to-publish paths and persist the downloaded link.
+        const auto onSuccess {[&context, outputFilepath, snapshotLink = baseParameters.lastSnapshotLink.value()](
+                                  [[maybe_unused]] const std::string& data)
                               {
                                   context.data.at("paths").push_back(outputFilepath);
                                   context.data.at("offset") = context.currentOffset;
+
+                                  if (context.spUpdaterBaseContext->spRocksDB)
+                                  {
+                                      context.spUpdaterBaseContext->spRocksDB->put(
+                                          Utils::getCompactTimestamp(std::time(nullptr)),
+                                          snapshotLink,
+                                          Components::Columns::LAST_SNAPSHOT_LINK);
+                                  }
                               }};
 
         logDebug2(WM_CONTENTUPDATER, "Downloading snapshot from '%s'", lastSnapshotURL.string().c_str());
 
-        // Download the content.
-        performQueryWithRetry(lastSnapshotURL, onSuccess, "", outputFilepath);
+        // Download the content. When starting from scratch, the snapshot is fetched with parallel range
+        // requests. A partial file from an interrupted execution is instead resumed sequentially from the last
+        // received byte, and a failure of the parallel path falls back to the sequential retry loop.
+        if (std::filesystem::exists(outputFilepath) || !downloadSnapshotInChunks(lastSnapshotURL, outputFilepath))
+        {
+            performQueryWithRetry(lastSnapshotURL, onSuccess, "", outputFilepath);
+            return;
+        }
+
+        onSuccess("");
     }
 
+    const unsigned int m_parallelWorkers; ///< Amount of concurrent chunk download workers.
+    const uintmax_t m_chunkSize;          ///< Size of each downloaded chunk, in bytes.
+
 public:
     /**
      * @brief Class constructor.
      *
      * @param urlRequest Object to perform the HTTP requests to the CTI API.
+     * @param parallelWorkers Amount of concurrent chunk download workers.
+     * @param chunkSize Size of each downloaded chunk, in bytes.
      */
-    explicit CtiSnapshotDownloader(IURLRequest& urlRequest)
+    explicit CtiSnapshotDownloader(IURLRequest& urlRequest,
+                                   unsigned int parallelWorkers = SNAPSHOT_DEFAULT_PARALLEL_WORKERS,
+                                   uintmax_t chunkSize = SNAPSHOT_DEFAULT_CHUNK_SIZE)
         : CtiDownloader(urlRequest, "CtiSnapshotDownloader")
+        , m_parallelWorkers {std::max(1U, parallelWorkers)}
+        , m_chunkSize {std::max<uintmax_t>(1, chunkSize)}
     {
     }
 };
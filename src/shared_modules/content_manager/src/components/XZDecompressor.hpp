@@ -19,11 +19,13 @@
 #include "utils/chainOfResponsability.hpp"
 #include "utils/stringHelper.h"
 #include "utils/xzHelper.hpp"
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 /**
  * @class XZDecompressor
@@ -34,6 +36,12 @@
 class XZDecompressor final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
 {
 private:
+    static constexpr size_t SCRATCH_BUFFER_SIZE {1024 * 1024}; ///< Size of the reusable output buffer.
+
+    uint32_t m_threadCount;    ///< Number of xz worker threads. 0 uses all the available threads.
+    uint64_t m_memoryLimit;    ///< Memory limit for the xz decoder, in bytes. 0 keeps the library defaults.
+    std::shared_ptr<std::vector<uint8_t>> m_spScratchBuffer; ///< Output buffer reused across files.
+
     /**
      * @brief Decompress the content and save it in the context.
      *
@@ -60,7 +68,7 @@ private:
             // Decompress.
             logDebug2(
                 WM_CONTENTUPDATER, "Decompressing '%s' into '%s'", inputPath.string().c_str(), outputPath.c_str());
-            Utils::XzHelper(inputPath, outputPath).decompress();
+            Utils::XzHelper(inputPath, outputPath, m_spScratchBuffer, m_threadCount, m_memoryLimit).decompress();
 
             // Decompression finished: Update context path.
             path = std::move(outputPath);
@@ -68,6 +76,20 @@ private:
     }
 
 public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param threadCount Number of xz worker threads. 0, the default, uses all the available threads.
+     * @param memoryLimit Memory limit for the xz decoder, in bytes. When exceeded, the decoder falls back to
+     * fewer threads. 0, the default, keeps the library defaults.
+     */
+    explicit XZDecompressor(uint32_t threadCount = 0, uint64_t memoryLimit = 0)
+        : m_threadCount(threadCount)
+        , m_memoryLimit(memoryLimit)
+        , m_spScratchBuffer(std::make_shared<std::vector<uint8_t>>(SCRATCH_BUFFER_SIZE))
+    {
+    }
+
     /**
      * @brief Decompress the content.
      *
@@ -34,6 +34,8 @@ namespace Components
     {
         static const std::string CURRENT_OFFSET {"current_offset"};             ///< Database column name for offsets.
         static const std::string DOWNLOADED_FILE_HASH {"downloaded_file_hash"}; ///< Database column name for hashes.
+        static const std::string LAST_SNAPSHOT_LINK {
+            "last_snapshot_link"}; ///< Database column name for the last downloaded snapshot link.
     }                                                                           // namespace Columns
 
     /**
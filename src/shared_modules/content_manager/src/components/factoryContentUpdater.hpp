@@ -17,6 +17,7 @@
 #include "factoryDecompressor.hpp"
 #include "factoryDownloader.hpp"
 #include "factoryVersionUpdater.hpp"
+#include "pipelinedDownloadDecompress.hpp"
 #include "pubSubPublisher.hpp"
 #include "updaterContext.hpp"
 #include "utils/chainOfResponsability.hpp"
@@ -49,6 +50,17 @@ public:
         auto factoryVersionUpdater {FactoryVersionUpdater::create(config)};
         auto factoryCleaner {FactoryCleaner::create(config)};
 
+        // Pipelined execution mode: the download and decompression stages run overlapped, streaming
+        // each downloaded file to the decompressor through a bounded queue.
+        if (config.contains("pipelined") && config.at("pipelined").get<bool>())
+        {
+            auto pipelinedStage {std::make_shared<PipelinedDownloadDecompress>(factoryDownloader, factoryDecompressor)};
+
+            pipelinedStage->setNext(factoryPublisher)->setNext(factoryVersionUpdater)->setNext(factoryCleaner);
+
+            return pipelinedStage;
+        }
+
         // Set the first step of the updater chain.
         auto const& updaterChain {factoryDownloader};
 
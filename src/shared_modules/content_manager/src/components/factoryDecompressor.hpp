@@ -74,7 +74,19 @@ public:
 
         if ("xz" == decompressorType)
         {
-            return std::make_shared<XZDecompressor>();
+            // Optional tuning for the multi-threaded xz decoder.
+            uint32_t threadCount {0};
+            uint64_t memoryLimit {0};
+            if (config.contains("decompressionThreads"))
+            {
+                threadCount = config.at("decompressionThreads").get<uint32_t>();
+            }
+            if (config.contains("decompressionMemoryLimit"))
+            {
+                memoryLimit = config.at("decompressionMemoryLimit").get<uint64_t>();
+            }
+
+            return std::make_shared<XZDecompressor>(threadCount, memoryLimit);
         }
 
         if ("gzip" == decompressorType)
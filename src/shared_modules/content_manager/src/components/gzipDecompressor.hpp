@@ -23,6 +23,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 /**
  * @class GzipDecompressor
@@ -33,6 +34,9 @@
 class GzipDecompressor final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
 {
 private:
+    std::shared_ptr<std::vector<char>> m_spScratchBuffer {
+        std::make_shared<std::vector<char>>(GZ_BUF_LEN)}; ///< Decompression buffer reused across files.
+
     /**
      * @brief Decompress the compressed content and update the context paths.
      *
@@ -59,7 +63,7 @@ private:
             // Decompress.
             logDebug2(
                 WM_CONTENTUPDATER, "Decompressing '%s' into '%s'", inputPath.string().c_str(), outputPath.c_str());
-            Utils::ZlibHelper::gzipDecompress(inputPath, outputPath);
+            Utils::ZlibHelper::gzipDecompress(inputPath, outputPath, m_spScratchBuffer);
 
             // Decompression finished: Update context path.
             path = std::move(outputPath);
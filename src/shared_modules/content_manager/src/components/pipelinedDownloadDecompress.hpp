@@ -0,0 +1,219 @@
+/*
+ * Wazuh content manager
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 28, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _PIPELINED_DOWNLOAD_DECOMPRESS_HPP
+#define _PIPELINED_DOWNLOAD_DECOMPRESS_HPP
+
+#include "../sharedDefs.hpp"
+#include "componentsHelper.hpp"
+#include "updaterContext.hpp"
+#include "utils/chainOfResponsability.hpp"
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+
+/**
+ * @brief Files kept in flight between the download and decompression stages by default.
+ *
+ */
+constexpr auto DEFAULT_PIPELINE_QUEUE_BOUND {8};
+
+/**
+ * @class PipelinedDownloadDecompress
+ *
+ * @brief Runs the download and decompression stages overlapped as a single step of the chain of responsibility.
+ *
+ * @details Each file reported by the downloader through the UpdaterContext::onFileDownloaded hook is handed to a
+ * decompression thread through a bounded queue, so the decompression of one file overlaps the download of the next
+ * one and the wall time of both stages tends to the slowest of the two. Files not reported through the hook are
+ * decompressed once the download finishes, keeping the behavior of downloaders that don't support per-file
+ * notifications. The downstream steps of the chain receive the context once every file has been decompressed, with
+ * the paths in download order.
+ *
+ */
+class PipelinedDownloadDecompress final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
+{
+private:
+    std::shared_ptr<AbstractHandler<std::shared_ptr<UpdaterContext>>> m_spDownloader;   ///< Download stage.
+    std::shared_ptr<AbstractHandler<std::shared_ptr<UpdaterContext>>> m_spDecompressor; ///< Decompression stage.
+    size_t m_queueBound; ///< Files kept in flight between the two stages; the producer blocks when reached.
+
+    /**
+     * @brief Decompresses a single file, returning the resulting paths.
+     *
+     * @param context Updater context of the current run, used to access the base context.
+     * @param path Path of the downloaded file.
+     * @return nlohmann::json Array of decompressed paths.
+     */
+    nlohmann::json decompressFile(const std::shared_ptr<UpdaterContext>& context, const std::string& path) const
+    {
+        auto spFileContext {std::make_shared<UpdaterContext>()};
+        spFileContext->spUpdaterBaseContext = context->spUpdaterBaseContext;
+        spFileContext->data.at("paths").push_back(path);
+
+        m_spDecompressor->handleRequest(spFileContext);
+
+        return spFileContext->data.at("paths");
+    }
+
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param spDownloader Download stage. Shouldn't be chained to any other step.
+     * @param spDecompressor Decompression stage. Shouldn't be chained to any other step.
+     * @param queueBound Files kept in flight between the two stages.
+     */
+    explicit PipelinedDownloadDecompress(
+        std::shared_ptr<AbstractHandler<std::shared_ptr<UpdaterContext>>> spDownloader,
+        std::shared_ptr<AbstractHandler<std::shared_ptr<UpdaterContext>>> spDecompressor,
+        size_t queueBound = DEFAULT_PIPELINE_QUEUE_BOUND)
+        : m_spDownloader(std::move(spDownloader))
+        , m_spDecompressor(std::move(spDecompressor))
+        , m_queueBound(queueBound ? queueBound : 1)
+    {
+    }
+
+    /**
+     * @brief Downloads and decompresses the content overlapped and passes the control to the next step on the chain.
+     *
+     * @param context Updater context.
+     * @return std::shared_ptr<UpdaterContext> Next step on the chain.
+     */
+    std::shared_ptr<UpdaterContext> handleRequest(std::shared_ptr<UpdaterContext> context) override
+    {
+        logDebug1(WM_CONTENTUPDATER, "PipelinedDownloadDecompress - Starting process");
+        constexpr auto COMPONENT_NAME {"PipelinedDownloadDecompress"};
+
+        std::queue<std::string> pendingFiles;
+        std::set<std::string> enqueuedFiles;
+        std::mutex mutex;
+        std::condition_variable cvProducer;
+        std::condition_variable cvConsumer;
+        bool closed {false};
+        bool failed {false};
+        std::exception_ptr decompressError;
+        auto decompressedPaths = nlohmann::json::array();
+
+        // Producer side: downloaders report each file as soon as it lands, blocking while the
+        // decompression stage is more than the queue bound behind.
+        context->onFileDownloaded = [&](const std::string& path)
+        {
+            std::unique_lock lock {mutex};
+            cvProducer.wait(lock, [&]() { return pendingFiles.size() < m_queueBound || failed; });
+
+            enqueuedFiles.insert(path);
+            if (!failed)
+            {
+                pendingFiles.push(path);
+                cvConsumer.notify_one();
+            }
+        };
+
+        // Consumer side: decompresses the files in download order while the download goes on.
+        std::thread consumer {[&]()
+                              {
+                                  while (true)
+                                  {
+                                      std::string path;
+                                      {
+                                          std::unique_lock lock {mutex};
+                                          cvConsumer.wait(lock, [&]() { return !pendingFiles.empty() || closed; });
+                                          if (pendingFiles.empty())
+                                          {
+                                              break;
+                                          }
+                                          path = std::move(pendingFiles.front());
+                                          pendingFiles.pop();
+                                          cvProducer.notify_one();
+
+                                          if (failed)
+                                          {
+                                              // A previous file already failed, just drain the queue.
+                                              continue;
+                                          }
+                                      }
+
+                                      try
+                                      {
+                                          auto filePaths {decompressFile(context, path)};
+
+                                          std::scoped_lock lock {mutex};
+                                          for (auto& filePath : filePaths)
+                                          {
+                                              decompressedPaths.push_back(std::move(filePath));
+                                          }
+                                      }
+                                      catch (...)
+                                      {
+                                          std::scoped_lock lock {mutex};
+                                          failed = true;
+                                          decompressError = std::current_exception();
+                                          cvProducer.notify_all();
+                                      }
+                                  }
+                              }};
+
+        const auto shutdownConsumer {[&]()
+                                     {
+                                         {
+                                             std::scoped_lock lock {mutex};
+                                             closed = true;
+                                             cvConsumer.notify_all();
+                                         }
+                                         consumer.join();
+                                         context->onFileDownloaded = nullptr;
+                                     }};
+
+        try
+        {
+            m_spDownloader->handleRequest(context);
+
+            // Feed the files the downloader did not report through the hook, so downloaders
+            // without per-file notifications still get their content decompressed.
+            for (const auto& path : context->data.at("paths"))
+            {
+                if (0 == enqueuedFiles.count(path.get<std::string>()))
+                {
+                    context->onFileDownloaded(path.get<std::string>());
+                }
+            }
+        }
+        catch (...)
+        {
+            shutdownConsumer();
+            throw;
+        }
+
+        shutdownConsumer();
+
+        if (decompressError)
+        {
+            Components::pushStatus(COMPONENT_NAME, Components::Status::STATUS_FAIL, *context);
+            std::rethrow_exception(decompressError);
+        }
+
+        // Commit the decompressed paths, in download order.
+        context->data.at("paths") = std::move(decompressedPaths);
+
+        Components::pushStatus(COMPONENT_NAME, Components::Status::STATUS_OK, *context);
+
+        return AbstractHandler<std::shared_ptr<UpdaterContext>>::handleRequest(std::move(context));
+    }
+};
+
+#endif // _PIPELINED_DOWNLOAD_DECOMPRESS_HPP
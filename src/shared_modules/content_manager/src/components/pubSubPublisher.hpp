@@ -16,6 +16,9 @@
 #include "updaterContext.hpp"
 #include "utils/chainOfResponsability.hpp"
 #include <memory>
+#include <ostream>
+#include <streambuf>
+#include <vector>
 
 /**
  * @class PubSubPublisher
@@ -26,6 +29,57 @@
 class PubSubPublisher final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
 {
 private:
+    /**
+     * @brief Streambuf that appends straight into a char vector, so the payload is serialized once
+     * into the buffer handed to the channel, with no intermediate string copy.
+     *
+     */
+    class VectorStreambuf final : public std::streambuf
+    {
+    public:
+        /**
+         * @brief Class constructor.
+         *
+         * @param buffer Vector the serialized bytes are appended to.
+         */
+        explicit VectorStreambuf(std::vector<char>& buffer)
+            : m_buffer(buffer)
+        {
+        }
+
+    protected:
+        /**
+         * @brief Appends a single character to the vector.
+         *
+         * @param character Character to append.
+         * @return int_type The appended character.
+         */
+        int_type overflow(int_type character) override
+        {
+            if (traits_type::eof() != character)
+            {
+                m_buffer.push_back(traits_type::to_char_type(character));
+            }
+            return character;
+        }
+
+        /**
+         * @brief Appends a character run to the vector.
+         *
+         * @param data Characters to append.
+         * @param count Amount of characters to append.
+         * @return std::streamsize Amount of characters appended.
+         */
+        std::streamsize xsputn(const char* data, std::streamsize count) override
+        {
+            m_buffer.insert(m_buffer.end(), data, data + count);
+            return count;
+        }
+
+    private:
+        std::vector<char>& m_buffer;
+    };
+
     /**
      * @brief Publish the content.
      *
@@ -36,12 +90,18 @@ private:
         // If there is data to publish, send it
         if (context.data.contains("paths") && !context.data.at("paths").empty())
         {
-            // serialize the JSON object
-            const auto stringifyJson = context.data.dump();
+            // Serialize the JSON object straight into the payload buffer: for big payloads the
+            // previous string-then-vector round trip doubled the peak memory of the publication.
+            std::vector<char> payload;
+            {
+                VectorStreambuf streambuf {payload};
+                std::ostream stream {&streambuf};
+                stream << context.data;
+            }
 
-            logDebug2(WM_CONTENTUPDATER, "Data to be published: '%s'", stringifyJson.c_str());
+            logDebug2(WM_CONTENTUPDATER, "Publishing %zu bytes", payload.size());
 
-            context.spUpdaterBaseContext->spChannel->send({stringifyJson.begin(), stringifyJson.end()});
+            context.spUpdaterBaseContext->spChannel->send(payload);
             logDebug2(WM_CONTENTUPDATER, "Data published");
             return;
         }
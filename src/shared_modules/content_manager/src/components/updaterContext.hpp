@@ -18,6 +18,7 @@
 #include "utils/rocksDBWrapper.hpp"
 #include <external/nlohmann/json.hpp>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -137,11 +138,33 @@ struct UpdaterContext
      */
     nlohmann::json data = R"({ "type": "raw", "offset": 0, "paths": [], "stageStatus": [] })"_json;
 
+    /**
+     * @brief Moves the data out of the context and resets it to its initial document.
+     *
+     * @details Used to hand the payload over without copying it: for multi-hundred-MB feeds a
+     * plain copy of the data member doubles the peak memory of the run.
+     *
+     * @return nlohmann::json Data owned by the context until this call.
+     */
+    nlohmann::json extractData()
+    {
+        auto extractedData = std::move(data);
+        data = R"({ "type": "raw", "offset": 0, "paths": [], "stageStatus": [] })"_json;
+        return extractedData;
+    }
+
     /**
      * @brief Represents the offset processed in the current run.
      *
      */
     int currentOffset {0};
+
+    /**
+     * @brief Optional hook invoked by the downloaders as soon as each file is fully downloaded. Set by the
+     * pipelined execution mode to overlap the decompression of a file with the download of the next one.
+     *
+     */
+    std::function<void(const std::string&)> onFileDownloaded;
 };
 
 #endif // _UPDATER_CONTEXT_HPP
@@ -34,6 +34,9 @@
 class ZipDecompressor final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
 {
 private:
+    std::shared_ptr<std::vector<char>> m_spScratchBuffer {
+        std::make_shared<std::vector<char>>(ZIP_BUF_LEN)}; ///< Decompression buffer reused across files.
+
     /**
      * @brief Decompress the compressed content and update the context paths.
      *
@@ -52,7 +55,7 @@ private:
                       outputFolder.string().c_str());
 
             // Decompress and move paths.
-            auto decompressedFiles {Utils::ZlibHelper::zipDecompress(path, outputFolder)};
+            auto decompressedFiles {Utils::ZlibHelper::zipDecompress(path, outputFolder, m_spScratchBuffer)};
             newPaths.insert(newPaths.end(),
                             std::make_move_iterator(decompressedFiles.begin()),
                             std::make_move_iterator(decompressedFiles.end()));
@@ -48,10 +48,13 @@ void OnDemandManager::startServer()
                                                                  "offset=-1 (Do not replace current offset)");
                                  }
 
-                                 const auto& it {m_endpoints.find(req.matches[1].str())};
+                                 const auto endpoint {req.matches[1].str()};
+                                 const auto& it {m_endpoints.find(endpoint)};
                                  if (it != m_endpoints.end())
                                  {
-                                     it->second(ActionOrchestrator::UpdateData::createContentUpdateData(offset));
+                                     runCoalescedUpdate(endpoint,
+                                                        it->second,
+                                                        ActionOrchestrator::UpdateData::createContentUpdateData(offset));
                                      res.status = 200;
                                  }
                                  else
@@ -155,6 +158,45 @@ void OnDemandManager::startServer()
     }
 }
 
+void OnDemandManager::runCoalescedUpdate(const std::string& endpoint,
+                                         const std::function<void(ActionOrchestrator::UpdateData)>& func,
+                                         ActionOrchestrator::UpdateData updateData)
+{
+    std::shared_future<void> updateResult;
+    auto isLeader {false};
+
+    {
+        std::lock_guard<std::mutex> lock {m_inFlightMutex};
+
+        if (const auto it {m_inFlightUpdates.find(endpoint)}; it != m_inFlightUpdates.end())
+        {
+            // Another request is already updating this content: wait on its result below.
+            updateResult = it->second;
+        }
+        else
+        {
+            // First request for this content: run the update off the server thread. Requests arriving
+            // while it's in flight will find this entry and wait for the same result.
+            updateResult = std::async(std::launch::async, func, std::move(updateData)).share();
+            m_inFlightUpdates.emplace(endpoint, updateResult);
+            isLeader = true;
+        }
+    }
+
+    // Retire the in-flight entry once the update settles, whether it succeeded or not, so that later
+    // requests trigger a fresh update.
+    if (isLeader)
+    {
+        updateResult.wait();
+
+        std::lock_guard<std::mutex> lock {m_inFlightMutex};
+        m_inFlightUpdates.erase(endpoint);
+    }
+
+    // Propagate the update error, if any, to the request.
+    updateResult.get();
+}
+
 /**
  * @brief Stop the server
  */
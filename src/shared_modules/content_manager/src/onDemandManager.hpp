@@ -21,7 +21,9 @@
 #include "singleton.hpp"
 #include <external/cpp-httplib/httplib.h>
 #include <functional>
+#include <future>
 #include <map>
+#include <mutex>
 #include <shared_mutex>
 
 /**
@@ -36,9 +38,26 @@ private:
     std::shared_mutex m_mutex {};
     std::thread m_serverThread {};
     std::atomic<bool> m_runningTrigger {true};
+    std::mutex m_inFlightMutex {};
+    std::map<std::string, std::shared_future<void>> m_inFlightUpdates {};
     void startServer();
     void stopServer();
 
+    /**
+     * @brief Runs a content update off the server thread, coalescing concurrent requests for the same content.
+     *
+     * @details The first request for a given endpoint launches the update and becomes its leader; requests
+     * arriving while it's in flight wait on the leader's result instead of triggering their own update. Errors
+     * from the update are propagated to every waiting request.
+     *
+     * @param endpoint Endpoint whose content will be updated.
+     * @param func Update function registered for the endpoint.
+     * @param updateData Update data to pass to the update function.
+     */
+    void runCoalescedUpdate(const std::string& endpoint,
+                            const std::function<void(ActionOrchestrator::UpdateData)>& func,
+                            ActionOrchestrator::UpdateData updateData);
+
 public:
     /**
      * @brief Add an endpoint to the server and start it if it's not running
@@ -12,10 +12,14 @@
 #include "CtiSnapshotDownloader_test.hpp"
 #include "CtiSnapshotDownloader.hpp"
 #include "HTTPRequest.hpp"
+#include "componentsHelper.hpp"
 #include "updaterContext.hpp"
+#include "utils/rocksDBWrapper.hpp"
 #include "gtest/gtest.h"
 #include <filesystem>
+#include <fstream>
 #include <memory>
+#include <sstream>
 
 const auto OK_STATUS = R"([{"stage":"CtiSnapshotDownloader","status":"ok"}])"_json;
 const auto FAIL_STATUS = R"([{"stage":"CtiSnapshotDownloader","status":"fail"}])"_json;
@@ -120,6 +124,40 @@ TEST_F(CtiSnapshotDownloaderTest, SnapshotDownloadWithRetry)
     EXPECT_TRUE(std::filesystem::exists(expectedContentPath));
 }
 
+/**
+ * @brief Tests the correct download of an snapshot file split into multiple parallel chunks.
+ *
+ */
+TEST_F(CtiSnapshotDownloaderTest, SnapshotDownloadInMultipleChunks)
+{
+    // A chunk size of four bytes forces the snapshot to be downloaded with several range requests.
+    constexpr auto PARALLEL_WORKERS {2};
+    constexpr auto CHUNK_SIZE {4};
+    ASSERT_NO_THROW(
+        CtiSnapshotDownloader(HTTPRequest::instance(), PARALLEL_WORKERS, CHUNK_SIZE).handleRequest(m_spUpdaterContext));
+
+    // Set expected data.
+    const auto expectedContentPath {m_spUpdaterContext->spUpdaterBaseContext->downloadsFolder / SNAPSHOT_FILE_NAME};
+    constexpr auto EXPECTED_CURRENT_OFFSET {3};
+    nlohmann::json expectedData;
+    expectedData["paths"] = nlohmann::json::array();
+    expectedData["paths"].push_back(expectedContentPath);
+    expectedData["stageStatus"] = OK_STATUS;
+    expectedData["type"] = CONTENT_TYPE;
+    expectedData["offset"] = EXPECTED_CURRENT_OFFSET;
+
+    EXPECT_EQ(m_spUpdaterContext->currentOffset, EXPECTED_CURRENT_OFFSET);
+    EXPECT_EQ(m_spUpdaterContext->data, expectedData);
+
+    // The reassembled file should hold the whole snapshot, with no chunk files left behind.
+    std::ifstream contentFile {expectedContentPath, std::ios::in | std::ios::binary};
+    ASSERT_TRUE(contentFile);
+    std::ostringstream content;
+    content << contentFile.rdbuf();
+    EXPECT_EQ(content.str(), R"({"data":"content"})");
+    EXPECT_FALSE(std::filesystem::exists(expectedContentPath.string() + ".chunk0"));
+}
+
 /**
  * @brief Tests the download of the snapshot when last_snapshot_link metadata is missing.
  *
@@ -177,3 +215,58 @@ TEST_F(CtiSnapshotDownloaderTest, MissingLastSnapshotOffsetMetadata)
     expectedData["offset"] = 0;
     EXPECT_EQ(m_spUpdaterContext->data, expectedData);
 }
+
+/**
+ * @brief Tests that the download is skipped when the last downloaded snapshot link is unchanged.
+ *
+ */
+TEST_F(CtiSnapshotDownloaderTest, SkipDownloadWhenSnapshotUnchanged)
+{
+    // Set up a metadata database whose last downloaded link matches the one served by the CTI API.
+    const auto databasePath {std::filesystem::temp_directory_path() / "CtiSnapshotDownloaderTestDb"};
+    auto& spRocksDB {m_spUpdaterContext->spUpdaterBaseContext->spRocksDB};
+    spRocksDB = std::make_unique<Utils::RocksDBWrapper>(databasePath.string());
+    spRocksDB->createColumn(Components::Columns::LAST_SNAPSHOT_LINK);
+    spRocksDB->put("0", "localhost:4444/" + SNAPSHOT_FILE_NAME, Components::Columns::LAST_SNAPSHOT_LINK);
+
+    ASSERT_NO_THROW(CtiSnapshotDownloader(HTTPRequest::instance()).handleRequest(m_spUpdaterContext));
+
+    // The snapshot is unchanged, so no file should be downloaded nor published.
+    const auto contentPath {m_spUpdaterContext->spUpdaterBaseContext->downloadsFolder / SNAPSHOT_FILE_NAME};
+    constexpr auto EXPECTED_CURRENT_OFFSET {3};
+    nlohmann::json expectedData;
+    expectedData["paths"] = nlohmann::json::array();
+    expectedData["stageStatus"] = OK_STATUS;
+    expectedData["type"] = CONTENT_TYPE;
+    expectedData["offset"] = EXPECTED_CURRENT_OFFSET;
+
+    EXPECT_EQ(m_spUpdaterContext->data, expectedData);
+    EXPECT_FALSE(std::filesystem::exists(contentPath));
+
+    spRocksDB.reset();
+    std::filesystem::remove_all(databasePath);
+}
+
+/**
+ * @brief Tests that the downloaded snapshot link is persisted in the metadata database.
+ *
+ */
+TEST_F(CtiSnapshotDownloaderTest, SnapshotLinkPersistedAfterDownload)
+{
+    // Set up an empty metadata database.
+    const auto databasePath {std::filesystem::temp_directory_path() / "CtiSnapshotDownloaderTestDb"};
+    auto& spRocksDB {m_spUpdaterContext->spUpdaterBaseContext->spRocksDB};
+    spRocksDB = std::make_unique<Utils::RocksDBWrapper>(databasePath.string());
+    spRocksDB->createColumn(Components::Columns::LAST_SNAPSHOT_LINK);
+
+    ASSERT_NO_THROW(CtiSnapshotDownloader(HTTPRequest::instance()).handleRequest(m_spUpdaterContext));
+
+    // The snapshot should have been downloaded and its link persisted.
+    const auto contentPath {m_spUpdaterContext->spUpdaterBaseContext->downloadsFolder / SNAPSHOT_FILE_NAME};
+    EXPECT_TRUE(std::filesystem::exists(contentPath));
+    EXPECT_EQ(spRocksDB->getLastKeyValue(Components::Columns::LAST_SNAPSHOT_LINK).second.ToString(),
+              "localhost:4444/" + SNAPSHOT_FILE_NAME);
+
+    spRocksDB.reset();
+    std::filesystem::remove_all(databasePath);
+}
@@ -162,3 +162,27 @@ TEST_F(XZDecompressorTest, DecompressTwoFilesOneInexistantThrows)
 
     EXPECT_EQ(m_spUpdaterContext->data, expectedData);
 }
+
+/**
+ * @brief Tests the correct decompression of one file with an explicit thread count and memory limit.
+ *
+ */
+TEST_F(XZDecompressorTest, DecompressOneFileWithExplicitTuning)
+{
+    m_spUpdaterContext->data.at("paths").push_back(SAMPLE_A_INPUT_FILE);
+
+    constexpr uint32_t THREAD_COUNT {2};
+    constexpr uint64_t MEMORY_LIMIT {256ULL * 1024 * 1024};
+    ASSERT_NO_THROW(XZDecompressor(THREAD_COUNT, MEMORY_LIMIT).handleRequest(m_spUpdaterContext));
+
+    nlohmann::json expectedData;
+    expectedData["paths"] = nlohmann::json::array();
+    expectedData["paths"].push_back(SAMPLE_A_OUTPUT_FILE);
+    expectedData["stageStatus"] = nlohmann::json::array();
+    expectedData["stageStatus"].push_back(OK_STATUS);
+    expectedData["type"] = DEFAULT_TYPE;
+    expectedData["offset"] = 0;
+
+    EXPECT_EQ(m_spUpdaterContext->data, expectedData);
+    EXPECT_TRUE(std::filesystem::exists(SAMPLE_A_OUTPUT_FILE));
+}
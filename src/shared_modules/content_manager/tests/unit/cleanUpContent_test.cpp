@@ -11,6 +11,7 @@
 
 #include "cleanUpContent_test.hpp"
 #include <filesystem>
+#include <fstream>
 #include <memory>
 
 /*
@@ -42,3 +43,21 @@ TEST_F(CleanUpContentTest, OutputPathSet)
     EXPECT_TRUE(std::filesystem::is_empty(DOWNLOAD_DIR));
     EXPECT_FALSE(std::filesystem::is_empty(CONTENTS_DIR));
 }
+
+/*
+ * @brief Check that the cleanup progress metrics are pushed into the context.
+ */
+TEST_F(CleanUpContentTest, CleanupMetricsPushed)
+{
+    // Create a sharded layout: a subdirectory with a file, plus a loose top-level file
+    std::filesystem::create_directory(DOWNLOAD_DIR + "/shard");
+    std::ofstream(DOWNLOAD_DIR + "/shard/file") << "data";
+    std::ofstream(DOWNLOAD_DIR + "/loose") << "data";
+
+    EXPECT_NO_THROW(m_spCleanUpContent->handleRequest(m_spUpdaterContext));
+
+    EXPECT_TRUE(std::filesystem::is_empty(DOWNLOAD_DIR));
+    ASSERT_TRUE(m_spUpdaterContext->data.contains("cleanupMetrics"));
+    EXPECT_GE(m_spUpdaterContext->data.at("cleanupMetrics").at("deletedFiles").get<size_t>(), 2u);
+    EXPECT_TRUE(m_spUpdaterContext->data.at("cleanupMetrics").contains("elapsedMs"));
+}
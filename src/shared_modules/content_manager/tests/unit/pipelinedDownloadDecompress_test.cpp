@@ -0,0 +1,174 @@
+/*
+ * Wazuh content manager - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 28, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "pipelinedDownloadDecompress_test.hpp"
+#include "pipelinedDownloadDecompress.hpp"
+#include "updaterContext.hpp"
+#include "utils/chainOfResponsability.hpp"
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Fake download stage that produces a fixed list of paths, reporting each one through the per-file hook.
+ *
+ */
+class FakeDownloader final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
+{
+public:
+    std::vector<std::string> paths;   ///< Paths to produce.
+    bool useHook {true};              ///< Whether to report the files through the per-file hook.
+    std::shared_future<void> waitFor; ///< If valid, waited on after producing the first file.
+
+    /**
+     * @brief Produces the configured paths.
+     *
+     * @param context Updater context.
+     * @return std::shared_ptr<UpdaterContext> Next step on the chain.
+     */
+    std::shared_ptr<UpdaterContext> handleRequest(std::shared_ptr<UpdaterContext> context) override
+    {
+        auto first {true};
+        for (const auto& path : paths)
+        {
+            context->data.at("paths").push_back(path);
+            if (useHook)
+            {
+                context->onFileDownloaded(path);
+            }
+
+            if (first && waitFor.valid())
+            {
+                first = false;
+                if (std::future_status::ready != waitFor.wait_for(std::chrono::seconds(10)))
+                {
+                    throw std::runtime_error {"The first file was never decompressed"};
+                }
+            }
+        }
+
+        return AbstractHandler<std::shared_ptr<UpdaterContext>>::handleRequest(std::move(context));
+    }
+};
+
+/**
+ * @brief Fake decompression stage that appends a suffix to every path.
+ *
+ */
+class FakeDecompressor final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
+{
+public:
+    bool shouldFail {false};              ///< Whether to throw on every file.
+    std::shared_ptr<std::promise<void>> firstFilePromise; ///< If set, fulfilled on the first processed file.
+
+    /**
+     * @brief Transforms the context paths.
+     *
+     * @param context Updater context.
+     * @return std::shared_ptr<UpdaterContext> Next step on the chain.
+     */
+    std::shared_ptr<UpdaterContext> handleRequest(std::shared_ptr<UpdaterContext> context) override
+    {
+        if (shouldFail)
+        {
+            throw std::runtime_error {"Decompression failed"};
+        }
+
+        for (auto& path : context->data.at("paths"))
+        {
+            path = path.get<std::string>() + ".out";
+        }
+
+        if (firstFilePromise)
+        {
+            firstFilePromise->set_value();
+            firstFilePromise.reset();
+        }
+
+        return AbstractHandler<std::shared_ptr<UpdaterContext>>::handleRequest(std::move(context));
+    }
+};
+} // namespace
+
+/*
+ * @brief Tests that every downloaded file is decompressed, keeping the download order.
+ */
+TEST_F(PipelinedDownloadDecompressTest, PathsAreTransformedInOrder)
+{
+    auto spDownloader {std::make_shared<FakeDownloader>()};
+    spDownloader->paths = {"fileA.gz", "fileB.gz", "fileC.gz"};
+    auto spDecompressor {std::make_shared<FakeDecompressor>()};
+
+    PipelinedDownloadDecompress pipeline {spDownloader, spDecompressor};
+    ASSERT_NO_THROW(pipeline.handleRequest(m_spContext));
+
+    const auto expectedPaths = nlohmann::json::array({"fileA.gz.out", "fileB.gz.out", "fileC.gz.out"});
+    EXPECT_EQ(m_spContext->data.at("paths"), expectedPaths);
+    EXPECT_EQ(m_spContext->data.at("stageStatus").back().at("status"), "ok");
+}
+
+/*
+ * @brief Tests that files from a downloader without per-file notifications are still decompressed.
+ */
+TEST_F(PipelinedDownloadDecompressTest, DownloaderWithoutHook)
+{
+    auto spDownloader {std::make_shared<FakeDownloader>()};
+    spDownloader->paths = {"fileA.gz", "fileB.gz"};
+    spDownloader->useHook = false;
+    auto spDecompressor {std::make_shared<FakeDecompressor>()};
+
+    PipelinedDownloadDecompress pipeline {spDownloader, spDecompressor};
+    ASSERT_NO_THROW(pipeline.handleRequest(m_spContext));
+
+    const auto expectedPaths = nlohmann::json::array({"fileA.gz.out", "fileB.gz.out"});
+    EXPECT_EQ(m_spContext->data.at("paths"), expectedPaths);
+}
+
+/*
+ * @brief Tests that the first file is decompressed while the download is still in progress.
+ */
+TEST_F(PipelinedDownloadDecompressTest, StagesRunOverlapped)
+{
+    auto spFirstFilePromise {std::make_shared<std::promise<void>>()};
+
+    auto spDownloader {std::make_shared<FakeDownloader>()};
+    spDownloader->paths = {"fileA.gz", "fileB.gz"};
+    spDownloader->waitFor = spFirstFilePromise->get_future().share();
+    auto spDecompressor {std::make_shared<FakeDecompressor>()};
+    spDecompressor->firstFilePromise = spFirstFilePromise;
+
+    PipelinedDownloadDecompress pipeline {spDownloader, spDecompressor};
+    ASSERT_NO_THROW(pipeline.handleRequest(m_spContext));
+
+    const auto expectedPaths = nlohmann::json::array({"fileA.gz.out", "fileB.gz.out"});
+    EXPECT_EQ(m_spContext->data.at("paths"), expectedPaths);
+}
+
+/*
+ * @brief Tests that a decompression failure is propagated once the download finishes.
+ */
+TEST_F(PipelinedDownloadDecompressTest, DecompressionFailurePropagates)
+{
+    auto spDownloader {std::make_shared<FakeDownloader>()};
+    spDownloader->paths = {"fileA.gz", "fileB.gz"};
+    auto spDecompressor {std::make_shared<FakeDecompressor>()};
+    spDecompressor->shouldFail = true;
+
+    PipelinedDownloadDecompress pipeline {spDownloader, spDecompressor};
+    EXPECT_THROW(pipeline.handleRequest(m_spContext), std::runtime_error);
+
+    EXPECT_EQ(m_spContext->data.at("stageStatus").back().at("status"), "fail");
+}
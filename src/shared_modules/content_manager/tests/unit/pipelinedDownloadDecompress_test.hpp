@@ -0,0 +1,46 @@
+/*
+ * Wazuh content manager - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 28, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _PIPELINED_DOWNLOAD_DECOMPRESS_TEST_HPP
+#define _PIPELINED_DOWNLOAD_DECOMPRESS_TEST_HPP
+
+#include "conditionSync.hpp"
+#include "updaterContext.hpp"
+#include "gtest/gtest.h"
+#include <memory>
+
+/**
+ * @brief Runs unit tests for PipelinedDownloadDecompress
+ *
+ */
+class PipelinedDownloadDecompressTest : public ::testing::Test
+{
+protected:
+    PipelinedDownloadDecompressTest() = default;
+    ~PipelinedDownloadDecompressTest() override = default;
+
+    std::shared_ptr<UpdaterContext> m_spContext; ///< Context used on tests.
+    std::shared_ptr<ConditionSync> m_spStopActionCondition {
+        std::make_shared<ConditionSync>(false)}; ///< Stop condition wrapper.
+
+    /**
+     * @brief Sets initial conditions for each test case.
+     *
+     */
+    // cppcheck-suppress unusedFunction
+    void SetUp() override
+    {
+        m_spContext = std::make_shared<UpdaterContext>();
+        m_spContext->spUpdaterBaseContext = std::make_shared<UpdaterBaseContext>(m_spStopActionCondition);
+    }
+};
+
+#endif //_PIPELINED_DOWNLOAD_DECOMPRESS_TEST_HPP
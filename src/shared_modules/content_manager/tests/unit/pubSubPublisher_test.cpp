@@ -16,6 +16,7 @@
 #include <gmock/gmock.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 /*
  * @brief Tests the instantiation of the PubSubPublisher class
@@ -70,6 +71,43 @@ TEST_F(PubSubPublisherTest, TestPublishValidData)
     EXPECT_FALSE(m_spUpdaterContext->data.empty());
 }
 
+/*
+ * @brief Tests that the published payload matches the context data serialization.
+ */
+TEST_F(PubSubPublisherTest, TestPublishedPayloadMatchesContextData)
+{
+    auto mockRouterProvider {std::make_shared<MockRouterProvider>()};
+    std::vector<char> sentPayload;
+    EXPECT_CALL(*mockRouterProvider, start()).Times(1);
+    EXPECT_CALL(*mockRouterProvider, send(::testing::_)).WillOnce(::testing::SaveArg<0>(&sentPayload));
+    EXPECT_CALL(*mockRouterProvider, stop).Times(1);
+
+    m_spUpdaterBaseContext->spChannel = mockRouterProvider;
+    m_spUpdaterBaseContext->spChannel->start();
+
+    m_spUpdaterContext->spUpdaterBaseContext = m_spUpdaterBaseContext;
+    m_spUpdaterContext->data.at("paths").push_back("/dummy/path");
+
+    EXPECT_NO_THROW(m_spPubSubPublisher->handleRequest(m_spUpdaterContext));
+
+    m_spUpdaterBaseContext->spChannel->stop();
+
+    EXPECT_EQ(std::string(sentPayload.begin(), sentPayload.end()), m_spUpdaterContext->data.dump());
+}
+
+/*
+ * @brief Tests that extracting the data resets the context to its initial document.
+ */
+TEST_F(PubSubPublisherTest, TestExtractDataResetsTheContext)
+{
+    m_spUpdaterContext->data.at("paths").push_back("/dummy/path");
+
+    const auto extractedData {m_spUpdaterContext->extractData()};
+
+    EXPECT_EQ(extractedData.at("paths").size(), 1);
+    EXPECT_EQ(m_spUpdaterContext->data, R"({ "type": "raw", "offset": 0, "paths": [], "stageStatus": [] })"_json);
+}
+
 /*
  * @brief Tests publish valid data without start the MockRouterProvider.
  */
@@ -37,6 +37,12 @@ public:
      * @param value The corresponding value to be returned.
      */
     static void get(const std::string& columnFamily, const std::string& key, std::string& value);
+
+    /**
+     * Drop every cached decrypted value, forcing the next get() of each key to read and
+     * decrypt it from the database again.
+     */
+    static void invalidateCache();
 };
 
 #endif // _KEYSTORE_HPP
@@ -3,6 +3,8 @@
 #include "loggerHelper.h"
 #include "rocksDBWrapper.hpp"
 #include "rsaHelper.hpp"
+#include <map>
+#include <mutex>
 
 // Database constants, based on the keystore path.
 constexpr auto DATABASE_PATH {"queue/keystore"};
@@ -18,6 +20,12 @@ constexpr auto KS_NAME {"keystore"};
 constexpr auto KS_VERSION {"2"};
 constexpr auto KS_VERSION_FIELD {"version"};
 
+// In-process cache of decrypted values, keyed by column family and key. Repeated reads of the
+// same credential skip the database open and cipher setup; writes and invalidateCache() drop
+// the affected entries.
+static std::mutex g_cacheMutex;
+static std::map<std::pair<std::string, std::string>, std::string> g_decryptedCache;
+
 static void upgrade(Utils::RocksDBWrapper& keystoreDB, const std::string& columnFamily)
 {
     std::string versionValue;
@@ -100,6 +108,10 @@ void Keystore::put(const std::string& columnFamily, const std::string& key, cons
 
     // Insert the key-value pair using AES encryption.
     keystoreDB.put(key, rocksdb::Slice(encryptedValue.data(), encryptedValue.size()), columnFamily);
+
+    // Drop any cached value for this key, the next get() will decrypt the fresh one.
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+    g_decryptedCache.erase(std::make_pair(columnFamily, key));
 }
 
 /**
@@ -113,6 +125,15 @@ void Keystore::get(const std::string& columnFamily, const std::string& key, std:
 {
     std::string encryptedValue;
 
+    {
+        std::lock_guard<std::mutex> lock(g_cacheMutex);
+        if (const auto it = g_decryptedCache.find(std::make_pair(columnFamily, key)); it != g_decryptedCache.end())
+        {
+            value = it->second;
+            return;
+        }
+    }
+
     auto keystoreDB = Utils::RocksDBWrapper(DATABASE_PATH, false);
 
     if (!keystoreDB.columnExists(columnFamily))
@@ -128,5 +149,14 @@ void Keystore::get(const std::string& columnFamily, const std::string& key, std:
     {
         std::vector<char> encryptedValueVec(encryptedValue.begin(), encryptedValue.end());
         EVPHelper().decryptAES256(encryptedValueVec, value);
+
+        std::lock_guard<std::mutex> lock(g_cacheMutex);
+        g_decryptedCache[std::make_pair(columnFamily, key)] = value;
     }
 }
+
+void Keystore::invalidateCache()
+{
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+    g_decryptedCache.clear();
+}
@@ -91,6 +91,7 @@ void writeRSACertAndPk(const std::filesystem::path& certPath, const std::filesys
 TEST(KeyStoreComponentTest, TestPutGet)
 {
     std::filesystem::remove_all(DATABASE_PATH);
+    Keystore::invalidateCache();
 
     // Check that the keystore version is empty when the database is empty
     ASSERT_EQ(getKeystoreVersion(), "");
@@ -111,6 +112,7 @@ TEST(KeyStoreComponentTest, TestPutGet)
 TEST(KeyStoreComponentTest, TestUpgrade)
 {
     std::filesystem::remove_all(DATABASE_PATH);
+    Keystore::invalidateCache();
 
     // Create a new RSA key pair using the path specified in the Keystore class.
     std::filesystem::remove("etc/sslmanager.key");
@@ -138,6 +140,7 @@ TEST(KeyStoreComponentTest, TestUpgrade)
 TEST(KeyStoreComponentTest, TestUpgradeFail)
 {
     std::filesystem::remove_all(DATABASE_PATH);
+    Keystore::invalidateCache();
     Utils::RocksDBWrapper(DATABASE_PATH, false).put("key1", "rawrawraw", "default");
 
     // Check if in the case of an invalid value the keystore is upgraded and the values are deleted
@@ -160,6 +163,7 @@ TEST(KeyStoreComponentTest, TestUpgradeFail)
 TEST(KeyStoreComponentTest, TestUpgradeFailWithInvalidCerts)
 {
     std::filesystem::remove_all(DATABASE_PATH);
+    Keystore::invalidateCache();
     // Create a new RSA key pair using the path specified in the Keystore class.
     std::filesystem::remove("etc/sslmanager.key");
     std::filesystem::remove("etc/sslmanager.cert");
@@ -198,3 +202,27 @@ TEST(KeyStoreComponentTest, TestUpgradeFailWithInvalidCerts)
     Keystore::get("default", "key2", out);
     ASSERT_EQ(out, "value2");
 }
+
+TEST(KeyStoreComponentTest, TestGetCachesDecryptedValue)
+{
+    std::filesystem::remove_all(DATABASE_PATH);
+    Keystore::invalidateCache();
+
+    Keystore::put("default", "key1", "value1");
+
+    // Prime the cache, then remove the database behind the keystore's back: the cached
+    // value is still served until the cache is explicitly invalidated.
+    std::string out;
+    Keystore::get("default", "key1", out);
+    ASSERT_EQ(out, "value1");
+
+    std::filesystem::remove_all(DATABASE_PATH);
+    out = "";
+    Keystore::get("default", "key1", out);
+    ASSERT_EQ(out, "value1");
+
+    Keystore::invalidateCache();
+    out = "";
+    Keystore::get("default", "key1", out);
+    ASSERT_EQ(out, "");
+}
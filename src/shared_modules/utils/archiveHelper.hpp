@@ -17,7 +17,13 @@
 #include "customDeleter.hpp"
 #include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <mutex>
+#include <thread>
+#include <utility>
 #include <vector>
 
 template<typename F, typename G, F func1, G func2>
@@ -38,6 +44,8 @@ using ArchiveReadPtr = std::unique_ptr<
 using ArchiveWritePtr = std::unique_ptr<
     struct archive,
     Deleter<decltype(&archive_write_close), decltype(&archive_write_free), archive_write_close, archive_write_free>>;
+using ArchiveEntryPtr =
+    std::unique_ptr<struct archive_entry, CustomDeleter<decltype(&archive_entry_free), archive_entry_free>>;
 
 namespace Utils
 {
@@ -48,8 +56,90 @@ namespace Utils
     class ArchiveHelper
     {
     private:
+        /**
+         * @brief Write-side operation handed from the reading thread to the disk writer thread.
+         *
+         */
+        struct WriteCommand
+        {
+            enum class Type
+            {
+                HEADER,
+                DATA,
+                FINISH_ENTRY
+            };
+
+            Type type {Type::FINISH_ENTRY}; ///< Operation to perform.
+            ArchiveEntryPtr entry;          ///< Owned entry clone, for HEADER commands.
+            std::vector<char> data;         ///< Decompressed data block, for DATA commands.
+            int64_t offset {0};             ///< Offset of the data block within the output file.
+        };
+
+        /**
+         * @brief Queue of write commands bounded by the amount of buffered bytes, so the reading thread can run
+         * ahead of the disk writes without memory usage growing with the archive size.
+         *
+         */
+        class BoundedCommandQueue
+        {
+        public:
+            explicit BoundedCommandQueue(const size_t maxBytes)
+                : m_maxBytes {maxBytes}
+            {
+            }
+
+            void push(WriteCommand&& command)
+            {
+                std::unique_lock<std::mutex> lock {m_mutex};
+                m_notFull.wait(lock, [this]() { return m_bytes < m_maxBytes || m_closed; });
+
+                if (m_closed)
+                {
+                    return;
+                }
+
+                m_bytes += command.data.size();
+                m_commands.push_back(std::move(command));
+                m_notEmpty.notify_one();
+            }
+
+            bool pop(WriteCommand& command)
+            {
+                std::unique_lock<std::mutex> lock {m_mutex};
+                m_notEmpty.wait(lock, [this]() { return !m_commands.empty() || m_closed; });
+
+                if (m_commands.empty())
+                {
+                    return false;
+                }
+
+                command = std::move(m_commands.front());
+                m_commands.pop_front();
+                m_bytes -= command.data.size();
+                m_notFull.notify_one();
+                return true;
+            }
+
+            void close()
+            {
+                std::lock_guard<std::mutex> lock {m_mutex};
+                m_closed = true;
+                m_notEmpty.notify_all();
+                m_notFull.notify_all();
+            }
+
+        private:
+            std::mutex m_mutex;
+            std::condition_variable m_notFull;
+            std::condition_variable m_notEmpty;
+            std::deque<WriteCommand> m_commands;
+            size_t m_bytes {0};
+            const size_t m_maxBytes;
+            bool m_closed {false};
+        };
+
         static void
-        copyData(struct archive* archiveRead, struct archive* archiveWrite, const std::atomic<bool>& forceStop)
+        readEntryData(struct archive* archiveRead, BoundedCommandQueue& queue, const std::atomic<bool>& forceStop)
         {
             const void* buff {};
             size_t size {};
@@ -69,10 +159,11 @@ namespace Utils
                     throw std::runtime_error("Error reading file during data copy. Error: " + errMsg);
                 }
 
-                if (archive_write_data_block(archiveWrite, buff, size, offset) != ARCHIVE_OK)
-                {
-                    throw std::runtime_error(archive_error_string(archiveWrite));
-                }
+                WriteCommand command;
+                command.type = WriteCommand::Type::DATA;
+                command.data.assign(static_cast<const char*>(buff), static_cast<const char*>(buff) + size);
+                command.offset = offset;
+                queue.push(std::move(command));
             }
         }
 
@@ -85,6 +176,11 @@ namespace Utils
         /**
          * @brief Uncompress TAR file.
          *
+         * @details The archive is a sequential stream, so entries are decompressed in order by the calling
+         * thread while a dedicated writer thread performs the disk writes, overlapping decompression with
+         * output I/O. The data in flight between both threads is bounded, keeping memory usage independent
+         * of the archive size.
+         *
          * @param filename Compressed (.tar) file name.
          * @param outputDir Destination path.
          * @param extractOnly Compressed element to extract.
@@ -117,48 +213,116 @@ namespace Utils
                 throw std::runtime_error("Error opening file during decompression. Error: " + errMsg);
             }
 
-            while (!forceStop.load())
-            {
-                retVal = archive_read_next_header(archiveRead.get(), &entry);
-                if (retVal == ARCHIVE_EOF)
-                {
-                    return;
-                }
+            // Amount of decompressed bytes allowed in flight between the reading and the writing thread.
+            constexpr size_t QUEUE_MAX_BYTES {8 * 1024 * 1024};
+            BoundedCommandQueue queue {QUEUE_MAX_BYTES};
+            std::exception_ptr writerError;
+            std::atomic<bool> writerFailed {false};
 
-                if (retVal != ARCHIVE_OK)
+            // Writer thread. Owns the disk-write archive handle and applies the commands in read order.
+            std::thread writerThread {
+                [&queue, &writerError, &writerFailed, &archiveWrite]()
                 {
-                    const std::string errMsg = archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
-                    throw std::runtime_error("Error reading next header during decompression. Error: " + errMsg);
-                }
+                    WriteCommand command;
+                    while (queue.pop(command))
+                    {
+                        try
+                        {
+                            if (WriteCommand::Type::HEADER == command.type)
+                            {
+                                if (archive_write_header(archiveWrite.get(), command.entry.get()) != ARCHIVE_OK)
+                                {
+                                    throw std::runtime_error(archive_error_string(archiveWrite.get()));
+                                }
+                            }
+                            else if (WriteCommand::Type::DATA == command.type)
+                            {
+                                if (archive_write_data_block(
+                                        archiveWrite.get(), command.data.data(), command.data.size(), command.offset) !=
+                                    ARCHIVE_OK)
+                                {
+                                    throw std::runtime_error(archive_error_string(archiveWrite.get()));
+                                }
+                            }
+                            else
+                            {
+                                if (archive_write_finish_entry(archiveWrite.get()) != ARCHIVE_OK)
+                                {
+                                    throw std::runtime_error(archive_error_string(archiveWrite.get()));
+                                }
+                            }
+                        }
+                        catch (...)
+                        {
+                            writerError = std::current_exception();
+                            writerFailed = true;
+                            queue.close();
 
-                std::filesystem::path outputDirPath(std::filesystem::current_path() / outputDir /
-                                                    archive_entry_pathname(entry));
-
-                if (std::find_if(extractOnly.cbegin(),
-                                 extractOnly.cend(),
-                                 [&outputDirPath](const std::string& path)
-                                 {
-                                     size_t pos = outputDirPath.string().find(path);
-                                     return pos != std::string::npos;
-                                 }) != extractOnly.cend() ||
-                    extractOnly.empty())
-                {
-                    archive_entry_set_pathname(entry, outputDirPath.c_str());
-                    content.emplace_back(outputDirPath);
+                            // Drain pending commands so the reading thread never blocks on a full queue.
+                            while (queue.pop(command)) {}
+                            return;
+                        }
+                    }
+                }};
 
-                    if (archive_write_header(archiveWrite.get(), entry) != ARCHIVE_OK)
+            try
+            {
+                while (!forceStop.load() && !writerFailed.load())
+                {
+                    retVal = archive_read_next_header(archiveRead.get(), &entry);
+                    if (retVal == ARCHIVE_EOF)
                     {
-                        throw std::runtime_error(archive_error_string(archiveWrite.get()));
+                        break;
                     }
 
-                    copyData(archiveRead.get(), archiveWrite.get(), forceStop);
-                    retVal = archive_write_finish_entry(archiveWrite.get());
                     if (retVal != ARCHIVE_OK)
                     {
-                        throw std::runtime_error(archive_error_string(archiveWrite.get()));
+                        const std::string errMsg = archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+                        throw std::runtime_error("Error reading next header during decompression. Error: " + errMsg);
+                    }
+
+                    std::filesystem::path outputDirPath(std::filesystem::current_path() / outputDir /
+                                                        archive_entry_pathname(entry));
+
+                    if (std::find_if(extractOnly.cbegin(),
+                                     extractOnly.cend(),
+                                     [&outputDirPath](const std::string& path)
+                                     {
+                                         size_t pos = outputDirPath.string().find(path);
+                                         return pos != std::string::npos;
+                                     }) != extractOnly.cend() ||
+                        extractOnly.empty())
+                    {
+                        archive_entry_set_pathname(entry, outputDirPath.c_str());
+                        content.emplace_back(outputDirPath);
+
+                        WriteCommand headerCommand;
+                        headerCommand.type = WriteCommand::Type::HEADER;
+                        headerCommand.entry = ArchiveEntryPtr {archive_entry_clone(entry)};
+                        queue.push(std::move(headerCommand));
+
+                        readEntryData(archiveRead.get(), queue, forceStop);
+
+                        WriteCommand finishCommand;
+                        finishCommand.type = WriteCommand::Type::FINISH_ENTRY;
+                        queue.push(std::move(finishCommand));
                     }
                 }
             }
+            catch (...)
+            {
+                queue.close();
+                writerThread.join();
+                throw;
+            }
+
+            queue.close();
+            writerThread.join();
+
+            if (writerError)
+            {
+                std::rethrow_exception(writerError);
+            }
 
             if (forceStop.load())
             {
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""Compare two google-benchmark JSON reports and fail on regressions.
+
+Record a baseline on a quiet reference machine:
+
+    ./utils_benchmark_test --benchmark_out=baseline.json --benchmark_out_format=json
+
+Run the suite again after a change and compare against the baseline:
+
+    ./utils_benchmark_test --benchmark_out=current.json --benchmark_out_format=json
+    ./compare_benchmarks.py baseline.json current.json --threshold 10
+
+The script exits with a non-zero status when any benchmark's cpu_time is more
+than the threshold percentage slower than the baseline, so it can gate a CI
+job. Benchmarks present in only one of the reports are listed but do not fail
+the comparison.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_benchmarks(path):
+    with open(path) as handle:
+        report = json.load(handle)
+    benchmarks = {}
+    for entry in report.get('benchmarks', []):
+        # Skip aggregate rows (mean/median/stddev) when repetitions are used
+        if entry.get('run_type') == 'aggregate':
+            continue
+        benchmarks[entry['name']] = entry
+    return benchmarks
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Fail when a benchmark regresses beyond a percentage threshold.')
+    parser.add_argument('baseline', help='Baseline JSON report')
+    parser.add_argument('current', help='Current JSON report')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='Allowed cpu_time regression in percent (default: 10)')
+    args = parser.parse_args()
+
+    baseline = load_benchmarks(args.baseline)
+    current = load_benchmarks(args.current)
+
+    regressions = []
+    for name, entry in sorted(current.items()):
+        base = baseline.get(name)
+        if base is None:
+            print(f'NEW      {name} (not in baseline)')
+            continue
+        base_time = base['cpu_time']
+        cur_time = entry['cpu_time']
+        delta = (cur_time - base_time) / base_time * 100.0 if base_time else 0.0
+        status = 'OK'
+        if delta > args.threshold:
+            status = 'REGRESSED'
+            regressions.append((name, delta))
+        print(f'{status:9}{name}: {base_time:.1f} -> {cur_time:.1f} '
+              f"{base['time_unit']} ({delta:+.1f}%)")
+
+    for name in sorted(set(baseline) - set(current)):
+        print(f'MISSING  {name} (not in current run)')
+
+    if regressions:
+        print(f'\n{len(regressions)} benchmark(s) regressed beyond '
+              f'{args.threshold:.1f}%:', file=sys.stderr)
+        for name, delta in regressions:
+            print(f'  {name}: {delta:+.1f}%', file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include "hashHelper.h"
+
+static void sha1Benchmark(benchmark::State& state)
+{
+    const std::string data(static_cast<size_t>(state.range(0)), 'x');
+    for (auto _ : state)
+    {
+        Utils::HashData hash(Utils::HashType::Sha1);
+        hash.update(data.data(), data.size());
+        benchmark::DoNotOptimize(hash.hash());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(sha1Benchmark)->Arg(64)->Arg(1024)->Arg(65536);
+
+static void sha256Benchmark(benchmark::State& state)
+{
+    const std::string data(static_cast<size_t>(state.range(0)), 'x');
+    for (auto _ : state)
+    {
+        Utils::HashData hash(Utils::HashType::Sha256);
+        hash.update(data.data(), data.size());
+        benchmark::DoNotOptimize(hash.hash());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(sha256Benchmark)->Arg(64)->Arg(1024)->Arg(65536);
+
+static void sha1BatchBenchmark(benchmark::State& state)
+{
+    // Many small buffers hashed with one reused context, the checksum sweep shape
+    const std::string data(64, 'x');
+    std::vector<std::pair<const void*, size_t>> buffers(1000, {data.data(), data.size()});
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Utils::hashBatch(buffers, Utils::HashType::Sha1));
+    }
+    state.SetItemsProcessed(state.iterations() * buffers.size());
+}
+
+BENCHMARK(sha1BatchBenchmark);
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include "rocksDBWrapper.hpp"
+
+constexpr auto TEST_WRAPPER_DB = "wrapper_test.db";
+constexpr auto PRELOADED_KEYS = 100000;
+
+// Composite keys shaped like the inventory ones the scanner stores: a zero padded
+// agent id followed by a package name and version.
+static std::string inventoryKey(const size_t index)
+{
+    auto agent = std::to_string(index % 1000);
+    return "agent_" + std::string(6 - agent.size(), '0') + agent + "_package_lib" + std::to_string(index % 100) + "-1."
+           + std::to_string(index % 10) + ".0";
+}
+
+static std::string inventoryValue(const size_t index)
+{
+    return R"({"name":"lib)" + std::to_string(index % 100) + R"(","version":"1.)" + std::to_string(index % 10)
+           + R"(.0","architecture":"x86_64","format":"deb","location":"/var/lib/dpkg/status"})";
+}
+
+static void wrapperPutBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_WRAPPER_DB, ec);
+
+    Utils::RocksDBWrapper wrapper(TEST_WRAPPER_DB);
+    size_t index = 0;
+    for (auto _ : state)
+    {
+        wrapper.put(inventoryKey(index), inventoryValue(index));
+        ++index;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(wrapperPutBenchmark);
+
+static void wrapperGetBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_WRAPPER_DB, ec);
+
+    Utils::RocksDBWrapper wrapper(TEST_WRAPPER_DB);
+    for (size_t i = 0; i < PRELOADED_KEYS; ++i)
+    {
+        wrapper.put(inventoryKey(i), inventoryValue(i));
+    }
+
+    size_t index = 0;
+    std::string value;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(wrapper.get(inventoryKey(index % PRELOADED_KEYS), value));
+        ++index;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(wrapperGetBenchmark);
+
+static void wrapperSeekBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_WRAPPER_DB, ec);
+
+    Utils::RocksDBWrapper wrapper(TEST_WRAPPER_DB);
+    for (size_t i = 0; i < PRELOADED_KEYS; ++i)
+    {
+        wrapper.put(inventoryKey(i), inventoryValue(i));
+    }
+
+    // Iterate the packages of one agent per iteration, the usual scan unit
+    size_t agent = 0;
+    for (auto _ : state)
+    {
+        auto id = std::to_string(agent % 1000);
+        size_t visited = 0;
+        for ([[maybe_unused]] const auto& [key, value] :
+             wrapper.seek("agent_" + std::string(6 - id.size(), '0') + id))
+        {
+            ++visited;
+        }
+        benchmark::DoNotOptimize(visited);
+        ++agent;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(wrapperSeekBenchmark);
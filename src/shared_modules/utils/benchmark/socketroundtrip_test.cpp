@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include "socketClient.hpp"
+#include "socketServer.hpp"
+
+constexpr auto TEST_SOCKET = "/tmp/utils_benchmark_echo.sock";
+
+static void socketRoundTripBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove(TEST_SOCKET, ec);
+
+    // Echo server, every received message is sent back on the same connection
+    SocketServer<Socket<OSPrimitives>, EpollWrapper> server {TEST_SOCKET};
+    server.listen(
+        [&server](const int fd, const char* data, uint32_t size, const char*, uint32_t)
+        {
+            server.send(fd, data, size);
+        });
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool replied = false;
+    SocketClient<Socket<OSPrimitives>, EpollWrapper> client {TEST_SOCKET};
+    client.connect(
+        [&](const char*, uint32_t, const char*, uint32_t)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            replied = true;
+            cv.notify_one();
+        });
+
+    const std::string message(static_cast<size_t>(state.range(0)), 'x');
+    for (auto _ : state)
+    {
+        client.send(message.c_str(), message.size());
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&replied]() { return replied; });
+        replied = false;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(socketRoundTripBenchmark)->Arg(64)->Arg(4096)->Unit(benchmark::kMicrosecond);
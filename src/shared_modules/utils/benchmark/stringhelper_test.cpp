@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include "stringHelper.h"
+
+static void splitBenchmark(benchmark::State& state)
+{
+    // A colon separated line shaped like the agent key entries
+    const std::string line {"001:agent_name:any:6f87ebd1a5e9e0a2a3c5b4d7e8f90123:deb:x86_64:1.2.3"};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Utils::split(line, ':'));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(splitBenchmark);
+
+static void splitLongLineBenchmark(benchmark::State& state)
+{
+    std::string line;
+    for (int i = 0; i < 100; ++i)
+    {
+        line += "field" + std::to_string(i) + "|";
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Utils::split(line, '|'));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(splitLongLineBenchmark);
+
+static void replaceAllBenchmark(benchmark::State& state)
+{
+    const std::string original {"/var/ossec/queue/../queue/fim/../fim/db/../db/fim.db"};
+    for (auto _ : state)
+    {
+        auto data = original;
+        benchmark::DoNotOptimize(Utils::replaceAll(data, "../", ""));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(replaceAllBenchmark);
+
+static void replaceAllNoMatchBenchmark(benchmark::State& state)
+{
+    const std::string original {"/var/ossec/queue/fim/db/fim.db"};
+    for (auto _ : state)
+    {
+        auto data = original;
+        benchmark::DoNotOptimize(Utils::replaceAll(data, "../", ""));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(replaceAllNoMatchBenchmark);
@@ -0,0 +1,78 @@
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <thread>
+#include <vector>
+#include "threadDispatcher.h"
+
+constexpr auto ITEMS_PER_PRODUCER = 10000;
+
+static void dispatcherPushBenchmark(benchmark::State& state)
+{
+    const auto producers = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::atomic<size_t> processed {0};
+        Utils::AsyncDispatcher<int, std::function<void(int)>> dispatcher {
+            [&processed](int) { processed++; }};
+
+        std::vector<std::thread> threads;
+        threads.reserve(producers);
+        for (size_t p = 0; p < producers; ++p)
+        {
+            threads.emplace_back(
+                [&dispatcher]()
+                {
+                    for (int i = 0; i < ITEMS_PER_PRODUCER; ++i)
+                    {
+                        dispatcher.push(i);
+                    }
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        dispatcher.rundown();
+        benchmark::DoNotOptimize(processed.load());
+    }
+    state.SetItemsProcessed(state.iterations() * producers * ITEMS_PER_PRODUCER);
+}
+
+BENCHMARK(dispatcherPushBenchmark)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond);
+
+static void dispatcherBoundedQueueBenchmark(benchmark::State& state)
+{
+    const auto producers = static_cast<size_t>(state.range(0));
+    constexpr auto MAX_QUEUE_SIZE = 4096ull;
+
+    for (auto _ : state)
+    {
+        std::atomic<size_t> processed {0};
+        Utils::AsyncDispatcher<int, std::function<void(int)>> dispatcher {
+            [&processed](int) { processed++; }, std::thread::hardware_concurrency(), MAX_QUEUE_SIZE};
+
+        std::vector<std::thread> threads;
+        threads.reserve(producers);
+        for (size_t p = 0; p < producers; ++p)
+        {
+            threads.emplace_back(
+                [&dispatcher]()
+                {
+                    for (int i = 0; i < ITEMS_PER_PRODUCER; ++i)
+                    {
+                        dispatcher.push(i);
+                    }
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        dispatcher.rundown();
+        benchmark::DoNotOptimize(processed.load());
+    }
+    state.SetItemsProcessed(state.iterations() * producers * ITEMS_PER_PRODUCER);
+}
+
+BENCHMARK(dispatcherBoundedQueueBenchmark)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
@@ -12,9 +12,15 @@
 #ifndef _CACHELRU_HPP
 #define _CACHELRU_HPP
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <optional>
+#include <shared_mutex>
+#include <vector>
 
 /**
  * @brief A class for implementing a Least Recently Used (LRU) Cache.
@@ -135,6 +141,19 @@ public:
         }
     }
 
+    /**
+     * @brief Removes a key-value pair from the cache, if present.
+     *
+     * @param key The key to be removed.
+     */
+    void removeKey(const KeyType& key)
+    {
+        if (m_map.erase(key) > 0)
+        {
+            m_list.remove(key);
+        }
+    }
+
     /**
      * @brief Clears the cache by removing all key-value pairs.
      */
@@ -161,4 +180,244 @@ private:
     }
 };
 
+/**
+ * @brief A sharded Least Recently Used (LRU) Cache with per-shard locking and optional TTL expiry.
+ *
+ * The cache is split into N independent LRUCache segments, each guarded by its own lock. Keys are
+ * distributed across the segments by hash, so concurrent accesses to different keys usually hit
+ * different shards and don't contend on a single lock. The API mirrors LRUCache, but all the methods
+ * are safe to call concurrently; eviction is per shard, so the LRU order is approximate across the
+ * whole cache. When a TTL is configured, entries older than it behave as misses and are dropped on
+ * access, so entries for keys that stop being queried no longer pin memory beyond LRU eviction.
+ *
+ * @tparam KeyType The type of the keys used for caching. It must be hashable with std::hash.
+ * @tparam ValueType The type of the values associated with the keys.
+ */
+template<typename KeyType, typename ValueType>
+class ShardedLRUCache final
+{
+public:
+    /**
+     * @brief Constructor to initialize a ShardedLRUCache with a specified capacity.
+     *
+     * @param capacity The maximum number of key-value pairs the cache can hold, split evenly across the shards.
+     * @param shardCount The number of independent segments. Each shard holds at least one entry.
+     * @param ttl Time after insertion during which an entry is valid. Zero (the default) disables expiry.
+     */
+    explicit ShardedLRUCache(const size_t capacity,
+                             const size_t shardCount = DEFAULT_SHARD_COUNT,
+                             const std::chrono::milliseconds ttl = std::chrono::milliseconds::zero())
+        : m_ttl {ttl}
+    {
+        const auto totalShards {shardCount ? shardCount : 1};
+        const auto shardCapacity {std::max<size_t>(1, capacity / totalShards)};
+
+        m_shards.reserve(totalShards);
+        for (size_t i = 0; i < totalShards; ++i)
+        {
+            m_shards.push_back(std::make_unique<Shard>(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Inserts a key-value pair into the cache.
+     *
+     * If the target shard is full, its least recently used item is removed to make space for the new pair.
+     *
+     * @param key The key to be inserted.
+     * @param value The value associated with the key.
+     */
+    void insertKey(const KeyType& key, const ValueType& value)
+    {
+        auto& shard {shardFor(key)};
+        std::unique_lock lock {shard.mutex};
+        shard.cache.insertKey(key, TimedEntry {value, std::chrono::steady_clock::now()});
+    }
+
+    /**
+     * @brief Retrieves the value associated with a key, marking it as the most recently used of its shard.
+     *
+     * @param key The key for which to retrieve the value.
+     * @return The value associated with the key or an empty optional if the key is not found.
+     */
+    std::optional<ValueType> getValue(const KeyType& key)
+    {
+        auto& shard {shardFor(key)};
+        std::unique_lock lock {shard.mutex};
+        auto entry {shard.cache.getValue(key)};
+
+        if (!entry)
+        {
+            return {};
+        }
+
+        if (isExpired(*entry))
+        {
+            shard.cache.removeKey(key);
+            return {};
+        }
+
+        return entry->value;
+    }
+
+    /**
+     * @brief Checks if the cache is full.
+     *
+     * @return true if every shard is full, false otherwise.
+     */
+    bool isFull() const
+    {
+        for (const auto& spShard : m_shards)
+        {
+            std::shared_lock lock {spShard->mutex};
+            if (!spShard->cache.isFull())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks if a key exists in the cache.
+     *
+     * @param key The key to be checked.
+     * @return true if the key exists in the cache, false otherwise.
+     */
+    bool isHit(const KeyType& key) const
+    {
+        const auto& shard {shardFor(key)};
+        std::shared_lock lock {shard.mutex};
+
+        auto hit {false};
+        shard.cache.forEach(
+            [&](const KeyType& entryKey, const TimedEntry& entry)
+            {
+                if (entryKey == key)
+                {
+                    hit = !isExpired(entry);
+                    return false;
+                }
+                return true;
+            });
+
+        return hit;
+    }
+
+    /**
+     * @brief Iterates over the cache data and applies a function to each key-value pair.
+     *
+     * Shards are visited one at a time while holding their lock, so the handler must not call back into
+     * the cache. The iteration stops if the handler function returns false.
+     *
+     * @tparam Handler The type of the handler function. It should be callable with (const KeyType&, const ValueType&).
+     * @param handler The function to be applied to each key-value pair. It should return a boolean value.
+     *                If the handler returns false, the iteration stops.
+     */
+    template<typename Handler>
+    void forEach(Handler&& handler) const
+    {
+        auto keepIterating {true};
+        for (const auto& spShard : m_shards)
+        {
+            std::shared_lock lock {spShard->mutex};
+            spShard->cache.forEach(
+                [&](const KeyType& key, const TimedEntry& entry)
+                {
+                    if (!isExpired(entry))
+                    {
+                        keepIterating = handler(key, entry.value);
+                    }
+                    return keepIterating;
+                });
+
+            if (!keepIterating)
+            {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Clears the cache by removing all key-value pairs.
+     */
+    void clear() noexcept
+    {
+        for (const auto& spShard : m_shards)
+        {
+            std::unique_lock lock {spShard->mutex};
+            spShard->cache.clear();
+        }
+    }
+
+private:
+    static constexpr size_t DEFAULT_SHARD_COUNT {16}; ///< Default number of independent segments.
+
+    /**
+     * @brief A cached value together with its insertion time.
+     */
+    struct TimedEntry final
+    {
+        ValueType value;                                 ///< Cached value.
+        std::chrono::steady_clock::time_point insertion; ///< Time of insertion, to evaluate the TTL.
+    };
+
+    /**
+     * @brief An independent cache segment with its own lock.
+     */
+    struct Shard final
+    {
+        /**
+         * @brief Constructor.
+         *
+         * @param capacity The maximum number of key-value pairs the shard can hold.
+         */
+        explicit Shard(const size_t capacity)
+            : cache(capacity)
+        {
+        }
+
+        LRUCache<KeyType, TimedEntry> cache; ///< Shard data.
+        mutable std::shared_mutex mutex;     ///< Shard lock.
+    };
+
+    std::vector<std::unique_ptr<Shard>> m_shards;                       ///< Independent cache segments.
+    const std::chrono::milliseconds m_ttl {std::chrono::milliseconds::zero()}; ///< Entry time to live. Zero disables
+                                                                               ///< expiry.
+
+    /**
+     * @brief Checks whether an entry has outlived the configured TTL.
+     *
+     * @param entry The entry to be checked.
+     * @return true if expiry is enabled and the entry is older than the TTL.
+     */
+    bool isExpired(const TimedEntry& entry) const
+    {
+        return m_ttl != std::chrono::milliseconds::zero()
+               && std::chrono::steady_clock::now() - entry.insertion > m_ttl;
+    }
+
+    /**
+     * @brief Returns the shard that owns a key, based on its hash.
+     *
+     * @param key The key to be mapped.
+     * @return Shard& The shard that owns the key.
+     */
+    Shard& shardFor(const KeyType& key)
+    {
+        return *m_shards[std::hash<KeyType> {}(key) % m_shards.size()];
+    }
+
+    /**
+     * @brief Returns the shard that owns a key, based on its hash.
+     *
+     * @param key The key to be mapped.
+     * @return const Shard& The shard that owns the key.
+     */
+    const Shard& shardFor(const KeyType& key) const
+    {
+        return *m_shards[std::hash<KeyType> {}(key) % m_shards.size()];
+    }
+};
+
 #endif // CACHELRU_HPP
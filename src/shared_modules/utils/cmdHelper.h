@@ -15,7 +15,17 @@
 #include <string>
 #include <iostream>
 #include <cstdio>
+#include <functional>
 #include <memory>
+#include <vector>
+
+#ifndef WIN32
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+#endif
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
@@ -29,24 +39,92 @@ namespace Utils
             pclose(file);
         }
     };
-    static std::string exec(const std::string& cmd, const size_t bufferSize = 128)
+
+#ifdef WIN32
+    static void execStream(const std::string& cmd,
+                           const std::function<void(const char*, size_t)>& callback,
+                           const size_t bufferSize = 4096)
     {
         const std::unique_ptr<FILE, FileSmartDeleter> file{popen(cmd.c_str(), "r")};
-        char buffer[bufferSize];
-        std::string result;
+        std::vector<char> buffer(bufferSize);
 
         if (file)
         {
-            while (fgets(buffer, bufferSize, file.get()))
+            size_t bytesRead;
+
+            while ((bytesRead = fread(buffer.data(), 1, buffer.size(), file.get())) > 0)
+            {
+                callback(buffer.data(), bytesRead);
+            }
+        }
+    }
+#else
+    // posix_spawn avoids fork's page-table copy, which stalls large-RSS processes. The output
+    // is handed to the callback chunk by chunk instead of being buffered whole.
+    static void execStream(const std::string& cmd,
+                           const std::function<void(const char*, size_t)>& callback,
+                           const size_t bufferSize = 4096)
+    {
+        int pipeFds[2];
+
+        if (pipe(pipeFds) != 0)
+        {
+            return;
+        }
+
+        posix_spawn_file_actions_t fileActions;
+        posix_spawn_file_actions_init(&fileActions);
+        posix_spawn_file_actions_adddup2(&fileActions, pipeFds[1], STDOUT_FILENO);
+        posix_spawn_file_actions_addclose(&fileActions, pipeFds[0]);
+        posix_spawn_file_actions_addclose(&fileActions, pipeFds[1]);
+
+        posix_spawnattr_t attributes;
+        posix_spawnattr_init(&attributes);
+#ifdef POSIX_SPAWN_USEVFORK
+        posix_spawnattr_setflags(&attributes, POSIX_SPAWN_USEVFORK);
+#endif
+
+        const char* argv[] = {"sh", "-c", cmd.c_str(), nullptr};
+        pid_t pid;
+        const auto spawnResult
+        {
+            posix_spawn(&pid, "/bin/sh", &fileActions, &attributes, const_cast<char* const*>(argv), environ)
+        };
+
+        posix_spawnattr_destroy(&attributes);
+        posix_spawn_file_actions_destroy(&fileActions);
+        close(pipeFds[1]);
+
+        if (spawnResult == 0)
+        {
+            std::vector<char> buffer(bufferSize);
+            ssize_t bytesRead;
+
+            while ((bytesRead = read(pipeFds[0], buffer.data(), buffer.size())) > 0)
             {
-                result += buffer;
+                callback(buffer.data(), static_cast<size_t>(bytesRead));
             }
+
+            waitpid(pid, nullptr, 0);
         }
 
+        close(pipeFds[0]);
+    }
+#endif
+
+    static std::string exec(const std::string& cmd, const size_t bufferSize = 128)
+    {
+        std::string result;
+        execStream(cmd,
+                   [&result](const char* data, size_t size)
+        {
+            result.append(data, size);
+        }, bufferSize);
+
         return result;
     }
 }
 
 #pragma GCC diagnostic pop
 
-#endif // _CMD_HELPER_H
\ No newline at end of file
+#endif // _CMD_HELPER_H
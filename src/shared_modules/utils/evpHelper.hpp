@@ -12,7 +12,6 @@
 #ifndef _EVPHELPER_HPP
 #define _EVPHELPER_HPP
 
-#include "defer.hpp"
 #include <array>
 #include <opensslPrimitives.hpp>
 #include <stdexcept>
@@ -27,8 +26,21 @@ template<typename T = OpenSSLPrimitives>
 class EVPHelper final : public T
 {
 public:
-    explicit EVPHelper() = default;
-    ~EVPHelper() override = default;
+    explicit EVPHelper()
+    {
+        if (!(m_ctx = T::EVP_CIPHER_CTX_new()))
+        {
+            throw std::runtime_error("Error creating EVP_CIPHER_CTX");
+        }
+    }
+
+    ~EVPHelper() override
+    {
+        T::EVP_CIPHER_CTX_free(m_ctx);
+    }
+
+    EVPHelper(const EVPHelper&) = delete;
+    EVPHelper& operator=(const EVPHelper&) = delete;
 
     /**
      * Encrypts the input string.
@@ -40,7 +52,6 @@ public:
      */
     void encryptAES256(const std::string& input, std::vector<char>& output)
     {
-        EVP_CIPHER_CTX* ctx;
         int len;
         int ciphertextLen;
         std::vector<unsigned char> ciphertext(input.length() + T::AES_BLOCK_LENGTH, 0);
@@ -53,13 +64,9 @@ public:
             throw std::runtime_error("Error generating random bytes for key/iv");
         }
 
-        if (!(ctx = T::EVP_CIPHER_CTX_new()))
-        {
-            throw std::runtime_error("Error creating EVP_CIPHER_CTX");
-        }
-
-        // Defered Free
-        DEFER([&]() { T::EVP_CIPHER_CTX_free(ctx); });
+        // The member context is reused across operations, the init call below resets it. OpenSSL
+        // selects the AES-NI implementation of the cipher internally when the CPU supports it.
+        auto* const ctx {m_ctx};
 
         if (OPENSSL_SUCCESS != T::EVP_EncryptInit_ex(ctx, T::EVP_aes_256_cbc(), NULL, key.data(), iv.data()))
         {
@@ -96,8 +103,6 @@ public:
      */
     void decryptAES256(const std::vector<char>& input, std::string& output)
     {
-        EVP_CIPHER_CTX* ctx;
-
         int len;
 
         const auto* key = reinterpret_cast<const unsigned char*>(input.data());
@@ -107,12 +112,7 @@ public:
         std::vector<unsigned char> plaintext(ciphertextLen, 0);
         int plaintextLen;
 
-        if (!(ctx = T::EVP_CIPHER_CTX_new()))
-        {
-            throw std::runtime_error("Error creating EVP_CIPHER_CTX");
-        }
-
-        DEFER([&]() { T::EVP_CIPHER_CTX_free(ctx); });
+        auto* const ctx {m_ctx};
 
         if (OPENSSL_SUCCESS != T::EVP_DecryptInit_ex(ctx, T::EVP_aes_256_cbc(), NULL, key, iv))
         {
@@ -135,6 +135,41 @@ public:
         plaintext.resize(plaintextLen);
         output.assign(plaintext.begin(), plaintext.end());
     }
+
+    /**
+     * Encrypts a batch of strings reusing the same cipher context for every item.
+     *
+     * @param inputs    The entries to be encrypted
+     * @param outputs   One encrypted value (key + iv + ciphertext) per entry, in order
+     */
+    void encryptAES256Bulk(const std::vector<std::string>& inputs, std::vector<std::vector<char>>& outputs)
+    {
+        outputs.resize(inputs.size());
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            encryptAES256(inputs[i], outputs[i]);
+        }
+    }
+
+    /**
+     * Decrypts a batch of values reusing the same cipher context for every item.
+     *
+     * @param inputs    The entries to be decrypted (key + iv + ciphertext)
+     * @param outputs   One decrypted value per entry, in order
+     */
+    void decryptAES256Bulk(const std::vector<std::vector<char>>& inputs, std::vector<std::string>& outputs)
+    {
+        outputs.resize(inputs.size());
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            decryptAES256(inputs[i], outputs[i]);
+        }
+    }
+
+private:
+    EVP_CIPHER_CTX* m_ctx {nullptr};
 };
 
 #endif // _EVPHELPER_HPP
@@ -15,12 +15,16 @@
 #include "threadDispatcher.h"
 #include <functional>
 #include <map>
+#include <mutex>
 #include <shared_mutex>
 #include <utility>
+#include <vector>
 
 namespace Utils
 {
-    template<typename RawValue, template<class, class> class ThreadDispatcher = AsyncDispatcher>
+    constexpr size_t DEFAULT_FILTER_DISPATCH_BATCH_SIZE {64};
+
+    template<typename RawValue, template<class...> class ThreadDispatcher = AsyncDispatcher>
     class FilterMsgDispatcher final : public ThreadDispatcher<RawValue, std::function<void(const RawValue&)>>
     {
     public:
@@ -47,20 +51,96 @@ namespace Utils
                 throw std::invalid_argument {"Callback function must be provided."};
             }
         }
+
+        /**
+         * @brief Constructor for batch delivery mode.
+         * @details Messages that pass the filter are drained in batches of up to batchSize and delivered to the
+         * callback in a single call, so downstream code can amortize its per-message overhead. Partial batches
+         * are delivered as soon as the pending queue runs empty or on rundown.
+         *
+         * @param batchCallback Callback function to be called with each batch of messages.
+         * @param batchSize Maximum amount of messages delivered per callback invocation.
+         * @param filterCallback Callback function to be called to filter the message.
+         * @param threadPoolSize Number of threads in the thread pool.
+         * @param maxQueueSize Maximum size of the queue.
+         * @note The filter callback function must return true if the message must be dispatched.
+         */
+        explicit FilterMsgDispatcher(const std::function<void(const std::vector<RawValue>&)>& batchCallback,
+                                     const size_t batchSize,
+                                     const std::function<bool(RawValue)>& filterCallback = nullptr,
+                                     const unsigned int threadPoolSize = std::thread::hardware_concurrency(),
+                                     const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE)
+            : ThreadType {std::bind(&DispatcherType::dispatch, this, std::placeholders::_1),
+                          threadPoolSize,
+                          maxQueueSize}
+            , m_batchCallback {batchCallback}
+            , m_filterCallback {filterCallback}
+            , m_batchSize {batchSize ? batchSize : 1}
+        {
+            if (!m_batchCallback)
+            {
+                throw std::invalid_argument {"Batch callback function must be provided."};
+            }
+        }
         // LCOV_EXCL_START
         ~FilterMsgDispatcher() = default;
         // LCOV_EXCL_STOP
 
         /**
          * @brief Dispatches a message to the callback function, if the filter callback returns true or if filter
-         * callback is not defined.
+         * callback is not defined. In batch delivery mode the message is accumulated and the batch callback is
+         * invoked once per drained batch.
          * @param value Message to be dispatched.
          */
         void dispatch(const RawValue& value)
         {
             if (!m_filterCallback || m_filterCallback(value))
             {
-                m_callback(value);
+                if (m_batchCallback)
+                {
+                    std::vector<RawValue> readyBatch;
+                    {
+                        std::lock_guard<std::mutex> lock {m_batchMutex};
+                        m_batch.push_back(value);
+
+                        // Deliver full batches, and partial ones when there is nothing else queued.
+                        if (m_batch.size() >= m_batchSize || 0 == this->size())
+                        {
+                            readyBatch.swap(m_batch);
+                        }
+                    }
+
+                    if (!readyBatch.empty())
+                    {
+                        m_batchCallback(readyBatch);
+                    }
+                }
+                else
+                {
+                    m_callback(value);
+                }
+            }
+        }
+
+        /**
+         * @brief Processes all the pending messages and cancels the dispatcher, delivering any partial batch.
+         */
+        void rundown()
+        {
+            ThreadType::rundown();
+
+            if (m_batchCallback)
+            {
+                std::vector<RawValue> readyBatch;
+                {
+                    std::lock_guard<std::mutex> lock {m_batchMutex};
+                    readyBatch.swap(m_batch);
+                }
+
+                if (!readyBatch.empty())
+                {
+                    m_batchCallback(readyBatch);
+                }
             }
         }
 
@@ -69,7 +149,11 @@ namespace Utils
         using DispatcherType = FilterMsgDispatcher<RawValue, ThreadDispatcher>;
 
         std::function<void(RawValue)> m_callback;
+        std::function<void(const std::vector<RawValue>&)> m_batchCallback;
         std::function<bool(RawValue)> m_filterCallback;
+        std::vector<RawValue> m_batch;
+        std::mutex m_batchMutex;
+        const size_t m_batchSize {DEFAULT_FILTER_DISPATCH_BATCH_SIZE};
     };
 }; // namespace Utils
 
@@ -18,7 +18,10 @@
 #include "openssl/evp.h"
 #include <fstream>
 #include <array>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <utility>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
@@ -80,6 +83,10 @@ namespace Utils
                 // LCOV_EXCL_STOP
                 return {digest, digest + digestSize};
             }
+            void reset(const HashType hashType = HashType::Sha1)
+            {
+                initializeContext(hashType, m_spCtx);
+            }
         private:
             struct EvpContextDeleter final
             {
@@ -157,6 +164,166 @@ namespace Utils
 
         throw std::runtime_error {"Unable to open '" + filepath + "' for hashing."};
     };
+
+    /**
+     * @brief Function to calculate the hash of several buffers reusing a single context.
+     *
+     * Re-initializing one EVP context between buffers avoids the per-buffer context
+     * allocation cost, which dominates when many small buffers are hashed.
+     *
+     * @param buffers Buffers to hash, as data pointer and size pairs.
+     * @param hashType Hash algorithm to use.
+     * @return std::vector<std::vector<unsigned char>> One digest vector per buffer, in order.
+     */
+    static std::vector<std::vector<unsigned char>> hashBatch(const std::vector<std::pair<const void*, size_t>>& buffers,
+                                                             const HashType hashType = HashType::Sha1)
+    {
+        std::vector<std::vector<unsigned char>> digests;
+        digests.reserve(buffers.size());
+
+        HashData hash(hashType);
+        auto first{true};
+
+        for (const auto& [data, size] : buffers)
+        {
+            if (!first)
+            {
+                hash.reset(hashType);
+            }
+
+            first = false;
+            hash.update(data, size);
+            digests.push_back(hash.hash());
+        }
+
+        return digests;
+    }
+
+    /**
+     * @brief Checks whether the CPU offers SHA instruction acceleration.
+     *
+     * OpenSSL already dispatches to the SHA-NI implementation internally when available,
+     * this is exposed for diagnostics only.
+     *
+     * @return true If the SHA extensions are available.
+     * @return false If hashing falls back to the generic implementation.
+     */
+    static bool hashAccelerationAvailable()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __builtin_cpu_supports("sha") != 0;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Non-cryptographic 64 bit hash (xxHash64) for internal keying.
+     *
+     * Intended for cache keys and shard selection, where a cryptographic digest is overkill.
+     * Not suitable for integrity or security checks.
+     *
+     * @param data Buffer to hash.
+     * @param size Buffer size.
+     * @param seed Optional seed.
+     * @return uint64_t Hash value.
+     */
+    static uint64_t fastHash64(const void* data, size_t size, const uint64_t seed = 0)
+    {
+        constexpr uint64_t PRIME64_1 {11400714785074694791ULL};
+        constexpr uint64_t PRIME64_2 {14029467366897019727ULL};
+        constexpr uint64_t PRIME64_3 {1609587929392839161ULL};
+        constexpr uint64_t PRIME64_4 {9650029242287828579ULL};
+        constexpr uint64_t PRIME64_5 {2870177450012600261ULL};
+
+        const auto rotl{[](const uint64_t value, const int bits)
+        {
+            return (value << bits) | (value >> (64 - bits));
+        }};
+        const auto read64{[](const unsigned char* ptr)
+        {
+            uint64_t value;
+            memcpy(&value, ptr, sizeof(value));
+            return value;
+        }};
+        const auto read32{[](const unsigned char* ptr)
+        {
+            uint32_t value;
+            memcpy(&value, ptr, sizeof(value));
+            return value;
+        }};
+        const auto round{[&rotl](uint64_t acc, const uint64_t input)
+        {
+            acc += input * PRIME64_2;
+            acc = rotl(acc, 31);
+            return acc * PRIME64_1;
+        }};
+
+        const auto* ptr{static_cast<const unsigned char*>(data)};
+        const auto* const end{ptr + size};
+        uint64_t h64;
+
+        if (size >= 32)
+        {
+            auto v1{seed + PRIME64_1 + PRIME64_2};
+            auto v2{seed + PRIME64_2};
+            auto v3{seed};
+            auto v4{seed - PRIME64_1};
+
+            do
+            {
+                v1 = round(v1, read64(ptr));
+                v2 = round(v2, read64(ptr + 8));
+                v3 = round(v3, read64(ptr + 16));
+                v4 = round(v4, read64(ptr + 24));
+                ptr += 32;
+            }
+            while (ptr + 32 <= end);
+
+            h64 = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+
+            for (const auto v : {v1, v2, v3, v4})
+            {
+                h64 ^= round(0, v);
+                h64 = h64 * PRIME64_1 + PRIME64_4;
+            }
+        }
+        else
+        {
+            h64 = seed + PRIME64_5;
+        }
+
+        h64 += size;
+
+        while (ptr + 8 <= end)
+        {
+            h64 ^= round(0, read64(ptr));
+            h64 = rotl(h64, 27) * PRIME64_1 + PRIME64_4;
+            ptr += 8;
+        }
+
+        if (ptr + 4 <= end)
+        {
+            h64 ^= static_cast<uint64_t>(read32(ptr)) * PRIME64_1;
+            h64 = rotl(h64, 23) * PRIME64_2 + PRIME64_3;
+            ptr += 4;
+        }
+
+        while (ptr < end)
+        {
+            h64 ^= (*ptr) * PRIME64_5;
+            h64 = rotl(h64, 11) * PRIME64_1;
+            ++ptr;
+        }
+
+        h64 ^= h64 >> 33;
+        h64 *= PRIME64_2;
+        h64 ^= h64 >> 29;
+        h64 *= PRIME64_3;
+        h64 ^= h64 >> 32;
+
+        return h64;
+    }
 } // namespace Utils
 
 #pragma GCC diagnostic pop
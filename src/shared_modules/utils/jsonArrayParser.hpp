@@ -451,5 +451,74 @@ namespace JsonArray
         nlohmann::json::sax_parse(file, &arrayParser);
     }
 
+    /// Default memory ceiling, in bytes, for each chunk delivered by parseChunked().
+    constexpr size_t DEFAULT_CHUNK_MAX_SIZE {1024 * 1024};
+
+    /**
+     * @brief Parses a JSON file and invokes a callback with bounded-size chunks of items from the target array.
+     *
+     * @details Items are accumulated into a JSON array until their serialized size reaches \p chunkMaxSize, at which
+     * point the chunk is handed to \p processChunkCallback and the accumulation restarts. The memory usage is thus
+     * bounded by the ceiling regardless of the input file size, with the exception of a single item bigger than the
+     * ceiling, which is delivered alone in its own chunk.
+     *
+     * @param filepath Path to the JSON file.
+     * @param processChunkCallback Callback invoked for every chunk of items of the target array. The second parameter
+     * is the quantity of items parsed so far, including the ones on the chunk. If the callback returns false the
+     * parsing stops.
+     * @param chunkMaxSize Memory ceiling for each chunk, in bytes.
+     * @param arrayPointer JSON Pointer to the target array.
+     * @param processBodyCallback Callback invoked at the end of the parsing, after the last chunk, with the body of
+     * the JSON object. The body of the JSON object is the original JSON with the array items removed. If the
+     * \p processChunkCallback stops the parsing, the \p processBodyCallback will not be called.
+     */
+    static void parseChunked(
+        const std::filesystem::path& filepath,
+        const std::function<bool(nlohmann::json&&, const size_t)>& processChunkCallback,
+        const size_t chunkMaxSize = DEFAULT_CHUNK_MAX_SIZE,
+        const nlohmann::json::json_pointer& arrayPointer = nlohmann::json::json_pointer(),
+        std::function<void(nlohmann::json&&)> processBodyCallback = [](nlohmann::json&&) {})
+    {
+        auto chunk = nlohmann::json::array();
+        size_t chunkBytes {0};
+        size_t itemsParsed {0};
+        bool stopped {false};
+        nlohmann::json body;
+
+        // Accumulate the items into a chunk, flushing it every time the ceiling is reached.
+        const auto itemCallback {[&](nlohmann::json&& item, const size_t itemId)
+                                 {
+                                     itemsParsed = itemId;
+                                     chunkBytes += item.dump().size();
+                                     chunk.emplace_back(std::move(item));
+
+                                     if (chunkBytes >= chunkMaxSize)
+                                     {
+                                         auto fullChunk = std::exchange(chunk, nlohmann::json::array());
+                                         chunkBytes = 0;
+                                         stopped = !processChunkCallback(std::move(fullChunk), itemId);
+                                     }
+
+                                     return !stopped;
+                                 }};
+
+        // Capture the body so that it can be delivered after the last chunk.
+        parse(filepath,
+              itemCallback,
+              arrayPointer,
+              [&body](nlohmann::json&& parsedBody) { body = std::move(parsedBody); });
+
+        // Flush the last, partially filled chunk.
+        if (!stopped && !chunk.empty())
+        {
+            stopped = !processChunkCallback(std::move(chunk), itemsParsed);
+        }
+
+        if (!stopped)
+        {
+            processBodyCallback(std::move(body));
+        }
+    }
+
 } // namespace JsonArray
 #endif // _JSON_ARRAY_PARSER_HPP
@@ -0,0 +1,199 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 28, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _LOCK_FREE_QUEUE_HPP
+#define _LOCK_FREE_QUEUE_HPP
+
+#include "threadDispatcher.h"
+#include <atomic>
+#include <chrono>
+#include <concurrentqueue/blockingconcurrentqueue.h>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace Utils
+{
+    /**
+     * @class LockFreeQueue
+     *
+     * @brief MPMC lock-free queue built on top of moodycamel's BlockingConcurrentQueue.
+     *
+     * Drop-in alternative to SafeQueue for producer/consumer paths where lock contention is visible, such as
+     * dispatchers draining event bursts. It keeps the SafeQueue interface and cancellation semantics, and adds
+     * bulk push/pop operations that amortize the queue synchronization cost across batches of items.
+     *
+     * @tparam T Type of the queued items. It must be default constructible.
+     */
+    template<typename T>
+    class LockFreeQueue
+    {
+    public:
+        LockFreeQueue() = default;
+        LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+        LockFreeQueue(LockFreeQueue& other) = delete;
+
+        /**
+         * @brief Pushes an item into the queue. No-op if the queue is cancelled.
+         *
+         * @param value Item to push.
+         */
+        void push(const T& value)
+        {
+            if (!m_canceled)
+            {
+                m_queue.enqueue(value);
+            }
+        }
+
+        /**
+         * @brief Pushes a batch of items into the queue in a single operation. No-op if the queue is cancelled.
+         *
+         * @param values Items to push. The vector items are moved from.
+         */
+        void pushBulk(std::vector<T>&& values)
+        {
+            if (!m_canceled && !values.empty())
+            {
+                m_queue.enqueue_bulk(std::make_move_iterator(values.begin()), values.size());
+            }
+        }
+
+        /**
+         * @brief Pops an item from the queue.
+         *
+         * @param value Popped item, if any.
+         * @param wait If true, the call blocks until an item is available or the queue is cancelled.
+         * @return bool True if an item was popped, false if the queue is cancelled or (on non-blocking calls) empty.
+         */
+        bool pop(T& value, const bool wait = true)
+        {
+            if (!wait)
+            {
+                return !m_canceled && m_queue.try_dequeue(value);
+            }
+
+            while (!m_canceled)
+            {
+                if (m_queue.wait_dequeue_timed(value, WAIT_TIME))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Pops an item from the queue.
+         *
+         * @param wait If true, the call blocks until an item is available or the queue is cancelled.
+         * @return std::shared_ptr<T> Popped item. Null if the queue is cancelled or (on non-blocking calls) empty.
+         */
+        std::shared_ptr<T> pop(const bool wait = true)
+        {
+            T value;
+            return pop(value, wait) ? std::make_shared<T>(std::move(value)) : nullptr;
+        }
+
+        /**
+         * @brief Pops a batch of items from the queue in a single operation.
+         *
+         * @param values Popped items. The vector is resized to the amount of items actually popped.
+         * @param maxItems Maximum amount of items to pop.
+         * @param wait If true, the call blocks until at least one item is available or the queue is cancelled.
+         * @return size_t Amount of items popped. Zero if the queue is cancelled or (on non-blocking calls) empty.
+         */
+        size_t popBulk(std::vector<T>& values, const size_t maxItems, const bool wait = true)
+        {
+            values.resize(maxItems);
+            size_t count {0};
+
+            if (!wait)
+            {
+                if (!m_canceled)
+                {
+                    count = m_queue.try_dequeue_bulk(values.begin(), maxItems);
+                }
+            }
+            else
+            {
+                while (!m_canceled)
+                {
+                    count = m_queue.wait_dequeue_bulk_timed(values.begin(), maxItems, WAIT_TIME);
+                    if (count > 0)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            // Items already dequeued are returned even if a cancellation raced in, so no item is ever dropped.
+            values.resize(count);
+            return count;
+        }
+
+        /**
+         * @brief Cancels the queue, unblocking all the pending and future pops.
+         */
+        void cancel()
+        {
+            m_canceled = true;
+        }
+
+        /**
+         * @brief Checks whether the queue is cancelled or not.
+         *
+         * @return bool True if the queue is cancelled.
+         */
+        bool cancelled() const
+        {
+            return m_canceled;
+        }
+
+        /**
+         * @brief Checks whether the queue is empty or not. The result is approximate by design.
+         *
+         * @return bool True if the queue is empty.
+         */
+        bool empty() const
+        {
+            return m_queue.size_approx() == 0;
+        }
+
+        /**
+         * @brief Returns the amount of queued items. The result is approximate by design.
+         *
+         * @return size_t Amount of queued items.
+         */
+        size_t size() const
+        {
+            return m_queue.size_approx();
+        }
+
+    private:
+        /**
+         * @brief Wake-up period used to check for cancellation while blocked on a pop.
+         */
+        static constexpr std::chrono::milliseconds WAIT_TIME {100};
+
+        moodycamel::BlockingConcurrentQueue<T> m_queue; ///< Underlying lock-free queue.
+        std::atomic_bool m_canceled {false};            ///< Whether the queue has been cancelled or not.
+    };
+
+    /**
+     * @brief Asynchronous dispatcher backed by the lock-free queue instead of the default SafeQueue.
+     */
+    template<typename Type, typename Functor>
+    using LockFreeAsyncDispatcher = AsyncDispatcher<Type, Functor, LockFreeQueue<std::function<void()>>>;
+} // namespace Utils
+
+#endif // _LOCK_FREE_QUEUE_HPP
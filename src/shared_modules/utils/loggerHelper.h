@@ -13,14 +13,20 @@
 #define LOGGER_HELPER_H
 
 #include "commonDefs.h"
+#include <atomic>
+#include <chrono>
 #include <cstdarg>
+#include <cstdint>
+#include <cstdio>
 #include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 // We can't use std::source_location until C++20
 #define LogEndl                                                                                                        \
@@ -28,11 +34,19 @@
     {                                                                                                                  \
         __FILE__, __LINE__, __func__                                                                                   \
     }
-#define logInfo(X, Y, ...)   Log::Logger::info(X, LogEndl, Y, ##__VA_ARGS__)
-#define logWarn(X, Y, ...)   Log::Logger::warning(X, LogEndl, Y, ##__VA_ARGS__)
+#define logInfo(X, Y, ...)  Log::Logger::info(X, LogEndl, Y, ##__VA_ARGS__)
+#define logWarn(X, Y, ...)  Log::Logger::warning(X, LogEndl, Y, ##__VA_ARGS__)
+#define logError(X, Y, ...) Log::Logger::error(X, LogEndl, Y, ##__VA_ARGS__)
+// Compile-time gate for the debug macros: building with LOGGER_HELPER_DISABLE_DEBUG compiles the
+// debug logging in hot loops out entirely. When compiled in, a debug call with no log function
+// assigned still costs only the single predictable branch inside the logger.
+#ifdef LOGGER_HELPER_DISABLE_DEBUG
+#define logDebug1(X, Y, ...)
+#define logDebug2(X, Y, ...)
+#else
 #define logDebug1(X, Y, ...) Log::Logger::debug(X, LogEndl, Y, ##__VA_ARGS__)
 #define logDebug2(X, Y, ...) Log::Logger::debugVerbose(X, LogEndl, Y, ##__VA_ARGS__)
-#define logError(X, Y, ...)  Log::Logger::error(X, LogEndl, Y, ##__VA_ARGS__)
+#endif
 constexpr auto MAXLEN {65536};
 
 namespace Log
@@ -93,12 +107,267 @@ namespace Log
     
 #pragma GCC diagnostic pop
 
+    /**
+     * @brief Formatted log entry queued for asynchronous delivery.
+     *
+     */
+    struct AsyncLogEntry
+    {
+        int level;           ///< Log level.
+        std::string tag;     ///< Module tag.
+        std::string file;    ///< Source file.
+        int line;            ///< Source line.
+        std::string func;    ///< Source function.
+        std::string message; ///< Formatted message.
+    };
+
+    /**
+     * @brief Asynchronous log sink.
+     *
+     * @note When enabled, log calls format on the calling thread into a reused thread-local buffer,
+     * queue the entry into a bounded lock-free ring and return; a dedicated flusher thread delivers
+     * the entries to the sink callback. If the ring is full the entry is delivered inline on the
+     * calling thread instead of being dropped, so the sink callback must be thread-safe.
+     *
+     */
+    class AsyncLogSink final
+    {
+        /**
+         * @brief Ring capacity. Must be a power of two.
+         */
+        static constexpr size_t RING_SIZE {8192};
+
+        /**
+         * @brief Ring slot: the sequence number gates producers and the consumer without locks.
+         */
+        struct Slot
+        {
+            std::atomic<size_t> sequence {0}; ///< Slot state: who may touch the slot next.
+            AsyncLogEntry entry;              ///< Queued entry.
+        };
+
+        std::unique_ptr<Slot[]> m_slots {new Slot[RING_SIZE]};
+        std::atomic<size_t> m_enqueuePos {0};
+        std::atomic<size_t> m_dequeuePos {0};
+        std::atomic<bool> m_enabled {false};
+        std::atomic<bool> m_stop {false};
+        std::function<void(const AsyncLogEntry&)> m_sink;
+        std::thread m_flusher;
+        std::mutex m_lifecycleMutex;
+
+        AsyncLogSink()
+        {
+            for (size_t i = 0; i < RING_SIZE; ++i)
+            {
+                m_slots[i].sequence = i;
+            }
+        }
+
+        /**
+         * @brief Enqueues an entry into the ring.
+         *
+         * @param entry Entry to enqueue. Only moved from on success.
+         * @return false if the ring is full.
+         */
+        bool push(AsyncLogEntry& entry)
+        {
+            auto pos = m_enqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto& slot = m_slots[pos & (RING_SIZE - 1)];
+                const auto sequence = slot.sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+                if (0 == difference)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        slot.entry = std::move(entry);
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    // Ring full.
+                    return false;
+                }
+                else
+                {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Dequeues an entry from the ring.
+         *
+         * @param entry Dequeued entry.
+         * @return false if the ring is empty.
+         */
+        bool pop(AsyncLogEntry& entry)
+        {
+            auto pos = m_dequeuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto& slot = m_slots[pos & (RING_SIZE - 1)];
+                const auto sequence = slot.sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+                if (0 == difference)
+                {
+                    if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        entry = std::move(slot.entry);
+                        slot.sequence.store(pos + RING_SIZE, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    // Ring empty.
+                    return false;
+                }
+                else
+                {
+                    pos = m_dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Flusher thread body: delivers queued entries, then drains the ring on stop.
+         */
+        void flushLoop()
+        {
+            AsyncLogEntry entry;
+            while (!m_stop.load(std::memory_order_acquire))
+            {
+                if (pop(entry))
+                {
+                    m_sink(entry);
+                }
+                else
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+
+            // Deliver whatever was queued before the stop.
+            while (pop(entry))
+            {
+                m_sink(entry);
+            }
+        }
+
+    public:
+        /**
+         * @brief Gets the sink instance.
+         *
+         * @return AsyncLogSink& Sink instance.
+         */
+        static AsyncLogSink& instance()
+        {
+            static AsyncLogSink s_instance;
+            return s_instance;
+        }
+
+        /**
+         * @brief Checks whether the asynchronous mode is enabled.
+         *
+         * @return true if enabled.
+         */
+        bool enabled() const
+        {
+            return m_enabled.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Enables the asynchronous mode and starts the flusher thread.
+         *
+         * @param sink Callback that receives the formatted entries. It must be thread-safe: it runs
+         * on the flusher thread, and on a producer thread when the ring is full.
+         */
+        void start(std::function<void(const AsyncLogEntry&)> sink)
+        {
+            const std::lock_guard<std::mutex> lock(m_lifecycleMutex);
+            if (m_enabled)
+            {
+                return;
+            }
+            m_sink = std::move(sink);
+            m_stop = false;
+            m_flusher = std::thread(&AsyncLogSink::flushLoop, this);
+            m_enabled.store(true, std::memory_order_release);
+        }
+
+        /**
+         * @brief Disables the asynchronous mode, draining the pending entries.
+         */
+        void stop()
+        {
+            const std::lock_guard<std::mutex> lock(m_lifecycleMutex);
+            if (!m_enabled)
+            {
+                return;
+            }
+            // New log calls go back to the synchronous path before the flusher winds down.
+            m_enabled.store(false, std::memory_order_release);
+            m_stop.store(true, std::memory_order_release);
+            if (m_flusher.joinable())
+            {
+                m_flusher.join();
+            }
+            m_sink = nullptr;
+        }
+
+        /**
+         * @brief Queues an entry for delivery, delivering inline if the ring is full.
+         *
+         * @param entry Entry to deliver.
+         */
+        void log(AsyncLogEntry&& entry)
+        {
+            if (!push(entry))
+            {
+                m_sink(entry);
+            }
+        }
+    };
+
     /**
      * @brief Logging helper class.
      *
      */
     class Logger final
     {
+        /**
+         * @brief Common logging body: asynchronous when the sink is enabled, otherwise the
+         * synchronous global log function.
+         *
+         * @param level Log level.
+         * @param tag Module tag.
+         * @param sourceFile Log location.
+         * @param msg Message to be logged.
+         * @param args Message format arguments.
+         */
+        static void
+        log(const int level, const char* tag, const SourceFile& sourceFile, const char* msg, va_list args)
+        {
+            if (auto& asyncSink = AsyncLogSink::instance(); asyncSink.enabled())
+            {
+                // Format on the calling thread into a reused thread-local buffer; delivery happens
+                // on the flusher thread.
+                thread_local std::vector<char> buffer(MAXLEN);
+                vsnprintf(buffer.data(), buffer.size(), msg, args);
+                asyncSink.log({level, tag, sourceFile.file, sourceFile.line, sourceFile.func, buffer.data()});
+            }
+            else if (GLOBAL_LOG_FUNCTION)
+            {
+                GLOBAL_LOG_FUNCTION(level, tag, sourceFile.file, sourceFile.line, sourceFile.func, msg, args);
+            }
+        }
+
     public:
         /**
          * @brief INFO log.
@@ -109,12 +378,12 @@ namespace Log
          */
         static void info(const char* tag, SourceFile sourceFile, const char* msg, ...)
         {
-            if (GLOBAL_LOG_FUNCTION)
+            if (GLOBAL_LOG_FUNCTION || AsyncLogSink::instance().enabled())
             {
                 std::va_list args;
                 va_start(args, msg);
 
-                GLOBAL_LOG_FUNCTION(LOGLEVEL_INFO, tag, sourceFile.file, sourceFile.line, sourceFile.func, msg, args);
+                log(LOGLEVEL_INFO, tag, sourceFile, msg, args);
 
                 va_end(args);
             }
@@ -129,13 +398,12 @@ namespace Log
          */
         static void warning(const char* tag, SourceFile sourceFile, const char* msg, ...)
         {
-            if (GLOBAL_LOG_FUNCTION)
+            if (GLOBAL_LOG_FUNCTION || AsyncLogSink::instance().enabled())
             {
                 std::va_list args;
                 va_start(args, msg);
 
-                GLOBAL_LOG_FUNCTION(
-                    LOGLEVEL_WARNING, tag, sourceFile.file, sourceFile.line, sourceFile.func, msg, args);
+                log(LOGLEVEL_WARNING, tag, sourceFile, msg, args);
 
                 va_end(args);
             }
@@ -150,12 +418,12 @@ namespace Log
          */
         static void debug(const char* tag, SourceFile sourceFile, const char* msg, ...)
         {
-            if (GLOBAL_LOG_FUNCTION)
+            if (GLOBAL_LOG_FUNCTION || AsyncLogSink::instance().enabled())
             {
                 std::va_list args;
                 va_start(args, msg);
 
-                GLOBAL_LOG_FUNCTION(LOGLEVEL_DEBUG, tag, sourceFile.file, sourceFile.line, sourceFile.func, msg, args);
+                log(LOGLEVEL_DEBUG, tag, sourceFile, msg, args);
 
                 va_end(args);
             }
@@ -170,13 +438,12 @@ namespace Log
          */
         static void debugVerbose(const char* tag, SourceFile sourceFile, const char* msg, ...)
         {
-            if (GLOBAL_LOG_FUNCTION)
+            if (GLOBAL_LOG_FUNCTION || AsyncLogSink::instance().enabled())
             {
                 std::va_list args;
                 va_start(args, msg);
 
-                GLOBAL_LOG_FUNCTION(
-                    LOGLEVEL_DEBUG_VERBOSE, tag, sourceFile.file, sourceFile.line, sourceFile.func, msg, args);
+                log(LOGLEVEL_DEBUG_VERBOSE, tag, sourceFile, msg, args);
 
                 va_end(args);
             }
@@ -191,12 +458,12 @@ namespace Log
          */
         static void error(const char* tag, SourceFile sourceFile, const char* msg, ...)
         {
-            if (GLOBAL_LOG_FUNCTION)
+            if (GLOBAL_LOG_FUNCTION || AsyncLogSink::instance().enabled())
             {
                 std::va_list args;
                 va_start(args, msg);
 
-                GLOBAL_LOG_FUNCTION(LOGLEVEL_ERROR, tag, sourceFile.file, sourceFile.line, sourceFile.func, msg, args);
+                log(LOGLEVEL_ERROR, tag, sourceFile, msg, args);
 
                 va_end(args);
             }
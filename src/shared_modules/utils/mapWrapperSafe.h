@@ -13,6 +13,7 @@
 
 #include <map>
 #include <mutex>
+#include <shared_mutex>
 
 namespace Utils
 {
@@ -44,6 +45,40 @@ namespace Utils
                 m_map.erase(key);
             }
     };
+
+    /**
+     * Reader-writer variant of MapWrapperSafe, with the same interface. Lookups take a shared
+     * lock so concurrent readers don't serialize each other; intended for read-dominated tables
+     * where writes are rare.
+     */
+    template<typename Key, typename Value>
+    class SharedMapWrapperSafe final
+    {
+            std::map<Key, Value> m_map;
+            std::shared_timed_mutex m_mutex;
+        public:
+            // LCOV_EXCL_START
+            SharedMapWrapperSafe() = default;
+            // LCOV_EXCL_STOP
+            void insert(const Key& key, const Value& value)
+            {
+                std::unique_lock<std::shared_timed_mutex> lock(m_mutex);
+                m_map.emplace(key, value);
+            }
+
+            Value operator[](const Key& key)
+            {
+                std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+                const auto it { m_map.find(key) };
+                return m_map.end() != it ? it->second : Value();
+            }
+
+            void erase(const Key& key)
+            {
+                std::unique_lock<std::shared_timed_mutex> lock(m_mutex);
+                m_map.erase(key);
+            }
+    };
 };
 
 
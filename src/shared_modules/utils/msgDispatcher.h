@@ -15,11 +15,13 @@
 #include <mutex>
 #include <functional>
 #include <utility>
+#include <vector>
 #include "commonDefs.h"
 #include "threadDispatcher.h"
 
 namespace Utils
 {
+    constexpr size_t DEFAULT_DISPATCH_BATCH_SIZE { 64 };
 
     template
     <
@@ -27,20 +29,22 @@ namespace Utils
         typename Value,
         typename RawValue,
         typename RawValueDecoder,
-        template <class, class> class ThreadDispatcher = AsyncDispatcher
+        template <class...> class ThreadDispatcher = AsyncDispatcher
         >
     class MsgDispatcher final : public ThreadDispatcher<RawValue, std::function<void(const RawValue&)>>
         , public RawValueDecoder
     {
         public:
             explicit MsgDispatcher(const unsigned int threadPoolSize = std::thread::hardware_concurrency(),
-                          const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE)
+                          const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE,
+                          const size_t batchSize = DEFAULT_DISPATCH_BATCH_SIZE)
                 : ThreadType
             {
                 std::bind(&DispatcherType::dispatch, this, std::placeholders::_1),
                 threadPoolSize,
                 maxQueueSize
             }
+            , m_batchSize{ batchSize ? batchSize : 1 }
             {
             }
             // LCOV_EXCL_START
@@ -58,33 +62,81 @@ namespace Utils
 
                 return ret;
             }
-            void removeCallback(const Key& key)
+            /**
+             * @brief Registers a batch callback for a given key.
+             * @details Messages decoded to the key are drained in batches of up to the dispatcher batch size
+             * and delivered to the callback in a single call, so downstream code can amortize its per-message
+             * overhead. Partial batches are delivered as soon as the pending queue runs empty or on rundown.
+             *
+             * @param key Key to register the callback for.
+             * @param callback Callable receiving the batched values.
+             * @return true if the callback was registered, false if the key already had a batch callback.
+             */
+            bool addBatchCallback(const Key& key, const std::function<void(const std::vector<Value>&)>& callback)
             {
                 std::lock_guard<std::mutex> lock{ m_mutex };
-                const auto it{ m_callbacks.find(key) };
+                const auto ret{ m_batchCallbacks.find(key) == m_batchCallbacks.end() };
 
-                if (it != m_callbacks.end())
+                if (ret)
                 {
-                    m_callbacks.erase(it);
+                    m_batchCallbacks[key] = callback;
                 }
+
+                return ret;
+            }
+            void removeCallback(const Key& key)
+            {
+                std::lock_guard<std::mutex> lock{ m_mutex };
+                m_callbacks.erase(key);
+                m_batchCallbacks.erase(key);
+                m_batches.erase(key);
             }
             void dispatch(const RawValue& raw)
             {
                 const auto& data{ RawValueDecoder::decode(raw) };
-                const auto& callback{ findCallback(data.first) };
+                const auto& batchCallback{ findBatchCallback(data.first) };
 
-                if (callback)
+                if (batchCallback)
                 {
-                    callback(data.second);
+                    std::vector<Value> readyBatch;
+                    {
+                        std::lock_guard<std::mutex> lock{ m_mutex };
+                        auto& batch{ m_batches[data.first] };
+                        batch.push_back(data.second);
+
+                        // Deliver full batches, and partial ones when there is nothing else queued.
+                        if (batch.size() >= m_batchSize || 0 == this->size())
+                        {
+                            readyBatch.swap(batch);
+                        }
+                    }
+
+                    if (!readyBatch.empty())
+                    {
+                        batchCallback(readyBatch);
+                    }
+                }
+                else
+                {
+                    const auto& callback{ findCallback(data.first) };
+
+                    if (callback)
+                    {
+                        callback(data.second);
+                    }
                 }
             }
+            void rundown()
+            {
+                ThreadType::rundown();
+                flushBatches();
+            }
         private:
             using ThreadType = ThreadDispatcher<RawValue, std::function<void(const RawValue&)>>;
             using DispatcherType = MsgDispatcher<Key, Value, RawValue, RawValueDecoder, ThreadDispatcher>;
 
             std::function<void(Value)> findCallback(const Key& key)
             {
-                std::function<void(Value)> ret;
                 std::lock_guard<std::mutex> lock{ m_mutex };
                 const auto it { m_callbacks.find(key) };
 
@@ -95,8 +147,44 @@ namespace Utils
 
                 return {};
             }
-            std::map<Key, std::function<void(Value)>> m_callbacks;
-            std::mutex                                m_mutex;
+            std::function<void(const std::vector<Value>&)> findBatchCallback(const Key& key)
+            {
+                std::lock_guard<std::mutex> lock{ m_mutex };
+                const auto it { m_batchCallbacks.find(key) };
+
+                if (it != m_batchCallbacks.end())
+                {
+                    return it->second;
+                }
+
+                return {};
+            }
+            void flushBatches()
+            {
+                std::map<Key, std::vector<Value>> pendingBatches;
+                {
+                    std::lock_guard<std::mutex> lock{ m_mutex };
+                    pendingBatches.swap(m_batches);
+                }
+
+                for (auto& [key, batch] : pendingBatches)
+                {
+                    if (!batch.empty())
+                    {
+                        const auto& batchCallback{ findBatchCallback(key) };
+
+                        if (batchCallback)
+                        {
+                            batchCallback(batch);
+                        }
+                    }
+                }
+            }
+            std::map<Key, std::function<void(Value)>>                    m_callbacks;
+            std::map<Key, std::function<void(const std::vector<Value>&)>> m_batchCallbacks;
+            std::map<Key, std::vector<Value>>                            m_batches;
+            std::mutex                                                   m_mutex;
+            const size_t                                                 m_batchSize;
     };
 }
 
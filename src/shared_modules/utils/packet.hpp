@@ -12,22 +12,123 @@
 #ifndef _PACKET_HPP
 #define _PACKET_HPP
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 class Packet final
 {
 public:
-    Packet(char* data, uint32_t size)
+    Packet() = default;
+
+    Packet(const char* data, uint32_t size)
         : data {std::make_unique<char[]>(size + 1)}
         , size(size)
         , offset(0)
+        , capacity(size + 1)
     {
         std::copy(data, data + size, this->data.get());
     }
     virtual ~Packet() = default;
+
+    /**
+     * @brief Grows the internal buffer if needed. The previous content is discarded.
+     *
+     * @param newCapacity Minimum capacity, in bytes.
+     */
+    void reserve(uint32_t newCapacity)
+    {
+        if (capacity < newCapacity)
+        {
+            data = std::make_unique<char[]>(newCapacity);
+            capacity = newCapacity;
+        }
+    }
+
+    /**
+     * @brief Replaces the packet content, reusing the internal buffer when its capacity allows it.
+     *
+     * @param newData Data to copy into the packet.
+     * @param newSize Size of the data, in bytes.
+     */
+    void assign(const char* newData, uint32_t newSize)
+    {
+        reserve(newSize + 1);
+        std::copy(newData, newData + newSize, data.get());
+        size = newSize;
+        offset = 0;
+    }
+
     std::unique_ptr<char[]> data;
-    uint32_t size;
-    uint32_t offset;
+    uint32_t size {0};
+    uint32_t offset {0};
+    uint32_t capacity {0};
+};
+
+/**
+ * @brief Freelist of reusable Packet objects.
+ *
+ * Packets released back to the pool keep their buffers, so acquiring a packet for a payload that fits an
+ * already-allocated buffer performs no allocation. The pool is not thread safe: callers synchronize access
+ * with the lock that already guards their packet queue.
+ */
+class PacketPool final
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param maxPooled Maximum number of idle packets kept in the freelist. Released packets in excess are freed.
+     */
+    explicit PacketPool(const size_t maxPooled = DEFAULT_MAX_POOLED_PACKETS)
+        : m_maxPooled {maxPooled}
+    {
+    }
+
+    /**
+     * @brief Takes a packet from the freelist, or creates one if the freelist is empty.
+     *
+     * @return std::unique_ptr<Packet> An empty packet ready to be assigned.
+     */
+    std::unique_ptr<Packet> acquire()
+    {
+        if (!m_freeList.empty())
+        {
+            auto packet {std::move(m_freeList.back())};
+            m_freeList.pop_back();
+            return packet;
+        }
+        return std::make_unique<Packet>();
+    }
+
+    /**
+     * @brief Returns a packet to the freelist so its buffer can be reused.
+     *
+     * @param packet Packet to recycle.
+     */
+    void release(std::unique_ptr<Packet> packet)
+    {
+        if (packet && m_freeList.size() < m_maxPooled)
+        {
+            m_freeList.push_back(std::move(packet));
+        }
+    }
+
+    /**
+     * @brief Returns the number of idle packets in the freelist.
+     *
+     * @return size_t Freelist size.
+     */
+    size_t available() const
+    {
+        return m_freeList.size();
+    }
+
+private:
+    static constexpr size_t DEFAULT_MAX_POOLED_PACKETS {128}; ///< Default freelist bound.
+
+    std::vector<std::unique_ptr<Packet>> m_freeList; ///< Idle packets.
+    const size_t m_maxPooled;                        ///< Maximum number of idle packets kept.
 };
 
 #endif // _PACKET_HPP
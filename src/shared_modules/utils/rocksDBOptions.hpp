@@ -13,8 +13,12 @@
 #define _ROCKS_DB_OPTIONS_HPP
 
 #include <memory>
+#include <rocksdb/cache.h>
 #include <rocksdb/db.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice_transform.h>
 #include <rocksdb/table.h>
+#include <rocksdb/write_buffer_manager.h>
 
 namespace Utils
 {
@@ -24,15 +28,74 @@ namespace Utils
     constexpr auto ROCKSDB_MAX_OPEN_FILES = 256;
     constexpr auto ROCKSDB_NUM_LEVELS = 4;
     constexpr auto ROCKSDB_BLOCK_CACHE_SIZE = 16 * 1024 * 1024;
+    constexpr auto ROCKSDB_BLOOM_FILTER_BITS_PER_KEY = 10.0;
+    constexpr auto ROCKSDB_MEMTABLE_PREFIX_BLOOM_RATIO = 0.1;
+    constexpr auto ROCKSDB_SHARED_WRITE_BUFFER_SIZE = 128 * 1024 * 1024;
+    constexpr auto ROCKSDB_SHARED_BLOCK_CACHE_SIZE = 64 * 1024 * 1024;
+
+    /**
+     * @brief Process-wide RocksDB memory resources shared by every embedded store.
+     *
+     * Each wrapper used to allocate its own WriteBufferManager and block cache, statically
+     * partitioning memory between stores and wasting cache on idle ones. Joining these shared
+     * instances puts all memtables under one global budget and lets the block cache evict
+     * towards whichever store is hot, so total RocksDB memory stays bounded by the caps.
+     */
+    class RocksDBSharedResources final
+    {
+        public:
+            /**
+             * @brief Block cache shared by all the RocksDB instances.
+             * @return std::shared_ptr<rocksdb::Cache> Shared cache.
+             */
+            static const std::shared_ptr<rocksdb::Cache>& blockCache()
+            {
+                static std::shared_ptr<rocksdb::Cache> cache =
+                    rocksdb::NewLRUCache(ROCKSDB_SHARED_BLOCK_CACHE_SIZE);
+                return cache;
+            }
+
+            /**
+             * @brief Write buffer manager shared by all the RocksDB instances.
+             * @return std::shared_ptr<rocksdb::WriteBufferManager> Shared manager.
+             */
+            static const std::shared_ptr<rocksdb::WriteBufferManager>& writeBufferManager()
+            {
+                static auto manager =
+                    std::make_shared<rocksdb::WriteBufferManager>(ROCKSDB_SHARED_WRITE_BUFFER_SIZE);
+                return manager;
+            }
+
+            /**
+             * @brief Adjust the global block cache capacity, applied to the live cache.
+             * @param bytes New capacity in bytes.
+             */
+            static void setBlockCacheCapacity(size_t bytes)
+            {
+                blockCache()->SetCapacity(bytes);
+            }
+
+            /**
+             * @brief Adjust the global memtable budget, applied to the live manager.
+             * @param bytes New budget in bytes.
+             */
+            static void setWriteBufferCapacity(size_t bytes)
+            {
+                writeBufferManager()->SetBufferSize(bytes);
+            }
+    };
 
     class RocksDBOptions final
     {
 
         /**
          * @brief Builds the table options for the RocksDB instance.
+         * @param readCache Cache for read operations.
+         * @param enableBloomFilter Whether to attach a bloom filter policy to the SST blocks or not.
          * @return rocksdb::BlockBasedTableOptions Table options.
          */
-        static rocksdb::BlockBasedTableOptions buildTableOptions(const std::shared_ptr<rocksdb::Cache>& readCache)
+        static rocksdb::BlockBasedTableOptions buildTableOptions(const std::shared_ptr<rocksdb::Cache>& readCache,
+                                                                 const bool enableBloomFilter = false)
         {
             if (readCache == nullptr)
             {
@@ -41,15 +104,24 @@ namespace Utils
 
             rocksdb::BlockBasedTableOptions tableOptions;
             tableOptions.block_cache = readCache;
+            if (enableBloomFilter)
+            {
+                // Bloom filters allow prefix seeks to skip SST blocks without matching keys.
+                tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(ROCKSDB_BLOOM_FILTER_BITS_PER_KEY));
+            }
             return tableOptions;
         }
 
     public:
         /**
          * @brief Builds the column family options for the RocksDB instance.
+         * @param readCache Cache for read operations.
+         * @param prefixLength Length of the fixed key prefix used for prefix seeks. If zero, no prefix extractor nor
+         * bloom filters are configured and the column keeps total order iteration only.
          * @return rocksdb::ColumnFamilyOptions Column family options.
          */
-        static rocksdb::ColumnFamilyOptions buildColumnFamilyOptions(const std::shared_ptr<rocksdb::Cache>& readCache)
+        static rocksdb::ColumnFamilyOptions buildColumnFamilyOptions(const std::shared_ptr<rocksdb::Cache>& readCache,
+                                                                     const size_t prefixLength = 0)
         {
             rocksdb::ColumnFamilyOptions columnFamilyOptions;
             // Amount of data to build up in memory (backed by an unsorted log
@@ -60,7 +132,16 @@ namespace Utils
             // The maximum number of levels of compaction to allow.
             columnFamilyOptions.num_levels = ROCKSDB_NUM_LEVELS;
             // The size of the LRU cache used to prevent cold reads.
-            columnFamilyOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(buildTableOptions(readCache)));
+            columnFamilyOptions.table_factory.reset(
+                rocksdb::NewBlockBasedTableFactory(buildTableOptions(readCache, prefixLength > 0)));
+
+            if (prefixLength > 0)
+            {
+                // Group keys sharing the first 'prefixLength' bytes so prefix seeks only touch related blocks.
+                columnFamilyOptions.prefix_extractor.reset(rocksdb::NewFixedPrefixTransform(prefixLength));
+                // Enable the memtable bloom filter to also skip non-matching prefixes on unflushed data.
+                columnFamilyOptions.memtable_prefix_bloom_size_ratio = ROCKSDB_MEMTABLE_PREFIX_BLOOM_RATIO;
+            }
 
             return columnFamilyOptions;
         }
@@ -13,13 +13,16 @@
 #define _ROCKS_DB_WRAPPER_HPP
 
 #include "rocksDBColumnFamily.hpp"
+#include "rocksDBCompactionScheduler.hpp"
 #include "rocksDBIterator.hpp"
 #include "rocksDBOptions.hpp"
 #include <algorithm>
 #include <filesystem>
+#include <map>
 #include <memory>
 #include <rocksdb/db.h>
 #include <rocksdb/filter_policy.h>
+#include <rocksdb/rate_limiter.h>
 #include <rocksdb/table.h>
 #include <rocksdb/utilities/transaction.h>
 #include <rocksdb/utilities/transaction_db.h>
@@ -47,6 +50,9 @@ namespace Utils
         virtual void flush() = 0;
         virtual std::vector<std::string> getAllColumns() = 0;
         virtual RocksDBIterator seek(std::string_view key, const std::string& columnName = "") = 0; // NOLINT
+        virtual RocksDBIterator seekPrefix(std::string_view prefix,
+                                           const std::string& columnName = "",
+                                           const size_t readaheadSize = 0) = 0;
 
         virtual ~IRocksDBWrapper() = default;
     };
@@ -65,16 +71,36 @@ namespace Utils
          *
          * @param dbPath Path to the RocksDB database.
          * @param enableWal Whether to enable WAL or not.
+         * @param columnsPrefixes Fixed key prefix lengths, indexed by column name, used to configure the prefix
+         * extractors of existing columns on open. Columns not present in the map are opened without prefix extractor.
          */
-        explicit TRocksDBWrapper(std::string dbPath, const bool enableWal = true)
+        explicit TRocksDBWrapper(std::string dbPath,
+                                 const bool enableWal = true,
+                                 const std::map<std::string, size_t>& columnsPrefixes = {},
+                                 const int64_t rateLimitBytesPerSec = 0)
             : m_enableWal {enableWal}
             , m_path {std::move(dbPath)}
         {
-            m_readCache = rocksdb::NewLRUCache(16 * 1024 * 1024);
-            m_writeManager = std::make_shared<rocksdb::WriteBufferManager>(128 * 1024 * 1024);
+            // Join the process-wide cache and memtable budget instead of a private partition
+            m_readCache = RocksDBSharedResources::blockCache();
+            m_writeManager = RocksDBSharedResources::writeBufferManager();
 
             rocksdb::Options options = RocksDBOptions::buildDBOptions(m_writeManager, m_readCache);
-            rocksdb::ColumnFamilyOptions columnFamilyOptions = RocksDBOptions::buildColumnFamilyOptions(m_readCache);
+
+            // Cap background I/O (flush and compaction) for this store, 0 leaves it unlimited.
+            if (rateLimitBytesPerSec > 0)
+            {
+                options.rate_limiter.reset(rocksdb::NewGenericRateLimiter(rateLimitBytesPerSec));
+            }
+
+            // Returns the column family options, including its prefix extractor when a prefix length is configured.
+            const auto columnFamilyOptions {
+                [this, &columnsPrefixes](const std::string& columnName)
+                {
+                    const auto it {columnsPrefixes.find(columnName)};
+                    return RocksDBOptions::buildColumnFamilyOptions(m_readCache,
+                                                                    it != columnsPrefixes.end() ? it->second : 0);
+                }};
 
             T* dbRawPtr;
             std::vector<rocksdb::ColumnFamilyDescriptor> columnsDescriptors;
@@ -96,13 +122,14 @@ namespace Utils
                 // Create a set of column descriptors. This includes the default column.
                 for (auto& columnName : columnsNames)
                 {
-                    columnsDescriptors.emplace_back(columnName, columnFamilyOptions);
+                    columnsDescriptors.emplace_back(columnName, columnFamilyOptions(columnName));
                 }
             }
             else
             {
                 // Database doesn't exist: Set just the default column descriptor.
-                columnsDescriptors.emplace_back(rocksdb::kDefaultColumnFamilyName, columnFamilyOptions);
+                columnsDescriptors.emplace_back(rocksdb::kDefaultColumnFamilyName,
+                                                columnFamilyOptions(rocksdb::kDefaultColumnFamilyName));
             }
 
             // Create a vector of column handles.
@@ -145,6 +172,18 @@ namespace Utils
             {
                 m_columnsInstances.emplace_back(m_db, handle);
             }
+
+            // Compact during ingestion idle windows instead of colliding with write peaks. The
+            // callback holds the DB weakly so a stale trigger after destruction is a no-op.
+            m_compactionHandle = RocksDBCompactionScheduler::instance().registerStore(
+                m_path,
+                [weakDb = std::weak_ptr<T>(m_db)]()
+                {
+                    if (auto db = weakDb.lock())
+                    {
+                        db->CompactRange(rocksdb::CompactRangeOptions(), nullptr, nullptr);
+                    }
+                });
         }
 
         /**
@@ -167,7 +206,11 @@ namespace Utils
 
             if (const auto status {
                     m_db->Put(writeOptions, getColumnFamilyBasedOnName(columnName).handle(), key, value)};
-                !status.ok())
+                status.ok())
+            {
+                m_compactionHandle->noteWrite();
+            }
+            else
             {
                 throw std::runtime_error("Error putting data: " + status.ToString());
             }
@@ -282,6 +325,7 @@ namespace Utils
             {
                 throw std::runtime_error("Error deleting data: " + status.ToString());
             }
+            m_compactionHandle->noteWrite();
         }
 
         /**
@@ -294,6 +338,70 @@ namespace Utils
             delete_(key, "");
         }
 
+        /**
+         * @brief Delete every key in the range [beginKey, endKey) with a single range tombstone.
+         *
+         * Unlike deleting the keys one at a time, a range deletion writes one tombstone covering the whole
+         * range, so bulk removals stay cheap no matter how many keys they cover. The write is counted on the
+         * compaction handle, so the idle-window scheduler reclaims the dropped range afterwards.
+         *
+         * @param beginKey First key of the range, inclusive.
+         * @param endKey End key of the range, exclusive.
+         * @param columnName Column name from where to delete. If empty, the default column will be used.
+         */
+        void deleteRange(const std::string& beginKey, const std::string& endKey, const std::string& columnName = "")
+        {
+            if (beginKey.empty() || endKey.empty())
+            {
+                throw std::invalid_argument("Key is empty");
+            }
+
+            rocksdb::WriteOptions writeOptions;
+            writeOptions.disableWAL = !m_enableWal;
+
+            const auto status {
+                m_db->DeleteRange(writeOptions, getColumnFamilyBasedOnName(columnName).handle(), beginKey, endKey)};
+            if (!status.ok())
+            {
+                throw std::runtime_error("Error deleting range: " + status.ToString());
+            }
+            m_compactionHandle->noteWrite();
+        }
+
+        /**
+         * @brief Delete every key sharing a prefix with a single range tombstone.
+         *
+         * @param prefix Key prefix to delete, e.g. an agent id prefix.
+         * @param columnName Column name from where to delete. If empty, the default column will be used.
+         */
+        void deleteByPrefix(const std::string& prefix, const std::string& columnName = "")
+        {
+            if (prefix.empty())
+            {
+                throw std::invalid_argument("Prefix is empty");
+            }
+
+            // Upper bound: the shortest key strictly greater than every key sharing the prefix.
+            auto endKey {prefix};
+            while (!endKey.empty() && static_cast<unsigned char>(endKey.back()) == 0xFF)
+            {
+                endKey.pop_back();
+            }
+
+            if (endKey.empty())
+            {
+                // The prefix is all 0xFF bytes and has no finite upper bound, fall back to per-key deletes.
+                for (const auto& [key, value] : seekPrefix(prefix, columnName))
+                {
+                    delete_(key, columnName);
+                }
+                return;
+            }
+
+            endKey.back() = static_cast<char>(static_cast<unsigned char>(endKey.back()) + 1);
+            deleteRange(prefix, endKey, columnName);
+        }
+
         /**
          * @brief Get the last key-value pair from the database.
          *
@@ -329,6 +437,32 @@ namespace Utils
                     key};
         }
 
+        /**
+         * @brief Seek to a specific key prefix, bounding the scan to the keys that share it.
+         *
+         * On columns created with a prefix length, the iteration uses the prefix bloom filters to skip SST blocks
+         * without matching keys. On columns without a prefix extractor the scan falls back to total order iteration,
+         * with the same results.
+         *
+         * @param prefix Key prefix to scan. It should be at least as long as the column prefix length, if any.
+         * @param columnName Column name to scan. If empty, the default column will be used.
+         * @param readaheadSize Readahead size in bytes for the iteration. If zero, no readahead is performed. Large
+         * sequential scans over spinning disks benefit from sizes of 2MB or more.
+         * @return RocksDBIterator Iterator to the database.
+         */
+        RocksDBIterator seekPrefix(std::string_view prefix,
+                                   const std::string& columnName = "",
+                                   const size_t readaheadSize = 0) override
+        {
+            rocksdb::ReadOptions readOptions;
+            readOptions.prefix_same_as_start = true;
+            readOptions.readahead_size = readaheadSize;
+
+            return {std::shared_ptr<rocksdb::Iterator>(
+                        m_db->NewIterator(readOptions, getColumnFamilyBasedOnName(columnName).handle())),
+                    prefix};
+        }
+
         /**
          * @brief Get an iterator to the database.
          * @return RocksDBIterator Iterator to the database.
@@ -398,6 +532,23 @@ namespace Utils
             m_db->CompactRange(compactOptions, nullptr, nullptr);
         }
 
+        /**
+         * @brief Gets the value of a RocksDB property for a column family.
+         *
+         * @param property Property name, e.g. "rocksdb.estimate-num-keys" or "rocksdb.levelstats".
+         * @param columnName Column name to query. If empty, the default column will be used.
+         * @return std::string Property value.
+         */
+        std::string getProperty(const std::string& property, const std::string& columnName = "")
+        {
+            std::string value;
+            if (!m_db->GetProperty(getColumnFamilyBasedOnName(columnName).handle(), property, &value))
+            {
+                throw std::runtime_error {"Failed to get property: " + property};
+            }
+            return value;
+        }
+
         /**
          * @brief Initialize transaction.
          * @return RocksDBTransaction Transaction object.
@@ -420,6 +571,20 @@ namespace Utils
          * @param columnName Name of the new column.
          */
         void createColumn(const std::string& columnName) override
+        {
+            createColumn(columnName, 0);
+        }
+
+        /**
+         * @brief Creates a new column family in the database with a fixed key prefix extractor.
+         *
+         * @note The column handle created is also added to the handles list to be then accessible by other methods.
+         *
+         * @param columnName Name of the new column.
+         * @param prefixLength Length of the fixed key prefix used to speed up seekPrefix() scans. If zero, no prefix
+         * extractor is configured.
+         */
+        void createColumn(const std::string& columnName, const size_t prefixLength)
         {
             if (columnName.empty())
             {
@@ -429,7 +594,7 @@ namespace Utils
             rocksdb::ColumnFamilyHandle* pColumnFamily;
 
             if (const auto status {m_db->CreateColumnFamily(
-                    RocksDBOptions::buildColumnFamilyOptions(m_readCache), columnName, &pColumnFamily)};
+                    RocksDBOptions::buildColumnFamilyOptions(m_readCache, prefixLength), columnName, &pColumnFamily)};
                 !status.ok())
             {
                 throw std::runtime_error {"Couldn't create column family: " + std::string {status.getState()}};
@@ -657,6 +822,7 @@ namespace Utils
         const std::string m_path;                                    ///< Location of the DB.
         std::shared_ptr<rocksdb::Cache> m_readCache;                 ///< Cache for read operations.
         std::shared_ptr<rocksdb::WriteBufferManager> m_writeManager; ///< Write buffer manager.
+        std::shared_ptr<RocksDBCompactionScheduler::StoreHandle> m_compactionHandle; ///< Idle compaction handle.
 
         /**
          * @brief Returns the column family handle identified by its name.
@@ -908,6 +1074,21 @@ namespace Utils
             return m_dbWrapper->seek(key, columnName);
         }
 
+        /**
+         * @brief Seek to a specific key prefix, bounding the scan to the keys that share it.
+         *
+         * @param prefix Key prefix to scan.
+         * @param columnName Column family name.
+         * @param readaheadSize Readahead size in bytes for the iteration. If zero, no readahead is performed.
+         * @return RocksDBIterator Iterator to the database.
+         */
+        RocksDBIterator seekPrefix(std::string_view prefix,
+                                   const std::string& columnName = "",
+                                   const size_t readaheadSize = 0) override
+        {
+            return m_dbWrapper->seekPrefix(prefix, columnName, readaheadSize);
+        }
+
         /**
          * @brief Flushes the transaction.
          */
@@ -16,10 +16,13 @@
 #include "osPrimitives.hpp"
 #include "socketWrapper.hpp"
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <filesystem>
 #include <functional>
+#include <future>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -30,6 +33,218 @@
 
 constexpr auto CLIENT_EPOLL_EVENTS = 32;
 
+// Shared epoll loop for clients created in shared-loop mode. Several SocketClient instances
+// register their descriptors here and are served by one reactor thread, instead of each client
+// spawning its own epoll thread.
+template<typename TEpoll>
+class SocketClientReactor final
+{
+private:
+    struct TimedTask
+    {
+        const void* owner;
+        std::function<void()> task;
+    };
+
+    std::shared_ptr<TEpoll> m_epoll;
+    std::thread m_loopThread;
+    std::atomic<bool> m_shouldStop;
+    int m_wakeFD[2] = {-1, -1};
+    std::mutex m_mutex;
+    std::map<int, std::function<void(uint32_t)>> m_handlers;
+    std::multimap<std::chrono::steady_clock::time_point, TimedTask> m_timedTasks;
+
+    int nextTimeout()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_timedTasks.empty())
+        {
+            return -1;
+        }
+        const auto remaining {std::chrono::duration_cast<std::chrono::milliseconds>(m_timedTasks.begin()->first -
+                                                                                    std::chrono::steady_clock::now())
+                                  .count()};
+        return remaining > 0 ? static_cast<int>(remaining) : 0;
+    }
+
+    void runExpiredTasks()
+    {
+        std::vector<std::function<void()>> expiredTasks;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto now {std::chrono::steady_clock::now()};
+            while (!m_timedTasks.empty() && m_timedTasks.begin()->first <= now)
+            {
+                expiredTasks.push_back(std::move(m_timedTasks.begin()->second.task));
+                m_timedTasks.erase(m_timedTasks.begin());
+            }
+        }
+
+        for (const auto& task : expiredTasks)
+        {
+            try
+            {
+                task();
+            }
+            catch (const std::exception& e)
+            {
+                // Error running timed task
+            }
+        }
+    }
+
+    void mainLoop()
+    {
+        std::vector<struct epoll_event> events(CLIENT_EPOLL_EVENTS);
+        while (!m_shouldStop)
+        {
+            try
+            {
+                auto numFDsReady = m_epoll->wait(events.data(), events.size(), nextTimeout());
+
+                for (int i = 0; i < numFDsReady; ++i)
+                {
+                    auto eventFD {events.at(i).data.fd};
+                    if (eventFD == m_wakeFD[0])
+                    {
+                        // Drain the wake pipe; the stop flag and the timed tasks are re-evaluated below.
+                        char dummy;
+                        while (::read(m_wakeFD[0], &dummy, sizeof(dummy)) > 0) {}
+                        continue;
+                    }
+
+                    // Dispatch without holding the lock; unregister() synchronizes with this.
+                    std::function<void(uint32_t)> handler;
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        if (const auto it {m_handlers.find(eventFD)}; it != m_handlers.end())
+                        {
+                            handler = it->second;
+                        }
+                    }
+
+                    if (handler)
+                    {
+                        try
+                        {
+                            handler(events.at(i).events);
+                        }
+                        catch (const std::exception& e)
+                        {
+                            // A failing client must not take the shared loop down.
+                            unregister(nullptr, eventFD);
+                        }
+                    }
+                }
+
+                runExpiredTasks();
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "Error in epoll: " << e.what() << std::endl;
+                m_shouldStop = true;
+            }
+        }
+    }
+
+    void wake()
+    {
+        char dummy = 'x';
+        std::ignore = ::write(m_wakeFD[1], &dummy, sizeof(dummy));
+    }
+
+public:
+    SocketClientReactor()
+        : m_epoll {std::make_shared<TEpoll>()}
+        , m_shouldStop {false}
+    {
+        if (::pipe(m_wakeFD) == -1)
+        {
+            throw std::runtime_error("Failed to create wake pipe");
+        }
+
+        if (::fcntl(m_wakeFD[0], F_SETFL, O_NONBLOCK) == -1)
+        {
+            throw std::runtime_error("Failed to set wake pipe to non-blocking");
+        }
+
+        m_epoll->addDescriptor(m_wakeFD[0], EPOLLIN | EPOLLET);
+        m_loopThread = std::thread(&SocketClientReactor::mainLoop, this);
+    }
+
+    ~SocketClientReactor()
+    {
+        stop();
+        ::close(m_wakeFD[0]);
+        ::close(m_wakeFD[1]);
+    }
+
+    void stop()
+    {
+        m_shouldStop = true;
+        wake();
+        if (m_loopThread.joinable())
+        {
+            m_loopThread.join();
+        }
+    }
+
+    void addDescriptor(const int fd, const uint32_t events, std::function<void(uint32_t)> handler)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_handlers[fd] = std::move(handler);
+        }
+        m_epoll->addDescriptor(fd, events);
+    }
+
+    void modifyDescriptor(const int fd, const uint32_t events)
+    {
+        m_epoll->modifyDescriptor(fd, events);
+    }
+
+    // Schedules a task on the loop thread after the given delay; used by the clients for
+    // reconnection backoff so connect retries never block the shared loop.
+    void post(const void* owner, std::function<void()> task, const std::chrono::milliseconds delay)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_timedTasks.emplace(std::chrono::steady_clock::now() + delay, TimedTask {owner, std::move(task)});
+        }
+        wake();
+    }
+
+    // Removes the descriptor and the pending tasks of a client, then waits until the loop has gone
+    // past the removal so no callback of the owner is still running on the loop thread.
+    void unregister(const void* owner, const int fd)
+    {
+        if (fd != -1)
+        {
+            m_epoll->deleteDescriptor(fd);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (fd != -1)
+            {
+                m_handlers.erase(fd);
+            }
+
+            for (auto it = m_timedTasks.begin(); it != m_timedTasks.end();)
+            {
+                it = (it->second.owner == owner && owner) ? m_timedTasks.erase(it) : std::next(it);
+            }
+        }
+
+        if (!m_shouldStop && std::this_thread::get_id() != m_loopThread.get_id())
+        {
+            std::promise<void> barrier;
+            post(this, [&barrier]() { barrier.set_value(); }, std::chrono::milliseconds(0));
+            barrier.get_future().wait_for(std::chrono::seconds(1));
+        }
+    }
+};
+
 template<typename TSocket, typename TEpoll>
 class SocketClient final
 {
@@ -38,11 +253,29 @@ private:
     std::thread m_mainLoopThread;
     std::shared_ptr<TEpoll> m_epoll;
     std::shared_ptr<TSocket> m_socket;
+    std::shared_ptr<SocketClientReactor<TEpoll>> m_reactor;
     std::atomic<bool> m_shouldStop;
     std::condition_variable_any m_cv;
     std::mutex m_mutex;
     int m_stopFD[2] = {-1, -1};
     std::shared_mutex m_socketMutex;
+    std::function<void(const char*, uint32_t, const char*, uint32_t)> m_onRead;
+    std::function<void()> m_onConnect;
+    std::atomic<bool> m_afterConnect {false};
+    bool m_registered {false};
+    int m_type {SOCK_STREAM | SOCK_NONBLOCK};
+
+    void modifySocketEvents(const uint32_t events)
+    {
+        if (m_reactor)
+        {
+            m_reactor->modifyDescriptor(m_socket->fileDescriptor(), events);
+        }
+        else
+        {
+            m_epoll->modifyDescriptor(m_socket->fileDescriptor(), events);
+        }
+    }
 
     void sendPendingMessages()
     {
@@ -50,7 +283,7 @@ private:
         {
             std::lock_guard<std::shared_mutex> lock(m_socketMutex);
             m_socket->sendUnsentMessages();
-            m_epoll->modifyDescriptor(m_socket->fileDescriptor(), EPOLLIN);
+            modifySocketEvents(EPOLLIN);
         }
         catch (const std::exception& e)
         {
@@ -58,11 +291,70 @@ private:
         }
     }
 
+    void handleReactorEvent(const uint32_t event)
+    {
+        if (event & EPOLLERR || event & EPOLLHUP)
+        {
+            // The descriptor changes on reconnection; any further event of this batch is stale.
+            m_reactor->unregister(this, m_socket->fileDescriptor());
+            tryReactorConnect(1);
+            return;
+        }
+
+        if (event & EPOLLOUT)
+        {
+            if (m_afterConnect.exchange(false))
+            {
+                m_onConnect();
+            }
+            sendPendingMessages();
+        }
+
+        if (event & EPOLLIN)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_socketMutex);
+            m_socket->read([&](const int, const char* body, uint32_t bodySize, const char* header, uint32_t headerSize)
+                           { m_onRead(body, bodySize, header, headerSize); });
+        }
+    }
+
+    void tryReactorConnect(const int delay)
+    {
+        if (m_shouldStop)
+        {
+            return;
+        }
+
+        // Build the address.
+        auto unixAddress {UnixAddress::builder().address(m_socketPath).build()};
+        constexpr auto MAX_DELAY = 30;
+
+        try
+        {
+            {
+                std::lock_guard<std::shared_mutex> lock(m_socketMutex);
+                m_socket->connect(unixAddress.data(), m_type);
+            }
+            m_afterConnect = true;
+            m_reactor->addDescriptor(m_socket->fileDescriptor(),
+                                     EPOLLIN | EPOLLOUT,
+                                     [this](const uint32_t event) { handleReactorEvent(event); });
+        }
+        catch (const std::exception& e)
+        {
+            // Failure to connect to socket: retry with backoff, without blocking the shared loop.
+            const auto nextDelay {std::min(delay * 2, MAX_DELAY)};
+            m_reactor->post(
+                this, [this, nextDelay]() { tryReactorConnect(nextDelay); }, std::chrono::seconds(delay));
+        }
+    }
+
 public:
-    explicit SocketClient(std::string socketPath)
+    explicit SocketClient(std::string socketPath, std::shared_ptr<SocketClientReactor<TEpoll>> reactor = nullptr)
         : m_socketPath {std::move(socketPath)}
         , m_epoll {std::make_shared<TEpoll>()}
         , m_socket {std::make_shared<TSocket>()}
+        , m_reactor {std::move(reactor)}
         , m_shouldStop {false}
     {
         int result = ::pipe(m_stopFD);
@@ -91,6 +383,16 @@ public:
     {
         m_shouldStop = true;
 
+        if (m_reactor)
+        {
+            if (m_registered)
+            {
+                m_reactor->unregister(this, m_socket->fileDescriptor());
+                m_registered = false;
+            }
+            return;
+        }
+
         char dummy = 'x';
         std::ignore = ::write(m_stopFD[1], &dummy, sizeof(dummy));
 
@@ -111,6 +413,23 @@ public:
         const std::function<void()>& onConnect = []() {},
         int type = (SOCK_STREAM | SOCK_NONBLOCK))
     {
+        // Shared-loop mode: the reactor thread serves this client, no dedicated thread is spawned.
+        if (m_reactor)
+        {
+            // If the client is already registered, then return, this case happens when the client is
+            // restarted/reconnected.
+            if (m_registered)
+            {
+                return;
+            }
+            m_registered = true;
+            m_onRead = onRead;
+            m_onConnect = onConnect;
+            m_type = type;
+            tryReactorConnect(1);
+            return;
+        }
+
         // If the thread is already running, then return, this case happens when the client is restarted/reconnected.
         if (m_mainLoopThread.joinable())
         {
@@ -222,8 +541,8 @@ public:
         }
         catch (const std::exception& e)
         {
-            // Error sending message
-            m_epoll->modifyDescriptor(m_socket->fileDescriptor(), EPOLLIN | EPOLLOUT);
+            // Error sending message: the unsent queue coalesces it until the loop reports EPOLLOUT.
+            modifySocketEvents(EPOLLIN | EPOLLOUT);
         }
     }
 };
@@ -16,8 +16,11 @@
 #include "singleton.hpp"
 #include "socketClient.hpp"
 #include "socketDBWrapperException.hpp"
-#include <condition_variable>
+#include "wazuhDBQueryBuilder.hpp"
+#include <future>
+#include <memory>
 #include <mutex>
+#include <queue>
 #include <string>
 #include <utility>
 
@@ -51,9 +54,45 @@ private:
     DbQueryStatus m_queryStatus {DbQueryStatus::UNKNOWN};
     std::mutex m_mutexMessage;
     std::mutex m_mutexResponse;
-    std::condition_variable m_conditionVariable;
+    std::queue<std::shared_ptr<std::promise<nlohmann::json>>> m_pendingQueries;
     bool m_teardown {false};
-    bool m_dataReady {false};
+
+    /**
+     * @brief Completes the oldest in-flight query with the accumulated response or error.
+     *
+     * Must be called with m_mutexResponse held. wazuh-db answers queries in the order they were
+     * sent over the socket, so the front of the pending queue always owns the current response.
+     */
+    void settleFrontQuery()
+    {
+        if (!m_pendingQueries.empty())
+        {
+            const auto spPromise {std::move(m_pendingQueries.front())};
+            m_pendingQueries.pop();
+
+            if (!m_exceptionStr.empty())
+            {
+                if (DbQueryStatus::QUERY_NOT_SYNCED == m_queryStatus)
+                {
+                    spPromise->set_exception(std::make_exception_ptr(SocketDbWrapperException(m_exceptionStr)));
+                }
+                else
+                {
+                    spPromise->set_exception(std::make_exception_ptr(std::runtime_error(m_exceptionStr)));
+                }
+            }
+            else
+            {
+                spPromise->set_value(std::move(m_response));
+            }
+        }
+
+        // Reset the accumulation state for the next in-flight query.
+        m_response.clear();
+        m_responsePartial.clear();
+        m_exceptionStr.clear();
+        m_queryStatus = DbQueryStatus::UNKNOWN;
+    }
 
 public:
     void init(const std::string& socketPath = WDB_SOCKET)
@@ -146,57 +185,72 @@ public:
                         m_queryStatus = DbQueryStatus::INVALID_RESPONSE;
                         m_exceptionStr = "DB query invalid response: " + responsePacket;
                     }
-                    m_dataReady = true;
-                    m_conditionVariable.notify_one();
+                    settleFrontQuery();
                 }
             });
     }
 
-    void query(const std::string& query, nlohmann::json& response)
+    /**
+     * @brief Sends a query without waiting for its response.
+     *
+     * Queries are pipelined over the single wazuh-db connection: several can be in flight at once
+     * and their responses are matched to the callers in send order. Callers overlapping many
+     * queries wait once on the returned futures instead of paying one round trip each.
+     *
+     * @param query Query to be executed.
+     * @return std::future<nlohmann::json> Future holding the query response, or the query error.
+     */
+    std::future<nlohmann::json> queryAsync(const std::string& query)
     {
         // Acquire lock to avoid multiple threads sending queries at the same time
         std::scoped_lock lockMessage {m_mutexMessage};
 
+        auto spPromise {std::make_shared<std::promise<nlohmann::json>>()};
+        auto future {spPromise->get_future()};
+
+        // Acquire lock so that the pending queue order matches the send order
+        std::scoped_lock lockResponse {m_mutexResponse};
+
         if (m_teardown)
         {
-            return;
+            spPromise->set_value(nlohmann::json {});
+            return future;
         }
 
-        // Acquire lock before clearing the response
-        std::unique_lock lockResponse {m_mutexResponse};
-
-        m_dataReady = false;
-        m_response.clear();
-        m_responsePartial.clear();
-        // coverity[missing_lock]
-        m_exceptionStr.clear();
-
         if (!m_dbSocket)
         {
             throw std::runtime_error("Socket DB Wrapper not initialized");
         }
 
+        m_pendingQueries.push(std::move(spPromise));
         m_dbSocket->send(query.c_str(), query.size());
-        m_conditionVariable.wait(lockResponse, [this] { return m_dataReady || m_teardown; });
 
-        if (!m_exceptionStr.empty())
+        return future;
+    }
+
+    void query(const std::string& query, nlohmann::json& response)
+    {
+        if (m_teardown)
         {
-            // coverity[missing_lock]
-            switch (m_queryStatus)
-            {
-                case DbQueryStatus::QUERY_NOT_SYNCED: throw SocketDbWrapperException(m_exceptionStr); break;
-                case DbQueryStatus::EMPTY_RESPONSE:
-                case DbQueryStatus::UNKNOWN:
-                case DbQueryStatus::QUERY_ERROR:
-                case DbQueryStatus::QUERY_UNKNOWN:
-                case DbQueryStatus::QUERY_IGNORE:
-                case DbQueryStatus::JSON_PARSING:
-                case DbQueryStatus::INVALID_RESPONSE:
-                default: throw std::runtime_error(m_exceptionStr); break;
-            }
+            return;
         }
 
-        response = m_response;
+        response = queryAsync(query).get();
+    }
+
+    /**
+     * @brief Executes a compiled query template with the given arguments.
+     *
+     * The template assembles the query into its own reused buffer, so repeated structurally
+     * identical queries only pay for argument substitution.
+     *
+     * @param queryTemplate Compiled query template.
+     * @param args One argument per parameter slot of the template, in slot order.
+     * @param response The response of the query.
+     */
+    void query(WazuhDBQueryTemplate& queryTemplate, const std::vector<std::string>& args, nlohmann::json& response)
+    {
+        query(queryTemplate.format(args), response);
     }
 
     /**
@@ -205,9 +259,22 @@ public:
      */
     void teardown()
     {
-        m_teardown = true;
-        m_conditionVariable.notify_all();
-        m_dbSocket->stop();
+        {
+            std::scoped_lock lockResponse {m_mutexResponse};
+            m_teardown = true;
+
+            // Release every caller still waiting on a response.
+            while (!m_pendingQueries.empty())
+            {
+                m_pendingQueries.front()->set_value(nlohmann::json {});
+                m_pendingQueries.pop();
+            }
+        }
+
+        if (m_dbSocket)
+        {
+            m_dbSocket->stop();
+        }
     }
 };
 
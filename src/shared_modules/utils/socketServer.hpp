@@ -39,6 +39,7 @@ private:
     std::unordered_map<int, std::shared_ptr<TSocket>> m_clients {};
     std::thread m_listenThread;
     std::mutex m_mutex;
+    const bool m_edgeTriggered;
 
     std::shared_ptr<TSocket> getClient(const int fd)
     {
@@ -58,12 +59,17 @@ private:
         m_clients[fd] = std::move(client);
     }
 
+    uint32_t clientEventMask() const
+    {
+        return m_edgeTriggered ? (EPOLLIN | EPOLLET) : EPOLLIN;
+    }
+
     void sendPendingMessages(std::shared_ptr<TSocket> client)
     {
         try
         {
             client->sendUnsentMessages();
-            m_epoll->modifyDescriptor(client->fileDescriptor(), EPOLLIN);
+            m_epoll->modifyDescriptor(client->fileDescriptor(), clientEventMask());
         }
         catch (const std::exception& e)
         {
@@ -72,12 +78,20 @@ private:
     }
 
 public:
-    explicit SocketServer(std::string socketPath)
+    /**
+     * @brief Constructor.
+     *
+     * @param socketPath Path of the UNIX socket to serve.
+     * @param edgeTriggered If true, client descriptors are registered in edge-triggered mode, so each burst of
+     * data raises a single wakeup that is drained to completion instead of one wakeup per readiness check.
+     */
+    explicit SocketServer(std::string socketPath, const bool edgeTriggered = false)
         : m_socketPath {std::move(socketPath)}
         , m_shouldStop {false}
         , m_epoll {std::make_unique<TEpoll>()}
         , m_listenSocket {std::make_unique<TSocket>()}
         , m_clients {}
+        , m_edgeTriggered {edgeTriggered}
     {
         int result = pipe(m_stopFD);
         if (result == -1)
@@ -150,15 +164,25 @@ public:
                         // If the event is on the server socket, then it's a new connection
                         if (eventFD == m_listenSocket->fileDescriptor())
                         {
-                            try
-                            {
-                                const auto clientFD = m_listenSocket->accept();
-                                addClient(clientFD, std::make_shared<TSocket>(clientFD));
-                                m_epoll->addDescriptor(clientFD, EPOLLIN);
-                            }
-                            catch (const std::exception& e)
+                            // In edge-triggered mode every queued connection must be accepted on this wakeup.
+                            auto acceptPending {true};
+                            while (acceptPending)
                             {
-                                std::cerr << "Failed to initialize client socket: " << e.what() << std::endl;
+                                try
+                                {
+                                    const auto clientFD = m_listenSocket->accept();
+                                    addClient(clientFD, std::make_shared<TSocket>(clientFD));
+                                    m_epoll->addDescriptor(clientFD, clientEventMask());
+                                }
+                                catch (const std::exception& e)
+                                {
+                                    if (errno != EAGAIN && errno != EWOULDBLOCK)
+                                    {
+                                        std::cerr << "Failed to initialize client socket: " << e.what() << std::endl;
+                                    }
+                                    acceptPending = false;
+                                }
+                                acceptPending = acceptPending && m_edgeTriggered;
                             }
                         }
                         else if (eventFD == m_stopFD[0])
@@ -218,7 +242,7 @@ public:
         }
         catch (const std::exception& e)
         {
-            m_epoll->modifyDescriptor(fd, EPOLLIN | EPOLLOUT);
+            m_epoll->modifyDescriptor(fd, clientEventMask() | EPOLLOUT);
         }
     }
 };
@@ -15,6 +15,7 @@
 #include "osPrimitives.hpp"
 #include "packet.hpp"
 #include <arpa/inet.h>
+#include <array>
 #include <chrono>
 #include <cstring>
 #include <filesystem>
@@ -25,7 +26,9 @@
 #include <mutex>
 #include <queue>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <thread>
+#include <tuple>
 #include <unistd.h>
 
 constexpr auto INVALID_SOCKET {-1};
@@ -208,6 +211,39 @@ public:
         PacketFieldType packetSize;
         HeaderFieldType headerSize;
     };
+
+    /**
+     * @brief Builds the scatter-gather vector to send according to this protocol, without copying the payload.
+     *
+     * @param iov           Output IO vector. The entries point at the header and at the caller's buffers.
+     * @param header        Protocol header storage, written by this method. It must outlive the send call.
+     * @param dataBody      Data to send.
+     * @param sizeBody      Size of the data to send.
+     * @param dataHeader    Optional header to send.
+     * @param sizeHeader    Size of the optional header.
+     * @return size_t Number of used IO vector entries.
+     */
+    size_t static buildIOVector(std::array<iovec, 3>& iov,
+                                Header& header,
+                                const char* dataBody,
+                                uint32_t sizeBody,
+                                const char* dataHeader = nullptr,
+                                uint32_t sizeHeader = 0)
+    {
+        header.packetSize = sizeBody + sizeof(Header::headerSize) + sizeHeader;
+        header.headerSize = sizeHeader;
+
+        size_t count {0};
+        iov[count++] = {&header, sizeof(Header)};
+
+        if (sizeHeader > 0)
+        {
+            iov[count++] = {const_cast<char*>(dataHeader), sizeHeader};
+        }
+
+        iov[count++] = {const_cast<char*>(dataBody), sizeBody};
+        return count;
+    }
 };
 
 /**
@@ -289,6 +325,34 @@ public:
     {
         PacketFieldType packetSize;
     };
+
+    /**
+     * @brief Builds the scatter-gather vector to send according to this protocol, without copying the payload.
+     *
+     * @param iov           Output IO vector. The entries point at the header and at the caller's buffers.
+     * @param header        Protocol header storage, written by this method. It must outlive the send call.
+     * @param dataBody      Data to send.
+     * @param sizeBody      Size of the data to send.
+     * @param dataHeader    Optional header to send.
+     * @param sizeHeader    Size of the optional header.
+     * @return size_t Number of used IO vector entries.
+     */
+    size_t static buildIOVector(std::array<iovec, 3>& iov,
+                                Header& header,
+                                const char* dataBody,
+                                uint32_t sizeBody,
+                                const char* dataHeader = nullptr,
+                                uint32_t sizeHeader = 0)
+    {
+        std::ignore = dataHeader;
+        std::ignore = sizeHeader;
+
+        header.packetSize = sizeBody;
+
+        iov[0] = {&header, sizeof(Header)};
+        iov[1] = {const_cast<char*>(dataBody), sizeBody};
+        return 2;
+    }
 };
 
 /**
@@ -356,6 +420,40 @@ public:
     {
         return 0;
     }
+
+    /**
+     * @brief This protocol has no header: the structure exists to keep the protocol interface uniform.
+     *
+     */
+    struct Header
+    {
+    };
+
+    /**
+     * @brief Builds the scatter-gather vector to send according to this protocol, without copying the payload.
+     *
+     * @param iov           Output IO vector. The single entry points at the caller's buffer.
+     * @param header        Unused for this protocol.
+     * @param dataBody      Data to send.
+     * @param sizeBody      Size of the data to send.
+     * @param dataHeader    Optional header to send.
+     * @param sizeHeader    Size of the optional header.
+     * @return size_t Number of used IO vector entries.
+     */
+    size_t static buildIOVector(std::array<iovec, 3>& iov,
+                                Header& header,
+                                const char* dataBody,
+                                uint32_t sizeBody,
+                                const char* dataHeader = nullptr,
+                                uint32_t sizeHeader = 0)
+    {
+        std::ignore = header;
+        std::ignore = dataHeader;
+        std::ignore = sizeHeader;
+
+        iov[0] = {const_cast<char*>(dataBody), sizeBody};
+        return 1;
+    }
 };
 
 enum class SocketStatus
@@ -386,9 +484,40 @@ private:
     uint32_t m_totalReadSize;
     std::vector<char> m_recvDataBuffer {};
     std::vector<char> m_sendDataBuffer {};
-    std::queue<Packet> m_unsentPacketList {};
+    std::queue<std::unique_ptr<Packet>> m_unsentPacketList {};
+    PacketPool m_packetPool {};
     std::mutex m_mutex;
 
+    /**
+     * @brief Copies the remainder of a scatter-gather vector into a pooled packet and queues it as unsent.
+     *
+     * @param iov IO vector with the pending entries.
+     * @param iovCount Number of pending entries.
+     */
+    void enqueueUnsent(const iovec* iov, size_t iovCount)
+    {
+        size_t totalSize {0};
+        for (size_t i = 0; i < iovCount; ++i)
+        {
+            totalSize += iov[i].iov_len;
+        }
+
+        auto packet {m_packetPool.acquire()};
+        packet->reserve(totalSize + 1);
+
+        size_t copied {0};
+        for (size_t i = 0; i < iovCount; ++i)
+        {
+            const auto* base {static_cast<const char*>(iov[i].iov_base)};
+            std::copy(base, base + iov[i].iov_len, packet->data.get() + copied);
+            copied += iov[i].iov_len;
+        }
+
+        packet->size = totalSize;
+        packet->offset = 0;
+        m_unsentPacketList.push(std::move(packet));
+    }
+
 public:
     explicit Socket(const int sock = INVALID_SOCKET)
         : m_sock {sock}
@@ -632,7 +761,7 @@ public:
         std::lock_guard<std::mutex> lock {m_mutex};
         while (!m_unsentPacketList.empty())
         {
-            auto& packet = m_unsentPacketList.front();
+            auto& packet = *m_unsentPacketList.front();
             auto ret = T::send(m_sock, packet.data.get() + packet.offset, packet.size - packet.offset, MSG_NOSIGNAL);
             if (ret <= 0)
             {
@@ -647,14 +776,15 @@ public:
             }
             else
             {
-                if (ret != packet.size)
+                if (ret != packet.size - packet.offset)
                 {
                     // In this case we need to send the rest of the data, when the next send is called.
                     packet.offset += ret;
                 }
                 else
                 {
-                    // We have sent the entire packet, remove it from the queue.
+                    // We have sent the entire packet, recycle it through the pool.
+                    m_packetPool.release(std::move(m_unsentPacketList.front()));
                     m_unsentPacketList.pop();
                 }
             }
@@ -663,33 +793,52 @@ public:
 
     void send(const char* dataBody, uint32_t sizeBody, const char* dataHeader = nullptr, uint32_t sizeHeader = 0)
     {
-        uint32_t bufferSize {0};
-        ssize_t amountSent {0};
         std::lock_guard<std::mutex> lock {m_mutex};
 
-        TCommunicationProtocol::buildBuffer(m_sendDataBuffer, bufferSize, dataBody, sizeBody, dataHeader, sizeHeader);
+        // Build the scatter-gather vector: the protocol header lives on the stack and the payload entries point
+        // at the caller's buffers, so nothing is copied on the fast path.
+        typename TCommunicationProtocol::Header header {};
+        std::array<iovec, 3> iov {};
+        auto iovCount {TCommunicationProtocol::buildIOVector(iov, header, dataBody, sizeBody, dataHeader, sizeHeader)};
+        size_t iovIndex {0};
 
         // If there is data in the unsent queue, add it to the queue.
         if (!m_unsentPacketList.empty())
         {
-            m_unsentPacketList.emplace(m_sendDataBuffer.data(), bufferSize);
+            enqueueUnsent(iov.data(), iovCount);
         }
         else
         {
-            // Send the data.
-            while (bufferSize != amountSent)
+            // Send the whole vector with a single syscall per attempt.
+            while (iovIndex < iovCount)
             {
-                const auto ret =
-                    T::send(m_sock, m_sendDataBuffer.data() + amountSent, bufferSize - amountSent, MSG_NOSIGNAL);
+                msghdr message {};
+                message.msg_iov = &iov[iovIndex];
+                message.msg_iovlen = iovCount - iovIndex;
+
+                const auto ret = T::sendmsg(m_sock, &message, MSG_NOSIGNAL);
 
                 if (ret <= 0)
                 {
-                    m_unsentPacketList.emplace(m_sendDataBuffer.data() + amountSent, bufferSize - amountSent);
+                    enqueueUnsent(&iov[iovIndex], iovCount - iovIndex);
                     throw std::runtime_error {"Error sending data to socket: " + std::string(std::strerror(errno))};
                 }
-                else
+
+                // Advance the vector past the bytes already sent.
+                auto remaining {static_cast<size_t>(ret)};
+                while (remaining > 0 && iovIndex < iovCount)
                 {
-                    amountSent += ret;
+                    if (remaining >= iov[iovIndex].iov_len)
+                    {
+                        remaining -= iov[iovIndex].iov_len;
+                        ++iovIndex;
+                    }
+                    else
+                    {
+                        iov[iovIndex].iov_base = static_cast<char*>(iov[iovIndex].iov_base) + remaining;
+                        iov[iovIndex].iov_len -= remaining;
+                        remaining = 0;
+                    }
                 }
             }
         }
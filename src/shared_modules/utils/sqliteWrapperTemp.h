@@ -19,9 +19,13 @@
 #include "customDeleter.hpp"
 #include <iostream>
 #include <chrono>
+#include <functional>
+#include <list>
+#include <map>
 #include <sys/stat.h>
 #include <math.h>
 #include <stdexcept>
+#include <utility>
 
 using DBSyncExceptionType = const std::pair<int, std::string>;
 
@@ -300,6 +304,16 @@ namespace SQLite
             {
                 return sqlite3_changes(m_db.get());
             }
+
+            /**
+             *   Switches the database to WAL journaling with the given synchronous level, so readers
+             *   don't block the writer and commits avoid one fsync per transaction.
+            */
+            void enableWalMode(const std::string& synchronousLevel = "NORMAL")
+            {
+                execute("PRAGMA journal_mode = WAL;");
+                execute("PRAGMA synchronous = " + synchronousLevel + ";");
+            }
         private:
             std::shared_ptr<sqlite3> m_db;
     };
@@ -519,6 +533,116 @@ namespace SQLite
             const int m_bindParametersCount;
             int m_bindParametersIndex;
     };
+
+    /**
+     *   LRU cache of prepared statements keyed by SQL text. Repeated queries reuse the compiled
+     *   statement, already reset and ready to bind, instead of paying the parse cost per execution.
+    */
+    class StatementCache final
+    {
+        public:
+            explicit StatementCache(std::shared_ptr<IConnection>& connection,
+                                    const size_t capacity = DEFAULT_CAPACITY)
+                : m_connection{ connection }
+                , m_capacity{ capacity ? capacity : 1 }
+            {}
+
+            std::shared_ptr<IStatement> get(const std::string& query)
+            {
+                const auto it { m_statements.find(query) };
+
+                if (m_statements.end() != it)
+                {
+                    //Move the entry to the front of the usage list and hand out the reset statement.
+                    m_usage.splice(m_usage.begin(), m_usage, it->second.second);
+                    it->second.first->reset();
+                    return it->second.first;
+                }
+
+                if (m_statements.size() >= m_capacity)
+                {
+                    m_statements.erase(m_usage.back());
+                    m_usage.pop_back();
+                }
+
+                m_usage.push_front(query);
+                const auto stmt { std::make_shared<Statement>(m_connection, query) };
+                m_statements.emplace(query, std::make_pair(stmt, m_usage.begin()));
+                return stmt;
+            }
+
+            size_t size() const
+            {
+                return m_statements.size();
+            }
+        private:
+            static constexpr size_t DEFAULT_CAPACITY { 64 };
+            std::shared_ptr<IConnection> m_connection;
+            const size_t m_capacity;
+            std::list<std::string> m_usage;
+            std::map<std::string, std::pair<std::shared_ptr<IStatement>, std::list<std::string>::iterator>> m_statements;
+    };
+
+    /**
+     *   Groups write operations into transactions of up to a fixed batch size, so callers doing
+     *   many small writes don't pay one implicit transaction per operation. The tail of the batch
+     *   is committed by flush(), also called on destruction.
+    */
+    class TransactionBatcher final
+    {
+        public:
+            explicit TransactionBatcher(std::shared_ptr<IConnection>& connection,
+                                        const size_t batchSize = DEFAULT_BATCH_SIZE)
+                : m_connection{ connection }
+                , m_batchSize{ batchSize ? batchSize : 1 }
+                , m_pendingOperations{ 0 }
+            {}
+
+            ~TransactionBatcher()
+            {
+                try
+                {
+                    flush();
+                }
+                //dtor should never throw
+                // LCOV_EXCL_START
+                catch (...)
+                {}
+
+                // LCOV_EXCL_STOP
+            }
+
+            void run(const std::function<void()>& operation)
+            {
+                if (!m_spTransaction)
+                {
+                    m_spTransaction = std::make_unique<Transaction>(m_connection);
+                }
+
+                operation();
+
+                if (++m_pendingOperations >= m_batchSize)
+                {
+                    flush();
+                }
+            }
+
+            void flush()
+            {
+                if (m_spTransaction)
+                {
+                    m_spTransaction->commit();
+                    m_spTransaction.reset();
+                    m_pendingOperations = 0;
+                }
+            }
+        private:
+            static constexpr size_t DEFAULT_BATCH_SIZE { 1000 };
+            std::shared_ptr<IConnection> m_connection;
+            const size_t m_batchSize;
+            size_t m_pendingOperations;
+            std::unique_ptr<Transaction> m_spTransaction;
+    };
 }
 
 #endif // _SQLITE_WRAPPER_TEMP_H
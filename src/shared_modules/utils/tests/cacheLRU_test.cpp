@@ -9,6 +9,8 @@
  * Foundation.
  */
 
+#include <thread>
+#include <vector>
 #include "cacheLRU_test.h"
 #include "cacheLRU.hpp"
 
@@ -33,3 +35,92 @@ TEST_F(CacheLRUTest, insertAndMiss)
 
     EXPECT_FALSE(result.has_value());
 }
+
+TEST_F(CacheLRUTest, shardedInsertAndHit)
+{
+    auto cacheMemory = ShardedLRUCache<int, int>(16, 4);
+
+    EXPECT_NO_THROW(cacheMemory.insertKey(1, 10));
+    EXPECT_TRUE(cacheMemory.isHit(1));
+    EXPECT_EQ(cacheMemory.getValue(1).value(), 10);
+}
+
+TEST_F(CacheLRUTest, shardedInsertAndMiss)
+{
+    auto cacheMemory = ShardedLRUCache<int, int>(16, 4);
+
+    EXPECT_NO_THROW(cacheMemory.insertKey(10, 10));
+    auto result = cacheMemory.getValue(1);
+
+    EXPECT_FALSE(result.has_value());
+}
+
+TEST_F(CacheLRUTest, shardedTtlExpiry)
+{
+    auto cacheMemory = ShardedLRUCache<int, int>(16, 4, std::chrono::milliseconds(50));
+
+    EXPECT_NO_THROW(cacheMemory.insertKey(1, 10));
+    EXPECT_TRUE(cacheMemory.isHit(1));
+    EXPECT_EQ(cacheMemory.getValue(1).value(), 10);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_FALSE(cacheMemory.isHit(1));
+    EXPECT_FALSE(cacheMemory.getValue(1).has_value());
+
+    auto count = 0;
+    cacheMemory.forEach(
+        [&count](const int&, const int&)
+        {
+            ++count;
+            return true;
+        });
+    EXPECT_EQ(count, 0);
+}
+
+TEST_F(CacheLRUTest, shardedTtlDisabledByDefault)
+{
+    auto cacheMemory = ShardedLRUCache<int, int>(16, 4);
+
+    EXPECT_NO_THROW(cacheMemory.insertKey(1, 10));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_TRUE(cacheMemory.isHit(1));
+    EXPECT_EQ(cacheMemory.getValue(1).value(), 10);
+}
+
+TEST_F(CacheLRUTest, shardedConcurrentInsertAndGet)
+{
+    constexpr auto NUM_THREADS {4};
+    constexpr auto NUM_ELEMENTS {250};
+    auto cacheMemory = ShardedLRUCache<int, int>(NUM_THREADS * NUM_ELEMENTS * 2);
+    std::vector<std::thread> threads;
+
+    for (auto t = 0; t < NUM_THREADS; ++t)
+    {
+        threads.emplace_back(
+            [&cacheMemory, t]()
+            {
+                for (auto i = 0; i < NUM_ELEMENTS; ++i)
+                {
+                    const auto key = t * NUM_ELEMENTS + i;
+                    cacheMemory.insertKey(key, key);
+                    EXPECT_EQ(cacheMemory.getValue(key).value(), key);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto count = 0;
+    cacheMemory.forEach(
+        [&count](const int&, const int&)
+        {
+            ++count;
+            return true;
+        });
+    EXPECT_EQ(count, NUM_THREADS * NUM_ELEMENTS);
+}
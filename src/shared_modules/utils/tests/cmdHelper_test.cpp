@@ -27,4 +27,15 @@ TEST_F(CmdUtilsTest, CmdUname)
     const auto result{Utils::exec("uname")};
     EXPECT_FALSE(result.empty());
 }
+
+TEST_F(CmdUtilsTest, CmdUnameStream)
+{
+    std::string result;
+    Utils::execStream("uname",
+                      [&result](const char* data, size_t size)
+    {
+        result.append(data, size);
+    });
+    EXPECT_FALSE(result.empty());
+}
 #endif
\ No newline at end of file
@@ -29,3 +29,21 @@ TEST_F(EVPHelperTest, ValidEncryptionAndDecryption)
     ASSERT_EQ(decryptedData, inputData);
 }
 
+
+/**
+ * @brief Test the bulk interface round trip reusing one helper for every item.
+ *
+ */
+TEST_F(EVPHelperTest, ValidBulkEncryptionAndDecryption)
+{
+    const std::vector<std::string> inputs {"first secret", "second secret", "third secret"};
+    std::vector<std::vector<char>> encrypted;
+
+    EVPHelper helper;
+    helper.encryptAES256Bulk(inputs, encrypted);
+    ASSERT_EQ(encrypted.size(), inputs.size());
+
+    std::vector<std::string> decrypted;
+    EXPECT_NO_THROW(helper.decryptAES256Bulk(encrypted, decrypted));
+    ASSERT_EQ(decrypted, inputs);
+}
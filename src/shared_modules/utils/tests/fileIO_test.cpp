@@ -0,0 +1,132 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 28, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "fileIO_test.hpp"
+#include "fileIO.hpp"
+#include <fstream>
+#include <string>
+#include <vector>
+
+void FileIOTest::SetUp()
+{
+    std::filesystem::create_directories(TEST_DIRECTORY);
+}
+
+void FileIOTest::TearDown()
+{
+    std::filesystem::remove_all(TEST_DIRECTORY);
+}
+
+static void writeFile(const std::filesystem::path& filePath, const std::string& content)
+{
+    std::ofstream file(filePath, std::ios::binary);
+    file << content;
+}
+
+TEST_F(FileIOTest, ReadLineByLine)
+{
+    const auto filePath = std::filesystem::path(TEST_DIRECTORY) / "lines.txt";
+    writeFile(filePath, "first\nsecond\nthird\n");
+
+    std::vector<std::string> lines;
+    FileIO::readLineByLine(filePath,
+                           [&lines](const std::string& line)
+                           {
+                               lines.push_back(line);
+                               return true;
+                           });
+
+    EXPECT_EQ(lines, (std::vector<std::string> {"first", "second", "third"}));
+}
+
+TEST_F(FileIOTest, BufferedReaderYieldsAllLines)
+{
+    const auto filePath = std::filesystem::path(TEST_DIRECTORY) / "lines.txt";
+    writeFile(filePath, "first\nsecond\n\nfourth\n");
+
+    BufferedFileReader reader(filePath);
+    std::vector<std::string> lines;
+    std::string_view line;
+    while (reader.nextLine(line))
+    {
+        lines.emplace_back(line);
+    }
+
+    EXPECT_EQ(lines, (std::vector<std::string> {"first", "second", "", "fourth"}));
+}
+
+TEST_F(FileIOTest, BufferedReaderEmitsLastLineWithoutTrailingNewline)
+{
+    const auto filePath = std::filesystem::path(TEST_DIRECTORY) / "truncated.txt";
+    writeFile(filePath, "first\nlast without newline");
+
+    BufferedFileReader reader(filePath);
+    std::vector<std::string> lines;
+    std::string_view line;
+    while (reader.nextLine(line))
+    {
+        lines.emplace_back(line);
+    }
+
+    EXPECT_EQ(lines, (std::vector<std::string> {"first", "last without newline"}));
+}
+
+TEST_F(FileIOTest, BufferedReaderHandlesLinesLargerThanTheBuffer)
+{
+    const auto filePath = std::filesystem::path(TEST_DIRECTORY) / "big.txt";
+    const std::string bigLine(3 * 1024 * 1024, 'a');
+    writeFile(filePath, "small\n" + bigLine + "\nsmall again\n");
+
+    BufferedFileReader reader(filePath);
+    std::vector<std::string> lines;
+    std::string_view line;
+    while (reader.nextLine(line))
+    {
+        lines.emplace_back(line);
+    }
+
+    ASSERT_EQ(lines.size(), 3u);
+    EXPECT_EQ(lines[0], "small");
+    EXPECT_EQ(lines[1], bigLine);
+    EXPECT_EQ(lines[2], "small again");
+}
+
+TEST_F(FileIOTest, BufferedReaderEmptyFile)
+{
+    const auto filePath = std::filesystem::path(TEST_DIRECTORY) / "empty.txt";
+    writeFile(filePath, "");
+
+    BufferedFileReader reader(filePath);
+    std::string_view line;
+    EXPECT_FALSE(reader.nextLine(line));
+}
+
+TEST_F(FileIOTest, BufferedReaderDirectModeFallsBackWhenUnsupported)
+{
+    const auto filePath = std::filesystem::path(TEST_DIRECTORY) / "direct.txt";
+    writeFile(filePath, "first\nsecond\n");
+
+    BufferedFileReader reader(filePath, true);
+    std::vector<std::string> lines;
+    std::string_view line;
+    while (reader.nextLine(line))
+    {
+        lines.emplace_back(line);
+    }
+
+    EXPECT_EQ(lines, (std::vector<std::string> {"first", "second"}));
+}
+
+TEST_F(FileIOTest, BufferedReaderMissingFileThrows)
+{
+    EXPECT_THROW(BufferedFileReader reader(std::filesystem::path(TEST_DIRECTORY) / "missing.txt"),
+                 std::runtime_error);
+}
@@ -0,0 +1,29 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 28, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _FILEIO_TEST_HPP
+#define _FILEIO_TEST_HPP
+
+#include "gtest/gtest.h"
+
+constexpr auto TEST_DIRECTORY {"fileio_test_directory"};
+
+class FileIOTest : public ::testing::Test
+{
+protected:
+    FileIOTest() = default;
+    virtual ~FileIOTest() = default;
+
+    void SetUp() override;
+    void TearDown() override;
+};
+
+#endif // _FILEIO_TEST_HPP
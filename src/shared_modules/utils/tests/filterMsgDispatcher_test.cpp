@@ -13,6 +13,9 @@
 #include "filterMsgDispatcher.hpp"
 #include <chrono>
 #include <thread>
+#include <algorithm>
+#include <mutex>
+#include <vector>
 
 void FilterMsgDispatcherTest::SetUp() {};
 void FilterMsgDispatcherTest::TearDown() {};
@@ -68,3 +71,72 @@ TEST_F(FilterMsgDispatcherTest, NullCallback)
 {
     EXPECT_ANY_THROW(TestMsgDispatcher dispatcher(nullptr));
 }
+
+TEST_F(FilterMsgDispatcherTest, BatchDelivery)
+{
+    constexpr auto BATCH_SIZE { 2ul };
+    constexpr auto NUM_THREADS { 1u };
+    std::vector<Value> receivedValues;
+    std::vector<size_t> batchSizes;
+    std::mutex mutex;
+
+    TestMsgDispatcher dispatcher(
+        [&](const std::vector<Value>& batch)
+    {
+        std::lock_guard<std::mutex> lock{ mutex };
+        batchSizes.push_back(batch.size());
+        receivedValues.insert(receivedValues.end(), batch.begin(), batch.end());
+    },
+    BATCH_SIZE,
+    nullptr,
+    NUM_THREADS);
+
+    dispatcher.push("1");
+    dispatcher.push("2");
+    dispatcher.push("3");
+    dispatcher.push("4");
+    dispatcher.push("5");
+    dispatcher.rundown();
+    EXPECT_TRUE(dispatcher.cancelled());
+    EXPECT_EQ(0ul, dispatcher.size());
+
+    std::sort(receivedValues.begin(), receivedValues.end());
+    EXPECT_EQ((std::vector<Value>{"1", "2", "3", "4", "5"}), receivedValues);
+
+    for (const auto batchSize : batchSizes)
+    {
+        EXPECT_LE(batchSize, BATCH_SIZE);
+    }
+}
+
+TEST_F(FilterMsgDispatcherTest, BatchDeliveryWithFilterCallback)
+{
+    constexpr auto BATCH_SIZE { 10ul };
+    constexpr auto NUM_THREADS { 1u };
+    std::vector<Value> receivedValues;
+    std::mutex mutex;
+
+    TestMsgDispatcher dispatcher(
+        [&](const std::vector<Value>& batch)
+    {
+        std::lock_guard<std::mutex> lock{ mutex };
+        receivedValues.insert(receivedValues.end(), batch.begin(), batch.end());
+    },
+    BATCH_SIZE,
+    [](const Value& value) { return value != "2"; },
+    NUM_THREADS);
+
+    dispatcher.push("1");
+    dispatcher.push("2");
+    dispatcher.push("3");
+    dispatcher.rundown();
+    EXPECT_TRUE(dispatcher.cancelled());
+
+    std::sort(receivedValues.begin(), receivedValues.end());
+    EXPECT_EQ((std::vector<Value>{"1", "3"}), receivedValues);
+}
+
+TEST_F(FilterMsgDispatcherTest, NullBatchCallback)
+{
+    EXPECT_ANY_THROW(TestMsgDispatcher dispatcher(nullptr, 2ul));
+}
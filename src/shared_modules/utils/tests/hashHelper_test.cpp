@@ -110,3 +110,37 @@ TEST_F(HashHelperTest, HashFileInexistantFile)
 {
     EXPECT_THROW(Utils::hashFile(INPUT_FILES_DIR / "inexistant_file.xml"), std::runtime_error);
 }
+
+/**
+ * @brief Test that the batch interface matches the per-buffer digests.
+ *
+ */
+TEST_F(HashHelperTest, HashBatchMatchesSingleBufferDigests)
+{
+    const std::string dataA{"HASH"};
+    const std::string dataB{"ANOTHER"};
+    const auto digests{ Utils::hashBatch({{dataA.c_str(), dataA.size()}, {dataB.c_str(), dataB.size()}}) };
+    ASSERT_EQ(digests.size(), 2);
+
+    HashData hashA;
+    hashA.update(dataA.c_str(), dataA.size());
+    EXPECT_EQ(digests[0], hashA.hash());
+
+    HashData hashB;
+    hashB.update(dataB.c_str(), dataB.size());
+    EXPECT_EQ(digests[1], hashB.hash());
+}
+
+/**
+ * @brief Test the fast non-cryptographic hash against the xxHash64 reference vectors.
+ *
+ */
+TEST_F(HashHelperTest, FastHash64ReferenceVectors)
+{
+    const std::string data{"abc"};
+    const std::string longData{"Nobody inspects the spammish repetition"};
+    EXPECT_EQ(Utils::fastHash64("", 0), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(Utils::fastHash64(data.c_str(), data.size()), 0x44BC2CF5AD770999ULL);
+    EXPECT_EQ(Utils::fastHash64(longData.c_str(), longData.size()), 0xFBCEA83C8A378BF1ULL);
+    EXPECT_NE(Utils::fastHash64(data.c_str(), data.size(), 1), Utils::fastHash64(data.c_str(), data.size()));
+}
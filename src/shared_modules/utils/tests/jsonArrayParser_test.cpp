@@ -687,3 +687,159 @@ TEST_F(JsonArrayParserTest, InexistentFile)
     // Start the parse and expect an exception
     ASSERT_THROW(JsonArray::parse(testFilepath, callback, testArrayPointer), std::runtime_error);
 }
+
+/**
+ * @brief Chunked parse with a tiny memory ceiling. Every item should arrive in its own chunk.
+ *
+ */
+TEST_F(JsonArrayParserTest, ChunkedParseMultipleChunks)
+{
+    // Setup the input data
+    const auto testData {R"(
+    {"cves_array":
+            [
+                {"cve":"CVE-2005-AAAA"},
+                {"cve":"CVE-2008-AAAA"},
+                {"cve":"CVE-2012-AAAA"}
+            ]
+    }
+    )"};
+    const auto testArrayPointer {"/cves_array"_json_pointer};
+    const auto testFilepath {m_testFolder / "ChunkedParseMultipleChunks.json"};
+    createTestFile(testData, testFilepath);
+
+    // Set the expected chunks: with a one byte ceiling every item fills its own chunk
+    std::queue<nlohmann::json> expectedChunks;
+    expectedChunks.push(R"([{"cve":"CVE-2005-AAAA"}])"_json);
+    expectedChunks.push(R"([{"cve":"CVE-2008-AAAA"}])"_json);
+    expectedChunks.push(R"([{"cve":"CVE-2012-AAAA"}])"_json);
+
+    constexpr size_t CHUNK_MAX_SIZE {1};
+    size_t currentId {1};
+
+    // This callback will validate the extracted chunks
+    auto chunkCallback = [&](nlohmann::json&& chunk, const size_t itemsParsed)
+    {
+        // Check that the current chunk equals the one at the front of the expected queue
+        EXPECT_EQ(expectedChunks.front(), chunk);
+
+        // Check that the parsed items count is correct
+        EXPECT_EQ(itemsParsed, currentId);
+        ++currentId;
+
+        // Remove chunk from queue
+        expectedChunks.pop();
+
+        return true;
+    };
+
+    // Parse the JSON array
+    ASSERT_NO_THROW(JsonArray::parseChunked(testFilepath, chunkCallback, CHUNK_MAX_SIZE, testArrayPointer));
+
+    // At the end of the processing the expected queue must be empty
+    EXPECT_TRUE(expectedChunks.empty());
+}
+
+/**
+ * @brief Chunked parse with a large memory ceiling. All the items should arrive in a single final chunk, followed
+ * by the body.
+ *
+ */
+TEST_F(JsonArrayParserTest, ChunkedParseSingleChunkAndBody)
+{
+    // Setup the input data
+    const auto testData {R"(
+    {
+        "some_key":"some_value",
+        "cves_array":
+            [
+                {"cve":"CVE-2005-AAAA"},
+                {"cve":"CVE-2008-AAAA"}
+            ]
+    }
+    )"};
+    const auto testArrayPointer {"/cves_array"_json_pointer};
+    const auto testFilepath {m_testFolder / "ChunkedParseSingleChunkAndBody.json"};
+    createTestFile(testData, testFilepath);
+
+    // Set the expected chunk and body
+    const auto expectedChunk = R"([{"cve":"CVE-2005-AAAA"},{"cve":"CVE-2008-AAAA"}])"_json;
+    const auto expectedBody = R"({"some_key":"some_value","cves_array":[]})"_json;
+    const auto expectedItemsParsed {2};
+
+    auto chunkCallbackCount {0};
+    auto bodyCallbackCount {0};
+
+    // This callback will validate the extracted chunk
+    auto chunkCallback = [&](nlohmann::json&& chunk, const size_t itemsParsed)
+    {
+        EXPECT_EQ(expectedChunk, chunk);
+        EXPECT_EQ(itemsParsed, expectedItemsParsed);
+
+        // The chunk must arrive before the body
+        EXPECT_EQ(bodyCallbackCount, 0);
+        ++chunkCallbackCount;
+
+        return true;
+    };
+
+    // This callback will validate the extracted json body
+    auto bodyCallback = [&](nlohmann::json&& body)
+    {
+        EXPECT_EQ(expectedBody, body);
+        ++bodyCallbackCount;
+    };
+
+    // Parse the JSON array with the default, large enough, ceiling
+    ASSERT_NO_THROW(JsonArray::parseChunked(
+        testFilepath, chunkCallback, JsonArray::DEFAULT_CHUNK_MAX_SIZE, testArrayPointer, bodyCallback));
+
+    // Both callbacks should have been called only once
+    EXPECT_EQ(chunkCallbackCount, 1);
+    EXPECT_EQ(bodyCallbackCount, 1);
+}
+
+/**
+ * @brief Stop the chunked parse from the chunk callback. No further chunks nor the body should arrive.
+ *
+ */
+TEST_F(JsonArrayParserTest, ChunkedParseStop)
+{
+    // Setup the input data
+    const auto testData {R"(
+    {"cves_array":
+            [
+                {"cve":"CVE-2005-AAAA"},
+                {"cve":"CVE-2008-AAAA"},
+                {"cve":"CVE-2012-AAAA"}
+            ]
+    }
+    )"};
+    const auto testArrayPointer {"/cves_array"_json_pointer};
+    const auto testFilepath {m_testFolder / "ChunkedParseStop.json"};
+    createTestFile(testData, testFilepath);
+
+    constexpr size_t CHUNK_MAX_SIZE {1};
+    auto chunkCallbackCount {0};
+
+    // This callback stops the parsing after the first chunk
+    auto chunkCallback = [&chunkCallbackCount](nlohmann::json&& /*chunk*/, const size_t /*itemsParsed*/)
+    {
+        ++chunkCallbackCount;
+        return false;
+    };
+
+    // The parsing is stopped, this callback should never be called
+    auto bodyCallback = [](nlohmann::json&& /*body*/)
+    {
+        // Execution should never reach here
+        EXPECT_TRUE(false) << "The body callback should not have been called.";
+    };
+
+    // Parse the JSON array
+    ASSERT_NO_THROW(
+        JsonArray::parseChunked(testFilepath, chunkCallback, CHUNK_MAX_SIZE, testArrayPointer, bodyCallback));
+
+    // Only the first chunk should have been received
+    EXPECT_EQ(chunkCallbackCount, 1);
+}
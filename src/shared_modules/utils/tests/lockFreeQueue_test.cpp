@@ -0,0 +1,161 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 28, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include <thread>
+#include "lockFreeQueue_test.h"
+#include "lockFreeQueue.hpp"
+
+void LockFreeQueueTest::SetUp() {};
+
+void LockFreeQueueTest::TearDown() {};
+
+using namespace Utils;
+TEST_F(LockFreeQueueTest, Ctor)
+{
+    LockFreeQueue<int> queue;
+    int ret_val{};
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.cancelled());
+    EXPECT_FALSE(queue.pop(ret_val, false));//non wait pop;
+    auto spValue{queue.pop(false)};
+    EXPECT_FALSE(spValue);
+}
+
+TEST_F(LockFreeQueueTest, NonBlockingPop)
+{
+    LockFreeQueue<int> queue;
+    queue.push(0);
+    int ret_val{};
+    EXPECT_TRUE(queue.pop(ret_val, false));//non wait pop;
+    EXPECT_EQ(0, ret_val);
+    EXPECT_FALSE(queue.pop(ret_val, false));//non wait pop;
+    queue.push(1);
+    auto spValue{queue.pop(false)};
+    EXPECT_TRUE(spValue);
+    EXPECT_EQ(1, *spValue);
+    spValue = queue.pop(false);
+    EXPECT_FALSE(spValue);
+}
+
+TEST_F(LockFreeQueueTest, BlockingPopByRef)
+{
+    LockFreeQueue<int> queue;
+    std::thread t1
+    {
+        [&queue]()
+        {
+            int ret_val{};
+            EXPECT_TRUE(queue.pop(ret_val));
+            EXPECT_EQ(0, ret_val);
+        }
+    };
+    queue.push(0);
+    t1.join();
+}
+
+TEST_F(LockFreeQueueTest, BulkPushAndPop)
+{
+    constexpr auto NUM_ELEMENTS { 10 };
+    constexpr auto MAX_BULK_SIZE { 4ul };
+    LockFreeQueue<int> queue;
+    std::vector<int> values;
+
+    for (int i = 0; i < NUM_ELEMENTS; ++i)
+    {
+        values.push_back(i);
+    }
+
+    queue.pushBulk(std::move(values));
+    EXPECT_EQ(static_cast<size_t>(NUM_ELEMENTS), queue.size());
+
+    std::vector<int> poppedValues;
+    auto totalPopped{ 0ul };
+
+    while (totalPopped < NUM_ELEMENTS)
+    {
+        std::vector<int> bulk;
+        const auto popped{ queue.popBulk(bulk, MAX_BULK_SIZE) };
+        EXPECT_GT(popped, 0ul);
+        EXPECT_LE(popped, MAX_BULK_SIZE);
+        totalPopped += popped;
+        poppedValues.insert(poppedValues.end(), bulk.begin(), bulk.end());
+    }
+
+    EXPECT_EQ(static_cast<size_t>(NUM_ELEMENTS), poppedValues.size());
+    EXPECT_TRUE(queue.empty());
+
+    std::vector<int> bulk;
+    EXPECT_EQ(0ul, queue.popBulk(bulk, MAX_BULK_SIZE, false));//non wait pop;
+}
+
+TEST_F(LockFreeQueueTest, Cancel)
+{
+    LockFreeQueue<int> queue;
+    queue.push(0);
+    queue.push(1);
+    queue.push(2);
+    int ret_val{};
+    EXPECT_TRUE(queue.pop(ret_val, false));//non wait pop;
+    queue.cancel();
+    EXPECT_FALSE(queue.pop(ret_val, false));//non wait pop;
+    EXPECT_FALSE(queue.pop(ret_val));//wait pop;
+    EXPECT_TRUE(queue.cancelled());
+}
+
+TEST_F(LockFreeQueueTest, CancelBlockingPop)
+{
+    LockFreeQueue<int> queue;
+    std::thread t1
+    {
+        [&queue]()
+        {
+            auto ret_val{queue.pop()};
+            EXPECT_FALSE(ret_val);
+            EXPECT_TRUE(queue.cancelled());
+        }
+    };
+    std::thread t2
+    {
+        [&queue]()
+        {
+            std::vector<int> bulk;
+            EXPECT_EQ(0ul, queue.popBulk(bulk, 8));
+            EXPECT_TRUE(queue.cancelled());
+        }
+    };
+    queue.cancel();
+    t1.join();
+    t2.join();
+}
+
+TEST_F(LockFreeQueueTest, LockFreeAsyncDispatcherPushAndRundown)
+{
+    constexpr auto NUM_ELEMENTS { 1000 };
+    std::atomic<int> counter { 0 };
+    LockFreeAsyncDispatcher<int, std::function<void(int)>> dispatcher
+    {
+        [&counter](int)
+        {
+            ++counter;
+        }
+    };
+    EXPECT_EQ(std::thread::hardware_concurrency(), dispatcher.numberOfThreads());
+
+    for (int i = 0; i < NUM_ELEMENTS; ++i)
+    {
+        dispatcher.push(i);
+    }
+
+    dispatcher.rundown();
+    EXPECT_TRUE(dispatcher.cancelled());
+    EXPECT_EQ(NUM_ELEMENTS, counter);
+    EXPECT_EQ(0ul, dispatcher.size());
+}
@@ -154,3 +154,36 @@ TEST_F(LoggerHelperTest, simpleWarningFormattedTest)
     logWarn(TAG, "%s", "Testing Warning log");
     EXPECT_TRUE(std::regex_match(ssOutput.str(), std::regex(WARNING_REGEX)));
 }
+
+TEST_F(LoggerHelperTest, asyncSinkDeliversFormattedEntries)
+{
+    std::mutex collectedMutex;
+    std::vector<Log::AsyncLogEntry> collected;
+
+    Log::AsyncLogSink::instance().start(
+        [&collectedMutex, &collected](const Log::AsyncLogEntry& entry)
+        {
+            std::lock_guard<std::mutex> lock(collectedMutex);
+            collected.push_back(entry);
+        });
+
+    logInfo(TAG, "%s", "Testing Async Info log");
+    logError(TAG, "Testing Async Error log");
+
+    // Stopping drains the ring, so every queued entry has been delivered afterwards
+    Log::AsyncLogSink::instance().stop();
+
+    ASSERT_EQ(collected.size(), 2u);
+    EXPECT_EQ(collected[0].level, Log::LOGLEVEL_INFO);
+    EXPECT_EQ(collected[0].tag, TAG);
+    EXPECT_EQ(collected[0].func, "TestBody");
+    EXPECT_EQ(collected[0].message, "Testing Async Info log");
+    EXPECT_EQ(collected[1].level, Log::LOGLEVEL_ERROR);
+    EXPECT_EQ(collected[1].message, "Testing Async Error log");
+
+    // While the sink was enabled nothing went through the synchronous path, and once it is
+    // stopped the synchronous path works again
+    ASSERT_TRUE(ssOutput.str().empty());
+    logInfo(TAG, "Testing Info log");
+    EXPECT_TRUE(std::regex_match(ssOutput.str(), std::regex(INFO_REGEX)));
+}
@@ -34,3 +34,47 @@ TEST_F(MapWrapperSafeTest, eraseTest)
     EXPECT_EQ(0, mapSafe[1]);
 }
 
+TEST_F(MapWrapperSafeTest, sharedInsertTest)
+{
+    Utils::SharedMapWrapperSafe<int, int> mapSafe;
+    mapSafe.insert(1, 2);
+    EXPECT_EQ(2, mapSafe[1]);
+}
+
+TEST_F(MapWrapperSafeTest, sharedEraseTest)
+{
+    Utils::SharedMapWrapperSafe<int, int> mapSafe;
+    mapSafe.insert(1, 2);
+    EXPECT_NO_THROW(mapSafe.erase(1));
+    EXPECT_EQ(0, mapSafe[1]);
+}
+
+TEST_F(MapWrapperSafeTest, sharedConcurrentReadersTest)
+{
+    Utils::SharedMapWrapperSafe<int, int> mapSafe;
+    mapSafe.insert(1, 2);
+
+    std::thread firstReader
+    {
+        [&mapSafe]()
+        {
+            for (auto i = 0; i < 1000; ++i)
+            {
+                EXPECT_EQ(2, mapSafe[1]);
+            }
+        }
+    };
+    std::thread secondReader
+    {
+        [&mapSafe]()
+        {
+            for (auto i = 0; i < 1000; ++i)
+            {
+                EXPECT_EQ(2, mapSafe[1]);
+            }
+        }
+    };
+    firstReader.join();
+    secondReader.join();
+}
+
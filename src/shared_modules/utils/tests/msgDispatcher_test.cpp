@@ -11,6 +11,9 @@
 
 #include <thread>
 #include <chrono>
+#include <algorithm>
+#include <mutex>
+#include <vector>
 #include "msgDispatcher_test.h"
 #include "msgDispatcher.h"
 
@@ -166,3 +169,46 @@ TEST_F(MsgDispatcherTest, MsgDispatcherRemoveCallback)
     dispatcher.removeCallback(key1);
     dispatcher.dispatch(input1);
 }
+
+TEST_F(MsgDispatcherTest, MsgDispatcherBatchCallback)
+{
+    constexpr auto NUM_THREADS { 1u };
+    constexpr auto BATCH_SIZE { 2ul };
+    const Key key1{100};
+    const auto input1 {RawValue{reinterpret_cast<void*>(0x65654), 5000}};
+    const auto input2 {RawValue{reinterpret_cast<void*>(0x65244), 4000}};
+    const auto input3 {RawValue{reinterpret_cast<void*>(0x68878), 6546}};
+
+    const auto decoded1 {DecodedValue(key1, "value 0")};
+    const auto decoded2 {DecodedValue(key1, "value 1")};
+    const auto decoded3 {DecodedValue(key1, "value 2")};
+    TestMsgDispatcher dispatcher(NUM_THREADS, UNLIMITED_QUEUE_SIZE, BATCH_SIZE);
+    EXPECT_CALL(dispatcher, decode(input1)).WillOnce(Return(decoded1));
+    EXPECT_CALL(dispatcher, decode(input2)).WillOnce(Return(decoded2));
+    EXPECT_CALL(dispatcher, decode(input3)).WillOnce(Return(decoded3));
+
+    std::vector<Value> receivedValues;
+    std::vector<size_t> batchSizes;
+    std::mutex mutex;
+    EXPECT_NO_THROW(dispatcher.addBatchCallback(key1, [&](const std::vector<Value>& batch)
+    {
+        std::lock_guard<std::mutex> lock{ mutex };
+        batchSizes.push_back(batch.size());
+        receivedValues.insert(receivedValues.end(), batch.begin(), batch.end());
+    }));
+
+    dispatcher.push(input1);
+    dispatcher.push(input2);
+    dispatcher.push(input3);
+    dispatcher.rundown();
+    EXPECT_TRUE(dispatcher.cancelled());
+    EXPECT_EQ(0ul, dispatcher.size());
+
+    std::sort(receivedValues.begin(), receivedValues.end());
+    EXPECT_EQ((std::vector<Value>{"value 0", "value 1", "value 2"}), receivedValues);
+
+    for (const auto batchSize : batchSizes)
+    {
+        EXPECT_LE(batchSize, BATCH_SIZE);
+    }
+}
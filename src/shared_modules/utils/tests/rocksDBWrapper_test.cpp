@@ -153,6 +153,55 @@ TEST_F(RocksDBWrapperTest, TestDeleteEmptyDB)
     EXPECT_NO_THROW(new_db_wrapper.delete_("key1"));
 }
 
+/**
+ * @brief Tests the deleteRange function
+ */
+TEST_F(RocksDBWrapperTest, TestDeleteRange)
+{
+    db_wrapper->put("range_A", "value_A");
+    db_wrapper->put("range_B", "value_B");
+    db_wrapper->put("range_C", "value_C");
+
+    EXPECT_NO_THROW(db_wrapper->deleteRange("range_A", "range_C"));
+
+    std::string value {};
+    EXPECT_FALSE(db_wrapper->get("range_A", value));
+    EXPECT_FALSE(db_wrapper->get("range_B", value));
+    EXPECT_TRUE(db_wrapper->get("range_C", value)); // The end key is exclusive
+}
+
+/**
+ * @brief Tests the deleteRange function with an empty key
+ */
+TEST_F(RocksDBWrapperTest, TestDeleteRangeEmptyKey)
+{
+    EXPECT_THROW(db_wrapper->deleteRange("", "range_C"), std::invalid_argument);
+    EXPECT_THROW(db_wrapper->deleteRange("range_A", ""), std::invalid_argument);
+}
+
+/**
+ * @brief Tests the deleteByPrefix function over a prefixed column
+ */
+TEST_F(RocksDBWrapperTest, TestDeleteByPrefix)
+{
+    constexpr auto COLUMN_NAME {"column_prefixed_delete"};
+    constexpr auto PREFIX_LENGTH {4};
+
+    db_wrapper->createColumn(COLUMN_NAME, PREFIX_LENGTH);
+    db_wrapper->put("001_package_A", "value_A", COLUMN_NAME);
+    db_wrapper->put("001_package_B", "value_B", COLUMN_NAME);
+    db_wrapper->put("002_package_A", "value_C", COLUMN_NAME);
+
+    EXPECT_NO_THROW(db_wrapper->deleteByPrefix("001_", COLUMN_NAME));
+
+    std::string value {};
+    EXPECT_FALSE(db_wrapper->get("001_package_A", value, COLUMN_NAME));
+    EXPECT_FALSE(db_wrapper->get("001_package_B", value, COLUMN_NAME));
+    EXPECT_TRUE(db_wrapper->get("002_package_A", value, COLUMN_NAME)); // Other prefixes are untouched
+
+    EXPECT_THROW(db_wrapper->deleteByPrefix(""), std::invalid_argument);
+}
+
 /**
  * @brief Tests the deleteAll function
  */
@@ -579,3 +628,103 @@ TEST_F(RocksDBWrapperTest, GetAllColumnFamiliesTest)
     EXPECT_EQ(columnFamilies[2], COLUMN_NAME_B);
     EXPECT_EQ(columnFamilies[3], COLUMN_NAME_C);
 }
+
+/**
+ * @brief Tests the getProperty function on the default column and on a created column.
+ */
+TEST_F(RocksDBWrapperTest, GetPropertyTest)
+{
+    constexpr auto COLUMN_NAME {"column_property"};
+
+    db_wrapper->createColumn(COLUMN_NAME);
+    db_wrapper->put("key1", "value1", COLUMN_NAME);
+
+    EXPECT_FALSE(db_wrapper->getProperty("rocksdb.estimate-num-keys").empty());
+    EXPECT_FALSE(db_wrapper->getProperty("rocksdb.levelstats", COLUMN_NAME).empty());
+    EXPECT_THROW(db_wrapper->getProperty("rocksdb.inexistent-property"), std::runtime_error);
+}
+
+/**
+ * @brief Tests the prefix seek over a column created with a prefix extractor.
+ *
+ */
+TEST_F(RocksDBWrapperTest, SeekPrefixOnPrefixedColumn)
+{
+    constexpr auto COLUMN_NAME {"column_prefixed"};
+    constexpr auto PREFIX_LENGTH {4};
+    constexpr auto NUM_ELEMENTS_AGENT_ONE {2};
+
+    db_wrapper->createColumn(COLUMN_NAME, PREFIX_LENGTH);
+    db_wrapper->put("001_package_A", "value_A", COLUMN_NAME);
+    db_wrapper->put("001_package_B", "value_B", COLUMN_NAME);
+    db_wrapper->put("002_package_A", "value_C", COLUMN_NAME);
+    db_wrapper->put("002_package_B", "value_D", COLUMN_NAME);
+
+    auto counter {0};
+    for (const auto& [key, value] : db_wrapper->seekPrefix("001_", COLUMN_NAME))
+    {
+        EXPECT_EQ(key.rfind("001_", 0), 0U);
+        ++counter;
+    }
+    EXPECT_EQ(counter, NUM_ELEMENTS_AGENT_ONE);
+
+    counter = 0;
+    for ([[maybe_unused]] const auto& [key, value] : db_wrapper->seekPrefix("003_", COLUMN_NAME))
+    {
+        ++counter;
+    }
+    EXPECT_EQ(counter, 0);
+}
+
+/**
+ * @brief Tests the prefix seek over a column without a prefix extractor, falling back to total order iteration.
+ *
+ */
+TEST_F(RocksDBWrapperTest, SeekPrefixWithoutPrefixExtractor)
+{
+    constexpr auto NUM_ELEMENTS_MATCHING {2};
+    constexpr auto READAHEAD_SIZE {2 * 1024 * 1024};
+
+    db_wrapper->put("001_package_A", "value_A");
+    db_wrapper->put("001_package_B", "value_B");
+    db_wrapper->put("002_package_A", "value_C");
+
+    auto counter {0};
+    for (const auto& [key, value] : db_wrapper->seekPrefix("001_", "", READAHEAD_SIZE))
+    {
+        EXPECT_EQ(key.rfind("001_", 0), 0U);
+        ++counter;
+    }
+    EXPECT_EQ(counter, NUM_ELEMENTS_MATCHING);
+}
+
+/**
+ * @brief Tests the prefix seek over a prefixed column after reopening the database.
+ *
+ */
+TEST_F(RocksDBWrapperTest, SeekPrefixAfterDatabaseReopen)
+{
+    constexpr auto COLUMN_NAME {"column_prefixed"};
+    constexpr auto PREFIX_LENGTH {4};
+    constexpr auto NUM_ELEMENTS_MATCHING {2};
+
+    db_wrapper->createColumn(COLUMN_NAME, PREFIX_LENGTH);
+    db_wrapper->put("001_package_A", "value_A", COLUMN_NAME);
+    db_wrapper->put("001_package_B", "value_B", COLUMN_NAME);
+    db_wrapper->put("002_package_A", "value_C", COLUMN_NAME);
+
+    // Reopen the database keeping the prefix extractor of the column.
+    db_wrapper.reset();
+    ASSERT_NO_THROW({
+        db_wrapper = std::make_unique<Utils::RocksDBWrapper>(
+            m_databaseFolder, true, std::map<std::string, size_t> {{COLUMN_NAME, PREFIX_LENGTH}});
+    });
+
+    auto counter {0};
+    for (const auto& [key, value] : db_wrapper->seekPrefix("001_", COLUMN_NAME))
+    {
+        EXPECT_EQ(key.rfind("001_", 0), 0U);
+        ++counter;
+    }
+    EXPECT_EQ(counter, NUM_ELEMENTS_MATCHING);
+}
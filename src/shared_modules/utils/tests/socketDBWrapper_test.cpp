@@ -89,6 +89,24 @@ TEST_F(SocketDBWrapperTest, OkTest)
     ASSERT_EQ(output[0].at("field"), "value");
 }
 
+TEST_F(SocketDBWrapperTest, AsyncPipelinedTest)
+{
+    m_query = "SELECT * FROM test_table;";
+    m_responses = std::vector<std::string> {R"(ok [{"field": "value"}])"};
+
+    // Both queries are in flight before either response is consumed.
+    auto firstFuture {SocketDBWrapper::instance().queryAsync(m_query)};
+    auto secondFuture {SocketDBWrapper::instance().queryAsync(m_query)};
+
+    nlohmann::json firstOutput;
+    nlohmann::json secondOutput;
+    EXPECT_NO_THROW(firstOutput = firstFuture.get());
+    EXPECT_NO_THROW(secondOutput = secondFuture.get());
+
+    ASSERT_EQ(firstOutput[0].at("field"), "value");
+    ASSERT_EQ(secondOutput[0].at("field"), "value");
+}
+
 TEST_F(SocketDBWrapperTestNoSetUp, NoSocketTest)
 {
     SocketDBWrapper::instance();
@@ -173,6 +173,68 @@ TYPED_TEST_P(SocketTest, MultipleClients)
     EXPECT_EQ(counter, MESSAGE_QUANTITY);
 }
 
+TYPED_TEST_P(SocketTest, MultipleClientsSharedReactor)
+{
+    constexpr size_t CLIENTS {8};
+    constexpr size_t MESSAGE_QUANTITY {80000};
+    std::string socketPath {"/tmp/echo_sock"};
+    std::promise<void> promise;
+    std::atomic<size_t> counter {0};
+
+    SocketServer<Socket<OSPrimitives, TypeParam>, EpollWrapper> server {socketPath};
+    server.listen(
+        [&](const int fd, const char* data, uint32_t size, const char* dataHeader, uint32_t sizeHeader)
+        {
+            std::ignore = fd;
+            std::ignore = dataHeader;
+            std::ignore = sizeHeader;
+            std::ignore = data;
+            std::ignore = size;
+            counter++;
+
+            if (counter == MESSAGE_QUANTITY)
+            {
+                promise.set_value();
+            }
+        });
+
+    // All the clients share one reactor thread instead of spawning one epoll thread each.
+    auto reactor {std::make_shared<SocketClientReactor<EpollWrapper>>()};
+    std::vector<std::unique_ptr<SocketClient<Socket<OSPrimitives, TypeParam>, EpollWrapper>>> clients;
+    for (size_t i {0}; i < CLIENTS; ++i)
+    {
+        clients.push_back(
+            std::make_unique<SocketClient<Socket<OSPrimitives, TypeParam>, EpollWrapper>>(socketPath, reactor));
+        clients.back()->connect(
+            [](const char* data, uint32_t size, const char* dataHeader, uint32_t sizeHeader)
+            {
+                std::ignore = dataHeader;
+                std::ignore = sizeHeader;
+                std::ignore = size;
+                std::ignore = data;
+            });
+    }
+
+    for (size_t i {0}; i < MESSAGE_QUANTITY / CLIENTS; ++i)
+    {
+        auto message {std::to_string(i)};
+        for (auto& client : clients)
+        {
+            client->send(message.c_str(), message.size());
+        }
+    }
+
+    promise.get_future().wait();
+
+    for (auto& client : clients)
+    {
+        client->stop();
+    }
+    reactor->stop();
+
+    EXPECT_EQ(counter, MESSAGE_QUANTITY);
+}
+
 TYPED_TEST_P(SocketTest, SingleDelayedClientWithReconnectionSendMessageOffline)
 {
     constexpr size_t MESSAGE_QUANTITY {100};
@@ -394,12 +456,60 @@ TYPED_TEST_P(SocketTest, SingleDelayedClientWithReconnectionServerReset)
     EXPECT_EQ(counter, MESSAGE_QUANTITY);
 }
 
+TYPED_TEST_P(SocketTest, EdgeTriggeredServer)
+{
+    constexpr size_t MESSAGE_QUANTITY {100000};
+    constexpr bool EDGE_TRIGGERED {true};
+    std::string socketPath {"/tmp/echo_sock"};
+    std::promise<void> promise;
+
+    SocketServer<Socket<OSPrimitives, TypeParam>, EpollWrapper> server {socketPath, EDGE_TRIGGERED};
+    std::atomic<size_t> counter {0};
+    server.listen(
+        [&](const int fd, const char* data, uint32_t size, const char* dataHeader, uint32_t sizeHeader)
+        {
+            std::ignore = fd;
+            std::ignore = dataHeader;
+            std::ignore = sizeHeader;
+            std::string message(data, size);
+            EXPECT_EQ(message, std::to_string(counter));
+            counter++;
+
+            if (counter == MESSAGE_QUANTITY)
+            {
+                promise.set_value();
+            }
+        });
+
+    SocketClient<Socket<OSPrimitives, TypeParam>, EpollWrapper> client {socketPath};
+    client.connect(
+        [](const char* data, uint32_t size, const char* dataHeader, uint32_t sizeHeader)
+        {
+            std::ignore = dataHeader;
+            std::ignore = sizeHeader;
+            std::ignore = size;
+            std::ignore = data;
+        });
+
+    for (size_t i {0}; i < MESSAGE_QUANTITY; ++i)
+    {
+        auto message {std::to_string(i)};
+        client.send(message.c_str(), message.size());
+    }
+
+    promise.get_future().wait_for(std::chrono::seconds(10));
+
+    EXPECT_EQ(counter, MESSAGE_QUANTITY);
+}
+
 // All tests must be registered
 
 REGISTER_TYPED_TEST_SUITE_P(SocketTest,
                             SingleDelayedServerStart,
                             SingleDelayedClient,
                             MultipleClients,
+                            MultipleClientsSharedReactor,
+                            EdgeTriggeredServer,
                             SingleDelayedClientWithReconnectionSendMessageOffline,
                             SingleDelayedClientWithReconnectionOnline,
                             SingleDelayedClientWithReconnectionServerReset);
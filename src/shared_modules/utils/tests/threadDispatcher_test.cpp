@@ -121,3 +121,49 @@ TEST_F(ThreadDispatcherTest, AsyncDispatcherQueue)
     dispatcher.rundown();
 }
 
+
+TEST_F(ThreadDispatcherTest, AsyncDispatcherAutoscaling)
+{
+    constexpr auto MAX_THREADS { 4u };
+    constexpr auto MIN_THREADS { 1u };
+    constexpr auto NUMBER_OF_ITEMS { 200 };
+    std::atomic<int> processed { 0 };
+
+    AsyncDispatcher<int, std::function<void(int)>> dispatcher
+    {
+        [&processed](int)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            ++processed;
+        }
+        , MAX_THREADS
+        , UNLIMITED_QUEUE_SIZE
+        , MIN_THREADS
+    };
+
+    EXPECT_EQ(MAX_THREADS, dispatcher.numberOfThreads());
+    EXPECT_EQ(MIN_THREADS, dispatcher.activeNumberOfThreads());
+
+    for (int i = 0; i < NUMBER_OF_ITEMS; ++i)
+    {
+        dispatcher.push(i);
+    }
+
+    // The backlog should grow the pool beyond the minimum while it drains.
+    auto maxActive { dispatcher.activeNumberOfThreads() };
+
+    while (processed < NUMBER_OF_ITEMS)
+    {
+        maxActive = std::max(maxActive, dispatcher.activeNumberOfThreads());
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_GT(maxActive, MIN_THREADS);
+
+    // Once idle, the dynamic workers retire back to the minimum.
+    std::this_thread::sleep_for(ThreadDispatchDetail::DISPATCH_IDLE_TIMEOUT * 3);
+    EXPECT_EQ(MIN_THREADS, dispatcher.activeNumberOfThreads());
+
+    dispatcher.cancel();
+    EXPECT_TRUE(dispatcher.cancelled());
+}
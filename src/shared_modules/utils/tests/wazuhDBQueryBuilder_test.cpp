@@ -160,3 +160,37 @@ TEST_F(WazuhDBQueryBuilderTest, AgentGetPackagesCommand)
     std::string message = WazuhDBQueryBuilder::builder().agentGetPackagesCommand("1").build();
     EXPECT_EQ(message, "agent 1 package get ");
 }
+
+TEST_F(WazuhDBQueryBuilderTest, TemplateAgentQuery)
+{
+    auto queryTemplate = WazuhDBQueryBuilder::builder()
+                             .agentParam()
+                             .selectAll()
+                             .fromTable("sys_programs")
+                             .whereColumn("name")
+                             .equalsToParam()
+                             .compile();
+
+    EXPECT_EQ(queryTemplate.format({"0", "bash"}), "agent 0 sql SELECT * FROM sys_programs WHERE name = 'bash' ");
+    EXPECT_EQ(queryTemplate.format({"1", "zsh"}), "agent 1 sql SELECT * FROM sys_programs WHERE name = 'zsh' ");
+}
+
+TEST_F(WazuhDBQueryBuilderTest, TemplateAgentCommand)
+{
+    auto queryTemplate = WazuhDBQueryBuilder::builder().agentCommandParam("package").compile();
+    EXPECT_EQ(queryTemplate.format({"1"}), "agent 1 package get ");
+}
+
+TEST_F(WazuhDBQueryBuilderTest, TemplateInvalidArguments)
+{
+    auto queryTemplate = WazuhDBQueryBuilder::builder().agentParam().selectAll().fromTable("agent").compile();
+    EXPECT_THROW(queryTemplate.format({}), std::runtime_error);
+    EXPECT_THROW(queryTemplate.format({"notANumber"}), std::runtime_error);
+}
+
+TEST_F(WazuhDBQueryBuilderTest, TemplateInvalidValueArgument)
+{
+    auto queryTemplate =
+        WazuhDBQueryBuilder::builder().global().selectAll().fromTable("agent").whereColumn("name").equalsToParam().compile();
+    EXPECT_THROW(queryTemplate.format({"it's"}), std::runtime_error);
+}
@@ -14,6 +14,7 @@
 #include "xzHelper.hpp"
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <vector>
 #include <array>
 
@@ -542,3 +543,57 @@ TEST_F(XzHelperTest, InvalidCompressionPresetThrows)
     constexpr auto INVALID_COMPRESSION_PRESET {1000};
     EXPECT_THROW(Utils::XzHelper(inputData, compressedData).compress(INVALID_COMPRESSION_PRESET), std::runtime_error);
 }
+
+/**
+ * @brief Test correct decompression with an explicit decoder memory limit. Multi-thread.
+ *
+ */
+TEST_F(XzHelperTest, DecompressMultiThreadWithMemoryLimit)
+{
+    // Setup
+    const auto DECOMPRESSED_OUTPUT_FILE {OUTPUT_PATH / "sample-DecompressMultiThreadWithMemoryLimit.json"};
+    constexpr uint64_t MEMORY_LIMIT {256ULL * 1024 * 1024};
+    Utils::XzHelper xz(COMPRESSED_INPUT_FILE_MT, DECOMPRESSED_OUTPUT_FILE, MAX_THREAD_COUNT, MEMORY_LIMIT);
+
+    // Decompress
+    ASSERT_NO_THROW(xz.decompress());
+
+    // Check that the output file equals the uncompressed reference file
+    EXPECT_EQ(hashFile(DECOMPRESSED_OUTPUT_FILE), hashFile(UNCOMPRESSED_REFERENCE_FILE));
+}
+
+/**
+ * @brief Test that a too low decoder memory limit makes the single-thread decompression fail.
+ *
+ */
+TEST_F(XzHelperTest, DecompressSingleThreadWithMemoryLimitTooLow)
+{
+    // Setup
+    const auto DECOMPRESSED_OUTPUT_FILE {OUTPUT_PATH / "sample-DecompressSingleThreadWithMemoryLimitTooLow.json"};
+    constexpr uint64_t MEMORY_LIMIT {1024};
+    Utils::XzHelper xz(COMPRESSED_INPUT_FILE_ST, DECOMPRESSED_OUTPUT_FILE, 1, MEMORY_LIMIT);
+
+    // Decompress
+    EXPECT_THROW(xz.decompress(), std::runtime_error);
+}
+
+/**
+ * @brief Test correct decompression of two files reusing the same output buffer.
+ *
+ */
+TEST_F(XzHelperTest, DecompressReusingOutputBuffer)
+{
+    // Setup: one output buffer shared across both decompressions
+    const auto FIRST_OUTPUT_FILE {OUTPUT_PATH / "sample-DecompressReusingOutputBuffer-first.json"};
+    const auto SECOND_OUTPUT_FILE {OUTPUT_PATH / "sample-DecompressReusingOutputBuffer-second.json"};
+    const auto spBuffer {std::make_shared<std::vector<uint8_t>>()};
+
+    // Decompress both files with the shared buffer
+    ASSERT_NO_THROW(Utils::XzHelper(COMPRESSED_INPUT_FILE_ST, FIRST_OUTPUT_FILE, spBuffer).decompress());
+    ASSERT_NO_THROW(Utils::XzHelper(COMPRESSED_INPUT_FILE_MT, SECOND_OUTPUT_FILE, spBuffer, MAX_THREAD_COUNT)
+                        .decompress());
+
+    // Check that both output files equal the uncompressed reference file
+    EXPECT_EQ(hashFile(FIRST_OUTPUT_FILE), hashFile(UNCOMPRESSED_REFERENCE_FILE));
+    EXPECT_EQ(hashFile(SECOND_OUTPUT_FILE), hashFile(UNCOMPRESSED_REFERENCE_FILE));
+}
@@ -18,8 +18,10 @@
 #include <filesystem>
 #include <fstream>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 const auto INPUT_FILES_DIR {std::filesystem::current_path() / "input_files" / "zlibHelper"};
 
@@ -116,6 +118,22 @@ TEST_F(ZlibHelperTest, GzDecompressFile)
     EXPECT_EQ(SHA1_EXPECTED, getFileHash(JSON_FILE));
 }
 
+/**
+ * @brief Tests the correct decompression of GZ and ZIP files sharing one scratch buffer.
+ *
+ */
+TEST_F(ZlibHelperTest, DecompressFilesWithSharedScratchBuffer)
+{
+    const auto spScratchBuffer {std::make_shared<std::vector<char>>()};
+
+    ASSERT_NO_THROW(Utils::ZlibHelper::gzipDecompress(GZ_FILE, JSON_FILE, spScratchBuffer));
+    EXPECT_EQ(SHA1_EXPECTED, getFileHash(JSON_FILE));
+
+    const std::vector<std::string> expectedDecompressedFiles {{JSON_FILE}};
+    EXPECT_EQ(expectedDecompressedFiles, Utils::ZlibHelper::zipDecompress(ZIP_FILE, OUTPUT_DIR, spScratchBuffer));
+    EXPECT_EQ(SHA1_EXPECTED, getFileHash(JSON_FILE));
+}
+
 /**
  * @brief Tests the GZ decompression of a file whose format is not '.gz'.
  *
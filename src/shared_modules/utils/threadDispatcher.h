@@ -14,9 +14,14 @@
 #include <vector>
 #include <thread>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <future>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <type_traits>
 #include "threadSafeQueue.h"
 #include "promiseFactory.h"
 #include "commonDefs.h"
@@ -60,25 +65,54 @@ namespace Utils
     //  void cancel();
     // };
 
+    namespace ThreadDispatchDetail
+    {
+        // Detects whether the queue backend provides bulk pop support, so the
+        // dispatch loop can drain tasks in batches instead of one at a time.
+        template <typename Queue, typename = void>
+        struct HasPopBulk : std::false_type {};
+        template <typename Queue>
+        struct HasPopBulk
+        <
+            Queue,
+            std::void_t<decltype(std::declval<Queue&>().popBulk(
+                std::declval<std::vector<std::function<void()>>&>(), size_t{}, bool{}))>
+            > : std::true_type {};
+
+        constexpr size_t DISPATCH_BULK_SIZE { 32 };
+
+        // Time a dynamic worker stays parked without work before it retires back
+        // towards the minimum pool size.
+        constexpr std::chrono::seconds DISPATCH_IDLE_TIMEOUT { 1 };
+    }
+
     template
     <
         typename Type,
-        typename Functor
+        typename Functor,
+        typename Queue = SafeQueue<std::function<void()>>
         >
     class AsyncDispatcher
     {
         public:
-            AsyncDispatcher(Functor functor, const unsigned int numberOfThreads = std::thread::hardware_concurrency(), const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE)
+            // When minNumberOfThreads is 0 the pool is fixed at numberOfThreads, which is the
+            // historical behavior. A non-zero minimum enables autoscaling: the pool starts at the
+            // minimum and grows up to numberOfThreads while the queue backlog outgrows the active
+            // workers; extra workers park on a condition variable and retire when idle.
+            AsyncDispatcher(Functor functor, const unsigned int numberOfThreads = std::thread::hardware_concurrency(), const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE, const unsigned int minNumberOfThreads = 0)
                 : m_functor{ functor }
                 , m_running{ true }
                 , m_numberOfThreads{ numberOfThreads ? numberOfThreads : 1 }
                 , m_maxQueueSize { maxQueueSize }
+                , m_minNumberOfThreads{ minNumberOfThreads ? std::min(minNumberOfThreads, m_numberOfThreads) : 0 }
             {
-                m_threads.reserve(m_numberOfThreads);
+                const auto coreThreads { m_minNumberOfThreads ? m_minNumberOfThreads : m_numberOfThreads };
+                m_currentThreads = coreThreads;
+                m_threads.reserve(coreThreads);
 
-                for (unsigned int i = 0; i < m_numberOfThreads; ++i)
+                for (unsigned int i = 0; i < coreThreads; ++i)
                 {
-                    m_threads.push_back(std::thread{ &AsyncDispatcher<Type, Functor>::dispatch, this });
+                    m_threads.push_back(std::thread{ &AsyncDispatcher<Type, Functor, Queue>::dispatch, this });
                 }
             }
             AsyncDispatcher& operator=(const AsyncDispatcher&) = delete;
@@ -101,6 +135,11 @@ namespace Utils
                             this->m_functor(value);
                         }
                         );
+
+                        if (m_minNumberOfThreads)
+                        {
+                            scaleUp();
+                        }
                     }
                 }
             }
@@ -125,6 +164,7 @@ namespace Utils
             {
                 m_running = false;
                 m_queue.cancel();
+                m_scaleCv.notify_all();
                 joinThreads();
             }
 
@@ -136,6 +176,10 @@ namespace Utils
             {
                 return m_numberOfThreads;
             }
+            unsigned int activeNumberOfThreads() const
+            {
+                return m_currentThreads;
+            }
             size_t size() const
             {
                 return m_queue.size();
@@ -143,16 +187,88 @@ namespace Utils
 
         private:
             void dispatch()
+            {
+                try
+                {
+                    if constexpr (ThreadDispatchDetail::HasPopBulk<Queue>::value)
+                    {
+                        std::vector<std::function<void()>> tasks;
+
+                        while (m_running)
+                        {
+                            if (m_queue.popBulk(tasks, ThreadDispatchDetail::DISPATCH_BULK_SIZE, true))
+                            {
+                                for (auto& fnc : tasks)
+                                {
+                                    fnc();
+                                }
+                            }
+                        }
+                    }
+                    else
+                    {
+                        while (m_running)
+                        {
+                            std::function<void()> fnc;
+
+                            if (m_queue.pop(fnc))
+                            {
+                                fnc();
+                            }
+                        }
+                    }
+                }
+                catch (const std::exception& ex)
+                {
+                    std::cerr << "Dispatch handler error, " << ex.what() << std::endl;
+                }
+            }
+            // Loop of the workers above the minimum pool size. They drain the queue without
+            // blocking in it and park on the scale condition variable when empty, so an idle
+            // timeout can retire them instead of keeping them pinned inside a blocking pop.
+            void dispatchDynamic(std::shared_ptr<std::atomic_bool> retired)
             {
                 try
                 {
                     while (m_running)
                     {
-                        std::function<void()> fnc;
+                        auto processed { false };
+
+                        if constexpr (ThreadDispatchDetail::HasPopBulk<Queue>::value)
+                        {
+                            std::vector<std::function<void()>> tasks;
+
+                            if (m_queue.popBulk(tasks, ThreadDispatchDetail::DISPATCH_BULK_SIZE, false))
+                            {
+                                processed = true;
 
-                        if (m_queue.pop(fnc))
+                                for (auto& fnc : tasks)
+                                {
+                                    fnc();
+                                }
+                            }
+                        }
+                        else
                         {
-                            fnc();
+                            std::function<void()> fnc;
+
+                            if (m_queue.pop(fnc, false))
+                            {
+                                processed = true;
+                                fnc();
+                            }
+                        }
+
+                        if (!processed)
+                        {
+                            std::unique_lock<std::mutex> lock{ m_scaleMutex };
+
+                            if (!m_scaleCv.wait_for(lock, ThreadDispatchDetail::DISPATCH_IDLE_TIMEOUT,
+                                                    [this]() { return !m_running || m_queue.size() > 0; }))
+                            {
+                                // Idle for the whole timeout: shrink back towards the minimum.
+                                break;
+                            }
                         }
                     }
                 }
@@ -160,7 +276,55 @@ namespace Utils
                 {
                     std::cerr << "Dispatch handler error, " << ex.what() << std::endl;
                 }
+
+                --m_currentThreads;
+                *retired = true;
+            }
+
+            // Wakes a parked dynamic worker, and spawns a new one while the backlog
+            // outgrows the active workers and the pool is below its maximum.
+            void scaleUp()
+            {
+                m_scaleCv.notify_one();
+
+                if (m_currentThreads < m_numberOfThreads && m_queue.size() > m_currentThreads)
+                {
+                    std::lock_guard<std::mutex> lock{ m_dynamicThreadsMutex };
+                    reapRetiredThreads();
+
+                    // The running check under the lock keeps cancel() from missing a spawn:
+                    // joinThreads() takes this same lock, so it either runs before the spawn or
+                    // finds the new thread already in the vector.
+                    if (m_running && m_currentThreads < m_numberOfThreads)
+                    {
+                        auto retired { std::make_shared<std::atomic_bool>(false) };
+                        ++m_currentThreads;
+                        m_dynamicThreads.push_back({ std::thread{ &AsyncDispatcher<Type, Functor, Queue>::dispatchDynamic, this, retired }, retired });
+                    }
+                }
+            }
+
+            // Must be called with m_dynamicThreadsMutex held.
+            void reapRetiredThreads()
+            {
+                for (auto it = m_dynamicThreads.begin(); it != m_dynamicThreads.end();)
+                {
+                    if (*it->retired)
+                    {
+                        if (it->thread.joinable())
+                        {
+                            it->thread.join();
+                        }
+
+                        it = m_dynamicThreads.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
             }
+
             void joinThreads()
             {
                 for (auto& thread : m_threads)
@@ -170,14 +334,38 @@ namespace Utils
                         thread.join();
                     }
                 }
+
+                std::lock_guard<std::mutex> lock{ m_dynamicThreadsMutex };
+
+                for (auto& dynamicThread : m_dynamicThreads)
+                {
+                    if (dynamicThread.thread.joinable())
+                    {
+                        dynamicThread.thread.join();
+                    }
+                }
+
+                m_dynamicThreads.clear();
             }
 
+            struct DynamicThread
+            {
+                std::thread thread;
+                std::shared_ptr<std::atomic_bool> retired;
+            };
+
             Functor m_functor;
-            SafeQueue<std::function<void()>> m_queue;
+            Queue m_queue;
             std::vector<std::thread> m_threads;
+            std::vector<DynamicThread> m_dynamicThreads;
+            std::mutex m_dynamicThreadsMutex;
+            std::mutex m_scaleMutex;
+            std::condition_variable m_scaleCv;
+            std::atomic<unsigned int> m_currentThreads{ 0 };
             std::atomic_bool m_running;
             const unsigned int m_numberOfThreads;
             const size_t m_maxQueueSize;
+            const unsigned int m_minNumberOfThreads;
     };
 
     template <typename Input, typename Functor>
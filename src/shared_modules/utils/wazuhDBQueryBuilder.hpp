@@ -15,13 +15,92 @@
 #include "builder.hpp"
 #include "stringHelper.h"
 #include <string>
+#include <vector>
 
 constexpr auto WAZUH_DB_ALLOWED_CHARS {"-_ "};
 
+enum class WazuhDBQueryParam
+{
+    NUMBER, ///< Validated with Utils::isNumber before substitution.
+    VALUE   ///< Validated against WAZUH_DB_ALLOWED_CHARS before substitution, quoting lives in the skeleton.
+};
+
+/**
+ * @brief Compiled wazuh-db query skeleton.
+ *
+ * The literal segments are parsed once when the template is compiled; each format() call only
+ * validates the arguments and substitutes them into a reused buffer, so issuing thousands of
+ * structurally identical queries costs argument substitution instead of string assembly.
+ */
+class WazuhDBQueryTemplate final
+{
+private:
+    friend class WazuhDBQueryBuilder;
+
+    std::vector<std::string> m_segments;    ///< N+1 literal segments around N parameter slots.
+    std::vector<WazuhDBQueryParam> m_params; ///< Validation applied to each slot.
+    std::string m_buffer;                   ///< Reused output buffer, keeps its capacity across calls.
+
+    WazuhDBQueryTemplate(std::vector<std::string>&& segments, std::vector<WazuhDBQueryParam>&& params)
+        : m_segments {std::move(segments)}
+        , m_params {std::move(params)}
+    {
+    }
+
+public:
+    /**
+     * @brief Substitutes the arguments into the parameter slots and returns the assembled query.
+     *
+     * The returned reference stays valid until the next format() call on the same template.
+     *
+     * @param args One argument per parameter slot, in slot order.
+     * @return const std::string& The assembled query.
+     */
+    const std::string& format(const std::vector<std::string>& args)
+    {
+        if (args.size() != m_params.size())
+        {
+            throw std::runtime_error("Invalid number of arguments for the query template");
+        }
+
+        m_buffer.clear();
+        for (size_t i = 0; i < m_params.size(); ++i)
+        {
+            m_buffer += m_segments[i];
+
+            if (m_params[i] == WazuhDBQueryParam::NUMBER)
+            {
+                if (!Utils::isNumber(args[i]))
+                {
+                    throw std::runtime_error("Invalid numeric argument");
+                }
+            }
+            else if (!Utils::isAlphaNumericWithSpecialCharacters(args[i], WAZUH_DB_ALLOWED_CHARS))
+            {
+                throw std::runtime_error("Invalid argument");
+            }
+
+            m_buffer += args[i];
+        }
+        m_buffer += m_segments.back();
+
+        return m_buffer;
+    }
+};
+
 class WazuhDBQueryBuilder final : public Utils::Builder<WazuhDBQueryBuilder>
 {
 private:
     std::string m_query;
+    std::vector<std::string> m_segments;     ///< Literal segments accumulated before each parameter slot.
+    std::vector<WazuhDBQueryParam> m_params; ///< Parameter slots marked so far.
+
+    void markParam(WazuhDBQueryParam param)
+    {
+        m_segments.emplace_back(std::move(m_query));
+        m_query.clear();
+        m_params.emplace_back(param);
+    }
 
 public:
     WazuhDBQueryBuilder& global()
@@ -169,10 +248,53 @@ public:
         return *this;
     }
 
+    WazuhDBQueryBuilder& agentParam()
+    {
+        m_query += "agent ";
+        markParam(WazuhDBQueryParam::NUMBER);
+        m_query += " sql ";
+        return *this;
+    }
+
+    WazuhDBQueryBuilder& equalsToParam()
+    {
+        m_query += "= '";
+        markParam(WazuhDBQueryParam::VALUE);
+        m_query += "' ";
+        return *this;
+    }
+
+    WazuhDBQueryBuilder& agentCommandParam(const std::string& command)
+    {
+        if (!Utils::isAlphaNumericWithSpecialCharacters(command, WAZUH_DB_ALLOWED_CHARS))
+        {
+            throw std::runtime_error("Invalid command");
+        }
+        m_query += "agent ";
+        markParam(WazuhDBQueryParam::NUMBER);
+        m_query += " " + command + " get ";
+        return *this;
+    }
+
     std::string build()
     {
         return m_query;
     }
+
+    /**
+     * @brief Compiles the skeleton built so far into a reusable query template.
+     *
+     * The builder is consumed; each parameter slot marked while building becomes a slot of the
+     * template, filled on every format() call.
+     *
+     * @return WazuhDBQueryTemplate The compiled template.
+     */
+    WazuhDBQueryTemplate compile()
+    {
+        m_segments.emplace_back(std::move(m_query));
+        m_query.clear();
+        return WazuhDBQueryTemplate {std::move(m_segments), std::move(m_params)};
+    }
 };
 
 #endif /* _WAZUH_DB_QUERY_BUILDER_HPP */
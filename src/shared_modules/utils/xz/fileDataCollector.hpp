@@ -16,6 +16,8 @@
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace Xz
@@ -29,7 +31,8 @@ namespace Xz
         static constexpr size_t DEFAULT_BUFFER_SIZE {8192}; ///< Default buffer size
         std::filesystem::path m_filePath;                   ///< Output file path
         std::ofstream m_file;                               ///< Output file stream
-        std::vector<uint8_t> m_buffer; ///< Buffer used to receive data that will be saved to the file
+        std::shared_ptr<std::vector<uint8_t>>
+            m_spBuffer; ///< Buffer used to receive data that will be saved to the file
 
     public:
         /**
@@ -40,8 +43,27 @@ namespace Xz
          */
         explicit FileDataCollector(const std::filesystem::path& outputFilePath, size_t bufferSize = DEFAULT_BUFFER_SIZE)
             : m_filePath(outputFilePath)
+            , m_spBuffer(std::make_shared<std::vector<uint8_t>>(bufferSize))
         {
-            m_buffer.resize(bufferSize);
+        }
+
+        /**
+         * @brief Construct a new File Data Collector object reusing an external buffer
+         *
+         * @details Lets the caller share one receiving buffer across collectors, avoiding a new allocation on
+         * every processed file. If the buffer is empty it is resized to the default size on the first use.
+         *
+         * @param outputFilePath Path to the input file
+         * @param buffer Buffer to receive the output data
+         */
+        FileDataCollector(const std::filesystem::path& outputFilePath, std::shared_ptr<std::vector<uint8_t>> buffer)
+            : m_filePath(outputFilePath)
+            , m_spBuffer(std::move(buffer))
+        {
+            if (m_spBuffer->empty())
+            {
+                m_spBuffer->resize(DEFAULT_BUFFER_SIZE);
+            }
         }
 
         /*! @copydoc IDataCollector::begin() */
@@ -65,14 +87,14 @@ namespace Xz
         /*! @copydoc IDataCollector::setBuffer() */
         void setBuffer(uint8_t** buffer, size_t& buffSize) override
         {
-            *buffer = m_buffer.data();
-            buffSize = m_buffer.size();
+            *buffer = m_spBuffer->data();
+            buffSize = m_spBuffer->size();
         }
 
         /*! @copydoc IDataCollector::dataReady() */
         void dataReady(size_t unusedBufferLen) override
         {
-            m_file.write(reinterpret_cast<char*>(m_buffer.data()), m_buffer.size() - unusedBufferLen);
+            m_file.write(reinterpret_cast<char*>(m_spBuffer->data()), m_spBuffer->size() - unusedBufferLen);
             if (!m_file.good())
             {
                 throw std::runtime_error("Error saving data: " + std::string(std::strerror(errno))); // LCOV_EXCL_LINE
@@ -23,6 +23,7 @@ namespace Xz
     constexpr inline uint32_t PRESET_9_MAX_COMPRESSION {9};
     constexpr inline uint32_t DEFAULT_COMPRESSION_PRESET {PRESET_9_MAX_COMPRESSION};
     constexpr inline uint32_t DEFAULT_THREAD_COUNT {1};
+    constexpr inline uint64_t DEFAULT_DECODER_MEM_LIMIT {0}; ///< 0 keeps the library defaults
 
     /**
      * @brief Wrapper for the xz compressor of the lzma library
@@ -34,6 +35,7 @@ namespace Xz
     class Wrapper
     {
         uint32_t m_threadCount;                ///< Number of worker threads
+        uint64_t m_decoderMemLimit;            ///< Memory limit for the decoder, in bytes. 0 keeps the defaults
         lzma_stream m_strm = LZMA_STREAM_INIT; ///< context for the lzma library api
         lzma_mt m_multiThreadOptions {};       ///< lzma options for multi-thread mode
 
@@ -106,7 +108,9 @@ namespace Xz
 
             if (threadCount == 1)
             {
-                const auto ret {lzma_stream_decoder(&m_strm, UINT64_MAX, 0)};
+                // A configured memory limit makes the decoder fail with LZMA_MEMLIMIT_ERROR when exceeded.
+                const auto memLimit {m_decoderMemLimit != 0 ? m_decoderMemLimit : UINT64_MAX};
+                const auto ret {lzma_stream_decoder(&m_strm, memLimit, 0)};
                 if (ret != LZMA_OK)
                 {
                     // LCOV_EXCL_START
@@ -124,8 +128,10 @@ namespace Xz
                 m_multiThreadOptions.block_size = 0;
                 // See the documentation of lzma_mt in lzma/container.h
                 m_multiThreadOptions.timeout = 0;
-                // Set threading memory
-                m_multiThreadOptions.memlimit_threading = lzma_physmem() / 4;
+                // Set threading memory. This is a soft limit: when exceeded the decoder falls back to fewer
+                // threads instead of failing.
+                m_multiThreadOptions.memlimit_threading =
+                    m_decoderMemLimit != 0 ? m_decoderMemLimit : lzma_physmem() / 4;
                 // Do not limit max memory
                 m_multiThreadOptions.memlimit_stop = UINT64_MAX;
                 // Set number of worker threads
@@ -212,9 +218,14 @@ namespace Xz
          * @brief Construct a new Xz Wrapper object
          *
          * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         * @param decoderMemLimit Memory limit for the decoder, in bytes. On single-thread mode the decompression
+         * fails when the limit is exceeded, while on multi-thread mode the decoder falls back to fewer threads.
+         * 0 keeps the library defaults.
          */
-        explicit Wrapper(uint32_t threadCount = DEFAULT_THREAD_COUNT)
+        explicit Wrapper(uint32_t threadCount = DEFAULT_THREAD_COUNT,
+                         uint64_t decoderMemLimit = DEFAULT_DECODER_MEM_LIMIT)
             : m_threadCount(threadCount)
+            , m_decoderMemLimit(decoderMemLimit)
         {
         }
 
@@ -32,6 +32,7 @@ namespace Utils
         std::unique_ptr<Xz::IDataProvider> m_spDataProvider;   ///< Data provider
         std::unique_ptr<Xz::IDataCollector> m_spDataCollector; ///< Data collector
         uint32_t m_threadCount;
+        uint64_t m_decoderMemLimit;
 
     public:
         /**
@@ -40,13 +41,37 @@ namespace Utils
          * @param source Path to input file
          * @param dest Path to destination file
          * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         * @param decoderMemLimit Memory limit for the decoder, in bytes. 0 keeps the library defaults.
          */
         XzHelper(const std::filesystem::path& source,
                  const std::filesystem::path& dest,
-                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
+                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT,
+                 uint64_t decoderMemLimit = Xz::DEFAULT_DECODER_MEM_LIMIT)
             : m_spDataProvider(std::make_unique<Xz::FileDataProvider>(source))
             , m_spDataCollector(std::make_unique<Xz::FileDataCollector>(dest))
             , m_threadCount(threadCount)
+            , m_decoderMemLimit(decoderMemLimit)
+        {
+        }
+
+        /**
+         * @brief Construct XZ helper with file input and file output, reusing an external output buffer
+         *
+         * @param source Path to input file
+         * @param dest Path to destination file
+         * @param buffer Buffer for the output data, shared across calls to avoid a new allocation per file
+         * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         * @param decoderMemLimit Memory limit for the decoder, in bytes. 0 keeps the library defaults.
+         */
+        XzHelper(const std::filesystem::path& source,
+                 const std::filesystem::path& dest,
+                 const std::shared_ptr<std::vector<uint8_t>>& buffer,
+                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT,
+                 uint64_t decoderMemLimit = Xz::DEFAULT_DECODER_MEM_LIMIT)
+            : m_spDataProvider(std::make_unique<Xz::FileDataProvider>(source))
+            , m_spDataCollector(std::make_unique<Xz::FileDataCollector>(dest, buffer))
+            , m_threadCount(threadCount)
+            , m_decoderMemLimit(decoderMemLimit)
         {
         }
 
@@ -56,13 +81,16 @@ namespace Utils
          * @param source Path to input file
          * @param dest Vector for the output data
          * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         * @param decoderMemLimit Memory limit for the decoder, in bytes. 0 keeps the library defaults.
          */
         XzHelper(const std::filesystem::path& source,
                  std::vector<uint8_t>& dest,
-                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
+                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT,
+                 uint64_t decoderMemLimit = Xz::DEFAULT_DECODER_MEM_LIMIT)
             : m_spDataProvider(std::make_unique<Xz::FileDataProvider>(source))
             , m_spDataCollector(std::make_unique<Xz::VectorDataCollector>(dest))
             , m_threadCount(threadCount)
+            , m_decoderMemLimit(decoderMemLimit)
         {
         }
 
@@ -72,13 +100,16 @@ namespace Utils
          * @param source Vector with the input data
          * @param dest Path to destination file
          * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         * @param decoderMemLimit Memory limit for the decoder, in bytes. 0 keeps the library defaults.
          */
         XzHelper(const std::vector<uint8_t>& source,
                  const std::filesystem::path& dest,
-                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
+                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT,
+                 uint64_t decoderMemLimit = Xz::DEFAULT_DECODER_MEM_LIMIT)
             : m_spDataProvider(std::make_unique<Xz::VectorDataProvider>(source))
             , m_spDataCollector(std::make_unique<Xz::FileDataCollector>(dest))
             , m_threadCount(threadCount)
+            , m_decoderMemLimit(decoderMemLimit)
         {
         }
 
@@ -88,13 +119,16 @@ namespace Utils
          * @param source Vector with the input data
          * @param dest Vector for the output data
          * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         * @param decoderMemLimit Memory limit for the decoder, in bytes. 0 keeps the library defaults.
          */
         XzHelper(const std::vector<uint8_t>& source,
                  std::vector<uint8_t>& dest,
-                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
+                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT,
+                 uint64_t decoderMemLimit = Xz::DEFAULT_DECODER_MEM_LIMIT)
             : m_spDataProvider(std::make_unique<Xz::VectorDataProvider>(source))
             , m_spDataCollector(std::make_unique<Xz::VectorDataCollector>(dest))
             , m_threadCount(threadCount)
+            , m_decoderMemLimit(decoderMemLimit)
         {
         }
 
@@ -104,13 +138,16 @@ namespace Utils
          * @param source String with the input data
          * @param dest Path to destination file
          * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         * @param decoderMemLimit Memory limit for the decoder, in bytes. 0 keeps the library defaults.
          */
         XzHelper(const std::string& source,
                  const std::filesystem::path& dest,
-                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
+                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT,
+                 uint64_t decoderMemLimit = Xz::DEFAULT_DECODER_MEM_LIMIT)
             : m_spDataProvider(std::make_unique<Xz::StringDataProvider>(source))
             , m_spDataCollector(std::make_unique<Xz::FileDataCollector>(dest))
             , m_threadCount(threadCount)
+            , m_decoderMemLimit(decoderMemLimit)
         {
         }
 
@@ -120,11 +157,16 @@ namespace Utils
          * @param source String with the input data
          * @param dest Vector for the output data
          * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         * @param decoderMemLimit Memory limit for the decoder, in bytes. 0 keeps the library defaults.
          */
-        XzHelper(const std::string& source, std::vector<uint8_t>& dest, uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
+        XzHelper(const std::string& source,
+                 std::vector<uint8_t>& dest,
+                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT,
+                 uint64_t decoderMemLimit = Xz::DEFAULT_DECODER_MEM_LIMIT)
             : m_spDataProvider(std::make_unique<Xz::StringDataProvider>(source))
             , m_spDataCollector(std::make_unique<Xz::VectorDataCollector>(dest))
             , m_threadCount(threadCount)
+            , m_decoderMemLimit(decoderMemLimit)
         {
         }
 
@@ -146,7 +188,7 @@ namespace Utils
          */
         void decompress()
         {
-            Xz::Wrapper xz(m_threadCount);
+            Xz::Wrapper xz(m_threadCount, m_decoderMemLimit);
             xz.decompress(*m_spDataProvider, *m_spDataCollector);
         }
     };
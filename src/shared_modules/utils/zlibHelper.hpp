@@ -55,8 +55,13 @@ namespace Utils
          *
          * @param gzFilePath Compressed (.gz) file path.
          * @param outputFilePath Uncompressed file pah.
+         * @param spScratchBuffer Optional buffer to stream the decompressed data through. Callers decompressing
+         * many files can pass the same buffer to every call to avoid cycling one allocation per file. If not
+         * provided, an internal buffer is used.
          */
-        static void gzipDecompress(const std::filesystem::path& gzFilePath, const std::filesystem::path& outputFilePath)
+        static void gzipDecompress(const std::filesystem::path& gzFilePath,
+                                   const std::filesystem::path& outputFilePath,
+                                   const std::shared_ptr<std::vector<char>>& spScratchBuffer = nullptr)
         {
             // Check input file extension.
             if (gzFilePath.extension() != ".gz")
@@ -78,24 +83,28 @@ namespace Utils
                 throw std::runtime_error("Unable to open compressed file: " + gzFilePath.string());
             }
 
+            const auto spBuffer {spScratchBuffer ? spScratchBuffer : std::make_shared<std::vector<char>>(GZ_BUF_LEN)};
+            if (spBuffer->size() < GZ_BUF_LEN)
+            {
+                spBuffer->resize(GZ_BUF_LEN);
+            }
+            auto& buf {*spBuffer};
+
             int len {};
-            char buf[GZ_BUF_LEN] {};
             do
             {
-                len = gzread(gzFile.get(), buf, sizeof(buf));
+                len = gzread(gzFile.get(), buf.data(), buf.size());
 
                 if (len > 0)
                 {
-                    if (outputFile.write(buf, len).bad())
+                    if (outputFile.write(buf.data(), len).bad())
                     {
                         // LCOV_EXCL_START
                         throw std::runtime_error("Unable to write to destination file: " + outputFilePath.string());
                         // LCOV_EXCL_STOP
                     }
-
-                    buf[0] = '\0';
                 }
-            } while (len == sizeof(buf));
+            } while (len == static_cast<int>(buf.size()));
             outputFile.close();
         }
 
@@ -104,11 +113,23 @@ namespace Utils
          *
          * @param zipFilePath Compressed (.zip) file path.
          * @param outputDir Folder where the output files will be stored.
+         * @param spScratchBuffer Optional buffer to stream the decompressed data through. Callers decompressing
+         * many files can pass the same buffer to every call to avoid cycling one allocation per file. If not
+         * provided, an internal buffer is used.
          * @return std::vector<std::string> List of decompressed files.
          */
         static std::vector<std::string> zipDecompress(const std::filesystem::path& zipFilePath,
-                                                      const std::filesystem::path& outputDir)
+                                                      const std::filesystem::path& outputDir,
+                                                      const std::shared_ptr<std::vector<char>>& spScratchBuffer = nullptr)
         {
+            // Decompressed data is streamed through a single buffer, reused for every file in the archive.
+            const auto spBuffer {spScratchBuffer ? spScratchBuffer : std::make_shared<std::vector<char>>(ZIP_BUF_LEN)};
+            if (spBuffer->size() < ZIP_BUF_LEN)
+            {
+                spBuffer->resize(ZIP_BUF_LEN);
+            }
+            auto& buffer {*spBuffer};
+
             // Open .zip file.
             UnzFilePtr spUnzFile {unzOpen(zipFilePath.c_str())};
             if (!spUnzFile)
@@ -173,8 +194,7 @@ namespace Utils
                     unsigned long bytesRead, totalBytesRead {0};
                     do
                     {
-                        // Read compressed data by ZIP_BUF_LEN chunks.
-                        std::vector<char> buffer(ZIP_BUF_LEN);
+                        // Read compressed data by buffer sized chunks.
                         bytesRead = unzReadCurrentFile(spUnzFile.get(), buffer.data(), buffer.size());
                         totalBytesRead += bytesRead;
 
@@ -0,0 +1,688 @@
+/*
+ * Wazuh Vulnerability scanner - Policy Manager
+ * Copyright (C) 2015, Wazuh Inc.
+ * September 8, 2023.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _POLICY_MANAGER_HPP
+#define _POLICY_MANAGER_HPP
+
+#include "singleton.hpp"
+#include <external/nlohmann/json.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+constexpr uint32_t DEFAULT_TRANSLATION_LRU_SIZE {2048};
+constexpr uint32_t DEFAULT_OSDATA_LRU_SIZE {1000};
+constexpr uint32_t DEFAULT_REMEDIATION_LRU_SIZE {2048};
+constexpr auto DEFAULT_FEED_UPDATE_INTERVAL {"60m"};
+constexpr uint64_t MINIMUM_FEED_UPDATE_INTERVAL {3600};
+constexpr auto UPDATER_TOPIC_NAME {"vulnerability_feed_manager"};
+constexpr auto UPDATER_CONSUMER_NAME {"Wazuh VulnerabilityDetector"};
+constexpr auto UPDATER_DATABASE_PATH {"queue/vd_updater/rocksdb"};
+constexpr auto UPDATER_OUTPUT_FOLDER {"queue/vd_updater/tmp"};
+constexpr auto UPDATER_CONTENT_FILE_NAME {"api_file.json"};
+
+/**
+ * @brief Interface for components interested in policy changes.
+ *
+ * Subscribers are notified after a new policy snapshot has been published, so they can
+ * re-read the settings they depend on through the regular getters.
+ */
+class IPolicySubscriber
+{
+public:
+    virtual ~IPolicySubscriber() = default;
+
+    /**
+     * @brief Called after a new policy snapshot has been published.
+     *
+     * @param changedSections Names of the configuration sections that changed.
+     */
+    virtual void policyUpdated(const nlohmann::json& changedSections) = 0;
+};
+
+/**
+ * @brief PolicyManager class.
+ *
+ * The manager keeps the module configuration in an immutable snapshot published through an
+ * atomic shared pointer. Readers on the scan paths grab the current snapshot without taking
+ * any lock; @see initialize and @see reload build a new snapshot and publish it atomically,
+ * so concurrent scans always observe a consistent configuration. Reloads are incremental:
+ * only the sections that actually changed are re-derived, the rest is carried over from the
+ * previous snapshot.
+ */
+class PolicyManager final : public Singleton<PolicyManager>
+{
+private:
+    /**
+     * @brief Immutable view of the configuration and the state derived from it.
+     *
+     * Instances are never modified after being published; any change builds a new one.
+     */
+    struct PolicyData final
+    {
+        nlohmann::json configuration;               ///< Raw configuration the snapshot was built from.
+        bool vulnerabilityDetectionEnabled {false}; ///< Whether the module is enabled.
+        bool indexerEnabled {false};                ///< Whether the indexer is enabled.
+        uint64_t feedUpdateTime {MINIMUM_FEED_UPDATE_INTERVAL}; ///< Feed update interval in seconds.
+        std::string feedUrl;                                    ///< URL of the content source in use.
+        std::string ctiUrl;                                     ///< URL of the CTI source, if any.
+        nlohmann::json updaterConfiguration;                    ///< Content updater orchestration config.
+        nlohmann::json indexerConfiguration;                    ///< Raw indexer section.
+        std::set<std::string> hostList;                         ///< Indexer hosts.
+        std::set<std::string> caList;                           ///< Indexer certificate authorities.
+        std::string username;                                   ///< Indexer username.
+        std::string password;                                   ///< Indexer password.
+        std::string certificate;                                ///< Indexer SSL certificate.
+        std::string key;                                        ///< Indexer SSL key.
+        std::string clusterName;                                ///< Cluster name.
+        std::string clusterNodeName;                            ///< Cluster node name.
+        bool clusterEnabled {false};                            ///< Whether the cluster is enabled.
+        bool managerDisabledScan {false};             ///< Whether the manager scan is disabled.
+        uint64_t alertsMaxEps {0};                    ///< Alerts per second cap, 0 means unlimited.
+        uint32_t translationLRUSize {DEFAULT_TRANSLATION_LRU_SIZE}; ///< Translation cache size.
+        uint32_t osdataLRUSize {DEFAULT_OSDATA_LRU_SIZE};           ///< OS data cache size.
+        uint32_t remediationLRUSize {DEFAULT_REMEDIATION_LRU_SIZE}; ///< Remediation cache size.
+    };
+
+    std::shared_ptr<const PolicyData> m_policyData; ///< Current snapshot, accessed with std::atomic_load/store.
+    std::vector<std::weak_ptr<IPolicySubscriber>> m_subscribers; ///< Components notified on policy changes.
+    std::mutex m_subscribersMutex;                               ///< Protects the subscribers list.
+
+    /**
+     * @brief Returns the current snapshot.
+     *
+     * @return std::shared_ptr<const PolicyData> Current snapshot.
+     * @throws std::runtime_error If the manager has not been initialized.
+     */
+    std::shared_ptr<const PolicyData> policyData() const
+    {
+        auto data = std::atomic_load(&m_policyData);
+        if (!data)
+        {
+            throw std::runtime_error("PolicyManager not initialized.");
+        }
+        return data;
+    }
+
+    /**
+     * @brief Parses a time interval expressed as a number with an optional unit suffix.
+     *
+     * @param interval Interval to parse, e.g. "60m".
+     * @return uint64_t Interval in seconds.
+     * @throws std::runtime_error If the interval is malformed or not positive.
+     */
+    static uint64_t parseTimeInterval(const std::string& interval)
+    {
+        int64_t value {0};
+        int64_t multiplier {1};
+        size_t unitPos {0};
+        try
+        {
+            value = std::stoll(interval, &unitPos);
+        }
+        catch (const std::exception&)
+        {
+            throw std::runtime_error("Invalid configuration: unable to parse time interval '" + interval + "'.");
+        }
+
+        if (unitPos < interval.size())
+        {
+            if (unitPos + 1 != interval.size())
+            {
+                throw std::runtime_error("Invalid configuration: unable to parse time interval '" + interval + "'.");
+            }
+            switch (interval.at(unitPos))
+            {
+                case 's': multiplier = 1; break;
+                case 'm': multiplier = 60; break;
+                case 'h': multiplier = 3600; break;
+                case 'd': multiplier = 86400; break;
+                default:
+                    throw std::runtime_error("Invalid configuration: unknown time unit in interval '" + interval
+                                             + "'.");
+            }
+        }
+
+        if (value <= 0)
+        {
+            throw std::runtime_error("Invalid configuration: time interval '" + interval + "' must be positive.");
+        }
+
+        return static_cast<uint64_t>(value) * static_cast<uint64_t>(multiplier);
+    }
+
+    /**
+     * @brief Checks a mandatory field of the updater section.
+     *
+     * @param object Object holding the field.
+     * @param field Field name.
+     * @param isValidType Type predicate the field value must satisfy.
+     */
+    static void
+    checkUpdaterField(const nlohmann::json& object, const std::string& field, bool (nlohmann::json::*isValidType)() const)
+    {
+        if (!object.contains(field) || !(object.at(field).*isValidType)())
+        {
+            throw std::runtime_error("Invalid configuration: missing or invalid updater field '" + field + "'.");
+        }
+    }
+
+    /**
+     * @brief Validates a user provided updater section.
+     *
+     * @param updaterConfiguration Updater section to validate.
+     * @throws std::runtime_error If any mandatory field is missing or has the wrong type.
+     */
+    static void validateUpdaterConfiguration(const nlohmann::json& updaterConfiguration)
+    {
+        checkUpdaterField(updaterConfiguration, "interval", &nlohmann::json::is_number_integer);
+        checkUpdaterField(updaterConfiguration, "ondemand", &nlohmann::json::is_boolean);
+        checkUpdaterField(updaterConfiguration, "topicName", &nlohmann::json::is_string);
+        checkUpdaterField(updaterConfiguration, "configData", &nlohmann::json::is_object);
+
+        const auto& configData = updaterConfiguration.at("configData");
+        checkUpdaterField(configData, "consumerName", &nlohmann::json::is_string);
+        checkUpdaterField(configData, "contentSource", &nlohmann::json::is_string);
+        checkUpdaterField(configData, "compressionType", &nlohmann::json::is_string);
+        checkUpdaterField(configData, "versionedContent", &nlohmann::json::is_string);
+        checkUpdaterField(configData, "deleteDownloadedContent", &nlohmann::json::is_boolean);
+        checkUpdaterField(configData, "outputFolder", &nlohmann::json::is_string);
+        checkUpdaterField(configData, "contentFileName", &nlohmann::json::is_string);
+        checkUpdaterField(configData, "databasePath", &nlohmann::json::is_string);
+        checkUpdaterField(configData, "url", &nlohmann::json::is_string);
+        checkUpdaterField(configData, "offset", &nlohmann::json::is_number_integer);
+
+        const auto url = configData.at("url").get<std::string>();
+        if (url.rfind("http://", 0) != 0 && url.rfind("https://", 0) != 0)
+        {
+            throw std::runtime_error("Invalid configuration: updater URL '" + url + "' has an unsupported scheme.");
+        }
+    }
+
+    /**
+     * @brief Returns a copy of a configuration section, or null if absent.
+     *
+     * @param configuration Configuration to read.
+     * @param section Section name.
+     */
+    static nlohmann::json sectionOf(const nlohmann::json& configuration, const std::string& section)
+    {
+        return configuration.contains(section) ? configuration.at(section) : nlohmann::json {};
+    }
+
+    /**
+     * @brief Derives the feed related state from the vulnerability-detection and updater sections.
+     *
+     * @param configuration Configuration to read.
+     * @param data Snapshot under construction.
+     */
+    static void deriveFeed(const nlohmann::json& configuration, PolicyData& data)
+    {
+        const auto& vdConfiguration = configuration.at("vulnerability-detection");
+        data.vulnerabilityDetectionEnabled = vdConfiguration.at("enabled") == "yes";
+
+        if (configuration.contains("updater"))
+        {
+            validateUpdaterConfiguration(configuration.at("updater"));
+            data.updaterConfiguration = configuration.at("updater");
+            data.feedUpdateTime = data.updaterConfiguration.at("interval").get<uint64_t>();
+            data.ctiUrl = data.updaterConfiguration.at("configData").at("url");
+            data.feedUrl = data.ctiUrl;
+            return;
+        }
+
+        data.feedUpdateTime = std::max(
+            parseTimeInterval(vdConfiguration.value("feed-update-interval", DEFAULT_FEED_UPDATE_INTERVAL)),
+            MINIMUM_FEED_UPDATE_INTERVAL);
+
+        nlohmann::json configData;
+        configData["consumerName"] = UPDATER_CONSUMER_NAME;
+        configData["compressionType"] = "raw";
+        configData["versionedContent"] = "false";
+        configData["deleteDownloadedContent"] = true;
+        configData["outputFolder"] = UPDATER_OUTPUT_FOLDER;
+        configData["databasePath"] = UPDATER_DATABASE_PATH;
+        configData["offset"] = 0;
+
+        // The offline source takes precedence over the CTI source.
+        if (vdConfiguration.contains("offline-url"))
+        {
+            configData["contentSource"] = "offline";
+            configData["url"] = vdConfiguration.at("offline-url");
+            data.ctiUrl.clear();
+        }
+        else if (vdConfiguration.contains("cti-url"))
+        {
+            configData["contentSource"] = "cti-offset";
+            configData["contentFileName"] = UPDATER_CONTENT_FILE_NAME;
+            configData["url"] = vdConfiguration.at("cti-url");
+            data.ctiUrl = vdConfiguration.at("cti-url");
+        }
+        else
+        {
+            throw std::runtime_error(
+                "Invalid configuration: either 'offline-url', 'cti-url' or an 'updater' section is required.");
+        }
+        data.feedUrl = configData.at("url");
+
+        data.updaterConfiguration = nlohmann::json {{"interval", data.feedUpdateTime},
+                                                    {"ondemand", true},
+                                                    {"topicName", UPDATER_TOPIC_NAME},
+                                                    {"configData", std::move(configData)}};
+    }
+
+    /**
+     * @brief Derives the indexer related state.
+     *
+     * @param configuration Configuration to read.
+     * @param data Snapshot under construction.
+     */
+    static void deriveIndexer(const nlohmann::json& configuration, PolicyData& data)
+    {
+        data.indexerConfiguration = sectionOf(configuration, "indexer");
+        data.indexerEnabled = false;
+        data.hostList.clear();
+        data.caList.clear();
+        data.username.clear();
+        data.password.clear();
+        data.certificate.clear();
+        data.key.clear();
+
+        if (!data.indexerConfiguration.is_object())
+        {
+            return;
+        }
+
+        const auto& indexerConfiguration = data.indexerConfiguration;
+        data.indexerEnabled = indexerConfiguration.value("enabled", "no") == "yes";
+        for (const auto& host : indexerConfiguration.value("hosts", nlohmann::json::array()))
+        {
+            data.hostList.insert(host.get<std::string>());
+        }
+        data.username = indexerConfiguration.value("username", "");
+        data.password = indexerConfiguration.value("password", "");
+
+        if (indexerConfiguration.contains("ssl"))
+        {
+            const auto& sslConfiguration = indexerConfiguration.at("ssl");
+            for (const auto& ca : sslConfiguration.value("certificate_authorities", nlohmann::json::array()))
+            {
+                data.caList.insert(ca.get<std::string>());
+            }
+            data.certificate = sslConfiguration.value("certificate", "");
+            data.key = sslConfiguration.value("key", "");
+        }
+    }
+
+    /**
+     * @brief Derives the cluster and manager related state.
+     *
+     * @param configuration Configuration to read.
+     * @param data Snapshot under construction.
+     */
+    static void deriveDeployment(const nlohmann::json& configuration, PolicyData& data)
+    {
+        data.clusterName = configuration.value("clusterName", "");
+        data.clusterNodeName = configuration.value("clusterNodeName", "");
+        data.clusterEnabled = configuration.value("clusterEnabled", false);
+        data.managerDisabledScan = configuration.value("managerDisabledScan", false);
+        data.alertsMaxEps = configuration.value("maxEps", uint64_t {0});
+    }
+
+    /**
+     * @brief Derives the cache sizes.
+     *
+     * @param configuration Configuration to read.
+     * @param data Snapshot under construction.
+     */
+    static void deriveCaches(const nlohmann::json& configuration, PolicyData& data)
+    {
+        data.translationLRUSize = configuration.value("translationLRUSize", DEFAULT_TRANSLATION_LRU_SIZE);
+        data.osdataLRUSize = configuration.value("osdataLRUSize", DEFAULT_OSDATA_LRU_SIZE);
+        data.remediationLRUSize = configuration.value("remediationLRUSize", DEFAULT_REMEDIATION_LRU_SIZE);
+    }
+
+    /**
+     * @brief Publishes a snapshot and notifies the subscribers.
+     *
+     * @param data Snapshot to publish.
+     * @param changedSections Names of the configuration sections that changed.
+     */
+    void publish(std::shared_ptr<const PolicyData> data, const nlohmann::json& changedSections)
+    {
+        std::atomic_store(&m_policyData, std::move(data));
+
+        std::lock_guard<std::mutex> lock(m_subscribersMutex);
+        auto it = m_subscribers.begin();
+        while (it != m_subscribers.end())
+        {
+            if (auto subscriber = it->lock())
+            {
+                subscriber->policyUpdated(changedSections);
+                ++it;
+            }
+            else
+            {
+                it = m_subscribers.erase(it);
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Validates a configuration without applying it.
+     *
+     * @param configuration Configuration to validate.
+     * @throws std::runtime_error If the configuration is invalid.
+     */
+    void validateConfiguration(const nlohmann::json& configuration) const
+    {
+        if (!configuration.contains("vulnerability-detection"))
+        {
+            throw std::runtime_error("Invalid configuration: 'vulnerability-detection' section not found.");
+        }
+
+        const auto& vdConfiguration = configuration.at("vulnerability-detection");
+        if (!vdConfiguration.contains("enabled") || !vdConfiguration.at("enabled").is_string())
+        {
+            throw std::runtime_error("Invalid configuration: 'enabled' is mandatory in 'vulnerability-detection'.");
+        }
+        if (!vdConfiguration.contains("index-status") || !vdConfiguration.at("index-status").is_string())
+        {
+            throw std::runtime_error(
+                "Invalid configuration: 'index-status' is mandatory in 'vulnerability-detection'.");
+        }
+
+        // Indexing the vulnerability state requires a working indexer connection.
+        if (vdConfiguration.at("enabled") == "yes" && vdConfiguration.at("index-status") == "yes"
+            && configuration.contains("indexer") && configuration.at("indexer").value("enabled", "no") != "yes")
+        {
+            throw std::runtime_error("Invalid configuration: 'index-status' requires the indexer to be enabled.");
+        }
+
+        if (vdConfiguration.contains("offline-url"))
+        {
+            const auto offlineUrl = vdConfiguration.at("offline-url").get<std::string>();
+            if (offlineUrl.rfind("file://", 0) != 0 && offlineUrl.rfind("http://", 0) != 0
+                && offlineUrl.rfind("https://", 0) != 0)
+            {
+                throw std::runtime_error("Invalid configuration: 'offline-url' has an unsupported scheme.");
+            }
+        }
+
+        if (vdConfiguration.contains("feed-update-interval"))
+        {
+            parseTimeInterval(vdConfiguration.at("feed-update-interval").get<std::string>());
+        }
+    }
+
+    /**
+     * @brief Initializes the manager, building and publishing the first snapshot.
+     *
+     * @param configuration Module configuration.
+     * @throws std::runtime_error If the configuration is invalid.
+     */
+    void initialize(const nlohmann::json& configuration)
+    {
+        validateConfiguration(configuration);
+
+        auto data = std::make_shared<PolicyData>();
+        data->configuration = configuration;
+        deriveFeed(configuration, *data);
+        deriveIndexer(configuration, *data);
+        deriveDeployment(configuration, *data);
+        deriveCaches(configuration, *data);
+
+        std::atomic_store(&m_policyData, std::shared_ptr<const PolicyData> {std::move(data)});
+    }
+
+    /**
+     * @brief Applies a new configuration incrementally.
+     *
+     * Only the sections that differ from the current snapshot are re-derived; the rest of the
+     * state is carried over. Subscribers are notified with the names of the changed sections.
+     *
+     * @param configuration New module configuration.
+     * @throws std::runtime_error If the configuration is invalid or the manager is not initialized.
+     */
+    void reload(const nlohmann::json& configuration)
+    {
+        validateConfiguration(configuration);
+        const auto current = policyData();
+
+        auto changedSections = nlohmann::json::array();
+        auto data = std::make_shared<PolicyData>(*current);
+        data->configuration = configuration;
+
+        if (sectionOf(current->configuration, "vulnerability-detection")
+                != sectionOf(configuration, "vulnerability-detection")
+            || sectionOf(current->configuration, "updater") != sectionOf(configuration, "updater"))
+        {
+            deriveFeed(configuration, *data);
+            changedSections.push_back("vulnerability-detection");
+        }
+        if (sectionOf(current->configuration, "indexer") != sectionOf(configuration, "indexer"))
+        {
+            deriveIndexer(configuration, *data);
+            changedSections.push_back("indexer");
+        }
+        if (data->clusterName != configuration.value("clusterName", "")
+            || data->clusterNodeName != configuration.value("clusterNodeName", "")
+            || data->clusterEnabled != configuration.value("clusterEnabled", false)
+            || data->managerDisabledScan != configuration.value("managerDisabledScan", false)
+            || data->alertsMaxEps != configuration.value("maxEps", uint64_t {0}))
+        {
+            deriveDeployment(configuration, *data);
+            changedSections.push_back("deployment");
+        }
+        if (data->translationLRUSize != configuration.value("translationLRUSize", DEFAULT_TRANSLATION_LRU_SIZE)
+            || data->osdataLRUSize != configuration.value("osdataLRUSize", DEFAULT_OSDATA_LRU_SIZE)
+            || data->remediationLRUSize != configuration.value("remediationLRUSize", DEFAULT_REMEDIATION_LRU_SIZE))
+        {
+            deriveCaches(configuration, *data);
+            changedSections.push_back("caches");
+        }
+
+        if (!changedSections.empty())
+        {
+            publish(std::move(data), changedSections);
+        }
+    }
+
+    /**
+     * @brief Updates the topic of the updater configuration.
+     *
+     * @param topicName New topic name.
+     */
+    void setUpdaterConfiguration(const std::string& topicName)
+    {
+        const auto current = policyData();
+        auto data = std::make_shared<PolicyData>(*current);
+        data->updaterConfiguration["topicName"] = topicName;
+        publish(std::move(data), nlohmann::json::array({"updater"}));
+    }
+
+    /**
+     * @brief Registers a subscriber for policy updates.
+     *
+     * @param subscriber Subscriber to register.
+     */
+    void addSubscriber(const std::shared_ptr<IPolicySubscriber>& subscriber)
+    {
+        std::lock_guard<std::mutex> lock(m_subscribersMutex);
+        m_subscribers.push_back(subscriber);
+    }
+
+    /**
+     * @brief Clears the published snapshot and the subscribers.
+     *
+     */
+    void teardown()
+    {
+        std::atomic_store(&m_policyData, std::shared_ptr<const PolicyData> {});
+        std::lock_guard<std::mutex> lock(m_subscribersMutex);
+        m_subscribers.clear();
+    }
+
+    /**
+     * @brief Checks if the vulnerability detection module is enabled.
+     *
+     * @return true if enabled.
+     */
+    bool isVulnerabilityDetectionEnabled() const { return policyData()->vulnerabilityDetectionEnabled; }
+
+    /**
+     * @brief Checks if the indexer is enabled.
+     *
+     * @return true if enabled.
+     */
+    bool isIndexerEnabled() const { return policyData()->indexerEnabled; }
+
+    /**
+     * @brief Gets the feed update interval in seconds.
+     *
+     * @return uint64_t Interval in seconds.
+     */
+    uint64_t getFeedUpdateTime() const { return policyData()->feedUpdateTime; }
+
+    /**
+     * @brief Gets the URL of the content source in use.
+     *
+     * @return std::string Feed URL.
+     */
+    std::string getFeedUrl() const { return policyData()->feedUrl; }
+
+    /**
+     * @brief Gets the URL of the CTI source.
+     *
+     * @return std::string CTI URL.
+     */
+    std::string getCTIUrl() const { return policyData()->ctiUrl; }
+
+    /**
+     * @brief Gets the content updater orchestration configuration.
+     *
+     * @return nlohmann::json Updater configuration.
+     */
+    nlohmann::json getUpdaterConfiguration() const { return policyData()->updaterConfiguration; }
+
+    /**
+     * @brief Gets the raw indexer configuration.
+     *
+     * @return nlohmann::json Indexer configuration.
+     */
+    nlohmann::json getIndexerConfiguration() const { return policyData()->indexerConfiguration; }
+
+    /**
+     * @brief Gets the indexer host list.
+     *
+     * @return std::set<std::string> Host list.
+     */
+    std::set<std::string> getHostList() const { return policyData()->hostList; }
+
+    /**
+     * @brief Gets the indexer certificate authorities.
+     *
+     * @return std::set<std::string> Certificate authorities.
+     */
+    std::set<std::string> getCAList() const { return policyData()->caList; }
+
+    /**
+     * @brief Gets the indexer username.
+     *
+     * @return std::string Username.
+     */
+    std::string getUsername() const { return policyData()->username; }
+
+    /**
+     * @brief Gets the indexer password.
+     *
+     * @return std::string Password.
+     */
+    std::string getPassword() const { return policyData()->password; }
+
+    /**
+     * @brief Gets the indexer SSL certificate.
+     *
+     * @return std::string Certificate.
+     */
+    std::string getCertificate() const { return policyData()->certificate; }
+
+    /**
+     * @brief Gets the indexer SSL key.
+     *
+     * @return std::string Key.
+     */
+    std::string getKey() const { return policyData()->key; }
+
+    /**
+     * @brief Gets the cluster name.
+     *
+     * @return std::string Cluster name.
+     */
+    std::string getClusterName() const { return policyData()->clusterName; }
+
+    /**
+     * @brief Gets the cluster node name.
+     *
+     * @return std::string Cluster node name.
+     */
+    std::string getClusterNodeName() const { return policyData()->clusterNodeName; }
+
+    /**
+     * @brief Checks if the cluster is enabled.
+     *
+     * @return true if enabled.
+     */
+    bool getClusterStatus() const { return policyData()->clusterEnabled; }
+
+    /**
+     * @brief Checks if the vulnerability scan is disabled on the manager.
+     *
+     * @return true if disabled.
+     */
+    bool getManagerDisabledScan() const { return policyData()->managerDisabledScan; }
+
+    /**
+     * @brief Gets the maximum number of alerts per second, 0 means unlimited.
+     *
+     * @return uint64_t Alerts per second cap.
+     */
+    uint64_t getAlertsMaxEventsPerSecond() const { return policyData()->alertsMaxEps; }
+
+    /**
+     * @brief Gets the translation LRU cache size.
+     *
+     * @return uint32_t Cache size.
+     */
+    uint32_t getTranslationLRUSize() const { return policyData()->translationLRUSize; }
+
+    /**
+     * @brief Gets the OS data LRU cache size.
+     *
+     * @return uint32_t Cache size.
+     */
+    uint32_t getOsdataLRUSize() const { return policyData()->osdataLRUSize; }
+
+    /**
+     * @brief Gets the remediation LRU cache size.
+     *
+     * @return uint32_t Cache size.
+     */
+    uint32_t getRemediationLRUSize() const { return policyData()->remediationLRUSize; }
+};
+
+#endif // _POLICY_MANAGER_HPP
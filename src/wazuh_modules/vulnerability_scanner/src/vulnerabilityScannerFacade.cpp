@@ -23,7 +23,13 @@
 
 constexpr auto DEFAULT_QUEUE_PATH = "queue/sockets/queue";
 constexpr auto REPORTS_QUEUE_PATH = "queue/vd/reports";
-constexpr auto REPORTS_BULK_SIZE {1};
+constexpr auto REPORTS_BULK_SIZE {128};
+// Batched report frame, matching the format the event socket accepts:
+// [marker][version][uint32 LE length][report]... in one datagram.
+constexpr char REPORT_FRAME_MARKER {'\0'};
+constexpr char REPORT_FRAME_VERSION {0x01};
+constexpr auto REPORT_FRAME_LENGTH_SIZE {sizeof(uint32_t)};
+constexpr auto REPORT_BATCH_MAX_BYTES {65536};
 constexpr auto EVENTS_BULK_SIZE {1};
 constexpr auto EVENTS_QUEUE_PATH = "queue/vd/event";
 constexpr auto MICROSEC_FACTOR {1000000};
@@ -120,17 +126,41 @@ void VulnerabilityScannerFacade::initAlertReportDispatcher()
     m_reportDispatcher = std::make_shared<ReportDispatcher>(
         [this, reportsWait](std::queue<std::string>& dataQueue)
         {
+            // Aggregate the pending reports into framed batch datagrams capped at
+            // REPORT_BATCH_MAX_BYTES, so post-update rescans pay the socket overhead
+            // once per batch instead of once per finding.
+            std::string frame;
             while (!dataQueue.empty())
             {
-                const auto& data = dataQueue.front();
-                m_reportSocketClient->send(data.c_str(), data.size());
+                frame.clear();
+                frame.push_back(REPORT_FRAME_MARKER);
+                frame.push_back(REPORT_FRAME_VERSION);
+
+                uint64_t batchedCount {0};
+                while (!dataQueue.empty())
+                {
+                    const auto& data = dataQueue.front();
+                    // Always frame at least one report, even if it exceeds the cap on its own.
+                    if (batchedCount > 0
+                        && frame.size() + REPORT_FRAME_LENGTH_SIZE + data.size() > REPORT_BATCH_MAX_BYTES)
+                    {
+                        break;
+                    }
+                    const auto length = static_cast<uint32_t>(data.size());
+                    frame.append(reinterpret_cast<const char*>(&length), sizeof(length));
+                    frame.append(data);
+                    logDebug2(WM_VULNSCAN_LOGTAG, "Report batched: %s", data.c_str());
+                    dataQueue.pop();
+                    ++batchedCount;
+                }
+
+                m_reportSocketClient->send(frame.c_str(), frame.size());
+                logDebug2(WM_VULNSCAN_LOGTAG, "Report batch sent: %llu reports", batchedCount);
                 // We wait to keep the maximum number of events per second
                 if (reportsWait > 0)
                 {
-                    std::this_thread::sleep_for(std::chrono::microseconds(reportsWait));
+                    std::this_thread::sleep_for(std::chrono::microseconds(reportsWait * batchedCount));
                 }
-                logDebug2(WM_VULNSCAN_LOGTAG, "Report sent: %s", data.c_str());
-                dataQueue.pop();
             }
         },
         {.dbPath = REPORTS_QUEUE_PATH, .bulkSize = REPORTS_BULK_SIZE});
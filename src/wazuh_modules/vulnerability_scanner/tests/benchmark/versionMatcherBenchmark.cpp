@@ -114,6 +114,21 @@ BENCHMARK_DEFINE_F(ComparisonCalVerPerformanceFixture, ComparisonCalVerPerforman
     }
 }
 
+BENCHMARK_DEFINE_F(ComparisonCalVerPerformanceFixture, ComparisonCalVerCachedPerformance)(benchmark::State& state)
+{
+    // Once the vectors have been traversed, every comparison hits the parse cache.
+    VersionObjectCache cache;
+    for (auto _ : state)
+    {
+        VersionMatcher::compare(
+            vectorVersionA[currentIdx], vectorVersionB[currentIdx], VersionObjectType::CalVer, cache);
+        if (++currentIdx >= CALVER_VECTOR_SIZE)
+        {
+            currentIdx = 0;
+        }
+    }
+}
+
 constexpr size_t PEP440_VECTOR_SIZE {1000};
 constexpr int PEP440_PROBABILITY_EQUAL {20};
 constexpr int PEP440_PROBABILITY_EPOCH {50};
@@ -413,6 +428,9 @@ BENCHMARK_DEFINE_F(ComparisonSemVerPerformanceFixture, ComparisonSemVerPerforman
 }
 
 BENCHMARK_REGISTER_F(ComparisonCalVerPerformanceFixture, ComparisonCalVerPerformance)->Iterations(100000)->Threads(1);
+BENCHMARK_REGISTER_F(ComparisonCalVerPerformanceFixture, ComparisonCalVerCachedPerformance)
+    ->Iterations(100000)
+    ->Threads(1);
 BENCHMARK_REGISTER_F(ComparisonPEP440PerformanceFixture, ComparisonPEP440Performance)->Iterations(100000)->Threads(1);
 BENCHMARK_REGISTER_F(ComparisonMajorMinorPerformanceFixture, ComparisonMajorMinorPerformance)
     ->Iterations(100000)
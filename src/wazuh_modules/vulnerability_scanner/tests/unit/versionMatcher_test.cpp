@@ -907,3 +907,46 @@ TEST_F(VersionMatcherTest, matchRPM)
 
     EXPECT_NO_THROW(VersionMatcher::compare("invalid", "3:2.3.15-24.el8", VersionObjectType::RPM));
 }
+
+TEST_F(VersionMatcherTest, cachedCompare)
+{
+    VersionObjectCache cache;
+
+    // The cached overload must agree with the uncached one and grow one entry per distinct (version, type) pair.
+    EXPECT_EQ(VersionMatcher::compare("1.2.3", "1.2.4", VersionObjectType::SemVer, cache),
+              VersionComparisonResult::A_LESS_THAN_B);
+    EXPECT_EQ(cache.size(), 2u);
+
+    EXPECT_EQ(VersionMatcher::compare("1.2.3", "1.2.4", VersionObjectType::SemVer, cache),
+              VersionComparisonResult::A_LESS_THAN_B);
+    EXPECT_EQ(cache.size(), 2u);
+
+    EXPECT_EQ(VersionMatcher::compare("1.2.4", "1.2.3", VersionObjectType::SemVer, cache),
+              VersionComparisonResult::A_GREATER_THAN_B);
+    EXPECT_EQ(VersionMatcher::compare("1.2.3", "1.2.3", VersionObjectType::SemVer, cache),
+              VersionComparisonResult::A_EQUAL_B);
+    EXPECT_EQ(cache.size(), 2u);
+
+    // The same version string parsed with another type is a distinct cache entry.
+    EXPECT_EQ(VersionMatcher::compare("1.2.3", "1.2.4", VersionObjectType::DPKG, cache),
+              VersionComparisonResult::A_LESS_THAN_B);
+    EXPECT_EQ(cache.size(), 4u);
+
+    // Failed parses are cached too, and keep throwing from the cached path.
+    EXPECT_THROW(VersionMatcher::compare("not-a-version", "1.2.3", VersionObjectType::SemVer, cache),
+                 std::invalid_argument);
+    EXPECT_EQ(cache.size(), 5u);
+    EXPECT_THROW(VersionMatcher::compare("not-a-version", "1.2.3", VersionObjectType::SemVer, cache),
+                 std::invalid_argument);
+    EXPECT_EQ(cache.size(), 5u);
+}
+
+TEST_F(VersionMatcherTest, cachedMatch)
+{
+    VersionObjectCache cache;
+
+    EXPECT_TRUE(VersionMatcher::match("1.2.3", VersionObjectType::SemVer, cache));
+    EXPECT_TRUE(VersionMatcher::match("1.2.3", VersionObjectType::SemVer, cache));
+    EXPECT_FALSE(VersionMatcher::match("not-a-version", VersionObjectType::SemVer, cache));
+    EXPECT_EQ(cache.size(), 2u);
+}
@@ -36,6 +36,9 @@ public:
         , m_columnFamily {paramValueOf(argc, argv, "-c", std::make_pair(false, ""))}
         , m_seekKey {paramValueOf(argc, argv, "-s", std::make_pair(false, ""))}
         , m_value {paramValueOf(argc, argv, "-v", std::make_pair(false, ""))}
+        , m_prefixLength {paramValueOf(argc, argv, "-p", std::make_pair(false, "0"))}
+        , m_sampleRate {paramValueOf(argc, argv, "-n", std::make_pair(false, "1"))}
+        , m_stats {paramExists(argc, argv, "-t")}
     {
     }
 
@@ -99,6 +102,37 @@ public:
         return m_seekKey;
     }
 
+    /**
+     * @brief Whether the statistics mode was requested.
+     *
+     * @return bool True if statistics were requested.
+     */
+    bool getStats()
+    {
+        return m_stats;
+    }
+
+    /**
+     * @brief Get the prefix length used to group keys in the statistics histograms.
+     *
+     * @return size_t Prefix length, 0 to group by the segment up to the first '_'.
+     */
+    size_t getPrefixLength()
+    {
+        return std::stoul(m_prefixLength);
+    }
+
+    /**
+     * @brief Get the sampling rate: only every Nth key is inspected.
+     *
+     * @return size_t Sampling rate, 1 to inspect every key.
+     */
+    size_t getSampleRate()
+    {
+        const auto rate {std::stoul(m_sampleRate)};
+        return rate == 0 ? 1 : rate;
+    }
+
     /**
      * @brief Shows the help to the user.
      */
@@ -113,12 +147,18 @@ public:
                   << "\t-c <columnFamily> \tColumn family to query. Optional, default column if not present.\n"
                   << "\t-s <key> \t\tKey to seek. Optional, prints all values if not present.\n"
                   << "\t-v <value> \t\tValue to insert for. Optional, performs a get if not present.\n"
+                  << "\t-t \t\t\tStatistics mode: scans the column families in parallel and prints key\n"
+                  << "\t\t\t\tcounts, size histograms per key prefix and SST level stats.\n"
+                  << "\t-p <length> \t\tPrefix length used to group keys in the statistics histograms.\n"
+                  << "\t\t\t\tOptional, groups by the segment up to the first '_' if not present.\n"
+                  << "\t-n <rate> \t\tSampling rate, only every Nth key is inspected. Optional, defaults to 1.\n"
                   << "\nExample:"
                   << "\n\t./rocksDBQuery -d rocksDBPath/ [-f schema.fbs] \n"
                   << "\n\t./rocksDBQuery -d rocksDBPath/ [-f schema.fbs] -k key1 \n"
                   << "\n\t./rocksDBQuery -d rocksDBPath/ [-f schema.fbs] -s CVE_ \n"
                   << "\n\t./rocksDBQuery -d rocksDBPath/ [-f schema.fbs] -c columnFamily1 \n"
                   << "\n\t./rocksDBQuery -d rocksDBPath/ -k key1 -v val1 -c column\n"
+                  << "\n\t./rocksDBQuery -d rocksDBPath/ -t [-c columnFamily1] [-p 4] [-n 100]\n"
                   << std::endl;
     }
 
@@ -147,12 +187,28 @@ private:
         return required.second;
     }
 
+    static bool paramExists(const int argc, const char* argv[], const std::string& switchValue)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            if (switchValue == argv[i])
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     const std::string m_dbPath;
     const std::string m_fbsPath;
     const std::string m_key;
     const std::string m_columnFamily;
     const std::string m_seekKey;
     const std::string m_value;
+    const std::string m_prefixLength;
+    const std::string m_sampleRate;
+    const bool m_stats;
 };
 
 #endif // _CMD_ARGS_PARSER_HPP_
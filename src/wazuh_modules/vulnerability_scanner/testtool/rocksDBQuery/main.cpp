@@ -13,7 +13,110 @@
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/idl.h"
 #include "rocksDBWrapper.hpp"
+#include <algorithm>
 #include <iostream>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Aggregated figures of one column family scan.
+ */
+struct ColumnStats
+{
+    std::string column;                                            ///< Column family name.
+    uint64_t keys {0};                                             ///< Inspected keys.
+    uint64_t keyBytes {0};                                         ///< Accumulated key sizes.
+    uint64_t valueBytes {0};                                       ///< Accumulated value sizes.
+    std::map<std::string, std::pair<uint64_t, uint64_t>> prefixes; ///< Key count and bytes per prefix.
+    std::string estimatedKeys;                                     ///< rocksdb.estimate-num-keys.
+    std::string sstFilesSize;                                      ///< rocksdb.total-sst-files-size.
+    std::string levelStats;                                        ///< rocksdb.levelstats.
+};
+
+/**
+ * @brief Walks a column family accumulating key counts and sizes grouped by prefix.
+ *
+ * @param rocksDB Database to scan.
+ * @param columnName Column family to scan.
+ * @param prefixLength Prefix length used to group keys, 0 to group by the segment up to the first '_'.
+ * @param sampleRate Only every Nth key is inspected.
+ * @return ColumnStats Aggregated figures.
+ */
+ColumnStats collectColumnStats(Utils::RocksDBWrapper& rocksDB,
+                               const std::string& columnName,
+                               const size_t prefixLength,
+                               const size_t sampleRate)
+{
+    ColumnStats stats;
+    stats.column = columnName;
+
+    uint64_t index {0};
+    for (const auto& [key, value] : rocksDB.begin(columnName))
+    {
+        if (index++ % sampleRate != 0)
+        {
+            continue;
+        }
+
+        ++stats.keys;
+        stats.keyBytes += key.size();
+        stats.valueBytes += value.size();
+
+        const auto prefix {prefixLength != 0 ? key.substr(0, prefixLength) : key.substr(0, key.find('_'))};
+        auto& [count, bytes] = stats.prefixes[prefix];
+        ++count;
+        bytes += key.size() + value.size();
+    }
+
+    stats.estimatedKeys = rocksDB.getProperty("rocksdb.estimate-num-keys", columnName);
+    stats.sstFilesSize = rocksDB.getProperty("rocksdb.total-sst-files-size", columnName);
+    stats.levelStats = rocksDB.getProperty("rocksdb.levelstats", columnName);
+
+    return stats;
+}
+
+/**
+ * @brief Prints the report of one column family scan.
+ *
+ * @param stats Aggregated figures.
+ * @param sampleRate Sampling rate used during the scan.
+ */
+void printColumnStats(const ColumnStats& stats, const size_t sampleRate)
+{
+    constexpr size_t TOP_PREFIXES {20};
+
+    std::cout << "=== Column family: " << stats.column << " ===" << std::endl;
+    if (sampleRate > 1)
+    {
+        std::cout << "Sampled every " << sampleRate << " keys, counts and sizes are partial." << std::endl;
+    }
+    std::cout << "Keys: " << stats.keys << " (estimate-num-keys: " << stats.estimatedKeys << ")" << std::endl;
+    std::cout << "Key bytes: " << stats.keyBytes << ", value bytes: " << stats.valueBytes
+              << ", SST files bytes: " << stats.sstFilesSize << std::endl;
+    std::cout << stats.levelStats;
+
+    std::vector<std::pair<std::string, std::pair<uint64_t, uint64_t>>> ordered(stats.prefixes.begin(),
+                                                                               stats.prefixes.end());
+    std::sort(ordered.begin(),
+              ordered.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.second.second > rhs.second.second; });
+
+    std::cout << "Top prefixes by size:" << std::endl;
+    size_t printed {0};
+    for (const auto& [prefix, figures] : ordered)
+    {
+        if (printed++ == TOP_PREFIXES)
+        {
+            std::cout << "\t... " << ordered.size() - TOP_PREFIXES << " more prefixes" << std::endl;
+            break;
+        }
+        std::cout << "\t" << prefix << " ==> keys: " << figures.first << ", bytes: " << figures.second << std::endl;
+    }
+}
+} // namespace
 
 int main(const int argc, const char** argv)
 {
@@ -59,11 +162,57 @@ int main(const int argc, const char** argv)
             }
         };
 
-        if (!seekKey.empty())
+        if (cmdLineArgs.getStats())
         {
+            const auto columns {columnFamily.empty() ? rocksDB.getAllColumns()
+                                                     : std::vector<std::string> {columnFamily}};
+
+            // One scan thread per column family, the reports are printed once every scan joined.
+            std::vector<ColumnStats> stats(columns.size());
+            std::vector<std::string> errors(columns.size());
+            std::vector<std::thread> scanners;
+            scanners.reserve(columns.size());
+
+            for (size_t i = 0; i < columns.size(); ++i)
+            {
+                scanners.emplace_back(
+                    [&, i]()
+                    {
+                        try
+                        {
+                            stats[i] = collectColumnStats(
+                                rocksDB, columns[i], cmdLineArgs.getPrefixLength(), cmdLineArgs.getSampleRate());
+                        }
+                        catch (const std::exception& e)
+                        {
+                            errors[i] = e.what();
+                        }
+                    });
+            }
+
+            for (auto& scanner : scanners)
+            {
+                scanner.join();
+            }
+
+            for (size_t i = 0; i < columns.size(); ++i)
+            {
+                if (!errors[i].empty())
+                {
+                    throw std::runtime_error("Unable to scan column '" + columns[i] + "': " + errors[i]);
+                }
+                printColumnStats(stats[i], cmdLineArgs.getSampleRate());
+            }
+        }
+        else if (!seekKey.empty())
+        {
+            size_t index {0};
             for (const auto& [key, value] : rocksDB.seek(seekKey, columnFamily))
             {
-                printValue(key, value);
+                if (index++ % cmdLineArgs.getSampleRate() == 0)
+                {
+                    printValue(key, value);
+                }
             }
         }
         else if (!value.empty() && !requestedKey.empty())
@@ -101,9 +250,13 @@ int main(const int argc, const char** argv)
         }
         else
         {
+            size_t index {0};
             for (const auto& [key, value] : rocksDB.begin(columnFamily))
             {
-                printValue(key, value);
+                if (index++ % cmdLineArgs.getSampleRate() == 0)
+                {
+                    printValue(key, value);
+                }
             }
         }
     }